@@ -28,8 +28,11 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <set>
 #include "benchmark/benchmark.h"
 #include "benchmarks.pb.h"
 #include "datasets/google_message1/proto2/benchmark_message1_proto2.pb.h"
@@ -37,7 +40,16 @@
 #include "datasets/google_message2/benchmark_message2.pb.h"
 #include "datasets/google_message3/benchmark_message3.pb.h"
 #include "datasets/google_message4/benchmark_message4.pb.h"
-
+#include "google/protobuf/descriptor.pb.h"
+#include "google/protobuf/dynamic_message.h"
+#include "google/protobuf/field_mask.pb.h"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl_lite.h"
+#include "google/protobuf/map.h"
+#include "google/protobuf/text_format.h"
+#include "google/protobuf/util/field_mask_util.h"
+#include "google/protobuf/util/json_util.h"
+#include "google/protobuf/util/message_differencer.h"
 
 #define PREFIX "dataset."
 #define SUFFIX ".pb"
@@ -46,8 +58,26 @@ using benchmarks::BenchmarkDataset;
 using google::protobuf::Arena;
 using google::protobuf::Descriptor;
 using google::protobuf::DescriptorPool;
+using google::protobuf::DynamicMessageFactory;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::FieldMask;
+using google::protobuf::FileDescriptor;
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::Map;
 using google::protobuf::Message;
 using google::protobuf::MessageFactory;
+using google::protobuf::TextFormat;
+using google::protobuf::int32;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::io::StringOutputStream;
+using google::protobuf::util::FieldMaskUtil;
+using google::protobuf::util::JsonStringToMessage;
+using google::protobuf::util::MessageDifferencer;
+using google::protobuf::util::MessageToJsonString;
+
+// Thread counts of the multi-threaded benchmarks.
+static const int kMinThreads = 2;
+static const int kMaxThreads = 8;
 
 class Fixture : public benchmark::Fixture {
  public:
@@ -156,39 +186,485 @@ class ParseReuseFixture : public Fixture {
   }
 };
 
+// Base of the benchmarks that start from the parsed payloads.
 template <class T>
-class SerializeFixture : public Fixture {
+class MessageFixture : public Fixture {
  public:
-  SerializeFixture(const BenchmarkDataset& dataset)
-      : Fixture(dataset, "_serialize") {
+  MessageFixture(const BenchmarkDataset& dataset, const std::string& suffix)
+      : Fixture(dataset, suffix) {
     for (size_t i = 0; i < payloads_.size(); i++) {
       message_.push_back(new T);
       message_.back()->ParseFromString(payloads_[i]);
     }
   }
 
-  ~SerializeFixture() {
+  ~MessageFixture() {
     for (size_t i = 0; i < message_.size(); i++) {
       delete message_[i];
     }
   }
 
+ protected:
+  std::vector<T*> message_;
+};
+
+template <class T>
+class SerializeFixture : public MessageFixture<T> {
+ public:
+  SerializeFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_serialize") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string str;
+    WrappingCounter i(this->payloads_.size());
+
+    while (state.KeepRunning()) {
+      str.clear();
+      this->message_[i.Next()]->SerializeToString(&str);
+      total += str.size();
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
+template <class T>
+class SerializeDeterministicFixture : public MessageFixture<T> {
+ public:
+  SerializeDeterministicFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_serialize_deterministic") {}
+
   virtual void BenchmarkCase(benchmark::State& state) {
     size_t total = 0;
     std::string str;
+    WrappingCounter i(this->payloads_.size());
+
+    while (state.KeepRunning()) {
+      str.clear();
+      {
+        StringOutputStream output(&str);
+        CodedOutputStream coded_output(&output);
+        coded_output.SetSerializationDeterministic(true);
+        this->message_[i.Next()]->SerializeToCodedStream(&coded_output);
+      }
+      total += str.size();
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
+template <class T>
+class ParseDynamicFixture : public Fixture {
+ public:
+  ParseDynamicFixture(const BenchmarkDataset& dataset)
+      : Fixture(dataset, "_parse_dynamic") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    DynamicMessageFactory factory;
+    const Message* prototype =
+        factory.GetPrototype(prototype_->GetDescriptor());
     WrappingCounter i(payloads_.size());
+    size_t total = 0;
+
+    while (state.KeepRunning()) {
+      std::unique_ptr<Message> m(prototype->New());
+      const std::string& payload = payloads_[i.Next()];
+      total += payload.size();
+      m->ParseFromString(payload);
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
+template <class T>
+class SerializeJsonFixture : public MessageFixture<T> {
+ public:
+  SerializeJsonFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_serialize_json") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string str;
+    WrappingCounter i(this->payloads_.size());
 
     while (state.KeepRunning()) {
       str.clear();
-      message_[i.Next()]->SerializeToString(&str);
+      if (!MessageToJsonString(*this->message_[i.Next()], &str).ok()) {
+        state.SkipWithError("Message can't be printed as JSON");
+        break;
+      }
+      total += str.size();
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
+template <class T>
+class ParseJsonFixture : public MessageFixture<T> {
+ public:
+  ParseJsonFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_parse_json") {
+    for (size_t i = 0; i < this->message_.size(); i++) {
+      json_.push_back(std::string());
+      if (!MessageToJsonString(*this->message_[i], &json_.back()).ok()) {
+        json_.clear();
+        break;
+      }
+    }
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    if (json_.empty()) {
+      state.SkipWithError("Message can't be printed as JSON");
+      return;
+    }
+    T m;
+    WrappingCounter i(json_.size());
+    size_t total = 0;
+
+    while (state.KeepRunning()) {
+      const std::string& json = json_[i.Next()];
+      total += json.size();
+      JsonStringToMessage(json, &m);
+    }
+
+    state.SetBytesProcessed(total);
+  }
+
+ private:
+  std::vector<std::string> json_;
+};
+
+template <class T>
+class SerializeTextFixture : public MessageFixture<T> {
+ public:
+  SerializeTextFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_serialize_text") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string str;
+    WrappingCounter i(this->payloads_.size());
+
+    while (state.KeepRunning()) {
+      TextFormat::PrintToString(*this->message_[i.Next()], &str);
       total += str.size();
     }
 
+    state.SetBytesProcessed(total);
+  }
+};
+
+template <class T>
+class ParseTextFixture : public MessageFixture<T> {
+ public:
+  ParseTextFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_parse_text") {
+    for (size_t i = 0; i < this->message_.size(); i++) {
+      text_.push_back(std::string());
+      TextFormat::PrintToString(*this->message_[i], &text_.back());
+    }
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    T m;
+    WrappingCounter i(text_.size());
+    size_t total = 0;
+
+    while (state.KeepRunning()) {
+      const std::string& text = text_[i.Next()];
+      total += text.size();
+      TextFormat::ParseFromString(text, &m);
+    }
+
     state.SetBytesProcessed(total);
   }
 
  private:
-  std::vector<T*> message_;
+  std::vector<std::string> text_;
+};
+
+// Compares every message with an equal copy, which visits all of its fields.
+template <class T>
+class CompareFixture : public MessageFixture<T> {
+ public:
+  CompareFixture(const BenchmarkDataset& dataset)
+      : MessageFixture<T>(dataset, "_compare_differencer") {
+    for (size_t i = 0; i < this->message_.size(); i++) {
+      copy_.push_back(new T(*this->message_[i]));
+    }
+  }
+
+  ~CompareFixture() {
+    for (size_t i = 0; i < copy_.size(); i++) {
+      delete copy_[i];
+    }
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    WrappingCounter i(this->payloads_.size());
+    size_t total = 0;
+
+    while (state.KeepRunning()) {
+      size_t index = i.Next();
+      total += this->payloads_[index].size();
+      if (!MessageDifferencer::Equals(*this->message_[index], *copy_[index])) {
+        state.SkipWithError("Copies of the message compare different");
+        break;
+      }
+    }
+
+    state.SetBytesProcessed(total);
+  }
+
+ private:
+  std::vector<T*> copy_;
+};
+
+// Uses a mask selecting every other field of the top-level message.
+template <class T>
+class FieldMaskFixture : public MessageFixture<T> {
+ public:
+  FieldMaskFixture(const BenchmarkDataset& dataset, const std::string& suffix)
+      : MessageFixture<T>(dataset, suffix),
+        mask_(T::descriptor(), MakeMask(T::descriptor())) {}
+
+ protected:
+  FieldMaskUtil::CompiledFieldMask mask_;
+
+ private:
+  static FieldMask MakeMask(const Descriptor* descriptor) {
+    FieldMask mask;
+    for (int i = 0; i < descriptor->field_count(); i += 2) {
+      mask.add_paths(descriptor->field(i)->name());
+    }
+    return mask;
+  }
+};
+
+template <class T>
+class FieldMaskMergeFixture : public FieldMaskFixture<T> {
+ public:
+  FieldMaskMergeFixture(const BenchmarkDataset& dataset)
+      : FieldMaskFixture<T>(dataset, "_field_mask_merge") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    T m;
+    FieldMaskUtil::MergeOptions options;
+    WrappingCounter i(this->payloads_.size());
+    size_t total = 0;
+
+    while (state.KeepRunning()) {
+      size_t index = i.Next();
+      total += this->payloads_[index].size();
+      m.Clear();
+      FieldMaskUtil::MergeMessageTo(*this->message_[index], this->mask_,
+                                    options, &m);
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
+template <class T>
+class FieldMaskSerializeFixture : public FieldMaskFixture<T> {
+ public:
+  FieldMaskSerializeFixture(const BenchmarkDataset& dataset)
+      : FieldMaskFixture<T>(dataset, "_field_mask_serialize") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string str;
+    WrappingCounter i(this->payloads_.size());
+
+    while (state.KeepRunning()) {
+      str.clear();
+      FieldMaskUtil::SerializeMessageToString(*this->message_[i.Next()],
+                                              this->mask_, &str);
+      total += str.size();
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
+// ---------------------------------------------------------------------
+// Benchmarks that do not depend on the datasets.
+
+template <typename Key>
+Key MakeKey(int i);
+
+template <>
+int32 MakeKey<int32>(int i) {
+  return i * 7919;
+}
+
+template <>
+std::string MakeKey<std::string>(int i) {
+  return "key_" + std::to_string(i * 7919);
+}
+
+template <typename Key>
+std::vector<Key> MakeKeys(int n) {
+  std::vector<Key> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(MakeKey<Key>(i));
+  }
+  return keys;
+}
+
+template <typename Key>
+static void BM_MapInsert(benchmark::State& state) {
+  const std::vector<Key> keys = MakeKeys<Key>(state.range(0));
+
+  while (state.KeepRunning()) {
+    Map<Key, int32> map;
+    for (size_t i = 0; i < keys.size(); i++) {
+      map[keys[i]] = i;
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(BM_MapInsert, int32)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(BM_MapInsert, std::string)->Range(8, 8 << 10);
+
+template <typename Key>
+static void BM_MapLookup(benchmark::State& state) {
+  const std::vector<Key> keys = MakeKeys<Key>(state.range(0));
+  Map<Key, int32> map;
+  for (size_t i = 0; i < keys.size(); i++) {
+    map[keys[i]] = i;
+  }
+
+  while (state.KeepRunning()) {
+    int32 sum = 0;
+    for (size_t i = 0; i < keys.size(); i++) {
+      sum += map.find(keys[i])->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(BM_MapLookup, int32)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(BM_MapLookup, std::string)->Range(8, 8 << 10);
+
+// The files defining the dataset messages, dependencies first.
+static std::vector<const FileDescriptor*> DatasetFiles() {
+  const FileDescriptor* roots[] = {
+      benchmarks::proto2::GoogleMessage1::descriptor()->file(),
+      benchmarks::proto3::GoogleMessage1::descriptor()->file(),
+      benchmarks::proto2::GoogleMessage2::descriptor()->file(),
+      benchmarks::google_message3::GoogleMessage3::descriptor()->file(),
+      benchmarks::google_message4::GoogleMessage4::descriptor()->file(),
+  };
+  std::vector<const FileDescriptor*> files;
+  std::set<const FileDescriptor*> seen;
+  // Depth-first, adding a file after all of its dependencies.
+  std::vector<std::pair<const FileDescriptor*, int> > stack;
+  for (size_t i = 0; i < sizeof(roots) / sizeof(roots[0]); i++) {
+    if (!seen.insert(roots[i]).second) continue;
+    stack.push_back(std::make_pair(roots[i], 0));
+    while (!stack.empty()) {
+      const FileDescriptor* file = stack.back().first;
+      int next = stack.back().second++;
+      if (next == file->dependency_count()) {
+        files.push_back(file);
+        stack.pop_back();
+      } else if (seen.insert(file->dependency(next)).second) {
+        stack.push_back(std::make_pair(file->dependency(next), 0));
+      }
+    }
+  }
+  return files;
+}
+
+static void BM_DescriptorPoolBuild(benchmark::State& state) {
+  std::vector<const FileDescriptor*> files = DatasetFiles();
+  std::vector<FileDescriptorProto> protos(files.size());
+  for (size_t i = 0; i < files.size(); i++) {
+    files[i]->CopyTo(&protos[i]);
+  }
+
+  while (state.KeepRunning()) {
+    DescriptorPool pool;
+    for (size_t i = 0; i < protos.size(); i++) {
+      GOOGLE_CHECK(pool.BuildFile(protos[i]) != NULL);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * protos.size());
+}
+BENCHMARK(BM_DescriptorPoolBuild);
+
+static void AddMessageNames(const Descriptor* descriptor,
+                            std::vector<std::string>* messages,
+                            std::vector<std::string>* fields) {
+  messages->push_back(descriptor->full_name());
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    fields->push_back(descriptor->field(i)->full_name());
+  }
+  for (int i = 0; i < descriptor->nested_type_count(); i++) {
+    AddMessageNames(descriptor->nested_type(i), messages, fields);
+  }
+}
+
+static void BM_DescriptorPoolLookup(benchmark::State& state) {
+  std::vector<const FileDescriptor*> files = DatasetFiles();
+  std::vector<std::string> messages;
+  std::vector<std::string> fields;
+  for (size_t i = 0; i < files.size(); i++) {
+    for (int j = 0; j < files[i]->message_type_count(); j++) {
+      AddMessageNames(files[i]->message_type(j), &messages, &fields);
+    }
+  }
+  const DescriptorPool* pool = DescriptorPool::generated_pool();
+
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < messages.size(); i++) {
+      benchmark::DoNotOptimize(pool->FindMessageTypeByName(messages[i]));
+    }
+    for (size_t i = 0; i < fields.size(); i++) {
+      benchmark::DoNotOptimize(pool->FindFieldByName(fields[i]));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          (messages.size() + fields.size()));
+}
+BENCHMARK(BM_DescriptorPoolLookup);
+
+// All threads allocate messages on the same arena. The arena can only be
+// reset while no thread uses it, so the number of iterations is fixed to
+// bound its size, and the first thread to start a run resets it before the
+// threads are released together.
+class SharedArenaFixture : public benchmark::Fixture {
+ public:
+  SharedArenaFixture() : running_(0) { SetName("BM_ArenaSharedAllocate"); }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    if (running_.fetch_add(1) == 0) {
+      arena_.Reset();
+    }
+
+    while (state.KeepRunning()) {
+      benchmark::DoNotOptimize(
+          Arena::CreateMessage<benchmarks::proto3::GoogleMessage1>(&arena_));
+    }
+
+    running_.fetch_sub(1);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+ private:
+  Arena arena_;
+  std::atomic<int> running_;
 };
 
 std::string ReadFile(const std::string& name) {
@@ -211,6 +687,28 @@ void RegisterBenchmarksForType(const BenchmarkDataset& dataset) {
       new ParseNewArenaFixture<T>(dataset));
   ::benchmark::internal::RegisterBenchmarkInternal(
       new SerializeFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new ParseNewArenaFixture<T>(dataset))
+      ->ThreadRange(kMinThreads, kMaxThreads)
+      ->UseRealTime();
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new SerializeDeterministicFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new ParseDynamicFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new ParseJsonFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new SerializeJsonFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new ParseTextFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new SerializeTextFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new CompareFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new FieldMaskMergeFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new FieldMaskSerializeFixture<T>(dataset));
 }
 
 void RegisterBenchmarks(const std::string& dataset_bytes) {
@@ -249,6 +747,10 @@ int main(int argc, char *argv[]) {
       RegisterBenchmarks(ReadFile(argv[i]));
     }
   }
+  ::benchmark::internal::RegisterBenchmarkInternal(new SharedArenaFixture)
+      ->Iterations(1 << 16)
+      ->ThreadRange(1, kMaxThreads)
+      ->UseRealTime();
 
   ::benchmark::RunSpecifiedBenchmarks();
 }
@@ -63,8 +63,20 @@ def __parse_cpp_result(filename):
   with open(filename) as f:
     results = json.loads(f.read())
     for benchmark in results["benchmarks"]:
+      if benchmark.get("error_occurred"):
+        continue
+      if "bytes_per_second" not in benchmark:
+        # Benchmarks that do not use a dataset report items per second.
+        __results.append({
+          "language": "cpp",
+          "dataFilename": "",
+          "behavior": benchmark["name"],
+          "throughput": benchmark["items_per_second"]
+        })
+        continue
       data_filename = "".join(
-          re.split("(_parse_|_serialize)", benchmark["name"])[0])
+          re.split("(_parse_|_serialize|_compare_|_field_mask_)",
+                   benchmark["name"])[0])
       behavior = benchmark["name"][len(data_filename) + 1:]
       if data_filename[:2] == "BM":
         data_filename = data_filename[3:]
@@ -134,6 +134,7 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/compiler/annotation_test_util.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/command_line_interface_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_bootstrap_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_generator_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_move_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_plugin_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_unittest.cc
@@ -186,6 +187,7 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/stubs/time_test.cc
   ${protobuf_source_dir}/src/google/protobuf/text_format_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/unknown_field_set_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/any_resolver_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/delimited_message_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/field_comparator_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/field_mask_util_test.cc
@@ -197,6 +199,8 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/util/internal/type_info_test_helper.cc
   ${protobuf_source_dir}/src/google/protobuf/util/json_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/message_differencer_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/message_hasher_test.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/space_used_report_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/time_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/type_resolver_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/well_known_types_unittest.cc
@@ -231,10 +235,27 @@ set(test_plugin_files
 add_executable(test_plugin ${test_plugin_files})
 target_link_libraries(test_plugin libprotoc libprotobuf gmock)
 
+# The messages of cpp_test_sharded_lite.proto are spread over several .cc
+# files, to test that those compile and link.
+set(sharded_lite_test_proto_files
+  ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_test_sharded_lite.pb.cc
+  ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_test_sharded_lite.out/0.cc
+  ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_test_sharded_lite.out/1.cc
+  ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_test_sharded_lite.out/2.cc
+)
+add_custom_command(
+  OUTPUT ${sharded_lite_test_proto_files}
+  DEPENDS protoc ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+  COMMAND protoc ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+      --proto_path=${protobuf_source_dir}/src
+      --cpp_out=lite_implicit_weak_fields=3:${protobuf_source_dir}/src
+)
+
 set(lite_test_files
+  ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_sharded_lite_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/lite_unittest.cc
 )
-add_executable(lite-test ${lite_test_files} ${common_lite_test_files} ${lite_test_proto_files})
+add_executable(lite-test ${lite_test_files} ${common_lite_test_files} ${lite_test_proto_files} ${sharded_lite_test_proto_files})
 target_link_libraries(lite-test libprotobuf-lite gmock_main)
 
 set(lite_arena_test_files
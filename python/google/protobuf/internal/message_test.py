@@ -45,6 +45,7 @@ abstract interface.
 __author__ = 'gps@google.com (Gregory P. Smith)'
 
 
+import array
 import collections
 import copy
 import math
@@ -53,7 +54,9 @@ import pickle
 import pydoc
 import six
 import sys
+import threading
 import warnings
+import weakref
 
 try:
   import unittest2 as unittest  # PY26
@@ -845,6 +848,171 @@ class MessageTest(BaseTestCase):
     m1.MergeFromString(b'')  # field state should not change
     self.assertFalse(m1.HasField('optional_nested_message'))
 
+  def testMergeFromLargeString(self, message_module):
+    # The C++ implementation parses large inputs into an empty message without
+    # holding the GIL; a message that is not empty is parsed in place.
+    m2 = message_module.TestAllTypes()
+    m2.optional_int32 = 2
+    m2.optional_nested_message.bb = 2
+    m2.repeated_string.extend(['x' * 100] * 1000)
+    serialized = m2.SerializeToString()
+
+    m1 = message_module.TestAllTypes()
+    m1.optional_int32 = 1
+    m1.optional_int64 = 1
+    m1.repeated_string.append('first')
+    nested = m1.optional_nested_message
+    m1.MergeFromString(serialized)
+    self.assertEqual(2, m1.optional_int32)
+    self.assertEqual(1, m1.optional_int64)
+    self.assertEqual(2, nested.bb)
+    self.assertEqual(1001, len(m1.repeated_string))
+    self.assertEqual('first', m1.repeated_string[0])
+
+    m3 = message_module.TestAllTypes()
+    m3.ParseFromString(serialized)
+    self.assertEqual(m2, m3)
+    m3.ParseFromString(bytearray(serialized))
+    self.assertEqual(m2, m3)
+
+  def testFromStrings(self, message_module):
+    m1 = message_module.TestAllTypes(optional_int32=1)
+    m2 = message_module.TestAllTypes(repeated_string=['x' * 100] * 1000)
+    serialized = [m1.SerializeToString(), b'',
+                  bytearray(m2.SerializeToString())]
+    parsed = message_module.TestAllTypes.FromStrings(serialized)
+    self.assertEqual([m1, message_module.TestAllTypes(), m2], parsed)
+    self.assertEqual([], message_module.TestAllTypes.FromStrings([]))
+    parsed[0].optional_nested_message.bb = 2
+    self.assertEqual(2, parsed[0].optional_nested_message.bb)
+    with self.assertRaisesRegexp(message.DecodeError,
+                                 'Error parsing message at index 1'):
+      message_module.TestAllTypes.FromStrings([serialized[0], b'\x0a\x02'])
+    with self.assertRaises(TypeError):
+      message_module.TestAllTypes.FromStrings([serialized[0], 1])
+
+  def testFromDelimitedString(self, message_module):
+    messages = [message_module.TestAllTypes(optional_int32=i)
+                for i in range(3)]
+    messages.append(message_module.TestAllTypes())
+    messages.append(message_module.TestAllTypes(repeated_int64=[1] * 200))
+    serialized = b''.join(
+        encoder._VarintBytes(m.ByteSize()) + m.SerializeToString()
+        for m in messages)
+    self.assertEqual(
+        messages, message_module.TestAllTypes.FromDelimitedString(serialized))
+    self.assertEqual(
+        messages,
+        message_module.TestAllTypes.FromDelimitedString(bytearray(serialized)))
+    self.assertEqual(
+        messages,
+        message_module.TestAllTypes.FromDelimitedString(
+            memoryview(serialized)))
+    self.assertEqual([], message_module.TestAllTypes.FromDelimitedString(b''))
+    self.assertEqual(
+        [], message_module.TestAllTypes.FromDelimitedString(bytearray()))
+    with self.assertRaisesRegexp(message.DecodeError,
+                                 'Truncated message at index 4'):
+      message_module.TestAllTypes.FromDelimitedString(serialized[:-1])
+    with self.assertRaisesRegexp(message.DecodeError,
+                                 'Truncated message at index 0'):
+      message_module.TestAllTypes.FromDelimitedString(b'\x80')
+    with self.assertRaisesRegexp(message.DecodeError,
+                                 'Truncated message at index 1'):
+      message_module.TestAllTypes.FromDelimitedString(
+          bytearray(b'\x00\x80'))
+    with self.assertRaisesRegexp(message.DecodeError,
+                                 'Error parsing message at index 1'):
+      message_module.TestAllTypes.FromDelimitedString(
+          bytearray(b'\x00\x02\x0a\x02'))
+
+  def testParseAndSerializeFromThreads(self, message_module):
+    m = message_module.TestAllTypes()
+    m.repeated_string.extend(['x' * 100] * 1000)
+    serialized = m.SerializeToString()
+    results = []
+
+    def ParseAndSerialize():
+      for _ in range(10):
+        parsed = message_module.TestAllTypes.FromString(serialized)
+        results.append(parsed.SerializeToString() == serialized)
+
+    threads = [threading.Thread(target=ParseAndSerialize) for _ in range(4)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+    self.assertEqual([True] * 40, results)
+
+  def testSerializeWhileModifiedFromThread(self, message_module):
+    a = message_module.TestAllTypes()
+    a.repeated_string.extend(['a' * 100] * 1000)
+    b = message_module.TestAllTypes()
+    b.optional_nested_message.bb = 1
+    b.repeated_string.extend(['b' * 200] * 500)
+    expected = (a.SerializeToString(), b.SerializeToString())
+    m = message_module.TestAllTypes()
+    m.CopyFrom(a)
+    stop = threading.Event()
+
+    def Modify():
+      while not stop.is_set():
+        m.CopyFrom(b)
+        m.CopyFrom(a)
+
+    thread = threading.Thread(target=Modify)
+    thread.start()
+    try:
+      outputs = [m.SerializeToString() for _ in range(200)]
+    finally:
+      stop.set()
+      thread.join()
+    for output in outputs:
+      message_module.TestAllTypes.FromString(output)
+      # The C++ implementation serializes with the GIL held, so it always
+      # sees the message between two CopyFrom() calls.
+      if api_implementation.Type() == 'cpp':
+        self.assertTrue(output in expected)
+
+  def testExtendRepeatedScalarFromArray(self, message_module):
+    m = message_module.TestAllTypes()
+    m.repeated_int32.extend(array.array('i', [1, -2, 3]))
+    m.repeated_uint64.extend(array.array('B', [4, 5]))
+    m.repeated_double.extend(array.array('d', [1.5, -2.5]))
+    m.repeated_float.extend(array.array('f', [0.5]))
+    m.repeated_int64.extend(bytearray(b'\x01\x02'))
+    self.assertEqual([1, -2, 3], m.repeated_int32)
+    self.assertEqual([4, 5], m.repeated_uint64)
+    self.assertEqual([1.5, -2.5], m.repeated_double)
+    self.assertEqual([0.5], m.repeated_float)
+    self.assertEqual([1, 2], m.repeated_int64)
+    with self.assertRaises(ValueError):
+      m.repeated_uint32.extend(array.array('i', [-1]))
+
+  def testExtendRepeatedScalarFromItself(self, message_module):
+    m = message_module.TestAllTypes()
+    m.repeated_int32.extend([1, 2])
+    m.repeated_int32.extend(m.repeated_int32)
+    self.assertEqual([1, 2, 1, 2], m.repeated_int32)
+    m.repeated_bool.extend([True, False])
+    m.repeated_bool.extend(m.repeated_bool)
+    self.assertEqual([True, False, True, False], m.repeated_bool)
+    m.repeated_string.append('a')
+    m.repeated_string.extend(m.repeated_string)
+    self.assertEqual(['a', 'a'], m.repeated_string)
+
+  @unittest.skipIf(six.PY2, 'bytes() is str() on py2')
+  def testBytesOfRepeatedScalar(self, message_module):
+    # The elements are converted, as for a list; the memory is not copied.
+    m = message_module.TestAllTypes(repeated_int32=[1, 2, 255])
+    self.assertEqual(b'\x01\x02\xff', bytes(m.repeated_int32))
+    self.assertEqual(bytearray(b'\x01\x02\xff'), bytearray(m.repeated_int32))
+    m.repeated_int32.append(256)
+    with self.assertRaises(ValueError):
+      bytes(m.repeated_int32)
+    with self.assertRaises(ValueError):
+      bytearray(m.repeated_int32)
+
   def ensureNestedMessageExists(self, msg, attribute):
     """Make sure that a nested message object exists.
 
@@ -1637,6 +1805,25 @@ class Proto3Test(BaseTestCase):
     self.assertEqual(False, message.optional_bool)
     self.assertEqual(0, message.optional_nested_message.bb)
 
+  def testMergeFromLargeStringWithExplicitDefaults(self):
+    # Scalars set to their default on the wire override the target, whether
+    # or not the input is large enough to be parsed without the GIL.
+    padding = unittest_proto3_arena_pb2.TestAllTypes(
+        repeated_string=['x' * 100] * 400).SerializeToString()
+    self.assertGreater(len(padding), 16 * 1024)
+    defaults = b'\x08\x00' + b'r\x00'  # optional_int32: 0, optional_string: ''
+    for serialized in (defaults, padding + defaults):
+      m = unittest_proto3_arena_pb2.TestAllTypes(
+          optional_int32=7, optional_string='abc')
+      m.MergeFromString(serialized)
+      self.assertEqual(0, m.optional_int32)
+      self.assertEqual('', m.optional_string)
+
+      m = unittest_proto3_arena_pb2.TestAllTypes()
+      m.MergeFromString(serialized)
+      self.assertEqual(0, m.optional_int32)
+      self.assertEqual('', m.optional_string)
+
   def testAssignUnknownEnum(self):
     """Assigning an unknown enum value is allowed and preserves the value."""
     m = unittest_proto3_arena_pb2.TestAllTypes()
@@ -2516,6 +2703,382 @@ class PackedFieldTest(BaseTestCase):
     self.assertEqual(golden_data, message.SerializeToString())
 
 
+@unittest.skipIf(api_implementation.Type() != 'cpp' or six.PY2,
+                 'buffer protocol is only exported by the C++ implementation')
+class RepeatedScalarBufferTest(BaseTestCase):
+
+  def testExportReadOnlyView(self):
+    m = unittest_pb2.TestAllTypes()
+    m.repeated_int32.extend([1, -2, 3])
+    m.repeated_uint64.append(2**64 - 1)
+    m.repeated_double.extend([0.5, 1.5])
+    m.repeated_bool.extend([True, False])
+    view = memoryview(m.repeated_int32.as_buffer())
+    self.assertTrue(view.readonly)
+    self.assertEqual('i', view.format)
+    self.assertEqual(12, view.nbytes)
+    self.assertEqual([1, -2, 3], view.tolist())
+    self.assertEqual('Q', memoryview(m.repeated_uint64.as_buffer()).format)
+    self.assertEqual([2**64 - 1], memoryview(m.repeated_uint64.as_buffer()).tolist())
+    self.assertEqual([0.5, 1.5], memoryview(m.repeated_double.as_buffer()).tolist())
+    self.assertEqual([True, False], memoryview(m.repeated_bool.as_buffer()).tolist())
+    self.assertEqual([], memoryview(m.repeated_float.as_buffer()).tolist())
+    with self.assertRaises(TypeError):
+      view[0] = 5
+    # Consumers which do not ask for the format get the raw values.
+    self.assertEqual(array.array('i', [1, -2, 3]).tobytes(),
+                     b''.join([m.repeated_int32.as_buffer()]))
+
+  def testNonNumericFieldsAreNotExported(self):
+    m = unittest_pb2.TestAllTypes()
+    with self.assertRaises(BufferError):
+      memoryview(m.repeated_string.as_buffer())
+    with self.assertRaises(BufferError):
+      memoryview(m.repeated_nested_enum.as_buffer())
+
+  def testResizeWhileExported(self):
+    m = unittest_pb2.TestAllTypes()
+    m.repeated_int32.extend([1, 2, 3])
+    other = unittest_pb2.TestAllTypes(repeated_int32=[4])
+    view = memoryview(m.repeated_int32.as_buffer())
+    with self.assertRaises(BufferError):
+      m.repeated_int32.append(4)
+    with self.assertRaises(BufferError):
+      m.repeated_int32.extend([4])
+    with self.assertRaises(BufferError):
+      del m.repeated_int32[0]
+    with self.assertRaises(BufferError):
+      m.repeated_int32[:] = [5]
+    with self.assertRaises(BufferError):
+      m.MergeFrom(other)
+    with self.assertRaises(BufferError):
+      m.MergeFromString(other.SerializeToString())
+    # Elements can still be assigned in place and are seen through the view.
+    m.repeated_int32[0] = 7
+    self.assertEqual([7, 2, 3], view.tolist())
+    view.release()
+    m.repeated_int32.append(4)
+    self.assertEqual([7, 2, 3, 4], m.repeated_int32)
+
+  def testResizeNestedWhileExported(self):
+    m = unittest_pb2.NestedTestAllTypes()
+    m.payload.repeated_int32.append(1)
+    other = unittest_pb2.NestedTestAllTypes()
+    other.CopyFrom(m)
+    view = memoryview(m.payload.repeated_int32.as_buffer())
+    with self.assertRaises(BufferError):
+      m.MergeFrom(other)
+    view.release()
+    m.MergeFrom(other)
+    self.assertEqual([1, 1], m.payload.repeated_int32)
+
+  def testResizeMapValueWhileExported(self):
+    m = map_unittest_pb2.TestMessageMap()
+    m.map_int32_message[1].repeated_int32.append(1)
+    other = map_unittest_pb2.TestMessageMap()
+    other.map_int32_message[1].repeated_int32.extend([2, 3])
+    view = memoryview(m.map_int32_message[1].repeated_int32.as_buffer())
+    with self.assertRaises(BufferError):
+      m.MergeFrom(other)
+    with self.assertRaises(BufferError):
+      m.MergeFromString(other.SerializeToString())
+    with self.assertRaises(BufferError):
+      m.map_int32_message.MergeFrom(other.map_int32_message)
+    self.assertEqual([1], view.tolist())
+    view.release()
+    m.MergeFrom(other)
+    self.assertEqual([2, 3], m.map_int32_message[1].repeated_int32)
+
+  def testContainersAreNotBytesLike(self):
+    m = unittest_pb2.TestAllTypes(repeated_int32=[1, 2, 3])
+    with self.assertRaises(TypeError):
+      memoryview(m.repeated_int32)
+    # Extending from the buffer copies the values, as for a bytearray the
+    # field cannot grow while its own buffer is exported.
+    other = unittest_pb2.TestAllTypes()
+    other.repeated_int32.extend(m.repeated_int32.as_buffer())
+    self.assertEqual([1, 2, 3], other.repeated_int32)
+    with self.assertRaises(BufferError):
+      m.repeated_int32.extend(m.repeated_int32.as_buffer())
+    m.repeated_int32.extend(m.repeated_int32)
+    self.assertEqual([1, 2, 3, 1, 2, 3], m.repeated_int32)
+
+  def testViewOutlivesClear(self):
+    m = unittest_pb2.TestAllTypes()
+    m.repeated_double.extend([1.0, 2.0])
+    container = m.repeated_double
+    view = memoryview(container.as_buffer())
+    m.ClearField('repeated_double')
+    self.assertEqual([1.0, 2.0], view.tolist())
+    self.assertEqual([], m.repeated_double)
+    m.repeated_double.append(3.0)
+    self.assertEqual([1.0, 2.0], list(container))
+    self.assertEqual([3.0], m.repeated_double)
+    view.release()
+
+    m.repeated_int64.extend([1, 2])
+    view = memoryview(m.repeated_int64.as_buffer())
+    m.Clear()
+    del m
+    self.assertEqual([1, 2], view.tolist())
+
+
+class RepeatedCompositeIterationTest(BaseTestCase):
+
+  def _MakeMessage(self, size):
+    m = unittest_pb2.TestAllTypes()
+    for i in range(size):
+      m.repeated_nested_message.add(bb=i)
+    return m
+
+  def testIterate(self):
+    m = self._MakeMessage(10)
+    self.assertEqual(list(range(10)), [x.bb for x in m.repeated_nested_message])
+    self.assertEqual(list(range(10)), [x.bb for x in m.repeated_nested_message])
+    self.assertEqual(45, sum(x.bb for x in m.repeated_nested_message))
+
+  def testRetainedElementsStayValid(self):
+    m = self._MakeMessage(10)
+    kept = []
+    for i, x in enumerate(m.repeated_nested_message):
+      if i % 3 == 0:
+        kept.append(x)
+    self.assertEqual([0, 3, 6, 9], [x.bb for x in kept])
+    for x in kept:
+      self.assertIs(x, m.repeated_nested_message[x.bb])
+    kept[1].bb = 30
+    self.assertEqual(30, m.repeated_nested_message[3].bb)
+    self.assertEqual([0, 1, 2, 30, 4, 5, 6, 7, 8, 9],
+                     [x.bb for x in m.repeated_nested_message])
+
+  def testIdentityOfIteratedElements(self):
+    serialized = self._MakeMessage(6).SerializeToString()
+    m = unittest_pb2.TestAllTypes.FromString(serialized)
+    # Referenced elements, strongly or weakly, keep their wrapper.
+    strong = None
+    weak = None
+    for x in m.repeated_nested_message:
+      if x.bb == 1:
+        strong = x
+      elif x.bb == 2:
+        weak = weakref.ref(x)
+    self.assertIs(strong, m.repeated_nested_message[1])
+    self.assertIs(weak(), m.repeated_nested_message[2])
+    self.assertEqual(2, weak().bb)
+    # Wrappers that existed before the loop are returned as they are.
+    fourth = m.repeated_nested_message[4]
+    self.assertTrue(any(x is fourth for x in m.repeated_nested_message))
+    self.assertEqual(4, fourth.bb)
+
+    # Dropped elements have no stable identity, their wrappers may be reused.
+    m = unittest_pb2.TestAllTypes.FromString(serialized)
+    ids = [id(x) for x in m.repeated_nested_message]
+    self.assertEqual(6, len(ids))
+    if api_implementation.Type() == 'cpp':
+      self.assertLess(len(set(ids)), 6)
+    self.assertEqual(list(range(6)), [x.bb for x in m.repeated_nested_message])
+
+  def testModifyWhileIterating(self):
+    m = self._MakeMessage(5)
+    for x in m.repeated_nested_message:
+      x.bb *= 2
+    self.assertEqual([0, 2, 4, 6, 8],
+                     [x.bb for x in m.repeated_nested_message])
+    for x in m.repeated_nested_message:
+      if x.bb == 4:
+        m.repeated_nested_message.add(bb=100)
+    self.assertEqual([0, 2, 4, 6, 8, 100],
+                     [x.bb for x in m.repeated_nested_message])
+
+  def testNestedSubMessages(self):
+    m = unittest_pb2.TestAllTypes()
+    for i in range(4):
+      child = m.repeated_nested_message.add()
+      if i % 2:
+        child.bb = i
+      del child
+    nested = unittest_pb2.NestedTestAllTypes()
+    for i in range(4):
+      child = nested.child.payload.repeated_foreign_message.add()
+      if i % 2:
+        child.c = i
+      del child
+    self.assertEqual([False, True, False, True],
+                     [x.HasField('bb') for x in m.repeated_nested_message])
+    self.assertEqual(
+        [0, 1, 0, 3],
+        [x.c for x in nested.child.payload.repeated_foreign_message])
+
+    m = unittest_pb2.NestedTestAllTypes()
+    for i in range(4):
+      m.repeated_child.add().payload.optional_int32 = i
+    values = []
+    for x in m.repeated_child:
+      values.append((x.payload.optional_int32, x.HasField('child'),
+                     x.child.payload.optional_int32))
+    self.assertEqual([(0, False, 0), (1, False, 0), (2, False, 0),
+                      (3, False, 0)], values)
+    payloads = [x.payload for x in m.repeated_child]
+    self.assertEqual([0, 1, 2, 3], [p.optional_int32 for p in payloads])
+    payloads[2].optional_int32 = 20
+    self.assertEqual(20, m.repeated_child[2].payload.optional_int32)
+
+  def testClearFieldDuringIteration(self):
+    m = self._MakeMessage(6)
+    it = iter(m.repeated_nested_message)
+    first = next(it)
+    next(it)
+    m.ClearField('repeated_nested_message')
+    self.assertEqual(0, len(m.repeated_nested_message))
+    self.assertEqual(0, first.bb)
+    first.bb = 5
+    self.assertEqual(5, first.bb)
+
+  def testClearFieldKeepsHeldContainerComplete(self):
+    m = unittest_pb2.TestAllTypes.FromString(
+        self._MakeMessage(5).SerializeToString())
+    rep = m.repeated_nested_message
+    x = rep[3]
+    m.ClearField('repeated_nested_message')
+    self.assertEqual(0, len(m.repeated_nested_message))
+    self.assertEqual(5, len(rep))
+    self.assertEqual(list(range(5)), [n.bb for n in rep])
+    self.assertIs(x, rep[3])
+    rep[1].bb = 10
+    self.assertEqual([0, 10, 2, 3, 4], [n.bb for n in rep])
+
+
+@unittest.skipIf(api_implementation.Type() != 'cpp',
+                 'arenas are only supported by the C++ implementation')
+class ArenaTest(BaseTestCase):
+
+  def setUp(self):
+    from google.protobuf.pyext._message import Arena
+    self.arena_class = Arena
+
+  def testAllocateOnArena(self):
+    arena = self.arena_class(initial_block_size=1024)
+    self.assertEqual(0, arena.SpaceUsed())
+    with arena as entered:
+      self.assertIs(arena, entered)
+      m1 = unittest_pb2.TestAllTypes(optional_int32=1)
+      m1.repeated_nested_message.add(bb=2)
+      m2 = unittest_pb2.TestAllTypes.FromString(m1.SerializeToString())
+      batch = unittest_pb2.TestAllTypes.FromStrings(
+          [m1.SerializeToString()] * 3)
+    space_used = arena.SpaceUsed()
+    self.assertGreater(space_used, 0)
+    self.assertGreaterEqual(arena.SpaceAllocated(), space_used)
+    self.assertEqual(m1, m2)
+    self.assertEqual([m1] * 3, batch)
+    # Messages created outside of the context are not allocated on the arena.
+    unittest_pb2.TestAllTypes(optional_int32=1).repeated_int32.append(1)
+    self.assertEqual(space_used, arena.SpaceUsed())
+
+  def testMessagesOutliveArenaObject(self):
+    with self.arena_class():
+      m = unittest_pb2.TestAllTypes()
+      m.optional_nested_message.bb = 1
+      m.repeated_nested_message.add(bb=2)
+      m.repeated_nested_message.add(bb=3)
+      m.repeated_int32.extend([4, 5])
+    nested = m.optional_nested_message
+    repeated = m.repeated_nested_message
+    first = repeated[0]
+    scalars = m.repeated_int32
+    m.Clear()
+    del m
+    nested.bb += 10
+    first.bb += 10
+    self.assertEqual(11, nested.bb)
+    self.assertEqual([12, 3], [n.bb for n in repeated])
+    self.assertEqual([4, 5], scalars)
+
+  def testReleaseFieldsOnArena(self):
+    with self.arena_class():
+      m = unittest_pb2.TestAllExtensions()
+      m.Extensions[unittest_pb2.optional_nested_message_extension].bb = 1
+      m.Extensions[unittest_pb2.repeated_nested_message_extension].add(bb=2)
+      child = m.Extensions[unittest_pb2.optional_nested_message_extension]
+      children = m.Extensions[unittest_pb2.repeated_nested_message_extension]
+      element = children[0]
+    m.ClearExtension(unittest_pb2.optional_nested_message_extension)
+    m.ClearExtension(unittest_pb2.repeated_nested_message_extension)
+    self.assertEqual(0, m.ByteSize())
+    self.assertEqual(1, child.bb)
+    self.assertEqual(2, element.bb)
+
+    with self.arena_class():
+      m = unittest_pb2.TestAllTypes()
+      for i in (3, 1, 2):
+        m.repeated_nested_message.add(bb=i)
+      m.oneof_nested_message.bb = 4
+    m.repeated_nested_message.sort(key=lambda n: n.bb)
+    self.assertEqual([1, 2, 3], [n.bb for n in m.repeated_nested_message])
+    oneof = m.oneof_nested_message
+    m.oneof_uint32 = 5
+    self.assertEqual(4, oneof.bb)
+    self.assertFalse(m.HasField('oneof_nested_message'))
+
+  def testClearFieldOnArenaDoesNotAllocate(self):
+    arena = self.arena_class()
+    with arena:
+      m = unittest_pb2.TestAllTypes()
+      m.optional_nested_message.bb = 1
+    child = m.optional_nested_message
+    space_used = arena.SpaceUsed()
+    m.ClearField('optional_nested_message')
+    self.assertEqual(space_used, arena.SpaceUsed())
+    self.assertEqual(1, child.bb)
+
+    # Each cycle allocates the one submessage it sets, and no more.
+    m.optional_nested_message.bb = 2
+    cycle_space = arena.SpaceUsed() - space_used
+    self.assertGreater(cycle_space, 0)
+    children = []
+    for i in range(100):
+      children.append(m.optional_nested_message)
+      m.ClearField('optional_nested_message')
+      m.optional_nested_message.bb = i
+    self.assertLessEqual(arena.SpaceUsed(),
+                         space_used + 101 * cycle_space)
+
+    extension = unittest_pb2.optional_nested_message_extension
+    with arena:
+      m = unittest_pb2.TestAllExtensions()
+      m.Extensions[extension].bb = 1
+    space_used = arena.SpaceUsed()
+    for i in range(100):
+      children.append(m.Extensions[extension])
+      m.ClearExtension(extension)
+      m.Extensions[extension].bb = i
+    self.assertLessEqual(arena.SpaceUsed(), space_used + 100 * cycle_space)
+    self.assertEqual([2] + list(range(99)) + [1] + list(range(99)),
+                     [c.bb for c in children])
+
+  def testNestedArenas(self):
+    outer = self.arena_class()
+    inner = self.arena_class()
+    with outer:
+      with inner:
+        unittest_pb2.TestAllTypes(optional_int32=1)
+      inner_space_used = inner.SpaceUsed()
+      self.assertEqual(0, outer.SpaceUsed())
+      unittest_pb2.TestAllTypes(optional_int32=1)
+    self.assertGreater(outer.SpaceUsed(), 0)
+    self.assertEqual(inner_space_used, inner.SpaceUsed())
+
+  def testEnterAndExitOrder(self):
+    arena = self.arena_class()
+    with arena:
+      with self.assertRaises(ValueError):
+        arena.__enter__()
+    with self.assertRaises(RuntimeError):
+      arena.__exit__(None, None, None)
+    with self.assertRaises(ValueError):
+      self.arena_class(initial_block_size=-1)
+
+
 @unittest.skipIf(api_implementation.Type() != 'cpp' or
                  sys.version_info < (2, 7),
                  'explicit tests of the C++ implementation for PY27 and above')
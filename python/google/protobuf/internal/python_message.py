@@ -791,6 +791,44 @@ def _AddStaticMethods(cls):
     return message
   cls.FromString = staticmethod(FromString)
 
+  # Errors name the index of the message, like those of the C++
+  # implementation.
+  def FromStringAtIndex(serialized, index):
+    try:
+      return FromString(serialized)
+    except message_mod.DecodeError as e:
+      raise message_mod.DecodeError(
+          'Error parsing message at index %d: %s' % (index, e))
+
+  def FromStrings(serialized_list):
+    return [FromStringAtIndex(s, i) for i, s in enumerate(serialized_list)]
+  cls.FromStrings = staticmethod(FromStrings)
+
+  def FromDelimitedString(serialized):
+    if not six.PY2:
+      # Slices of a memoryview do not copy the data.
+      serialized = memoryview(serialized)
+    elif not isinstance(serialized, bytes):
+      # The decoder expects characters when indexing on Python 2.
+      serialized = memoryview(serialized).tobytes()
+    length = len(serialized)
+    messages = []
+    pos = 0
+    while pos < length:
+      try:
+        (size, pos) = decoder._DecodeVarint32(serialized, pos)
+        truncated = pos + size > length
+      except IndexError:
+        truncated = True
+      if truncated:
+        raise message_mod.DecodeError(
+            'Truncated message at index %d' % len(messages))
+      messages.append(
+          FromStringAtIndex(serialized[pos:pos + size], len(messages)))
+      pos += size
+    return messages
+  cls.FromDelimitedString = staticmethod(FromDelimitedString)
+
 
 def _IsPresent(item):
   """Given a (FieldDescriptor, value) tuple from _fields, return true if the
@@ -0,0 +1,223 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/pyext/arena.h>
+
+#include <unordered_map>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message.h>
+
+#if PY_MAJOR_VERSION >= 3
+  #define PyInt_FromSize_t PyLong_FromSize_t
+#endif
+
+namespace google {
+namespace protobuf {
+namespace python {
+
+namespace arena {
+
+// The arena entered last in this thread. It holds a reference to itself while
+// it is entered.
+static GOOGLE_THREAD_LOCAL PyArena* current_arena = NULL;
+
+// Maps each C++ arena to the Python object that owns it.
+static std::unordered_map<const Arena*, PyArena*>* py_arenas = NULL;
+
+PyArena* Current() { return current_arena; }
+
+static void ReleaseArenaMessage(Message* message, void* context) {
+  // The message is destroyed with the arena.
+  Py_DECREF(reinterpret_cast<PyArena*>(context));
+}
+
+CMessage::OwnerRef Own(Message* message) {
+  if (message->GetArena() == NULL) {
+    return CMessage::OwnerRef(message);
+  }
+  std::unordered_map<const Arena*, PyArena*>::const_iterator it;
+  if (py_arenas == NULL ||
+      (it = py_arenas->find(message->GetArena())) == py_arenas->end()) {
+    PyErr_SetString(PyExc_ValueError,
+                    "Message allocated on an arena not owned by Python");
+    return CMessage::OwnerRef(NULL);
+  }
+  Py_INCREF(it->second);
+  return CMessage::OwnerRef(message, ReleaseArenaMessage, it->second);
+}
+
+CMessage::OwnerRef NewMessage(const Message& prototype, PyArena* arena) {
+  if (arena == NULL) {
+    return CMessage::OwnerRef(prototype.New());
+  }
+  Py_INCREF(arena);
+  return CMessage::OwnerRef(prototype.New(arena->arena), ReleaseArenaMessage,
+                            arena);
+}
+
+CMessage::OwnerRef NewMessageOnSameArena(const Message& prototype) {
+  return Own(prototype.New(prototype.GetArena()));
+}
+
+static PyObject* New(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+  static char* kwlist[] = {"initial_block_size", "max_block_size", 0};
+  Py_ssize_t initial_block_size = 0;
+  Py_ssize_t max_block_size = 0;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|nn", kwlist,
+                                   &initial_block_size, &max_block_size)) {
+    return NULL;
+  }
+  if (initial_block_size < 0 || max_block_size < 0) {
+    PyErr_SetString(PyExc_ValueError, "Block sizes must not be negative");
+    return NULL;
+  }
+  ArenaOptions options;
+  if (initial_block_size > 0) {
+    options.start_block_size = initial_block_size;
+  }
+  if (max_block_size > 0) {
+    options.max_block_size = max_block_size;
+  }
+
+  PyArena* self = reinterpret_cast<PyArena*>(type->tp_alloc(type, 0));
+  if (self == NULL) {
+    return NULL;
+  }
+  self->arena = new Arena(options);
+  self->previous = NULL;
+  self->entered = false;
+  if (py_arenas == NULL) {
+    py_arenas = new std::unordered_map<const Arena*, PyArena*>();
+  }
+  (*py_arenas)[self->arena] = self;
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static void Dealloc(PyObject* pself) {
+  PyArena* self = reinterpret_cast<PyArena*>(pself);
+  py_arenas->erase(self->arena);
+  delete self->arena;
+  Py_TYPE(self)->tp_free(pself);
+}
+
+static PyObject* Enter(PyArena* self, PyObject* unused) {
+  if (self->entered) {
+    PyErr_SetString(PyExc_ValueError, "Arena is already entered");
+    return NULL;
+  }
+  Py_INCREF(self);
+  self->previous = current_arena;
+  self->entered = true;
+  current_arena = self;
+  Py_INCREF(self);
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static PyObject* Exit(PyArena* self, PyObject* unused_args) {
+  if (current_arena != self) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "Arena is not the one entered last in this thread");
+    return NULL;
+  }
+  current_arena = self->previous;
+  self->previous = NULL;
+  self->entered = false;
+  Py_DECREF(self);
+  Py_RETURN_FALSE;
+}
+
+static PyObject* SpaceUsed(PyArena* self, PyObject* unused) {
+  return PyInt_FromSize_t(self->arena->SpaceUsed());
+}
+
+static PyObject* SpaceAllocated(PyArena* self, PyObject* unused) {
+  return PyInt_FromSize_t(self->arena->SpaceAllocated());
+}
+
+static PyMethodDef Methods[] = {
+  { "__enter__", (PyCFunction)Enter, METH_NOARGS,
+    "Allocates new messages on this arena until __exit__." },
+  { "__exit__", (PyCFunction)Exit, METH_VARARGS,
+    "Allocates new messages as before __enter__." },
+  { "SpaceUsed", (PyCFunction)SpaceUsed, METH_NOARGS,
+    "Returns the number of bytes used by objects on the arena." },
+  { "SpaceAllocated", (PyCFunction)SpaceAllocated, METH_NOARGS,
+    "Returns the number of bytes allocated by the arena." },
+  { NULL, NULL }
+};
+
+}  // namespace arena
+
+PyTypeObject PyArena_Type = {
+  PyVarObject_HEAD_INIT(&PyType_Type, 0)
+  FULL_MODULE_NAME ".Arena",           // tp_name
+  sizeof(PyArena),                     // tp_basicsize
+  0,                                   //  tp_itemsize
+  arena::Dealloc,                      //  tp_dealloc
+  0,                                   //  tp_print
+  0,                                   //  tp_getattr
+  0,                                   //  tp_setattr
+  0,                                   //  tp_compare
+  0,                                   //  tp_repr
+  0,                                   //  tp_as_number
+  0,                                   //  tp_as_sequence
+  0,                                   //  tp_as_mapping
+  PyObject_HashNotImplemented,         //  tp_hash
+  0,                                   //  tp_call
+  0,                                   //  tp_str
+  0,                                   //  tp_getattro
+  0,                                   //  tp_setattro
+  0,                                   //  tp_as_buffer
+  Py_TPFLAGS_DEFAULT,                  //  tp_flags
+  "Arena on which new messages are allocated while it is entered",  // tp_doc
+  0,                                   //  tp_traverse
+  0,                                   //  tp_clear
+  0,                                   //  tp_richcompare
+  0,                                   //  tp_weaklistoffset
+  0,                                   //  tp_iter
+  0,                                   //  tp_iternext
+  arena::Methods,                      //  tp_methods
+  0,                                   //  tp_members
+  0,                                   //  tp_getset
+  0,                                   //  tp_base
+  0,                                   //  tp_dict
+  0,                                   //  tp_descr_get
+  0,                                   //  tp_descr_set
+  0,                                   //  tp_dictoffset
+  0,                                   //  tp_init
+  0,                                   //  tp_alloc
+  arena::New,                          //  tp_new
+};
+
+}  // namespace python
+}  // namespace protobuf
+}  // namespace google
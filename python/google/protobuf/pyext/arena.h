@@ -0,0 +1,94 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef GOOGLE_PROTOBUF_PYTHON_CPP_ARENA_H__
+#define GOOGLE_PROTOBUF_PYTHON_CPP_ARENA_H__
+
+#include <Python.h>
+
+#include <google/protobuf/pyext/message.h>
+
+namespace google {
+namespace protobuf {
+
+class Arena;
+class Message;
+
+namespace python {
+
+// A google::protobuf::Arena exposed to Python. While it is entered with a
+// "with" statement, new top-level messages created or parsed in the same
+// thread are allocated on it. The arena is freed once it and all messages
+// allocated on it are unreferenced. Nothing on the arena is freed before that:
+// a submessage detached by ClearField() while Python still refers to it keeps
+// its space, and setting the field again allocates a new one.
+typedef struct PyArena {
+  PyObject_HEAD;
+
+  // Owned.
+  Arena* arena;
+
+  // The arena that was current in this thread when this one was entered, or
+  // NULL.
+  struct PyArena* previous;
+
+  bool entered;
+} PyArena;
+
+extern PyTypeObject PyArena_Type;
+
+namespace arena {
+
+// Returns the arena that new messages are allocated on in the current thread,
+// or NULL if they are allocated on the heap.
+PyArena* Current();
+
+// Returns a reference owning "message", which is allocated either on the heap
+// or on the arena of a PyArena. The reference keeps the arena alive.
+// If the message is on an arena no PyArena owns, raises ValueError and returns
+// a NULL reference; the message is left as it is.
+CMessage::OwnerRef Own(Message* message);
+
+// Returns a new message of the type of "prototype", allocated on "arena" if it
+// is not NULL, and on the heap otherwise. The returned reference owns the
+// message and keeps the arena alive.
+CMessage::OwnerRef NewMessage(const Message& prototype, PyArena* arena);
+
+// Same as above, but allocates the new message on the same arena as
+// "prototype". Messages can then be swapped without copying. Fails like Own().
+CMessage::OwnerRef NewMessageOnSameArena(const Message& prototype);
+
+}  // namespace arena
+
+}  // namespace python
+}  // namespace protobuf
+}  // namespace google
+
+#endif  // GOOGLE_PROTOBUF_PYTHON_CPP_ARENA_H__
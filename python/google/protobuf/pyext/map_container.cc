@@ -39,6 +39,7 @@
 #include <google/protobuf/map_field.h>
 #include <google/protobuf/map.h>
 #include <google/protobuf/message.h>
+#include <google/protobuf/pyext/arena.h>
 #include <google/protobuf/pyext/message_factory.h>
 #include <google/protobuf/pyext/message.h>
 #include <google/protobuf/pyext/repeated_composite_container.h>
@@ -342,6 +343,9 @@ PyObject* GetEntryClass(PyObject* _self) {
 PyObject* MapReflectionFriend::MergeFrom(PyObject* _self, PyObject* arg) {
   MapContainer* self = GetMap(_self);
   MapContainer* other_map = GetMap(arg);
+  if (cmessage::CheckMapValuesNotExported(self) < 0) {
+    return NULL;
+  }
   Message* message = self->GetMutableMessage();
   const Message* other_message = other_map->message;
   const Reflection* reflection = message->GetReflection();
@@ -385,7 +389,11 @@ static int InitializeAndCopyToParentContainer(MapContainer* from,
   // For now we require from == to, re-evaluate if we want to support deep copy
   // as in repeated_scalar_container.cc.
   GOOGLE_DCHECK(from == to);
-  Message* new_message = from->message->New();
+  CMessage::OwnerRef new_owner = arena::NewMessageOnSameArena(*from->message);
+  Message* new_message = new_owner.get();
+  if (new_message == NULL) {
+    return -1;
+  }
 
   if (MapReflectionFriend::Length(reinterpret_cast<PyObject*>(from)) > 0) {
     // A somewhat roundabout way of copying just one field from old_message to
@@ -403,7 +411,7 @@ static int InitializeAndCopyToParentContainer(MapContainer* from,
   }
 
   // If from == to this could delete old_message.
-  to->owner.reset(new_message);
+  to->owner = new_owner;
 
   to->parent = NULL;
   to->parent_field_descriptor = from->parent_field_descriptor;
@@ -786,7 +794,11 @@ int MapReflectionFriend::MessageMapSetItem(PyObject* _self, PyObject* key,
       // instead of just removing.
       CMessage* cmsg =  reinterpret_cast<CMessage*>(cmsg_value);
       Message* msg = cmsg->message;
-      cmsg->owner.reset(msg->New());
+      CMessage::OwnerRef new_owner = arena::NewMessageOnSameArena(*msg);
+      if (new_owner.get() == NULL) {
+        return -1;
+      }
+      cmsg->owner.swap(new_owner);
       cmsg->message = cmsg->owner.get();
       cmsg->parent = NULL;
       msg->GetReflection()->Swap(msg, cmsg->message);
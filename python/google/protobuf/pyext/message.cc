@@ -33,9 +33,11 @@
 
 #include <google/protobuf/pyext/message.h>
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <structmember.h>  // A Python header file.
 
@@ -55,6 +57,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/pyext/arena.h>
 #include <google/protobuf/pyext/descriptor.h>
 #include <google/protobuf/pyext/descriptor_pool.h>
 #include <google/protobuf/pyext/extension_dict.h>
@@ -294,6 +297,7 @@ static PyObject* New(PyTypeObject* type,
   }
   newtype->py_message_factory = py_descriptor_pool->py_message_factory;
   Py_INCREF(newtype->py_message_factory);
+  newtype->parse_without_gil = 0;
 
   // Register the message in the MessageFactory.
   // TODO(amauryfa): Move this call to MessageFactory.GetPrototype() when the
@@ -986,6 +990,45 @@ struct FixupMessageReference : public ChildVisitor {
 
 // After a Merge, visit every sub-message that was read-only, and
 // eventually update their pointer if the Merge operation modified them.
+// Fails with a BufferError if a buffer is exported from a repeated scalar
+// field of the visited message, its singular submessages or its map values,
+// which merging into the message could resize. Elements of repeated message
+// fields are never merged into, only appended.
+struct CheckNotExportedForMerge : public ChildVisitor {
+  int VisitRepeatedScalarContainer(RepeatedScalarContainer* container) {
+    return repeated_scalar_container::CheckNotExported(container);
+  }
+
+  int VisitMapContainer(MapContainer* container) {
+    return CheckMapValuesNotExported(container);
+  }
+
+  int VisitCMessage(CMessage* cmessage,
+                    const FieldDescriptor* field_descriptor) {
+    return ForEachCompositeField(cmessage, CheckNotExportedForMerge());
+  }
+};
+
+int CheckMapValuesNotExported(MapContainer* container) {
+  if (container->value_field_descriptor->cpp_type() !=
+      FieldDescriptor::CPPTYPE_MESSAGE) {
+    return 0;
+  }
+  // Every wrapper of a value that Python can reach is in message_dict.
+  PyObject* message_dict =
+      static_cast<MessageMapContainer*>(container)->message_dict;
+  Py_ssize_t pos = 0;
+  PyObject* key;
+  PyObject* value;
+  while (PyDict_Next(message_dict, &pos, &key, &value)) {
+    if (ForEachCompositeField(reinterpret_cast<CMessage*>(value),
+                              CheckNotExportedForMerge()) == -1) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
 struct FixupMessageAfterMerge : public FixupMessageReference {
   explicit FixupMessageAfterMerge(CMessage* parent) :
       FixupMessageReference(parent->message),
@@ -1026,8 +1069,8 @@ int AssureWritable(CMessage* self) {
     // If parent is NULL but we are trying to modify a read-only message, this
     // is a reference to a constant default instance that needs to be replaced
     // with a mutable top-level message.
-    self->message = self->message->New();
-    self->owner.reset(self->message);
+    self->owner = arena::NewMessage(*self->message, arena::Current());
+    self->message = self->owner.get();
     // Cascade the new owner to eventual children: even if this message is
     // empty, some submessages or repeated containers might exist already.
     SetOwner(self, self->owner);
@@ -1185,8 +1228,10 @@ int InternalDeleteRepeatedField(
     } else {
       CMessage* last_cmessage = reinterpret_cast<CMessage*>(
           PyList_GET_ITEM(cmessage_list, PyList_GET_SIZE(cmessage_list) - 1));
-      repeated_composite_container::ReleaseLastTo(
-          message, field_descriptor, last_cmessage);
+      if (repeated_composite_container::ReleaseLastTo(
+              message, field_descriptor, last_cmessage) < 0) {
+        return -1;
+      }
       if (PySequence_DelItem(cmessage_list, -1) < 0) {
         return -1;
       }
@@ -1412,8 +1457,8 @@ static PyObject* New(PyTypeObject* cls,
   if (self == NULL) {
     return NULL;
   }
-  self->message = default_message->New();
-  self->owner.reset(self->message);
+  self->owner = arena::NewMessage(*default_message, arena::Current());
+  self->message = self->owner.get();
   return reinterpret_cast<PyObject*>(self);
 }
 
@@ -1437,8 +1482,11 @@ struct ClearWeakReferences : public ChildVisitor {
     // container itself, so NULL out that pointer as well.
     const Py_ssize_t n = PyList_GET_SIZE(container->child_messages);
     for (Py_ssize_t i = 0; i < n; ++i) {
-      CMessage* child_cmessage = reinterpret_cast<CMessage*>(
-          PyList_GET_ITEM(container->child_messages, i));
+      PyObject* child = PyList_GET_ITEM(container->child_messages, i);
+      if (child == Py_None) {
+        continue;
+      }
+      CMessage* child_cmessage = reinterpret_cast<CMessage*>(child);
       child_cmessage->parent = NULL;
     }
     return 0;
@@ -1726,15 +1774,118 @@ int SetOwner(CMessage* self, const CMessage::OwnerRef& new_owner) {
   return 0;
 }
 
+// ---------------------------------------------------------------------
+// Rebinding wrappers
+//
+// A wrapper that nothing references anymore can be pointed at another message
+// of the same type, together with the wrappers cached for its fields, instead
+// of allocating new ones. This is used when iterating over repeated message
+// fields.
+
+struct CheckUnreferenced : public ChildVisitor {
+  int VisitRepeatedCompositeContainer(RepeatedCompositeContainer* container) {
+    if (Py_REFCNT(container) != 1) {
+      return -1;
+    }
+    const Py_ssize_t n = PyList_GET_SIZE(container->child_messages);
+    for (Py_ssize_t i = 0; i < n; ++i) {
+      PyObject* child = PyList_GET_ITEM(container->child_messages, i);
+      if (child != Py_None &&
+          !IsUnreferenced(reinterpret_cast<CMessage*>(child), 1)) {
+        return -1;
+      }
+    }
+    return 0;
+  }
+
+  int VisitRepeatedScalarContainer(RepeatedScalarContainer* container) {
+    return Py_REFCNT(container) == 1 ? 0 : -1;
+  }
+
+  int VisitMapContainer(MapContainer* container) {
+    // The wrappers of message values are not tracked here.
+    return -1;
+  }
+
+  int VisitCMessage(CMessage* cmessage,
+                    const FieldDescriptor* field_descriptor) {
+    return IsUnreferenced(cmessage, 1) ? 0 : -1;
+  }
+};
+
+bool IsUnreferenced(CMessage* self, Py_ssize_t refcount) {
+  return Py_REFCNT(self) == refcount && self->weakreflist == NULL &&
+         self->unknown_field_set == NULL &&
+         ForEachCompositeField(self, CheckUnreferenced()) == 0;
+}
+
+struct RebindChild : public ChildVisitor {
+  // parent must outlive this object.
+  explicit RebindChild(CMessage* parent) : parent_(parent) {}
+
+  int VisitRepeatedCompositeContainer(RepeatedCompositeContainer* container) {
+    container->message = parent_->message;
+    // The wrappers of the previous elements are not referenced, drop them.
+    return PyList_SetSlice(container->child_messages, 0, PY_SSIZE_T_MAX, NULL);
+  }
+
+  int VisitRepeatedScalarContainer(RepeatedScalarContainer* container) {
+    container->message = parent_->message;
+    return 0;
+  }
+
+  int VisitCMessage(CMessage* cmessage,
+                    const FieldDescriptor* field_descriptor) {
+    // Same as InternalGetSubMessage().
+    const Message& message = *parent_->message;
+    const Reflection* reflection = message.GetReflection();
+    const Message& sub_message = reflection->GetMessage(
+        message, field_descriptor,
+        GetFactoryForMessage(parent_)->message_factory);
+    cmessage->read_only = !reflection->HasField(message, field_descriptor);
+    return Rebind(cmessage, const_cast<Message*>(&sub_message));
+  }
+
+  CMessage* parent_;
+};
+
+int Rebind(CMessage* self, Message* message) {
+  self->message = message;
+  return ForEachCompositeField(self, RebindChild(self));
+}
+
 // Releases the message specified by 'field' and returns the
 // pointer. If the field does not exist a new message is created using
-// 'descriptor'. The caller takes ownership of the returned pointer.
+// 'descriptor'. The caller takes ownership of the returned pointer, which may
+// be allocated on the arena of self->message.
 Message* ReleaseMessage(CMessage* self,
                         const Descriptor* descriptor,
                         const FieldDescriptor* field_descriptor) {
   MessageFactory* message_factory = GetFactoryForMessage(self)->message_factory;
-  Message* released_message = self->message->GetReflection()->ReleaseMessage(
-      self->message, field_descriptor, message_factory);
+  Message* message = self->message;
+  const Reflection* reflection = message->GetReflection();
+  Message* released_message = NULL;
+  if (message->GetArena() == NULL) {
+    released_message =
+        reflection->ReleaseMessage(message, field_descriptor, message_factory);
+  } else if (reflection->HasField(*message, field_descriptor)) {
+    // ReleaseMessage() would copy the submessage off the arena, leaving the
+    // Python objects of its fields pointing to the original. Detach the
+    // original instead. The arena keeps it until the arena is freed.
+    released_message =
+        reflection->MutableMessage(message, field_descriptor, message_factory);
+    if (field_descriptor->is_extension()) {
+      // Clearing an extension keeps its message for reuse, so the extension
+      // needs an empty message of its own.
+      reflection->SetAllocatedMessage(
+          message, released_message->New(message->GetArena()),
+          field_descriptor);
+      reflection->ClearField(message, field_descriptor);
+    } else {
+      // Unsets the field without deleting or replacing the message.
+      reflection->SetAllocatedMessage(message, NULL, field_descriptor);
+    }
+  }
   // ReleaseMessage will return NULL which differs from
   // child_cmessage->message, if the field does not exist.  In this case,
   // the latter points to the default instance via a const_cast<>, so we
@@ -1752,8 +1903,11 @@ int ReleaseSubMessage(CMessage* self,
                       const FieldDescriptor* field_descriptor,
                       CMessage* child_cmessage) {
   // Release the Message
-  CMessage::OwnerRef released_message(ReleaseMessage(
+  CMessage::OwnerRef released_message = arena::Own(ReleaseMessage(
       self, child_cmessage->message->GetDescriptor(), field_descriptor));
+  if (released_message.get() == NULL) {
+    return -1;
+  }
   child_cmessage->message = released_message.get();
   child_cmessage->owner.swap(released_message);
   child_cmessage->parent = NULL;
@@ -1883,6 +2037,29 @@ PyObject* Clear(CMessage* self) {
 
 // ---------------------------------------------------------------------
 
+// Inputs at least this large are parsed without holding the GIL, so that other
+// Python threads can run in the meantime. Smaller ones are not worth the cost
+// of releasing and reacquiring it.
+static const Py_ssize_t kMinSizeWithoutGIL = 16 * 1024;
+
+// Releases the GIL for the lifetime of the object if "release" is true. No
+// Python objects may be used in the meantime.
+class ScopedReleaseGIL {
+ public:
+  explicit ScopedReleaseGIL(bool release)
+      : thread_state_(release ? PyEval_SaveThread() : NULL) {}
+  ~ScopedReleaseGIL() {
+    if (thread_state_ != NULL) {
+      PyEval_RestoreThread(thread_state_);
+    }
+  }
+
+ private:
+  PyThreadState* thread_state_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ScopedReleaseGIL);
+};
+
 static string GetMessageName(CMessage* self) {
   if (self->parent_field_descriptor != NULL) {
     return self->parent_field_descriptor->full_name();
@@ -1962,6 +2139,8 @@ static PyObject* InternalSerializeToString(
   if (deterministic_obj != Py_None) {
     coded_out.SetSerializationDeterministic(deterministic);
   }
+  // The GIL stays held: any thread with a reference to the message could
+  // modify it, and copying it first would cost about as much as serializing.
   self->message->SerializeWithCachedSizes(&coded_out);
   GOOGLE_CHECK(!coded_out.HadError());
   return result;
@@ -2051,6 +2230,9 @@ PyObject* MergeFrom(CMessage* self, PyObject* arg) {
                  other_message->message->GetDescriptor()->full_name().c_str());
     return NULL;
   }
+  if (ForEachCompositeField(self, CheckNotExportedForMerge()) == -1) {
+    return NULL;
+  }
   AssureWritable(self);
 
   self->message->MergeFrom(*other_message->message);
@@ -2129,24 +2311,112 @@ PyObject* SetAllowOversizeProtos(PyObject* m, PyObject* arg) {
   }
 }
 
-static PyObject* MergeFromString(CMessage* self, PyObject* arg) {
-  const void* data;
-  Py_ssize_t data_length;
-  if (PyObject_AsReadBuffer(arg, &data, &data_length) < 0) {
-    return NULL;
+// Returns true if no message type reachable from "descriptor" has extension
+// ranges. Parsing them never looks up the DescriptorPool, which other threads
+// may add files to while the GIL is released.
+static bool HasNoExtensionRanges(
+    const Descriptor* descriptor,
+    std::unordered_set<const Descriptor*>* visited) {
+  if (!visited->insert(descriptor).second) {
+    return true;
+  }
+  if (descriptor->extension_range_count() > 0) {
+    return false;
+  }
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const Descriptor* message_type = descriptor->field(i)->message_type();
+    if (message_type != NULL && !HasNoExtensionRanges(message_type, visited)) {
+      return false;
+    }
   }
+  return true;
+}
 
-  AssureWritable(self);
+static bool CanParseWithoutGIL(CMessageClass* type) {
+  if (type->parse_without_gil == 0) {
+    std::unordered_set<const Descriptor*> visited;
+    type->parse_without_gil =
+        HasNoExtensionRanges(type->message_descriptor, &visited) ? 1 : -1;
+  }
+  return type->parse_without_gil > 0;
+}
 
-  io::CodedInputStream input(
-      reinterpret_cast<const uint8*>(data), data_length);
+// Returns true if parsing into a new message and swapping it with "self" has
+// the same result as parsing into "self", and leaves no Python object pointing
+// to a moved submessage or unknown field set.
+static bool CanSwapParsedMessage(CMessage* self) {
+  return (self->composite_fields == NULL || self->composite_fields->empty()) &&
+         self->unknown_field_set == NULL && self->message->ByteSizeLong() == 0;
+}
+
+// Merges "data" into "message". Sets *position to the number of bytes parsed
+// and *consumed_entire_message to whether parsing stopped at the end of the
+// data rather than at an end-group tag.
+static bool MergePartialFromBytes(Message* message, const uint8* data,
+                                  Py_ssize_t data_length,
+                                  PyMessageFactory* factory, int* position,
+                                  bool* consumed_entire_message) {
+  io::CodedInputStream input(data, data_length);
   if (allow_oversize_protos) {
     input.SetTotalBytesLimit(INT_MAX, INT_MAX);
     input.SetRecursionLimit(INT_MAX);
   }
-  PyMessageFactory* factory = GetFactoryForMessage(self);
   input.SetExtensionRegistry(factory->pool->pool, factory->message_factory);
-  bool success = self->message->MergePartialFromCodedStream(&input);
+  bool success = message->MergePartialFromCodedStream(&input);
+  *position = input.CurrentPosition();
+  *consumed_entire_message = input.ConsumedEntireMessage();
+  return success;
+}
+
+static PyObject* MergeFromString(CMessage* self, PyObject* arg) {
+  if (ForEachCompositeField(self, CheckNotExportedForMerge()) == -1) {
+    return NULL;
+  }
+  // Holding the buffer keeps it from being resized or freed while the GIL is
+  // released.
+  Py_buffer buffer;
+  if (PyObject_GetBuffer(arg, &buffer, PyBUF_SIMPLE) < 0) {
+    return NULL;
+  }
+  const uint8* data = static_cast<const uint8*>(buffer.buf);
+  const Py_ssize_t data_length = buffer.len;
+
+  AssureWritable(self);
+
+  PyMessageFactory* factory = GetFactoryForMessage(self);
+  int position;
+  bool consumed_entire_message;
+  bool success;
+  bool parsed_in_place = true;
+  // Merging a separately parsed message is not the same as parsing in place:
+  // proto3 scalars set to their default on the wire would not override the
+  // target. So the GIL is only released when the target is empty.
+  if (data_length >= kMinSizeWithoutGIL && CanSwapParsedMessage(self) &&
+      CanParseWithoutGIL(reinterpret_cast<CMessageClass*>(Py_TYPE(self)))) {
+    // Other threads may use the message while the GIL is released, so parse
+    // into a new one that no Python object can see, and swap it in afterwards.
+    CMessage::OwnerRef parsed = arena::NewMessageOnSameArena(*self->message);
+    if (parsed.get() == NULL) {
+      PyBuffer_Release(&buffer);
+      return NULL;
+    }
+    {
+      ScopedReleaseGIL release_gil(true);
+      success = MergePartialFromBytes(parsed.get(), data, data_length, factory,
+                                      &position, &consumed_entire_message);
+    }
+    // Another thread may have modified the message in the meantime. Then
+    // parse again in place, as if that had happened before this call.
+    if (CanSwapParsedMessage(self)) {
+      self->message->GetReflection()->Swap(self->message, parsed.get());
+      parsed_in_place = false;
+    }
+  }
+  if (parsed_in_place) {
+    success = MergePartialFromBytes(self->message, data, data_length, factory,
+                                    &position, &consumed_entire_message);
+  }
+  PyBuffer_Release(&buffer);
   // Child message might be lazily created before MergeFrom. Make sure they
   // are mutable at this point if child messages are really created.
   if (ForEachCompositeField(self, FixupMessageAfterMerge(self)) == -1) {
@@ -2154,12 +2424,12 @@ static PyObject* MergeFromString(CMessage* self, PyObject* arg) {
   }
 
   if (success) {
-    if (!input.ConsumedEntireMessage()) {
+    if (!consumed_entire_message) {
       // TODO(jieluo): Raise error and return NULL instead.
       // b/27494216
       PyErr_Warn(NULL, "Unexpected end-group tag: Not all data was converted");
     }
-    return PyInt_FromLong(input.CurrentPosition());
+    return PyInt_FromLong(position);
   } else {
     PyErr_Format(DecodeError_class, "Error parsing message");
     return NULL;
@@ -2580,6 +2850,148 @@ PyObject* FromString(PyTypeObject* cls, PyObject* serialized) {
   return py_cmsg;
 }
 
+// Parses each of "inputs" into a new message of class "type", and returns them
+// in a list. All C++ messages are parsed before any Python object is created,
+// so that the GIL is released once for the whole batch. The messages share the
+// current arena, if any.
+static PyObject* ParseBatch(CMessageClass* type,
+                            const std::vector<StringPiece>& inputs) {
+  PyMessageFactory* factory = type->py_message_factory;
+  const Message* prototype =
+      factory->message_factory->GetPrototype(type->message_descriptor);
+  if (prototype == NULL) {
+    PyErr_SetString(PyExc_TypeError,
+                    type->message_descriptor->full_name().c_str());
+    return NULL;
+  }
+
+  size_t total_size = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    total_size += inputs[i].size();
+  }
+  // Allocating on an arena references it, which needs the GIL.
+  PyArena* arena = arena::Current();
+  std::vector<CMessage::OwnerRef> messages;
+  messages.reserve(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    messages.push_back(arena::NewMessage(*prototype, arena));
+  }
+  size_t failed_index = inputs.size();
+  {
+    ScopedReleaseGIL release_gil(
+        total_size >= static_cast<size_t>(kMinSizeWithoutGIL) &&
+        CanParseWithoutGIL(type));
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      io::CodedInputStream input(
+          reinterpret_cast<const uint8*>(inputs[i].data()), inputs[i].size());
+      if (allow_oversize_protos) {
+        input.SetTotalBytesLimit(INT_MAX, INT_MAX);
+        input.SetRecursionLimit(INT_MAX);
+      }
+      input.SetExtensionRegistry(factory->pool->pool,
+                                 factory->message_factory);
+      if (!messages[i].get()->MergePartialFromCodedStream(&input) ||
+          !input.ConsumedEntireMessage()) {
+        failed_index = i;
+        break;
+      }
+    }
+  }
+  if (failed_index < inputs.size()) {
+    PyErr_Format(DecodeError_class, "Error parsing message at index %zu",
+                 failed_index);
+    return NULL;
+  }
+
+  // The messages are not passed to __init__, as there is nothing to
+  // initialize from.
+  ScopedPyObjectPtr result(PyList_New(messages.size()));
+  if (result == NULL) {
+    return NULL;
+  }
+  for (size_t i = 0; i < messages.size(); ++i) {
+    CMessage* cmsg = NewEmptyMessage(type);
+    if (cmsg == NULL) {
+      return NULL;
+    }
+    cmsg->owner = messages[i];
+    cmsg->message = cmsg->owner.get();
+    PyList_SET_ITEM(result.get(), i, reinterpret_cast<PyObject*>(cmsg));
+  }
+  return result.release();
+}
+
+static PyObject* FromStrings(PyTypeObject* cls, PyObject* serialized_list) {
+  CMessageClass* type = CheckMessageClass(cls);
+  if (type == NULL) {
+    return NULL;
+  }
+  ScopedPyObjectPtr list(PySequence_Fast(
+      serialized_list, "FromStrings() expects a sequence of bytes"));
+  if (list == NULL) {
+    return NULL;
+  }
+  Py_ssize_t size = PySequence_Fast_GET_SIZE(list.get());
+  // The buffers keep the data alive, even if the list is modified while the
+  // GIL is released.
+  std::vector<Py_buffer> buffers;
+  std::vector<StringPiece> inputs;
+  buffers.reserve(size);
+  inputs.reserve(size);
+  for (Py_ssize_t i = 0; i < size; ++i) {
+    Py_buffer buffer;
+    if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(list.get(), i), &buffer,
+                           PyBUF_SIMPLE) < 0) {
+      break;
+    }
+    buffers.push_back(buffer);
+    inputs.push_back(
+        StringPiece(static_cast<const char*>(buffer.buf), buffer.len));
+  }
+  PyObject* result = NULL;
+  if (static_cast<Py_ssize_t>(buffers.size()) == size) {
+    result = ParseBatch(type, inputs);
+  }
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    PyBuffer_Release(&buffers[i]);
+  }
+  return result;
+}
+
+static PyObject* FromDelimitedString(PyTypeObject* cls, PyObject* serialized) {
+  CMessageClass* type = CheckMessageClass(cls);
+  if (type == NULL) {
+    return NULL;
+  }
+  Py_buffer buffer;
+  if (PyObject_GetBuffer(serialized, &buffer, PyBUF_SIMPLE) < 0) {
+    return NULL;
+  }
+  // Each message is preceded by its size as a varint, as written by
+  // util::SerializeDelimitedToOstream().
+  const char* data = static_cast<const char*>(buffer.buf);
+  Py_ssize_t remaining = buffer.len;
+  std::vector<StringPiece> inputs;
+  while (remaining > 0) {
+    io::CodedInputStream input(reinterpret_cast<const uint8*>(data),
+                               std::min<Py_ssize_t>(remaining, INT_MAX));
+    uint32 size;
+    if (!input.ReadVarint32(&size) ||
+        size > static_cast<uint64>(remaining - input.CurrentPosition())) {
+      PyErr_Format(DecodeError_class, "Truncated message at index %zu",
+                   inputs.size());
+      PyBuffer_Release(&buffer);
+      return NULL;
+    }
+    inputs.push_back(StringPiece(data + input.CurrentPosition(), size));
+    data += input.CurrentPosition() + size;
+    remaining -= input.CurrentPosition() + size;
+  }
+  PyObject* result = ParseBatch(type, inputs);
+  PyBuffer_Release(&buffer);
+  return result;
+}
+
 PyObject* DeepCopy(CMessage* self, PyObject* arg) {
   PyObject* clone = PyObject_CallObject(
       reinterpret_cast<PyObject*>(Py_TYPE(self)), NULL);
@@ -2749,6 +3161,11 @@ static PyMethodDef Methods[] = {
     "Finds unset required fields." },
   { "FromString", (PyCFunction)FromString, METH_O | METH_CLASS,
     "Creates new method instance from given serialized data." },
+  { "FromStrings", (PyCFunction)FromStrings, METH_O | METH_CLASS,
+    "Creates new message instances from a sequence of serialized data." },
+  { "FromDelimitedString", (PyCFunction)FromDelimitedString,
+    METH_O | METH_CLASS,
+    "Creates new message instances from size-delimited serialized data." },
   { "HasExtension", (PyCFunction)HasExtension, METH_O,
     "Checks if a message field is set." },
   { "HasField", (PyCFunction)HasField, METH_O,
@@ -3075,6 +3492,11 @@ bool InitProto2MessageModule(PyObject *m) {
 
   PyModule_AddObject(m, "Message", reinterpret_cast<PyObject*>(CMessage_Type));
 
+  if (PyType_Ready(&PyArena_Type) < 0) {
+    return false;
+  }
+  PyModule_AddObject(m, "Arena", reinterpret_cast<PyObject*>(&PyArena_Type));
+
   // Initialize Repeated container types.
   {
     if (PyType_Ready(&RepeatedScalarContainer_Type) < 0) {
@@ -3085,6 +3507,10 @@ bool InitProto2MessageModule(PyObject *m) {
                        reinterpret_cast<PyObject*>(
                            &RepeatedScalarContainer_Type));
 
+    if (PyType_Ready(&RepeatedScalarBuffer_Type) < 0) {
+      return false;
+    }
+
     if (PyType_Ready(&RepeatedCompositeContainer_Type) < 0) {
       return false;
     }
@@ -3094,6 +3520,10 @@ bool InitProto2MessageModule(PyObject *m) {
         reinterpret_cast<PyObject*>(
             &RepeatedCompositeContainer_Type));
 
+    if (PyType_Ready(&RepeatedCompositeIterator_Type) < 0) {
+      return false;
+    }
+
     // Register them as collections.Sequence
     ScopedPyObjectPtr collections(PyImport_ImportModule("collections"));
     if (collections == NULL) {
@@ -56,6 +56,7 @@ class MessageFactory;
 namespace python {
 
 struct ExtensionDict;
+struct MapContainer;
 struct PyMessageFactory;
 
 typedef struct CMessage {
@@ -137,6 +138,10 @@ struct CMessageClass {
   // We own the reference, because it's important to keep the factory alive.
   PyMessageFactory* py_message_factory;
 
+  // Whether messages of this class can be parsed without holding the GIL, see
+  // cmessage::MergeFromString(). 0 until computed, then 1 or -1.
+  int parse_without_gil;
+
   PyObject* AsPyObject() {
     return reinterpret_cast<PyObject*>(this);
   }
@@ -254,6 +259,22 @@ int SetOwner(CMessage* self, const CMessage::OwnerRef& new_owner);
 
 int AssureWritable(CMessage* self);
 
+// Merging into a map replaces the contents of the values of existing keys.
+// Returns 0 if no buffer is exported from a repeated field of those values,
+// otherwise raises BufferError and returns -1.
+int CheckMapValuesNotExported(MapContainer* container);
+
+// Returns true if "self" has exactly "refcount" references, all of them known
+// to the caller, and the wrappers cached for its fields are referenced only by
+// "self". Such a wrapper may be rebound to another message.
+bool IsUnreferenced(CMessage* self, Py_ssize_t refcount);
+
+// Points "self" and the wrappers cached for its fields at "message", which must
+// be of the same type and belong to the same tree. "self" must be
+// unreferenced, see IsUnreferenced().
+// Returns 0 on success, -1 on failure.
+int Rebind(CMessage* self, Message* message);
+
 // Returns the message factory for the given message.
 // This is equivalent to message.MESSAGE_FACTORY
 //
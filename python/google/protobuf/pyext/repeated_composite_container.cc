@@ -40,12 +40,14 @@
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/message.h>
+#include <google/protobuf/pyext/arena.h>
 #include <google/protobuf/pyext/descriptor.h>
 #include <google/protobuf/pyext/descriptor_pool.h>
 #include <google/protobuf/pyext/message.h>
 #include <google/protobuf/pyext/message_factory.h>
 #include <google/protobuf/pyext/scoped_pyobject_ptr.h>
 #include <google/protobuf/reflection.h>
+#include <google/protobuf/repeated_field.h>
 
 #if PY_MAJOR_VERSION >= 3
   #define PyInt_Check PyLong_Check
@@ -95,7 +97,7 @@ static Py_ssize_t Length(PyObject* pself) {
 
 // Returns 0 if successful; returns -1 and sets an exception if
 // unsuccessful.
-static int UpdateChildMessages(RepeatedCompositeContainer* self) {
+static int SyncChildMessages(RepeatedCompositeContainer* self) {
   if (self->message == NULL)
     return 0;
 
@@ -104,20 +106,52 @@ static int UpdateChildMessages(RepeatedCompositeContainer* self) {
   // be removed in such a way so there's no need to worry about that.
   Py_ssize_t message_length = Length(reinterpret_cast<PyObject*>(self));
   Py_ssize_t child_length = PyList_GET_SIZE(self->child_messages);
-  Message* message = self->message;
-  const Reflection* reflection = message->GetReflection();
   for (Py_ssize_t i = child_length; i < message_length; ++i) {
-    const Message& sub_message = reflection->GetRepeatedMessage(
-        *(self->message), self->parent_field_descriptor, i);
-    CMessage* cmsg = cmessage::NewEmptyMessage(self->child_message_class);
-    ScopedPyObjectPtr py_cmsg(reinterpret_cast<PyObject*>(cmsg));
-    if (cmsg == NULL) {
+    if (PyList_Append(self->child_messages, Py_None) < 0) {
       return -1;
     }
-    cmsg->owner = self->owner;
-    cmsg->message = const_cast<Message*>(&sub_message);
-    cmsg->parent = self->parent;
-    if (PyList_Append(self->child_messages, py_cmsg.get()) < 0) {
+  }
+  return 0;
+}
+
+// Returns a new wrapper for the element at "index" of an attached container.
+static CMessage* NewChildMessage(RepeatedCompositeContainer* self,
+                                 Py_ssize_t index) {
+  const Message& sub_message = self->message->GetReflection()->
+      GetRepeatedMessage(*self->message, self->parent_field_descriptor, index);
+  CMessage* cmsg = cmessage::NewEmptyMessage(self->child_message_class);
+  if (cmsg == NULL) {
+    return NULL;
+  }
+  cmsg->owner = self->owner;
+  cmsg->message = const_cast<Message*>(&sub_message);
+  cmsg->parent = self->parent;
+  return cmsg;
+}
+
+// Returns a borrowed reference to the wrapper of the element at "index",
+// creating it if needed. "index" must be in range.
+static PyObject* GetChildMessage(RepeatedCompositeContainer* self,
+                                 Py_ssize_t index) {
+  PyObject* item = PyList_GET_ITEM(self->child_messages, index);
+  if (item == Py_None) {
+    item = reinterpret_cast<PyObject*>(NewChildMessage(self, index));
+    if (item == NULL) {
+      return NULL;
+    }
+    PyList_SetItem(self->child_messages, index, item);
+  }
+  return item;
+}
+
+// Same as SyncChildMessages(), and creates the wrappers of all elements.
+static int UpdateChildMessages(RepeatedCompositeContainer* self) {
+  if (SyncChildMessages(self) < 0) {
+    return -1;
+  }
+  const Py_ssize_t n = PyList_GET_SIZE(self->child_messages);
+  for (Py_ssize_t i = 0; i < n; ++i) {
+    if (GetChildMessage(self, i) == NULL) {
       return -1;
     }
   }
@@ -132,7 +166,7 @@ static PyObject* AddToAttached(RepeatedCompositeContainer* self,
                                PyObject* kwargs) {
   GOOGLE_CHECK_ATTACHED(self);
 
-  if (UpdateChildMessages(self) < 0) {
+  if (SyncChildMessages(self) < 0) {
     return NULL;
   }
   if (cmessage::AssureWritable(self->parent) == -1)
@@ -201,7 +235,7 @@ static PyObject* AddMethod(PyObject* self, PyObject* args, PyObject* kwargs) {
 
 static PyObject* AddMessage(RepeatedCompositeContainer* self, PyObject* value) {
   cmessage::AssureWritable(self->parent);
-  if (UpdateChildMessages(self) < 0) {
+  if (SyncChildMessages(self) < 0) {
     return nullptr;
   }
 
@@ -288,7 +322,7 @@ static PyObject* Insert(PyObject* pself, PyObject* args) {
 
 PyObject* Extend(RepeatedCompositeContainer* self, PyObject* value) {
   cmessage::AssureWritable(self->parent);
-  if (UpdateChildMessages(self) < 0) {
+  if (SyncChildMessages(self) < 0) {
     return NULL;
   }
   ScopedPyObjectPtr iter(PyObject_GetIter(value));
@@ -323,7 +357,7 @@ static PyObject* ExtendMethod(PyObject* self, PyObject* value) {
 }
 
 PyObject* MergeFrom(RepeatedCompositeContainer* self, PyObject* other) {
-  if (UpdateChildMessages(self) < 0) {
+  if (SyncChildMessages(self) < 0) {
     return NULL;
   }
   return Extend(self, other);
@@ -333,7 +367,17 @@ static PyObject* MergeFromMethod(PyObject* self, PyObject* other) {
   return MergeFrom(reinterpret_cast<RepeatedCompositeContainer*>(self), other);
 }
 
+static PyObject* Item(PyObject* pself, Py_ssize_t index);
+
 PyObject* Subscript(RepeatedCompositeContainer* self, PyObject* slice) {
+  if (PyIndex_Check(slice)) {
+    // Only the wrapper of a single element is needed.
+    Py_ssize_t index = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+    if (index == -1 && PyErr_Occurred()) {
+      return NULL;
+    }
+    return Item(reinterpret_cast<PyObject*>(self), index);
+  }
   if (UpdateChildMessages(self) < 0) {
     return NULL;
   }
@@ -476,16 +520,17 @@ static void ReorderAttached(RepeatedCompositeContainer* self) {
   const FieldDescriptor* descriptor = self->parent_field_descriptor;
   const Py_ssize_t length = Length(reinterpret_cast<PyObject*>(self));
 
-  // Since Python protobuf objects are never arena-allocated, adding and
-  // removing message pointers to the underlying array is just updating
-  // pointers.
+  // The elements are only reordered, so they can be removed and added back
+  // without copying even when they are allocated on an arena.
+  RepeatedPtrField<Message>* field =
+      reflection->MutableRepeatedPtrField<Message>(message, descriptor);
   for (Py_ssize_t i = 0; i < length; ++i)
-    reflection->ReleaseLast(message, descriptor);
+    field->UnsafeArenaReleaseLast();
 
   for (Py_ssize_t i = 0; i < length; ++i) {
     CMessage* py_cmsg = reinterpret_cast<CMessage*>(
         PyList_GET_ITEM(self->child_messages, i));
-    reflection->AddAllocatedMessage(message, descriptor, py_cmsg->message);
+    field->UnsafeArenaAddAllocated(py_cmsg->message);
   }
 }
 
@@ -536,14 +581,18 @@ static PyObject* Item(PyObject* pself, Py_ssize_t index) {
   RepeatedCompositeContainer* self =
       reinterpret_cast<RepeatedCompositeContainer*>(pself);
 
-  if (UpdateChildMessages(self) < 0) {
+  if (SyncChildMessages(self) < 0) {
     return NULL;
   }
   Py_ssize_t length = Length(pself);
   if (index < 0) {
     index = length + index;
   }
-  PyObject* item = PyList_GetItem(self->child_messages, index);
+  if (index < 0 || index >= PyList_GET_SIZE(self->child_messages)) {
+    PyErr_SetString(PyExc_IndexError, "list index out of range");
+    return NULL;
+  }
+  PyObject* item = GetChildMessage(self, index);
   if (item == NULL) {
     return NULL;
   }
@@ -572,28 +621,44 @@ static PyObject* Pop(PyObject* pself, PyObject* args) {
 }
 
 // Release field of parent message and transfer the ownership to target.
-void ReleaseLastTo(Message* message,
-                   const FieldDescriptor* field,
-                   CMessage* target) {
+int ReleaseLastTo(Message* message,
+                  const FieldDescriptor* field,
+                  CMessage* target) {
   GOOGLE_CHECK(message != nullptr);
   GOOGLE_CHECK(field != nullptr);
   GOOGLE_CHECK(target != nullptr);
 
-  CMessage::OwnerRef released_message(
-      message->GetReflection()->ReleaseLast(message, field));
+  Message* released;
+  if (message->GetArena() == NULL) {
+    released = message->GetReflection()->ReleaseLast(message, field);
+  } else {
+    // ReleaseLast() would copy the element off the arena, leaving the Python
+    // objects of its fields pointing to the original.
+    released = message->GetReflection()
+                   ->MutableRepeatedPtrField<Message>(message, field)
+                   ->UnsafeArenaReleaseLast();
+  }
+  CMessage::OwnerRef released_message = arena::Own(released);
+  if (released_message.get() == NULL) {
+    return -1;
+  }
   // TODO(tibell): Deal with proto1.
 
   target->parent = NULL;
   target->parent_field_descriptor = NULL;
   target->message = released_message.get();
   target->read_only = false;
-  cmessage::SetOwner(target, released_message);
+  return cmessage::SetOwner(target, released_message);
 }
 
 // Called to release a container using
 // ClearField('container_field_name') on the parent.
 int Release(RepeatedCompositeContainer* self) {
-  if (UpdateChildMessages(self) < 0) {
+  // When only the parent refers to the container, it is dropped afterwards
+  // and the elements without a wrapper can no longer be reached. Otherwise the
+  // detached container must keep all of them.
+  const bool held = Py_REFCNT(self) > 1;
+  if ((held ? UpdateChildMessages(self) : SyncChildMessages(self)) < 0) {
     PyErr_WriteUnraisable(PyBytes_FromString("Failed to update released "
                                              "messages"));
     return -1;
@@ -608,9 +673,19 @@ int Release(RepeatedCompositeContainer* self) {
   const Py_ssize_t size = PyList_GET_SIZE(self->child_messages);
   GOOGLE_DCHECK_EQ(size, message->GetReflection()->FieldSize(*message, field));
   for (Py_ssize_t i = size - 1; i >= 0; --i) {
-    CMessage* child_cmessage = reinterpret_cast<CMessage*>(
-        PyList_GET_ITEM(self->child_messages, i));
-    ReleaseLastTo(message, field, child_cmessage);
+    PyObject* child = PyList_GET_ITEM(self->child_messages, i);
+    if (child == Py_None) {
+      // Nothing refers to this element or to the container from Python, so
+      // there is nothing to release it to.
+      message->GetReflection()->RemoveLast(message, field);
+      if (PySequence_DelItem(self->child_messages, i) < 0) {
+        return -1;
+      }
+      continue;
+    }
+    if (ReleaseLastTo(message, field, reinterpret_cast<CMessage*>(child)) < 0) {
+      return -1;
+    }
   }
 
   // Detach from containing message.
@@ -659,6 +734,9 @@ int SetOwner(RepeatedCompositeContainer* self,
   const Py_ssize_t n = PyList_GET_SIZE(self->child_messages);
   for (Py_ssize_t i = 0; i < n; ++i) {
     PyObject* msg = PyList_GET_ITEM(self->child_messages, i);
+    if (msg == Py_None) {
+      continue;
+    }
     if (cmessage::SetOwner(reinterpret_cast<CMessage*>(msg), new_owner) == -1) {
       return -1;
     }
@@ -706,6 +784,124 @@ static void Dealloc(PyObject* pself) {
   Py_TYPE(self)->tp_free(pself);
 }
 
+// ---------------------------------------------------------------------
+// Iteration
+//
+// Iterating over an attached container creates the element wrappers one at a
+// time. When the wrapper created two steps earlier is no longer referenced
+// outside of the container and the iterator, it is rebound to the next element
+// instead of allocating a new one, so a loop only keeps a couple of wrappers
+// alive at a time. Two are kept because the loop variable still holds the
+// previous element while the next one is fetched.
+//
+// Only wrappers created by the iterator itself are recycled; wrappers that
+// already existed are returned as they are. Element identity is therefore
+// only kept while the element is referenced, strongly or weakly: the id() of
+// an element that was dropped during the loop may later belong to another
+// element, and indexing that element afterwards returns a new wrapper. This
+// is what Python allows for any object whose last reference went away.
+
+struct RepeatedCompositeIterator {
+  PyObject_HEAD;
+
+  // Strong reference to the container, NULL once exhausted.
+  RepeatedCompositeContainer* container;
+
+  // Index of the next element.
+  Py_ssize_t index;
+
+  // The wrappers created by the iterator that may be recycled, together with
+  // their index in the container.
+  CMessage* recent[2];
+  Py_ssize_t recent_index[2];
+  int slot;
+};
+
+static PyObject* Iter(PyObject* pself) {
+  RepeatedCompositeIterator* it = PyObject_New(
+      RepeatedCompositeIterator, &RepeatedCompositeIterator_Type);
+  if (it == NULL) {
+    return NULL;
+  }
+  Py_INCREF(pself);
+  it->container = reinterpret_cast<RepeatedCompositeContainer*>(pself);
+  it->index = 0;
+  it->recent[0] = it->recent[1] = NULL;
+  it->recent_index[0] = it->recent_index[1] = 0;
+  it->slot = 0;
+  return reinterpret_cast<PyObject*>(it);
+}
+
+static PyObject* IterNext(PyObject* pself) {
+  RepeatedCompositeIterator* it =
+      reinterpret_cast<RepeatedCompositeIterator*>(pself);
+  RepeatedCompositeContainer* self = it->container;
+  if (self == NULL) {
+    return NULL;
+  }
+  if (SyncChildMessages(self) < 0) {
+    return NULL;
+  }
+  const Py_ssize_t size = PyList_GET_SIZE(self->child_messages);
+  if (it->index >= size) {
+    Py_CLEAR(it->container);
+    return NULL;
+  }
+  const Py_ssize_t index = it->index++;
+  PyObject* item = PyList_GET_ITEM(self->child_messages, index);
+  if (item != Py_None) {
+    Py_INCREF(item);
+    return item;
+  }
+
+  // Only attached containers have missing wrappers.
+  const Message& element = self->message->GetReflection()->GetRepeatedMessage(
+      *self->message, self->parent_field_descriptor, index);
+  CMessage* cmsg = it->recent[it->slot];
+  it->recent[it->slot] = NULL;
+  if (cmsg != NULL) {
+    const Py_ssize_t old_index = it->recent_index[it->slot];
+    // The wrapper is only referenced by its slot in the container and by us.
+    if (old_index < size &&
+        PyList_GET_ITEM(self->child_messages, old_index) ==
+            reinterpret_cast<PyObject*>(cmsg) &&
+        cmessage::IsUnreferenced(cmsg, 2)) {
+      Py_INCREF(Py_None);
+      PyList_SetItem(self->child_messages, old_index, Py_None);
+      if (cmessage::Rebind(cmsg, const_cast<Message*>(&element)) < 0) {
+        Py_DECREF(cmsg);
+        return NULL;
+      }
+    } else {
+      Py_DECREF(cmsg);
+      cmsg = NULL;
+    }
+  }
+  if (cmsg == NULL) {
+    cmsg = NewChildMessage(self, index);
+    if (cmsg == NULL) {
+      return NULL;
+    }
+  }
+  Py_INCREF(cmsg);
+  PyList_SetItem(self->child_messages, index,
+                 reinterpret_cast<PyObject*>(cmsg));
+  Py_INCREF(cmsg);
+  it->recent[it->slot] = cmsg;
+  it->recent_index[it->slot] = index;
+  it->slot ^= 1;
+  return reinterpret_cast<PyObject*>(cmsg);
+}
+
+static void IterDealloc(PyObject* pself) {
+  RepeatedCompositeIterator* it =
+      reinterpret_cast<RepeatedCompositeIterator*>(pself);
+  Py_XDECREF(it->recent[0]);
+  Py_XDECREF(it->recent[1]);
+  Py_XDECREF(it->container);
+  PyObject_Del(pself);
+}
+
 static PySequenceMethods SqMethods = {
   Length,                 /* sq_length */
   0,                      /* sq_concat */
@@ -769,7 +965,7 @@ PyTypeObject RepeatedCompositeContainer_Type = {
   0,                                   //  tp_clear
   repeated_composite_container::RichCompare,  //  tp_richcompare
   0,                                   //  tp_weaklistoffset
-  0,                                   //  tp_iter
+  repeated_composite_container::Iter,  //  tp_iter
   0,                                   //  tp_iternext
   repeated_composite_container::Methods,   //  tp_methods
   0,                                   //  tp_members
@@ -782,6 +978,37 @@ PyTypeObject RepeatedCompositeContainer_Type = {
   0,                                   //  tp_init
 };
 
+PyTypeObject RepeatedCompositeIterator_Type = {
+  PyVarObject_HEAD_INIT(&PyType_Type, 0)
+  FULL_MODULE_NAME ".RepeatedCompositeIterator",  // tp_name
+  sizeof(repeated_composite_container::RepeatedCompositeIterator),
+                                       //  tp_basicsize
+  0,                                   //  tp_itemsize
+  repeated_composite_container::IterDealloc,  //  tp_dealloc
+  0,                                   //  tp_print
+  0,                                   //  tp_getattr
+  0,                                   //  tp_setattr
+  0,                                   //  tp_compare
+  0,                                   //  tp_repr
+  0,                                   //  tp_as_number
+  0,                                   //  tp_as_sequence
+  0,                                   //  tp_as_mapping
+  0,                                   //  tp_hash
+  0,                                   //  tp_call
+  0,                                   //  tp_str
+  0,                                   //  tp_getattro
+  0,                                   //  tp_setattro
+  0,                                   //  tp_as_buffer
+  Py_TPFLAGS_DEFAULT,                  //  tp_flags
+  "A repeated message field iterator",  //  tp_doc
+  0,                                   //  tp_traverse
+  0,                                   //  tp_clear
+  0,                                   //  tp_richcompare
+  0,                                   //  tp_weaklistoffset
+  PyObject_SelfIter,                   //  tp_iter
+  repeated_composite_container::IterNext,  //  tp_iternext
+};
+
 }  // namespace python
 }  // namespace protobuf
 }  // namespace google
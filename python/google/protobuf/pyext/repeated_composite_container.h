@@ -90,11 +90,13 @@ typedef struct RepeatedCompositeContainer {
   // The type used to create new child messages.
   CMessageClass* child_message_class;
 
-  // A list of child messages.
+  // A list of child messages. While attached, an entry is None until the
+  // wrapper of that element is needed.
   PyObject* child_messages;
 } RepeatedCompositeContainer;
 
 extern PyTypeObject RepeatedCompositeContainer_Type;
+extern PyTypeObject RepeatedCompositeIterator_Type;
 
 namespace repeated_composite_container {
 
@@ -154,9 +156,10 @@ int SetOwner(RepeatedCompositeContainer* self,
 // Message to 'target'.
 //
 // Corresponds to reflection api method ReleaseMessage.
-void ReleaseLastTo(Message* message,
-                   const FieldDescriptor* field,
-                   CMessage* target);
+// Returns 0 on success, -1 on failure.
+int ReleaseLastTo(Message* message,
+                  const FieldDescriptor* field,
+                  CMessage* target);
 
 }  // namespace repeated_composite_container
 }  // namespace python
@@ -33,13 +33,18 @@
 
 #include <google/protobuf/pyext/repeated_scalar_container.h>
 
+#include <limits.h>
+#include <string.h>
 #include <memory>
+#include <vector>
 
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/pyext/arena.h>
 #include <google/protobuf/pyext/descriptor.h>
 #include <google/protobuf/pyext/descriptor_pool.h>
 #include <google/protobuf/pyext/message.h>
@@ -63,6 +68,9 @@ namespace repeated_scalar_container {
 
 static int InternalAssignRepeatedField(
     RepeatedScalarContainer* self, PyObject* list) {
+  if (CheckNotExported(self) < 0) {
+    return -1;
+  }
   self->message->GetReflection()->ClearField(self->message,
                                              self->parent_field_descriptor);
   for (Py_ssize_t i = 0; i < PyList_GET_SIZE(list); ++i) {
@@ -103,6 +111,9 @@ static int AssignItem(PyObject* pself, Py_ssize_t index, PyObject* arg) {
   }
 
   if (arg == NULL) {
+    if (CheckNotExported(self) < 0) {
+      return -1;
+    }
     ScopedPyObjectPtr py_index(PyLong_FromLong(index));
     return cmessage::InternalDeleteRepeatedField(self->message,
                                                  field_descriptor,
@@ -342,6 +353,9 @@ static PyObject* Subscript(PyObject* pself, PyObject* slice) {
 }
 
 PyObject* Append(RepeatedScalarContainer* self, PyObject* item) {
+  if (CheckNotExported(self) < 0) {
+    return NULL;
+  }
   cmessage::AssureWritable(self->parent);
   Message* message = self->message;
   const FieldDescriptor* field_descriptor = self->parent_field_descriptor;
@@ -466,6 +480,10 @@ static int AssSubscript(PyObject* pself, PyObject* slice, PyObject* value) {
     return -1;
   }
 
+  if ((value == NULL || create_list) && CheckNotExported(self) < 0) {
+    return -1;
+  }
+
   if (value == NULL) {
     return cmessage::InternalDeleteRepeatedField(
         self->message, field_descriptor, slice, nullptr);
@@ -490,6 +508,133 @@ static int AssSubscript(PyObject* pself, PyObject* slice, PyObject* value) {
   return InternalAssignRepeatedField(self, new_list.get());
 }
 
+// Returns 'i', 'u' or 'f' if the struct module format of a buffer describes
+// signed integers, unsigned integers or floating point values in native byte
+// order, 0 otherwise.
+static char FormatKind(const char* format) {
+  if (format == NULL) {
+    return 'u';  // Unsigned bytes.
+  }
+  if (format[0] == '@' || format[0] == '=') {
+    ++format;
+  }
+  if (format[0] == '\0' || format[1] != '\0') {
+    return 0;
+  }
+  switch (format[0]) {
+    case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+      return 'i';
+    case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+      return 'u';
+    case 'f': case 'd':
+      return 'f';
+    default:
+      return 0;
+  }
+}
+
+template <typename T>
+static void AppendValues(Message* message,
+                         const FieldDescriptor* field_descriptor,
+                         const void* data, int count) {
+  RepeatedField<T>* values =
+      message->GetReflection()->MutableRepeatedField<T>(message,
+                                                        field_descriptor);
+  values->Reserve(values->size() + count);
+  memcpy(values->AddNAlreadyReserved(count), data, count * sizeof(T));
+}
+
+// Appends the values of a one-dimensional buffer with items of the same type
+// as the field, e.g. an array.array or a numpy array, with a single memcpy().
+// Returns 1 if it did, 0 if "value" has to be iterated over instead, and -1 on
+// error.
+static int ExtendFromBuffer(RepeatedScalarContainer* self, PyObject* value) {
+  if (!PyObject_CheckBuffer(value)) {
+    return 0;
+  }
+  const FieldDescriptor* field_descriptor = self->parent_field_descriptor;
+  char kind;
+  Py_ssize_t itemsize;
+  switch (field_descriptor->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      kind = 'i';
+      itemsize = sizeof(int32);
+      break;
+    case FieldDescriptor::CPPTYPE_INT64:
+      kind = 'i';
+      itemsize = sizeof(int64);
+      break;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      kind = 'u';
+      itemsize = sizeof(uint32);
+      break;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      kind = 'u';
+      itemsize = sizeof(uint64);
+      break;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      kind = 'f';
+      itemsize = sizeof(float);
+      break;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      kind = 'f';
+      itemsize = sizeof(double);
+      break;
+    default:
+      // Bools and enums need their values checked.
+      return 0;
+  }
+
+  Py_buffer buffer;
+  if (PyObject_GetBuffer(value, &buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) <
+      0) {
+    PyErr_Clear();
+    return 0;
+  }
+  if (buffer.ndim != 1 || buffer.itemsize != itemsize ||
+      FormatKind(buffer.format) != kind) {
+    PyBuffer_Release(&buffer);
+    return 0;
+  }
+
+  int result = 1;
+  const Py_ssize_t count = buffer.len / itemsize;
+  if (count > INT_MAX - Len(reinterpret_cast<PyObject*>(self))) {
+    PyErr_SetString(PyExc_OverflowError,
+                    "Too many values for a repeated field");
+    result = -1;
+  } else if (count > 0 && CheckNotExported(self) < 0) {
+    result = -1;
+  } else if (count > 0) {
+    cmessage::AssureWritable(self->parent);
+    Message* message = self->message;
+    switch (field_descriptor->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_INT32:
+        AppendValues<int32>(message, field_descriptor, buffer.buf, count);
+        break;
+      case FieldDescriptor::CPPTYPE_INT64:
+        AppendValues<int64>(message, field_descriptor, buffer.buf, count);
+        break;
+      case FieldDescriptor::CPPTYPE_UINT32:
+        AppendValues<uint32>(message, field_descriptor, buffer.buf, count);
+        break;
+      case FieldDescriptor::CPPTYPE_UINT64:
+        AppendValues<uint64>(message, field_descriptor, buffer.buf, count);
+        break;
+      case FieldDescriptor::CPPTYPE_FLOAT:
+        AppendValues<float>(message, field_descriptor, buffer.buf, count);
+        break;
+      case FieldDescriptor::CPPTYPE_DOUBLE:
+        AppendValues<double>(message, field_descriptor, buffer.buf, count);
+        break;
+      default:
+        break;
+    }
+  }
+  PyBuffer_Release(&buffer);
+  return result;
+}
+
 PyObject* Extend(RepeatedScalarContainer* self, PyObject* value) {
   cmessage::AssureWritable(self->parent);
 
@@ -501,6 +646,28 @@ PyObject* Extend(RepeatedScalarContainer* self, PyObject* value) {
     Py_RETURN_NONE;
   }
 
+  // Extending a field with itself reads from a copy: iterating over it while
+  // appending would never end.
+  ScopedPyObjectPtr copy;
+  if (value == reinterpret_cast<PyObject*>(self)) {
+    ScopedPyObjectPtr full_slice(PySlice_New(NULL, NULL, NULL));
+    if (full_slice == NULL) {
+      return NULL;
+    }
+    copy.reset(Subscript(value, full_slice.get()));
+    if (copy == NULL) {
+      return NULL;
+    }
+    value = copy.get();
+  }
+
+  int extended = ExtendFromBuffer(self, value);
+  if (extended < 0) {
+    return NULL;
+  } else if (extended > 0) {
+    Py_RETURN_NONE;
+  }
+
   ScopedPyObjectPtr iter(PyObject_GetIter(value));
   if (iter == NULL) {
     PyErr_SetString(PyExc_TypeError, "Value must be iterable");
@@ -690,9 +857,7 @@ PyObject *NewContainer(
 }
 
 // Initializes the underlying Message object of "to" so it becomes a new parent
-// repeated scalar, and copies all the values from "from" to it. A child scalar
-// container can be released by passing it as both from and to (e.g. making it
-// the recipient of the new parent message and copying the values from itself).
+// repeated scalar, and copies all the values from "from" to it.
 static int InitializeAndCopyToParentContainer(
     RepeatedScalarContainer* from,
     RepeatedScalarContainer* to) {
@@ -717,7 +882,23 @@ static int InitializeAndCopyToParentContainer(
 }
 
 int Release(RepeatedScalarContainer* self) {
-  return InitializeAndCopyToParentContainer(self, self);
+  // Move the values rather than copying them, so that buffers exported from
+  // the container stay valid. A read-only parent has no values to move.
+  CMessage::OwnerRef new_owner = arena::NewMessageOnSameArena(*self->message);
+  Message* new_message = new_owner.get();
+  if (new_message == NULL) {
+    return -1;
+  }
+  if (self->parent == NULL || !self->parent->read_only) {
+    std::vector<const FieldDescriptor*> fields;
+    fields.push_back(self->parent_field_descriptor);
+    self->message->GetReflection()->SwapFields(self->message, new_message,
+                                               fields);
+  }
+  self->parent = NULL;
+  self->message = new_message;
+  self->owner = new_owner;
+  return 0;
 }
 
 PyObject* DeepCopy(PyObject* pself, PyObject* arg) {
@@ -737,6 +918,150 @@ PyObject* DeepCopy(PyObject* pself, PyObject* arg) {
   return reinterpret_cast<PyObject*>(clone);
 }
 
+int CheckNotExported(RepeatedScalarContainer* self) {
+  if (self->exports > 0) {
+    PyErr_SetString(PyExc_BufferError,
+                    "Existing exports of data: repeated field cannot be "
+                    "resized");
+    return -1;
+  }
+  return 0;
+}
+
+template <typename T>
+static const void* FieldData(const Message* message,
+                             const FieldDescriptor* field_descriptor,
+                             Py_ssize_t* size) {
+  const RepeatedField<T>& values =
+      message->GetReflection()->GetRepeatedField<T>(*message,
+                                                    field_descriptor);
+  *size = values.size();
+  return values.data();
+}
+
+// The object returned by as_buffer(). The container itself does not export
+// its values, so that bytes() and bytearray() of a container convert its
+// elements as in pure Python instead of copying its memory.
+struct RepeatedScalarBuffer {
+  PyObject_HEAD;
+
+  // Strong reference to the container whose values are exported.
+  RepeatedScalarContainer* container;
+};
+
+static PyObject* AsBuffer(PyObject* pself, PyObject* unused) {
+  RepeatedScalarBuffer* buffer =
+      PyObject_New(RepeatedScalarBuffer, &RepeatedScalarBuffer_Type);
+  if (buffer == NULL) {
+    return NULL;
+  }
+  Py_INCREF(pself);
+  buffer->container = reinterpret_cast<RepeatedScalarContainer*>(pself);
+  return reinterpret_cast<PyObject*>(buffer);
+}
+
+// Exports the values of numeric and bool fields as a read-only buffer without
+// copying them, e.g. for numpy.frombuffer(). The field cannot be resized
+// while the buffer is in use. As the protocol requires, the format is only
+// filled in for consumers that ask for it with PyBUF_FORMAT, like memoryview;
+// others get the bytes of the values and must know their type.
+static int GetBuffer(PyObject* pbuffer, Py_buffer* view, int flags) {
+  RepeatedScalarContainer* self =
+      reinterpret_cast<RepeatedScalarBuffer*>(pbuffer)->container;
+  view->obj = NULL;
+  if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+    PyErr_SetString(PyExc_BufferError, "Repeated field buffers are read-only");
+    return -1;
+  }
+
+  const Message* message = self->message;
+  const FieldDescriptor* field_descriptor = self->parent_field_descriptor;
+  const void* data;
+  Py_ssize_t size;
+  const char* format;
+  Py_ssize_t itemsize;
+  switch (field_descriptor->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      data = FieldData<int32>(message, field_descriptor, &size);
+      format = "i";
+      itemsize = sizeof(int32);
+      break;
+    case FieldDescriptor::CPPTYPE_INT64:
+      data = FieldData<int64>(message, field_descriptor, &size);
+      format = "q";
+      itemsize = sizeof(int64);
+      break;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      data = FieldData<uint32>(message, field_descriptor, &size);
+      format = "I";
+      itemsize = sizeof(uint32);
+      break;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      data = FieldData<uint64>(message, field_descriptor, &size);
+      format = "Q";
+      itemsize = sizeof(uint64);
+      break;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      data = FieldData<float>(message, field_descriptor, &size);
+      format = "f";
+      itemsize = sizeof(float);
+      break;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      data = FieldData<double>(message, field_descriptor, &size);
+      format = "d";
+      itemsize = sizeof(double);
+      break;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      data = FieldData<bool>(message, field_descriptor, &size);
+      format = "?";
+      itemsize = sizeof(bool);
+      break;
+    default:
+      PyErr_Format(PyExc_BufferError,
+                   "Repeated %s fields do not support the buffer protocol",
+                   field_descriptor->cpp_type_name());
+      return -1;
+  }
+
+  // The shape and the strides are only valid as long as the buffer.
+  Py_ssize_t* shape_and_strides =
+      static_cast<Py_ssize_t*>(PyMem_Malloc(2 * sizeof(Py_ssize_t)));
+  if (shape_and_strides == NULL) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  shape_and_strides[0] = size;
+  shape_and_strides[1] = itemsize;
+
+  // An empty field may have no storage at all.
+  static const int64 kEmpty = 0;
+  view->buf = const_cast<void*>(data != NULL ? data : &kEmpty);
+  view->obj = pbuffer;
+  Py_INCREF(pbuffer);
+  view->len = size * itemsize;
+  view->readonly = 1;
+  view->itemsize = itemsize;
+  view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(format) : NULL;
+  view->ndim = 1;
+  view->shape = (flags & PyBUF_ND) ? &shape_and_strides[0] : NULL;
+  view->strides =
+      (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &shape_and_strides[1] : NULL;
+  view->suboffsets = NULL;
+  view->internal = shape_and_strides;
+  ++self->exports;
+  return 0;
+}
+
+static void ReleaseBuffer(PyObject* pbuffer, Py_buffer* view) {
+  --reinterpret_cast<RepeatedScalarBuffer*>(pbuffer)->container->exports;
+  PyMem_Free(view->internal);
+}
+
+static void BufferDealloc(PyObject* pbuffer) {
+  Py_DECREF(reinterpret_cast<RepeatedScalarBuffer*>(pbuffer)->container);
+  PyObject_Del(pbuffer);
+}
+
 static void Dealloc(PyObject* pself) {
   RepeatedScalarContainer* self =
       reinterpret_cast<RepeatedScalarContainer*>(pself);
@@ -764,6 +1089,17 @@ static PyMappingMethods MpMethods = {
   AssSubscript, /* mp_ass_subscript */
 };
 
+static PyBufferProcs BufferProcs = {
+#if PY_MAJOR_VERSION < 3
+  0,              /* bf_getreadbuffer */
+  0,              /* bf_getwritebuffer */
+  0,              /* bf_getsegcount */
+  0,              /* bf_getcharbuffer */
+#endif
+  GetBuffer,      /* bf_getbuffer */
+  ReleaseBuffer,  /* bf_releasebuffer */
+};
+
 static PyMethodDef Methods[] = {
   { "__deepcopy__", DeepCopy, METH_VARARGS,
     "Makes a deep copy of the class." },
@@ -783,6 +1119,8 @@ static PyMethodDef Methods[] = {
     "Sorts the repeated container."},
   { "MergeFrom", (PyCFunction)MergeFrom, METH_O,
     "Merges a repeated container into the current container." },
+  { "as_buffer", AsBuffer, METH_NOARGS,
+    "Returns an object exporting the values through the buffer protocol." },
   { NULL, NULL }
 };
 
@@ -827,6 +1165,35 @@ PyTypeObject RepeatedScalarContainer_Type = {
   0,                                   //  tp_init
 };
 
+PyTypeObject RepeatedScalarBuffer_Type = {
+  PyVarObject_HEAD_INIT(&PyType_Type, 0)
+  FULL_MODULE_NAME ".RepeatedScalarBuffer",  // tp_name
+  sizeof(repeated_scalar_container::RepeatedScalarBuffer),  // tp_basicsize
+  0,                                   //  tp_itemsize
+  repeated_scalar_container::BufferDealloc,  //  tp_dealloc
+  0,                                   //  tp_print
+  0,                                   //  tp_getattr
+  0,                                   //  tp_setattr
+  0,                                   //  tp_compare
+  0,                                   //  tp_repr
+  0,                                   //  tp_as_number
+  0,                                   //  tp_as_sequence
+  0,                                   //  tp_as_mapping
+  0,                                   //  tp_hash
+  0,                                   //  tp_call
+  0,                                   //  tp_str
+  0,                                   //  tp_getattro
+  0,                                   //  tp_setattro
+  &repeated_scalar_container::BufferProcs,  //  tp_as_buffer
+#if PY_MAJOR_VERSION < 3
+  Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,  //  tp_flags
+#else
+  Py_TPFLAGS_DEFAULT,                  //  tp_flags
+#endif
+  "The values of a repeated scalar field, through the buffer protocol",
+                                       //  tp_doc
+};
+
 }  // namespace python
 }  // namespace protobuf
 }  // namespace google
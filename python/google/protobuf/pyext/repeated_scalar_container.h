@@ -69,9 +69,15 @@ typedef struct RepeatedScalarContainer {
   // default message instance mutable.
   // The pointer is owned by the global DescriptorPool.
   const FieldDescriptor* parent_field_descriptor;
+
+  // Number of buffers exported through the buffer protocol by as_buffer()
+  // objects. They point to the values of the field, so its size must not
+  // change while there are any.
+  Py_ssize_t exports;
 } RepeatedScalarContainer;
 
 extern PyTypeObject RepeatedScalarContainer_Type;
+extern PyTypeObject RepeatedScalarBuffer_Type;
 
 namespace repeated_scalar_container {
 
@@ -101,6 +107,10 @@ PyObject* Extend(RepeatedScalarContainer* self, PyObject* value);
 void SetOwner(RepeatedScalarContainer* self,
               const CMessage::OwnerRef& new_owner);
 
+// Returns 0 if no buffer is exported from the container. Otherwise sets a
+// BufferError and returns -1.
+int CheckNotExported(RepeatedScalarContainer* self);
+
 }  // namespace repeated_scalar_container
 }  // namespace python
 }  // namespace protobuf
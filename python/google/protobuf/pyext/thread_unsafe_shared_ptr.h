@@ -46,9 +46,20 @@ namespace python {
 template <typename T>
 class ThreadUnsafeSharedPtr {
  public:
+  // Called with "ptr" and "context" instead of deleting "ptr", once the last
+  // reference to it goes away.
+  typedef void (*Deleter)(T* ptr, void* context);
+
   // Takes ownership.
   explicit ThreadUnsafeSharedPtr(T* ptr)
-      : ptr_(ptr), refcount_(ptr ? new RefcountT(1) : nullptr) {
+      : ptr_(ptr), refcount_(ptr ? new RefcountT(1, nullptr, nullptr)
+                                 : nullptr) {
+  }
+
+  // Releases "ptr" with "deleter" instead of deleting it.
+  ThreadUnsafeSharedPtr(T* ptr, Deleter deleter, void* context)
+      : ptr_(ptr), refcount_(ptr ? new RefcountT(1, deleter, context)
+                                 : nullptr) {
   }
 
   ThreadUnsafeSharedPtr(const ThreadUnsafeSharedPtr& other)
@@ -64,7 +75,7 @@ class ThreadUnsafeSharedPtr {
     ptr_ = other.ptr_;
     refcount_ = other.refcount_;
     if (refcount_) {
-      ++*refcount_;
+      ++refcount_->count;
     }
     return *this;
   }
@@ -74,9 +85,13 @@ class ThreadUnsafeSharedPtr {
       GOOGLE_DCHECK(ptr_ == nullptr);
       return;
     }
-    if (--*refcount_ == 0) {
+    if (--refcount_->count == 0) {
+      if (refcount_->deleter != nullptr) {
+        refcount_->deleter(ptr_, refcount_->context);
+      } else {
+        delete ptr_;
+      }
       delete refcount_;
-      delete ptr_;
     }
   }
 
@@ -92,7 +107,13 @@ class ThreadUnsafeSharedPtr {
   }
 
  private:
-  typedef int RefcountT;
+  struct RefcountT {
+    RefcountT(int count, Deleter deleter, void* context)
+        : count(count), deleter(deleter), context(context) {}
+    int count;
+    Deleter deleter;
+    void* context;
+  };
   T* ptr_;
   RefcountT* refcount_;
 };
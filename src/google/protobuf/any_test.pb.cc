@@ -0,0 +1,489 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/any_test.proto
+
+#include "google/protobuf/any_test.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fany_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Any_google_2fprotobuf_2fany_2eproto;
+namespace protobuf_unittest {
+class TestAnyDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAny> _instance;
+} _TestAny_default_instance_;
+}  // namespace protobuf_unittest
+static void InitDefaultsTestAny_google_2fprotobuf_2fany_5ftest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestAny_default_instance_;
+    new (ptr) ::protobuf_unittest::TestAny();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestAny::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestAny_google_2fprotobuf_2fany_5ftest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestAny_google_2fprotobuf_2fany_5ftest_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+void InitDefaults_google_2fprotobuf_2fany_5ftest_2eproto() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAny_google_2fprotobuf_2fany_5ftest_2eproto.base);
+}
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2fany_5ftest_2eproto[1];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2fany_5ftest_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2fany_5ftest_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2fany_5ftest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, int32_value_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, any_value_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestAny, repeated_any_value_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::protobuf_unittest::TestAny)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_TestAny_default_instance_),
+};
+
+static ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptorsTable assign_descriptors_table_google_2fprotobuf_2fany_5ftest_2eproto = {
+  {}, AddDescriptors_google_2fprotobuf_2fany_5ftest_2eproto, "google/protobuf/any_test.proto", schemas,
+  file_default_instances, TableStruct_google_2fprotobuf_2fany_5ftest_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2fany_5ftest_2eproto, 1, file_level_enum_descriptors_google_2fprotobuf_2fany_5ftest_2eproto, file_level_service_descriptors_google_2fprotobuf_2fany_5ftest_2eproto,
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2fany_5ftest_2eproto[] =
+  "\n\036google/protobuf/any_test.proto\022\021protob"
+  "uf_unittest\032\031google/protobuf/any.proto\"y"
+  "\n\007TestAny\022\023\n\013int32_value\030\001 \001(\005\022\'\n\tany_va"
+  "lue\030\002 \001(\0132\024.google.protobuf.Any\0220\n\022repea"
+  "ted_any_value\030\003 \003(\0132\024.google.protobuf.An"
+  "yb\006proto3"
+  ;
+static ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto = {
+  false, InitDefaults_google_2fprotobuf_2fany_5ftest_2eproto, 
+  descriptor_table_protodef_google_2fprotobuf_2fany_5ftest_2eproto,
+  "google/protobuf/any_test.proto", &assign_descriptors_table_google_2fprotobuf_2fany_5ftest_2eproto, 209,
+};
+
+void AddDescriptors_google_2fprotobuf_2fany_5ftest_2eproto() {
+  static constexpr ::PROTOBUF_NAMESPACE_ID::internal::InitFunc deps[1] =
+  {
+    ::AddDescriptors_google_2fprotobuf_2fany_2eproto,
+  };
+ ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2fany_5ftest_2eproto, deps, 1);
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2fany_5ftest_2eproto = []() { AddDescriptors_google_2fprotobuf_2fany_5ftest_2eproto(); return true; }();
+namespace protobuf_unittest {
+
+// ===================================================================
+
+void TestAny::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestAny_default_instance_._instance.get_mutable()->any_value_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class TestAny::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& any_value(const TestAny* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+TestAny::HasBitSetters::any_value(const TestAny* msg) {
+  return *msg->any_value_;
+}
+void TestAny::clear_any_value() {
+  if (GetArenaNoVirtual() == nullptr && any_value_ != nullptr) {
+    delete any_value_;
+  }
+  any_value_ = nullptr;
+}
+void TestAny::clear_repeated_any_value() {
+  repeated_any_value_.Clear();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAny::kInt32ValueFieldNumber;
+const int TestAny::kAnyValueFieldNumber;
+const int TestAny::kRepeatedAnyValueFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAny::TestAny()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestAny)
+}
+TestAny::TestAny(const TestAny& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      repeated_any_value_(from.repeated_any_value_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_any_value()) {
+    any_value_ = new PROTOBUF_NAMESPACE_ID::Any(*from.any_value_);
+  } else {
+    any_value_ = nullptr;
+  }
+  int32_value_ = from.int32_value_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAny)
+}
+
+void TestAny::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestAny_google_2fprotobuf_2fany_5ftest_2eproto.base);
+  ::memset(&any_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&int32_value_) -
+      reinterpret_cast<char*>(&any_value_)) + sizeof(int32_value_));
+}
+
+TestAny::~TestAny() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAny)
+  SharedDtor();
+}
+
+void TestAny::SharedDtor() {
+  if (this != internal_default_instance()) delete any_value_;
+}
+
+void TestAny::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAny& TestAny::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAny_google_2fprotobuf_2fany_5ftest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAny::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAny)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_any_value_.Clear();
+  if (GetArenaNoVirtual() == nullptr && any_value_ != nullptr) {
+    delete any_value_;
+  }
+  any_value_ = nullptr;
+  int32_value_ = 0;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAny::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // int32 int32_value = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_int32_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .google.protobuf.Any any_value = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_any_value(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated .google.protobuf.Any repeated_any_value = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_any_value(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 26 && (ptr += 1));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAny::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestAny)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 int32_value = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &int32_value_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .google.protobuf.Any any_value = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_any_value()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .google.protobuf.Any repeated_any_value = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_any_value()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestAny)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestAny)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAny::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestAny)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 int32_value = 1;
+  if (this->int32_value() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->int32_value(), output);
+  }
+
+  // .google.protobuf.Any any_value = 2;
+  if (this->has_any_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, HasBitSetters::any_value(this), output);
+  }
+
+  // repeated .google.protobuf.Any repeated_any_value = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_any_value_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3,
+      this->repeated_any_value(static_cast<int>(i)),
+      output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestAny)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAny::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAny)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 int32_value = 1;
+  if (this->int32_value() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->int32_value(), target);
+  }
+
+  // .google.protobuf.Any any_value = 2;
+  if (this->has_any_value()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        2, HasBitSetters::any_value(this), target);
+  }
+
+  // repeated .google.protobuf.Any repeated_any_value = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_any_value_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        3, this->repeated_any_value(static_cast<int>(i)), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAny)
+  return target;
+}
+
+size_t TestAny::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAny)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any repeated_any_value = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_any_value_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_any_value(static_cast<int>(i)));
+    }
+  }
+
+  // .google.protobuf.Any any_value = 2;
+  if (this->has_any_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_value_);
+  }
+
+  // int32 int32_value = 1;
+  if (this->int32_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->int32_value());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAny::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest.TestAny)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAny* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAny>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest.TestAny)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest.TestAny)
+    MergeFrom(*source);
+  }
+}
+
+void TestAny::MergeFrom(const TestAny& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAny)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_any_value_.MergeFrom(from.repeated_any_value_);
+  if (from.has_any_value()) {
+    mutable_any_value()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from.any_value());
+  }
+  if (from.int32_value() != 0) {
+    set_int32_value(from.int32_value());
+  }
+}
+
+void TestAny::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest.TestAny)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAny::CopyFrom(const TestAny& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAny)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAny::IsInitialized() const {
+  return true;
+}
+
+void TestAny::Swap(TestAny* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAny::InternalSwap(TestAny* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  CastToBase(&repeated_any_value_)->InternalSwap(CastToBase(&other->repeated_any_value_));
+  swap(any_value_, other->any_value_);
+  swap(int32_value_, other->int32_value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAny::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2fany_5ftest_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2fany_5ftest_2eproto[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestAny* Arena::CreateMaybeMessage< ::protobuf_unittest::TestAny >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest::TestAny >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -54,14 +54,21 @@
 #include <fstream>
 #include <iostream>
 #include <ctype.h>
+#ifndef _WIN32
+#include <signal.h>
+#endif
 
 #include <limits.h> //For PATH_MAX
 
 #include <memory>
+#include <thread>
 
 #ifdef __APPLE__
 #include <mach-o/dyld.h>
 #endif
+#ifdef _MSC_VER
+#include <process.h>  // For _getpid().
+#endif
 
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/stubs/logging.h>
@@ -71,8 +78,10 @@
 #include <google/protobuf/compiler/plugin.pb.h>
 #include <google/protobuf/compiler/code_generator.h>
 #include <google/protobuf/compiler/importer.h>
+#include <google/protobuf/compiler/parser.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/printer.h>
+#include <google/protobuf/io/tokenizer.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
@@ -273,6 +282,452 @@ string PluginName(const std::string& plugin_prefix,
   return plugin_prefix + "gen-" + directive.substr(2, directive.size() - 6);
 }
 
+// Appends the rest of the stream to *contents.  ZeroCopyInputStream does not
+// distinguish errors from the end of the stream, so callers that can detect
+// read errors must check the stream themselves.
+void ReadStreamToString(io::ZeroCopyInputStream* input, std::string* contents) {
+  const void* data;
+  int size;
+  while (input->Next(&data, &size)) {
+    contents->append(static_cast<const char*>(data), size);
+  }
+}
+
+// A SourceTree which can be told to serve the next Open() of a file from
+// contents already in memory.  This lets ParseCacheDatabase compare a file
+// against its cache and, on a miss, have it parsed from exactly the same
+// contents without reading it from disk again.
+class ReadOnceSourceTree : public SourceTree {
+ public:
+  explicit ReadOnceSourceTree(SourceTree* source_tree)
+      : source_tree_(source_tree), next_contents_(NULL) {}
+
+  // Reads the whole file into *contents.  Returns false if it could not be
+  // opened.
+  bool Read(const std::string& filename, std::string* contents) {
+    std::unique_ptr<io::ZeroCopyInputStream> input(
+        source_tree_->Open(filename));
+    if (input == NULL) {
+      return false;
+    }
+    contents->clear();
+    ReadStreamToString(input.get(), contents);
+    return true;
+  }
+
+  // Makes the next Open() return a stream over "contents" if it is for
+  // "filename".  "contents" must outlive that stream.  Every Open() forgets
+  // this, whichever file it is for.
+  void ServeNextOpen(const std::string& filename,
+                     const std::string* contents) {
+    next_filename_ = filename;
+    next_contents_ = contents;
+  }
+
+  // implements SourceTree -------------------------------------------
+  io::ZeroCopyInputStream* Open(const std::string& filename) override {
+    const std::string* contents = next_contents_;
+    const bool serve = contents != NULL && filename == next_filename_;
+    next_filename_.clear();
+    next_contents_ = NULL;
+    if (serve) {
+      return new io::ArrayInputStream(contents->data(), contents->size());
+    }
+    return source_tree_->Open(filename);
+  }
+  std::string GetLastErrorMessage() override {
+    return source_tree_->GetLastErrorMessage();
+  }
+
+ private:
+  SourceTree* source_tree_;
+  std::string next_filename_;
+  const std::string* next_contents_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ReadOnceSourceTree);
+};
+
+// Implements --parse_cache_dir.  A DescriptorDatabase which stores the
+// FileDescriptorProtos parsed by a SourceTreeDescriptorDatabase in a directory
+// on disk, so that later protoc runs do not need to parse .proto files which
+// have not changed.  Each cache entry contains the exact source it was parsed
+// from and is only used if that source is unchanged, so stale entries or
+// entries whose names collide are never used.  Files which produced any
+// errors or warnings while parsing are not cached, so that those diagnostics
+// are printed every time.  This includes files without a syntax statement,
+// for which the parser logs a warning.
+class ParseCacheDatabase : public DescriptorDatabase {
+ public:
+  // "database" must read its files through "source_tree".
+  ParseCacheDatabase(const std::string& cache_dir,
+                     ReadOnceSourceTree* source_tree,
+                     SourceTreeDescriptorDatabase* database,
+                     MultiFileErrorCollector* error_collector)
+      : cache_dir_(cache_dir),
+        source_tree_(source_tree),
+        database_(database),
+        error_collector_(error_collector),
+        database_validation_error_collector_(NULL),
+        validation_error_collector_(this) {
+    AddTrailingSlash(&cache_dir_);
+  }
+
+  // Like SourceTreeDescriptorDatabase::GetValidationErrorCollector(), but
+  // also finds the lines and columns of errors in files read from the cache.
+  DescriptorPool::ErrorCollector* GetValidationErrorCollector() {
+    database_validation_error_collector_ =
+        database_->GetValidationErrorCollector();
+    return &validation_error_collector_;
+  }
+
+  // implements DescriptorDatabase -----------------------------------
+  bool FindFileByName(const std::string& filename,
+                      FileDescriptorProto* output) override {
+    std::string source;
+    if (!source_tree_->Read(filename, &source)) {
+      // Let the underlying database report the error or consult its fallback.
+      cached_files_.erase(filename);
+      return database_->FindFileByName(filename, output);
+    }
+
+    const std::string entry_path = EntryPath(filename, source);
+    if (ReadEntry(entry_path, filename, source, output)) {
+      // Keep what is needed to locate errors found while building the file.
+      CachedFile* cached_file = &cached_files_[filename];
+      cached_file->file = output;
+      cached_file->source.swap(source);
+      cached_file->parsed.reset();
+      return true;
+    }
+    cached_files_.erase(filename);
+
+    // On a miss the underlying database parses the contents just read, which
+    // the source tree hands to it instead of reading the file again.
+    RecordingErrorCollector recording_collector(error_collector_);
+    database_->RecordErrorsTo(&recording_collector);
+    source_tree_->ServeNextOpen(filename, &source);
+    bool success = database_->FindFileByName(filename, output);
+    source_tree_->ServeNextOpen("", NULL);
+    database_->RecordErrorsTo(error_collector_);
+    if (success && !recording_collector.reported_anything() &&
+        HasSyntaxStatement(*output)) {
+      WriteEntry(entry_path, filename, source, *output);
+    }
+    return success;
+  }
+  bool FindFileContainingSymbol(const std::string& symbol_name,
+                                FileDescriptorProto* output) override {
+    return database_->FindFileContainingSymbol(symbol_name, output);
+  }
+  bool FindFileContainingExtension(const std::string& containing_type,
+                                   int field_number,
+                                   FileDescriptorProto* output) override {
+    return database_->FindFileContainingExtension(containing_type,
+                                                  field_number, output);
+  }
+
+ private:
+  // A file read from the cache.
+  struct CachedFile {
+    // The FileDescriptorProto the file was read into, which the
+    // DescriptorPool builds the file from.
+    const FileDescriptorProto* file;
+    std::string source;
+    // The file parsed again from "source" and the locations of its elements,
+    // once an error was found in it.
+    std::unique_ptr<FileDescriptorProto> parsed;
+    SourceLocationTable source_locations;
+  };
+
+  // Reports errors in files read from the cache with the locations found by
+  // parsing them again, and other errors through the underlying database.
+  class ValidationErrorCollector : public DescriptorPool::ErrorCollector {
+   public:
+    explicit ValidationErrorCollector(ParseCacheDatabase* owner)
+        : owner_(owner) {}
+
+    // implements ErrorCollector ---------------------------------------
+    void AddError(const std::string& filename, const std::string& element_name,
+                  const Message* descriptor, ErrorLocation location,
+                  const std::string& message) override {
+      std::map<std::string, CachedFile>::iterator it =
+          owner_->cached_files_.find(filename);
+      if (it == owner_->cached_files_.end()) {
+        owner_->database_validation_error_collector_->AddError(
+            filename, element_name, descriptor, location, message);
+      } else if (owner_->error_collector_ != NULL) {
+        int line, column;
+        Locate(&it->second, descriptor, location, &line, &column);
+        owner_->error_collector_->AddError(filename, line, column, message);
+      }
+    }
+    void AddWarning(const std::string& filename,
+                    const std::string& element_name, const Message* descriptor,
+                    ErrorLocation location,
+                    const std::string& message) override {
+      std::map<std::string, CachedFile>::iterator it =
+          owner_->cached_files_.find(filename);
+      if (it == owner_->cached_files_.end()) {
+        owner_->database_validation_error_collector_->AddWarning(
+            filename, element_name, descriptor, location, message);
+      } else if (owner_->error_collector_ != NULL) {
+        int line, column;
+        Locate(&it->second, descriptor, location, &line, &column);
+        owner_->error_collector_->AddWarning(filename, line, column, message);
+      }
+    }
+
+   private:
+    // Ignores the errors of parsing a cached file again, which parsed
+    // without errors before.
+    class IgnoringErrorCollector : public io::ErrorCollector {
+     public:
+      void AddError(int line, int column,
+                    const std::string& message) override {}
+    };
+
+    // Finds the line and column of "location" in "descriptor", a part of
+    // the FileDescriptorProto "cached_file" was read into.  The DescriptorPool
+    // only knows "descriptor" by address, so the element at the same path in
+    // the file parsed again is looked up instead.
+    static void Locate(CachedFile* cached_file, const Message* descriptor,
+                       ErrorLocation location, int* line, int* column) {
+      *line = -1;
+      *column = 0;
+      std::vector<std::pair<const FieldDescriptor*, int> > path;
+      if (!FindPath(*cached_file->file, descriptor, &path)) {
+        return;
+      }
+      if (cached_file->parsed == NULL) {
+        cached_file->parsed.reset(new FileDescriptorProto);
+        io::ArrayInputStream input(cached_file->source.data(),
+                                   cached_file->source.size());
+        IgnoringErrorCollector error_collector;
+        io::Tokenizer tokenizer(&input, &error_collector);
+        Parser parser;
+        parser.RecordSourceLocationsTo(&cached_file->source_locations);
+        parser.Parse(&tokenizer, cached_file->parsed.get());
+      }
+      const Message* parsed_descriptor = cached_file->parsed.get();
+      for (int i = 0; i < path.size() && parsed_descriptor != NULL; i++) {
+        const Reflection* reflection = parsed_descriptor->GetReflection();
+        const FieldDescriptor* field = path[i].first;
+        if (path[i].second < 0) {
+          parsed_descriptor =
+              reflection->HasField(*parsed_descriptor, field)
+                  ? &reflection->GetMessage(*parsed_descriptor, field)
+                  : NULL;
+        } else {
+          parsed_descriptor =
+              path[i].second < reflection->FieldSize(*parsed_descriptor, field)
+                  ? &reflection->GetRepeatedMessage(*parsed_descriptor, field,
+                                                    path[i].second)
+                  : NULL;
+        }
+      }
+      if (parsed_descriptor != NULL) {
+        cached_file->source_locations.Find(parsed_descriptor, location, line,
+                                           column);
+      }
+    }
+
+    // Appends to *path the message fields, and indices for repeated ones,
+    // that lead from "message" to "target".  Returns false if "target" is not
+    // part of "message".
+    static bool FindPath(
+        const Message& message, const Message* target,
+        std::vector<std::pair<const FieldDescriptor*, int> >* path) {
+      if (&message == target) {
+        return true;
+      }
+      const Reflection* reflection = message.GetReflection();
+      std::vector<const FieldDescriptor*> fields;
+      reflection->ListFields(message, &fields);
+      for (int i = 0; i < fields.size(); i++) {
+        const FieldDescriptor* field = fields[i];
+        if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+          continue;
+        }
+        if (!field->is_repeated()) {
+          path->push_back(std::make_pair(field, -1));
+          if (FindPath(reflection->GetMessage(message, field), target, path)) {
+            return true;
+          }
+          path->pop_back();
+          continue;
+        }
+        for (int j = 0; j < reflection->FieldSize(message, field); j++) {
+          path->push_back(std::make_pair(field, j));
+          if (FindPath(reflection->GetRepeatedMessage(message, field, j),
+                       target, path)) {
+            return true;
+          }
+          path->pop_back();
+        }
+      }
+      return false;
+    }
+
+    ParseCacheDatabase* owner_;
+  };
+
+  // Forwards to another collector and remembers whether anything was
+  // reported.
+  class RecordingErrorCollector : public MultiFileErrorCollector {
+   public:
+    explicit RecordingErrorCollector(MultiFileErrorCollector* delegate)
+        : delegate_(delegate), reported_anything_(false) {}
+
+    bool reported_anything() const { return reported_anything_; }
+
+    // implements MultiFileErrorCollector ------------------------------
+    void AddError(const std::string& filename, int line, int column,
+                  const std::string& message) override {
+      reported_anything_ = true;
+      if (delegate_ != NULL) {
+        delegate_->AddError(filename, line, column, message);
+      }
+    }
+    void AddWarning(const std::string& filename, int line, int column,
+                    const std::string& message) override {
+      reported_anything_ = true;
+      if (delegate_ != NULL) {
+        delegate_->AddWarning(filename, line, column, message);
+      }
+    }
+
+   private:
+    MultiFileErrorCollector* delegate_;
+    bool reported_anything_;
+  };
+
+  static bool HasSyntaxStatement(const FileDescriptorProto& file) {
+    const SourceCodeInfo& info = file.source_code_info();
+    for (int i = 0; i < info.location_size(); i++) {
+      const SourceCodeInfo::Location& location = info.location(i);
+      if (location.path_size() == 1 &&
+          location.path(0) == FileDescriptorProto::kSyntaxFieldNumber) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Entries are named after a hash (FNV-1a) of the virtual file name and the
+  // source, so that each version of a file gets its own entry.  Both are
+  // stored in the entry and checked on lookup.
+  std::string EntryPath(const std::string& filename,
+                        const std::string& source) const {
+    uint64 hash = 14695981039346656037ULL;
+    // The name is followed by a NUL, which cannot be part of it.
+    for (int i = 0; i <= filename.size(); i++) {
+      hash ^= static_cast<uint8>(filename.c_str()[i]);
+      hash *= 1099511628211ULL;
+    }
+    for (int i = 0; i < source.size(); i++) {
+      hash ^= static_cast<uint8>(source[i]);
+      hash *= 1099511628211ULL;
+    }
+    return StrCat(cache_dir_, strings::Hex(hash, strings::ZERO_PAD_16),
+                  ".protocache");
+  }
+
+  // An entry consists of the protoc version, the virtual file name, the
+  // source and the serialized FileDescriptorProto, each but the first
+  // prefixed by its length.
+  bool ReadEntry(const std::string& entry_path, const std::string& filename,
+                 const std::string& source, FileDescriptorProto* output) {
+    int fd;
+    do {
+      fd = open(entry_path.c_str(), O_RDONLY | O_BINARY);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+      return false;
+    }
+    std::string entry;
+    {
+      io::FileInputStream input(fd);
+      input.SetCloseOnDelete(true);
+      ReadStreamToString(&input, &entry);
+      if (input.GetErrno() != 0) {
+        return false;
+      }
+    }
+
+    io::CodedInputStream coded_input(
+        reinterpret_cast<const uint8*>(entry.data()), entry.size());
+    uint32 version;
+    uint32 size;
+    std::string cached_filename;
+    std::string cached_source;
+    std::string serialized_file;
+    return coded_input.ReadVarint32(&version) && version == PROTOBUF_VERSION &&
+           coded_input.ReadVarint32(&size) &&
+           coded_input.ReadString(&cached_filename, size) &&
+           cached_filename == filename && coded_input.ReadVarint32(&size) &&
+           coded_input.ReadString(&cached_source, size) &&
+           cached_source == source && coded_input.ReadVarint32(&size) &&
+           coded_input.ReadString(&serialized_file, size) &&
+           output->ParseFromString(serialized_file);
+  }
+
+  // Failing to write an entry is not an error; the file is simply parsed
+  // again next time.  Entries are written to a temporary file first and then
+  // renamed, so that concurrent protoc runs never see partial entries.
+  void WriteEntry(const std::string& entry_path, const std::string& filename,
+                  const std::string& source, const FileDescriptorProto& file) {
+    std::string serialized_file;
+    if (!file.SerializeToString(&serialized_file)) {
+      return;
+    }
+#ifdef _MSC_VER
+    const int pid = _getpid();
+#else
+    const int pid = getpid();
+#endif
+    const std::string temp_path = StrCat(entry_path, ".", pid, ".tmp");
+    int fd;
+    do {
+      fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY,
+                0666);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+      return;
+    }
+
+    bool success;
+    {
+      io::FileOutputStream output(fd);
+      {
+        io::CodedOutputStream coded_output(&output);
+        coded_output.WriteVarint32(PROTOBUF_VERSION);
+        coded_output.WriteVarint32(filename.size());
+        coded_output.WriteString(filename);
+        coded_output.WriteVarint32(source.size());
+        coded_output.WriteString(source);
+        coded_output.WriteVarint32(serialized_file.size());
+        coded_output.WriteString(serialized_file);
+        success = !coded_output.HadError();
+      }
+      success = output.Close() && success;
+    }
+    if (!success || rename(temp_path.c_str(), entry_path.c_str()) != 0) {
+      remove(temp_path.c_str());
+    }
+  }
+
+  std::string cache_dir_;
+  ReadOnceSourceTree* source_tree_;
+  SourceTreeDescriptorDatabase* database_;
+  MultiFileErrorCollector* error_collector_;
+  DescriptorPool::ErrorCollector* database_validation_error_collector_;
+  ValidationErrorCollector validation_error_collector_;
+  // The files last read from the cache, by name.
+  std::map<std::string, CachedFile> cached_files_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ParseCacheDatabase);
+};
+
 }  // namespace
 
 // A MultiFileErrorCollector that prints errors to stderr.
@@ -779,6 +1234,65 @@ CommandLineInterface::MemoryOutputStream::~MemoryOutputStream() {
 
 // ===================================================================
 
+// Runs a plugin for one output directive.  The plugin process is started on
+// the calling thread, but the request is written and the response read on a
+// background thread, so that the plugins of a protoc run execute concurrently
+// with each other and with the built-in generators.  Plugins only ever see the
+// parsed files, never the output of other generators, so this does not change
+// what they produce.
+class CommandLineInterface::PluginInvocation {
+ public:
+  explicit PluginInvocation(const std::string& plugin_name)
+      : plugin_name_(plugin_name), success_(false) {}
+  ~PluginInvocation() {
+    if (thread_.joinable()) thread_.join();
+  }
+
+  // Starts the given program and sends it the request.  Takes ownership of
+  // the contents of *request.
+  void Start(const std::string& program, Subprocess::SearchMode search_mode,
+             CodeGeneratorRequest* request) {
+    request_.Swap(request);
+    subprocess_.Start(program, search_mode);
+#ifdef _WIN32
+    // Subprocess makes its pipe handles inheritable, so a concurrently started
+    // plugin would keep the pipes of the others open.  Run plugins one at a
+    // time instead.
+    Communicate();
+#else
+    thread_ = std::thread(&PluginInvocation::Communicate, this);
+#endif
+  }
+
+  // Waits for the plugin to exit.  Returns its response, or NULL (filling in
+  // *error) if the plugin could not be run.
+  const CodeGeneratorResponse* Finish(std::string* error) {
+    if (thread_.joinable()) thread_.join();
+    if (!success_) {
+      *error = strings::Substitute("$0: $1", plugin_name_, error_);
+      return NULL;
+    }
+    return &response_;
+  }
+
+ private:
+  void Communicate() {
+    success_ = subprocess_.Communicate(request_, &response_, &error_);
+  }
+
+  const std::string plugin_name_;
+  Subprocess subprocess_;
+  CodeGeneratorRequest request_;
+  CodeGeneratorResponse response_;
+  std::string error_;
+  bool success_;
+  std::thread thread_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(PluginInvocation);
+};
+
+// ===================================================================
+
 #if defined(_WIN32) && !defined(__CYGWIN__)
 const char* const CommandLineInterface::kPathSeparator = ";";
 #else
@@ -839,7 +1353,9 @@ int CommandLineInterface::Run(int argc, const char* const argv[]) {
   std::unique_ptr<ErrorPrinter> error_collector;
   std::unique_ptr<DescriptorPool> descriptor_pool;
   std::unique_ptr<SimpleDescriptorDatabase> descriptor_set_in_database;
+  std::unique_ptr<ReadOnceSourceTree> read_once_source_tree;
   std::unique_ptr<SourceTreeDescriptorDatabase> source_tree_database;
+  std::unique_ptr<ParseCacheDatabase> parse_cache_database;
 
   // Any --descriptor_set_in FileDescriptorSet objects will be used as a
   // fallback to input_files on command line, so create that db first.
@@ -871,13 +1387,27 @@ int CommandLineInterface::Run(int argc, const char* const argv[]) {
     error_collector.reset(
         new ErrorPrinter(error_format_, disk_source_tree.get()));
 
+    SourceTree* source_tree = disk_source_tree.get();
+    if (!parse_cache_dir_.empty()) {
+      read_once_source_tree.reset(new ReadOnceSourceTree(source_tree));
+      source_tree = read_once_source_tree.get();
+    }
     source_tree_database.reset(new SourceTreeDescriptorDatabase(
-        disk_source_tree.get(), descriptor_set_in_database.get()));
+        source_tree, descriptor_set_in_database.get()));
     source_tree_database->RecordErrorsTo(error_collector.get());
 
-    descriptor_pool.reset(new DescriptorPool(
-        source_tree_database.get(),
-        source_tree_database->GetValidationErrorCollector()));
+    if (parse_cache_dir_.empty()) {
+      descriptor_pool.reset(new DescriptorPool(
+          source_tree_database.get(),
+          source_tree_database->GetValidationErrorCollector()));
+    } else {
+      parse_cache_database.reset(new ParseCacheDatabase(
+          parse_cache_dir_, read_once_source_tree.get(),
+          source_tree_database.get(), error_collector.get()));
+      descriptor_pool.reset(new DescriptorPool(
+          parse_cache_database.get(),
+          parse_cache_database->GetValidationErrorCollector()));
+    }
   }
 
   descriptor_pool->EnforceWeakDependencies(true);
@@ -893,7 +1423,36 @@ int CommandLineInterface::Run(int argc, const char* const argv[]) {
 
   // Generate output.
   if (mode_ == MODE_COMPILE) {
-    for (int i = 0; i < output_directives_.size(); i++) {
+    // Consecutive plugin directives are started together so that they run
+    // concurrently.  Their output is still added to the GeneratorContexts in
+    // command-line order below, which keeps insertion points and error
+    // reporting as if the directives had been run one after another.  No
+    // plugin is started after a directive has failed, and none is started
+    // past a built-in generator before that generator has succeeded; plugins
+    // already running when a failure is seen are waited for, but their
+    // output and errors are dropped.
+#ifndef _WIN32
+    // Subprocess::Communicate() toggles SIGPIPE around each call; keep it
+    // ignored for as long as any plugin may be running so that concurrent
+    // calls cannot restore the default handler under each other.
+    typedef void SignalHandler(int);
+    SignalHandler* old_pipe_handler = signal(SIGPIPE, SIG_IGN);
+#endif
+    std::vector<std::unique_ptr<PluginInvocation> > plugin_invocations(
+        output_directives_.size());
+    int started = 0;
+
+    bool success = true;
+    for (int i = 0; i < output_directives_.size() && success; i++) {
+      for (; started < output_directives_.size(); started++) {
+        if (started > i && (output_directives_[i].generator != NULL ||
+                            output_directives_[started].generator != NULL)) {
+          break;
+        }
+        plugin_invocations[started].reset(
+            StartPlugin(parsed_files, output_directives_[started]));
+      }
+
       std::string output_location = output_directives_[i].output_location;
       if (!HasSuffixString(output_location, ".zip") &&
           !HasSuffixString(output_location, ".jar")) {
@@ -906,10 +1465,18 @@ int CommandLineInterface::Run(int argc, const char* const argv[]) {
         *map_slot = new GeneratorContextImpl(parsed_files);
       }
 
-      if (!GenerateOutput(parsed_files, output_directives_[i], *map_slot)) {
-        STLDeleteValues(&output_directories);
-        return 1;
-      }
+      success = GenerateOutput(parsed_files, output_directives_[i],
+                               plugin_invocations[i].get(), *map_slot);
+    }
+
+    // Waits for any plugins still running after a failure.
+    plugin_invocations.clear();
+#ifndef _WIN32
+    signal(SIGPIPE, old_pipe_handler);
+#endif
+    if (!success) {
+      STLDeleteValues(&output_directories);
+      return 1;
     }
   }
 
@@ -1135,6 +1702,7 @@ void CommandLineInterface::Clear() {
   descriptor_set_in_names_.clear();
   descriptor_set_out_name_.clear();
   dependency_out_name_.clear();
+  parse_cache_dir_.clear();
 
 
   mode_ = MODE_COMPILE;
@@ -1566,6 +2134,17 @@ CommandLineInterface::InterpretArgument(const std::string& name,
     }
     dependency_out_name_ = value;
 
+  } else if (name == "--parse_cache_dir") {
+    if (!parse_cache_dir_.empty()) {
+      std::cerr << name << " may only be passed once." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    if (value.empty()) {
+      std::cerr << name << " requires a non-empty value." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    parse_cache_dir_ = value;
+
   } else if (name == "--include_imports") {
     if (imports_in_descriptor_set_) {
       std::cerr << name << " may only be passed once." << std::endl;
@@ -1789,6 +2368,12 @@ void CommandLineInterface::PrintHelpText() {
 "  --dependency_out=FILE       Write a dependency output file in the format\n"
 "                              expected by make. This writes the transitive\n"
 "                              set of input file paths to FILE\n"
+"  --parse_cache_dir=DIR       Keep parsed .proto files in DIR and reuse them\n"
+"                              in later runs for files whose content has not\n"
+"                              changed. DIR must exist and may be shared by\n"
+"                              concurrent runs. Errors found after parsing\n"
+"                              may be reported without line numbers for\n"
+"                              files loaded from the cache.\n"
 "  --error_format=FORMAT       Set the format in which to print errors.\n"
 "                              FORMAT may be 'gcc' (the default) or 'msvs'\n"
 "                              (Microsoft Visual Studio format).\n"
@@ -1836,29 +2421,54 @@ void CommandLineInterface::PrintHelpText() {
       << std::endl;
 }
 
+CommandLineInterface::PluginInvocation* CommandLineInterface::StartPlugin(
+    const std::vector<const FileDescriptor*>& parsed_files,
+    const OutputDirective& output_directive) {
+  if (output_directive.generator != NULL) {
+    // Not a plugin.
+    return NULL;
+  }
+  GOOGLE_CHECK(HasPrefixString(output_directive.name, "--") &&
+        HasSuffixString(output_directive.name, "_out"))
+      << "Bad name for plugin generator: " << output_directive.name;
+
+  std::string plugin_name = PluginName(plugin_prefix_, output_directive.name);
+  std::string parameters = output_directive.parameter;
+  if (!plugin_parameters_[plugin_name].empty()) {
+    if (!parameters.empty()) {
+      parameters.append(",");
+    }
+    parameters.append(plugin_parameters_[plugin_name]);
+  }
+
+  CodeGeneratorRequest request;
+  BuildPluginRequest(parsed_files, parameters, &request);
+
+  PluginInvocation* plugin = new PluginInvocation(plugin_name);
+  std::map<std::string, std::string>::const_iterator plugin_path =
+      plugins_.find(plugin_name);
+  if (plugin_path != plugins_.end()) {
+    plugin->Start(plugin_path->second, Subprocess::EXACT_NAME, &request);
+  } else {
+    plugin->Start(plugin_name, Subprocess::SEARCH_PATH, &request);
+  }
+  return plugin;
+}
+
 bool CommandLineInterface::GenerateOutput(
     const std::vector<const FileDescriptor*>& parsed_files,
     const OutputDirective& output_directive,
+    PluginInvocation* plugin,
     GeneratorContext* generator_context) {
   // Call the generator.
   std::string error;
   if (output_directive.generator == NULL) {
     // This is a plugin.
-    GOOGLE_CHECK(HasPrefixString(output_directive.name, "--") &&
-          HasSuffixString(output_directive.name, "_out"))
-        << "Bad name for plugin generator: " << output_directive.name;
-
-    std::string plugin_name = PluginName(plugin_prefix_, output_directive.name);
-    std::string parameters = output_directive.parameter;
-    if (!plugin_parameters_[plugin_name].empty()) {
-      if (!parameters.empty()) {
-        parameters.append(",");
-      }
-      parameters.append(plugin_parameters_[plugin_name]);
-    }
-    if (!GeneratePluginOutput(parsed_files, plugin_name,
-                              parameters,
-                              generator_context, &error)) {
+    GOOGLE_CHECK(plugin != NULL);
+    const CodeGeneratorResponse* response = plugin->Finish(&error);
+    if (response == NULL ||
+        !WritePluginOutput(PluginName(plugin_prefix_, output_directive.name),
+                           *response, generator_context, &error)) {
       std::cerr << output_directive.name << ": " << error << std::endl;
       return false;
     }
@@ -1954,52 +2564,33 @@ bool CommandLineInterface::GenerateDependencyManifestFile(
   return true;
 }
 
-bool CommandLineInterface::GeneratePluginOutput(
+void CommandLineInterface::BuildPluginRequest(
     const std::vector<const FileDescriptor*>& parsed_files,
-    const std::string& plugin_name, const std::string& parameter,
-    GeneratorContext* generator_context, std::string* error) {
-  CodeGeneratorRequest request;
-  CodeGeneratorResponse response;
-  std::string processed_parameter = parameter;
-
-
-  // Build the request.
-  if (!processed_parameter.empty()) {
-    request.set_parameter(processed_parameter);
+    const std::string& parameter, CodeGeneratorRequest* request) {
+  if (!parameter.empty()) {
+    request->set_parameter(parameter);
   }
 
-
   std::set<const FileDescriptor*> already_seen;
   for (int i = 0; i < parsed_files.size(); i++) {
-    request.add_file_to_generate(parsed_files[i]->name());
+    request->add_file_to_generate(parsed_files[i]->name());
     GetTransitiveDependencies(parsed_files[i],
                               true,  // Include json_name for plugins.
                               true,  // Include source code info.
-                              &already_seen, request.mutable_proto_file());
+                              &already_seen, request->mutable_proto_file());
   }
 
   google::protobuf::compiler::Version* version =
-      request.mutable_compiler_version();
+      request->mutable_compiler_version();
   version->set_major(PROTOBUF_VERSION / 1000000);
   version->set_minor(PROTOBUF_VERSION / 1000 % 1000);
   version->set_patch(PROTOBUF_VERSION % 1000);
   version->set_suffix(PROTOBUF_VERSION_SUFFIX);
+}
 
-  // Invoke the plugin.
-  Subprocess subprocess;
-
-  if (plugins_.count(plugin_name) > 0) {
-    subprocess.Start(plugins_[plugin_name], Subprocess::EXACT_NAME);
-  } else {
-    subprocess.Start(plugin_name, Subprocess::SEARCH_PATH);
-  }
-
-  std::string communicate_error;
-  if (!subprocess.Communicate(request, &response, &communicate_error)) {
-    *error = strings::Substitute("$0: $1", plugin_name, communicate_error);
-    return false;
-  }
-
+bool CommandLineInterface::WritePluginOutput(
+    const std::string& plugin_name, const CodeGeneratorResponse& response,
+    GeneratorContext* generator_context, std::string* error) {
   // Write the files.  We do this even if there was a generator error in order
   // to match the behavior of a compiled-in generator.
   std::unique_ptr<io::ZeroCopyOutputStream> current_output;
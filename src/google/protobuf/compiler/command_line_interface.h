@@ -63,9 +63,11 @@ class SimpleDescriptorDatabase;               // descriptor_database.h
 
 namespace compiler {
 
-class CodeGenerator;     // code_generator.h
-class GeneratorContext;  // code_generator.h
-class DiskSourceTree;    // importer.h
+class CodeGenerator;          // code_generator.h
+class CodeGeneratorRequest;   // plugin.pb.h
+class CodeGeneratorResponse;  // plugin.pb.h
+class GeneratorContext;       // code_generator.h
+class DiskSourceTree;         // importer.h
 
 // This class implements the command-line interface to the protocol compiler.
 // It is designed to make it very easy to create a custom protocol compiler
@@ -207,6 +209,7 @@ class PROTOC_EXPORT CommandLineInterface {
   class ErrorPrinter;
   class GeneratorContextImpl;
   class MemoryOutputStream;
+  class PluginInvocation;
   typedef std::unordered_map<std::string, GeneratorContextImpl*>
       GeneratorContextMap;
 
@@ -274,15 +277,26 @@ class PROTOC_EXPORT CommandLineInterface {
   bool ParseInputFiles(DescriptorPool* descriptor_pool,
                        std::vector<const FileDescriptor*>* parsed_files);
 
-  // Generate the given output file from the given input.
+  // If the given output directive is a plugin, starts running it on the
+  // given input and returns the invocation; otherwise returns NULL.
   struct OutputDirective;  // see below
+  PluginInvocation* StartPlugin(
+      const std::vector<const FileDescriptor*>& parsed_files,
+      const OutputDirective& output_directive);
+
+  // Generate the given output file from the given input.  For plugins,
+  // "plugin" is the invocation returned by StartPlugin().
   bool GenerateOutput(const std::vector<const FileDescriptor*>& parsed_files,
                       const OutputDirective& output_directive,
+                      PluginInvocation* plugin,
                       GeneratorContext* generator_context);
-  bool GeneratePluginOutput(
+  void BuildPluginRequest(
       const std::vector<const FileDescriptor*>& parsed_files,
-      const std::string& plugin_name, const std::string& parameter,
-      GeneratorContext* generator_context, std::string* error);
+      const std::string& parameter, CodeGeneratorRequest* request);
+  bool WritePluginOutput(const std::string& plugin_name,
+                         const CodeGeneratorResponse& response,
+                         GeneratorContext* generator_context,
+                         std::string* error);
 
   // Implements --encode and --decode.
   bool EncodeOrDecode(const DescriptorPool* pool);
@@ -426,6 +440,10 @@ class PROTOC_EXPORT CommandLineInterface {
   // dependency file will be written. Otherwise, empty.
   std::string dependency_out_name_;
 
+  // If --parse_cache_dir was given, this is the directory in which parsed
+  // .proto files are cached across runs. Otherwise, empty.
+  std::string parse_cache_dir_;
+
   // True if --include_imports was given, meaning that we should
   // write all transitive dependencies to the DescriptorSet.  Otherwise, only
   // the .proto files listed on the command-line are added.
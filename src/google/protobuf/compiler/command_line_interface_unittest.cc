@@ -51,8 +51,10 @@
 #include <google/protobuf/compiler/command_line_interface.h>
 #include <google/protobuf/test_util2.h>
 #include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/stubs/substitute.h>
@@ -117,6 +119,9 @@ class CommandLineInterfaceTest : public testing::Test {
   // Create a subdirectory within temp_directory_.
   void CreateTempDir(const std::string& name);
 
+  // The directory which "$tmpdir" refers to.
+  const std::string& temp_directory() const { return temp_directory_; }
+
 #ifdef PROTOBUF_OPENSOURCE
   // Change working directory to temp directory.
   void SwitchToTempDirectory() {
@@ -1311,6 +1316,158 @@ TEST_F(CommandLineInterfaceTest, CwdRelativeInputs) {
   ExpectGenerated("test_generator", "", "foo.proto", "Foo");
 }
 
+// Returns the path of the --parse_cache_dir entry for the given virtual file
+// name and source, named like ParseCacheDatabase::EntryPath() does.
+std::string ParseCacheEntryPath(const std::string& cache_dir,
+                                const std::string& filename,
+                                const std::string& source) {
+  uint64 hash = 14695981039346656037ULL;
+  for (int i = 0; i <= filename.size(); i++) {
+    hash ^= static_cast<uint8>(filename.c_str()[i]);
+    hash *= 1099511628211ULL;
+  }
+  for (int i = 0; i < source.size(); i++) {
+    hash ^= static_cast<uint8>(source[i]);
+    hash *= 1099511628211ULL;
+  }
+  return StrCat(cache_dir, "/", strings::Hex(hash, strings::ZERO_PAD_16),
+                ".protocache");
+}
+
+// Builds a --parse_cache_dir entry in the format ParseCacheDatabase writes.
+std::string MakeParseCacheEntry(const std::string& filename,
+                                const std::string& source,
+                                const FileDescriptorProto& file) {
+  std::string entry;
+  {
+    io::StringOutputStream output(&entry);
+    io::CodedOutputStream coded_output(&output);
+    const std::string serialized_file = file.SerializeAsString();
+    coded_output.WriteVarint32(GOOGLE_PROTOBUF_VERSION);
+    coded_output.WriteVarint32(filename.size());
+    coded_output.WriteString(filename);
+    coded_output.WriteVarint32(source.size());
+    coded_output.WriteString(source);
+    coded_output.WriteVarint32(serialized_file.size());
+    coded_output.WriteString(serialized_file);
+  }
+  return entry;
+}
+
+TEST_F(CommandLineInterfaceTest, ParseCache) {
+  // Test that cached files are used in later runs and that files are parsed
+  // again when their content changes or their entry is corrupt.
+
+  const std::string kSource =
+      "syntax = \"proto2\";\n"
+      "message Foo {}\n";
+  CreateTempDir("cache");
+  CreateTempFile("foo.proto", kSource);
+
+  Run("protocol_compiler --test_out=$tmpdir --parse_cache_dir=$tmpdir/cache "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectNoErrors();
+  ExpectGenerated("test_generator", "", "foo.proto", "Foo");
+  const std::string entry_path =
+      ParseCacheEntryPath(temp_directory() + "/cache", "foo.proto", kSource);
+  ASSERT_TRUE(FileExists(entry_path));
+
+  // Replace the entry with one for the same source which declares another
+  // message, so that the output shows whether the entry was used.
+  FileDescriptorProto cached_file;
+  cached_file.set_name("foo.proto");
+  cached_file.set_syntax("proto2");
+  cached_file.add_message_type()->set_name("Cached");
+  GOOGLE_CHECK_OK(File::SetContents(
+      entry_path, MakeParseCacheEntry("foo.proto", kSource, cached_file), true));
+
+  Run("protocol_compiler --test_out=$tmpdir --parse_cache_dir=$tmpdir/cache "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectNoErrors();
+  ExpectGenerated("test_generator", "", "foo.proto", "Cached");
+
+  // A corrupt entry is ignored and replaced.
+  GOOGLE_CHECK_OK(File::SetContents(entry_path, "corrupt", true));
+
+  Run("protocol_compiler --test_out=$tmpdir --parse_cache_dir=$tmpdir/cache "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectNoErrors();
+  ExpectGenerated("test_generator", "", "foo.proto", "Foo");
+  std::string entry;
+  GOOGLE_CHECK_OK(File::GetContents(entry_path, &entry, true));
+  EXPECT_NE("corrupt", entry);
+
+  // The entry is not used once the source changes.  The new source gets an
+  // entry of its own, so switching back and forth between versions of a file
+  // does not parse it again.
+  const std::string kChangedSource =
+      "syntax = \"proto2\";\n"
+      "message Bar {}\n";
+  CreateTempFile("foo.proto", kChangedSource);
+
+  Run("protocol_compiler --test_out=$tmpdir --parse_cache_dir=$tmpdir/cache "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectNoErrors();
+  ExpectGenerated("test_generator", "", "foo.proto", "Bar");
+  EXPECT_TRUE(FileExists(ParseCacheEntryPath(temp_directory() + "/cache",
+                                             "foo.proto", kChangedSource)));
+  std::string unchanged_entry;
+  GOOGLE_CHECK_OK(File::GetContents(entry_path, &unchanged_entry, true));
+  EXPECT_EQ(entry, unchanged_entry);
+}
+
+TEST_F(CommandLineInterfaceTest, ParseCacheErrorLocations) {
+  // Test that errors in files read from the cache have the same locations as
+  // when the files are parsed.
+
+  CreateTempDir("cache");
+  CreateTempFile("bar.proto",
+    "syntax = \"proto2\";\n"
+    "message Bar {}\n");
+  const std::string kSource =
+      "syntax = \"proto2\";\n"
+      "import \"bar.proto\";\n"
+      "message Foo {\n"
+      "  optional Bar bar = 1;\n"
+      "  optional int32 baz = 1;\n"
+      "}\n";
+  CreateTempFile("foo.proto", kSource);
+
+  Run("protocol_compiler --test_out=$tmpdir --parse_cache_dir=$tmpdir/cache "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectErrorText(
+      "foo.proto:5:24: Field number 1 has already been used in \"Foo\" by "
+      "field \"bar\".\n");
+  // Only files which parsed without errors are cached, and the error above
+  // is found later.
+  EXPECT_TRUE(FileExists(ParseCacheEntryPath(temp_directory() + "/cache",
+                                             "foo.proto", kSource)));
+
+  // foo.proto is read from the cache, but bar.proto no longer defines Bar.
+  CreateTempFile("bar.proto",
+    "syntax = \"proto2\";\n"
+    "message Baz {}\n");
+
+  Run("protocol_compiler --test_out=$tmpdir --parse_cache_dir=$tmpdir/cache "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectErrorText(
+      "foo.proto:4:12: \"Bar\" is not defined.\n"
+      "foo.proto: warning: Import bar.proto but not used.\n");
+
+  // The same errors are reported when the file is parsed.
+  Run("protocol_compiler --test_out=$tmpdir --proto_path=$tmpdir foo.proto");
+
+  ExpectErrorText(
+      "foo.proto:4:12: \"Bar\" is not defined.\n"
+      "foo.proto: warning: Import bar.proto but not used.\n");
+}
+
 TEST_F(CommandLineInterfaceTest, WriteDescriptorSet) {
   CreateTempFile("foo.proto",
     "syntax = \"proto2\";\n"
@@ -1954,6 +2111,58 @@ TEST_F(CommandLineInterfaceTest, GeneratorPluginFail) {
       "--plug_out: prefix-gen-plug: Plugin failed with status code 123.");
 }
 
+TEST_F(CommandLineInterfaceTest, ConcurrentPlugins) {
+  // Test that plugins started together all produce their output, in between
+  // built-in generators.
+
+  CreateTempFile("foo.proto",
+    "syntax = \"proto2\";\n"
+    "message Foo {}\n");
+  CreateTempDir("a");
+  CreateTempDir("b");
+  CreateTempDir("c");
+  CreateTempDir("d");
+
+  Run("protocol_compiler --plug_out=$tmpdir/a --plug_out=$tmpdir/b "
+      "--test_out=$tmpdir/c --plug_out=$tmpdir/d "
+      "--proto_path=$tmpdir foo.proto");
+
+  ExpectNoErrors();
+  ExpectGenerated("test_plugin", "", "foo.proto", "Foo", "a");
+  ExpectGenerated("test_plugin", "", "foo.proto", "Foo", "b");
+  ExpectGenerated("test_generator", "", "foo.proto", "Foo", "c");
+  ExpectGenerated("test_plugin", "", "foo.proto", "Foo", "d");
+}
+
+TEST_F(CommandLineInterfaceTest, ConcurrentPluginsReportFirstError) {
+  // Test that when several concurrently running plugins fail, only the error
+  // of the first one on the command line is reported.
+
+  CreateTempFile("foo.proto",
+    "syntax = \"proto2\";\n"
+    "message Foo {}\n");
+
+  Run("protocol_compiler --plug_out=$tmpdir --plug_out=fail=a:$tmpdir "
+      "--plug_out=fail=b:$tmpdir --proto_path=$tmpdir foo.proto");
+
+  ExpectErrorText("--plug_out: foo.proto: Saw parameter fail=a.\n");
+}
+
+TEST_F(CommandLineInterfaceTest, NoPluginStartedAfterGeneratorError) {
+  // Test that a plugin after a failing built-in generator is never run.  The
+  // plugin would exit on MockCodeGenerator_Exit, while the built-in generator
+  // fails before looking at the file.
+
+  CreateTempFile("foo.proto",
+    "syntax = \"proto2\";\n"
+    "message MockCodeGenerator_Exit {}\n");
+
+  Run("protocol_compiler --test_out=fail=a:$tmpdir "
+      "--plug_out=TestParameter:$tmpdir --proto_path=$tmpdir foo.proto");
+
+  ExpectErrorText("--test_out: foo.proto: Saw parameter fail=a.\n");
+}
+
 TEST_F(CommandLineInterfaceTest, GeneratorPluginCrash) {
   // Test a generator plugin that crashes.
 
@@ -508,6 +508,11 @@ void FileGenerator::GenerateInternalForwardDeclarations(
 }
 
 void FileGenerator::GenerateSourceForMessage(int idx, io::Printer* printer) {
+  GenerateSourceForMessages(std::vector<int>(1, idx), printer);
+}
+
+void FileGenerator::GenerateSourceForMessages(const std::vector<int>& indices,
+                                              io::Printer* printer) {
   Formatter format(printer, variables_);
   GenerateSourceIncludes(printer);
 
@@ -515,31 +520,38 @@ void FileGenerator::GenerateSourceForMessage(int idx, io::Printer* printer) {
   // component (SCC), because we have a single InitDefaults* function for the
   // SCC.
   std::vector<const FieldDescriptor*> fields;
-  for (const Descriptor* message :
-       scc_analyzer_.GetSCC(message_generators_[idx]->descriptor_)
-           ->descriptors) {
-    ListAllFields(message, &fields);
+  for (int idx : indices) {
+    for (const Descriptor* message :
+         scc_analyzer_.GetSCC(message_generators_[idx]->descriptor_)
+             ->descriptors) {
+      ListAllFields(message, &fields);
+    }
   }
   GenerateInternalForwardDeclarations(fields, options_, &scc_analyzer_,
                                       printer);
 
-  if (IsSCCRepresentative(message_generators_[idx]->descriptor_)) {
-    GenerateInitForSCC(GetSCC(message_generators_[idx]->descriptor_), printer);
+  for (int idx : indices) {
+    if (IsSCCRepresentative(message_generators_[idx]->descriptor_)) {
+      GenerateInitForSCC(GetSCC(message_generators_[idx]->descriptor_),
+                         printer);
+    }
   }
 
   {  // package namespace
     NamespaceOpener ns(Namespace(file_, options_), format);
 
-    // Define default instances
-    GenerateSourceDefaultInstance(idx, printer);
-    if (options_.lite_implicit_weak_fields) {
-      format("void $1$_ReferenceStrong() {}\n",
-             message_generators_[idx]->classname_);
-    }
+    for (int idx : indices) {
+      // Define default instances
+      GenerateSourceDefaultInstance(idx, printer);
+      if (options_.lite_implicit_weak_fields) {
+        format("void $1$_ReferenceStrong() {}\n",
+               message_generators_[idx]->classname_);
+      }
 
-    // Generate classes.
-    format("\n");
-    message_generators_[idx]->GenerateClassMethods(printer);
+      // Generate classes.
+      format("\n");
+      message_generators_[idx]->GenerateClassMethods(printer);
+    }
 
     format(
         "\n"
@@ -548,7 +560,9 @@ void FileGenerator::GenerateSourceForMessage(int idx, io::Printer* printer) {
 
   {
     NamespaceOpener proto_ns(ProtobufNamespace(options_), format);
-    message_generators_[idx]->GenerateSourceInProto2Namespace(printer);
+    for (int idx : indices) {
+      message_generators_[idx]->GenerateSourceInProto2Namespace(printer);
+    }
   }
 
   format(
@@ -85,6 +85,10 @@ class FileGenerator {
   int NumMessages() const { return message_generators_.size(); }
   // Similar to GenerateSource but generates only one message
   void GenerateSourceForMessage(int idx, io::Printer* printer);
+  // Similar to GenerateSource but generates only the given messages, which
+  // must be in increasing order.
+  void GenerateSourceForMessages(const std::vector<int>& indices,
+                                 io::Printer* printer);
   void GenerateGlobalSource(io::Printer* printer);
 
  private:
@@ -34,8 +34,10 @@
 
 #include <google/protobuf/compiler/cpp/cpp_generator.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include <google/protobuf/stubs/strutil.h>
@@ -44,6 +46,7 @@
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 
 
 
@@ -52,6 +55,70 @@ namespace protobuf {
 namespace compiler {
 namespace cpp {
 
+namespace {
+
+// With lite_implicit_weak_fields=auto, the number of .cc files is chosen so
+// that each of them contains roughly this many lines of generated code.
+const int kAutoCcFileTargetLines = 10000;
+
+// Returns the number of lines of the .cc file generated for the given
+// messages.
+int CountSourceLines(FileGenerator* file_generator,
+                     const std::vector<int>& indices) {
+  std::string code;
+  {
+    io::StringOutputStream output(&code);
+    io::Printer printer(&output, '$');
+    file_generator->GenerateSourceForMessages(indices, &printer);
+  }
+  return std::count(code.begin(), code.end(), '\n');
+}
+
+// Returns the number of lines of code generated for each message of the file,
+// by index as passed to GenerateSourceForMessage(), not counting the includes
+// every .cc file starts with.  It is used as the cost of compiling the
+// message.
+std::vector<int> CountMessageSourceLines(FileGenerator* file_generator) {
+  const int common_lines =
+      CountSourceLines(file_generator, std::vector<int>());
+  std::vector<int> lines;
+  for (int i = 0; i < file_generator->NumMessages(); i++) {
+    lines.push_back(std::max(
+        1, CountSourceLines(file_generator, std::vector<int>(1, i)) -
+               common_lines));
+  }
+  return lines;
+}
+
+// Distributes the messages over num_cc_files .cc files so that the estimated
+// costs of the files are balanced, by always adding the most expensive
+// remaining message to the cheapest file.  The result is deterministic and
+// the messages of each file are sorted by index.
+std::vector<std::vector<int> > BalanceMessages(const std::vector<int>& costs,
+                                               int num_cc_files) {
+  std::vector<int> order;
+  for (int i = 0; i < costs.size(); i++) {
+    order.push_back(i);
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&costs](int a, int b) { return costs[a] > costs[b]; });
+
+  std::vector<std::vector<int> > cc_files(num_cc_files);
+  std::vector<int64> file_costs(num_cc_files, 0);
+  for (int idx : order) {
+    int cheapest = std::min_element(file_costs.begin(), file_costs.end()) -
+                   file_costs.begin();
+    cc_files[cheapest].push_back(idx);
+    file_costs[cheapest] += costs[idx];
+  }
+  for (int i = 0; i < num_cc_files; i++) {
+    std::sort(cc_files[i].begin(), cc_files[i].end());
+  }
+  return cc_files;
+}
+
+}  // namespace
+
 CppGenerator::CppGenerator() {}
 CppGenerator::~CppGenerator() {}
 
@@ -100,7 +167,9 @@ bool CppGenerator::Generate(const FileDescriptor* file,
     } else if (options[i].first == "lite_implicit_weak_fields") {
       file_options.enforce_mode = EnforceOptimizeMode::kLiteRuntime;
       file_options.lite_implicit_weak_fields = true;
-      if (!options[i].second.empty()) {
+      if (options[i].second == "auto") {
+        file_options.auto_num_cc_files = true;
+      } else if (!options[i].second.empty()) {
         file_options.num_cc_files = strto32(options[i].second.c_str(),
                                             NULL, 10);
       }
@@ -191,23 +260,64 @@ bool CppGenerator::Generate(const FileDescriptor* file,
         file_generator.GenerateGlobalSource(&printer);
       }
 
-      int num_cc_files = file_generator.NumMessages();
+      const int num_messages = file_generator.NumMessages();
+      int num_cc_files = num_messages;
 
       // If we're using implicit weak fields then we allow the user to
       // optionally specify how many files to generate, not counting the global
       // pb.cc file. If we have more files than messages, then some files will
-      // be generated as empty placeholders.
-      if (file_options.num_cc_files > 0) {
-        GOOGLE_CHECK_LE(file_generator.NumMessages(), file_options.num_cc_files)
-            << "There must be at least as many numbered .cc files as messages.";
-        num_cc_files = file_options.num_cc_files;
+      // be generated as empty placeholders. If we have fewer, messages are
+      // grouped so that the estimated compile cost of the files is balanced.
+      // With "auto", the number of files is chosen from the size of the
+      // generated code and listed in a manifest for build systems.
+      std::vector<std::vector<int> > cc_files;
+      if (file_options.auto_num_cc_files ||
+          (file_options.num_cc_files > 0 &&
+           file_options.num_cc_files < num_messages)) {
+        // The messages are generated once more to measure them, which is
+        // cheap compared to compiling the code.
+        std::vector<int> costs = CountMessageSourceLines(&file_generator);
+        if (file_options.auto_num_cc_files) {
+          int64 total_lines = 0;
+          for (int lines : costs) {
+            total_lines += lines;
+          }
+          num_cc_files = std::min<int64>(
+              num_messages, std::max<int64>(1, (total_lines +
+                                                kAutoCcFileTargetLines - 1) /
+                                                   kAutoCcFileTargetLines));
+        } else {
+          num_cc_files = file_options.num_cc_files;
+        }
+        cc_files = BalanceMessages(costs, num_cc_files);
+      } else {
+        if (file_options.num_cc_files > 0) {
+          num_cc_files = file_options.num_cc_files;
+        }
+        cc_files.resize(num_cc_files);
+        for (int i = 0; i < num_messages; i++) {
+          cc_files[i].push_back(i);
+        }
       }
+
       for (int i = 0; i < num_cc_files; i++) {
         std::unique_ptr<io::ZeroCopyOutputStream> output(
             generator_context->Open(StrCat(basename, ".out/", i, ".cc")));
         io::Printer printer(output.get(), '$');
-        if (i < file_generator.NumMessages()) {
-          file_generator.GenerateSourceForMessage(i, &printer);
+        if (!cc_files[i].empty()) {
+          file_generator.GenerateSourceForMessages(cc_files[i], &printer);
+        }
+      }
+
+      if (file_options.auto_num_cc_files) {
+        // The manifest lists the numbered .cc files, relative to the output
+        // directory, one per line.
+        std::unique_ptr<io::ZeroCopyOutputStream> output(
+            generator_context->Open(basename + ".out/manifest.txt"));
+        io::Printer printer(output.get(), '$');
+        for (int i = 0; i < num_cc_files; i++) {
+          printer.Print("$basename$.out/$index$.cc\n", "basename", basename,
+                        "index", StrCat(i));
         }
       }
     }
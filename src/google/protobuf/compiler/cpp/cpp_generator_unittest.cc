@@ -0,0 +1,183 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Tests for splitting the output of lite_implicit_weak_fields into several
+// .cc files.
+
+#include <google/protobuf/compiler/cpp/cpp_generator.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/compiler/command_line_interface.h>
+#include <google/protobuf/stubs/strutil.h>
+
+#include <google/protobuf/testing/file.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace compiler {
+namespace cpp {
+namespace {
+
+// Returns a message definition with the given number of int32 fields.
+std::string MessageWithFields(const std::string& name, int num_fields) {
+  std::string result = "message " + name + " {\n";
+  for (int i = 1; i <= num_fields; i++) {
+    result += StrCat("  optional int32 field", i, " = ", i, ";\n");
+  }
+  return result + "}\n";
+}
+
+class CppGeneratorSplitTest : public testing::Test {
+ protected:
+  // Writes <name>.proto with the given messages and runs the C++ generator
+  // on it with the given lite_implicit_weak_fields value.
+  void Generate(const std::string& name, const std::string& messages,
+                const std::string& num_cc_files) {
+    GOOGLE_CHECK_OK(File::SetContents(
+        TestTempDir() + "/" + name + ".proto",
+        "syntax = \"proto2\";\npackage foo;\n" + messages, true));
+
+    CommandLineInterface cli;
+    cli.SetInputsAreProtoPathRelative(true);
+    CppGenerator cpp_generator;
+    cli.RegisterGenerator("--cpp_out", &cpp_generator, "");
+
+    std::string proto_path = "-I" + TestTempDir();
+    std::string cpp_out = "--cpp_out=lite_implicit_weak_fields=" +
+                          num_cc_files + ":" + TestTempDir();
+    std::string proto_file = name + ".proto";
+    const char* argv[] = {"protoc", proto_path.c_str(), cpp_out.c_str(),
+                          proto_file.c_str()};
+    ASSERT_EQ(0, cli.Run(4, argv));
+  }
+
+  bool Exists(const std::string& path) {
+    return File::Exists(TestTempDir() + "/" + path);
+  }
+
+  std::string Contents(const std::string& path) {
+    std::string contents;
+    GOOGLE_CHECK_OK(
+        File::GetContents(TestTempDir() + "/" + path, &contents, true));
+    return contents;
+  }
+
+  // Returns whether the class of the given message is defined in the file.
+  bool Defines(const std::string& path, const std::string& message) {
+    return Contents(path).find(message + "::" + message + "()") !=
+           std::string::npos;
+  }
+};
+
+TEST_F(CppGeneratorSplitTest, BalancesFiles) {
+  // The large message costs more than the four small ones together, so it
+  // gets a file of its own.
+  Generate("balance",
+           MessageWithFields("Big", 100) + MessageWithFields("Small1", 1) +
+               MessageWithFields("Small2", 1) +
+               MessageWithFields("Small3", 1) + MessageWithFields("Small4", 1),
+           "2");
+
+  ASSERT_TRUE(Exists("balance.out/0.cc"));
+  ASSERT_TRUE(Exists("balance.out/1.cc"));
+  EXPECT_FALSE(Exists("balance.out/2.cc"));
+  EXPECT_FALSE(Exists("balance.out/manifest.txt"));
+  EXPECT_TRUE(Defines("balance.out/0.cc", "Big"));
+  EXPECT_FALSE(Defines("balance.out/1.cc", "Big"));
+  for (int i = 1; i <= 4; i++) {
+    std::string small = StrCat("Small", i);
+    EXPECT_FALSE(Defines("balance.out/0.cc", small));
+    EXPECT_TRUE(Defines("balance.out/1.cc", small));
+  }
+}
+
+TEST_F(CppGeneratorSplitTest, AutoSingleFile) {
+  Generate("auto_small",
+           MessageWithFields("First", 3) + MessageWithFields("Second", 3),
+           "auto");
+
+  EXPECT_EQ("auto_small.out/0.cc\n", Contents("auto_small.out/manifest.txt"));
+  EXPECT_TRUE(Defines("auto_small.out/0.cc", "First"));
+  EXPECT_TRUE(Defines("auto_small.out/0.cc", "Second"));
+  EXPECT_FALSE(Exists("auto_small.out/1.cc"));
+}
+
+TEST_F(CppGeneratorSplitTest, AutoSeveralFiles) {
+  // 30 messages of 10 fields generate well over 10k lines, so they are spread
+  // evenly over several files.
+  std::string messages;
+  for (int i = 0; i < 30; i++) {
+    messages += MessageWithFields(StrCat("Message", i), 10);
+  }
+  Generate("auto_large", messages, "auto");
+
+  std::vector<std::string> files =
+      Split(Contents("auto_large.out/manifest.txt"), "\n");
+  ASSERT_GE(files.size(), 2);
+  ASSERT_LT(files.size(), 30);
+  int total_lines = 0;
+  for (int file = 0; file < files.size(); file++) {
+    EXPECT_EQ(StrCat("auto_large.out/", file, ".cc"), files[file]);
+    const std::string contents = Contents(files[file]);
+    total_lines += std::count(contents.begin(), contents.end(), '\n');
+  }
+  EXPECT_FALSE(Exists(StrCat("auto_large.out/", files.size(), ".cc")));
+  // Each file holds about 10k lines.
+  EXPECT_GT(total_lines, (files.size() - 1) * 10000);
+  EXPECT_LT(total_lines, (files.size() + 1) * 10000);
+
+  std::vector<int> per_file(files.size(), 0);
+  for (int i = 0; i < 30; i++) {
+    int defined_in = 0;
+    for (int file = 0; file < files.size(); file++) {
+      if (Defines(files[file], StrCat("Message", i))) {
+        defined_in++;
+        per_file[file]++;
+      }
+    }
+    EXPECT_EQ(1, defined_in) << "Message" << i;
+  }
+  // The messages cost the same, so the files get the same number of them.
+  for (int file = 0; file < files.size(); file++) {
+    EXPECT_LE(30 / files.size(), per_file[file]) << file;
+    EXPECT_GE((30 + files.size() - 1) / files.size(), per_file[file]) << file;
+  }
+}
+
+}  // namespace
+}  // namespace cpp
+}  // namespace compiler
+}  // namespace protobuf
+}  // namespace google
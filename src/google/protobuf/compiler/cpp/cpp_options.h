@@ -63,6 +63,7 @@ struct Options {
   bool opensource_runtime = false;
   std::string runtime_include_base;
   int num_cc_files = 0;
+  bool auto_num_cc_files = false;
   std::string annotation_pragma_name;
   std::string annotation_guard_name;
   const AccessInfoMap* access_info_map = nullptr;
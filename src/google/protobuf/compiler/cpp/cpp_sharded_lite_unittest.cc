@@ -0,0 +1,90 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Links against the code generated for cpp_test_sharded_lite.proto, whose
+// messages are spread over several .cc files, and checks that they work.
+
+#include <string>
+
+#include <google/protobuf/compiler/cpp/cpp_test_sharded_lite.pb.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace compiler {
+namespace cpp {
+namespace {
+
+using protobuf_unittest_sharded::ShardedBranch;
+using protobuf_unittest_sharded::ShardedLeaf;
+using protobuf_unittest_sharded::ShardedRoot;
+
+TEST(ShardedLiteTest, RoundTrip) {
+  ShardedRoot root;
+  root.set_id(1);
+  root.mutable_leaf()->set_label("leaf");
+  root.mutable_leaf()->set_color(ShardedLeaf::GREEN);
+  ShardedBranch* branch = root.add_branches();
+  branch->add_values(2);
+  branch->mutable_root()->set_id(3);
+  (*root.mutable_leaves_by_name())["name"].set_label("mapped");
+  root.mutable_branch()->mutable_leaf()->set_color(ShardedLeaf::RED);
+
+  std::string serialized;
+  ASSERT_TRUE(root.SerializeToString(&serialized));
+  ShardedRoot parsed;
+  ASSERT_TRUE(parsed.ParseFromString(serialized));
+  EXPECT_EQ(1, parsed.id());
+  EXPECT_EQ("leaf", parsed.leaf().label());
+  EXPECT_EQ(ShardedLeaf::GREEN, parsed.leaf().color());
+  ASSERT_EQ(1, parsed.branches_size());
+  EXPECT_EQ(2, parsed.branches(0).values(0));
+  EXPECT_EQ(3, parsed.branches(0).root().id());
+  EXPECT_EQ("mapped", parsed.leaves_by_name().at("name").label());
+  EXPECT_EQ(ShardedLeaf::RED, parsed.branch().leaf().color());
+  EXPECT_EQ(serialized, parsed.SerializeAsString());
+}
+
+TEST(ShardedLiteTest, DefaultInstances) {
+  // Sub-messages that were never set refer to the default instances defined
+  // in the other .cc files.
+  ShardedRoot root;
+  EXPECT_FALSE(root.has_leaf());
+  EXPECT_EQ("", root.leaf().label());
+  EXPECT_EQ(ShardedLeaf::RED, root.leaf().color());
+  EXPECT_EQ(0, root.branch().values_size());
+  EXPECT_EQ(&ShardedLeaf::default_instance(), &root.leaf());
+}
+
+}  // namespace
+}  // namespace cpp
+}  // namespace compiler
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,597 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+
+#include "google/protobuf/compiler/cpp/cpp_test_sharded_lite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ShardedRoot_LeavesByNameEntry_DoNotUse_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto __attribute__((weak)) ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+void AddDescriptors_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto() __attribute__((weak));
+namespace protobuf_unittest_sharded {
+extern __attribute__((weak)) ShardedLeafDefaultTypeInternal _ShardedLeaf_default_instance_;
+}  // namespace protobuf_unittest_sharded
+namespace protobuf_unittest_sharded {
+class ShardedRootDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ShardedRoot> _instance;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  const ::protobuf_unittest_sharded::ShardedBranch* branch_;
+} _ShardedRoot_default_instance_;
+void ShardedRoot_ReferenceStrong() {}
+
+void ShardedRoot::InitAsDefaultInstance() {
+  ::protobuf_unittest_sharded::_ShardedRoot_default_instance_._instance.get_mutable()->leaf_ = const_cast< ::protobuf_unittest_sharded::ShardedLeaf*>(
+      ::protobuf_unittest_sharded::ShardedLeaf::internal_default_instance());
+}
+class ShardedRoot::HasBitSetters {
+ public:
+  static void set_has_id(ShardedRoot* msg) {
+    msg->_has_bits_[0] |= 0x00000002u;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::MessageLite& leaf(const ShardedRoot* msg);
+  static ::PROTOBUF_NAMESPACE_ID::MessageLite* mutable_leaf(ShardedRoot* msg);
+  static void set_has_leaf(ShardedRoot* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+  static const ::protobuf_unittest_sharded::ShardedBranch& branch(const ShardedRoot* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::MessageLite& ShardedRoot::HasBitSetters::leaf(
+    const ShardedRoot* msg) {
+  if (msg->leaf_ != nullptr) {
+    return *msg->leaf_;
+  } else if (&::protobuf_unittest_sharded::_ShardedLeaf_default_instance_ != nullptr) {
+    return *reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::MessageLite*>(
+        &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_);
+  } else {
+    return *::PROTOBUF_NAMESPACE_ID::internal::ImplicitWeakMessage::default_instance();
+  }
+}
+::PROTOBUF_NAMESPACE_ID::MessageLite*
+ShardedRoot::HasBitSetters::mutable_leaf(ShardedRoot* msg) {
+  msg->_has_bits_[0] |= 0x00000001u;
+  if (msg->leaf_ == nullptr) {
+    if (&::protobuf_unittest_sharded::_ShardedLeaf_default_instance_ == nullptr) {
+      msg->leaf_ = new ::PROTOBUF_NAMESPACE_ID::internal::ImplicitWeakMessage;
+    } else {
+      msg->leaf_ = reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::MessageLite*>(
+          &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_)->New();
+    }
+  }
+  return msg->leaf_;
+}
+const ::protobuf_unittest_sharded::ShardedBranch&
+ShardedRoot::HasBitSetters::branch(const ShardedRoot* msg) {
+  return *msg->choice_.branch_;
+}
+void ShardedRoot::set_allocated_branch(::protobuf_unittest_sharded::ShardedBranch* branch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  clear_choice();
+  if (branch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      branch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, branch, submessage_arena);
+    }
+    set_has_branch();
+    choice_.branch_ = branch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_sharded.ShardedRoot.branch)
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ShardedRoot::kIdFieldNumber;
+const int ShardedRoot::kLeafFieldNumber;
+const int ShardedRoot::kBranchesFieldNumber;
+const int ShardedRoot::kLeavesByNameFieldNumber;
+const int ShardedRoot::kNameFieldNumber;
+const int ShardedRoot::kBranchFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ShardedRoot::ShardedRoot()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_sharded.ShardedRoot)
+}
+ShardedRoot::ShardedRoot(const ShardedRoot& from)
+  : ShardedRoot() {
+  MergeFrom(from);
+}
+void ShardedRoot::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base);
+  ::memset(&leaf_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&id_) -
+      reinterpret_cast<char*>(&leaf_)) + sizeof(id_));
+  clear_has_choice();
+}
+
+ShardedRoot::~ShardedRoot() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_sharded.ShardedRoot)
+  SharedDtor();
+}
+
+void ShardedRoot::SharedDtor() {
+  if (this != internal_default_instance()) delete leaf_;
+  if (has_choice()) {
+    clear_choice();
+  }
+}
+
+void ShardedRoot::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ShardedRoot& ShardedRoot::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ShardedRoot::clear_choice() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest_sharded.ShardedRoot)
+  switch (choice_case()) {
+    case kName: {
+      choice_.name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+      break;
+    }
+    case kBranch: {
+      delete choice_.branch_;
+      break;
+    }
+    case CHOICE_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = CHOICE_NOT_SET;
+}
+
+
+void ShardedRoot::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_sharded.ShardedRoot)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  branches_.Clear();
+  leaves_by_name_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(leaf_ != nullptr);
+    leaf_->Clear();
+  }
+  id_ = 0;
+  clear_choice();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* ShardedRoot::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 id = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        ptr = ctx->ParseMessage(HasBitSetters::mutable_leaf(this), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated .protobuf_unittest_sharded.ShardedBranch branches = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_branches(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 26 && (ptr += 1));
+        break;
+      }
+      // map<string, .protobuf_unittest_sharded.ShardedLeaf> leaves_by_name = 4;
+      case 4: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 34) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&leaves_by_name_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 34 && (ptr += 1));
+        break;
+      }
+      // optional string name = 5;
+      case 5: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_name(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_sharded.ShardedBranch branch = 6;
+      case 6: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_branch(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool ShardedRoot::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_sharded.ShardedRoot)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 id = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          HasBitSetters::set_has_id(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, HasBitSetters::mutable_leaf(this)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_sharded.ShardedBranch branches = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_branches()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<string, .protobuf_unittest_sharded.ShardedLeaf> leaves_by_name = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
+          ShardedRoot_LeavesByNameEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              ShardedRoot_LeavesByNameEntry_DoNotUse,
+              std::string, ::protobuf_unittest_sharded::ShardedLeaf,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf > > parser(&leaves_by_name_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string name = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_sharded.ShardedBranch branch = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_branch()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_sharded.ShardedRoot)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_sharded.ShardedRoot)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void ShardedRoot::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_sharded.ShardedRoot)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+  }
+
+  // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(
+      2, HasBitSetters::leaf(this), output);
+  }
+
+  // repeated .protobuf_unittest_sharded.ShardedBranch branches = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->branches_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(
+      3,
+      this->branches(static_cast<int>(i)),
+      output);
+  }
+
+  // map<string, .protobuf_unittest_sharded.ShardedLeaf> leaves_by_name = 4;
+  if (!this->leaves_by_name().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+      }
+    };
+
+    if (output->IsSerializationDeterministic() &&
+        this->leaves_by_name().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->leaves_by_name().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >::const_iterator
+          it = this->leaves_by_name().begin();
+          it != this->leaves_by_name().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        ShardedRoot_LeavesByNameEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(4, entry, output);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >::const_iterator
+          it = this->leaves_by_name().begin();
+          it != this->leaves_by_name().end(); ++it) {
+        ShardedRoot_LeavesByNameEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(4, entry, output);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  switch (choice_case()) {
+    case kName:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+        5, this->name(), output);
+      break;
+    case kBranch:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(
+        6, HasBitSetters::branch(this), output);
+      break;
+    default: ;
+  }
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_sharded.ShardedRoot)
+}
+
+size_t ShardedRoot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_sharded.ShardedRoot)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protobuf_unittest_sharded.ShardedBranch branches = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->branches_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->branches(static_cast<int>(i)));
+    }
+  }
+
+  // map<string, .protobuf_unittest_sharded.ShardedLeaf> leaves_by_name = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->leaves_by_name_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >::const_iterator
+      it = this->leaves_by_name().begin();
+      it != this->leaves_by_name().end(); ++it) {
+    ShardedRoot_LeavesByNameEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *leaf_);
+    }
+
+    // optional int32 id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->id());
+    }
+
+  }
+  switch (choice_case()) {
+    // optional string name = 5;
+    case kName: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->name());
+      break;
+    }
+    // optional .protobuf_unittest_sharded.ShardedBranch branch = 6;
+    case kBranch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *choice_.branch_);
+      break;
+    }
+    case CHOICE_NOT_SET: {
+      break;
+    }
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ShardedRoot::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ShardedRoot*>(
+      &from));
+}
+
+void ShardedRoot::MergeFrom(const ShardedRoot& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_sharded.ShardedRoot)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  branches_.MergeFrom(from.branches_);
+  leaves_by_name_.MergeFrom(from.leaves_by_name_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      HasBitSetters::mutable_leaf(this)->CheckTypeAndMergeFrom(
+          HasBitSetters::leaf(&from));
+    }
+    if (cached_has_bits & 0x00000002u) {
+      id_ = from.id_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.choice_case()) {
+    case kName: {
+      set_name(from.name());
+      break;
+    }
+    case kBranch: {
+      mutable_branch()->::protobuf_unittest_sharded::ShardedBranch::MergeFrom(from.branch());
+      break;
+    }
+    case CHOICE_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void ShardedRoot::CopyFrom(const ShardedRoot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_sharded.ShardedRoot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShardedRoot::IsInitialized() const {
+  return true;
+}
+
+void ShardedRoot::Swap(ShardedRoot* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ShardedRoot::InternalSwap(ShardedRoot* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  CastToBase(&branches_)->InternalSwap(CastToBase(&other->branches_));
+  leaves_by_name_.Swap(&other->leaves_by_name_);
+  swap(leaf_, other->leaf_);
+  swap(id_, other->id_);
+  swap(choice_, other->choice_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+std::string ShardedRoot::GetTypeName() const {
+  return "protobuf_unittest_sharded.ShardedRoot";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest_sharded
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_sharded::ShardedRoot* Arena::CreateMaybeMessage< ::protobuf_unittest_sharded::ShardedRoot >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_sharded::ShardedRoot >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
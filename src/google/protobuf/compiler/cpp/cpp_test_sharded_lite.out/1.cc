@@ -0,0 +1,424 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+
+#include "google/protobuf/compiler/cpp/cpp_test_sharded_lite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ShardedRoot_LeavesByNameEntry_DoNotUse_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto __attribute__((weak)) ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+void AddDescriptors_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto() __attribute__((weak));
+namespace protobuf_unittest_sharded {
+extern __attribute__((weak)) ShardedLeafDefaultTypeInternal _ShardedLeaf_default_instance_;
+}  // namespace protobuf_unittest_sharded
+static void InitDefaultsShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_sharded::_ShardedRoot_default_instance_;
+    new (ptr) ::protobuf_unittest_sharded::ShardedRoot();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  {
+    void* ptr = &::protobuf_unittest_sharded::_ShardedBranch_default_instance_;
+    new (ptr) ::protobuf_unittest_sharded::ShardedBranch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_sharded::ShardedRoot::InitAsDefaultInstance();
+  ::protobuf_unittest_sharded::ShardedBranch::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto}, {
+      &scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base,
+      &scc_info_ShardedRoot_LeavesByNameEntry_DoNotUse_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base,}};
+
+namespace protobuf_unittest_sharded {
+class ShardedBranchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ShardedBranch> _instance;
+} _ShardedBranch_default_instance_;
+void ShardedBranch_ReferenceStrong() {}
+
+void ShardedBranch::InitAsDefaultInstance() {
+  ::protobuf_unittest_sharded::_ShardedBranch_default_instance_._instance.get_mutable()->leaf_ = const_cast< ::protobuf_unittest_sharded::ShardedLeaf*>(
+      ::protobuf_unittest_sharded::ShardedLeaf::internal_default_instance());
+  ::protobuf_unittest_sharded::_ShardedBranch_default_instance_._instance.get_mutable()->root_ = const_cast< ::protobuf_unittest_sharded::ShardedRoot*>(
+      ::protobuf_unittest_sharded::ShardedRoot::internal_default_instance());
+}
+class ShardedBranch::HasBitSetters {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::MessageLite& leaf(const ShardedBranch* msg);
+  static ::PROTOBUF_NAMESPACE_ID::MessageLite* mutable_leaf(ShardedBranch* msg);
+  static void set_has_leaf(ShardedBranch* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+  static const ::protobuf_unittest_sharded::ShardedRoot& root(const ShardedBranch* msg);
+  static void set_has_root(ShardedBranch* msg) {
+    msg->_has_bits_[0] |= 0x00000002u;
+  }
+};
+
+const ::PROTOBUF_NAMESPACE_ID::MessageLite& ShardedBranch::HasBitSetters::leaf(
+    const ShardedBranch* msg) {
+  if (msg->leaf_ != nullptr) {
+    return *msg->leaf_;
+  } else if (&::protobuf_unittest_sharded::_ShardedLeaf_default_instance_ != nullptr) {
+    return *reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::MessageLite*>(
+        &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_);
+  } else {
+    return *::PROTOBUF_NAMESPACE_ID::internal::ImplicitWeakMessage::default_instance();
+  }
+}
+::PROTOBUF_NAMESPACE_ID::MessageLite*
+ShardedBranch::HasBitSetters::mutable_leaf(ShardedBranch* msg) {
+  msg->_has_bits_[0] |= 0x00000001u;
+  if (msg->leaf_ == nullptr) {
+    if (&::protobuf_unittest_sharded::_ShardedLeaf_default_instance_ == nullptr) {
+      msg->leaf_ = new ::PROTOBUF_NAMESPACE_ID::internal::ImplicitWeakMessage;
+    } else {
+      msg->leaf_ = reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::MessageLite*>(
+          &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_)->New();
+    }
+  }
+  return msg->leaf_;
+}
+const ::protobuf_unittest_sharded::ShardedRoot&
+ShardedBranch::HasBitSetters::root(const ShardedBranch* msg) {
+  return *msg->root_;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ShardedBranch::kValuesFieldNumber;
+const int ShardedBranch::kLeafFieldNumber;
+const int ShardedBranch::kRootFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ShardedBranch::ShardedBranch()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_sharded.ShardedBranch)
+}
+ShardedBranch::ShardedBranch(const ShardedBranch& from)
+  : ShardedBranch() {
+  MergeFrom(from);
+}
+void ShardedBranch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base);
+  ::memset(&leaf_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&root_) -
+      reinterpret_cast<char*>(&leaf_)) + sizeof(root_));
+}
+
+ShardedBranch::~ShardedBranch() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_sharded.ShardedBranch)
+  SharedDtor();
+}
+
+void ShardedBranch::SharedDtor() {
+  if (this != internal_default_instance()) delete leaf_;
+  if (this != internal_default_instance()) delete root_;
+}
+
+void ShardedBranch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ShardedBranch& ShardedBranch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ShardedBranch_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ShardedBranch::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_sharded.ShardedBranch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  values_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(leaf_ != nullptr);
+      leaf_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(root_ != nullptr);
+      root_->Clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* ShardedBranch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // repeated int64 values = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
+          do {
+            add_values(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 8 && (ptr += 1));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_values(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        ptr = ctx->ParseMessage(HasBitSetters::mutable_leaf(this), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_sharded.ShardedRoot root = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_root(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool ShardedBranch::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_sharded.ShardedBranch)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated int64 values = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 1, 8u, input, this->mutable_values())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_values())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, HasBitSetters::mutable_leaf(this)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_sharded.ShardedRoot root = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_root()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_sharded.ShardedBranch)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_sharded.ShardedBranch)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void ShardedBranch::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_sharded.ShardedBranch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int64 values = 1;
+  for (int i = 0, n = this->values_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(
+      1, this->values(i), output);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(
+      2, HasBitSetters::leaf(this), output);
+  }
+
+  // optional .protobuf_unittest_sharded.ShardedRoot root = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(
+      3, HasBitSetters::root(this), output);
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_sharded.ShardedBranch)
+}
+
+size_t ShardedBranch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_sharded.ShardedBranch)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 values = 1;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->values_);
+    total_size += 1 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->values_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *leaf_);
+    }
+
+    // optional .protobuf_unittest_sharded.ShardedRoot root = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *root_);
+    }
+
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ShardedBranch::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ShardedBranch*>(
+      &from));
+}
+
+void ShardedBranch::MergeFrom(const ShardedBranch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_sharded.ShardedBranch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  values_.MergeFrom(from.values_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      HasBitSetters::mutable_leaf(this)->CheckTypeAndMergeFrom(
+          HasBitSetters::leaf(&from));
+    }
+    if (cached_has_bits & 0x00000002u) {
+      mutable_root()->::protobuf_unittest_sharded::ShardedRoot::MergeFrom(from.root());
+    }
+  }
+}
+
+void ShardedBranch::CopyFrom(const ShardedBranch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_sharded.ShardedBranch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShardedBranch::IsInitialized() const {
+  return true;
+}
+
+void ShardedBranch::Swap(ShardedBranch* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ShardedBranch::InternalSwap(ShardedBranch* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  values_.InternalSwap(&other->values_);
+  swap(leaf_, other->leaf_);
+  swap(root_, other->root_);
+}
+
+std::string ShardedBranch::GetTypeName() const {
+  return "protobuf_unittest_sharded.ShardedBranch";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest_sharded
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_sharded::ShardedBranch* Arena::CreateMaybeMessage< ::protobuf_unittest_sharded::ShardedBranch >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_sharded::ShardedBranch >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,368 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+
+#include "google/protobuf/compiler/cpp/cpp_test_sharded_lite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto __attribute__((weak)) ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+void AddDescriptors_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto() __attribute__((weak));
+namespace protobuf_unittest_sharded {
+extern __attribute__((weak)) ShardedLeafDefaultTypeInternal _ShardedLeaf_default_instance_;
+}  // namespace protobuf_unittest_sharded
+static void InitDefaultsShardedRoot_LeavesByNameEntry_DoNotUse_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_sharded::_ShardedRoot_LeavesByNameEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse();
+  }
+  ::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ShardedRoot_LeavesByNameEntry_DoNotUse_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsShardedRoot_LeavesByNameEntry_DoNotUse_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto}, {
+      &scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base,}};
+
+static void InitDefaultsShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_;
+    new (ptr) ::protobuf_unittest_sharded::ShardedLeaf();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_sharded::ShardedLeaf::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto}, {}};
+
+namespace protobuf_unittest_sharded {
+class ShardedRoot_LeavesByNameEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ShardedRoot_LeavesByNameEntry_DoNotUse> _instance;
+} _ShardedRoot_LeavesByNameEntry_DoNotUse_default_instance_;
+void ShardedRoot_LeavesByNameEntry_DoNotUse_ReferenceStrong() {}
+
+ShardedRoot_LeavesByNameEntry_DoNotUse::ShardedRoot_LeavesByNameEntry_DoNotUse() {}
+ShardedRoot_LeavesByNameEntry_DoNotUse::ShardedRoot_LeavesByNameEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void ShardedRoot_LeavesByNameEntry_DoNotUse::MergeFrom(const ShardedRoot_LeavesByNameEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+class ShardedLeafDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ShardedLeaf> _instance;
+} _ShardedLeaf_default_instance_;
+void ShardedLeaf_ReferenceStrong() {}
+
+void ShardedLeaf::InitAsDefaultInstance() {
+}
+class ShardedLeaf::HasBitSetters {
+ public:
+  static void set_has_label(ShardedLeaf* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+  static void set_has_color(ShardedLeaf* msg) {
+    msg->_has_bits_[0] |= 0x00000002u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ShardedLeaf::kLabelFieldNumber;
+const int ShardedLeaf::kColorFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ShardedLeaf::ShardedLeaf()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_sharded.ShardedLeaf)
+}
+ShardedLeaf::ShardedLeaf(const ShardedLeaf& from)
+  : ShardedLeaf() {
+  MergeFrom(from);
+}
+void ShardedLeaf::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base);
+  label_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  color_ = 1;
+}
+
+ShardedLeaf::~ShardedLeaf() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_sharded.ShardedLeaf)
+  SharedDtor();
+}
+
+void ShardedLeaf::SharedDtor() {
+  label_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void ShardedLeaf::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ShardedLeaf& ShardedLeaf::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ShardedLeaf_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ShardedLeaf::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_sharded.ShardedLeaf)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      label_.ClearNonDefaultToEmptyNoArena();
+    }
+    color_ = 1;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* ShardedLeaf::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional string label = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_label(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_sharded.ShardedLeaf.Color color = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 16) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_sharded::ShardedLeaf_Color_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          break;
+        }
+        set_color(static_cast<::protobuf_unittest_sharded::ShardedLeaf_Color>(val));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool ShardedLeaf::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_sharded.ShardedLeaf)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string label = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_label()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_sharded.ShardedLeaf.Color color = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_sharded::ShardedLeaf_Color_IsValid(value)) {
+            set_color(static_cast< ::protobuf_unittest_sharded::ShardedLeaf_Color >(value));
+          } else {
+            unknown_fields_stream.WriteVarint32(16u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast<::PROTOBUF_NAMESPACE_ID::uint32>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_sharded.ShardedLeaf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_sharded.ShardedLeaf)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void ShardedLeaf::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_sharded.ShardedLeaf)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string label = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->label(), output);
+  }
+
+  // optional .protobuf_unittest_sharded.ShardedLeaf.Color color = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      2, this->color(), output);
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_sharded.ShardedLeaf)
+}
+
+size_t ShardedLeaf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_sharded.ShardedLeaf)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string label = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->label());
+    }
+
+    // optional .protobuf_unittest_sharded.ShardedLeaf.Color color = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->color());
+    }
+
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ShardedLeaf::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ShardedLeaf*>(
+      &from));
+}
+
+void ShardedLeaf::MergeFrom(const ShardedLeaf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_sharded.ShardedLeaf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _has_bits_[0] |= 0x00000001u;
+      label_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.label_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      color_ = from.color_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void ShardedLeaf::CopyFrom(const ShardedLeaf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_sharded.ShardedLeaf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShardedLeaf::IsInitialized() const {
+  return true;
+}
+
+void ShardedLeaf::Swap(ShardedLeaf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ShardedLeaf::InternalSwap(ShardedLeaf* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  label_.Swap(&other->label_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(color_, other->color_);
+}
+
+std::string ShardedLeaf::GetTypeName() const {
+  return "protobuf_unittest_sharded.ShardedLeaf";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest_sharded
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_sharded::ShardedLeaf* Arena::CreateMaybeMessage< ::protobuf_unittest_sharded::ShardedLeaf >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_sharded::ShardedLeaf >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
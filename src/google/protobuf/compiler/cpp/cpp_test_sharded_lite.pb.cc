@@ -0,0 +1,33 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+
+#include "google/protobuf/compiler/cpp/cpp_test_sharded_lite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+namespace protobuf_unittest_sharded {
+bool ShardedLeaf_Color_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+constexpr ShardedLeaf_Color ShardedLeaf::RED;
+constexpr ShardedLeaf_Color ShardedLeaf::GREEN;
+constexpr ShardedLeaf_Color ShardedLeaf::Color_MIN;
+constexpr ShardedLeaf_Color ShardedLeaf::Color_MAX;
+constexpr int ShardedLeaf::Color_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+}  // namespace protobuf_unittest_sharded
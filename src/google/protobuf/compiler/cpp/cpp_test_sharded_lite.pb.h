@@ -0,0 +1,1110 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/compiler/cpp/cpp_test_sharded_lite.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/implicit_weak_message.h>
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry_lite.h>
+#include <google/protobuf/map_field_lite.h>
+#include <google/protobuf/generated_enum_util.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+namespace protobuf_unittest_sharded {
+class ShardedBranch;
+class ShardedBranchDefaultTypeInternal;
+extern ShardedBranchDefaultTypeInternal _ShardedBranch_default_instance_;
+void ShardedBranch_ReferenceStrong();
+class ShardedLeaf;
+class ShardedLeafDefaultTypeInternal;
+extern ShardedLeafDefaultTypeInternal _ShardedLeaf_default_instance_;
+void ShardedLeaf_ReferenceStrong();
+class ShardedRoot;
+class ShardedRootDefaultTypeInternal;
+extern ShardedRootDefaultTypeInternal _ShardedRoot_default_instance_;
+void ShardedRoot_ReferenceStrong();
+class ShardedRoot_LeavesByNameEntry_DoNotUse;
+class ShardedRoot_LeavesByNameEntry_DoNotUseDefaultTypeInternal;
+extern ShardedRoot_LeavesByNameEntry_DoNotUseDefaultTypeInternal _ShardedRoot_LeavesByNameEntry_DoNotUse_default_instance_;
+void ShardedRoot_LeavesByNameEntry_DoNotUse_ReferenceStrong();
+}  // namespace protobuf_unittest_sharded
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest_sharded::ShardedBranch* Arena::CreateMaybeMessage<::protobuf_unittest_sharded::ShardedBranch>(Arena*);
+template<> ::protobuf_unittest_sharded::ShardedLeaf* Arena::CreateMaybeMessage<::protobuf_unittest_sharded::ShardedLeaf>(Arena*);
+template<> ::protobuf_unittest_sharded::ShardedRoot* Arena::CreateMaybeMessage<::protobuf_unittest_sharded::ShardedRoot>(Arena*);
+template<> ::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest_sharded::ShardedRoot_LeavesByNameEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest_sharded {
+
+enum ShardedLeaf_Color {
+  ShardedLeaf_Color_RED = 1,
+  ShardedLeaf_Color_GREEN = 2
+};
+bool ShardedLeaf_Color_IsValid(int value);
+constexpr ShardedLeaf_Color ShardedLeaf_Color_Color_MIN = ShardedLeaf_Color_RED;
+constexpr ShardedLeaf_Color ShardedLeaf_Color_Color_MAX = ShardedLeaf_Color_GREEN;
+constexpr int ShardedLeaf_Color_Color_ARRAYSIZE = ShardedLeaf_Color_Color_MAX + 1;
+
+// ===================================================================
+
+class ShardedRoot_LeavesByNameEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<ShardedRoot_LeavesByNameEntry_DoNotUse, 
+    std::string, ::protobuf_unittest_sharded::ShardedLeaf,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<ShardedRoot_LeavesByNameEntry_DoNotUse, 
+    std::string, ::protobuf_unittest_sharded::ShardedLeaf,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  ShardedRoot_LeavesByNameEntry_DoNotUse();
+  ShardedRoot_LeavesByNameEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const ShardedRoot_LeavesByNameEntry_DoNotUse& other);
+  static const ShardedRoot_LeavesByNameEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const ShardedRoot_LeavesByNameEntry_DoNotUse*>(&_ShardedRoot_LeavesByNameEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class ShardedRoot final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest_sharded.ShardedRoot) */ {
+ public:
+  ShardedRoot();
+  virtual ~ShardedRoot();
+
+  ShardedRoot(const ShardedRoot& from);
+  ShardedRoot(ShardedRoot&& from) noexcept
+    : ShardedRoot() {
+    *this = ::std::move(from);
+  }
+
+  inline ShardedRoot& operator=(const ShardedRoot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShardedRoot& operator=(ShardedRoot&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ShardedRoot& default_instance();
+
+  enum ChoiceCase {
+    kName = 5,
+    kBranch = 6,
+    CHOICE_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ShardedRoot* internal_default_instance() {
+    return reinterpret_cast<const ShardedRoot*>(
+               &_ShardedRoot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  void Swap(ShardedRoot* other);
+  friend void swap(ShardedRoot& a, ShardedRoot& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ShardedRoot* New() const final {
+    return CreateMaybeMessage<ShardedRoot>(nullptr);
+  }
+
+  ShardedRoot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ShardedRoot>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const ShardedRoot& from);
+  void MergeFrom(const ShardedRoot& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ShardedRoot* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest_sharded.ShardedRoot";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // repeated .protobuf_unittest_sharded.ShardedBranch branches = 3;
+  int branches_size() const;
+  void clear_branches();
+  static const int kBranchesFieldNumber = 3;
+  ::protobuf_unittest_sharded::ShardedBranch* mutable_branches(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_sharded::ShardedBranch >*
+      mutable_branches();
+  const ::protobuf_unittest_sharded::ShardedBranch& branches(int index) const;
+  ::protobuf_unittest_sharded::ShardedBranch* add_branches();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_sharded::ShardedBranch >&
+      branches() const;
+
+  // map<string, .protobuf_unittest_sharded.ShardedLeaf> leaves_by_name = 4;
+  int leaves_by_name_size() const;
+  void clear_leaves_by_name();
+  static const int kLeavesByNameFieldNumber = 4;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >&
+      leaves_by_name() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >*
+      mutable_leaves_by_name();
+
+  // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+  bool has_leaf() const;
+  void clear_leaf();
+  static const int kLeafFieldNumber = 2;
+  const ::protobuf_unittest_sharded::ShardedLeaf& leaf() const;
+  ::protobuf_unittest_sharded::ShardedLeaf* release_leaf();
+  ::protobuf_unittest_sharded::ShardedLeaf* mutable_leaf();
+  void set_allocated_leaf(::protobuf_unittest_sharded::ShardedLeaf* leaf);
+
+  // optional int32 id = 1;
+  bool has_id() const;
+  void clear_id();
+  static const int kIdFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional string name = 5;
+  bool has_name() const;
+  void clear_name();
+  static const int kNameFieldNumber = 5;
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+
+  // optional .protobuf_unittest_sharded.ShardedBranch branch = 6;
+  bool has_branch() const;
+  void clear_branch();
+  static const int kBranchFieldNumber = 6;
+  const ::protobuf_unittest_sharded::ShardedBranch& branch() const;
+  ::protobuf_unittest_sharded::ShardedBranch* release_branch();
+  ::protobuf_unittest_sharded::ShardedBranch* mutable_branch();
+  void set_allocated_branch(::protobuf_unittest_sharded::ShardedBranch* branch);
+
+  void clear_choice();
+  ChoiceCase choice_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest_sharded.ShardedRoot)
+ private:
+  class HasBitSetters;
+  void set_has_name();
+  void set_has_branch();
+
+  inline bool has_choice() const;
+  inline void clear_has_choice();
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_sharded::ShardedBranch > branches_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      ShardedRoot_LeavesByNameEntry_DoNotUse,
+      std::string, ::protobuf_unittest_sharded::ShardedLeaf,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > leaves_by_name_;
+  ::PROTOBUF_NAMESPACE_ID::MessageLite* leaf_;
+  ::PROTOBUF_NAMESPACE_ID::int32 id_;
+  union ChoiceUnion {
+    ChoiceUnion() {}
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::protobuf_unittest_sharded::ShardedBranch* branch_;
+  } choice_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShardedBranch final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest_sharded.ShardedBranch) */ {
+ public:
+  ShardedBranch();
+  virtual ~ShardedBranch();
+
+  ShardedBranch(const ShardedBranch& from);
+  ShardedBranch(ShardedBranch&& from) noexcept
+    : ShardedBranch() {
+    *this = ::std::move(from);
+  }
+
+  inline ShardedBranch& operator=(const ShardedBranch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShardedBranch& operator=(ShardedBranch&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ShardedBranch& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ShardedBranch* internal_default_instance() {
+    return reinterpret_cast<const ShardedBranch*>(
+               &_ShardedBranch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(ShardedBranch* other);
+  friend void swap(ShardedBranch& a, ShardedBranch& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ShardedBranch* New() const final {
+    return CreateMaybeMessage<ShardedBranch>(nullptr);
+  }
+
+  ShardedBranch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ShardedBranch>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const ShardedBranch& from);
+  void MergeFrom(const ShardedBranch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ShardedBranch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest_sharded.ShardedBranch";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated int64 values = 1;
+  int values_size() const;
+  void clear_values();
+  static const int kValuesFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int64 values(int index) const;
+  void set_values(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_values(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_values();
+
+  // optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+  bool has_leaf() const;
+  void clear_leaf();
+  static const int kLeafFieldNumber = 2;
+  const ::protobuf_unittest_sharded::ShardedLeaf& leaf() const;
+  ::protobuf_unittest_sharded::ShardedLeaf* release_leaf();
+  ::protobuf_unittest_sharded::ShardedLeaf* mutable_leaf();
+  void set_allocated_leaf(::protobuf_unittest_sharded::ShardedLeaf* leaf);
+
+  // optional .protobuf_unittest_sharded.ShardedRoot root = 3;
+  bool has_root() const;
+  void clear_root();
+  static const int kRootFieldNumber = 3;
+  const ::protobuf_unittest_sharded::ShardedRoot& root() const;
+  ::protobuf_unittest_sharded::ShardedRoot* release_root();
+  ::protobuf_unittest_sharded::ShardedRoot* mutable_root();
+  void set_allocated_root(::protobuf_unittest_sharded::ShardedRoot* root);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest_sharded.ShardedBranch)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > values_;
+  ::PROTOBUF_NAMESPACE_ID::MessageLite* leaf_;
+  ::protobuf_unittest_sharded::ShardedRoot* root_;
+  friend struct ::TableStruct_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShardedLeaf final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest_sharded.ShardedLeaf) */ {
+ public:
+  ShardedLeaf();
+  virtual ~ShardedLeaf();
+
+  ShardedLeaf(const ShardedLeaf& from);
+  ShardedLeaf(ShardedLeaf&& from) noexcept
+    : ShardedLeaf() {
+    *this = ::std::move(from);
+  }
+
+  inline ShardedLeaf& operator=(const ShardedLeaf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShardedLeaf& operator=(ShardedLeaf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ShardedLeaf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ShardedLeaf* internal_default_instance() {
+    return reinterpret_cast<const ShardedLeaf*>(
+               &_ShardedLeaf_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  void Swap(ShardedLeaf* other);
+  friend void swap(ShardedLeaf& a, ShardedLeaf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ShardedLeaf* New() const final {
+    return CreateMaybeMessage<ShardedLeaf>(nullptr);
+  }
+
+  ShardedLeaf* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ShardedLeaf>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const ShardedLeaf& from);
+  void MergeFrom(const ShardedLeaf& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ShardedLeaf* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest_sharded.ShardedLeaf";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ShardedLeaf_Color Color;
+  static constexpr Color RED =
+    ShardedLeaf_Color_RED;
+  static constexpr Color GREEN =
+    ShardedLeaf_Color_GREEN;
+  static inline bool Color_IsValid(int value) {
+    return ShardedLeaf_Color_IsValid(value);
+  }
+  static constexpr Color Color_MIN =
+    ShardedLeaf_Color_Color_MIN;
+  static constexpr Color Color_MAX =
+    ShardedLeaf_Color_Color_MAX;
+  static constexpr int Color_ARRAYSIZE =
+    ShardedLeaf_Color_Color_ARRAYSIZE;
+
+  // accessors -------------------------------------------------------
+
+  // optional string label = 1;
+  bool has_label() const;
+  void clear_label();
+  static const int kLabelFieldNumber = 1;
+  const std::string& label() const;
+  void set_label(const std::string& value);
+  void set_label(std::string&& value);
+  void set_label(const char* value);
+  void set_label(const char* value, size_t size);
+  std::string* mutable_label();
+  std::string* release_label();
+  void set_allocated_label(std::string* label);
+
+  // optional .protobuf_unittest_sharded.ShardedLeaf.Color color = 2;
+  bool has_color() const;
+  void clear_color();
+  static const int kColorFieldNumber = 2;
+  ::protobuf_unittest_sharded::ShardedLeaf_Color color() const;
+  void set_color(::protobuf_unittest_sharded::ShardedLeaf_Color value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest_sharded.ShardedLeaf)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+  int color_;
+  friend struct ::TableStruct_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// ShardedRoot
+
+// optional int32 id = 1;
+inline bool ShardedRoot::has_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ShardedRoot::clear_id() {
+  id_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ShardedRoot::id() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedRoot.id)
+  return id_;
+}
+inline void ShardedRoot::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  id_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedRoot.id)
+}
+
+// optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+inline bool ShardedRoot::has_leaf() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ShardedRoot::clear_leaf() {
+  if (leaf_ != nullptr) leaf_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest_sharded::ShardedLeaf& ShardedRoot::leaf() const {
+  const ::protobuf_unittest_sharded::ShardedLeaf* p = reinterpret_cast< ::protobuf_unittest_sharded::ShardedLeaf* >(leaf_);
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedRoot.leaf)
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_sharded::ShardedLeaf*>(
+      &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_);
+}
+inline ::protobuf_unittest_sharded::ShardedLeaf* ShardedRoot::release_leaf() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_sharded.ShardedRoot.leaf)
+  ::protobuf_unittest_sharded::ShardedLeaf_ReferenceStrong();
+  _has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest_sharded::ShardedLeaf* temp = reinterpret_cast< ::protobuf_unittest_sharded::ShardedLeaf* >(leaf_);
+  leaf_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_sharded::ShardedLeaf* ShardedRoot::mutable_leaf() {
+  _has_bits_[0] |= 0x00000001u;
+  if (leaf_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_sharded::ShardedLeaf>(GetArenaNoVirtual());
+    leaf_ = reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(p);
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedRoot.leaf)
+  return reinterpret_cast< ::protobuf_unittest_sharded::ShardedLeaf* >(leaf_);
+}
+inline void ShardedRoot::set_allocated_leaf(::protobuf_unittest_sharded::ShardedLeaf* leaf) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete leaf_;
+  }
+  if (leaf) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      leaf = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leaf, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  leaf_ = reinterpret_cast<MessageLite*>(leaf);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_sharded.ShardedRoot.leaf)
+}
+
+// repeated .protobuf_unittest_sharded.ShardedBranch branches = 3;
+inline int ShardedRoot::branches_size() const {
+  return branches_.size();
+}
+inline void ShardedRoot::clear_branches() {
+  branches_.Clear();
+}
+inline ::protobuf_unittest_sharded::ShardedBranch* ShardedRoot::mutable_branches(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedRoot.branches)
+  return branches_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_sharded::ShardedBranch >*
+ShardedRoot::mutable_branches() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest_sharded.ShardedRoot.branches)
+  return &branches_;
+}
+inline const ::protobuf_unittest_sharded::ShardedBranch& ShardedRoot::branches(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedRoot.branches)
+  return branches_.Get(index);
+}
+inline ::protobuf_unittest_sharded::ShardedBranch* ShardedRoot::add_branches() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest_sharded.ShardedRoot.branches)
+  return branches_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_sharded::ShardedBranch >&
+ShardedRoot::branches() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest_sharded.ShardedRoot.branches)
+  return branches_;
+}
+
+// map<string, .protobuf_unittest_sharded.ShardedLeaf> leaves_by_name = 4;
+inline int ShardedRoot::leaves_by_name_size() const {
+  return leaves_by_name_.size();
+}
+inline void ShardedRoot::clear_leaves_by_name() {
+  leaves_by_name_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >&
+ShardedRoot::leaves_by_name() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest_sharded.ShardedRoot.leaves_by_name)
+  return leaves_by_name_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest_sharded::ShardedLeaf >*
+ShardedRoot::mutable_leaves_by_name() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest_sharded.ShardedRoot.leaves_by_name)
+  return leaves_by_name_.MutableMap();
+}
+
+// optional string name = 5;
+inline bool ShardedRoot::has_name() const {
+  return choice_case() == kName;
+}
+inline void ShardedRoot::set_has_name() {
+  _oneof_case_[0] = kName;
+}
+inline void ShardedRoot::clear_name() {
+  if (has_name()) {
+    choice_.name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    clear_has_choice();
+  }
+}
+inline const std::string& ShardedRoot::name() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedRoot.name)
+  if (has_name()) {
+    return choice_.name_.GetNoArena();
+  }
+  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void ShardedRoot::set_name(const std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedRoot.name)
+  if (!has_name()) {
+    clear_choice();
+    set_has_name();
+    choice_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  choice_.name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedRoot.name)
+}
+inline void ShardedRoot::set_name(std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedRoot.name)
+  if (!has_name()) {
+    clear_choice();
+    set_has_name();
+    choice_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  choice_.name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_sharded.ShardedRoot.name)
+}
+inline void ShardedRoot::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  if (!has_name()) {
+    clear_choice();
+    set_has_name();
+    choice_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  choice_.name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_sharded.ShardedRoot.name)
+}
+inline void ShardedRoot::set_name(const char* value, size_t size) {
+  if (!has_name()) {
+    clear_choice();
+    set_has_name();
+    choice_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  choice_.name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_sharded.ShardedRoot.name)
+}
+inline std::string* ShardedRoot::mutable_name() {
+  if (!has_name()) {
+    clear_choice();
+    set_has_name();
+    choice_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedRoot.name)
+  return choice_.name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* ShardedRoot::release_name() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_sharded.ShardedRoot.name)
+  if (has_name()) {
+    clear_has_choice();
+    return choice_.name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  } else {
+    return nullptr;
+  }
+}
+inline void ShardedRoot::set_allocated_name(std::string* name) {
+  if (has_choice()) {
+    clear_choice();
+  }
+  if (name != nullptr) {
+    set_has_name();
+    choice_.name_.UnsafeSetDefault(name);
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_sharded.ShardedRoot.name)
+}
+
+// optional .protobuf_unittest_sharded.ShardedBranch branch = 6;
+inline bool ShardedRoot::has_branch() const {
+  return choice_case() == kBranch;
+}
+inline void ShardedRoot::set_has_branch() {
+  _oneof_case_[0] = kBranch;
+}
+inline void ShardedRoot::clear_branch() {
+  if (has_branch()) {
+    delete choice_.branch_;
+    clear_has_choice();
+  }
+}
+inline ::protobuf_unittest_sharded::ShardedBranch* ShardedRoot::release_branch() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_sharded.ShardedRoot.branch)
+  if (has_branch()) {
+    clear_has_choice();
+      ::protobuf_unittest_sharded::ShardedBranch* temp = choice_.branch_;
+    choice_.branch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protobuf_unittest_sharded::ShardedBranch& ShardedRoot::branch() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedRoot.branch)
+  return has_branch()
+      ? *choice_.branch_
+      : *reinterpret_cast< ::protobuf_unittest_sharded::ShardedBranch*>(&::protobuf_unittest_sharded::_ShardedBranch_default_instance_);
+}
+inline ::protobuf_unittest_sharded::ShardedBranch* ShardedRoot::mutable_branch() {
+  if (!has_branch()) {
+    clear_choice();
+    set_has_branch();
+    choice_.branch_ = CreateMaybeMessage< ::protobuf_unittest_sharded::ShardedBranch >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedRoot.branch)
+  return choice_.branch_;
+}
+
+inline bool ShardedRoot::has_choice() const {
+  return choice_case() != CHOICE_NOT_SET;
+}
+inline void ShardedRoot::clear_has_choice() {
+  _oneof_case_[0] = CHOICE_NOT_SET;
+}
+inline ShardedRoot::ChoiceCase ShardedRoot::choice_case() const {
+  return ShardedRoot::ChoiceCase(_oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ShardedBranch
+
+// repeated int64 values = 1;
+inline int ShardedBranch::values_size() const {
+  return values_.size();
+}
+inline void ShardedBranch::clear_values() {
+  values_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 ShardedBranch::values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedBranch.values)
+  return values_.Get(index);
+}
+inline void ShardedBranch::set_values(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedBranch.values)
+}
+inline void ShardedBranch::add_values(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest_sharded.ShardedBranch.values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+ShardedBranch::values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest_sharded.ShardedBranch.values)
+  return values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+ShardedBranch::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest_sharded.ShardedBranch.values)
+  return &values_;
+}
+
+// optional .protobuf_unittest_sharded.ShardedLeaf leaf = 2;
+inline bool ShardedBranch::has_leaf() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ShardedBranch::clear_leaf() {
+  if (leaf_ != nullptr) leaf_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest_sharded::ShardedLeaf& ShardedBranch::leaf() const {
+  const ::protobuf_unittest_sharded::ShardedLeaf* p = reinterpret_cast< ::protobuf_unittest_sharded::ShardedLeaf* >(leaf_);
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedBranch.leaf)
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_sharded::ShardedLeaf*>(
+      &::protobuf_unittest_sharded::_ShardedLeaf_default_instance_);
+}
+inline ::protobuf_unittest_sharded::ShardedLeaf* ShardedBranch::release_leaf() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_sharded.ShardedBranch.leaf)
+  ::protobuf_unittest_sharded::ShardedLeaf_ReferenceStrong();
+  _has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest_sharded::ShardedLeaf* temp = reinterpret_cast< ::protobuf_unittest_sharded::ShardedLeaf* >(leaf_);
+  leaf_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_sharded::ShardedLeaf* ShardedBranch::mutable_leaf() {
+  _has_bits_[0] |= 0x00000001u;
+  if (leaf_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_sharded::ShardedLeaf>(GetArenaNoVirtual());
+    leaf_ = reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(p);
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedBranch.leaf)
+  return reinterpret_cast< ::protobuf_unittest_sharded::ShardedLeaf* >(leaf_);
+}
+inline void ShardedBranch::set_allocated_leaf(::protobuf_unittest_sharded::ShardedLeaf* leaf) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete leaf_;
+  }
+  if (leaf) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      leaf = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leaf, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  leaf_ = reinterpret_cast<MessageLite*>(leaf);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_sharded.ShardedBranch.leaf)
+}
+
+// optional .protobuf_unittest_sharded.ShardedRoot root = 3;
+inline bool ShardedBranch::has_root() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ShardedBranch::clear_root() {
+  if (root_ != nullptr) root_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::protobuf_unittest_sharded::ShardedRoot& ShardedBranch::root() const {
+  const ::protobuf_unittest_sharded::ShardedRoot* p = root_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedBranch.root)
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_sharded::ShardedRoot*>(
+      &::protobuf_unittest_sharded::_ShardedRoot_default_instance_);
+}
+inline ::protobuf_unittest_sharded::ShardedRoot* ShardedBranch::release_root() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_sharded.ShardedBranch.root)
+  _has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest_sharded::ShardedRoot* temp = root_;
+  root_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_sharded::ShardedRoot* ShardedBranch::mutable_root() {
+  _has_bits_[0] |= 0x00000002u;
+  if (root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_sharded::ShardedRoot>(GetArenaNoVirtual());
+    root_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedBranch.root)
+  return root_;
+}
+inline void ShardedBranch::set_allocated_root(::protobuf_unittest_sharded::ShardedRoot* root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete root_;
+  }
+  if (root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, root, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  root_ = root;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_sharded.ShardedBranch.root)
+}
+
+// -------------------------------------------------------------------
+
+// ShardedLeaf
+
+// optional string label = 1;
+inline bool ShardedLeaf::has_label() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ShardedLeaf::clear_label() {
+  label_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ShardedLeaf::label() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedLeaf.label)
+  return label_.GetNoArena();
+}
+inline void ShardedLeaf::set_label(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  label_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedLeaf.label)
+}
+inline void ShardedLeaf::set_label(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  label_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_sharded.ShardedLeaf.label)
+}
+inline void ShardedLeaf::set_label(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  label_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_sharded.ShardedLeaf.label)
+}
+inline void ShardedLeaf::set_label(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  label_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_sharded.ShardedLeaf.label)
+}
+inline std::string* ShardedLeaf::mutable_label() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_sharded.ShardedLeaf.label)
+  return label_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* ShardedLeaf::release_label() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_sharded.ShardedLeaf.label)
+  if (!has_label()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return label_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void ShardedLeaf::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  label_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), label);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_sharded.ShardedLeaf.label)
+}
+
+// optional .protobuf_unittest_sharded.ShardedLeaf.Color color = 2;
+inline bool ShardedLeaf::has_color() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ShardedLeaf::clear_color() {
+  color_ = 1;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::protobuf_unittest_sharded::ShardedLeaf_Color ShardedLeaf::color() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_sharded.ShardedLeaf.color)
+  return static_cast< ::protobuf_unittest_sharded::ShardedLeaf_Color >(color_);
+}
+inline void ShardedLeaf::set_color(::protobuf_unittest_sharded::ShardedLeaf_Color value) {
+  assert(::protobuf_unittest_sharded::ShardedLeaf_Color_IsValid(value));
+  _has_bits_[0] |= 0x00000002u;
+  color_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest_sharded.ShardedLeaf.color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest_sharded
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::protobuf_unittest_sharded::ShardedLeaf_Color> : ::std::true_type {};
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fsharded_5flite_2eproto
@@ -174,6 +174,11 @@ bool MockCodeGenerator::Generate(const FileDescriptor* file,
                                  const std::string& parameter,
                                  GeneratorContext* context,
                                  std::string* error) const {
+  if (HasPrefixString(parameter, "fail=")) {
+    *error = "Saw parameter " + parameter + ".";
+    return false;
+  }
+
   bool annotate = false;
   for (int i = 0; i < file->message_type_count(); i++) {
     if (HasPrefixString(file->message_type(i)->name(), "MockCodeGenerator_")) {
@@ -58,6 +58,9 @@ namespace compiler {
 // its own file.  NAMES is a comma-separated list of the names of those other
 // MockCodeGenerators.
 //
+// If the parameter starts with "fail=", Generate() returns false and sets the
+// error message to "Saw parameter <parameter>." before looking at the file.
+//
 // MockCodeGenerator will also modify its behavior slightly if the input file
 // contains a message type with one of the following names:
 //   MockCodeGenerator_Error:  Causes Generate() to return false and set the
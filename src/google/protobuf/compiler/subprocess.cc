@@ -38,6 +38,7 @@
 
 #ifndef _WIN32
 #include <errno.h>
+#include <fcntl.h>
 #include <sys/select.h>
 #include <sys/wait.h>
 #include <signal.h>
@@ -302,8 +303,10 @@ Subprocess::~Subprocess() {
 }
 
 void Subprocess::Start(const std::string& program, SearchMode search_mode) {
-  // Note that we assume that there are no other threads, thus we don't have to
-  // do crazy stuff like using socket pairs or avoiding libc locks.
+  // Note that we assume that no other thread starts processes at the same
+  // time, thus we don't have to do crazy stuff like using socket pairs.  Other
+  // threads may be communicating with previously started subprocesses, so the
+  // child must not do anything but async-signal-safe calls before exec.
 
   // [0] is read end, [1] is write end.
   int stdin_pipe[2];
@@ -312,6 +315,12 @@ void Subprocess::Start(const std::string& program, SearchMode search_mode) {
   GOOGLE_CHECK(pipe(stdin_pipe) != -1);
   GOOGLE_CHECK(pipe(stdout_pipe) != -1);
 
+  // Our ends of the pipes must not be inherited by subprocesses started while
+  // this one is still running; otherwise this child would not see EOF on its
+  // stdin until those have exited.
+  GOOGLE_CHECK(fcntl(stdin_pipe[1], F_SETFD, FD_CLOEXEC) != -1);
+  GOOGLE_CHECK(fcntl(stdout_pipe[0], F_SETFD, FD_CLOEXEC) != -1);
+
   char* argv[2] = { portable_strdup(program.c_str()), NULL };
 
   child_pid_ = fork();
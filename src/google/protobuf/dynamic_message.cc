@@ -65,14 +65,20 @@
 #include <algorithm>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include <google/protobuf/stubs/casts.h>
 #include <google/protobuf/stubs/hash.h>
 
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_table_driven_lite.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/map_field.h>
@@ -81,6 +87,7 @@
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/wire_format.h>
+#include <google/protobuf/wire_format_lite.h>
 
 
 namespace google {
@@ -91,6 +98,8 @@ using internal::ExtensionSet;
 using internal::GeneratedMessageReflection;
 using internal::InternalMetadataWithArena;
 using internal::MapField;
+using internal::WireFormat;
+using internal::WireFormatLite;
 
 
 using internal::ArenaStringPtr;
@@ -190,6 +199,64 @@ int OneofFieldSpaceUsed(const FieldDescriptor* field) {
   return 0;
 }
 
+// Returns true if messages of the given type might contain required fields,
+// either directly, in a sub-message, or through an extension.
+bool HasRequiredFields(const Descriptor* type,
+                       std::unordered_set<const Descriptor*>* already_seen) {
+  if (!already_seen->insert(type).second) {
+    // Already checked (or being checked further up the stack).
+    return false;
+  }
+  // An extension might be (or contain) a required field.
+  if (type->extension_range_count() > 0) return true;
+
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    if (field->is_required()) return true;
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+        HasRequiredFields(field->message_type(), already_seen)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool HasRequiredFields(const Descriptor* type) {
+  std::unordered_set<const Descriptor*> already_seen;
+  return HasRequiredFields(type, &already_seen);
+}
+
+// Merges a single singular field through reflection.  Only used for oneof
+// members, where switching the active case needs reflection's bookkeeping.
+void MergeFieldWithReflection(const Message& from, Message* to,
+                              const FieldDescriptor* field) {
+  const Reflection* from_reflection = from.GetReflection();
+  const Reflection* to_reflection = to->GetReflection();
+  switch (field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, METHOD)                        \
+    case FieldDescriptor::CPPTYPE_##CPPTYPE:                \
+      to_reflection->Set##METHOD(to, field,                 \
+          from_reflection->Get##METHOD(from, field));       \
+      break;
+
+    HANDLE_TYPE(INT32 , Int32 );
+    HANDLE_TYPE(INT64 , Int64 );
+    HANDLE_TYPE(UINT32, UInt32);
+    HANDLE_TYPE(UINT64, UInt64);
+    HANDLE_TYPE(FLOAT , Float );
+    HANDLE_TYPE(DOUBLE, Double);
+    HANDLE_TYPE(BOOL  , Bool  );
+    HANDLE_TYPE(STRING, String);
+    HANDLE_TYPE(ENUM  , EnumValue);
+#undef HANDLE_TYPE
+
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      to_reflection->MutableMessage(to, field)->MergeFrom(
+          from_reflection->GetMessage(from, field));
+      break;
+  }
+}
+
 inline int DivideRoundingUp(int i, int j) {
   return (i + (j - 1)) / j;
 }
@@ -209,6 +276,208 @@ inline int AlignOffset(int offset) {
 
 #define bitsizeof(T) (sizeof(T) * 8)
 
+// Returns the largest number of a group field whose type is |type|, or 0 if
+// |type| is not used as a group.  The group's end tag carries that number, so
+// the parse table must be large enough to recognize it.
+int MaxGroupFieldNumber(const Descriptor* type) {
+  int max_number = 0;
+  // A group's type is always declared in the same scope as the group field.
+  const Descriptor* scope = type->containing_type();
+  std::vector<const FieldDescriptor*> candidates;
+  if (scope != NULL) {
+    for (int i = 0; i < scope->field_count(); i++) {
+      candidates.push_back(scope->field(i));
+    }
+    for (int i = 0; i < scope->extension_count(); i++) {
+      candidates.push_back(scope->extension(i));
+    }
+  } else {
+    for (int i = 0; i < type->file()->extension_count(); i++) {
+      candidates.push_back(type->file()->extension(i));
+    }
+  }
+  for (int i = 0; i < candidates.size(); i++) {
+    const FieldDescriptor* field = candidates[i];
+    if (field->type() == FieldDescriptor::TYPE_GROUP &&
+        field->message_type() == type) {
+      max_number = std::max(max_number, field->number());
+    }
+  }
+  return max_number;
+}
+
+// Returns the encoded size of the singular value of |field| stored at |ptr|,
+// excluding the tag.
+size_t FieldValueByteSize(const FieldDescriptor* field, const void* ptr) {
+  switch (field->type()) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, NAME)                                \
+    case FieldDescriptor::TYPE_##TYPE:                                  \
+      return WireFormatLite::NAME##Size(*static_cast<const CPPTYPE*>(ptr));
+
+    HANDLE_TYPE( INT32,  int32,  Int32)
+    HANDLE_TYPE( INT64,  int64,  Int64)
+    HANDLE_TYPE(SINT32,  int32, SInt32)
+    HANDLE_TYPE(SINT64,  int64, SInt64)
+    HANDLE_TYPE(UINT32, uint32, UInt32)
+    HANDLE_TYPE(UINT64, uint64, UInt64)
+    HANDLE_TYPE(  ENUM,    int,   Enum)
+#undef HANDLE_TYPE
+
+#define HANDLE_TYPE(TYPE, NAME)                                         \
+    case FieldDescriptor::TYPE_##TYPE:                                  \
+      return WireFormatLite::k##NAME##Size;
+
+    HANDLE_TYPE( FIXED32,  Fixed32)
+    HANDLE_TYPE( FIXED64,  Fixed64)
+    HANDLE_TYPE(SFIXED32, SFixed32)
+    HANDLE_TYPE(SFIXED64, SFixed64)
+    HANDLE_TYPE(   FLOAT,    Float)
+    HANDLE_TYPE(  DOUBLE,   Double)
+    HANDLE_TYPE(    BOOL,     Bool)
+#undef HANDLE_TYPE
+
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+      return WireFormatLite::StringSize(
+          static_cast<const ArenaStringPtr*>(ptr)->Get());
+
+    case FieldDescriptor::TYPE_GROUP:
+      return WireFormatLite::GroupSize(
+          **static_cast<const Message* const*>(ptr));
+
+    case FieldDescriptor::TYPE_MESSAGE:
+      return WireFormatLite::MessageSize(
+          **static_cast<const Message* const*>(ptr));
+  }
+
+  GOOGLE_LOG(DFATAL) << "Can't get here.";
+  return 0;
+}
+
+// Returns the total encoded size of the elements of the repeated, non-map
+// |field| stored at |ptr|, excluding tags.  The element count is stored in
+// |*count|.
+size_t RepeatedFieldDataByteSize(const FieldDescriptor* field, const void* ptr,
+                                 int* count) {
+  switch (field->type()) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, NAME)                                \
+    case FieldDescriptor::TYPE_##TYPE: {                                \
+      const RepeatedField<CPPTYPE>& values =                            \
+          *static_cast<const RepeatedField<CPPTYPE>*>(ptr);             \
+      *count = values.size();                                           \
+      return WireFormatLite::NAME##Size(values);                        \
+    }
+
+    HANDLE_TYPE( INT32,  int32,  Int32)
+    HANDLE_TYPE( INT64,  int64,  Int64)
+    HANDLE_TYPE(SINT32,  int32, SInt32)
+    HANDLE_TYPE(SINT64,  int64, SInt64)
+    HANDLE_TYPE(UINT32, uint32, UInt32)
+    HANDLE_TYPE(UINT64, uint64, UInt64)
+    HANDLE_TYPE(  ENUM,    int,   Enum)
+#undef HANDLE_TYPE
+
+#define HANDLE_TYPE(TYPE, CPPTYPE, NAME)                                \
+    case FieldDescriptor::TYPE_##TYPE:                                  \
+      *count = static_cast<const RepeatedField<CPPTYPE>*>(ptr)->size(); \
+      return *count * WireFormatLite::k##NAME##Size;
+
+    HANDLE_TYPE( FIXED32, uint32,  Fixed32)
+    HANDLE_TYPE( FIXED64, uint64,  Fixed64)
+    HANDLE_TYPE(SFIXED32,  int32, SFixed32)
+    HANDLE_TYPE(SFIXED64,  int64, SFixed64)
+    HANDLE_TYPE(   FLOAT,  float,    Float)
+    HANDLE_TYPE(  DOUBLE, double,   Double)
+    HANDLE_TYPE(    BOOL,   bool,     Bool)
+#undef HANDLE_TYPE
+
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES: {
+      const RepeatedPtrField<std::string>& values =
+          *static_cast<const RepeatedPtrField<std::string>*>(ptr);
+      size_t data_size = 0;
+      for (int i = 0; i < values.size(); i++) {
+        data_size += WireFormatLite::StringSize(values.Get(i));
+      }
+      *count = values.size();
+      return data_size;
+    }
+
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE: {
+      const RepeatedPtrField<Message>& values =
+          *static_cast<const RepeatedPtrField<Message>*>(ptr);
+      size_t data_size = 0;
+      for (int i = 0; i < values.size(); i++) {
+        data_size += field->type() == FieldDescriptor::TYPE_GROUP
+                         ? WireFormatLite::GroupSize(values.Get(i))
+                         : WireFormatLite::MessageSize(values.Get(i));
+      }
+      *count = values.size();
+      return data_size;
+    }
+  }
+
+  GOOGLE_LOG(DFATAL) << "Can't get here.";
+  *count = 0;
+  return 0;
+}
+
+// A SpecialSerializer which writes the field with index |has_offset| of the
+// message at |base| through reflection.  Used for map fields, which the
+// table-driven serializer can only handle with a generated MapField type.
+void ReflectionFieldSerializer(const uint8* base, uint32 offset, uint32 tag,
+                               uint32 has_offset,
+                               io::CodedOutputStream* output) {
+  const Message* message = reinterpret_cast<const Message*>(base);
+  WireFormat::SerializeFieldWithCachedSizes(
+      message->GetDescriptor()->field(has_offset), *message, output);
+}
+
+// Handles everything the table-driven parser does not parse itself: unknown
+// fields, extensions, and fields which are left out of the parse table.  All
+// of these go through WireFormat, as WireFormat::ParseAndMergePartial() does.
+struct DynamicUnknownFieldHandler {
+  static bool IsLite() { return false; }
+
+  // ParseExtension() consumes every field it is handed, so this is only
+  // reached if it failed or |tag| is an unexpected end-group tag.
+  static bool Skip(MessageLite* msg, const internal::ParseTable& table,
+                   io::CodedInputStream* input, int tag) {
+    return false;
+  }
+
+  static void Varint(MessageLite* msg, const internal::ParseTable& table,
+                     int tag, int value) {
+    internal::Raw<InternalMetadataWithArena>(msg, table.arena_offset)
+        ->mutable_unknown_fields()
+        ->AddVarint(WireFormatLite::GetTagFieldNumber(tag), value);
+  }
+
+  static bool ParseExtension(MessageLite* msg,
+                             const internal::ParseTable& table,
+                             io::CodedInputStream* input, int tag) {
+    if (WireFormatLite::GetTagWireType(tag) ==
+        WireFormatLite::WIRETYPE_END_GROUP) {
+      return false;
+    }
+    Message* message = down_cast<Message*>(msg);
+    const Descriptor* descriptor = message->GetDescriptor();
+    int field_number = WireFormatLite::GetTagFieldNumber(tag);
+    const FieldDescriptor* field = descriptor->FindFieldByNumber(field_number);
+    if (field == NULL && descriptor->IsExtensionNumber(field_number)) {
+      if (input->GetExtensionPool() == NULL) {
+        field = message->GetReflection()->FindKnownExtensionByNumber(
+            field_number);
+      } else {
+        field = input->GetExtensionPool()->FindExtensionByNumber(descriptor,
+                                                                 field_number);
+      }
+    }
+    return WireFormat::ParseAndMergeField(tag, field, message, input);
+  }
+};
+
 }  // namespace
 
 // ===================================================================
@@ -239,7 +508,53 @@ class DynamicMessage : public Message {
     const DynamicMessage* prototype;
     int weak_field_map_offset;  // The offset for the weak_field_map;
 
-    TypeInfo() : prototype(NULL) {}
+    // Operation tables built by DynamicMessageFactory, so that Clear(),
+    // MergeFrom() and IsInitialized() can work on the memory layout directly
+    // instead of making a virtual reflection call per field.
+    struct FieldOp {
+      const FieldDescriptor* field;
+      uint32 offset;
+      int has_bit;  // -1 if the type has no has-bits.
+    };
+    struct PodRange {
+      uint32 offset;
+      uint32 size;
+    };
+    // Byte ranges covering runs of adjacent singular, non-oneof numeric
+    // fields.  Clear() copies each of them from the prototype with a memcpy.
+    std::vector<PodRange> pod_ranges;
+    // All non-oneof fields, in declaration order.
+    std::vector<FieldOp> field_ops;
+    // Has-bit indices of the required fields.
+    std::vector<int> required_has_bits;
+    // Message fields, including oneof members, whose type might contain
+    // required fields.  For oneof members |offset| is that of the oneof.
+    std::vector<FieldOp> fields_to_check_initialized;
+    // True if some map has message values which might be uninitialized.  We
+    // leave those to ReflectionOps so that the map isn't synced to its
+    // repeated field representation.
+    bool check_initialized_by_reflection;
+
+    // Tables for the table-driven parser and serializer, built the same way
+    // protoc builds them for generated code.  |parse_table.fields| and
+    // |serialization_table.field_table| are NULL for types which must go
+    // through WireFormat instead.
+    //
+    // The parser requires has-bits, so every type reserves them.  For proto3
+    // types they are written by the parser but never read.
+    int parse_has_bits_offset;
+    std::vector<internal::ParseTableField> parse_table_fields;
+    std::vector<internal::AuxillaryParseTableField> parse_table_aux;
+    internal::ParseTable parse_table;
+    std::vector<internal::FieldMetadata> serialization_table_fields;
+    internal::SerializationTable serialization_table;
+
+    TypeInfo()
+        : prototype(NULL),
+          check_initialized_by_reflection(false),
+          parse_has_bits_offset(-1),
+          parse_table(),
+          serialization_table() {}
 
     ~TypeInfo() {
       delete prototype;
@@ -267,6 +582,28 @@ class DynamicMessage : public Message {
 
   Metadata GetMetadata() const override;
 
+  // These use the operation tables in TypeInfo when |from| is a
+  // DynamicMessage of the same type, and ReflectionOps otherwise.
+  void Clear() override;
+  bool IsInitialized() const override;
+  void CopyFrom(const Message& from) override;
+  void MergeFrom(const Message& from) override;
+
+  // These use the table-driven parser and serializer when the type has
+  // tables, and WireFormat otherwise.
+#if !GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  bool MergePartialFromCodedStream(io::CodedInputStream* input) override;
+#endif
+  size_t ByteSizeLong() const override;
+
+  // Builds the operation tables of |type_info|.  Called by
+  // GetPrototypeNoLock() once the prototype has been constructed.
+  static void InitOpTables(TypeInfo* type_info);
+
+  // Builds the parse and serialization tables of |type_info|.  Called after
+  // InitOpTables().
+  static void InitTableDrivenTables(TypeInfo* type_info);
+
   // We actually allocate more memory than sizeof(*this) when this
   // class's memory is allocated via the global operator new. Thus, we need to
   // manually call the global operator delete. Calling the destructor is taken
@@ -297,6 +634,32 @@ class DynamicMessage : public Message {
     return reinterpret_cast<const uint8*>(this) + offset;
   }
 
+  inline uint32* MutableHasBits() {
+    return reinterpret_cast<uint32*>(
+        OffsetToPointer(type_info_->has_bits_offset));
+  }
+  inline bool HasBit(int index) const {
+    const uint32* has_bits = reinterpret_cast<const uint32*>(
+        OffsetToPointer(type_info_->has_bits_offset));
+    return (has_bits[index / 32] & (static_cast<uint32>(1) << (index % 32))) !=
+           0;
+  }
+  inline void SetBit(int index) {
+    MutableHasBits()[index / 32] |= (static_cast<uint32>(1) << (index % 32));
+  }
+  inline uint32 OneofCase(int oneof_index) const {
+    return *reinterpret_cast<const uint32*>(OffsetToPointer(
+        type_info_->oneof_case_offset + sizeof(uint32) * oneof_index));
+  }
+
+  // Returns true if the singular field described by |op| is set.  For types
+  // without has-bits (proto3) this means it differs from the zero default.
+  bool IsPresent(const TypeInfo::FieldOp& op) const;
+
+  // Returns the serialization table, which Message::SerializeWithCachedSizes()
+  // and friends use when it is not NULL.
+  const void* InternalGetTable() const override;
+
   const TypeInfo* type_info_;
   Arena* const arena_;
   mutable std::atomic<int> cached_byte_size_;
@@ -603,6 +966,649 @@ Metadata DynamicMessage::GetMetadata() const {
   return metadata;
 }
 
+bool DynamicMessage::IsPresent(const TypeInfo::FieldOp& op) const {
+  if (op.has_bit != -1) return HasBit(op.has_bit);
+
+  const void* field_ptr = OffsetToPointer(op.offset);
+  switch (op.field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)                          \
+    case FieldDescriptor::CPPTYPE_##CPPTYPE:                \
+      return *reinterpret_cast<const TYPE*>(field_ptr) != 0;
+
+    HANDLE_TYPE(INT32 , int32 );
+    HANDLE_TYPE(INT64 , int64 );
+    HANDLE_TYPE(UINT32, uint32);
+    HANDLE_TYPE(UINT64, uint64);
+    HANDLE_TYPE(DOUBLE, double);
+    HANDLE_TYPE(FLOAT , float );
+    HANDLE_TYPE(BOOL  , bool  );
+    HANDLE_TYPE(ENUM  , int   );
+#undef HANDLE_TYPE
+
+    case FieldDescriptor::CPPTYPE_STRING:
+      return !reinterpret_cast<const ArenaStringPtr*>(field_ptr)->Get().empty();
+
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return *reinterpret_cast<Message* const*>(field_ptr) != NULL;
+  }
+  return false;
+}
+
+void DynamicMessage::Clear() {
+  const TypeInfo* type_info = type_info_;
+
+  // Numeric fields are reset to their defaults by copying them from the
+  // prototype, whatever their has-bits say.
+  for (int i = 0; i < type_info->pod_ranges.size(); i++) {
+    const TypeInfo::PodRange& range = type_info->pod_ranges[i];
+    memcpy(OffsetToPointer(range.offset),
+           type_info->prototype->OffsetToPointer(range.offset), range.size);
+  }
+
+  for (int i = 0; i < type_info->field_ops.size(); i++) {
+    const TypeInfo::FieldOp& op = type_info->field_ops[i];
+    void* field_ptr = OffsetToPointer(op.offset);
+
+    if (op.field->is_repeated()) {
+      switch (op.field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)                                 \
+        case FieldDescriptor::CPPTYPE_##CPPTYPE:                   \
+          reinterpret_cast<RepeatedField<TYPE>*>(field_ptr)->Clear(); \
+          break;
+
+        HANDLE_TYPE(INT32 , int32 );
+        HANDLE_TYPE(INT64 , int64 );
+        HANDLE_TYPE(UINT32, uint32);
+        HANDLE_TYPE(UINT64, uint64);
+        HANDLE_TYPE(DOUBLE, double);
+        HANDLE_TYPE(FLOAT , float );
+        HANDLE_TYPE(BOOL  , bool  );
+        HANDLE_TYPE(ENUM  , int   );
+#undef HANDLE_TYPE
+
+        case FieldDescriptor::CPPTYPE_STRING:
+          reinterpret_cast<RepeatedPtrField<std::string>*>(field_ptr)->Clear();
+          break;
+
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+          if (IsMapFieldInApi(op.field)) {
+            reinterpret_cast<DynamicMapField*>(field_ptr)->Clear();
+          } else {
+            reinterpret_cast<RepeatedPtrField<Message>*>(field_ptr)->Clear();
+          }
+          break;
+      }
+    } else if (op.field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+      const std::string* default_value =
+          &reinterpret_cast<const ArenaStringPtr*>(
+               type_info->prototype->OffsetToPointer(op.offset))
+               ->Get();
+      reinterpret_cast<ArenaStringPtr*>(field_ptr)->ClearToDefault(
+          default_value, arena_);
+    } else if (op.field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+      Message** message = reinterpret_cast<Message**>(field_ptr);
+      if (op.has_bit != -1) {
+        if (HasBit(op.has_bit)) (*message)->Clear();
+      } else if (*message != NULL) {
+        // Proto3 does not have has-bits, so a NULL pointer is what marks the
+        // field as unset.
+        if (arena_ == NULL) delete *message;
+        *message = NULL;
+      }
+    }
+  }
+
+  const Descriptor* descriptor = type_info->type;
+  for (int i = 0; i < descriptor->oneof_decl_count(); i++) {
+    if (OneofCase(i) != 0) {
+      type_info->reflection->ClearOneof(this, descriptor->oneof_decl(i));
+    }
+  }
+
+  if (type_info->has_bits_offset != -1) {
+    memset(MutableHasBits(), 0,
+           DivideRoundingUp(descriptor->field_count(), bitsizeof(uint32)) *
+               sizeof(uint32));
+  }
+  if (type_info->extensions_offset != -1) {
+    reinterpret_cast<ExtensionSet*>(
+        OffsetToPointer(type_info->extensions_offset))->Clear();
+  }
+  reinterpret_cast<InternalMetadataWithArena*>(
+      OffsetToPointer(type_info->internal_metadata_offset))->Clear();
+}
+
+bool DynamicMessage::IsInitialized() const {
+  const TypeInfo* type_info = type_info_;
+  // The prototype's proto3 message fields point at other prototypes, which
+  // must not be mistaken for set fields.
+  if (type_info->check_initialized_by_reflection || is_prototype()) {
+    return Message::IsInitialized();
+  }
+
+  for (int i = 0; i < type_info->required_has_bits.size(); i++) {
+    if (!HasBit(type_info->required_has_bits[i])) return false;
+  }
+
+  for (int i = 0; i < type_info->fields_to_check_initialized.size(); i++) {
+    const TypeInfo::FieldOp& op = type_info->fields_to_check_initialized[i];
+    const void* field_ptr = OffsetToPointer(op.offset);
+    if (op.field->is_repeated()) {
+      const RepeatedPtrField<Message>& messages =
+          *reinterpret_cast<const RepeatedPtrField<Message>*>(field_ptr);
+      for (int j = 0; j < messages.size(); j++) {
+        if (!messages.Get(j).IsInitialized()) return false;
+      }
+    } else if (op.field->containing_oneof() != NULL) {
+      if (OneofCase(op.field->containing_oneof()->index()) ==
+              op.field->number() &&
+          !(*reinterpret_cast<Message* const*>(field_ptr))->IsInitialized()) {
+        return false;
+      }
+    } else if (IsPresent(op) &&
+               !(*reinterpret_cast<Message* const*>(field_ptr))
+                    ->IsInitialized()) {
+      return false;
+    }
+  }
+
+  if (type_info->extensions_offset != -1 &&
+      !reinterpret_cast<const ExtensionSet*>(
+           OffsetToPointer(type_info->extensions_offset))->IsInitialized()) {
+    return false;
+  }
+  return true;
+}
+
+void DynamicMessage::CopyFrom(const Message& from) {
+  if (from.GetReflection() != type_info_->reflection.get()) {
+    Message::CopyFrom(from);
+    return;
+  }
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DynamicMessage::MergeFrom(const Message& from) {
+  if (from.GetReflection() != type_info_->reflection.get()) {
+    // A different type, or the same type built by another factory.
+    Message::MergeFrom(from);
+    return;
+  }
+  GOOGLE_CHECK_NE(&from, this);
+  // The prototype has nothing set, but its proto3 message fields point at
+  // other prototypes rather than being NULL.
+  if (&from == type_info_->prototype) return;
+
+  const DynamicMessage& from_message = static_cast<const DynamicMessage&>(from);
+  const TypeInfo* type_info = type_info_;
+
+  for (int i = 0; i < type_info->field_ops.size(); i++) {
+    const TypeInfo::FieldOp& op = type_info->field_ops[i];
+    const void* from_ptr = from_message.OffsetToPointer(op.offset);
+    void* to_ptr = OffsetToPointer(op.offset);
+
+    if (op.field->is_repeated()) {
+      switch (op.field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)                                    \
+        case FieldDescriptor::CPPTYPE_##CPPTYPE:                      \
+          reinterpret_cast<RepeatedField<TYPE>*>(to_ptr)->MergeFrom(  \
+              *reinterpret_cast<const RepeatedField<TYPE>*>(from_ptr)); \
+          break;
+
+        HANDLE_TYPE(INT32 , int32 );
+        HANDLE_TYPE(INT64 , int64 );
+        HANDLE_TYPE(UINT32, uint32);
+        HANDLE_TYPE(UINT64, uint64);
+        HANDLE_TYPE(DOUBLE, double);
+        HANDLE_TYPE(FLOAT , float );
+        HANDLE_TYPE(BOOL  , bool  );
+        HANDLE_TYPE(ENUM  , int   );
+#undef HANDLE_TYPE
+
+        case FieldDescriptor::CPPTYPE_STRING:
+          reinterpret_cast<RepeatedPtrField<std::string>*>(to_ptr)->MergeFrom(
+              *reinterpret_cast<const RepeatedPtrField<std::string>*>(
+                  from_ptr));
+          break;
+
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+          if (IsMapFieldInApi(op.field)) {
+            const DynamicMapField* from_map =
+                reinterpret_cast<const DynamicMapField*>(from_ptr);
+            DynamicMapField* to_map =
+                reinterpret_cast<DynamicMapField*>(to_ptr);
+            if (from_map->IsMapValid() && to_map->IsMapValid()) {
+              to_map->MergeFrom(*from_map);
+            } else {
+              const Reflection* reflection = type_info->reflection.get();
+              int count = reflection->FieldSize(from, op.field);
+              for (int j = 0; j < count; j++) {
+                reflection->AddMessage(this, op.field)->MergeFrom(
+                    reflection->GetRepeatedMessage(from, op.field, j));
+              }
+            }
+          } else {
+            reinterpret_cast<RepeatedPtrField<Message>*>(to_ptr)->MergeFrom(
+                *reinterpret_cast<const RepeatedPtrField<Message>*>(from_ptr));
+          }
+          break;
+      }
+      continue;
+    }
+
+    if (!from_message.IsPresent(op)) continue;
+    switch (op.field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)                                    \
+      case FieldDescriptor::CPPTYPE_##CPPTYPE:                        \
+        *reinterpret_cast<TYPE*>(to_ptr) =                            \
+            *reinterpret_cast<const TYPE*>(from_ptr);                 \
+        break;
+
+      HANDLE_TYPE(INT32 , int32 );
+      HANDLE_TYPE(INT64 , int64 );
+      HANDLE_TYPE(UINT32, uint32);
+      HANDLE_TYPE(UINT64, uint64);
+      HANDLE_TYPE(DOUBLE, double);
+      HANDLE_TYPE(FLOAT , float );
+      HANDLE_TYPE(BOOL  , bool  );
+      HANDLE_TYPE(ENUM  , int   );
+#undef HANDLE_TYPE
+
+      case FieldDescriptor::CPPTYPE_STRING: {
+        const std::string* default_value =
+            &reinterpret_cast<const ArenaStringPtr*>(
+                 type_info->prototype->OffsetToPointer(op.offset))
+                 ->Get();
+        reinterpret_cast<ArenaStringPtr*>(to_ptr)->Set(
+            default_value,
+            reinterpret_cast<const ArenaStringPtr*>(from_ptr)->Get(), arena_);
+        break;
+      }
+
+      case FieldDescriptor::CPPTYPE_MESSAGE: {
+        Message** to_message = reinterpret_cast<Message**>(to_ptr);
+        if (*to_message == NULL) {
+          const Message* default_message =
+              *reinterpret_cast<Message* const*>(
+                  type_info->prototype->OffsetToPointer(op.offset));
+          *to_message = default_message->New(arena_);
+        }
+        (*to_message)->MergeFrom(**reinterpret_cast<Message* const*>(from_ptr));
+        break;
+      }
+    }
+    if (op.has_bit != -1) SetBit(op.has_bit);
+  }
+
+  const Descriptor* descriptor = type_info->type;
+  for (int i = 0; i < descriptor->oneof_decl_count(); i++) {
+    uint32 oneof_case = from_message.OneofCase(i);
+    if (oneof_case != 0) {
+      MergeFieldWithReflection(from, this,
+                               descriptor->FindFieldByNumber(oneof_case));
+    }
+  }
+
+  if (type_info->extensions_offset != -1) {
+    reinterpret_cast<ExtensionSet*>(
+        OffsetToPointer(type_info->extensions_offset))
+        ->MergeFrom(*reinterpret_cast<const ExtensionSet*>(
+            from_message.OffsetToPointer(type_info->extensions_offset)));
+  }
+  reinterpret_cast<InternalMetadataWithArena*>(
+      OffsetToPointer(type_info->internal_metadata_offset))
+      ->MergeFrom(*reinterpret_cast<const InternalMetadataWithArena*>(
+          from_message.OffsetToPointer(type_info->internal_metadata_offset)));
+}
+
+#if !GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool DynamicMessage::MergePartialFromCodedStream(
+    io::CodedInputStream* input) {
+  if (type_info_->parse_table.fields == NULL) {
+    return Message::MergePartialFromCodedStream(input);
+  }
+  return internal::MergePartialFromCodedStreamImpl<DynamicUnknownFieldHandler,
+                                                   InternalMetadataWithArena>(
+      this, type_info_->parse_table, input);
+}
+#endif  // !GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+size_t DynamicMessage::ByteSizeLong() const {
+  if (InternalGetTable() == NULL) {
+    return Message::ByteSizeLong();
+  }
+
+  const TypeInfo* type_info = type_info_;
+  size_t total_size = 0;
+  for (int i = 0; i < type_info->field_ops.size(); i++) {
+    const TypeInfo::FieldOp& op = type_info->field_ops[i];
+    const FieldDescriptor* field = op.field;
+    const void* field_ptr = OffsetToPointer(op.offset);
+
+    if (field->is_map()) {
+      total_size += WireFormat::FieldByteSize(field, *this);
+    } else if (field->is_repeated()) {
+      int count;
+      size_t data_size = RepeatedFieldDataByteSize(field, field_ptr, &count);
+      if (field->is_packed()) {
+        // The serializer reads the data size from the slot which
+        // GetPrototypeNoLock() reserves right after the RepeatedField.
+        int cached_size = internal::ToCachedSize(data_size);
+        *reinterpret_cast<int*>(const_cast<uint8*>(
+            static_cast<const uint8*>(field_ptr) + FieldSpaceUsed(field))) =
+            cached_size;
+        if (data_size > 0) {
+          total_size += WireFormat::TagSize(field->number(), field->type()) +
+                        WireFormatLite::Int32Size(cached_size) + data_size;
+        }
+      } else {
+        total_size +=
+            count * WireFormat::TagSize(field->number(), field->type()) +
+            data_size;
+      }
+    } else if (IsPresent(op)) {
+      total_size += WireFormat::TagSize(field->number(), field->type()) +
+                    FieldValueByteSize(field, field_ptr);
+    }
+  }
+
+  const Descriptor* descriptor = type_info->type;
+  for (int i = 0; i < descriptor->oneof_decl_count(); i++) {
+    uint32 oneof_case = OneofCase(i);
+    if (oneof_case != 0) {
+      const FieldDescriptor* field = descriptor->FindFieldByNumber(oneof_case);
+      const void* field_ptr =
+          OffsetToPointer(type_info->offsets[descriptor->field_count() + i]);
+      total_size += WireFormat::TagSize(field->number(), field->type()) +
+                    FieldValueByteSize(field, field_ptr);
+    }
+  }
+
+  if (type_info->extensions_offset != -1) {
+    total_size += reinterpret_cast<const ExtensionSet*>(
+        OffsetToPointer(type_info->extensions_offset))->ByteSize();
+  }
+  const InternalMetadataWithArena* metadata =
+      reinterpret_cast<const InternalMetadataWithArena*>(
+          OffsetToPointer(type_info->internal_metadata_offset));
+  if (metadata->have_unknown_fields()) {
+    total_size += WireFormat::ComputeUnknownFieldsSize(
+        metadata->unknown_fields());
+  }
+
+  SetCachedSize(internal::ToCachedSize(total_size));
+  return total_size;
+}
+
+const void* DynamicMessage::InternalGetTable() const {
+  // The prototype's proto3 message fields point at other prototypes instead
+  // of being NULL, which the serializer would take for set fields.
+  if (type_info_->serialization_table.field_table == NULL || is_prototype()) {
+    return NULL;
+  }
+  return &type_info_->serialization_table;
+}
+
+void DynamicMessage::InitOpTables(TypeInfo* type_info) {
+  const Descriptor* type = type_info->type;
+  bool has_hasbits = type_info->has_bits_offset != -1;
+
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    TypeInfo::FieldOp op;
+    op.field = field;
+    op.has_bit = has_hasbits ? type_info->has_bits_indices[i] : -1;
+
+    if (field->containing_oneof()) {
+      if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+          HasRequiredFields(field->message_type())) {
+        op.offset = type_info->offsets[type->field_count() +
+                                       field->containing_oneof()->index()];
+        type_info->fields_to_check_initialized.push_back(op);
+      }
+      continue;
+    }
+
+    op.offset = type_info->offsets[i];
+    type_info->field_ops.push_back(op);
+
+    if (field->is_required()) {
+      type_info->required_has_bits.push_back(op.has_bit);
+    }
+
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+      if (field->is_map()) {
+        const FieldDescriptor* value_field = field->message_type()->field(1);
+        if (value_field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+            HasRequiredFields(value_field->message_type())) {
+          type_info->check_initialized_by_reflection = true;
+        }
+      } else if (HasRequiredFields(field->message_type())) {
+        type_info->fields_to_check_initialized.push_back(op);
+      }
+    } else if (!field->is_repeated() &&
+               field->cpp_type() != FieldDescriptor::CPPTYPE_STRING) {
+      // Singular numeric field: extend the current range if this field
+      // directly follows the previous one (up to alignment padding, which
+      // is zero in the prototype as well).
+      uint32 size = FieldSpaceUsed(field);
+      std::vector<TypeInfo::PodRange>& ranges = type_info->pod_ranges;
+      if (!ranges.empty() && i > 0 && !type->field(i - 1)->containing_oneof() &&
+          ranges.back().offset + ranges.back().size ==
+              type_info->offsets[i - 1] + FieldSpaceUsed(type->field(i - 1))) {
+        ranges.back().size = op.offset + size - ranges.back().offset;
+      } else {
+        TypeInfo::PodRange range = {op.offset, size};
+        ranges.push_back(range);
+      }
+    }
+  }
+}
+
+void DynamicMessage::InitTableDrivenTables(TypeInfo* type_info) {
+  const Descriptor* type = type_info->type;
+  // MessageSet items and map entries have their own wire format handling.
+  if (type->options().message_set_wire_format() ||
+      type->options().map_entry()) {
+    return;
+  }
+
+  std::vector<std::pair<int, int> > fields_by_number;  // (number, index)
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    // When it switches a oneof to another field, the parser frees the old
+    // string assuming that its default is the empty string.
+    if (field->containing_oneof() != NULL &&
+        field->cpp_type() == FieldDescriptor::CPPTYPE_STRING &&
+        !field->default_value_string().empty()) {
+      return;
+    }
+    fields_by_number.push_back(std::make_pair(field->number(), i));
+  }
+  std::sort(fields_by_number.begin(), fields_by_number.end());
+
+  const DynamicMessage* prototype = type_info->prototype;
+  const uint8* base = reinterpret_cast<const uint8*>(prototype);
+  const bool is_proto3 =
+      type->file()->syntax() == FileDescriptor::SYNTAX_PROTO3;
+  const int oneof_case_offset =
+      type->oneof_decl_count() > 0 ? type_info->oneof_case_offset : -1;
+
+  // The parse table has an entry for every field number up to the largest
+  // one, so as in protoc we only build it if the numbers are dense enough.
+  int max_field_number = MaxGroupFieldNumber(type);
+  if (!fields_by_number.empty()) {
+    max_field_number =
+        std::max(max_field_number, fields_by_number.back().first);
+  }
+  if (max_field_number < (2 << 14) &&
+      max_field_number <= 2 * type->field_count()) {
+    // Field numbers without a field keep invalid wire types, so that they
+    // are never matched.  Field "0" is special: its processing type ends the
+    // parse on a zero tag.
+    const internal::ParseTableField kNoField = {
+        0, 0, internal::kInvalidMask, internal::kInvalidMask, 0, 0};
+    std::vector<internal::ParseTableField>& entries =
+        type_info->parse_table_fields;
+    std::vector<internal::AuxillaryParseTableField>& aux =
+        type_info->parse_table_aux;
+    entries.assign(max_field_number + 1, kNoField);
+    entries[0].normal_wiretype = 0;
+    aux.assign(max_field_number + 1, internal::AuxillaryParseTableField());
+
+    for (int i = 0; i < type->field_count(); i++) {
+      const FieldDescriptor* field = type->field(i);
+      internal::ParseTableField& entry = entries[field->number()];
+      internal::AuxillaryParseTableField& field_aux = aux[field->number()];
+
+      // The processing type is set even for the fields parsed through
+      // WireFormat, since the parser uses it to clear oneof members.
+      entry.processing_type = static_cast<unsigned char>(field->type());
+      if (field->is_repeated()) {
+        entry.processing_type |= internal::kRepeatedMask;
+      }
+      if (field->containing_oneof() != NULL) {
+        entry.processing_type |= internal::kOneofMask;
+        entry.offset = type_info->offsets[type->field_count() +
+                                          field->containing_oneof()->index()];
+        entry.presence_index = field->containing_oneof()->index();
+      } else {
+        entry.offset = type_info->offsets[i];
+        entry.presence_index = i;
+      }
+      entry.tag_size = WireFormat::TagSize(field->number(), field->type());
+
+      // These fields are left to WireFormat: maps, enums with closed value
+      // sets (unknown values go to the UnknownFieldSet, and an enum
+      // validator can't be told which type to check), proto3 strings (which
+      // must fail the parse on bad UTF-8), and groups in oneofs.
+      if (field->is_map() ||
+          (field->type() == FieldDescriptor::TYPE_ENUM && !is_proto3) ||
+          (field->type() == FieldDescriptor::TYPE_STRING && is_proto3)) {
+        continue;
+      }
+      if (field->type() == FieldDescriptor::TYPE_GROUP &&
+          field->containing_oneof() != NULL) {
+        // Clearing a message and a group is the same thing.
+        entry.processing_type =
+            WireFormatLite::TYPE_MESSAGE | internal::kOneofMask;
+        continue;
+      }
+
+      entry.normal_wiretype = WireFormat::WireTypeForFieldType(field->type());
+      if (field->is_packable()) {
+        entry.packed_wiretype = WireFormatLite::WIRETYPE_LENGTH_DELIMITED;
+      } else {
+        entry.packed_wiretype = internal::kNotPackedMask;
+      }
+
+      if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING &&
+          !field->is_repeated()) {
+        field_aux.strings.default_ptr =
+            &reinterpret_cast<const ArenaStringPtr*>(
+                 base + type_info->offsets[i])->Get();
+        field_aux.strings.field_name = field->full_name().c_str();
+      } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        const MessageLite* default_message =
+            type_info->factory->GetPrototypeNoLock(field->message_type());
+        field_aux.messages.default_message_void = default_message;
+      }
+    }
+
+    internal::ParseTable& table = type_info->parse_table;
+    table.fields = &entries[0];
+    table.aux = &aux[0];
+    table.max_field_number = max_field_number;
+    table.has_bits_offset = type_info->parse_has_bits_offset;
+    table.oneof_case_offset = oneof_case_offset;
+    table.extension_offset = type_info->extensions_offset;
+    table.arena_offset = type_info->internal_metadata_offset;
+    table.default_instance_void = static_cast<const MessageLite*>(prototype);
+    table.unknown_field_set = true;
+  }
+
+  // The serialization table lists the fields and extension ranges in order
+  // of field number.  Its first entry locates the cached size and its last
+  // one writes the unknown fields.
+  std::vector<std::pair<int, int> > extension_ranges;  // (start, end)
+  for (int i = 0; i < type->extension_range_count(); i++) {
+    extension_ranges.push_back(std::make_pair(
+        type->extension_range(i)->start, type->extension_range(i)->end));
+  }
+  std::sort(extension_ranges.begin(), extension_ranges.end());
+
+  typedef internal::FieldMetadata FieldMetadata;
+  std::vector<FieldMetadata>& metadata = type_info->serialization_table_fields;
+  const FieldMetadata cached_size = {
+      static_cast<uint32>(
+          reinterpret_cast<const uint8*>(&prototype->cached_byte_size_) - base),
+      0, 0, 0, NULL};
+  metadata.push_back(cached_size);
+  for (int i = 0, range = 0; /* no range */; i++) {
+    for (; range < extension_ranges.size() &&
+           (i == fields_by_number.size() ||
+            extension_ranges[range].first < fields_by_number[i].first);
+         range++) {
+      const FieldMetadata extensions = {
+          static_cast<uint32>(type_info->extensions_offset),
+          static_cast<uint32>(extension_ranges[range].first),
+          static_cast<uint32>(extension_ranges[range].second),
+          FieldMetadata::kSpecial,
+          reinterpret_cast<const void*>(internal::ExtensionSerializer)};
+      metadata.push_back(extensions);
+    }
+    if (i == fields_by_number.size()) break;
+
+    const FieldDescriptor* field = type->field(fields_by_number[i].second);
+    int index = field->index();
+    uint32 tag = WireFormatLite::MakeTag(
+        field->number(), field->is_packed()
+                             ? WireFormatLite::WIRETYPE_LENGTH_DELIMITED
+                             : WireFormat::WireTypeForFieldType(field->type()));
+
+    // Message fields leave |ptr| NULL, which makes the serializer call the
+    // sub-message's virtual methods, and so its own table if it has one.
+    FieldMetadata entry = {type_info->offsets[index], tag, 0, 0, NULL};
+    if (field->is_map()) {
+      entry.has_offset = index;
+      entry.type = FieldMetadata::kSpecial;
+      entry.ptr = reinterpret_cast<const void*>(ReflectionFieldSerializer);
+    } else if (field->containing_oneof() != NULL) {
+      int oneof_index = field->containing_oneof()->index();
+      entry.offset = type_info->offsets[type->field_count() + oneof_index];
+      entry.has_offset = oneof_case_offset + sizeof(uint32) * oneof_index;
+      entry.type =
+          FieldMetadata::CalculateType(field->type(), FieldMetadata::kOneOf);
+    } else if (field->is_packed()) {
+      entry.type =
+          FieldMetadata::CalculateType(field->type(), FieldMetadata::kPacked);
+    } else if (field->is_repeated()) {
+      entry.type =
+          FieldMetadata::CalculateType(field->type(), FieldMetadata::kRepeated);
+    } else if (is_proto3) {
+      entry.has_offset = ~0u;
+      entry.type = FieldMetadata::CalculateType(field->type(),
+                                                FieldMetadata::kNoPresence);
+    } else {
+      entry.has_offset = type_info->has_bits_offset * 8 +
+                         type_info->has_bits_indices[index];
+      entry.type =
+          FieldMetadata::CalculateType(field->type(), FieldMetadata::kPresence);
+    }
+    metadata.push_back(entry);
+  }
+  const FieldMetadata unknown_fields = {
+      static_cast<uint32>(type_info->internal_metadata_offset), 0, ~0u,
+      FieldMetadata::kSpecial,
+      reinterpret_cast<const void*>(internal::UnknownFieldSetSerializer)};
+  metadata.push_back(unknown_fields);
+
+  type_info->serialization_table.num_fields = metadata.size();
+  type_info->serialization_table.field_table = &metadata[0];
+}
+
 // ===================================================================
 
 struct DynamicMessageFactory::PrototypeMap {
@@ -675,15 +1681,18 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
   int size = sizeof(DynamicMessage);
   size = AlignOffset(size);
 
-  // Next the has_bits, which is an array of uint32s.
+  // Next the has_bits, which is an array of uint32s.  Proto3 types have no
+  // has_bits, but the table-driven parser still needs somewhere to set them.
+  type_info->parse_has_bits_offset = size;
+  int has_bits_array_size =
+    DivideRoundingUp(type->field_count(), bitsizeof(uint32));
+  size += has_bits_array_size * sizeof(uint32);
+  size = AlignOffset(size);
+
   if (type->file()->syntax() == FileDescriptor::SYNTAX_PROTO3) {
     type_info->has_bits_offset = -1;
   } else {
-    type_info->has_bits_offset = size;
-    int has_bits_array_size =
-      DivideRoundingUp(type->field_count(), bitsizeof(uint32));
-    size += has_bits_array_size * sizeof(uint32);
-    size = AlignOffset(size);
+    type_info->has_bits_offset = type_info->parse_has_bits_offset;
 
     uint32* has_bits_indices = new uint32[type->field_count()];
     for (int i = 0; i < type->field_count(); i++) {
@@ -721,6 +1730,11 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
       size = AlignTo(size, std::min(kSafeAlignment, field_size));
       offsets[i] = size;
       size += field_size;
+      // Packed fields are followed by the cached size of their data, which
+      // the table-driven serializer reads.
+      if (type->field(i)->is_packed()) {
+        size += sizeof(int);
+      }
     }
   }
 
@@ -799,6 +1813,9 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
   // Cross link prototypes.
   prototype->CrossLinkPrototypes();
 
+  DynamicMessage::InitOpTables(type_info);
+  DynamicMessage::InitTableDrivenTables(type_info);
+
   return prototype;
 }
 
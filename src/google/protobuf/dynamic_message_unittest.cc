@@ -48,6 +48,10 @@
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/text_format.h>
 
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
@@ -267,6 +271,250 @@ TEST_P(DynamicMessageTest, SpaceUsed) {
   }
 }
 
+TEST_P(DynamicMessageTest, MergeCopyClear) {
+  // DynamicMessage merges and clears through its own operation tables; check
+  // that the results match those of ReflectionOps.
+  Arena arena;
+  Arena* arena_ptr = GetParam() ? &arena : NULL;
+  const Message* prototypes[] = {prototype_, extensions_prototype_,
+                                 packed_prototype_, oneof_prototype_};
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(prototypes); i++) {
+    std::unique_ptr<Message> from(prototypes[i]->New());
+    TestUtil::ReflectionTester reflection_tester(from->GetDescriptor());
+    if (prototypes[i] == packed_prototype_) {
+      reflection_tester.SetPackedFieldsViaReflection(from.get());
+    } else if (prototypes[i] == oneof_prototype_) {
+      TestUtil::ReflectionTester::SetOneofViaReflection(from.get());
+    } else {
+      reflection_tester.SetAllFieldsViaReflection(from.get());
+    }
+    from->GetReflection()->MutableUnknownFields(from.get())->AddVarint(
+        12345, 1);
+
+    Message* message = prototypes[i]->New(arena_ptr);
+    std::unique_ptr<Message> expected(prototypes[i]->New());
+    message->MergeFrom(*prototypes[i]);
+    message->MergeFrom(*from);
+    message->MergeFrom(*from);
+    internal::ReflectionOps::Merge(*from, expected.get());
+    internal::ReflectionOps::Merge(*from, expected.get());
+    EXPECT_EQ(expected->SerializeAsString(), message->SerializeAsString());
+
+    message->CopyFrom(*from);
+    EXPECT_EQ(from->SerializeAsString(), message->SerializeAsString());
+
+    message->Clear();
+    EXPECT_EQ(0, message->ByteSize());
+    std::vector<const FieldDescriptor*> fields;
+    message->GetReflection()->ListFields(*message, &fields);
+    EXPECT_TRUE(fields.empty());
+    if (prototypes[i] == prototype_) {
+      reflection_tester.ExpectClearViaReflection(*message);
+    }
+
+    if (!GetParam()) {
+      delete message;
+    }
+  }
+}
+
+TEST_P(DynamicMessageTest, Proto3MergeClear) {
+  Arena arena;
+  Message* message = proto3_prototype_->New(GetParam() ? &arena : NULL);
+  std::unique_ptr<Message> from(proto3_prototype_->New());
+  const Reflection* refl = message->GetReflection();
+  const Descriptor* desc = message->GetDescriptor();
+  const FieldDescriptor* optional_int32 =
+      desc->FindFieldByName("optional_int32");
+  const FieldDescriptor* optional_string =
+      desc->FindFieldByName("optional_string");
+  const FieldDescriptor* optional_msg =
+      desc->FindFieldByName("optional_nested_message");
+
+  // Merging the prototype must not pick up its links to other prototypes.
+  message->MergeFrom(*proto3_prototype_);
+  EXPECT_FALSE(refl->HasField(*message, optional_msg));
+
+  refl->SetInt32(message, optional_int32, 7);
+  refl->SetInt32(from.get(), optional_int32, 0);
+  refl->SetString(from.get(), optional_string, "abc");
+  refl->MutableMessage(from.get(), optional_msg);
+  message->MergeFrom(*from);
+  // Zero is indistinguishable from unset, so it doesn't overwrite.
+  EXPECT_EQ(7, refl->GetInt32(*message, optional_int32));
+  EXPECT_EQ("abc", refl->GetString(*message, optional_string));
+  EXPECT_TRUE(refl->HasField(*message, optional_msg));
+
+  message->Clear();
+  EXPECT_FALSE(refl->HasField(*message, optional_int32));
+  EXPECT_FALSE(refl->HasField(*message, optional_string));
+  EXPECT_FALSE(refl->HasField(*message, optional_msg));
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
+TEST_P(DynamicMessageTest, ParseAndSerialize) {
+  // DynamicMessage parses and serializes with tables built from its
+  // descriptor; check that it agrees with the generated code.
+  unittest::TestAllTypes all_types;
+  TestUtil::SetAllFields(&all_types);
+  unittest::TestAllExtensions all_extensions;
+  TestUtil::SetAllExtensions(&all_extensions);
+  unittest::TestPackedTypes packed;
+  TestUtil::SetPackedFields(&packed);
+  unittest::TestOneof2 oneof;
+  TestUtil::SetOneof1(&oneof);
+  unittest::TestHugeFieldNumbers huge_field_numbers;
+  huge_field_numbers.set_optional_int32(1);
+  huge_field_numbers.add_packed_int32(2);
+  (*huge_field_numbers.mutable_string_string_map())["a"] = "b";
+  huge_field_numbers.set_oneof_string("c");
+  proto2_nofieldpresence_unittest::TestAllTypes proto3;
+  proto3.set_optional_int32(1);
+  proto3.set_optional_string("abc");
+  proto3.mutable_optional_nested_message()->set_bb(2);
+  proto3.add_repeated_int32(3);
+  proto3.add_repeated_int32(-4);
+  proto3.add_repeated_string("def");
+  proto3.set_optional_nested_enum(
+      proto2_nofieldpresence_unittest::TestAllTypes::BAZ);
+  TestUtil::SetAllFields(proto3.mutable_optional_proto2_message());
+
+  const Message* generated[] = {&all_types, &all_extensions, &packed,
+                                &oneof, &huge_field_numbers, &proto3};
+  const char* type_names[] = {
+      "protobuf_unittest.TestAllTypes", "protobuf_unittest.TestAllExtensions",
+      "protobuf_unittest.TestPackedTypes", "protobuf_unittest.TestOneof2",
+      "protobuf_unittest.TestHugeFieldNumbers",
+      "proto2_nofieldpresence_unittest.TestAllTypes"};
+
+  Arena arena;
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(generated); i++) {
+    SCOPED_TRACE(type_names[i]);
+    const Descriptor* descriptor = pool_.FindMessageTypeByName(type_names[i]);
+    ASSERT_TRUE(descriptor != NULL);
+
+    // Unknown fields are kept, after the known ones.
+    std::string data = generated[i]->SerializeAsString();
+    data += "\xc8\x83\x06\x01";  // 12345: 1
+
+    Message* message =
+        factory_.GetPrototype(descriptor)->New(GetParam() ? &arena : NULL);
+    ASSERT_TRUE(message->ParseFromString(data));
+    EXPECT_EQ(data.size(), message->ByteSizeLong());
+    EXPECT_EQ(data, message->SerializeAsString());
+
+    // Deterministic serialization goes through the CodedOutputStream.
+    std::string coded_data;
+    {
+      io::StringOutputStream output_stream(&coded_data);
+      io::CodedOutputStream output(&output_stream);
+      output.SetSerializationDeterministic(true);
+      message->SerializeToCodedStream(&output);
+    }
+    EXPECT_EQ(data, coded_data);
+
+    if (!GetParam()) {
+      delete message;
+    }
+  }
+}
+
+TEST_P(DynamicMessageTest, ParseUnknownEnumValue) {
+  // Enum values which proto2 doesn't know end up in the unknown fields.
+  unittest::TestAllTypes generated;
+  generated.set_optional_int32(1);
+  std::string data = generated.SerializeAsString();
+  data += "\xa8\x01\x0c";  // optional_nested_enum: 12
+  ASSERT_TRUE(generated.ParseFromString(data));
+
+  Arena arena;
+  Message* message = prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(message->ParseFromString(data));
+  EXPECT_FALSE(message->GetReflection()->HasField(
+      *message, descriptor_->FindFieldByName("optional_nested_enum")));
+  EXPECT_EQ(1,
+            message->GetReflection()->GetUnknownFields(*message).field_count());
+  EXPECT_EQ(generated.SerializeAsString(), message->SerializeAsString());
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
+TEST_F(DynamicMessageTest, ParseGroupEndTag) {
+  // The end tag of a group carries the number of the group field, which can
+  // be larger than the field numbers of the group's own type.
+  FileDescriptorProto file;
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: 'dynamic_message_group.proto' "
+      "package: 'dynamic_message_group' "
+      "message_type { "
+      "  name: 'Outer' "
+      "  field { name: 'group' number: 5 label: LABEL_OPTIONAL "
+      "          type: TYPE_GROUP "
+      "          type_name: '.dynamic_message_group.Outer.Group' } "
+      "  nested_type { "
+      "    name: 'Group' "
+      "    field { name: 'a' number: 1 label: LABEL_OPTIONAL "
+      "            type: TYPE_INT32 } "
+      "  } "
+      "}",
+      &file));
+  ASSERT_TRUE(pool_.BuildFile(file) != NULL);
+  const Descriptor* descriptor =
+      pool_.FindMessageTypeByName("dynamic_message_group.Outer");
+  ASSERT_TRUE(descriptor != NULL);
+
+  std::unique_ptr<Message> message(factory_.GetPrototype(descriptor)->New());
+  const std::string data("\x2b\x08\x07\x2c");  // group { a: 7 }
+  ASSERT_TRUE(message->ParseFromString(data));
+  const Message& group = message->GetReflection()->GetMessage(
+      *message, descriptor->FindFieldByName("group"));
+  EXPECT_EQ(7, group.GetReflection()->GetInt32(
+                   group, group.GetDescriptor()->FindFieldByName("a")));
+  EXPECT_EQ(data, message->SerializeAsString());
+}
+
+TEST_F(DynamicMessageTest, IsInitialized) {
+  const Descriptor* descriptor =
+      pool_.FindMessageTypeByName("protobuf_unittest.TestRequiredForeign");
+  ASSERT_TRUE(descriptor != NULL);
+  std::unique_ptr<Message> message(factory_.GetPrototype(descriptor)->New());
+  const Reflection* reflection = message->GetReflection();
+  const FieldDescriptor* optional_message =
+      descriptor->FindFieldByName("optional_message");
+  const FieldDescriptor* repeated_message =
+      descriptor->FindFieldByName("repeated_message");
+  EXPECT_TRUE(message->IsInitialized());
+
+  Message* sub_message = reflection->MutableMessage(message.get(),
+                                                    optional_message);
+  EXPECT_FALSE(message->IsInitialized());
+  const Descriptor* required_descriptor = sub_message->GetDescriptor();
+  const char* required_fields[] = {"a", "b", "c"};
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(required_fields); i++) {
+    sub_message->GetReflection()->SetInt32(
+        sub_message, required_descriptor->FindFieldByName(required_fields[i]),
+        1);
+  }
+  EXPECT_TRUE(message->IsInitialized());
+
+  Message* element = reflection->AddMessage(message.get(), repeated_message);
+  EXPECT_FALSE(message->IsInitialized());
+  element->CopyFrom(*sub_message);
+  EXPECT_TRUE(message->IsInitialized());
+
+  // The generated check agrees.
+  unittest::TestRequiredForeign generated;
+  generated.ParseFromString(message->SerializePartialAsString());
+  EXPECT_TRUE(generated.IsInitialized());
+  message->Clear();
+  EXPECT_TRUE(message->IsInitialized());
+}
+
 TEST_F(DynamicMessageTest, Arena) {
   Arena arena;
   Message* message = prototype_->New(&arena);
@@ -508,6 +508,12 @@ class PROTOBUF_EXPORT ExtensionSet {
   // as .dll.
   int SpaceUsedExcludingSelf() const;
 
+  // The part of SpaceUsedExcludingSelfLong() that is not in the values of the
+  // extensions listed by AppendToList(): the entries of the set, the objects
+  // of repeated extensions, and extensions which were cleared or emptied but
+  // keep their memory for reuse.
+  size_t StorageSpaceUsedLong() const;
+
  private:
   // Interface of a lazily parsed singular message extension.
   class PROTOBUF_EXPORT LazyMessageExtension {
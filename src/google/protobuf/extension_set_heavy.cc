@@ -414,6 +414,36 @@ size_t ExtensionSet::SpaceUsedExcludingSelfLong() const {
   return total_size;
 }
 
+size_t ExtensionSet::StorageSpaceUsedLong() const {
+  size_t total_size = Size() * sizeof(KeyValue);
+  ForEach([&total_size](int /* number */, const Extension& ext) {
+    // Matches what AppendToList() lists.
+    if (ext.is_repeated ? ext.GetSize() == 0 : ext.is_cleared) {
+      total_size += ext.SpaceUsedExcludingSelfLong();
+    } else if (ext.is_repeated) {
+      switch (cpp_type(ext.type)) {
+#define HANDLE_TYPE(UPPERCASE, LOWERCASE)                  \
+  case FieldDescriptor::CPPTYPE_##UPPERCASE:               \
+    total_size += sizeof(*ext.repeated_##LOWERCASE##_value); \
+    break
+
+        HANDLE_TYPE(  INT32,   int32);
+        HANDLE_TYPE(  INT64,   int64);
+        HANDLE_TYPE( UINT32,  uint32);
+        HANDLE_TYPE( UINT64,  uint64);
+        HANDLE_TYPE(  FLOAT,   float);
+        HANDLE_TYPE( DOUBLE,  double);
+        HANDLE_TYPE(   BOOL,    bool);
+        HANDLE_TYPE(   ENUM,    enum);
+        HANDLE_TYPE( STRING,  string);
+        HANDLE_TYPE(MESSAGE, message);
+#undef HANDLE_TYPE
+      }
+    }
+  });
+  return total_size;
+}
+
 inline size_t ExtensionSet::RepeatedMessage_SpaceUsedExcludingSelfLong(
     RepeatedPtrFieldBase* field) {
   return field->SpaceUsedExcludingSelfLong<GenericTypeHandler<Message> >();
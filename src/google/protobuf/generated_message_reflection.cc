@@ -2411,6 +2411,38 @@ void AddDescriptors(DescriptorTable* table, const InitFunc* deps,
   AddDescriptorsImpl(table, deps, num_deps);
 }
 
+const ExtensionSet* ReflectionInternals::GetExtensionSet(
+    const Message& message) {
+  // All messages with reflection use GeneratedMessageReflection.
+  const GeneratedMessageReflection* reflection =
+      static_cast<const GeneratedMessageReflection*>(message.GetReflection());
+  return reflection->schema_.HasExtensionSet()
+             ? &reflection->GetExtensionSet(message)
+             : NULL;
+}
+
+const MapFieldBase* ReflectionInternals::GetMapData(
+    const Message& message, const FieldDescriptor* field) {
+  return static_cast<const GeneratedMessageReflection*>(message.GetReflection())
+      ->GetMapData(message, field);
+}
+
+int ReflectionInternals::MapSize(const Message& message,
+                                 const FieldDescriptor* field) {
+  return static_cast<const GeneratedMessageReflection*>(message.GetReflection())
+      ->MapSize(message, field);
+}
+
+const void* ReflectionInternals::GetRawRepeatedField(
+    const Message& message, const FieldDescriptor* field) {
+  return static_cast<const GeneratedMessageReflection*>(message.GetReflection())
+      ->GetRawRepeatedField(message, field, field->cpp_type(), -1, NULL);
+}
+
+size_t ReflectionInternals::RepeatedPtrFieldHeaderSize() {
+  return RepeatedPtrFieldBase::kRepHeaderSize;
+}
+
 // Separate function because it needs to be a friend of
 // GeneratedMessageReflection
 void RegisterAllTypesInternal(const Metadata* file_level_metadata, int size) {
@@ -78,6 +78,7 @@ namespace protobuf {
 namespace internal {
 class DefaultEmptyOneof;
 class ReflectionAccessor;
+class ReflectionInternals;
 
 // Defined in this file.
 class GeneratedMessageReflection;
@@ -532,6 +533,7 @@ class GeneratedMessageReflection final : public Reflection {
 
  private:
   friend class ReflectionAccessor;
+  friend class ReflectionInternals;
   friend class upb::google_opensource::GMR_Handlers;
 
   const Descriptor* const descriptor_;
@@ -674,6 +676,26 @@ class GeneratedMessageReflection final : public Reflection {
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(GeneratedMessageReflection);
 };
 
+// Gives the utilities in util/ access to the parts of messages that
+// Reflection does not expose.  Not part of the public API.
+class PROTOBUF_EXPORT ReflectionInternals {
+ public:
+  // Returns the extensions of "message", or NULL if its type has no extension
+  // ranges.
+  static const ExtensionSet* GetExtensionSet(const Message& message);
+
+  // Return the map or repeated field of "message" as stored, without syncing
+  // the map with its repeated field view.
+  static const MapFieldBase* GetMapData(const Message& message,
+                                        const FieldDescriptor* field);
+  static int MapSize(const Message& message, const FieldDescriptor* field);
+  static const void* GetRawRepeatedField(const Message& message,
+                                         const FieldDescriptor* field);
+
+  // The bytes a RepeatedPtrField allocates in addition to the pointers.
+  static size_t RepeatedPtrFieldHeaderSize();
+};
+
 typedef void (*InitFunc)();
 
 struct PROTOBUF_EXPORT AssignDescriptorsTable {
@@ -38,6 +38,8 @@
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
 
+#include <google/protobuf/port_def.inc>
+
 namespace google {
 namespace protobuf {
 namespace io {
@@ -49,6 +51,861 @@ namespace io {
 
 namespace {
 
+// The most significant 64 bits of 10^q for q in [kMinPowerOfTen,
+// kMaxPowerOfTen], normalized so that the top bit is set and rounded down.
+const int kMinPowerOfTen = -348;
+const int kMaxPowerOfTen = 347;
+const uint64 kPowersOfTen[] = {
+    PROTOBUF_ULONGLONG(0xfa8fd5a0081c0288),  // 1e-348
+    PROTOBUF_ULONGLONG(0x9c99e58405118195),  // 1e-347
+    PROTOBUF_ULONGLONG(0xc3c05ee50655e1fa),  // 1e-346
+    PROTOBUF_ULONGLONG(0xf4b0769e47eb5a78),  // 1e-345
+    PROTOBUF_ULONGLONG(0x98ee4a22ecf3188b),  // 1e-344
+    PROTOBUF_ULONGLONG(0xbf29dcaba82fdeae),  // 1e-343
+    PROTOBUF_ULONGLONG(0xeef453d6923bd65a),  // 1e-342
+    PROTOBUF_ULONGLONG(0x9558b4661b6565f8),  // 1e-341
+    PROTOBUF_ULONGLONG(0xbaaee17fa23ebf76),  // 1e-340
+    PROTOBUF_ULONGLONG(0xe95a99df8ace6f53),  // 1e-339
+    PROTOBUF_ULONGLONG(0x91d8a02bb6c10594),  // 1e-338
+    PROTOBUF_ULONGLONG(0xb64ec836a47146f9),  // 1e-337
+    PROTOBUF_ULONGLONG(0xe3e27a444d8d98b7),  // 1e-336
+    PROTOBUF_ULONGLONG(0x8e6d8c6ab0787f72),  // 1e-335
+    PROTOBUF_ULONGLONG(0xb208ef855c969f4f),  // 1e-334
+    PROTOBUF_ULONGLONG(0xde8b2b66b3bc4723),  // 1e-333
+    PROTOBUF_ULONGLONG(0x8b16fb203055ac76),  // 1e-332
+    PROTOBUF_ULONGLONG(0xaddcb9e83c6b1793),  // 1e-331
+    PROTOBUF_ULONGLONG(0xd953e8624b85dd78),  // 1e-330
+    PROTOBUF_ULONGLONG(0x87d4713d6f33aa6b),  // 1e-329
+    PROTOBUF_ULONGLONG(0xa9c98d8ccb009506),  // 1e-328
+    PROTOBUF_ULONGLONG(0xd43bf0effdc0ba48),  // 1e-327
+    PROTOBUF_ULONGLONG(0x84a57695fe98746d),  // 1e-326
+    PROTOBUF_ULONGLONG(0xa5ced43b7e3e9188),  // 1e-325
+    PROTOBUF_ULONGLONG(0xcf42894a5dce35ea),  // 1e-324
+    PROTOBUF_ULONGLONG(0x818995ce7aa0e1b2),  // 1e-323
+    PROTOBUF_ULONGLONG(0xa1ebfb4219491a1f),  // 1e-322
+    PROTOBUF_ULONGLONG(0xca66fa129f9b60a6),  // 1e-321
+    PROTOBUF_ULONGLONG(0xfd00b897478238d0),  // 1e-320
+    PROTOBUF_ULONGLONG(0x9e20735e8cb16382),  // 1e-319
+    PROTOBUF_ULONGLONG(0xc5a890362fddbc62),  // 1e-318
+    PROTOBUF_ULONGLONG(0xf712b443bbd52b7b),  // 1e-317
+    PROTOBUF_ULONGLONG(0x9a6bb0aa55653b2d),  // 1e-316
+    PROTOBUF_ULONGLONG(0xc1069cd4eabe89f8),  // 1e-315
+    PROTOBUF_ULONGLONG(0xf148440a256e2c76),  // 1e-314
+    PROTOBUF_ULONGLONG(0x96cd2a865764dbca),  // 1e-313
+    PROTOBUF_ULONGLONG(0xbc807527ed3e12bc),  // 1e-312
+    PROTOBUF_ULONGLONG(0xeba09271e88d976b),  // 1e-311
+    PROTOBUF_ULONGLONG(0x93445b8731587ea3),  // 1e-310
+    PROTOBUF_ULONGLONG(0xb8157268fdae9e4c),  // 1e-309
+    PROTOBUF_ULONGLONG(0xe61acf033d1a45df),  // 1e-308
+    PROTOBUF_ULONGLONG(0x8fd0c16206306bab),  // 1e-307
+    PROTOBUF_ULONGLONG(0xb3c4f1ba87bc8696),  // 1e-306
+    PROTOBUF_ULONGLONG(0xe0b62e2929aba83c),  // 1e-305
+    PROTOBUF_ULONGLONG(0x8c71dcd9ba0b4925),  // 1e-304
+    PROTOBUF_ULONGLONG(0xaf8e5410288e1b6f),  // 1e-303
+    PROTOBUF_ULONGLONG(0xdb71e91432b1a24a),  // 1e-302
+    PROTOBUF_ULONGLONG(0x892731ac9faf056e),  // 1e-301
+    PROTOBUF_ULONGLONG(0xab70fe17c79ac6ca),  // 1e-300
+    PROTOBUF_ULONGLONG(0xd64d3d9db981787d),  // 1e-299
+    PROTOBUF_ULONGLONG(0x85f0468293f0eb4e),  // 1e-298
+    PROTOBUF_ULONGLONG(0xa76c582338ed2621),  // 1e-297
+    PROTOBUF_ULONGLONG(0xd1476e2c07286faa),  // 1e-296
+    PROTOBUF_ULONGLONG(0x82cca4db847945ca),  // 1e-295
+    PROTOBUF_ULONGLONG(0xa37fce126597973c),  // 1e-294
+    PROTOBUF_ULONGLONG(0xcc5fc196fefd7d0c),  // 1e-293
+    PROTOBUF_ULONGLONG(0xff77b1fcbebcdc4f),  // 1e-292
+    PROTOBUF_ULONGLONG(0x9faacf3df73609b1),  // 1e-291
+    PROTOBUF_ULONGLONG(0xc795830d75038c1d),  // 1e-290
+    PROTOBUF_ULONGLONG(0xf97ae3d0d2446f25),  // 1e-289
+    PROTOBUF_ULONGLONG(0x9becce62836ac577),  // 1e-288
+    PROTOBUF_ULONGLONG(0xc2e801fb244576d5),  // 1e-287
+    PROTOBUF_ULONGLONG(0xf3a20279ed56d48a),  // 1e-286
+    PROTOBUF_ULONGLONG(0x9845418c345644d6),  // 1e-285
+    PROTOBUF_ULONGLONG(0xbe5691ef416bd60c),  // 1e-284
+    PROTOBUF_ULONGLONG(0xedec366b11c6cb8f),  // 1e-283
+    PROTOBUF_ULONGLONG(0x94b3a202eb1c3f39),  // 1e-282
+    PROTOBUF_ULONGLONG(0xb9e08a83a5e34f07),  // 1e-281
+    PROTOBUF_ULONGLONG(0xe858ad248f5c22c9),  // 1e-280
+    PROTOBUF_ULONGLONG(0x91376c36d99995be),  // 1e-279
+    PROTOBUF_ULONGLONG(0xb58547448ffffb2d),  // 1e-278
+    PROTOBUF_ULONGLONG(0xe2e69915b3fff9f9),  // 1e-277
+    PROTOBUF_ULONGLONG(0x8dd01fad907ffc3b),  // 1e-276
+    PROTOBUF_ULONGLONG(0xb1442798f49ffb4a),  // 1e-275
+    PROTOBUF_ULONGLONG(0xdd95317f31c7fa1d),  // 1e-274
+    PROTOBUF_ULONGLONG(0x8a7d3eef7f1cfc52),  // 1e-273
+    PROTOBUF_ULONGLONG(0xad1c8eab5ee43b66),  // 1e-272
+    PROTOBUF_ULONGLONG(0xd863b256369d4a40),  // 1e-271
+    PROTOBUF_ULONGLONG(0x873e4f75e2224e68),  // 1e-270
+    PROTOBUF_ULONGLONG(0xa90de3535aaae202),  // 1e-269
+    PROTOBUF_ULONGLONG(0xd3515c2831559a83),  // 1e-268
+    PROTOBUF_ULONGLONG(0x8412d9991ed58091),  // 1e-267
+    PROTOBUF_ULONGLONG(0xa5178fff668ae0b6),  // 1e-266
+    PROTOBUF_ULONGLONG(0xce5d73ff402d98e3),  // 1e-265
+    PROTOBUF_ULONGLONG(0x80fa687f881c7f8e),  // 1e-264
+    PROTOBUF_ULONGLONG(0xa139029f6a239f72),  // 1e-263
+    PROTOBUF_ULONGLONG(0xc987434744ac874e),  // 1e-262
+    PROTOBUF_ULONGLONG(0xfbe9141915d7a922),  // 1e-261
+    PROTOBUF_ULONGLONG(0x9d71ac8fada6c9b5),  // 1e-260
+    PROTOBUF_ULONGLONG(0xc4ce17b399107c22),  // 1e-259
+    PROTOBUF_ULONGLONG(0xf6019da07f549b2b),  // 1e-258
+    PROTOBUF_ULONGLONG(0x99c102844f94e0fb),  // 1e-257
+    PROTOBUF_ULONGLONG(0xc0314325637a1939),  // 1e-256
+    PROTOBUF_ULONGLONG(0xf03d93eebc589f88),  // 1e-255
+    PROTOBUF_ULONGLONG(0x96267c7535b763b5),  // 1e-254
+    PROTOBUF_ULONGLONG(0xbbb01b9283253ca2),  // 1e-253
+    PROTOBUF_ULONGLONG(0xea9c227723ee8bcb),  // 1e-252
+    PROTOBUF_ULONGLONG(0x92a1958a7675175f),  // 1e-251
+    PROTOBUF_ULONGLONG(0xb749faed14125d36),  // 1e-250
+    PROTOBUF_ULONGLONG(0xe51c79a85916f484),  // 1e-249
+    PROTOBUF_ULONGLONG(0x8f31cc0937ae58d2),  // 1e-248
+    PROTOBUF_ULONGLONG(0xb2fe3f0b8599ef07),  // 1e-247
+    PROTOBUF_ULONGLONG(0xdfbdcece67006ac9),  // 1e-246
+    PROTOBUF_ULONGLONG(0x8bd6a141006042bd),  // 1e-245
+    PROTOBUF_ULONGLONG(0xaecc49914078536d),  // 1e-244
+    PROTOBUF_ULONGLONG(0xda7f5bf590966848),  // 1e-243
+    PROTOBUF_ULONGLONG(0x888f99797a5e012d),  // 1e-242
+    PROTOBUF_ULONGLONG(0xaab37fd7d8f58178),  // 1e-241
+    PROTOBUF_ULONGLONG(0xd5605fcdcf32e1d6),  // 1e-240
+    PROTOBUF_ULONGLONG(0x855c3be0a17fcd26),  // 1e-239
+    PROTOBUF_ULONGLONG(0xa6b34ad8c9dfc06f),  // 1e-238
+    PROTOBUF_ULONGLONG(0xd0601d8efc57b08b),  // 1e-237
+    PROTOBUF_ULONGLONG(0x823c12795db6ce57),  // 1e-236
+    PROTOBUF_ULONGLONG(0xa2cb1717b52481ed),  // 1e-235
+    PROTOBUF_ULONGLONG(0xcb7ddcdda26da268),  // 1e-234
+    PROTOBUF_ULONGLONG(0xfe5d54150b090b02),  // 1e-233
+    PROTOBUF_ULONGLONG(0x9efa548d26e5a6e1),  // 1e-232
+    PROTOBUF_ULONGLONG(0xc6b8e9b0709f109a),  // 1e-231
+    PROTOBUF_ULONGLONG(0xf867241c8cc6d4c0),  // 1e-230
+    PROTOBUF_ULONGLONG(0x9b407691d7fc44f8),  // 1e-229
+    PROTOBUF_ULONGLONG(0xc21094364dfb5636),  // 1e-228
+    PROTOBUF_ULONGLONG(0xf294b943e17a2bc4),  // 1e-227
+    PROTOBUF_ULONGLONG(0x979cf3ca6cec5b5a),  // 1e-226
+    PROTOBUF_ULONGLONG(0xbd8430bd08277231),  // 1e-225
+    PROTOBUF_ULONGLONG(0xece53cec4a314ebd),  // 1e-224
+    PROTOBUF_ULONGLONG(0x940f4613ae5ed136),  // 1e-223
+    PROTOBUF_ULONGLONG(0xb913179899f68584),  // 1e-222
+    PROTOBUF_ULONGLONG(0xe757dd7ec07426e5),  // 1e-221
+    PROTOBUF_ULONGLONG(0x9096ea6f3848984f),  // 1e-220
+    PROTOBUF_ULONGLONG(0xb4bca50b065abe63),  // 1e-219
+    PROTOBUF_ULONGLONG(0xe1ebce4dc7f16dfb),  // 1e-218
+    PROTOBUF_ULONGLONG(0x8d3360f09cf6e4bd),  // 1e-217
+    PROTOBUF_ULONGLONG(0xb080392cc4349dec),  // 1e-216
+    PROTOBUF_ULONGLONG(0xdca04777f541c567),  // 1e-215
+    PROTOBUF_ULONGLONG(0x89e42caaf9491b60),  // 1e-214
+    PROTOBUF_ULONGLONG(0xac5d37d5b79b6239),  // 1e-213
+    PROTOBUF_ULONGLONG(0xd77485cb25823ac7),  // 1e-212
+    PROTOBUF_ULONGLONG(0x86a8d39ef77164bc),  // 1e-211
+    PROTOBUF_ULONGLONG(0xa8530886b54dbdeb),  // 1e-210
+    PROTOBUF_ULONGLONG(0xd267caa862a12d66),  // 1e-209
+    PROTOBUF_ULONGLONG(0x8380dea93da4bc60),  // 1e-208
+    PROTOBUF_ULONGLONG(0xa46116538d0deb78),  // 1e-207
+    PROTOBUF_ULONGLONG(0xcd795be870516656),  // 1e-206
+    PROTOBUF_ULONGLONG(0x806bd9714632dff6),  // 1e-205
+    PROTOBUF_ULONGLONG(0xa086cfcd97bf97f3),  // 1e-204
+    PROTOBUF_ULONGLONG(0xc8a883c0fdaf7df0),  // 1e-203
+    PROTOBUF_ULONGLONG(0xfad2a4b13d1b5d6c),  // 1e-202
+    PROTOBUF_ULONGLONG(0x9cc3a6eec6311a63),  // 1e-201
+    PROTOBUF_ULONGLONG(0xc3f490aa77bd60fc),  // 1e-200
+    PROTOBUF_ULONGLONG(0xf4f1b4d515acb93b),  // 1e-199
+    PROTOBUF_ULONGLONG(0x991711052d8bf3c5),  // 1e-198
+    PROTOBUF_ULONGLONG(0xbf5cd54678eef0b6),  // 1e-197
+    PROTOBUF_ULONGLONG(0xef340a98172aace4),  // 1e-196
+    PROTOBUF_ULONGLONG(0x9580869f0e7aac0e),  // 1e-195
+    PROTOBUF_ULONGLONG(0xbae0a846d2195712),  // 1e-194
+    PROTOBUF_ULONGLONG(0xe998d258869facd7),  // 1e-193
+    PROTOBUF_ULONGLONG(0x91ff83775423cc06),  // 1e-192
+    PROTOBUF_ULONGLONG(0xb67f6455292cbf08),  // 1e-191
+    PROTOBUF_ULONGLONG(0xe41f3d6a7377eeca),  // 1e-190
+    PROTOBUF_ULONGLONG(0x8e938662882af53e),  // 1e-189
+    PROTOBUF_ULONGLONG(0xb23867fb2a35b28d),  // 1e-188
+    PROTOBUF_ULONGLONG(0xdec681f9f4c31f31),  // 1e-187
+    PROTOBUF_ULONGLONG(0x8b3c113c38f9f37e),  // 1e-186
+    PROTOBUF_ULONGLONG(0xae0b158b4738705e),  // 1e-185
+    PROTOBUF_ULONGLONG(0xd98ddaee19068c76),  // 1e-184
+    PROTOBUF_ULONGLONG(0x87f8a8d4cfa417c9),  // 1e-183
+    PROTOBUF_ULONGLONG(0xa9f6d30a038d1dbc),  // 1e-182
+    PROTOBUF_ULONGLONG(0xd47487cc8470652b),  // 1e-181
+    PROTOBUF_ULONGLONG(0x84c8d4dfd2c63f3b),  // 1e-180
+    PROTOBUF_ULONGLONG(0xa5fb0a17c777cf09),  // 1e-179
+    PROTOBUF_ULONGLONG(0xcf79cc9db955c2cc),  // 1e-178
+    PROTOBUF_ULONGLONG(0x81ac1fe293d599bf),  // 1e-177
+    PROTOBUF_ULONGLONG(0xa21727db38cb002f),  // 1e-176
+    PROTOBUF_ULONGLONG(0xca9cf1d206fdc03b),  // 1e-175
+    PROTOBUF_ULONGLONG(0xfd442e4688bd304a),  // 1e-174
+    PROTOBUF_ULONGLONG(0x9e4a9cec15763e2e),  // 1e-173
+    PROTOBUF_ULONGLONG(0xc5dd44271ad3cdba),  // 1e-172
+    PROTOBUF_ULONGLONG(0xf7549530e188c128),  // 1e-171
+    PROTOBUF_ULONGLONG(0x9a94dd3e8cf578b9),  // 1e-170
+    PROTOBUF_ULONGLONG(0xc13a148e3032d6e7),  // 1e-169
+    PROTOBUF_ULONGLONG(0xf18899b1bc3f8ca1),  // 1e-168
+    PROTOBUF_ULONGLONG(0x96f5600f15a7b7e5),  // 1e-167
+    PROTOBUF_ULONGLONG(0xbcb2b812db11a5de),  // 1e-166
+    PROTOBUF_ULONGLONG(0xebdf661791d60f56),  // 1e-165
+    PROTOBUF_ULONGLONG(0x936b9fcebb25c995),  // 1e-164
+    PROTOBUF_ULONGLONG(0xb84687c269ef3bfb),  // 1e-163
+    PROTOBUF_ULONGLONG(0xe65829b3046b0afa),  // 1e-162
+    PROTOBUF_ULONGLONG(0x8ff71a0fe2c2e6dc),  // 1e-161
+    PROTOBUF_ULONGLONG(0xb3f4e093db73a093),  // 1e-160
+    PROTOBUF_ULONGLONG(0xe0f218b8d25088b8),  // 1e-159
+    PROTOBUF_ULONGLONG(0x8c974f7383725573),  // 1e-158
+    PROTOBUF_ULONGLONG(0xafbd2350644eeacf),  // 1e-157
+    PROTOBUF_ULONGLONG(0xdbac6c247d62a583),  // 1e-156
+    PROTOBUF_ULONGLONG(0x894bc396ce5da772),  // 1e-155
+    PROTOBUF_ULONGLONG(0xab9eb47c81f5114f),  // 1e-154
+    PROTOBUF_ULONGLONG(0xd686619ba27255a2),  // 1e-153
+    PROTOBUF_ULONGLONG(0x8613fd0145877585),  // 1e-152
+    PROTOBUF_ULONGLONG(0xa798fc4196e952e7),  // 1e-151
+    PROTOBUF_ULONGLONG(0xd17f3b51fca3a7a0),  // 1e-150
+    PROTOBUF_ULONGLONG(0x82ef85133de648c4),  // 1e-149
+    PROTOBUF_ULONGLONG(0xa3ab66580d5fdaf5),  // 1e-148
+    PROTOBUF_ULONGLONG(0xcc963fee10b7d1b3),  // 1e-147
+    PROTOBUF_ULONGLONG(0xffbbcfe994e5c61f),  // 1e-146
+    PROTOBUF_ULONGLONG(0x9fd561f1fd0f9bd3),  // 1e-145
+    PROTOBUF_ULONGLONG(0xc7caba6e7c5382c8),  // 1e-144
+    PROTOBUF_ULONGLONG(0xf9bd690a1b68637b),  // 1e-143
+    PROTOBUF_ULONGLONG(0x9c1661a651213e2d),  // 1e-142
+    PROTOBUF_ULONGLONG(0xc31bfa0fe5698db8),  // 1e-141
+    PROTOBUF_ULONGLONG(0xf3e2f893dec3f126),  // 1e-140
+    PROTOBUF_ULONGLONG(0x986ddb5c6b3a76b7),  // 1e-139
+    PROTOBUF_ULONGLONG(0xbe89523386091465),  // 1e-138
+    PROTOBUF_ULONGLONG(0xee2ba6c0678b597f),  // 1e-137
+    PROTOBUF_ULONGLONG(0x94db483840b717ef),  // 1e-136
+    PROTOBUF_ULONGLONG(0xba121a4650e4ddeb),  // 1e-135
+    PROTOBUF_ULONGLONG(0xe896a0d7e51e1566),  // 1e-134
+    PROTOBUF_ULONGLONG(0x915e2486ef32cd60),  // 1e-133
+    PROTOBUF_ULONGLONG(0xb5b5ada8aaff80b8),  // 1e-132
+    PROTOBUF_ULONGLONG(0xe3231912d5bf60e6),  // 1e-131
+    PROTOBUF_ULONGLONG(0x8df5efabc5979c8f),  // 1e-130
+    PROTOBUF_ULONGLONG(0xb1736b96b6fd83b3),  // 1e-129
+    PROTOBUF_ULONGLONG(0xddd0467c64bce4a0),  // 1e-128
+    PROTOBUF_ULONGLONG(0x8aa22c0dbef60ee4),  // 1e-127
+    PROTOBUF_ULONGLONG(0xad4ab7112eb3929d),  // 1e-126
+    PROTOBUF_ULONGLONG(0xd89d64d57a607744),  // 1e-125
+    PROTOBUF_ULONGLONG(0x87625f056c7c4a8b),  // 1e-124
+    PROTOBUF_ULONGLONG(0xa93af6c6c79b5d2d),  // 1e-123
+    PROTOBUF_ULONGLONG(0xd389b47879823479),  // 1e-122
+    PROTOBUF_ULONGLONG(0x843610cb4bf160cb),  // 1e-121
+    PROTOBUF_ULONGLONG(0xa54394fe1eedb8fe),  // 1e-120
+    PROTOBUF_ULONGLONG(0xce947a3da6a9273e),  // 1e-119
+    PROTOBUF_ULONGLONG(0x811ccc668829b887),  // 1e-118
+    PROTOBUF_ULONGLONG(0xa163ff802a3426a8),  // 1e-117
+    PROTOBUF_ULONGLONG(0xc9bcff6034c13052),  // 1e-116
+    PROTOBUF_ULONGLONG(0xfc2c3f3841f17c67),  // 1e-115
+    PROTOBUF_ULONGLONG(0x9d9ba7832936edc0),  // 1e-114
+    PROTOBUF_ULONGLONG(0xc5029163f384a931),  // 1e-113
+    PROTOBUF_ULONGLONG(0xf64335bcf065d37d),  // 1e-112
+    PROTOBUF_ULONGLONG(0x99ea0196163fa42e),  // 1e-111
+    PROTOBUF_ULONGLONG(0xc06481fb9bcf8d39),  // 1e-110
+    PROTOBUF_ULONGLONG(0xf07da27a82c37088),  // 1e-109
+    PROTOBUF_ULONGLONG(0x964e858c91ba2655),  // 1e-108
+    PROTOBUF_ULONGLONG(0xbbe226efb628afea),  // 1e-107
+    PROTOBUF_ULONGLONG(0xeadab0aba3b2dbe5),  // 1e-106
+    PROTOBUF_ULONGLONG(0x92c8ae6b464fc96f),  // 1e-105
+    PROTOBUF_ULONGLONG(0xb77ada0617e3bbcb),  // 1e-104
+    PROTOBUF_ULONGLONG(0xe55990879ddcaabd),  // 1e-103
+    PROTOBUF_ULONGLONG(0x8f57fa54c2a9eab6),  // 1e-102
+    PROTOBUF_ULONGLONG(0xb32df8e9f3546564),  // 1e-101
+    PROTOBUF_ULONGLONG(0xdff9772470297ebd),  // 1e-100
+    PROTOBUF_ULONGLONG(0x8bfbea76c619ef36),  // 1e-99
+    PROTOBUF_ULONGLONG(0xaefae51477a06b03),  // 1e-98
+    PROTOBUF_ULONGLONG(0xdab99e59958885c4),  // 1e-97
+    PROTOBUF_ULONGLONG(0x88b402f7fd75539b),  // 1e-96
+    PROTOBUF_ULONGLONG(0xaae103b5fcd2a881),  // 1e-95
+    PROTOBUF_ULONGLONG(0xd59944a37c0752a2),  // 1e-94
+    PROTOBUF_ULONGLONG(0x857fcae62d8493a5),  // 1e-93
+    PROTOBUF_ULONGLONG(0xa6dfbd9fb8e5b88e),  // 1e-92
+    PROTOBUF_ULONGLONG(0xd097ad07a71f26b2),  // 1e-91
+    PROTOBUF_ULONGLONG(0x825ecc24c873782f),  // 1e-90
+    PROTOBUF_ULONGLONG(0xa2f67f2dfa90563b),  // 1e-89
+    PROTOBUF_ULONGLONG(0xcbb41ef979346bca),  // 1e-88
+    PROTOBUF_ULONGLONG(0xfea126b7d78186bc),  // 1e-87
+    PROTOBUF_ULONGLONG(0x9f24b832e6b0f436),  // 1e-86
+    PROTOBUF_ULONGLONG(0xc6ede63fa05d3143),  // 1e-85
+    PROTOBUF_ULONGLONG(0xf8a95fcf88747d94),  // 1e-84
+    PROTOBUF_ULONGLONG(0x9b69dbe1b548ce7c),  // 1e-83
+    PROTOBUF_ULONGLONG(0xc24452da229b021b),  // 1e-82
+    PROTOBUF_ULONGLONG(0xf2d56790ab41c2a2),  // 1e-81
+    PROTOBUF_ULONGLONG(0x97c560ba6b0919a5),  // 1e-80
+    PROTOBUF_ULONGLONG(0xbdb6b8e905cb600f),  // 1e-79
+    PROTOBUF_ULONGLONG(0xed246723473e3813),  // 1e-78
+    PROTOBUF_ULONGLONG(0x9436c0760c86e30b),  // 1e-77
+    PROTOBUF_ULONGLONG(0xb94470938fa89bce),  // 1e-76
+    PROTOBUF_ULONGLONG(0xe7958cb87392c2c2),  // 1e-75
+    PROTOBUF_ULONGLONG(0x90bd77f3483bb9b9),  // 1e-74
+    PROTOBUF_ULONGLONG(0xb4ecd5f01a4aa828),  // 1e-73
+    PROTOBUF_ULONGLONG(0xe2280b6c20dd5232),  // 1e-72
+    PROTOBUF_ULONGLONG(0x8d590723948a535f),  // 1e-71
+    PROTOBUF_ULONGLONG(0xb0af48ec79ace837),  // 1e-70
+    PROTOBUF_ULONGLONG(0xdcdb1b2798182244),  // 1e-69
+    PROTOBUF_ULONGLONG(0x8a08f0f8bf0f156b),  // 1e-68
+    PROTOBUF_ULONGLONG(0xac8b2d36eed2dac5),  // 1e-67
+    PROTOBUF_ULONGLONG(0xd7adf884aa879177),  // 1e-66
+    PROTOBUF_ULONGLONG(0x86ccbb52ea94baea),  // 1e-65
+    PROTOBUF_ULONGLONG(0xa87fea27a539e9a5),  // 1e-64
+    PROTOBUF_ULONGLONG(0xd29fe4b18e88640e),  // 1e-63
+    PROTOBUF_ULONGLONG(0x83a3eeeef9153e89),  // 1e-62
+    PROTOBUF_ULONGLONG(0xa48ceaaab75a8e2b),  // 1e-61
+    PROTOBUF_ULONGLONG(0xcdb02555653131b6),  // 1e-60
+    PROTOBUF_ULONGLONG(0x808e17555f3ebf11),  // 1e-59
+    PROTOBUF_ULONGLONG(0xa0b19d2ab70e6ed6),  // 1e-58
+    PROTOBUF_ULONGLONG(0xc8de047564d20a8b),  // 1e-57
+    PROTOBUF_ULONGLONG(0xfb158592be068d2e),  // 1e-56
+    PROTOBUF_ULONGLONG(0x9ced737bb6c4183d),  // 1e-55
+    PROTOBUF_ULONGLONG(0xc428d05aa4751e4c),  // 1e-54
+    PROTOBUF_ULONGLONG(0xf53304714d9265df),  // 1e-53
+    PROTOBUF_ULONGLONG(0x993fe2c6d07b7fab),  // 1e-52
+    PROTOBUF_ULONGLONG(0xbf8fdb78849a5f96),  // 1e-51
+    PROTOBUF_ULONGLONG(0xef73d256a5c0f77c),  // 1e-50
+    PROTOBUF_ULONGLONG(0x95a8637627989aad),  // 1e-49
+    PROTOBUF_ULONGLONG(0xbb127c53b17ec159),  // 1e-48
+    PROTOBUF_ULONGLONG(0xe9d71b689dde71af),  // 1e-47
+    PROTOBUF_ULONGLONG(0x9226712162ab070d),  // 1e-46
+    PROTOBUF_ULONGLONG(0xb6b00d69bb55c8d1),  // 1e-45
+    PROTOBUF_ULONGLONG(0xe45c10c42a2b3b05),  // 1e-44
+    PROTOBUF_ULONGLONG(0x8eb98a7a9a5b04e3),  // 1e-43
+    PROTOBUF_ULONGLONG(0xb267ed1940f1c61c),  // 1e-42
+    PROTOBUF_ULONGLONG(0xdf01e85f912e37a3),  // 1e-41
+    PROTOBUF_ULONGLONG(0x8b61313bbabce2c6),  // 1e-40
+    PROTOBUF_ULONGLONG(0xae397d8aa96c1b77),  // 1e-39
+    PROTOBUF_ULONGLONG(0xd9c7dced53c72255),  // 1e-38
+    PROTOBUF_ULONGLONG(0x881cea14545c7575),  // 1e-37
+    PROTOBUF_ULONGLONG(0xaa242499697392d2),  // 1e-36
+    PROTOBUF_ULONGLONG(0xd4ad2dbfc3d07787),  // 1e-35
+    PROTOBUF_ULONGLONG(0x84ec3c97da624ab4),  // 1e-34
+    PROTOBUF_ULONGLONG(0xa6274bbdd0fadd61),  // 1e-33
+    PROTOBUF_ULONGLONG(0xcfb11ead453994ba),  // 1e-32
+    PROTOBUF_ULONGLONG(0x81ceb32c4b43fcf4),  // 1e-31
+    PROTOBUF_ULONGLONG(0xa2425ff75e14fc31),  // 1e-30
+    PROTOBUF_ULONGLONG(0xcad2f7f5359a3b3e),  // 1e-29
+    PROTOBUF_ULONGLONG(0xfd87b5f28300ca0d),  // 1e-28
+    PROTOBUF_ULONGLONG(0x9e74d1b791e07e48),  // 1e-27
+    PROTOBUF_ULONGLONG(0xc612062576589dda),  // 1e-26
+    PROTOBUF_ULONGLONG(0xf79687aed3eec551),  // 1e-25
+    PROTOBUF_ULONGLONG(0x9abe14cd44753b52),  // 1e-24
+    PROTOBUF_ULONGLONG(0xc16d9a0095928a27),  // 1e-23
+    PROTOBUF_ULONGLONG(0xf1c90080baf72cb1),  // 1e-22
+    PROTOBUF_ULONGLONG(0x971da05074da7bee),  // 1e-21
+    PROTOBUF_ULONGLONG(0xbce5086492111aea),  // 1e-20
+    PROTOBUF_ULONGLONG(0xec1e4a7db69561a5),  // 1e-19
+    PROTOBUF_ULONGLONG(0x9392ee8e921d5d07),  // 1e-18
+    PROTOBUF_ULONGLONG(0xb877aa3236a4b449),  // 1e-17
+    PROTOBUF_ULONGLONG(0xe69594bec44de15b),  // 1e-16
+    PROTOBUF_ULONGLONG(0x901d7cf73ab0acd9),  // 1e-15
+    PROTOBUF_ULONGLONG(0xb424dc35095cd80f),  // 1e-14
+    PROTOBUF_ULONGLONG(0xe12e13424bb40e13),  // 1e-13
+    PROTOBUF_ULONGLONG(0x8cbccc096f5088cb),  // 1e-12
+    PROTOBUF_ULONGLONG(0xafebff0bcb24aafe),  // 1e-11
+    PROTOBUF_ULONGLONG(0xdbe6fecebdedd5be),  // 1e-10
+    PROTOBUF_ULONGLONG(0x89705f4136b4a597),  // 1e-9
+    PROTOBUF_ULONGLONG(0xabcc77118461cefc),  // 1e-8
+    PROTOBUF_ULONGLONG(0xd6bf94d5e57a42bc),  // 1e-7
+    PROTOBUF_ULONGLONG(0x8637bd05af6c69b5),  // 1e-6
+    PROTOBUF_ULONGLONG(0xa7c5ac471b478423),  // 1e-5
+    PROTOBUF_ULONGLONG(0xd1b71758e219652b),  // 1e-4
+    PROTOBUF_ULONGLONG(0x83126e978d4fdf3b),  // 1e-3
+    PROTOBUF_ULONGLONG(0xa3d70a3d70a3d70a),  // 1e-2
+    PROTOBUF_ULONGLONG(0xcccccccccccccccc),  // 1e-1
+    PROTOBUF_ULONGLONG(0x8000000000000000),  // 1e0
+    PROTOBUF_ULONGLONG(0xa000000000000000),  // 1e1
+    PROTOBUF_ULONGLONG(0xc800000000000000),  // 1e2
+    PROTOBUF_ULONGLONG(0xfa00000000000000),  // 1e3
+    PROTOBUF_ULONGLONG(0x9c40000000000000),  // 1e4
+    PROTOBUF_ULONGLONG(0xc350000000000000),  // 1e5
+    PROTOBUF_ULONGLONG(0xf424000000000000),  // 1e6
+    PROTOBUF_ULONGLONG(0x9896800000000000),  // 1e7
+    PROTOBUF_ULONGLONG(0xbebc200000000000),  // 1e8
+    PROTOBUF_ULONGLONG(0xee6b280000000000),  // 1e9
+    PROTOBUF_ULONGLONG(0x9502f90000000000),  // 1e10
+    PROTOBUF_ULONGLONG(0xba43b74000000000),  // 1e11
+    PROTOBUF_ULONGLONG(0xe8d4a51000000000),  // 1e12
+    PROTOBUF_ULONGLONG(0x9184e72a00000000),  // 1e13
+    PROTOBUF_ULONGLONG(0xb5e620f480000000),  // 1e14
+    PROTOBUF_ULONGLONG(0xe35fa931a0000000),  // 1e15
+    PROTOBUF_ULONGLONG(0x8e1bc9bf04000000),  // 1e16
+    PROTOBUF_ULONGLONG(0xb1a2bc2ec5000000),  // 1e17
+    PROTOBUF_ULONGLONG(0xde0b6b3a76400000),  // 1e18
+    PROTOBUF_ULONGLONG(0x8ac7230489e80000),  // 1e19
+    PROTOBUF_ULONGLONG(0xad78ebc5ac620000),  // 1e20
+    PROTOBUF_ULONGLONG(0xd8d726b7177a8000),  // 1e21
+    PROTOBUF_ULONGLONG(0x878678326eac9000),  // 1e22
+    PROTOBUF_ULONGLONG(0xa968163f0a57b400),  // 1e23
+    PROTOBUF_ULONGLONG(0xd3c21bcecceda100),  // 1e24
+    PROTOBUF_ULONGLONG(0x84595161401484a0),  // 1e25
+    PROTOBUF_ULONGLONG(0xa56fa5b99019a5c8),  // 1e26
+    PROTOBUF_ULONGLONG(0xcecb8f27f4200f3a),  // 1e27
+    PROTOBUF_ULONGLONG(0x813f3978f8940984),  // 1e28
+    PROTOBUF_ULONGLONG(0xa18f07d736b90be5),  // 1e29
+    PROTOBUF_ULONGLONG(0xc9f2c9cd04674ede),  // 1e30
+    PROTOBUF_ULONGLONG(0xfc6f7c4045812296),  // 1e31
+    PROTOBUF_ULONGLONG(0x9dc5ada82b70b59d),  // 1e32
+    PROTOBUF_ULONGLONG(0xc5371912364ce305),  // 1e33
+    PROTOBUF_ULONGLONG(0xf684df56c3e01bc6),  // 1e34
+    PROTOBUF_ULONGLONG(0x9a130b963a6c115c),  // 1e35
+    PROTOBUF_ULONGLONG(0xc097ce7bc90715b3),  // 1e36
+    PROTOBUF_ULONGLONG(0xf0bdc21abb48db20),  // 1e37
+    PROTOBUF_ULONGLONG(0x96769950b50d88f4),  // 1e38
+    PROTOBUF_ULONGLONG(0xbc143fa4e250eb31),  // 1e39
+    PROTOBUF_ULONGLONG(0xeb194f8e1ae525fd),  // 1e40
+    PROTOBUF_ULONGLONG(0x92efd1b8d0cf37be),  // 1e41
+    PROTOBUF_ULONGLONG(0xb7abc627050305ad),  // 1e42
+    PROTOBUF_ULONGLONG(0xe596b7b0c643c719),  // 1e43
+    PROTOBUF_ULONGLONG(0x8f7e32ce7bea5c6f),  // 1e44
+    PROTOBUF_ULONGLONG(0xb35dbf821ae4f38b),  // 1e45
+    PROTOBUF_ULONGLONG(0xe0352f62a19e306e),  // 1e46
+    PROTOBUF_ULONGLONG(0x8c213d9da502de45),  // 1e47
+    PROTOBUF_ULONGLONG(0xaf298d050e4395d6),  // 1e48
+    PROTOBUF_ULONGLONG(0xdaf3f04651d47b4c),  // 1e49
+    PROTOBUF_ULONGLONG(0x88d8762bf324cd0f),  // 1e50
+    PROTOBUF_ULONGLONG(0xab0e93b6efee0053),  // 1e51
+    PROTOBUF_ULONGLONG(0xd5d238a4abe98068),  // 1e52
+    PROTOBUF_ULONGLONG(0x85a36366eb71f041),  // 1e53
+    PROTOBUF_ULONGLONG(0xa70c3c40a64e6c51),  // 1e54
+    PROTOBUF_ULONGLONG(0xd0cf4b50cfe20765),  // 1e55
+    PROTOBUF_ULONGLONG(0x82818f1281ed449f),  // 1e56
+    PROTOBUF_ULONGLONG(0xa321f2d7226895c7),  // 1e57
+    PROTOBUF_ULONGLONG(0xcbea6f8ceb02bb39),  // 1e58
+    PROTOBUF_ULONGLONG(0xfee50b7025c36a08),  // 1e59
+    PROTOBUF_ULONGLONG(0x9f4f2726179a2245),  // 1e60
+    PROTOBUF_ULONGLONG(0xc722f0ef9d80aad6),  // 1e61
+    PROTOBUF_ULONGLONG(0xf8ebad2b84e0d58b),  // 1e62
+    PROTOBUF_ULONGLONG(0x9b934c3b330c8577),  // 1e63
+    PROTOBUF_ULONGLONG(0xc2781f49ffcfa6d5),  // 1e64
+    PROTOBUF_ULONGLONG(0xf316271c7fc3908a),  // 1e65
+    PROTOBUF_ULONGLONG(0x97edd871cfda3a56),  // 1e66
+    PROTOBUF_ULONGLONG(0xbde94e8e43d0c8ec),  // 1e67
+    PROTOBUF_ULONGLONG(0xed63a231d4c4fb27),  // 1e68
+    PROTOBUF_ULONGLONG(0x945e455f24fb1cf8),  // 1e69
+    PROTOBUF_ULONGLONG(0xb975d6b6ee39e436),  // 1e70
+    PROTOBUF_ULONGLONG(0xe7d34c64a9c85d44),  // 1e71
+    PROTOBUF_ULONGLONG(0x90e40fbeea1d3a4a),  // 1e72
+    PROTOBUF_ULONGLONG(0xb51d13aea4a488dd),  // 1e73
+    PROTOBUF_ULONGLONG(0xe264589a4dcdab14),  // 1e74
+    PROTOBUF_ULONGLONG(0x8d7eb76070a08aec),  // 1e75
+    PROTOBUF_ULONGLONG(0xb0de65388cc8ada8),  // 1e76
+    PROTOBUF_ULONGLONG(0xdd15fe86affad912),  // 1e77
+    PROTOBUF_ULONGLONG(0x8a2dbf142dfcc7ab),  // 1e78
+    PROTOBUF_ULONGLONG(0xacb92ed9397bf996),  // 1e79
+    PROTOBUF_ULONGLONG(0xd7e77a8f87daf7fb),  // 1e80
+    PROTOBUF_ULONGLONG(0x86f0ac99b4e8dafd),  // 1e81
+    PROTOBUF_ULONGLONG(0xa8acd7c0222311bc),  // 1e82
+    PROTOBUF_ULONGLONG(0xd2d80db02aabd62b),  // 1e83
+    PROTOBUF_ULONGLONG(0x83c7088e1aab65db),  // 1e84
+    PROTOBUF_ULONGLONG(0xa4b8cab1a1563f52),  // 1e85
+    PROTOBUF_ULONGLONG(0xcde6fd5e09abcf26),  // 1e86
+    PROTOBUF_ULONGLONG(0x80b05e5ac60b6178),  // 1e87
+    PROTOBUF_ULONGLONG(0xa0dc75f1778e39d6),  // 1e88
+    PROTOBUF_ULONGLONG(0xc913936dd571c84c),  // 1e89
+    PROTOBUF_ULONGLONG(0xfb5878494ace3a5f),  // 1e90
+    PROTOBUF_ULONGLONG(0x9d174b2dcec0e47b),  // 1e91
+    PROTOBUF_ULONGLONG(0xc45d1df942711d9a),  // 1e92
+    PROTOBUF_ULONGLONG(0xf5746577930d6500),  // 1e93
+    PROTOBUF_ULONGLONG(0x9968bf6abbe85f20),  // 1e94
+    PROTOBUF_ULONGLONG(0xbfc2ef456ae276e8),  // 1e95
+    PROTOBUF_ULONGLONG(0xefb3ab16c59b14a2),  // 1e96
+    PROTOBUF_ULONGLONG(0x95d04aee3b80ece5),  // 1e97
+    PROTOBUF_ULONGLONG(0xbb445da9ca61281f),  // 1e98
+    PROTOBUF_ULONGLONG(0xea1575143cf97226),  // 1e99
+    PROTOBUF_ULONGLONG(0x924d692ca61be758),  // 1e100
+    PROTOBUF_ULONGLONG(0xb6e0c377cfa2e12e),  // 1e101
+    PROTOBUF_ULONGLONG(0xe498f455c38b997a),  // 1e102
+    PROTOBUF_ULONGLONG(0x8edf98b59a373fec),  // 1e103
+    PROTOBUF_ULONGLONG(0xb2977ee300c50fe7),  // 1e104
+    PROTOBUF_ULONGLONG(0xdf3d5e9bc0f653e1),  // 1e105
+    PROTOBUF_ULONGLONG(0x8b865b215899f46c),  // 1e106
+    PROTOBUF_ULONGLONG(0xae67f1e9aec07187),  // 1e107
+    PROTOBUF_ULONGLONG(0xda01ee641a708de9),  // 1e108
+    PROTOBUF_ULONGLONG(0x884134fe908658b2),  // 1e109
+    PROTOBUF_ULONGLONG(0xaa51823e34a7eede),  // 1e110
+    PROTOBUF_ULONGLONG(0xd4e5e2cdc1d1ea96),  // 1e111
+    PROTOBUF_ULONGLONG(0x850fadc09923329e),  // 1e112
+    PROTOBUF_ULONGLONG(0xa6539930bf6bff45),  // 1e113
+    PROTOBUF_ULONGLONG(0xcfe87f7cef46ff16),  // 1e114
+    PROTOBUF_ULONGLONG(0x81f14fae158c5f6e),  // 1e115
+    PROTOBUF_ULONGLONG(0xa26da3999aef7749),  // 1e116
+    PROTOBUF_ULONGLONG(0xcb090c8001ab551c),  // 1e117
+    PROTOBUF_ULONGLONG(0xfdcb4fa002162a63),  // 1e118
+    PROTOBUF_ULONGLONG(0x9e9f11c4014dda7e),  // 1e119
+    PROTOBUF_ULONGLONG(0xc646d63501a1511d),  // 1e120
+    PROTOBUF_ULONGLONG(0xf7d88bc24209a565),  // 1e121
+    PROTOBUF_ULONGLONG(0x9ae757596946075f),  // 1e122
+    PROTOBUF_ULONGLONG(0xc1a12d2fc3978937),  // 1e123
+    PROTOBUF_ULONGLONG(0xf209787bb47d6b84),  // 1e124
+    PROTOBUF_ULONGLONG(0x9745eb4d50ce6332),  // 1e125
+    PROTOBUF_ULONGLONG(0xbd176620a501fbff),  // 1e126
+    PROTOBUF_ULONGLONG(0xec5d3fa8ce427aff),  // 1e127
+    PROTOBUF_ULONGLONG(0x93ba47c980e98cdf),  // 1e128
+    PROTOBUF_ULONGLONG(0xb8a8d9bbe123f017),  // 1e129
+    PROTOBUF_ULONGLONG(0xe6d3102ad96cec1d),  // 1e130
+    PROTOBUF_ULONGLONG(0x9043ea1ac7e41392),  // 1e131
+    PROTOBUF_ULONGLONG(0xb454e4a179dd1877),  // 1e132
+    PROTOBUF_ULONGLONG(0xe16a1dc9d8545e94),  // 1e133
+    PROTOBUF_ULONGLONG(0x8ce2529e2734bb1d),  // 1e134
+    PROTOBUF_ULONGLONG(0xb01ae745b101e9e4),  // 1e135
+    PROTOBUF_ULONGLONG(0xdc21a1171d42645d),  // 1e136
+    PROTOBUF_ULONGLONG(0x899504ae72497eba),  // 1e137
+    PROTOBUF_ULONGLONG(0xabfa45da0edbde69),  // 1e138
+    PROTOBUF_ULONGLONG(0xd6f8d7509292d603),  // 1e139
+    PROTOBUF_ULONGLONG(0x865b86925b9bc5c2),  // 1e140
+    PROTOBUF_ULONGLONG(0xa7f26836f282b732),  // 1e141
+    PROTOBUF_ULONGLONG(0xd1ef0244af2364ff),  // 1e142
+    PROTOBUF_ULONGLONG(0x8335616aed761f1f),  // 1e143
+    PROTOBUF_ULONGLONG(0xa402b9c5a8d3a6e7),  // 1e144
+    PROTOBUF_ULONGLONG(0xcd036837130890a1),  // 1e145
+    PROTOBUF_ULONGLONG(0x802221226be55a64),  // 1e146
+    PROTOBUF_ULONGLONG(0xa02aa96b06deb0fd),  // 1e147
+    PROTOBUF_ULONGLONG(0xc83553c5c8965d3d),  // 1e148
+    PROTOBUF_ULONGLONG(0xfa42a8b73abbf48c),  // 1e149
+    PROTOBUF_ULONGLONG(0x9c69a97284b578d7),  // 1e150
+    PROTOBUF_ULONGLONG(0xc38413cf25e2d70d),  // 1e151
+    PROTOBUF_ULONGLONG(0xf46518c2ef5b8cd1),  // 1e152
+    PROTOBUF_ULONGLONG(0x98bf2f79d5993802),  // 1e153
+    PROTOBUF_ULONGLONG(0xbeeefb584aff8603),  // 1e154
+    PROTOBUF_ULONGLONG(0xeeaaba2e5dbf6784),  // 1e155
+    PROTOBUF_ULONGLONG(0x952ab45cfa97a0b2),  // 1e156
+    PROTOBUF_ULONGLONG(0xba756174393d88df),  // 1e157
+    PROTOBUF_ULONGLONG(0xe912b9d1478ceb17),  // 1e158
+    PROTOBUF_ULONGLONG(0x91abb422ccb812ee),  // 1e159
+    PROTOBUF_ULONGLONG(0xb616a12b7fe617aa),  // 1e160
+    PROTOBUF_ULONGLONG(0xe39c49765fdf9d94),  // 1e161
+    PROTOBUF_ULONGLONG(0x8e41ade9fbebc27d),  // 1e162
+    PROTOBUF_ULONGLONG(0xb1d219647ae6b31c),  // 1e163
+    PROTOBUF_ULONGLONG(0xde469fbd99a05fe3),  // 1e164
+    PROTOBUF_ULONGLONG(0x8aec23d680043bee),  // 1e165
+    PROTOBUF_ULONGLONG(0xada72ccc20054ae9),  // 1e166
+    PROTOBUF_ULONGLONG(0xd910f7ff28069da4),  // 1e167
+    PROTOBUF_ULONGLONG(0x87aa9aff79042286),  // 1e168
+    PROTOBUF_ULONGLONG(0xa99541bf57452b28),  // 1e169
+    PROTOBUF_ULONGLONG(0xd3fa922f2d1675f2),  // 1e170
+    PROTOBUF_ULONGLONG(0x847c9b5d7c2e09b7),  // 1e171
+    PROTOBUF_ULONGLONG(0xa59bc234db398c25),  // 1e172
+    PROTOBUF_ULONGLONG(0xcf02b2c21207ef2e),  // 1e173
+    PROTOBUF_ULONGLONG(0x8161afb94b44f57d),  // 1e174
+    PROTOBUF_ULONGLONG(0xa1ba1ba79e1632dc),  // 1e175
+    PROTOBUF_ULONGLONG(0xca28a291859bbf93),  // 1e176
+    PROTOBUF_ULONGLONG(0xfcb2cb35e702af78),  // 1e177
+    PROTOBUF_ULONGLONG(0x9defbf01b061adab),  // 1e178
+    PROTOBUF_ULONGLONG(0xc56baec21c7a1916),  // 1e179
+    PROTOBUF_ULONGLONG(0xf6c69a72a3989f5b),  // 1e180
+    PROTOBUF_ULONGLONG(0x9a3c2087a63f6399),  // 1e181
+    PROTOBUF_ULONGLONG(0xc0cb28a98fcf3c7f),  // 1e182
+    PROTOBUF_ULONGLONG(0xf0fdf2d3f3c30b9f),  // 1e183
+    PROTOBUF_ULONGLONG(0x969eb7c47859e743),  // 1e184
+    PROTOBUF_ULONGLONG(0xbc4665b596706114),  // 1e185
+    PROTOBUF_ULONGLONG(0xeb57ff22fc0c7959),  // 1e186
+    PROTOBUF_ULONGLONG(0x9316ff75dd87cbd8),  // 1e187
+    PROTOBUF_ULONGLONG(0xb7dcbf5354e9bece),  // 1e188
+    PROTOBUF_ULONGLONG(0xe5d3ef282a242e81),  // 1e189
+    PROTOBUF_ULONGLONG(0x8fa475791a569d10),  // 1e190
+    PROTOBUF_ULONGLONG(0xb38d92d760ec4455),  // 1e191
+    PROTOBUF_ULONGLONG(0xe070f78d3927556a),  // 1e192
+    PROTOBUF_ULONGLONG(0x8c469ab843b89562),  // 1e193
+    PROTOBUF_ULONGLONG(0xaf58416654a6babb),  // 1e194
+    PROTOBUF_ULONGLONG(0xdb2e51bfe9d0696a),  // 1e195
+    PROTOBUF_ULONGLONG(0x88fcf317f22241e2),  // 1e196
+    PROTOBUF_ULONGLONG(0xab3c2fddeeaad25a),  // 1e197
+    PROTOBUF_ULONGLONG(0xd60b3bd56a5586f1),  // 1e198
+    PROTOBUF_ULONGLONG(0x85c7056562757456),  // 1e199
+    PROTOBUF_ULONGLONG(0xa738c6bebb12d16c),  // 1e200
+    PROTOBUF_ULONGLONG(0xd106f86e69d785c7),  // 1e201
+    PROTOBUF_ULONGLONG(0x82a45b450226b39c),  // 1e202
+    PROTOBUF_ULONGLONG(0xa34d721642b06084),  // 1e203
+    PROTOBUF_ULONGLONG(0xcc20ce9bd35c78a5),  // 1e204
+    PROTOBUF_ULONGLONG(0xff290242c83396ce),  // 1e205
+    PROTOBUF_ULONGLONG(0x9f79a169bd203e41),  // 1e206
+    PROTOBUF_ULONGLONG(0xc75809c42c684dd1),  // 1e207
+    PROTOBUF_ULONGLONG(0xf92e0c3537826145),  // 1e208
+    PROTOBUF_ULONGLONG(0x9bbcc7a142b17ccb),  // 1e209
+    PROTOBUF_ULONGLONG(0xc2abf989935ddbfe),  // 1e210
+    PROTOBUF_ULONGLONG(0xf356f7ebf83552fe),  // 1e211
+    PROTOBUF_ULONGLONG(0x98165af37b2153de),  // 1e212
+    PROTOBUF_ULONGLONG(0xbe1bf1b059e9a8d6),  // 1e213
+    PROTOBUF_ULONGLONG(0xeda2ee1c7064130c),  // 1e214
+    PROTOBUF_ULONGLONG(0x9485d4d1c63e8be7),  // 1e215
+    PROTOBUF_ULONGLONG(0xb9a74a0637ce2ee1),  // 1e216
+    PROTOBUF_ULONGLONG(0xe8111c87c5c1ba99),  // 1e217
+    PROTOBUF_ULONGLONG(0x910ab1d4db9914a0),  // 1e218
+    PROTOBUF_ULONGLONG(0xb54d5e4a127f59c8),  // 1e219
+    PROTOBUF_ULONGLONG(0xe2a0b5dc971f303a),  // 1e220
+    PROTOBUF_ULONGLONG(0x8da471a9de737e24),  // 1e221
+    PROTOBUF_ULONGLONG(0xb10d8e1456105dad),  // 1e222
+    PROTOBUF_ULONGLONG(0xdd50f1996b947518),  // 1e223
+    PROTOBUF_ULONGLONG(0x8a5296ffe33cc92f),  // 1e224
+    PROTOBUF_ULONGLONG(0xace73cbfdc0bfb7b),  // 1e225
+    PROTOBUF_ULONGLONG(0xd8210befd30efa5a),  // 1e226
+    PROTOBUF_ULONGLONG(0x8714a775e3e95c78),  // 1e227
+    PROTOBUF_ULONGLONG(0xa8d9d1535ce3b396),  // 1e228
+    PROTOBUF_ULONGLONG(0xd31045a8341ca07c),  // 1e229
+    PROTOBUF_ULONGLONG(0x83ea2b892091e44d),  // 1e230
+    PROTOBUF_ULONGLONG(0xa4e4b66b68b65d60),  // 1e231
+    PROTOBUF_ULONGLONG(0xce1de40642e3f4b9),  // 1e232
+    PROTOBUF_ULONGLONG(0x80d2ae83e9ce78f3),  // 1e233
+    PROTOBUF_ULONGLONG(0xa1075a24e4421730),  // 1e234
+    PROTOBUF_ULONGLONG(0xc94930ae1d529cfc),  // 1e235
+    PROTOBUF_ULONGLONG(0xfb9b7cd9a4a7443c),  // 1e236
+    PROTOBUF_ULONGLONG(0x9d412e0806e88aa5),  // 1e237
+    PROTOBUF_ULONGLONG(0xc491798a08a2ad4e),  // 1e238
+    PROTOBUF_ULONGLONG(0xf5b5d7ec8acb58a2),  // 1e239
+    PROTOBUF_ULONGLONG(0x9991a6f3d6bf1765),  // 1e240
+    PROTOBUF_ULONGLONG(0xbff610b0cc6edd3f),  // 1e241
+    PROTOBUF_ULONGLONG(0xeff394dcff8a948e),  // 1e242
+    PROTOBUF_ULONGLONG(0x95f83d0a1fb69cd9),  // 1e243
+    PROTOBUF_ULONGLONG(0xbb764c4ca7a4440f),  // 1e244
+    PROTOBUF_ULONGLONG(0xea53df5fd18d5513),  // 1e245
+    PROTOBUF_ULONGLONG(0x92746b9be2f8552c),  // 1e246
+    PROTOBUF_ULONGLONG(0xb7118682dbb66a77),  // 1e247
+    PROTOBUF_ULONGLONG(0xe4d5e82392a40515),  // 1e248
+    PROTOBUF_ULONGLONG(0x8f05b1163ba6832d),  // 1e249
+    PROTOBUF_ULONGLONG(0xb2c71d5bca9023f8),  // 1e250
+    PROTOBUF_ULONGLONG(0xdf78e4b2bd342cf6),  // 1e251
+    PROTOBUF_ULONGLONG(0x8bab8eefb6409c1a),  // 1e252
+    PROTOBUF_ULONGLONG(0xae9672aba3d0c320),  // 1e253
+    PROTOBUF_ULONGLONG(0xda3c0f568cc4f3e8),  // 1e254
+    PROTOBUF_ULONGLONG(0x8865899617fb1871),  // 1e255
+    PROTOBUF_ULONGLONG(0xaa7eebfb9df9de8d),  // 1e256
+    PROTOBUF_ULONGLONG(0xd51ea6fa85785631),  // 1e257
+    PROTOBUF_ULONGLONG(0x8533285c936b35de),  // 1e258
+    PROTOBUF_ULONGLONG(0xa67ff273b8460356),  // 1e259
+    PROTOBUF_ULONGLONG(0xd01fef10a657842c),  // 1e260
+    PROTOBUF_ULONGLONG(0x8213f56a67f6b29b),  // 1e261
+    PROTOBUF_ULONGLONG(0xa298f2c501f45f42),  // 1e262
+    PROTOBUF_ULONGLONG(0xcb3f2f7642717713),  // 1e263
+    PROTOBUF_ULONGLONG(0xfe0efb53d30dd4d7),  // 1e264
+    PROTOBUF_ULONGLONG(0x9ec95d1463e8a506),  // 1e265
+    PROTOBUF_ULONGLONG(0xc67bb4597ce2ce48),  // 1e266
+    PROTOBUF_ULONGLONG(0xf81aa16fdc1b81da),  // 1e267
+    PROTOBUF_ULONGLONG(0x9b10a4e5e9913128),  // 1e268
+    PROTOBUF_ULONGLONG(0xc1d4ce1f63f57d72),  // 1e269
+    PROTOBUF_ULONGLONG(0xf24a01a73cf2dccf),  // 1e270
+    PROTOBUF_ULONGLONG(0x976e41088617ca01),  // 1e271
+    PROTOBUF_ULONGLONG(0xbd49d14aa79dbc82),  // 1e272
+    PROTOBUF_ULONGLONG(0xec9c459d51852ba2),  // 1e273
+    PROTOBUF_ULONGLONG(0x93e1ab8252f33b45),  // 1e274
+    PROTOBUF_ULONGLONG(0xb8da1662e7b00a17),  // 1e275
+    PROTOBUF_ULONGLONG(0xe7109bfba19c0c9d),  // 1e276
+    PROTOBUF_ULONGLONG(0x906a617d450187e2),  // 1e277
+    PROTOBUF_ULONGLONG(0xb484f9dc9641e9da),  // 1e278
+    PROTOBUF_ULONGLONG(0xe1a63853bbd26451),  // 1e279
+    PROTOBUF_ULONGLONG(0x8d07e33455637eb2),  // 1e280
+    PROTOBUF_ULONGLONG(0xb049dc016abc5e5f),  // 1e281
+    PROTOBUF_ULONGLONG(0xdc5c5301c56b75f7),  // 1e282
+    PROTOBUF_ULONGLONG(0x89b9b3e11b6329ba),  // 1e283
+    PROTOBUF_ULONGLONG(0xac2820d9623bf429),  // 1e284
+    PROTOBUF_ULONGLONG(0xd732290fbacaf133),  // 1e285
+    PROTOBUF_ULONGLONG(0x867f59a9d4bed6c0),  // 1e286
+    PROTOBUF_ULONGLONG(0xa81f301449ee8c70),  // 1e287
+    PROTOBUF_ULONGLONG(0xd226fc195c6a2f8c),  // 1e288
+    PROTOBUF_ULONGLONG(0x83585d8fd9c25db7),  // 1e289
+    PROTOBUF_ULONGLONG(0xa42e74f3d032f525),  // 1e290
+    PROTOBUF_ULONGLONG(0xcd3a1230c43fb26f),  // 1e291
+    PROTOBUF_ULONGLONG(0x80444b5e7aa7cf85),  // 1e292
+    PROTOBUF_ULONGLONG(0xa0555e361951c366),  // 1e293
+    PROTOBUF_ULONGLONG(0xc86ab5c39fa63440),  // 1e294
+    PROTOBUF_ULONGLONG(0xfa856334878fc150),  // 1e295
+    PROTOBUF_ULONGLONG(0x9c935e00d4b9d8d2),  // 1e296
+    PROTOBUF_ULONGLONG(0xc3b8358109e84f07),  // 1e297
+    PROTOBUF_ULONGLONG(0xf4a642e14c6262c8),  // 1e298
+    PROTOBUF_ULONGLONG(0x98e7e9cccfbd7dbd),  // 1e299
+    PROTOBUF_ULONGLONG(0xbf21e44003acdd2c),  // 1e300
+    PROTOBUF_ULONGLONG(0xeeea5d5004981478),  // 1e301
+    PROTOBUF_ULONGLONG(0x95527a5202df0ccb),  // 1e302
+    PROTOBUF_ULONGLONG(0xbaa718e68396cffd),  // 1e303
+    PROTOBUF_ULONGLONG(0xe950df20247c83fd),  // 1e304
+    PROTOBUF_ULONGLONG(0x91d28b7416cdd27e),  // 1e305
+    PROTOBUF_ULONGLONG(0xb6472e511c81471d),  // 1e306
+    PROTOBUF_ULONGLONG(0xe3d8f9e563a198e5),  // 1e307
+    PROTOBUF_ULONGLONG(0x8e679c2f5e44ff8f),  // 1e308
+    PROTOBUF_ULONGLONG(0xb201833b35d63f73),  // 1e309
+    PROTOBUF_ULONGLONG(0xde81e40a034bcf4f),  // 1e310
+    PROTOBUF_ULONGLONG(0x8b112e86420f6191),  // 1e311
+    PROTOBUF_ULONGLONG(0xadd57a27d29339f6),  // 1e312
+    PROTOBUF_ULONGLONG(0xd94ad8b1c7380874),  // 1e313
+    PROTOBUF_ULONGLONG(0x87cec76f1c830548),  // 1e314
+    PROTOBUF_ULONGLONG(0xa9c2794ae3a3c69a),  // 1e315
+    PROTOBUF_ULONGLONG(0xd433179d9c8cb841),  // 1e316
+    PROTOBUF_ULONGLONG(0x849feec281d7f328),  // 1e317
+    PROTOBUF_ULONGLONG(0xa5c7ea73224deff3),  // 1e318
+    PROTOBUF_ULONGLONG(0xcf39e50feae16bef),  // 1e319
+    PROTOBUF_ULONGLONG(0x81842f29f2cce375),  // 1e320
+    PROTOBUF_ULONGLONG(0xa1e53af46f801c53),  // 1e321
+    PROTOBUF_ULONGLONG(0xca5e89b18b602368),  // 1e322
+    PROTOBUF_ULONGLONG(0xfcf62c1dee382c42),  // 1e323
+    PROTOBUF_ULONGLONG(0x9e19db92b4e31ba9),  // 1e324
+    PROTOBUF_ULONGLONG(0xc5a05277621be293),  // 1e325
+    PROTOBUF_ULONGLONG(0xf70867153aa2db38),  // 1e326
+    PROTOBUF_ULONGLONG(0x9a65406d44a5c903),  // 1e327
+    PROTOBUF_ULONGLONG(0xc0fe908895cf3b44),  // 1e328
+    PROTOBUF_ULONGLONG(0xf13e34aabb430a15),  // 1e329
+    PROTOBUF_ULONGLONG(0x96c6e0eab509e64d),  // 1e330
+    PROTOBUF_ULONGLONG(0xbc789925624c5fe0),  // 1e331
+    PROTOBUF_ULONGLONG(0xeb96bf6ebadf77d8),  // 1e332
+    PROTOBUF_ULONGLONG(0x933e37a534cbaae7),  // 1e333
+    PROTOBUF_ULONGLONG(0xb80dc58e81fe95a1),  // 1e334
+    PROTOBUF_ULONGLONG(0xe61136f2227e3b09),  // 1e335
+    PROTOBUF_ULONGLONG(0x8fcac257558ee4e6),  // 1e336
+    PROTOBUF_ULONGLONG(0xb3bd72ed2af29e1f),  // 1e337
+    PROTOBUF_ULONGLONG(0xe0accfa875af45a7),  // 1e338
+    PROTOBUF_ULONGLONG(0x8c6c01c9498d8b88),  // 1e339
+    PROTOBUF_ULONGLONG(0xaf87023b9bf0ee6a),  // 1e340
+    PROTOBUF_ULONGLONG(0xdb68c2ca82ed2a05),  // 1e341
+    PROTOBUF_ULONGLONG(0x892179be91d43a43),  // 1e342
+    PROTOBUF_ULONGLONG(0xab69d82e364948d4),  // 1e343
+    PROTOBUF_ULONGLONG(0xd6444e39c3db9b09),  // 1e344
+    PROTOBUF_ULONGLONG(0x85eab0e41a6940e5),  // 1e345
+    PROTOBUF_ULONGLONG(0xa7655d1d2103911f),  // 1e346
+    PROTOBUF_ULONGLONG(0xd13eb46469447567),  // 1e347
+};
+
+// Sets *high and *low to the 128-bit product of x and y.
+inline void Multiply64(uint64 x, uint64 y, uint64* high, uint64* low) {
+  const uint64 kMask32 = 0xFFFFFFFFu;
+  const uint64 x_lo = x & kMask32;
+  const uint64 x_hi = x >> 32;
+  const uint64 y_lo = y & kMask32;
+  const uint64 y_hi = y >> 32;
+  const uint64 lo_lo = x_lo * y_lo;
+  const uint64 hi_lo = x_hi * y_lo;
+  const uint64 lo_hi = x_lo * y_hi;
+  const uint64 hi_hi = x_hi * y_hi;
+  const uint64 cross = (lo_lo >> 32) + (hi_lo & kMask32) + lo_hi;
+  *high = hi_hi + (hi_lo >> 32) + (cross >> 32);
+  *low = (cross << 32) | (lo_lo & kMask32);
+}
+
+// Converts mantissa * 10^exponent to the nearest double with the algorithm of
+// Eisel and Lemire ("Number Parsing at a Gigabyte per Second"). Returns false
+// if the result is not a normal double, or if 64 bits of the power of ten are
+// not enough to tell which way to round; the caller then has to fall back to
+// an arbitrary precision conversion.
+bool EiselLemire(uint64 mantissa, int exponent, double* value) {
+  if (mantissa == 0) {
+    *value = 0;
+    return true;
+  }
+  if (exponent < kMinPowerOfTen || exponent > kMaxPowerOfTen) return false;
+
+  const int leading_zeros = 63 - Bits::Log2FloorNonZero64(mantissa);
+  mantissa <<= leading_zeros;
+  // 217706 / 2^16 approximates log2(10).
+  int64 binary_exponent = ((217706 * static_cast<int64>(exponent)) >> 16) +
+                          64 + 1023 - leading_zeros;
+
+  uint64 high, low;
+  Multiply64(mantissa, kPowersOfTen[exponent - kMinPowerOfTen], &high, &low);
+  // The lower bits of the power of ten could carry into the bits we keep.
+  if ((high & 0x1FF) == 0x1FF && low + mantissa < mantissa) return false;
+
+  const uint64 top_bit = high >> 63;
+  uint64 result = high >> (top_bit + 9);
+  binary_exponent -= 1 ^ top_bit;
+
+  // Exactly halfway between two doubles, or maybe only almost.
+  if (low == 0 && (high & 0x1FF) == 0 && (result & 3) == 1) return false;
+
+  // Round to 53 bits.
+  result += result & 1;
+  result >>= 1;
+  if (result >> 53 != 0) {
+    result >>= 1;
+    ++binary_exponent;
+  }
+  // Subnormal numbers, infinities and zero are left to strtod().
+  if (binary_exponent <= 0 || binary_exponent >= 0x7FF) return false;
+
+  const uint64 bits = (static_cast<uint64>(binary_exponent) << 52) |
+                      (result & ((static_cast<uint64>(1) << 52) - 1));
+  memcpy(value, &bits, sizeof(bits));
+  return true;
+}
+
+// Parses a number of the form [+-]digits[.digits][(e|E)[+-]digits] at the
+// start of [begin, end), without needing the number to be followed by a NUL.
+// Returns false without parsing anything if the text is something else that
+// strtod() accepts, like leading whitespace, hexadecimal or "inf", or if the
+// value cannot be computed exactly with EiselLemire().
+bool ParseDecimal(const char* begin, const char* end, double* value,
+                  const char** number_end) {
+  const char* p = begin;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    ++p;
+  }
+  if (end - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+    return false;
+  }
+
+  // Up to 19 significant digits fit in the mantissa; further digits are
+  // only counted.
+  uint64 mantissa = 0;
+  int significant_digits = 0;
+  int64 exponent = 0;
+  bool truncated = false;
+  bool any_digits = false;
+  for (; p < end && '0' <= *p && *p <= '9'; ++p) {
+    any_digits = true;
+    if (significant_digits < 19) {
+      mantissa = mantissa * 10 + (*p - '0');
+      if (mantissa != 0) ++significant_digits;
+    } else {
+      truncated |= *p != '0';
+      ++exponent;
+    }
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    for (; p < end && '0' <= *p && *p <= '9'; ++p) {
+      any_digits = true;
+      if (significant_digits < 19) {
+        mantissa = mantissa * 10 + (*p - '0');
+        if (mantissa != 0) ++significant_digits;
+        --exponent;
+      } else {
+        truncated |= *p != '0';
+      }
+    }
+  }
+  if (!any_digits) return false;
+
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    bool negative_exponent = false;
+    if (q < end && (*q == '-' || *q == '+')) {
+      negative_exponent = *q == '-';
+      ++q;
+    }
+    if (q < end && '0' <= *q && *q <= '9') {
+      int64 explicit_exponent = 0;
+      for (; q < end && '0' <= *q && *q <= '9'; ++q) {
+        // Anything this large over- or underflows anyway.
+        if (explicit_exponent < 100000) {
+          explicit_exponent = explicit_exponent * 10 + (*q - '0');
+        }
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+      p = q;
+    }
+  }
+
+  double result;
+  if (mantissa == 0) {
+    result = 0;
+  } else if (exponent < kMinPowerOfTen || exponent > kMaxPowerOfTen) {
+    return false;
+  } else if (!EiselLemire(mantissa, static_cast<int>(exponent), &result)) {
+    return false;
+  } else if (truncated) {
+    // The digits we dropped put the value between mantissa and mantissa + 1
+    // times the power of ten; both have to round to the same double.
+    double upper;
+    if (!EiselLemire(mantissa + 1, static_cast<int>(exponent), &upper) ||
+        upper != result) {
+      return false;
+    }
+  }
+  *value = negative ? -result : result;
+  *number_end = p;
+  return true;
+}
+
 // Returns a string identical to *input except that the character pointed to
 // by radix_pos (which should be '.') is replaced with the locale-specific
 // radix character.
@@ -76,6 +933,18 @@ std::string LocalizeRadix(const char* input, const char* radix_pos) {
 }  // namespace
 
 double NoLocaleStrtod(const char* text, char** original_endptr) {
+  // Plain decimal numbers, which are almost all we see, are parsed by
+  // ourselves without calling into the C library.
+  double result;
+  const char* number_end;
+  if (ParseDecimal(text, text + strlen(text), &result, &number_end)) {
+    // const_cast is necessary to match the strtod() interface.
+    if (original_endptr != NULL) {
+      *original_endptr = const_cast<char*>(number_end);
+    }
+    return result;
+  }
+
   // We cannot simply set the locale to "C" temporarily with setlocale()
   // as this is not thread-safe.  Instead, we try to parse in the current
   // locale first.  If parsing stops at a '.' character, then this is a
@@ -83,7 +952,7 @@ double NoLocaleStrtod(const char* text, char** original_endptr) {
   // '.' is not the radix character.
 
   char* temp_endptr;
-  double result = strtod(text, &temp_endptr);
+  result = strtod(text, &temp_endptr);
   if (original_endptr != NULL) *original_endptr = temp_endptr;
   if (*temp_endptr != '.') return result;
 
@@ -110,6 +979,19 @@ double NoLocaleStrtod(const char* text, char** original_endptr) {
   return result;
 }
 
+size_t NoLocaleStrtod(StringPiece text, double* value) {
+  const char* number_end;
+  if (ParseDecimal(text.data(), text.data() + text.size(), value,
+                   &number_end)) {
+    return number_end - text.data();
+  }
+  // Rare: let strtod() handle it, which needs a NUL-terminated copy.
+  const std::string copy = text.ToString();
+  char* copy_end;
+  *value = NoLocaleStrtod(copy.c_str(), &copy_end);
+  return copy_end - copy.c_str();
+}
+
 float SafeDoubleToFloat(double value) {
   if (value > std::numeric_limits<float>::max()) {
     return std::numeric_limits<float>::infinity();
@@ -123,3 +1005,5 @@ float SafeDoubleToFloat(double value) {
 }  // namespace io
 }  // namespace protobuf
 }  // namespace google
+
+#include <google/protobuf/port_undef.inc>
@@ -35,6 +35,10 @@
 #ifndef GOOGLE_PROTOBUF_IO_STRTOD_H__
 #define GOOGLE_PROTOBUF_IO_STRTOD_H__
 
+#include <stddef.h>
+
+#include <google/protobuf/stubs/stringpiece.h>
+
 namespace google {
 namespace protobuf {
 namespace io {
@@ -43,6 +47,11 @@ namespace io {
 // uses a dot as the decimal separator.
 double NoLocaleStrtod(const char* str, char** endptr);
 
+// Like the above, but parses the number at the start of "str", which does
+// not need to be NUL-terminated, into *value. Returns the number of
+// characters parsed, or 0 if "str" does not start with a number.
+size_t NoLocaleStrtod(StringPiece str, double* value);
+
 // Casts a double value to a float value. If the value is outside of the
 // representable range of float, it will be converted to positive or negative
 // infinity.
@@ -770,6 +770,18 @@ TEST_F(TokenizerTest, ParseFloat) {
   EXPECT_DOUBLE_EQ(1.2  , Tokenizer::ParseFloat("1.2"));
   EXPECT_DOUBLE_EQ(1.e2 , Tokenizer::ParseFloat("1.e2"));
 
+  // These must be correctly rounded, not just close.
+  EXPECT_EQ(0.1, Tokenizer::ParseFloat("0.1"));
+  EXPECT_EQ(1e23, Tokenizer::ParseFloat("1e23"));
+  EXPECT_EQ(9007199254740992.0, Tokenizer::ParseFloat("9007199254740993"));
+  EXPECT_EQ(2.2250738585072014e-308,
+            Tokenizer::ParseFloat("2.2250738585072014e-308"));
+  EXPECT_EQ(1.7976931348623157e308,
+            Tokenizer::ParseFloat("1.7976931348623157e308"));
+  EXPECT_EQ(4.9e-324, Tokenizer::ParseFloat("4.9e-324"));
+  EXPECT_EQ(1.2345678901234567,
+            Tokenizer::ParseFloat("1.23456789012345678901234567890"));
+
   // Test invalid integers that may still be tokenized as integers.
   EXPECT_DOUBLE_EQ(1, Tokenizer::ParseFloat("1e"));
   EXPECT_DOUBLE_EQ(1, Tokenizer::ParseFloat("1e-"));
@@ -93,6 +93,21 @@ void MapFieldBase::SetRepeatedDirty() {
 
 void* MapFieldBase::MutableRepeatedPtrField() const { return repeated_field_; }
 
+Message* MapFieldBase::AddRepeatedEntry(const Message& prototype) const {
+  RepeatedPtrFieldBase* repeated_field =
+      reinterpret_cast<RepeatedPtrFieldBase*>(repeated_field_);
+  Message* entry =
+      repeated_field->AddFromCleared<GenericTypeHandler<Message> >();
+  if (entry == NULL) {
+    // The entry is created on the repeated field's arena, so it can be added
+    // without a copy.
+    entry = prototype.New(arena_);
+    repeated_field->UnsafeArenaAddAllocated<GenericTypeHandler<Message> >(
+        entry);
+  }
+  return entry;
+}
+
 void MapFieldBase::SyncRepeatedFieldWithMap() const {
   // acquire here matches with release below to ensure that we can only see a
   // value of CLEAN after all previous changes have been synced.
@@ -375,12 +390,13 @@ void DynamicMapField::SyncRepeatedFieldWithMapNoLock() const {
     }
   }
 
+  // Entries are cleared rather than deleted, so that they are reused below.
   MapFieldBase::repeated_field_->Clear();
+  MapFieldBase::repeated_field_->Reserve(static_cast<int>(map_.size()));
 
   for (Map<MapKey, MapValueRef>::const_iterator it = map_.begin();
        it != map_.end(); ++it) {
-    Message* new_entry = default_entry_->New();
-    MapFieldBase::repeated_field_->AddAllocated(new_entry);
+    Message* new_entry = AddRepeatedEntry(*default_entry_);
     const MapKey& map_key = it->first;
     switch (key_des->cpp_type()) {
       case FieldDescriptor::CPPTYPE_STRING:
@@ -140,6 +140,11 @@ class PROTOBUF_EXPORT MapFieldBase {
   // Provides derived class the access to repeated field.
   void* MutableRepeatedPtrField() const;
 
+  // Adds an entry to the repeated field for SyncRepeatedFieldWithMapNoLock()
+  // to fill in. An entry cleared by an earlier synchronization is reused if
+  // there is one; otherwise a new one is created from "prototype" on arena_.
+  Message* AddRepeatedEntry(const Message& prototype) const;
+
   enum State {
     STATE_MODIFIED_MAP = 0,       // map has newly added data that has not been
                                   // synchronized to repeated field
@@ -293,7 +293,9 @@ void MapField<Derived, Key, T, kKeyFieldType, kValueFieldType,
       reinterpret_cast<RepeatedPtrField<EntryType>*>(
           this->MapFieldBase::repeated_field_);
 
+  // Entries are cleared rather than deleted, so that they are reused below.
   repeated_field->Clear();
+  repeated_field->Reserve(static_cast<int>(map.size()));
 
   // The only way we can get at this point is through reflection and the
   // only way we can get the reflection object is by having called GetReflection
@@ -304,8 +306,7 @@ void MapField<Derived, Key, T, kKeyFieldType, kValueFieldType,
   for (typename Map<Key, T>::const_iterator it = map.begin();
        it != map.end(); ++it) {
     EntryType* new_entry =
-        down_cast<EntryType*>(default_entry->New(this->MapFieldBase::arena_));
-    repeated_field->AddAllocated(new_entry);
+        down_cast<EntryType*>(this->AddRepeatedEntry(*default_entry));
     (*new_entry->mutable_key()) = it->first;
     (*new_entry->mutable_value()) = it->second;
   }
@@ -30,6 +30,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <unordered_map>
 
 #include <google/protobuf/stubs/logging.h>
@@ -171,6 +172,31 @@ TEST_F(MapFieldBasePrimitiveTest, MutableRepeatedField) {
   }
 }
 
+TEST_F(MapFieldBasePrimitiveTest, ResyncReusesEntries) {
+  const RepeatedPtrField<Message>& repeated =
+      reinterpret_cast<const RepeatedPtrField<Message>&>(
+          map_field_base_->GetRepeatedField());
+  std::set<const Message*> entries;
+  for (int i = 0; i < repeated.size(); i++) {
+    entries.insert(&repeated.Get(i));
+  }
+
+  (*map_field_->MutableMap())[2] = 102;
+  initial_value_map_[2] = 102;
+  map_field_base_->GetRepeatedField();
+
+  EXPECT_EQ(3, repeated.size());
+  int reused = 0;
+  for (int i = 0; i < repeated.size(); i++) {
+    const Message& message = repeated.Get(i);
+    int key = message.GetReflection()->GetInt32(message, key_descriptor_);
+    int value = message.GetReflection()->GetInt32(message, value_descriptor_);
+    EXPECT_EQ(value, initial_value_map_[key]);
+    reused += entries.count(&message);
+  }
+  EXPECT_EQ(2, reused);
+}
+
 TEST_F(MapFieldBasePrimitiveTest, Arena) {
   // Allocate a large initial block to avoid mallocs during hooked test.
   std::vector<char> arena_block(128 * 1024);
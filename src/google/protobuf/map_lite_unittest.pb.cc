@@ -0,0 +1,6818 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_lite_unittest.proto
+
+#include "google/protobuf/map_lite_unittest.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessageArenaLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_TeboringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestRequiredLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestMessageMapLite_MapInt32MessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5farena_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5fno_5farena_5flite_2eproto;
+namespace protobuf_unittest {
+class TestMapLite_MapInt32Int32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt32Int32Entry_DoNotUse> _instance;
+} _TestMapLite_MapInt32Int32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapInt64Int64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt64Int64Entry_DoNotUse> _instance;
+} _TestMapLite_MapInt64Int64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapUint32Uint32Entry_DoNotUse> _instance;
+} _TestMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapUint64Uint64Entry_DoNotUse> _instance;
+} _TestMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapSint32Sint32Entry_DoNotUse> _instance;
+} _TestMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapSint64Sint64Entry_DoNotUse> _instance;
+} _TestMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapFixed32Fixed32Entry_DoNotUse> _instance;
+} _TestMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapFixed64Fixed64Entry_DoNotUse> _instance;
+} _TestMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse> _instance;
+} _TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse> _instance;
+} _TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32FloatEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt32FloatEntry_DoNotUse> _instance;
+} _TestMapLite_MapInt32FloatEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt32DoubleEntry_DoNotUse> _instance;
+} _TestMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_;
+class TestMapLite_MapBoolBoolEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapBoolBoolEntry_DoNotUse> _instance;
+} _TestMapLite_MapBoolBoolEntry_DoNotUse_default_instance_;
+class TestMapLite_MapStringStringEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapStringStringEntry_DoNotUse> _instance;
+} _TestMapLite_MapStringStringEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32BytesEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt32BytesEntry_DoNotUse> _instance;
+} _TestMapLite_MapInt32BytesEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32EnumEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt32EnumEntry_DoNotUse> _instance;
+} _TestMapLite_MapInt32EnumEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_MapInt32ForeignMessageEntry_DoNotUse> _instance;
+} _TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+class TestMapLite_TeboringEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite_TeboringEntry_DoNotUse> _instance;
+} _TestMapLite_TeboringEntry_DoNotUse_default_instance_;
+class TestMapLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMapLite> _instance;
+} _TestMapLite_default_instance_;
+class TestArenaMapLite_MapInt32Int32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32Int32Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32Int32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt64Int64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt64Int64Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt64Int64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapUint32Uint32Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapUint64Uint64Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapSint32Sint32Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapSint64Sint64Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse> _instance;
+} _TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32FloatEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32FloatEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32FloatEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32DoubleEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapBoolBoolEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapBoolBoolEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapBoolBoolEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapStringStringEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapStringStringEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapStringStringEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32BytesEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32BytesEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32BytesEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32EnumEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32EnumEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32EnumEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse> _instance;
+} _TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_default_instance_;
+class TestArenaMapLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestArenaMapLite> _instance;
+} _TestArenaMapLite_default_instance_;
+class TestRequiredMessageMapLite_MapFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestRequiredMessageMapLite_MapFieldEntry_DoNotUse> _instance;
+} _TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_default_instance_;
+class TestRequiredMessageMapLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestRequiredMessageMapLite> _instance;
+} _TestRequiredMessageMapLite_default_instance_;
+class TestEnumMapLite_KnownMapFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumMapLite_KnownMapFieldEntry_DoNotUse> _instance;
+} _TestEnumMapLite_KnownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapLite_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumMapLite_UnknownMapFieldEntry_DoNotUse> _instance;
+} _TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumMapLite> _instance;
+} _TestEnumMapLite_default_instance_;
+class TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse> _instance;
+} _TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse> _instance;
+} _TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtraLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumMapPlusExtraLite> _instance;
+} _TestEnumMapPlusExtraLite_default_instance_;
+class TestMessageMapLite_MapInt32MessageEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMessageMapLite_MapInt32MessageEntry_DoNotUse> _instance;
+} _TestMessageMapLite_MapInt32MessageEntry_DoNotUse_default_instance_;
+class TestMessageMapLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMessageMapLite> _instance;
+} _TestMessageMapLite_default_instance_;
+class TestRequiredLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestRequiredLite> _instance;
+} _TestRequiredLite_default_instance_;
+class ForeignMessageArenaLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ForeignMessageArenaLite> _instance;
+} _ForeignMessageArenaLite_default_instance_;
+}  // namespace protobuf_unittest
+static void InitDefaultsTestMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt32Int32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt64Int64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt32FloatEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapBoolBoolEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapStringStringEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt32BytesEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt32EnumEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsTestMapLite_TeboringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_TeboringEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMapLite_TeboringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestMapLite_TeboringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMapLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMapLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestMapLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_TestMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, InitDefaultsTestMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestMapLite_TeboringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32Int32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt64Int64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32FloatEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapBoolBoolEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapStringStringEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32BytesEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32EnumEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestArenaMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestArenaMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_ForeignMessageArenaLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5fno_5farena_5flite_2eproto.base,}};
+
+static void InitDefaultsTestArenaMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestArenaMapLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestArenaMapLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestArenaMapLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_TestArenaMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, InitDefaultsTestArenaMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestArenaMapLite_MapInt32Int32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt64Int64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt32FloatEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapBoolBoolEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapStringStringEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt32BytesEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt32EnumEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestRequiredMessageMapLite_MapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestRequiredMessageMapLite_MapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestRequiredLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestRequiredMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestRequiredMessageMapLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestRequiredMessageMapLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestRequiredMessageMapLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestRequiredMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestRequiredMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestEnumMapLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEnumMapLite_KnownMapFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestEnumMapLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestEnumMapLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestEnumMapLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestEnumMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEnumMapLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEnumMapLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestEnumMapLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_TestEnumMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsTestEnumMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestEnumMapLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsTestEnumMapPlusExtraLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEnumMapPlusExtraLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEnumMapPlusExtraLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestEnumMapPlusExtraLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_TestEnumMapPlusExtraLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsTestEnumMapPlusExtraLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,
+      &scc_info_TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestMessageMapLite_MapInt32MessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMessageMapLite_MapInt32MessageEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestMessageMapLite_MapInt32MessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestMessageMapLite_MapInt32MessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsTestMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestMessageMapLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestMessageMapLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestMessageMapLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {
+      &scc_info_TestMessageMapLite_MapInt32MessageEntry_DoNotUse_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base,}};
+
+static void InitDefaultsTestRequiredLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestRequiredLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestRequiredLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestRequiredLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestRequiredLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestRequiredLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+static void InitDefaultsForeignMessageArenaLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_ForeignMessageArenaLite_default_instance_;
+    new (ptr) ::protobuf_unittest::ForeignMessageArenaLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::ForeignMessageArenaLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessageArenaLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsForeignMessageArenaLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto}, {}};
+
+namespace protobuf_unittest {
+bool Proto2MapEnumLite_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool Proto2MapEnumPlusExtraLite_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool MapEnumLite_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+TestMapLite_MapInt32Int32Entry_DoNotUse::TestMapLite_MapInt32Int32Entry_DoNotUse() {}
+TestMapLite_MapInt32Int32Entry_DoNotUse::TestMapLite_MapInt32Int32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt32Int32Entry_DoNotUse::MergeFrom(const TestMapLite_MapInt32Int32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapInt64Int64Entry_DoNotUse::TestMapLite_MapInt64Int64Entry_DoNotUse() {}
+TestMapLite_MapInt64Int64Entry_DoNotUse::TestMapLite_MapInt64Int64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt64Int64Entry_DoNotUse::MergeFrom(const TestMapLite_MapInt64Int64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapUint32Uint32Entry_DoNotUse::TestMapLite_MapUint32Uint32Entry_DoNotUse() {}
+TestMapLite_MapUint32Uint32Entry_DoNotUse::TestMapLite_MapUint32Uint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapUint32Uint32Entry_DoNotUse::MergeFrom(const TestMapLite_MapUint32Uint32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapUint64Uint64Entry_DoNotUse::TestMapLite_MapUint64Uint64Entry_DoNotUse() {}
+TestMapLite_MapUint64Uint64Entry_DoNotUse::TestMapLite_MapUint64Uint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapUint64Uint64Entry_DoNotUse::MergeFrom(const TestMapLite_MapUint64Uint64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapSint32Sint32Entry_DoNotUse::TestMapLite_MapSint32Sint32Entry_DoNotUse() {}
+TestMapLite_MapSint32Sint32Entry_DoNotUse::TestMapLite_MapSint32Sint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapSint32Sint32Entry_DoNotUse::MergeFrom(const TestMapLite_MapSint32Sint32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapSint64Sint64Entry_DoNotUse::TestMapLite_MapSint64Sint64Entry_DoNotUse() {}
+TestMapLite_MapSint64Sint64Entry_DoNotUse::TestMapLite_MapSint64Sint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapSint64Sint64Entry_DoNotUse::MergeFrom(const TestMapLite_MapSint64Sint64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapFixed32Fixed32Entry_DoNotUse::TestMapLite_MapFixed32Fixed32Entry_DoNotUse() {}
+TestMapLite_MapFixed32Fixed32Entry_DoNotUse::TestMapLite_MapFixed32Fixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapFixed32Fixed32Entry_DoNotUse::MergeFrom(const TestMapLite_MapFixed32Fixed32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapFixed64Fixed64Entry_DoNotUse::TestMapLite_MapFixed64Fixed64Entry_DoNotUse() {}
+TestMapLite_MapFixed64Fixed64Entry_DoNotUse::TestMapLite_MapFixed64Fixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapFixed64Fixed64Entry_DoNotUse::MergeFrom(const TestMapLite_MapFixed64Fixed64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse() {}
+TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MergeFrom(const TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse() {}
+TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MergeFrom(const TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapInt32FloatEntry_DoNotUse::TestMapLite_MapInt32FloatEntry_DoNotUse() {}
+TestMapLite_MapInt32FloatEntry_DoNotUse::TestMapLite_MapInt32FloatEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt32FloatEntry_DoNotUse::MergeFrom(const TestMapLite_MapInt32FloatEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapInt32DoubleEntry_DoNotUse::TestMapLite_MapInt32DoubleEntry_DoNotUse() {}
+TestMapLite_MapInt32DoubleEntry_DoNotUse::TestMapLite_MapInt32DoubleEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt32DoubleEntry_DoNotUse::MergeFrom(const TestMapLite_MapInt32DoubleEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapBoolBoolEntry_DoNotUse::TestMapLite_MapBoolBoolEntry_DoNotUse() {}
+TestMapLite_MapBoolBoolEntry_DoNotUse::TestMapLite_MapBoolBoolEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapBoolBoolEntry_DoNotUse::MergeFrom(const TestMapLite_MapBoolBoolEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapStringStringEntry_DoNotUse::TestMapLite_MapStringStringEntry_DoNotUse() {}
+TestMapLite_MapStringStringEntry_DoNotUse::TestMapLite_MapStringStringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapStringStringEntry_DoNotUse::MergeFrom(const TestMapLite_MapStringStringEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapInt32BytesEntry_DoNotUse::TestMapLite_MapInt32BytesEntry_DoNotUse() {}
+TestMapLite_MapInt32BytesEntry_DoNotUse::TestMapLite_MapInt32BytesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt32BytesEntry_DoNotUse::MergeFrom(const TestMapLite_MapInt32BytesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapInt32EnumEntry_DoNotUse::TestMapLite_MapInt32EnumEntry_DoNotUse() {}
+TestMapLite_MapInt32EnumEntry_DoNotUse::TestMapLite_MapInt32EnumEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt32EnumEntry_DoNotUse::MergeFrom(const TestMapLite_MapInt32EnumEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse() {}
+TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::MergeFrom(const TestMapLite_MapInt32ForeignMessageEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestMapLite_TeboringEntry_DoNotUse::TestMapLite_TeboringEntry_DoNotUse() {}
+TestMapLite_TeboringEntry_DoNotUse::TestMapLite_TeboringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMapLite_TeboringEntry_DoNotUse::MergeFrom(const TestMapLite_TeboringEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestMapLite::InitAsDefaultInstance() {
+}
+class TestMapLite::HasBitSetters {
+ public:
+};
+
+void TestMapLite::clear_map_int32_foreign_message() {
+  map_int32_foreign_message_.Clear();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestMapLite::kMapInt32Int32FieldNumber;
+const int TestMapLite::kMapInt64Int64FieldNumber;
+const int TestMapLite::kMapUint32Uint32FieldNumber;
+const int TestMapLite::kMapUint64Uint64FieldNumber;
+const int TestMapLite::kMapSint32Sint32FieldNumber;
+const int TestMapLite::kMapSint64Sint64FieldNumber;
+const int TestMapLite::kMapFixed32Fixed32FieldNumber;
+const int TestMapLite::kMapFixed64Fixed64FieldNumber;
+const int TestMapLite::kMapSfixed32Sfixed32FieldNumber;
+const int TestMapLite::kMapSfixed64Sfixed64FieldNumber;
+const int TestMapLite::kMapInt32FloatFieldNumber;
+const int TestMapLite::kMapInt32DoubleFieldNumber;
+const int TestMapLite::kMapBoolBoolFieldNumber;
+const int TestMapLite::kMapStringStringFieldNumber;
+const int TestMapLite::kMapInt32BytesFieldNumber;
+const int TestMapLite::kMapInt32EnumFieldNumber;
+const int TestMapLite::kMapInt32ForeignMessageFieldNumber;
+const int TestMapLite::kTeboringFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestMapLite::TestMapLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestMapLite)
+}
+TestMapLite::TestMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena),
+  map_int32_int32_(arena),
+  map_int64_int64_(arena),
+  map_uint32_uint32_(arena),
+  map_uint64_uint64_(arena),
+  map_sint32_sint32_(arena),
+  map_sint64_sint64_(arena),
+  map_fixed32_fixed32_(arena),
+  map_fixed64_fixed64_(arena),
+  map_sfixed32_sfixed32_(arena),
+  map_sfixed64_sfixed64_(arena),
+  map_int32_float_(arena),
+  map_int32_double_(arena),
+  map_bool_bool_(arena),
+  map_string_string_(arena),
+  map_int32_bytes_(arena),
+  map_int32_enum_(arena),
+  map_int32_foreign_message_(arena),
+  teboring_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMapLite)
+}
+TestMapLite::TestMapLite(const TestMapLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  map_int32_int32_.MergeFrom(from.map_int32_int32_);
+  map_int64_int64_.MergeFrom(from.map_int64_int64_);
+  map_uint32_uint32_.MergeFrom(from.map_uint32_uint32_);
+  map_uint64_uint64_.MergeFrom(from.map_uint64_uint64_);
+  map_sint32_sint32_.MergeFrom(from.map_sint32_sint32_);
+  map_sint64_sint64_.MergeFrom(from.map_sint64_sint64_);
+  map_fixed32_fixed32_.MergeFrom(from.map_fixed32_fixed32_);
+  map_fixed64_fixed64_.MergeFrom(from.map_fixed64_fixed64_);
+  map_sfixed32_sfixed32_.MergeFrom(from.map_sfixed32_sfixed32_);
+  map_sfixed64_sfixed64_.MergeFrom(from.map_sfixed64_sfixed64_);
+  map_int32_float_.MergeFrom(from.map_int32_float_);
+  map_int32_double_.MergeFrom(from.map_int32_double_);
+  map_bool_bool_.MergeFrom(from.map_bool_bool_);
+  map_string_string_.MergeFrom(from.map_string_string_);
+  map_int32_bytes_.MergeFrom(from.map_int32_bytes_);
+  map_int32_enum_.MergeFrom(from.map_int32_enum_);
+  map_int32_foreign_message_.MergeFrom(from.map_int32_foreign_message_);
+  teboring_.MergeFrom(from.teboring_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMapLite)
+}
+
+void TestMapLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+}
+
+TestMapLite::~TestMapLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMapLite)
+  SharedDtor();
+}
+
+void TestMapLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestMapLite::ArenaDtor(void* object) {
+  TestMapLite* _this = reinterpret_cast< TestMapLite* >(object);
+  (void)_this;
+}
+void TestMapLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestMapLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestMapLite& TestMapLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestMapLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  map_int32_int32_.Clear();
+  map_int64_int64_.Clear();
+  map_uint32_uint32_.Clear();
+  map_uint64_uint64_.Clear();
+  map_sint32_sint32_.Clear();
+  map_sint64_sint64_.Clear();
+  map_fixed32_fixed32_.Clear();
+  map_fixed64_fixed64_.Clear();
+  map_sfixed32_sfixed32_.Clear();
+  map_sfixed64_sfixed64_.Clear();
+  map_int32_float_.Clear();
+  map_int32_double_.Clear();
+  map_bool_bool_.Clear();
+  map_string_string_.Clear();
+  map_int32_bytes_.Clear();
+  map_int32_enum_.Clear();
+  map_int32_foreign_message_.Clear();
+  teboring_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestMapLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // map<int32, int32> map_int32_int32 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_int32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 10 && (ptr += 1));
+        break;
+      }
+      // map<int64, int64> map_int64_int64 = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int64_int64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 18 && (ptr += 1));
+        break;
+      }
+      // map<uint32, uint32> map_uint32_uint32 = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_uint32_uint32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 26 && (ptr += 1));
+        break;
+      }
+      // map<uint64, uint64> map_uint64_uint64 = 4;
+      case 4: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 34) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_uint64_uint64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 34 && (ptr += 1));
+        break;
+      }
+      // map<sint32, sint32> map_sint32_sint32 = 5;
+      case 5: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sint32_sint32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 42 && (ptr += 1));
+        break;
+      }
+      // map<sint64, sint64> map_sint64_sint64 = 6;
+      case 6: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sint64_sint64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 50 && (ptr += 1));
+        break;
+      }
+      // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+      case 7: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 58) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_fixed32_fixed32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 58 && (ptr += 1));
+        break;
+      }
+      // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+      case 8: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 66) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_fixed64_fixed64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 66 && (ptr += 1));
+        break;
+      }
+      // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+      case 9: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 74) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sfixed32_sfixed32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 74 && (ptr += 1));
+        break;
+      }
+      // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+      case 10: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 82) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sfixed64_sfixed64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 82 && (ptr += 1));
+        break;
+      }
+      // map<int32, float> map_int32_float = 11;
+      case 11: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 90) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_float_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 90 && (ptr += 1));
+        break;
+      }
+      // map<int32, double> map_int32_double = 12;
+      case 12: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 98) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_double_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 98 && (ptr += 1));
+        break;
+      }
+      // map<bool, bool> map_bool_bool = 13;
+      case 13: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 106) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_bool_bool_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 106 && (ptr += 1));
+        break;
+      }
+      // map<string, string> map_string_string = 14;
+      case 14: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 114) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_string_string_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 114 && (ptr += 1));
+        break;
+      }
+      // map<int32, bytes> map_int32_bytes = 15;
+      case 15: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 122) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_bytes_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 122 && (ptr += 1));
+        break;
+      }
+      // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+      case 16: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        do {
+          auto object = ::PROTOBUF_NAMESPACE_ID::internal::InitEnumParseWrapper(&map_int32_enum_, ::protobuf_unittest::MapEnumLite_IsValid, 16, &_internal_metadata_);
+          ptr = ctx->ParseMessage(&object, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 386 && (ptr += 2));
+        break;
+      }
+      // map<int32, .protobuf_unittest.ForeignMessageLite> map_int32_foreign_message = 17;
+      case 17: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_foreign_message_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 394 && (ptr += 2));
+        break;
+      }
+      // map<int32, int32> teboring = 18;
+      case 18: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&teboring_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 402 && (ptr += 2));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestMapLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestMapLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // map<int32, int32> map_int32_int32 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          TestMapLite_MapInt32Int32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt32Int32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&map_int32_int32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int64, int64> map_int64_int64 = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          TestMapLite_MapInt64Int64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt64Int64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 > > parser(&map_int64_int64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<uint32, uint32> map_uint32_uint32 = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          TestMapLite_MapUint32Uint32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapUint32Uint32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 > > parser(&map_uint32_uint32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<uint64, uint64> map_uint64_uint64 = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
+          TestMapLite_MapUint64Uint64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapUint64Uint64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 > > parser(&map_uint64_uint64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sint32, sint32> map_sint32_sint32 = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          TestMapLite_MapSint32Sint32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapSint32Sint32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&map_sint32_sint32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sint64, sint64> map_sint64_sint64 = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          TestMapLite_MapSint64Sint64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapSint64Sint64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 > > parser(&map_sint64_sint64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (58 & 0xFF)) {
+          TestMapLite_MapFixed32Fixed32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapFixed32Fixed32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 > > parser(&map_fixed32_fixed32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+      case 8: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (66 & 0xFF)) {
+          TestMapLite_MapFixed64Fixed64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapFixed64Fixed64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 > > parser(&map_fixed64_fixed64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+      case 9: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (74 & 0xFF)) {
+          TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&map_sfixed32_sfixed32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+      case 10: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (82 & 0xFF)) {
+          TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 > > parser(&map_sfixed64_sfixed64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, float> map_int32_float = 11;
+      case 11: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (90 & 0xFF)) {
+          TestMapLite_MapInt32FloatEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt32FloatEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, float,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float > > parser(&map_int32_float_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, double> map_int32_double = 12;
+      case 12: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (98 & 0xFF)) {
+          TestMapLite_MapInt32DoubleEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt32DoubleEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, double,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double > > parser(&map_int32_double_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<bool, bool> map_bool_bool = 13;
+      case 13: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (106 & 0xFF)) {
+          TestMapLite_MapBoolBoolEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapBoolBoolEntry_DoNotUse,
+              bool, bool,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< bool, bool > > parser(&map_bool_bool_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<string, string> map_string_string = 14;
+      case 14: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (114 & 0xFF)) {
+          TestMapLite_MapStringStringEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapStringStringEntry_DoNotUse,
+              std::string, std::string,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string > > parser(&map_string_string_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, bytes> map_int32_bytes = 15;
+      case 15: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (122 & 0xFF)) {
+          TestMapLite_MapInt32BytesEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt32BytesEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string > > parser(&map_int32_bytes_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+      case 16: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (130 & 0xFF)) {
+          TestMapLite_MapInt32EnumEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt32EnumEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite > > parser(&map_int32_enum_);
+          auto entry = parser.NewEntry();
+          std::string data;
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(input, &data));
+          DO_(entry->ParseFromString(data));
+          if (::protobuf_unittest::MapEnumLite_IsValid(*entry->mutable_value())) {
+            (*mutable_map_int32_enum())[entry->key()] =
+                static_cast< ::protobuf_unittest::MapEnumLite >(*entry->mutable_value());
+          } else {
+            unknown_fields_stream.WriteVarint32(130u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast< ::google::protobuf::uint32>(data.size()));
+            unknown_fields_stream.WriteString(data);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest.ForeignMessageLite> map_int32_foreign_message = 17;
+      case 17: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (138 & 0xFF)) {
+          TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_MapInt32ForeignMessageEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite > > parser(&map_int32_foreign_message_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, int32> teboring = 18;
+      case 18: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (146 & 0xFF)) {
+          TestMapLite_TeboringEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMapLite_TeboringEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&teboring_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestMapLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestMapLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestMapLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  if (!this->map_int32_int32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_int32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_int32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_int32_int32().begin();
+          it != this->map_int32_int32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt32Int32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_int32_int32().begin();
+          it != this->map_int32_int32().end(); ++it) {
+        TestMapLite_MapInt32Int32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    }
+  }
+
+  // map<int64, int64> map_int64_int64 = 2;
+  if (!this->map_int64_int64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int64_int64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int64_int64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_int64_int64().begin();
+          it != this->map_int64_int64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt64Int64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(2, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_int64_int64().begin();
+          it != this->map_int64_int64().end(); ++it) {
+        TestMapLite_MapInt64Int64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(2, entry, output);
+      }
+    }
+  }
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  if (!this->map_uint32_uint32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_uint32_uint32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_uint32_uint32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_uint32_uint32().begin();
+          it != this->map_uint32_uint32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapUint32Uint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(3, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_uint32_uint32().begin();
+          it != this->map_uint32_uint32().end(); ++it) {
+        TestMapLite_MapUint32Uint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(3, entry, output);
+      }
+    }
+  }
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  if (!this->map_uint64_uint64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_uint64_uint64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_uint64_uint64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_uint64_uint64().begin();
+          it != this->map_uint64_uint64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapUint64Uint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(4, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_uint64_uint64().begin();
+          it != this->map_uint64_uint64().end(); ++it) {
+        TestMapLite_MapUint64Uint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(4, entry, output);
+      }
+    }
+  }
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  if (!this->map_sint32_sint32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sint32_sint32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sint32_sint32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sint32_sint32().begin();
+          it != this->map_sint32_sint32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapSint32Sint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(5, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sint32_sint32().begin();
+          it != this->map_sint32_sint32().end(); ++it) {
+        TestMapLite_MapSint32Sint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(5, entry, output);
+      }
+    }
+  }
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  if (!this->map_sint64_sint64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sint64_sint64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sint64_sint64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sint64_sint64().begin();
+          it != this->map_sint64_sint64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapSint64Sint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(6, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sint64_sint64().begin();
+          it != this->map_sint64_sint64().end(); ++it) {
+        TestMapLite_MapSint64Sint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(6, entry, output);
+      }
+    }
+  }
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  if (!this->map_fixed32_fixed32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_fixed32_fixed32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_fixed32_fixed32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_fixed32_fixed32().begin();
+          it != this->map_fixed32_fixed32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapFixed32Fixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(7, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_fixed32_fixed32().begin();
+          it != this->map_fixed32_fixed32().end(); ++it) {
+        TestMapLite_MapFixed32Fixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(7, entry, output);
+      }
+    }
+  }
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  if (!this->map_fixed64_fixed64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_fixed64_fixed64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_fixed64_fixed64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_fixed64_fixed64().begin();
+          it != this->map_fixed64_fixed64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapFixed64Fixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(8, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_fixed64_fixed64().begin();
+          it != this->map_fixed64_fixed64().end(); ++it) {
+        TestMapLite_MapFixed64Fixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(8, entry, output);
+      }
+    }
+  }
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  if (!this->map_sfixed32_sfixed32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sfixed32_sfixed32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sfixed32_sfixed32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sfixed32_sfixed32().begin();
+          it != this->map_sfixed32_sfixed32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(9, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sfixed32_sfixed32().begin();
+          it != this->map_sfixed32_sfixed32().end(); ++it) {
+        TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(9, entry, output);
+      }
+    }
+  }
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  if (!this->map_sfixed64_sfixed64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sfixed64_sfixed64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sfixed64_sfixed64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sfixed64_sfixed64().begin();
+          it != this->map_sfixed64_sfixed64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(10, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sfixed64_sfixed64().begin();
+          it != this->map_sfixed64_sfixed64().end(); ++it) {
+        TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(10, entry, output);
+      }
+    }
+  }
+
+  // map<int32, float> map_int32_float = 11;
+  if (!this->map_int32_float().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_float().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_float().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_iterator
+          it = this->map_int32_float().begin();
+          it != this->map_int32_float().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt32FloatEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(11, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_iterator
+          it = this->map_int32_float().begin();
+          it != this->map_int32_float().end(); ++it) {
+        TestMapLite_MapInt32FloatEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(11, entry, output);
+      }
+    }
+  }
+
+  // map<int32, double> map_int32_double = 12;
+  if (!this->map_int32_double().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_double().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_double().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_iterator
+          it = this->map_int32_double().begin();
+          it != this->map_int32_double().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt32DoubleEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(12, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_iterator
+          it = this->map_int32_double().begin();
+          it != this->map_int32_double().end(); ++it) {
+        TestMapLite_MapInt32DoubleEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(12, entry, output);
+      }
+    }
+  }
+
+  // map<bool, bool> map_bool_bool = 13;
+  if (!this->map_bool_bool().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< bool, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_bool_bool().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_bool_bool().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_iterator
+          it = this->map_bool_bool().begin();
+          it != this->map_bool_bool().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapBoolBoolEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(13, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_iterator
+          it = this->map_bool_bool().begin();
+          it != this->map_bool_bool().end(); ++it) {
+        TestMapLite_MapBoolBoolEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(13, entry, output);
+      }
+    }
+  }
+
+  // map<string, string> map_string_string = 14;
+  if (!this->map_string_string().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+      }
+    };
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_string_string().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_string_string().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->map_string_string().begin();
+          it != this->map_string_string().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapStringStringEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(14, entry, output);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->map_string_string().begin();
+          it != this->map_string_string().end(); ++it) {
+        TestMapLite_MapStringStringEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(14, entry, output);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  if (!this->map_int32_bytes().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_bytes().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_bytes().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_iterator
+          it = this->map_int32_bytes().begin();
+          it != this->map_int32_bytes().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt32BytesEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(15, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_iterator
+          it = this->map_int32_bytes().begin();
+          it != this->map_int32_bytes().end(); ++it) {
+        TestMapLite_MapInt32BytesEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(15, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+  if (!this->map_int32_enum().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_enum().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_enum().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_iterator
+          it = this->map_int32_enum().begin();
+          it != this->map_int32_enum().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt32EnumEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(16, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_iterator
+          it = this->map_int32_enum().begin();
+          it != this->map_int32_enum().end(); ++it) {
+        TestMapLite_MapInt32EnumEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(16, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.ForeignMessageLite> map_int32_foreign_message = 17;
+  if (!this->map_int32_foreign_message().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_foreign_message().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_foreign_message().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >::const_iterator
+          it = this->map_int32_foreign_message().begin();
+          it != this->map_int32_foreign_message().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(17, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >::const_iterator
+          it = this->map_int32_foreign_message().begin();
+          it != this->map_int32_foreign_message().end(); ++it) {
+        TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(17, entry, output);
+      }
+    }
+  }
+
+  // map<int32, int32> teboring = 18;
+  if (!this->teboring().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->teboring().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->teboring().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->teboring().begin();
+          it != this->teboring().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMapLite_TeboringEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(18, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->teboring().begin();
+          it != this->teboring().end(); ++it) {
+        TestMapLite_TeboringEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(18, entry, output);
+      }
+    }
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestMapLite)
+}
+
+size_t TestMapLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMapLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_int32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->map_int32_int32().begin();
+      it != this->map_int32_int32().end(); ++it) {
+    TestMapLite_MapInt32Int32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int64, int64> map_int64_int64 = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int64_int64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+      it = this->map_int64_int64().begin();
+      it != this->map_int64_int64().end(); ++it) {
+    TestMapLite_MapInt64Int64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_uint32_uint32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+      it = this->map_uint32_uint32().begin();
+      it != this->map_uint32_uint32().end(); ++it) {
+    TestMapLite_MapUint32Uint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_uint64_uint64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+      it = this->map_uint64_uint64().begin();
+      it != this->map_uint64_uint64().end(); ++it) {
+    TestMapLite_MapUint64Uint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sint32_sint32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->map_sint32_sint32().begin();
+      it != this->map_sint32_sint32().end(); ++it) {
+    TestMapLite_MapSint32Sint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sint64_sint64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+      it = this->map_sint64_sint64().begin();
+      it != this->map_sint64_sint64().end(); ++it) {
+    TestMapLite_MapSint64Sint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_fixed32_fixed32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+      it = this->map_fixed32_fixed32().begin();
+      it != this->map_fixed32_fixed32().end(); ++it) {
+    TestMapLite_MapFixed32Fixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_fixed64_fixed64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+      it = this->map_fixed64_fixed64().begin();
+      it != this->map_fixed64_fixed64().end(); ++it) {
+    TestMapLite_MapFixed64Fixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sfixed32_sfixed32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->map_sfixed32_sfixed32().begin();
+      it != this->map_sfixed32_sfixed32().end(); ++it) {
+    TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sfixed64_sfixed64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+      it = this->map_sfixed64_sfixed64().begin();
+      it != this->map_sfixed64_sfixed64().end(); ++it) {
+    TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, float> map_int32_float = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_float_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_iterator
+      it = this->map_int32_float().begin();
+      it != this->map_int32_float().end(); ++it) {
+    TestMapLite_MapInt32FloatEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, double> map_int32_double = 12;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_double_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_iterator
+      it = this->map_int32_double().begin();
+      it != this->map_int32_double().end(); ++it) {
+    TestMapLite_MapInt32DoubleEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<bool, bool> map_bool_bool = 13;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_bool_bool_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_iterator
+      it = this->map_bool_bool().begin();
+      it != this->map_bool_bool().end(); ++it) {
+    TestMapLite_MapBoolBoolEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<string, string> map_string_string = 14;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_string_string_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->map_string_string().begin();
+      it != this->map_string_string().end(); ++it) {
+    TestMapLite_MapStringStringEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_bytes_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_iterator
+      it = this->map_int32_bytes().begin();
+      it != this->map_int32_bytes().end(); ++it) {
+    TestMapLite_MapInt32BytesEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_enum_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_iterator
+      it = this->map_int32_enum().begin();
+      it != this->map_int32_enum().end(); ++it) {
+    TestMapLite_MapInt32EnumEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest.ForeignMessageLite> map_int32_foreign_message = 17;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_foreign_message_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >::const_iterator
+      it = this->map_int32_foreign_message().begin();
+      it != this->map_int32_foreign_message().end(); ++it) {
+    TestMapLite_MapInt32ForeignMessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, int32> teboring = 18;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->teboring_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->teboring().begin();
+      it != this->teboring().end(); ++it) {
+    TestMapLite_TeboringEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestMapLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestMapLite*>(
+      &from));
+}
+
+void TestMapLite::MergeFrom(const TestMapLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMapLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  map_int32_int32_.MergeFrom(from.map_int32_int32_);
+  map_int64_int64_.MergeFrom(from.map_int64_int64_);
+  map_uint32_uint32_.MergeFrom(from.map_uint32_uint32_);
+  map_uint64_uint64_.MergeFrom(from.map_uint64_uint64_);
+  map_sint32_sint32_.MergeFrom(from.map_sint32_sint32_);
+  map_sint64_sint64_.MergeFrom(from.map_sint64_sint64_);
+  map_fixed32_fixed32_.MergeFrom(from.map_fixed32_fixed32_);
+  map_fixed64_fixed64_.MergeFrom(from.map_fixed64_fixed64_);
+  map_sfixed32_sfixed32_.MergeFrom(from.map_sfixed32_sfixed32_);
+  map_sfixed64_sfixed64_.MergeFrom(from.map_sfixed64_sfixed64_);
+  map_int32_float_.MergeFrom(from.map_int32_float_);
+  map_int32_double_.MergeFrom(from.map_int32_double_);
+  map_bool_bool_.MergeFrom(from.map_bool_bool_);
+  map_string_string_.MergeFrom(from.map_string_string_);
+  map_int32_bytes_.MergeFrom(from.map_int32_bytes_);
+  map_int32_enum_.MergeFrom(from.map_int32_enum_);
+  map_int32_foreign_message_.MergeFrom(from.map_int32_foreign_message_);
+  teboring_.MergeFrom(from.teboring_);
+}
+
+void TestMapLite::CopyFrom(const TestMapLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMapLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestMapLite::IsInitialized() const {
+  return true;
+}
+
+void TestMapLite::Swap(TestMapLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestMapLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestMapLite::UnsafeArenaSwap(TestMapLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestMapLite::InternalSwap(TestMapLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  map_int32_int32_.Swap(&other->map_int32_int32_);
+  map_int64_int64_.Swap(&other->map_int64_int64_);
+  map_uint32_uint32_.Swap(&other->map_uint32_uint32_);
+  map_uint64_uint64_.Swap(&other->map_uint64_uint64_);
+  map_sint32_sint32_.Swap(&other->map_sint32_sint32_);
+  map_sint64_sint64_.Swap(&other->map_sint64_sint64_);
+  map_fixed32_fixed32_.Swap(&other->map_fixed32_fixed32_);
+  map_fixed64_fixed64_.Swap(&other->map_fixed64_fixed64_);
+  map_sfixed32_sfixed32_.Swap(&other->map_sfixed32_sfixed32_);
+  map_sfixed64_sfixed64_.Swap(&other->map_sfixed64_sfixed64_);
+  map_int32_float_.Swap(&other->map_int32_float_);
+  map_int32_double_.Swap(&other->map_int32_double_);
+  map_bool_bool_.Swap(&other->map_bool_bool_);
+  map_string_string_.Swap(&other->map_string_string_);
+  map_int32_bytes_.Swap(&other->map_int32_bytes_);
+  map_int32_enum_.Swap(&other->map_int32_enum_);
+  map_int32_foreign_message_.Swap(&other->map_int32_foreign_message_);
+  teboring_.Swap(&other->teboring_);
+}
+
+std::string TestMapLite::GetTypeName() const {
+  return "protobuf_unittest.TestMapLite";
+}
+
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32Int32Entry_DoNotUse::TestArenaMapLite_MapInt32Int32Entry_DoNotUse() {}
+TestArenaMapLite_MapInt32Int32Entry_DoNotUse::TestArenaMapLite_MapInt32Int32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32Int32Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32Int32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt64Int64Entry_DoNotUse::TestArenaMapLite_MapInt64Int64Entry_DoNotUse() {}
+TestArenaMapLite_MapInt64Int64Entry_DoNotUse::TestArenaMapLite_MapInt64Int64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt64Int64Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt64Int64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse() {}
+TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapUint32Uint32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse() {}
+TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapUint64Uint64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse() {}
+TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapSint32Sint32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse() {}
+TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapSint64Sint64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse() {}
+TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse() {}
+TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse() {}
+TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse() {}
+TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MergeFrom(const TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32FloatEntry_DoNotUse::TestArenaMapLite_MapInt32FloatEntry_DoNotUse() {}
+TestArenaMapLite_MapInt32FloatEntry_DoNotUse::TestArenaMapLite_MapInt32FloatEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32FloatEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32FloatEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse() {}
+TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32DoubleEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapBoolBoolEntry_DoNotUse::TestArenaMapLite_MapBoolBoolEntry_DoNotUse() {}
+TestArenaMapLite_MapBoolBoolEntry_DoNotUse::TestArenaMapLite_MapBoolBoolEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapBoolBoolEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapBoolBoolEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapStringStringEntry_DoNotUse::TestArenaMapLite_MapStringStringEntry_DoNotUse() {}
+TestArenaMapLite_MapStringStringEntry_DoNotUse::TestArenaMapLite_MapStringStringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapStringStringEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapStringStringEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32BytesEntry_DoNotUse::TestArenaMapLite_MapInt32BytesEntry_DoNotUse() {}
+TestArenaMapLite_MapInt32BytesEntry_DoNotUse::TestArenaMapLite_MapInt32BytesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32BytesEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32BytesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32EnumEntry_DoNotUse::TestArenaMapLite_MapInt32EnumEntry_DoNotUse() {}
+TestArenaMapLite_MapInt32EnumEntry_DoNotUse::TestArenaMapLite_MapInt32EnumEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32EnumEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32EnumEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse() {}
+TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse() {}
+TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::MergeFrom(const TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestArenaMapLite::InitAsDefaultInstance() {
+}
+class TestArenaMapLite::HasBitSetters {
+ public:
+};
+
+void TestArenaMapLite::clear_map_int32_foreign_message_no_arena() {
+  map_int32_foreign_message_no_arena_.Clear();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestArenaMapLite::kMapInt32Int32FieldNumber;
+const int TestArenaMapLite::kMapInt64Int64FieldNumber;
+const int TestArenaMapLite::kMapUint32Uint32FieldNumber;
+const int TestArenaMapLite::kMapUint64Uint64FieldNumber;
+const int TestArenaMapLite::kMapSint32Sint32FieldNumber;
+const int TestArenaMapLite::kMapSint64Sint64FieldNumber;
+const int TestArenaMapLite::kMapFixed32Fixed32FieldNumber;
+const int TestArenaMapLite::kMapFixed64Fixed64FieldNumber;
+const int TestArenaMapLite::kMapSfixed32Sfixed32FieldNumber;
+const int TestArenaMapLite::kMapSfixed64Sfixed64FieldNumber;
+const int TestArenaMapLite::kMapInt32FloatFieldNumber;
+const int TestArenaMapLite::kMapInt32DoubleFieldNumber;
+const int TestArenaMapLite::kMapBoolBoolFieldNumber;
+const int TestArenaMapLite::kMapStringStringFieldNumber;
+const int TestArenaMapLite::kMapInt32BytesFieldNumber;
+const int TestArenaMapLite::kMapInt32EnumFieldNumber;
+const int TestArenaMapLite::kMapInt32ForeignMessageFieldNumber;
+const int TestArenaMapLite::kMapInt32ForeignMessageNoArenaFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestArenaMapLite::TestArenaMapLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestArenaMapLite)
+}
+TestArenaMapLite::TestArenaMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena),
+  map_int32_int32_(arena),
+  map_int64_int64_(arena),
+  map_uint32_uint32_(arena),
+  map_uint64_uint64_(arena),
+  map_sint32_sint32_(arena),
+  map_sint64_sint64_(arena),
+  map_fixed32_fixed32_(arena),
+  map_fixed64_fixed64_(arena),
+  map_sfixed32_sfixed32_(arena),
+  map_sfixed64_sfixed64_(arena),
+  map_int32_float_(arena),
+  map_int32_double_(arena),
+  map_bool_bool_(arena),
+  map_string_string_(arena),
+  map_int32_bytes_(arena),
+  map_int32_enum_(arena),
+  map_int32_foreign_message_(arena),
+  map_int32_foreign_message_no_arena_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestArenaMapLite)
+}
+TestArenaMapLite::TestArenaMapLite(const TestArenaMapLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  map_int32_int32_.MergeFrom(from.map_int32_int32_);
+  map_int64_int64_.MergeFrom(from.map_int64_int64_);
+  map_uint32_uint32_.MergeFrom(from.map_uint32_uint32_);
+  map_uint64_uint64_.MergeFrom(from.map_uint64_uint64_);
+  map_sint32_sint32_.MergeFrom(from.map_sint32_sint32_);
+  map_sint64_sint64_.MergeFrom(from.map_sint64_sint64_);
+  map_fixed32_fixed32_.MergeFrom(from.map_fixed32_fixed32_);
+  map_fixed64_fixed64_.MergeFrom(from.map_fixed64_fixed64_);
+  map_sfixed32_sfixed32_.MergeFrom(from.map_sfixed32_sfixed32_);
+  map_sfixed64_sfixed64_.MergeFrom(from.map_sfixed64_sfixed64_);
+  map_int32_float_.MergeFrom(from.map_int32_float_);
+  map_int32_double_.MergeFrom(from.map_int32_double_);
+  map_bool_bool_.MergeFrom(from.map_bool_bool_);
+  map_string_string_.MergeFrom(from.map_string_string_);
+  map_int32_bytes_.MergeFrom(from.map_int32_bytes_);
+  map_int32_enum_.MergeFrom(from.map_int32_enum_);
+  map_int32_foreign_message_.MergeFrom(from.map_int32_foreign_message_);
+  map_int32_foreign_message_no_arena_.MergeFrom(from.map_int32_foreign_message_no_arena_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestArenaMapLite)
+}
+
+void TestArenaMapLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestArenaMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+}
+
+TestArenaMapLite::~TestArenaMapLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestArenaMapLite)
+  SharedDtor();
+}
+
+void TestArenaMapLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestArenaMapLite::ArenaDtor(void* object) {
+  TestArenaMapLite* _this = reinterpret_cast< TestArenaMapLite* >(object);
+  (void)_this;
+}
+void TestArenaMapLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestArenaMapLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestArenaMapLite& TestArenaMapLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestArenaMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestArenaMapLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestArenaMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  map_int32_int32_.Clear();
+  map_int64_int64_.Clear();
+  map_uint32_uint32_.Clear();
+  map_uint64_uint64_.Clear();
+  map_sint32_sint32_.Clear();
+  map_sint64_sint64_.Clear();
+  map_fixed32_fixed32_.Clear();
+  map_fixed64_fixed64_.Clear();
+  map_sfixed32_sfixed32_.Clear();
+  map_sfixed64_sfixed64_.Clear();
+  map_int32_float_.Clear();
+  map_int32_double_.Clear();
+  map_bool_bool_.Clear();
+  map_string_string_.Clear();
+  map_int32_bytes_.Clear();
+  map_int32_enum_.Clear();
+  map_int32_foreign_message_.Clear();
+  map_int32_foreign_message_no_arena_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestArenaMapLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // map<int32, int32> map_int32_int32 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_int32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 10 && (ptr += 1));
+        break;
+      }
+      // map<int64, int64> map_int64_int64 = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int64_int64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 18 && (ptr += 1));
+        break;
+      }
+      // map<uint32, uint32> map_uint32_uint32 = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_uint32_uint32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 26 && (ptr += 1));
+        break;
+      }
+      // map<uint64, uint64> map_uint64_uint64 = 4;
+      case 4: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 34) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_uint64_uint64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 34 && (ptr += 1));
+        break;
+      }
+      // map<sint32, sint32> map_sint32_sint32 = 5;
+      case 5: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sint32_sint32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 42 && (ptr += 1));
+        break;
+      }
+      // map<sint64, sint64> map_sint64_sint64 = 6;
+      case 6: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sint64_sint64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 50 && (ptr += 1));
+        break;
+      }
+      // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+      case 7: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 58) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_fixed32_fixed32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 58 && (ptr += 1));
+        break;
+      }
+      // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+      case 8: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 66) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_fixed64_fixed64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 66 && (ptr += 1));
+        break;
+      }
+      // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+      case 9: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 74) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sfixed32_sfixed32_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 74 && (ptr += 1));
+        break;
+      }
+      // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+      case 10: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 82) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_sfixed64_sfixed64_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 82 && (ptr += 1));
+        break;
+      }
+      // map<int32, float> map_int32_float = 11;
+      case 11: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 90) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_float_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 90 && (ptr += 1));
+        break;
+      }
+      // map<int32, double> map_int32_double = 12;
+      case 12: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 98) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_double_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 98 && (ptr += 1));
+        break;
+      }
+      // map<bool, bool> map_bool_bool = 13;
+      case 13: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 106) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_bool_bool_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 106 && (ptr += 1));
+        break;
+      }
+      // map<string, string> map_string_string = 14;
+      case 14: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 114) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_string_string_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 114 && (ptr += 1));
+        break;
+      }
+      // map<int32, bytes> map_int32_bytes = 15;
+      case 15: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 122) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_bytes_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 122 && (ptr += 1));
+        break;
+      }
+      // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+      case 16: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        do {
+          auto object = ::PROTOBUF_NAMESPACE_ID::internal::InitEnumParseWrapper(&map_int32_enum_, ::protobuf_unittest::MapEnumLite_IsValid, 16, &_internal_metadata_);
+          ptr = ctx->ParseMessage(&object, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 386 && (ptr += 2));
+        break;
+      }
+      // map<int32, .protobuf_unittest.ForeignMessageArenaLite> map_int32_foreign_message = 17;
+      case 17: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_foreign_message_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 394 && (ptr += 2));
+        break;
+      }
+      // map<int32, .protobuf_unittest_no_arena.ForeignMessageLite> map_int32_foreign_message_no_arena = 18;
+      case 18: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_foreign_message_no_arena_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 402 && (ptr += 2));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestArenaMapLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestArenaMapLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // map<int32, int32> map_int32_int32 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          TestArenaMapLite_MapInt32Int32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32Int32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&map_int32_int32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int64, int64> map_int64_int64 = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          TestArenaMapLite_MapInt64Int64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt64Int64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 > > parser(&map_int64_int64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<uint32, uint32> map_uint32_uint32 = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapUint32Uint32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 > > parser(&map_uint32_uint32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<uint64, uint64> map_uint64_uint64 = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
+          TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapUint64Uint64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 > > parser(&map_uint64_uint64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sint32, sint32> map_sint32_sint32 = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapSint32Sint32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&map_sint32_sint32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sint64, sint64> map_sint64_sint64 = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapSint64Sint64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 > > parser(&map_sint64_sint64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (58 & 0xFF)) {
+          TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 > > parser(&map_fixed32_fixed32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+      case 8: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (66 & 0xFF)) {
+          TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 > > parser(&map_fixed64_fixed64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+      case 9: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (74 & 0xFF)) {
+          TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 > > parser(&map_sfixed32_sfixed32_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+      case 10: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (82 & 0xFF)) {
+          TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 > > parser(&map_sfixed64_sfixed64_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, float> map_int32_float = 11;
+      case 11: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (90 & 0xFF)) {
+          TestArenaMapLite_MapInt32FloatEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32FloatEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, float,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float > > parser(&map_int32_float_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, double> map_int32_double = 12;
+      case 12: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (98 & 0xFF)) {
+          TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32DoubleEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, double,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double > > parser(&map_int32_double_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<bool, bool> map_bool_bool = 13;
+      case 13: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (106 & 0xFF)) {
+          TestArenaMapLite_MapBoolBoolEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapBoolBoolEntry_DoNotUse,
+              bool, bool,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< bool, bool > > parser(&map_bool_bool_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<string, string> map_string_string = 14;
+      case 14: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (114 & 0xFF)) {
+          TestArenaMapLite_MapStringStringEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapStringStringEntry_DoNotUse,
+              std::string, std::string,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string > > parser(&map_string_string_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, bytes> map_int32_bytes = 15;
+      case 15: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (122 & 0xFF)) {
+          TestArenaMapLite_MapInt32BytesEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32BytesEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string > > parser(&map_int32_bytes_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+      case 16: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (130 & 0xFF)) {
+          TestArenaMapLite_MapInt32EnumEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32EnumEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite > > parser(&map_int32_enum_);
+          auto entry = parser.NewEntry();
+          std::string data;
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(input, &data));
+          DO_(entry->ParseFromString(data));
+          if (::protobuf_unittest::MapEnumLite_IsValid(*entry->mutable_value())) {
+            (*mutable_map_int32_enum())[entry->key()] =
+                static_cast< ::protobuf_unittest::MapEnumLite >(*entry->mutable_value());
+          } else {
+            unknown_fields_stream.WriteVarint32(130u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast< ::google::protobuf::uint32>(data.size()));
+            unknown_fields_stream.WriteString(data);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest.ForeignMessageArenaLite> map_int32_foreign_message = 17;
+      case 17: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (138 & 0xFF)) {
+          TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite > > parser(&map_int32_foreign_message_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest_no_arena.ForeignMessageLite> map_int32_foreign_message_no_arena = 18;
+      case 18: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (146 & 0xFF)) {
+          TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite > > parser(&map_int32_foreign_message_no_arena_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestArenaMapLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestArenaMapLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestArenaMapLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestArenaMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  if (!this->map_int32_int32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_int32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_int32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_int32_int32().begin();
+          it != this->map_int32_int32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32Int32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_int32_int32().begin();
+          it != this->map_int32_int32().end(); ++it) {
+        TestArenaMapLite_MapInt32Int32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    }
+  }
+
+  // map<int64, int64> map_int64_int64 = 2;
+  if (!this->map_int64_int64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int64_int64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int64_int64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_int64_int64().begin();
+          it != this->map_int64_int64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt64Int64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(2, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_int64_int64().begin();
+          it != this->map_int64_int64().end(); ++it) {
+        TestArenaMapLite_MapInt64Int64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(2, entry, output);
+      }
+    }
+  }
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  if (!this->map_uint32_uint32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_uint32_uint32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_uint32_uint32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_uint32_uint32().begin();
+          it != this->map_uint32_uint32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(3, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_uint32_uint32().begin();
+          it != this->map_uint32_uint32().end(); ++it) {
+        TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(3, entry, output);
+      }
+    }
+  }
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  if (!this->map_uint64_uint64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_uint64_uint64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_uint64_uint64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_uint64_uint64().begin();
+          it != this->map_uint64_uint64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(4, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_uint64_uint64().begin();
+          it != this->map_uint64_uint64().end(); ++it) {
+        TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(4, entry, output);
+      }
+    }
+  }
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  if (!this->map_sint32_sint32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sint32_sint32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sint32_sint32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sint32_sint32().begin();
+          it != this->map_sint32_sint32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(5, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sint32_sint32().begin();
+          it != this->map_sint32_sint32().end(); ++it) {
+        TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(5, entry, output);
+      }
+    }
+  }
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  if (!this->map_sint64_sint64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sint64_sint64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sint64_sint64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sint64_sint64().begin();
+          it != this->map_sint64_sint64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(6, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sint64_sint64().begin();
+          it != this->map_sint64_sint64().end(); ++it) {
+        TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(6, entry, output);
+      }
+    }
+  }
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  if (!this->map_fixed32_fixed32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_fixed32_fixed32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_fixed32_fixed32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_fixed32_fixed32().begin();
+          it != this->map_fixed32_fixed32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(7, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+          it = this->map_fixed32_fixed32().begin();
+          it != this->map_fixed32_fixed32().end(); ++it) {
+        TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(7, entry, output);
+      }
+    }
+  }
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  if (!this->map_fixed64_fixed64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_fixed64_fixed64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_fixed64_fixed64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_fixed64_fixed64().begin();
+          it != this->map_fixed64_fixed64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(8, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+          it = this->map_fixed64_fixed64().begin();
+          it != this->map_fixed64_fixed64().end(); ++it) {
+        TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(8, entry, output);
+      }
+    }
+  }
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  if (!this->map_sfixed32_sfixed32().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sfixed32_sfixed32().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sfixed32_sfixed32().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sfixed32_sfixed32().begin();
+          it != this->map_sfixed32_sfixed32().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(9, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->map_sfixed32_sfixed32().begin();
+          it != this->map_sfixed32_sfixed32().end(); ++it) {
+        TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(9, entry, output);
+      }
+    }
+  }
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  if (!this->map_sfixed64_sfixed64().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_sfixed64_sfixed64().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_sfixed64_sfixed64().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sfixed64_sfixed64().begin();
+          it != this->map_sfixed64_sfixed64().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(10, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+          it = this->map_sfixed64_sfixed64().begin();
+          it != this->map_sfixed64_sfixed64().end(); ++it) {
+        TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(10, entry, output);
+      }
+    }
+  }
+
+  // map<int32, float> map_int32_float = 11;
+  if (!this->map_int32_float().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_float().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_float().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_iterator
+          it = this->map_int32_float().begin();
+          it != this->map_int32_float().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32FloatEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(11, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_iterator
+          it = this->map_int32_float().begin();
+          it != this->map_int32_float().end(); ++it) {
+        TestArenaMapLite_MapInt32FloatEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(11, entry, output);
+      }
+    }
+  }
+
+  // map<int32, double> map_int32_double = 12;
+  if (!this->map_int32_double().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_double().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_double().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_iterator
+          it = this->map_int32_double().begin();
+          it != this->map_int32_double().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(12, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_iterator
+          it = this->map_int32_double().begin();
+          it != this->map_int32_double().end(); ++it) {
+        TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(12, entry, output);
+      }
+    }
+  }
+
+  // map<bool, bool> map_bool_bool = 13;
+  if (!this->map_bool_bool().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< bool, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_bool_bool().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_bool_bool().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_iterator
+          it = this->map_bool_bool().begin();
+          it != this->map_bool_bool().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapBoolBoolEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(13, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_iterator
+          it = this->map_bool_bool().begin();
+          it != this->map_bool_bool().end(); ++it) {
+        TestArenaMapLite_MapBoolBoolEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(13, entry, output);
+      }
+    }
+  }
+
+  // map<string, string> map_string_string = 14;
+  if (!this->map_string_string().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+      }
+    };
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_string_string().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_string_string().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->map_string_string().begin();
+          it != this->map_string_string().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapStringStringEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(14, entry, output);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->map_string_string().begin();
+          it != this->map_string_string().end(); ++it) {
+        TestArenaMapLite_MapStringStringEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(14, entry, output);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  if (!this->map_int32_bytes().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_bytes().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_bytes().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_iterator
+          it = this->map_int32_bytes().begin();
+          it != this->map_int32_bytes().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32BytesEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(15, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_iterator
+          it = this->map_int32_bytes().begin();
+          it != this->map_int32_bytes().end(); ++it) {
+        TestArenaMapLite_MapInt32BytesEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(15, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+  if (!this->map_int32_enum().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_enum().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_enum().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_iterator
+          it = this->map_int32_enum().begin();
+          it != this->map_int32_enum().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32EnumEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(16, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_iterator
+          it = this->map_int32_enum().begin();
+          it != this->map_int32_enum().end(); ++it) {
+        TestArenaMapLite_MapInt32EnumEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(16, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.ForeignMessageArenaLite> map_int32_foreign_message = 17;
+  if (!this->map_int32_foreign_message().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_foreign_message().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_foreign_message().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >::const_iterator
+          it = this->map_int32_foreign_message().begin();
+          it != this->map_int32_foreign_message().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(17, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >::const_iterator
+          it = this->map_int32_foreign_message().begin();
+          it != this->map_int32_foreign_message().end(); ++it) {
+        TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(17, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest_no_arena.ForeignMessageLite> map_int32_foreign_message_no_arena = 18;
+  if (!this->map_int32_foreign_message_no_arena().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_foreign_message_no_arena().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_foreign_message_no_arena().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite >::const_iterator
+          it = this->map_int32_foreign_message_no_arena().begin();
+          it != this->map_int32_foreign_message_no_arena().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(18, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite >::const_iterator
+          it = this->map_int32_foreign_message_no_arena().begin();
+          it != this->map_int32_foreign_message_no_arena().end(); ++it) {
+        TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(18, entry, output);
+      }
+    }
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestArenaMapLite)
+}
+
+size_t TestArenaMapLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestArenaMapLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> map_int32_int32 = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_int32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->map_int32_int32().begin();
+      it != this->map_int32_int32().end(); ++it) {
+    TestArenaMapLite_MapInt32Int32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int64, int64> map_int64_int64 = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int64_int64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+      it = this->map_int64_int64().begin();
+      it != this->map_int64_int64().end(); ++it) {
+    TestArenaMapLite_MapInt64Int64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_uint32_uint32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+      it = this->map_uint32_uint32().begin();
+      it != this->map_uint32_uint32().end(); ++it) {
+    TestArenaMapLite_MapUint32Uint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_uint64_uint64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+      it = this->map_uint64_uint64().begin();
+      it != this->map_uint64_uint64().end(); ++it) {
+    TestArenaMapLite_MapUint64Uint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sint32_sint32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->map_sint32_sint32().begin();
+      it != this->map_sint32_sint32().end(); ++it) {
+    TestArenaMapLite_MapSint32Sint32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sint64_sint64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+      it = this->map_sint64_sint64().begin();
+      it != this->map_sint64_sint64().end(); ++it) {
+    TestArenaMapLite_MapSint64Sint64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_fixed32_fixed32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >::const_iterator
+      it = this->map_fixed32_fixed32().begin();
+      it != this->map_fixed32_fixed32().end(); ++it) {
+    TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_fixed64_fixed64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >::const_iterator
+      it = this->map_fixed64_fixed64().begin();
+      it != this->map_fixed64_fixed64().end(); ++it) {
+    TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sfixed32_sfixed32_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->map_sfixed32_sfixed32().begin();
+      it != this->map_sfixed32_sfixed32().end(); ++it) {
+    TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_sfixed64_sfixed64_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+      it = this->map_sfixed64_sfixed64().begin();
+      it != this->map_sfixed64_sfixed64().end(); ++it) {
+    TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, float> map_int32_float = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_float_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >::const_iterator
+      it = this->map_int32_float().begin();
+      it != this->map_int32_float().end(); ++it) {
+    TestArenaMapLite_MapInt32FloatEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, double> map_int32_double = 12;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_double_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >::const_iterator
+      it = this->map_int32_double().begin();
+      it != this->map_int32_double().end(); ++it) {
+    TestArenaMapLite_MapInt32DoubleEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<bool, bool> map_bool_bool = 13;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_bool_bool_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< bool, bool >::const_iterator
+      it = this->map_bool_bool().begin();
+      it != this->map_bool_bool().end(); ++it) {
+    TestArenaMapLite_MapBoolBoolEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<string, string> map_string_string = 14;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_string_string_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->map_string_string().begin();
+      it != this->map_string_string().end(); ++it) {
+    TestArenaMapLite_MapStringStringEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_bytes_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >::const_iterator
+      it = this->map_int32_bytes().begin();
+      it != this->map_int32_bytes().end(); ++it) {
+    TestArenaMapLite_MapInt32BytesEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_enum_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >::const_iterator
+      it = this->map_int32_enum().begin();
+      it != this->map_int32_enum().end(); ++it) {
+    TestArenaMapLite_MapInt32EnumEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest.ForeignMessageArenaLite> map_int32_foreign_message = 17;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_foreign_message_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >::const_iterator
+      it = this->map_int32_foreign_message().begin();
+      it != this->map_int32_foreign_message().end(); ++it) {
+    TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest_no_arena.ForeignMessageLite> map_int32_foreign_message_no_arena = 18;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_foreign_message_no_arena_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest_no_arena::ForeignMessageLite >::const_iterator
+      it = this->map_int32_foreign_message_no_arena().begin();
+      it != this->map_int32_foreign_message_no_arena().end(); ++it) {
+    TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestArenaMapLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestArenaMapLite*>(
+      &from));
+}
+
+void TestArenaMapLite::MergeFrom(const TestArenaMapLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestArenaMapLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  map_int32_int32_.MergeFrom(from.map_int32_int32_);
+  map_int64_int64_.MergeFrom(from.map_int64_int64_);
+  map_uint32_uint32_.MergeFrom(from.map_uint32_uint32_);
+  map_uint64_uint64_.MergeFrom(from.map_uint64_uint64_);
+  map_sint32_sint32_.MergeFrom(from.map_sint32_sint32_);
+  map_sint64_sint64_.MergeFrom(from.map_sint64_sint64_);
+  map_fixed32_fixed32_.MergeFrom(from.map_fixed32_fixed32_);
+  map_fixed64_fixed64_.MergeFrom(from.map_fixed64_fixed64_);
+  map_sfixed32_sfixed32_.MergeFrom(from.map_sfixed32_sfixed32_);
+  map_sfixed64_sfixed64_.MergeFrom(from.map_sfixed64_sfixed64_);
+  map_int32_float_.MergeFrom(from.map_int32_float_);
+  map_int32_double_.MergeFrom(from.map_int32_double_);
+  map_bool_bool_.MergeFrom(from.map_bool_bool_);
+  map_string_string_.MergeFrom(from.map_string_string_);
+  map_int32_bytes_.MergeFrom(from.map_int32_bytes_);
+  map_int32_enum_.MergeFrom(from.map_int32_enum_);
+  map_int32_foreign_message_.MergeFrom(from.map_int32_foreign_message_);
+  map_int32_foreign_message_no_arena_.MergeFrom(from.map_int32_foreign_message_no_arena_);
+}
+
+void TestArenaMapLite::CopyFrom(const TestArenaMapLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestArenaMapLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestArenaMapLite::IsInitialized() const {
+  return true;
+}
+
+void TestArenaMapLite::Swap(TestArenaMapLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestArenaMapLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestArenaMapLite::UnsafeArenaSwap(TestArenaMapLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestArenaMapLite::InternalSwap(TestArenaMapLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  map_int32_int32_.Swap(&other->map_int32_int32_);
+  map_int64_int64_.Swap(&other->map_int64_int64_);
+  map_uint32_uint32_.Swap(&other->map_uint32_uint32_);
+  map_uint64_uint64_.Swap(&other->map_uint64_uint64_);
+  map_sint32_sint32_.Swap(&other->map_sint32_sint32_);
+  map_sint64_sint64_.Swap(&other->map_sint64_sint64_);
+  map_fixed32_fixed32_.Swap(&other->map_fixed32_fixed32_);
+  map_fixed64_fixed64_.Swap(&other->map_fixed64_fixed64_);
+  map_sfixed32_sfixed32_.Swap(&other->map_sfixed32_sfixed32_);
+  map_sfixed64_sfixed64_.Swap(&other->map_sfixed64_sfixed64_);
+  map_int32_float_.Swap(&other->map_int32_float_);
+  map_int32_double_.Swap(&other->map_int32_double_);
+  map_bool_bool_.Swap(&other->map_bool_bool_);
+  map_string_string_.Swap(&other->map_string_string_);
+  map_int32_bytes_.Swap(&other->map_int32_bytes_);
+  map_int32_enum_.Swap(&other->map_int32_enum_);
+  map_int32_foreign_message_.Swap(&other->map_int32_foreign_message_);
+  map_int32_foreign_message_no_arena_.Swap(&other->map_int32_foreign_message_no_arena_);
+}
+
+std::string TestArenaMapLite::GetTypeName() const {
+  return "protobuf_unittest.TestArenaMapLite";
+}
+
+
+// ===================================================================
+
+TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse() {}
+TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::MergeFrom(const TestRequiredMessageMapLite_MapFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestRequiredMessageMapLite::InitAsDefaultInstance() {
+}
+class TestRequiredMessageMapLite::HasBitSetters {
+ public:
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestRequiredMessageMapLite::kMapFieldFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestRequiredMessageMapLite::TestRequiredMessageMapLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestRequiredMessageMapLite)
+}
+TestRequiredMessageMapLite::TestRequiredMessageMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena),
+  map_field_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRequiredMessageMapLite)
+}
+TestRequiredMessageMapLite::TestRequiredMessageMapLite(const TestRequiredMessageMapLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  map_field_.MergeFrom(from.map_field_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRequiredMessageMapLite)
+}
+
+void TestRequiredMessageMapLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestRequiredMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+}
+
+TestRequiredMessageMapLite::~TestRequiredMessageMapLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRequiredMessageMapLite)
+  SharedDtor();
+}
+
+void TestRequiredMessageMapLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestRequiredMessageMapLite::ArenaDtor(void* object) {
+  TestRequiredMessageMapLite* _this = reinterpret_cast< TestRequiredMessageMapLite* >(object);
+  (void)_this;
+}
+void TestRequiredMessageMapLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestRequiredMessageMapLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestRequiredMessageMapLite& TestRequiredMessageMapLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestRequiredMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestRequiredMessageMapLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestRequiredMessageMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  map_field_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestRequiredMessageMapLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // map<int32, .protobuf_unittest.TestRequiredLite> map_field = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_field_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 10 && (ptr += 1));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestRequiredMessageMapLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestRequiredMessageMapLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // map<int32, .protobuf_unittest.TestRequiredLite> map_field = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestRequiredMessageMapLite_MapFieldEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite > > parser(&map_field_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestRequiredMessageMapLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestRequiredMessageMapLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestRequiredMessageMapLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestRequiredMessageMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestRequiredLite> map_field = 1;
+  if (!this->map_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >::const_iterator
+          it = this->map_field().begin();
+          it != this->map_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >::const_iterator
+          it = this->map_field().begin();
+          it != this->map_field().end(); ++it) {
+        TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    }
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestRequiredMessageMapLite)
+}
+
+size_t TestRequiredMessageMapLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestRequiredMessageMapLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestRequiredLite> map_field = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >::const_iterator
+      it = this->map_field().begin();
+      it != this->map_field().end(); ++it) {
+    TestRequiredMessageMapLite_MapFieldEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestRequiredMessageMapLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestRequiredMessageMapLite*>(
+      &from));
+}
+
+void TestRequiredMessageMapLite::MergeFrom(const TestRequiredMessageMapLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestRequiredMessageMapLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  map_field_.MergeFrom(from.map_field_);
+}
+
+void TestRequiredMessageMapLite::CopyFrom(const TestRequiredMessageMapLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestRequiredMessageMapLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestRequiredMessageMapLite::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(this->map_field())) return false;
+  return true;
+}
+
+void TestRequiredMessageMapLite::Swap(TestRequiredMessageMapLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestRequiredMessageMapLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestRequiredMessageMapLite::UnsafeArenaSwap(TestRequiredMessageMapLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestRequiredMessageMapLite::InternalSwap(TestRequiredMessageMapLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  map_field_.Swap(&other->map_field_);
+}
+
+std::string TestRequiredMessageMapLite::GetTypeName() const {
+  return "protobuf_unittest.TestRequiredMessageMapLite";
+}
+
+
+// ===================================================================
+
+TestEnumMapLite_KnownMapFieldEntry_DoNotUse::TestEnumMapLite_KnownMapFieldEntry_DoNotUse() {}
+TestEnumMapLite_KnownMapFieldEntry_DoNotUse::TestEnumMapLite_KnownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestEnumMapLite_KnownMapFieldEntry_DoNotUse::MergeFrom(const TestEnumMapLite_KnownMapFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse() {}
+TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::MergeFrom(const TestEnumMapLite_UnknownMapFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestEnumMapLite::InitAsDefaultInstance() {
+}
+class TestEnumMapLite::HasBitSetters {
+ public:
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestEnumMapLite::kKnownMapFieldFieldNumber;
+const int TestEnumMapLite::kUnknownMapFieldFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestEnumMapLite::TestEnumMapLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestEnumMapLite)
+}
+TestEnumMapLite::TestEnumMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena),
+  known_map_field_(arena),
+  unknown_map_field_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestEnumMapLite)
+}
+TestEnumMapLite::TestEnumMapLite(const TestEnumMapLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  known_map_field_.MergeFrom(from.known_map_field_);
+  unknown_map_field_.MergeFrom(from.unknown_map_field_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestEnumMapLite)
+}
+
+void TestEnumMapLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestEnumMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+}
+
+TestEnumMapLite::~TestEnumMapLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestEnumMapLite)
+  SharedDtor();
+}
+
+void TestEnumMapLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestEnumMapLite::ArenaDtor(void* object) {
+  TestEnumMapLite* _this = reinterpret_cast< TestEnumMapLite* >(object);
+  (void)_this;
+}
+void TestEnumMapLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestEnumMapLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestEnumMapLite& TestEnumMapLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestEnumMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestEnumMapLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestEnumMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  known_map_field_.Clear();
+  unknown_map_field_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestEnumMapLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // map<int32, .protobuf_unittest.Proto2MapEnumLite> known_map_field = 101;
+      case 101: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        do {
+          auto object = ::PROTOBUF_NAMESPACE_ID::internal::InitEnumParseWrapper(&known_map_field_, ::protobuf_unittest::Proto2MapEnumLite_IsValid, 101, &_internal_metadata_);
+          ptr = ctx->ParseMessage(&object, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 1706 && (ptr += 2));
+        break;
+      }
+      // map<int32, .protobuf_unittest.Proto2MapEnumLite> unknown_map_field = 102;
+      case 102: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        do {
+          auto object = ::PROTOBUF_NAMESPACE_ID::internal::InitEnumParseWrapper(&unknown_map_field_, ::protobuf_unittest::Proto2MapEnumLite_IsValid, 102, &_internal_metadata_);
+          ptr = ctx->ParseMessage(&object, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 1714 && (ptr += 2));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestEnumMapLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestEnumMapLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // map<int32, .protobuf_unittest.Proto2MapEnumLite> known_map_field = 101;
+      case 101: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (810 & 0xFF)) {
+          TestEnumMapLite_KnownMapFieldEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestEnumMapLite_KnownMapFieldEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite > > parser(&known_map_field_);
+          auto entry = parser.NewEntry();
+          std::string data;
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(input, &data));
+          DO_(entry->ParseFromString(data));
+          if (::protobuf_unittest::Proto2MapEnumLite_IsValid(*entry->mutable_value())) {
+            (*mutable_known_map_field())[entry->key()] =
+                static_cast< ::protobuf_unittest::Proto2MapEnumLite >(*entry->mutable_value());
+          } else {
+            unknown_fields_stream.WriteVarint32(810u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast< ::google::protobuf::uint32>(data.size()));
+            unknown_fields_stream.WriteString(data);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest.Proto2MapEnumLite> unknown_map_field = 102;
+      case 102: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (818 & 0xFF)) {
+          TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestEnumMapLite_UnknownMapFieldEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite > > parser(&unknown_map_field_);
+          auto entry = parser.NewEntry();
+          std::string data;
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(input, &data));
+          DO_(entry->ParseFromString(data));
+          if (::protobuf_unittest::Proto2MapEnumLite_IsValid(*entry->mutable_value())) {
+            (*mutable_unknown_map_field())[entry->key()] =
+                static_cast< ::protobuf_unittest::Proto2MapEnumLite >(*entry->mutable_value());
+          } else {
+            unknown_fields_stream.WriteVarint32(818u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast< ::google::protobuf::uint32>(data.size()));
+            unknown_fields_stream.WriteString(data);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestEnumMapLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestEnumMapLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestEnumMapLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestEnumMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumLite> known_map_field = 101;
+  if (!this->known_map_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->known_map_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->known_map_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_iterator
+          it = this->known_map_field().begin();
+          it != this->known_map_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestEnumMapLite_KnownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(101, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_iterator
+          it = this->known_map_field().begin();
+          it != this->known_map_field().end(); ++it) {
+        TestEnumMapLite_KnownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(101, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumLite> unknown_map_field = 102;
+  if (!this->unknown_map_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->unknown_map_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->unknown_map_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_iterator
+          it = this->unknown_map_field().begin();
+          it != this->unknown_map_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(102, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_iterator
+          it = this->unknown_map_field().begin();
+          it != this->unknown_map_field().end(); ++it) {
+        TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(102, entry, output);
+      }
+    }
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestEnumMapLite)
+}
+
+size_t TestEnumMapLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestEnumMapLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumLite> known_map_field = 101;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->known_map_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_iterator
+      it = this->known_map_field().begin();
+      it != this->known_map_field().end(); ++it) {
+    TestEnumMapLite_KnownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumLite> unknown_map_field = 102;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->unknown_map_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >::const_iterator
+      it = this->unknown_map_field().begin();
+      it != this->unknown_map_field().end(); ++it) {
+    TestEnumMapLite_UnknownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestEnumMapLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestEnumMapLite*>(
+      &from));
+}
+
+void TestEnumMapLite::MergeFrom(const TestEnumMapLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestEnumMapLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  known_map_field_.MergeFrom(from.known_map_field_);
+  unknown_map_field_.MergeFrom(from.unknown_map_field_);
+}
+
+void TestEnumMapLite::CopyFrom(const TestEnumMapLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestEnumMapLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestEnumMapLite::IsInitialized() const {
+  return true;
+}
+
+void TestEnumMapLite::Swap(TestEnumMapLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestEnumMapLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestEnumMapLite::UnsafeArenaSwap(TestEnumMapLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestEnumMapLite::InternalSwap(TestEnumMapLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  known_map_field_.Swap(&other->known_map_field_);
+  unknown_map_field_.Swap(&other->unknown_map_field_);
+}
+
+std::string TestEnumMapLite::GetTypeName() const {
+  return "protobuf_unittest.TestEnumMapLite";
+}
+
+
+// ===================================================================
+
+TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse() {}
+TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::MergeFrom(const TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse() {}
+TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::MergeFrom(const TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestEnumMapPlusExtraLite::InitAsDefaultInstance() {
+}
+class TestEnumMapPlusExtraLite::HasBitSetters {
+ public:
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestEnumMapPlusExtraLite::kKnownMapFieldFieldNumber;
+const int TestEnumMapPlusExtraLite::kUnknownMapFieldFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestEnumMapPlusExtraLite::TestEnumMapPlusExtraLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestEnumMapPlusExtraLite)
+}
+TestEnumMapPlusExtraLite::TestEnumMapPlusExtraLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena),
+  known_map_field_(arena),
+  unknown_map_field_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestEnumMapPlusExtraLite)
+}
+TestEnumMapPlusExtraLite::TestEnumMapPlusExtraLite(const TestEnumMapPlusExtraLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  known_map_field_.MergeFrom(from.known_map_field_);
+  unknown_map_field_.MergeFrom(from.unknown_map_field_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestEnumMapPlusExtraLite)
+}
+
+void TestEnumMapPlusExtraLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestEnumMapPlusExtraLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+}
+
+TestEnumMapPlusExtraLite::~TestEnumMapPlusExtraLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestEnumMapPlusExtraLite)
+  SharedDtor();
+}
+
+void TestEnumMapPlusExtraLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestEnumMapPlusExtraLite::ArenaDtor(void* object) {
+  TestEnumMapPlusExtraLite* _this = reinterpret_cast< TestEnumMapPlusExtraLite* >(object);
+  (void)_this;
+}
+void TestEnumMapPlusExtraLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestEnumMapPlusExtraLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestEnumMapPlusExtraLite& TestEnumMapPlusExtraLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestEnumMapPlusExtraLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestEnumMapPlusExtraLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestEnumMapPlusExtraLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  known_map_field_.Clear();
+  unknown_map_field_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestEnumMapPlusExtraLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> known_map_field = 101;
+      case 101: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        do {
+          auto object = ::PROTOBUF_NAMESPACE_ID::internal::InitEnumParseWrapper(&known_map_field_, ::protobuf_unittest::Proto2MapEnumPlusExtraLite_IsValid, 101, &_internal_metadata_);
+          ptr = ctx->ParseMessage(&object, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 1706 && (ptr += 2));
+        break;
+      }
+      // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> unknown_map_field = 102;
+      case 102: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        do {
+          auto object = ::PROTOBUF_NAMESPACE_ID::internal::InitEnumParseWrapper(&unknown_map_field_, ::protobuf_unittest::Proto2MapEnumPlusExtraLite_IsValid, 102, &_internal_metadata_);
+          ptr = ctx->ParseMessage(&object, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 1714 && (ptr += 2));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestEnumMapPlusExtraLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestEnumMapPlusExtraLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> known_map_field = 101;
+      case 101: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (810 & 0xFF)) {
+          TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite > > parser(&known_map_field_);
+          auto entry = parser.NewEntry();
+          std::string data;
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(input, &data));
+          DO_(entry->ParseFromString(data));
+          if (::protobuf_unittest::Proto2MapEnumPlusExtraLite_IsValid(*entry->mutable_value())) {
+            (*mutable_known_map_field())[entry->key()] =
+                static_cast< ::protobuf_unittest::Proto2MapEnumPlusExtraLite >(*entry->mutable_value());
+          } else {
+            unknown_fields_stream.WriteVarint32(810u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast< ::google::protobuf::uint32>(data.size()));
+            unknown_fields_stream.WriteString(data);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> unknown_map_field = 102;
+      case 102: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (818 & 0xFF)) {
+          TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite > > parser(&unknown_map_field_);
+          auto entry = parser.NewEntry();
+          std::string data;
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(input, &data));
+          DO_(entry->ParseFromString(data));
+          if (::protobuf_unittest::Proto2MapEnumPlusExtraLite_IsValid(*entry->mutable_value())) {
+            (*mutable_unknown_map_field())[entry->key()] =
+                static_cast< ::protobuf_unittest::Proto2MapEnumPlusExtraLite >(*entry->mutable_value());
+          } else {
+            unknown_fields_stream.WriteVarint32(818u);
+            unknown_fields_stream.WriteVarint32(
+                static_cast< ::google::protobuf::uint32>(data.size()));
+            unknown_fields_stream.WriteString(data);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestEnumMapPlusExtraLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestEnumMapPlusExtraLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestEnumMapPlusExtraLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestEnumMapPlusExtraLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> known_map_field = 101;
+  if (!this->known_map_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->known_map_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->known_map_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_iterator
+          it = this->known_map_field().begin();
+          it != this->known_map_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(101, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_iterator
+          it = this->known_map_field().begin();
+          it != this->known_map_field().end(); ++it) {
+        TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(101, entry, output);
+      }
+    }
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> unknown_map_field = 102;
+  if (!this->unknown_map_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->unknown_map_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->unknown_map_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_iterator
+          it = this->unknown_map_field().begin();
+          it != this->unknown_map_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(102, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_iterator
+          it = this->unknown_map_field().begin();
+          it != this->unknown_map_field().end(); ++it) {
+        TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(102, entry, output);
+      }
+    }
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestEnumMapPlusExtraLite)
+}
+
+size_t TestEnumMapPlusExtraLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestEnumMapPlusExtraLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> known_map_field = 101;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->known_map_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_iterator
+      it = this->known_map_field().begin();
+      it != this->known_map_field().end(); ++it) {
+    TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> unknown_map_field = 102;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->unknown_map_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >::const_iterator
+      it = this->unknown_map_field().begin();
+      it != this->unknown_map_field().end(); ++it) {
+    TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse::MapEnumEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestEnumMapPlusExtraLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestEnumMapPlusExtraLite*>(
+      &from));
+}
+
+void TestEnumMapPlusExtraLite::MergeFrom(const TestEnumMapPlusExtraLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestEnumMapPlusExtraLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  known_map_field_.MergeFrom(from.known_map_field_);
+  unknown_map_field_.MergeFrom(from.unknown_map_field_);
+}
+
+void TestEnumMapPlusExtraLite::CopyFrom(const TestEnumMapPlusExtraLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestEnumMapPlusExtraLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestEnumMapPlusExtraLite::IsInitialized() const {
+  return true;
+}
+
+void TestEnumMapPlusExtraLite::Swap(TestEnumMapPlusExtraLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestEnumMapPlusExtraLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestEnumMapPlusExtraLite::UnsafeArenaSwap(TestEnumMapPlusExtraLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestEnumMapPlusExtraLite::InternalSwap(TestEnumMapPlusExtraLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  known_map_field_.Swap(&other->known_map_field_);
+  unknown_map_field_.Swap(&other->unknown_map_field_);
+}
+
+std::string TestEnumMapPlusExtraLite::GetTypeName() const {
+  return "protobuf_unittest.TestEnumMapPlusExtraLite";
+}
+
+
+// ===================================================================
+
+TestMessageMapLite_MapInt32MessageEntry_DoNotUse::TestMessageMapLite_MapInt32MessageEntry_DoNotUse() {}
+TestMessageMapLite_MapInt32MessageEntry_DoNotUse::TestMessageMapLite_MapInt32MessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMessageMapLite_MapInt32MessageEntry_DoNotUse::MergeFrom(const TestMessageMapLite_MapInt32MessageEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestMessageMapLite::InitAsDefaultInstance() {
+}
+class TestMessageMapLite::HasBitSetters {
+ public:
+};
+
+void TestMessageMapLite::clear_map_int32_message() {
+  map_int32_message_.Clear();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestMessageMapLite::kMapInt32MessageFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestMessageMapLite::TestMessageMapLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestMessageMapLite)
+}
+TestMessageMapLite::TestMessageMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena),
+  map_int32_message_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestMessageMapLite)
+}
+TestMessageMapLite::TestMessageMapLite(const TestMessageMapLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  map_int32_message_.MergeFrom(from.map_int32_message_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestMessageMapLite)
+}
+
+void TestMessageMapLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+}
+
+TestMessageMapLite::~TestMessageMapLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestMessageMapLite)
+  SharedDtor();
+}
+
+void TestMessageMapLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestMessageMapLite::ArenaDtor(void* object) {
+  TestMessageMapLite* _this = reinterpret_cast< TestMessageMapLite* >(object);
+  (void)_this;
+}
+void TestMessageMapLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestMessageMapLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestMessageMapLite& TestMessageMapLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestMessageMapLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestMessageMapLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestMessageMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  map_int32_message_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestMessageMapLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // map<int32, .protobuf_unittest.TestAllTypesLite> map_int32_message = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(&map_int32_message_, ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 255) == 10 && (ptr += 1));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestMessageMapLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestMessageMapLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // map<int32, .protobuf_unittest.TestAllTypesLite> map_int32_message = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          TestMessageMapLite_MapInt32MessageEntry_DoNotUse::Parser< ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+              TestMessageMapLite_MapInt32MessageEntry_DoNotUse,
+              ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+              0 >,
+            ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite > > parser(&map_int32_message_);
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessageNoVirtual(
+              input, &parser));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestMessageMapLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestMessageMapLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestMessageMapLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestMessageMapLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestAllTypesLite> map_int32_message = 1;
+  if (!this->map_int32_message().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (output->IsSerializationDeterministic() &&
+        this->map_int32_message().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->map_int32_message().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >::const_iterator
+          it = this->map_int32_message().begin();
+          it != this->map_int32_message().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        TestMessageMapLite_MapInt32MessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >::const_iterator
+          it = this->map_int32_message().begin();
+          it != this->map_int32_message().end(); ++it) {
+        TestMessageMapLite_MapInt32MessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessage(1, entry, output);
+      }
+    }
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestMessageMapLite)
+}
+
+size_t TestMessageMapLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestMessageMapLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .protobuf_unittest.TestAllTypesLite> map_int32_message = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->map_int32_message_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >::const_iterator
+      it = this->map_int32_message().begin();
+      it != this->map_int32_message().end(); ++it) {
+    TestMessageMapLite_MapInt32MessageEntry_DoNotUse::MapEntryWrapper entry(nullptr, it->first, it->second);
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        MessageSizeNoVirtual(entry);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestMessageMapLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestMessageMapLite*>(
+      &from));
+}
+
+void TestMessageMapLite::MergeFrom(const TestMessageMapLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestMessageMapLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  map_int32_message_.MergeFrom(from.map_int32_message_);
+}
+
+void TestMessageMapLite::CopyFrom(const TestMessageMapLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestMessageMapLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestMessageMapLite::IsInitialized() const {
+  return true;
+}
+
+void TestMessageMapLite::Swap(TestMessageMapLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestMessageMapLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestMessageMapLite::UnsafeArenaSwap(TestMessageMapLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestMessageMapLite::InternalSwap(TestMessageMapLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  map_int32_message_.Swap(&other->map_int32_message_);
+}
+
+std::string TestMessageMapLite::GetTypeName() const {
+  return "protobuf_unittest.TestMessageMapLite";
+}
+
+
+// ===================================================================
+
+void TestRequiredLite::InitAsDefaultInstance() {
+}
+class TestRequiredLite::HasBitSetters {
+ public:
+  static void set_has_a(TestRequiredLite* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+  static void set_has_b(TestRequiredLite* msg) {
+    msg->_has_bits_[0] |= 0x00000002u;
+  }
+  static void set_has_c(TestRequiredLite* msg) {
+    msg->_has_bits_[0] |= 0x00000004u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestRequiredLite::kAFieldNumber;
+const int TestRequiredLite::kBFieldNumber;
+const int TestRequiredLite::kCFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestRequiredLite::TestRequiredLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestRequiredLite)
+}
+TestRequiredLite::TestRequiredLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRequiredLite)
+}
+TestRequiredLite::TestRequiredLite(const TestRequiredLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&a_, &from.a_,
+    static_cast<size_t>(reinterpret_cast<char*>(&c_) -
+    reinterpret_cast<char*>(&a_)) + sizeof(c_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRequiredLite)
+}
+
+void TestRequiredLite::SharedCtor() {
+  ::memset(&a_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&c_) -
+      reinterpret_cast<char*>(&a_)) + sizeof(c_));
+}
+
+TestRequiredLite::~TestRequiredLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRequiredLite)
+  SharedDtor();
+}
+
+void TestRequiredLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void TestRequiredLite::ArenaDtor(void* object) {
+  TestRequiredLite* _this = reinterpret_cast< TestRequiredLite* >(object);
+  (void)_this;
+}
+void TestRequiredLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestRequiredLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestRequiredLite& TestRequiredLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestRequiredLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestRequiredLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestRequiredLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&a_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&c_) -
+        reinterpret_cast<char*>(&a_)) + sizeof(c_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestRequiredLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // required int32 a = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_a(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // required int32 b = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 16) goto handle_unusual;
+        set_b(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // required int32 c = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 24) goto handle_unusual;
+        set_c(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestRequiredLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestRequiredLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int32 a = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          HasBitSetters::set_has_a(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &a_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // required int32 b = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+          HasBitSetters::set_has_b(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &b_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // required int32 c = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+          HasBitSetters::set_has_c(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &c_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestRequiredLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestRequiredLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestRequiredLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestRequiredLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required int32 a = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->a(), output);
+  }
+
+  // required int32 b = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(2, this->b(), output);
+  }
+
+  // required int32 c = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(3, this->c(), output);
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestRequiredLite)
+}
+
+size_t TestRequiredLite::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:protobuf_unittest.TestRequiredLite)
+  size_t total_size = 0;
+
+  if (has_a()) {
+    // required int32 a = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->a());
+  }
+
+  if (has_b()) {
+    // required int32 b = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->b());
+  }
+
+  if (has_c()) {
+    // required int32 c = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->c());
+  }
+
+  return total_size;
+}
+size_t TestRequiredLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestRequiredLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required int32 a = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->a());
+
+    // required int32 b = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->b());
+
+    // required int32 c = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->c());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestRequiredLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestRequiredLite*>(
+      &from));
+}
+
+void TestRequiredLite::MergeFrom(const TestRequiredLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestRequiredLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      a_ = from.a_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      b_ = from.b_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      c_ = from.c_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TestRequiredLite::CopyFrom(const TestRequiredLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestRequiredLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestRequiredLite::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+  return true;
+}
+
+void TestRequiredLite::Swap(TestRequiredLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestRequiredLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void TestRequiredLite::UnsafeArenaSwap(TestRequiredLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestRequiredLite::InternalSwap(TestRequiredLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+  swap(b_, other->b_);
+  swap(c_, other->c_);
+}
+
+std::string TestRequiredLite::GetTypeName() const {
+  return "protobuf_unittest.TestRequiredLite";
+}
+
+
+// ===================================================================
+
+void ForeignMessageArenaLite::InitAsDefaultInstance() {
+}
+class ForeignMessageArenaLite::HasBitSetters {
+ public:
+  static void set_has_c(ForeignMessageArenaLite* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ForeignMessageArenaLite::kCFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ForeignMessageArenaLite::ForeignMessageArenaLite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.ForeignMessageArenaLite)
+}
+ForeignMessageArenaLite::ForeignMessageArenaLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+  _internal_metadata_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ForeignMessageArenaLite)
+}
+ForeignMessageArenaLite::ForeignMessageArenaLite(const ForeignMessageArenaLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  c_ = from.c_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.ForeignMessageArenaLite)
+}
+
+void ForeignMessageArenaLite::SharedCtor() {
+  c_ = 0;
+}
+
+ForeignMessageArenaLite::~ForeignMessageArenaLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ForeignMessageArenaLite)
+  SharedDtor();
+}
+
+void ForeignMessageArenaLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaNoVirtual() == nullptr);
+}
+
+void ForeignMessageArenaLite::ArenaDtor(void* object) {
+  ForeignMessageArenaLite* _this = reinterpret_cast< ForeignMessageArenaLite* >(object);
+  (void)_this;
+}
+void ForeignMessageArenaLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ForeignMessageArenaLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ForeignMessageArenaLite& ForeignMessageArenaLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ForeignMessageArenaLite_google_2fprotobuf_2fmap_5flite_5funittest_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ForeignMessageArenaLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ForeignMessageArenaLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  c_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* ForeignMessageArenaLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 c = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_c(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool ForeignMessageArenaLite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.ForeignMessageArenaLite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 c = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          HasBitSetters::set_has_c(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &c_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.ForeignMessageArenaLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.ForeignMessageArenaLite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void ForeignMessageArenaLite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.ForeignMessageArenaLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 c = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->c(), output);
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.ForeignMessageArenaLite)
+}
+
+size_t ForeignMessageArenaLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ForeignMessageArenaLite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 c = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->c());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ForeignMessageArenaLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ForeignMessageArenaLite*>(
+      &from));
+}
+
+void ForeignMessageArenaLite::MergeFrom(const ForeignMessageArenaLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ForeignMessageArenaLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_c()) {
+    set_c(from.c());
+  }
+}
+
+void ForeignMessageArenaLite::CopyFrom(const ForeignMessageArenaLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ForeignMessageArenaLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ForeignMessageArenaLite::IsInitialized() const {
+  return true;
+}
+
+void ForeignMessageArenaLite::Swap(ForeignMessageArenaLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    ForeignMessageArenaLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == nullptr) {
+      delete temp;
+    }
+  }
+}
+void ForeignMessageArenaLite::UnsafeArenaSwap(ForeignMessageArenaLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void ForeignMessageArenaLite::InternalSwap(ForeignMessageArenaLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(c_, other->c_);
+}
+
+std::string ForeignMessageArenaLite::GetTypeName() const {
+  return "protobuf_unittest.ForeignMessageArenaLite";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMapLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMapLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMapLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageNoArenaEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestArenaMapLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestArenaMapLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestArenaMapLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestRequiredMessageMapLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestRequiredMessageMapLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestRequiredMessageMapLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEnumMapLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEnumMapLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEnumMapLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEnumMapPlusExtraLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEnumMapPlusExtraLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEnumMapPlusExtraLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestMessageMapLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestMessageMapLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestMessageMapLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestRequiredLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestRequiredLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestRequiredLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::ForeignMessageArenaLite* Arena::CreateMaybeMessage< ::protobuf_unittest::ForeignMessageArenaLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::ForeignMessageArenaLite >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1015,6 +1015,12 @@ class MapFieldReflectionTest : public testing::Test {
               const Message& message) {
     return reflection->MapSize(message, field);
   }
+
+  const MapFieldBase* GetMapData(const Reflection* reflection,
+                                 const FieldDescriptor* field,
+                                 const Message& message) {
+    return reflection->GetMapData(message, field);
+  }
 };
 
 TEST_F(MapFieldReflectionTest, RegularFields) {
@@ -1825,6 +1831,35 @@ TEST_F(MapFieldReflectionTest, RepeatedFieldRefMergeFromAndSwap) {
   // TODO(teboring): add test for duplicated key
 }
 
+TEST_F(MapFieldReflectionTest, DeterministicSerializationKeepsRepeatedField) {
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> message(
+      factory.GetPrototype(unittest::TestMap::descriptor())->New());
+  MapReflectionTester reflection_tester(unittest::TestMap::descriptor());
+  reflection_tester.SetMapFieldsViaMapReflection(message.get());
+  const Reflection* reflection = message->GetReflection();
+  const FieldDescriptor* field =
+      unittest::TestMap::descriptor()->FindFieldByName("map_int32_int32");
+
+  // Reading the map as a repeated field synchronizes the two.
+  reflection->GetRepeatedMessage(*message, field, 0);
+  EXPECT_TRUE(GetMapData(reflection, field, *message)->IsRepeatedFieldValid());
+
+  std::string data;
+  {
+    io::StringOutputStream output_stream(&data);
+    io::CodedOutputStream output(&output_stream);
+    output.SetSerializationDeterministic(true);
+    WireFormat::SerializeWithCachedSizes(
+        *message, static_cast<int>(message->ByteSizeLong()), &output);
+  }
+  EXPECT_TRUE(GetMapData(reflection, field, *message)->IsRepeatedFieldValid());
+
+  unittest::TestMap parsed;
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  reflection_tester.ExpectMapFieldsSetViaReflection(parsed);
+}
+
 TEST_F(MapFieldReflectionTest, MapSizeWithDuplicatedKey) {
   // Dynamic Message
   {
@@ -3292,6 +3327,28 @@ TEST(TextFormatMapTest, Sorted) {
   EXPECT_EQ(message2.DebugString(), expected_text);
 }
 
+// Maps that were only modified through the generated API are printed straight
+// from their elements; entries must still come out sorted by key.
+TEST(TextFormatMapTest, SortedWithoutRepeatedField) {
+  unittest::TestMap message;
+  (*message.mutable_map_string_foreign_message())["b"].set_c(2);
+  (*message.mutable_map_string_foreign_message())["a"].set_c(1);
+  (*message.mutable_map_string_foreign_message())["c"];
+
+  std::string output;
+  TextFormat::Printer printer;
+  printer.SetSingleLineMode(true);
+  printer.PrintToString(message, &output);
+  EXPECT_EQ(
+      "map_string_foreign_message { key: \"a\" value { c: 1 } } "
+      "map_string_foreign_message { key: \"b\" value { c: 2 } } "
+      "map_string_foreign_message { key: \"c\" value { } } ",
+      output);
+  // Printing must not modify the message.
+  EXPECT_EQ(3, message.map_string_foreign_message().size());
+  EXPECT_EQ(2, message.map_string_foreign_message().at("b").c());
+}
+
 TEST(TextFormatMapTest, ParseCorruptedString) {
   std::string serialized_message;
   GOOGLE_CHECK_OK(
@@ -166,6 +166,9 @@ class CelMapReflectionFriend;  // field_backed_map_impl.cc
 namespace internal {
 class MapFieldPrinterHelper;   // text_format.cc
 }
+namespace util {
+class MessageHasher;           // util/message_hasher.h
+}
 
 
 namespace internal {
@@ -981,6 +984,8 @@ class PROTOBUF_EXPORT Reflection {
   // Needed for implementing text format for map.
   friend class internal::MapFieldPrinterHelper;
   friend class internal::ReflectionAccessor;
+  // Needed for hashing maps without syncing their repeated field view.
+  friend class util::MessageHasher;
 
   // Special version for specialized implementations of string.  We can't
   // call MutableRawRepeatedField directly here because we don't have access to
@@ -87,6 +87,7 @@ class Message;
 namespace internal {
 
 class MergePartialFromCodedStreamHelper;
+class ReflectionInternals;  // generated_message_reflection.h
 
 static const int kMinRepeatedFieldAllocationSize = 4;
 
@@ -657,6 +658,10 @@ class PROTOBUF_EXPORT RepeatedPtrFieldBase {
 
   friend class AccessorHelper;
 
+  // Reports kRepHeaderSize for attributing the memory of RepeatedPtrFields
+  // without walking their elements.
+  friend class ReflectionInternals;
+
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(RepeatedPtrFieldBase);
 };
 
@@ -32,6 +32,7 @@
 // Author: xpeng@google.com (Peter Peng)
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stringpiece.h>
 #include <gtest/gtest.h>
 
 namespace google {
@@ -64,6 +65,67 @@ TEST(StructurallyValidTest, InvalidUTF8String) {
   }
 }
 
+TEST(StructurallyValidTest, LongStrings) {
+  // Long enough to go through the vectorized scan, with ASCII runs and
+  // characters of every length crossing block boundaries.
+  string valid_str;
+  for (int i = 0; i < 20; ++i) {
+    valid_str += "abcdefghijklmnopqrstuvwxyz0123456789";
+    valid_str += "\303\251\342\202\254\360\237\230\200 ";
+  }
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_TRUE(IsStructurallyValidUTF8(valid_str.data() + i,
+                                        valid_str.size() - i));
+    EXPECT_EQ(valid_str.size() - i,
+              UTF8SpnStructurallyValid(StringPiece(valid_str.data() + i,
+                                                   valid_str.size() - i)));
+  }
+
+  // An invalid byte anywhere ends the valid span right before it.
+  for (int i = 0; i < valid_str.size(); ++i) {
+    if ((valid_str[i] & 0xc0) == 0x80) continue;
+    string invalid_str = valid_str;
+    invalid_str[i] = '\377';
+    EXPECT_FALSE(IsStructurallyValidUTF8(invalid_str.data(),
+                                         invalid_str.size()));
+    EXPECT_EQ(i, UTF8SpnStructurallyValid(invalid_str));
+  }
+
+  // A truncated character at the end is not part of the valid span.
+  string truncated_str = valid_str + "\360\237\230";
+  EXPECT_FALSE(IsStructurallyValidUTF8(truncated_str.data(),
+                                       truncated_str.size()));
+  EXPECT_EQ(valid_str.size(), UTF8SpnStructurallyValid(truncated_str));
+}
+
+TEST(StructurallyValidTest, InvalidSequences) {
+  // Overlong encodings, surrogates, code points above U+10FFFF and stray
+  // continuation bytes, each embedded in a long ASCII string.
+  const char* const kInvalid[] = {
+      "\300\200",         "\301\277",         "\340\200\200",
+      "\340\237\277",     "\355\240\200",     "\355\277\277",
+      "\360\200\200\200", "\360\217\277\277", "\364\220\200\200",
+      "\365\200\200\200", "\377",             "\200",
+      "\302",             "\342\202",         "\302\302\251",
+  };
+  const string padding(40, 'x');
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kInvalid); ++i) {
+    string str = padding + kInvalid[i] + padding;
+    EXPECT_FALSE(IsStructurallyValidUTF8(str.data(), str.size())) << i;
+    EXPECT_EQ(padding.size(), UTF8SpnStructurallyValid(str)) << i;
+  }
+
+  const char* const kValid[] = {
+      "\302\200",         "\337\277",         "\340\240\200",
+      "\355\237\277",     "\356\200\200",     "\357\277\277",
+      "\360\220\200\200", "\364\217\277\277",
+  };
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kValid); ++i) {
+    string str = padding + kValid[i] + padding;
+    EXPECT_TRUE(IsStructurallyValidUTF8(str.data(), str.size())) << i;
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace protobuf
@@ -36,10 +36,12 @@
 #include <float.h>    // FLT_DIG and DBL_DIG
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <cmath>
 #include <iterator>
 #include <limits>
 
+#include <google/protobuf/stubs/casts.h>
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/stl_util.h>
 #include <google/protobuf/io/strtod.h>
@@ -58,6 +60,8 @@
 #define snprintf _snprintf
 #endif
 
+#include <google/protobuf/port_def.inc>
+
 namespace google {
 namespace protobuf {
 
@@ -1188,30 +1192,20 @@ string SimpleItoa(unsigned long long i) {
 //    It turns out there is no precision value that does the right thing
 //    for all numbers.
 //
-//    Our strategy is to first try printing with a precision that is never
-//    over-precise, then parse the result with strtod() to see if it
-//    matches.  If not, we print again with a precision that will always
-//    give a precise result, but may use more digits than necessary.
-//
-//    An arguably better strategy would be to use the algorithm described
-//    in "How to Print Floating-Point Numbers Accurately" by Steele &
-//    White, e.g. as implemented by David M. Gay's dtoa().  It turns out,
-//    however, that the following implementation is about as fast as
-//    DMG's code.  Furthermore, DMG's code locks mutexes, which means it
-//    will not scale well on multi-core machines.  DMG's code is slightly
-//    more accurate (in that it will never use more digits than
-//    necessary), but this is probably irrelevant for most users.
+//    We generate the shortest digits that parse back to the same value with
+//    Grisu3, from "Printing Floating-Point Numbers Quickly and Accurately
+//    with Integers" by Florian Loitsch.  It only uses integer arithmetic on
+//    64-bit significands, so it neither allocates nor depends on the locale.
+//    For about 0.5% of values it cannot prove that its digits are the
+//    shortest and gives up; for those we print with snprintf() at
+//    increasing precisions and parse the result with strtod() until it
+//    matches.
 //
-//    Rob Pike and Ken Thompson also have an implementation of dtoa() in
-//    third_party/fmt/fltfmt.cc.  Their implementation is similar to this
-//    one in that it makes guesses and then uses strtod() to check them.
-//    Their implementation is faster because they use their own code to
-//    generate the digits in the first place rather than use snprintf(),
-//    thus avoiding format string parsing overhead.  However, this makes
-//    it considerably more complicated than the following implementation,
-//    and it is embedded in a larger library.  If speed turns out to be
-//    an issue, we could re-implement this in terms of their
-//    implementation.
+//    The digits are then laid out the way "%.15g" (DBL_DIG) would for
+//    values which need at most 15 digits, and the way "%.17g" would for the
+//    others; "%.6g" and "%.9g" for floats.  This is how we printed values
+//    before we generated the digits ourselves, so the output only changed
+//    for values where "%.17g" printed more digits than needed.
 // ----------------------------------------------------------------------
 
 string SimpleDtoa(double value) {
@@ -1257,6 +1251,353 @@ void DelocalizeRadix(char* buffer) {
   }
 }
 
+// A floating point number f * 2^e with a 64-bit significand.
+struct DiyFp {
+  uint64 f;
+  int e;
+};
+
+static inline DiyFp MakeDiyFp(uint64 f, int e) {
+  DiyFp result;
+  result.f = f;
+  result.e = e;
+  return result;
+}
+
+static inline DiyFp NormalizeDiyFp(DiyFp x) {
+  while ((x.f & (static_cast<uint64>(1) << 63)) == 0) {
+    x.f <<= 1;
+    --x.e;
+  }
+  return x;
+}
+
+// Returns x * y with the product's significand rounded to 64 bits.
+static inline DiyFp MultiplyDiyFp(DiyFp x, DiyFp y) {
+  const uint64 kMask32 = 0xFFFFFFFFu;
+  const uint64 a = x.f >> 32;
+  const uint64 b = x.f & kMask32;
+  const uint64 c = y.f >> 32;
+  const uint64 d = y.f & kMask32;
+  const uint64 ac = a * c;
+  const uint64 bc = b * c;
+  const uint64 ad = a * d;
+  const uint64 bd = b * d;
+  uint64 tmp = (bd >> 32) + (ad & kMask32) + (bc & kMask32);
+  tmp += static_cast<uint64>(1) << 31;  // Round.
+  return MakeDiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64);
+}
+
+// Normalized approximations of 10^-348, 10^-340, ..., 10^340.
+struct CachedPowerOfTen {
+  uint64 significand;
+  int16 binary_exponent;
+  int16 decimal_exponent;
+};
+
+static const CachedPowerOfTen kCachedPowersOfTen[] = {
+    {PROTOBUF_ULONGLONG(0xfa8fd5a0081c0288), -1220, -348},
+    {PROTOBUF_ULONGLONG(0xbaaee17fa23ebf76), -1193, -340},
+    {PROTOBUF_ULONGLONG(0x8b16fb203055ac76), -1166, -332},
+    {PROTOBUF_ULONGLONG(0xcf42894a5dce35ea), -1140, -324},
+    {PROTOBUF_ULONGLONG(0x9a6bb0aa55653b2d), -1113, -316},
+    {PROTOBUF_ULONGLONG(0xe61acf033d1a45df), -1087, -308},
+    {PROTOBUF_ULONGLONG(0xab70fe17c79ac6ca), -1060, -300},
+    {PROTOBUF_ULONGLONG(0xff77b1fcbebcdc4f), -1034, -292},
+    {PROTOBUF_ULONGLONG(0xbe5691ef416bd60c), -1007, -284},
+    {PROTOBUF_ULONGLONG(0x8dd01fad907ffc3c), -980, -276},
+    {PROTOBUF_ULONGLONG(0xd3515c2831559a83), -954, -268},
+    {PROTOBUF_ULONGLONG(0x9d71ac8fada6c9b5), -927, -260},
+    {PROTOBUF_ULONGLONG(0xea9c227723ee8bcb), -901, -252},
+    {PROTOBUF_ULONGLONG(0xaecc49914078536d), -874, -244},
+    {PROTOBUF_ULONGLONG(0x823c12795db6ce57), -847, -236},
+    {PROTOBUF_ULONGLONG(0xc21094364dfb5637), -821, -228},
+    {PROTOBUF_ULONGLONG(0x9096ea6f3848984f), -794, -220},
+    {PROTOBUF_ULONGLONG(0xd77485cb25823ac7), -768, -212},
+    {PROTOBUF_ULONGLONG(0xa086cfcd97bf97f4), -741, -204},
+    {PROTOBUF_ULONGLONG(0xef340a98172aace5), -715, -196},
+    {PROTOBUF_ULONGLONG(0xb23867fb2a35b28e), -688, -188},
+    {PROTOBUF_ULONGLONG(0x84c8d4dfd2c63f3b), -661, -180},
+    {PROTOBUF_ULONGLONG(0xc5dd44271ad3cdba), -635, -172},
+    {PROTOBUF_ULONGLONG(0x936b9fcebb25c996), -608, -164},
+    {PROTOBUF_ULONGLONG(0xdbac6c247d62a584), -582, -156},
+    {PROTOBUF_ULONGLONG(0xa3ab66580d5fdaf6), -555, -148},
+    {PROTOBUF_ULONGLONG(0xf3e2f893dec3f126), -529, -140},
+    {PROTOBUF_ULONGLONG(0xb5b5ada8aaff80b8), -502, -132},
+    {PROTOBUF_ULONGLONG(0x87625f056c7c4a8b), -475, -124},
+    {PROTOBUF_ULONGLONG(0xc9bcff6034c13053), -449, -116},
+    {PROTOBUF_ULONGLONG(0x964e858c91ba2655), -422, -108},
+    {PROTOBUF_ULONGLONG(0xdff9772470297ebd), -396, -100},
+    {PROTOBUF_ULONGLONG(0xa6dfbd9fb8e5b88f), -369, -92},
+    {PROTOBUF_ULONGLONG(0xf8a95fcf88747d94), -343, -84},
+    {PROTOBUF_ULONGLONG(0xb94470938fa89bcf), -316, -76},
+    {PROTOBUF_ULONGLONG(0x8a08f0f8bf0f156b), -289, -68},
+    {PROTOBUF_ULONGLONG(0xcdb02555653131b6), -263, -60},
+    {PROTOBUF_ULONGLONG(0x993fe2c6d07b7fac), -236, -52},
+    {PROTOBUF_ULONGLONG(0xe45c10c42a2b3b06), -210, -44},
+    {PROTOBUF_ULONGLONG(0xaa242499697392d3), -183, -36},
+    {PROTOBUF_ULONGLONG(0xfd87b5f28300ca0e), -157, -28},
+    {PROTOBUF_ULONGLONG(0xbce5086492111aeb), -130, -20},
+    {PROTOBUF_ULONGLONG(0x8cbccc096f5088cc), -103, -12},
+    {PROTOBUF_ULONGLONG(0xd1b71758e219652c), -77, -4},
+    {PROTOBUF_ULONGLONG(0x9c40000000000000), -50, 4},
+    {PROTOBUF_ULONGLONG(0xe8d4a51000000000), -24, 12},
+    {PROTOBUF_ULONGLONG(0xad78ebc5ac620000), 3, 20},
+    {PROTOBUF_ULONGLONG(0x813f3978f8940984), 30, 28},
+    {PROTOBUF_ULONGLONG(0xc097ce7bc90715b3), 56, 36},
+    {PROTOBUF_ULONGLONG(0x8f7e32ce7bea5c70), 83, 44},
+    {PROTOBUF_ULONGLONG(0xd5d238a4abe98068), 109, 52},
+    {PROTOBUF_ULONGLONG(0x9f4f2726179a2245), 136, 60},
+    {PROTOBUF_ULONGLONG(0xed63a231d4c4fb27), 162, 68},
+    {PROTOBUF_ULONGLONG(0xb0de65388cc8ada8), 189, 76},
+    {PROTOBUF_ULONGLONG(0x83c7088e1aab65db), 216, 84},
+    {PROTOBUF_ULONGLONG(0xc45d1df942711d9a), 242, 92},
+    {PROTOBUF_ULONGLONG(0x924d692ca61be758), 269, 100},
+    {PROTOBUF_ULONGLONG(0xda01ee641a708dea), 295, 108},
+    {PROTOBUF_ULONGLONG(0xa26da3999aef774a), 322, 116},
+    {PROTOBUF_ULONGLONG(0xf209787bb47d6b85), 348, 124},
+    {PROTOBUF_ULONGLONG(0xb454e4a179dd1877), 375, 132},
+    {PROTOBUF_ULONGLONG(0x865b86925b9bc5c2), 402, 140},
+    {PROTOBUF_ULONGLONG(0xc83553c5c8965d3d), 428, 148},
+    {PROTOBUF_ULONGLONG(0x952ab45cfa97a0b3), 455, 156},
+    {PROTOBUF_ULONGLONG(0xde469fbd99a05fe3), 481, 164},
+    {PROTOBUF_ULONGLONG(0xa59bc234db398c25), 508, 172},
+    {PROTOBUF_ULONGLONG(0xf6c69a72a3989f5c), 534, 180},
+    {PROTOBUF_ULONGLONG(0xb7dcbf5354e9bece), 561, 188},
+    {PROTOBUF_ULONGLONG(0x88fcf317f22241e2), 588, 196},
+    {PROTOBUF_ULONGLONG(0xcc20ce9bd35c78a5), 614, 204},
+    {PROTOBUF_ULONGLONG(0x98165af37b2153df), 641, 212},
+    {PROTOBUF_ULONGLONG(0xe2a0b5dc971f303a), 667, 220},
+    {PROTOBUF_ULONGLONG(0xa8d9d1535ce3b396), 694, 228},
+    {PROTOBUF_ULONGLONG(0xfb9b7cd9a4a7443c), 720, 236},
+    {PROTOBUF_ULONGLONG(0xbb764c4ca7a44410), 747, 244},
+    {PROTOBUF_ULONGLONG(0x8bab8eefb6409c1a), 774, 252},
+    {PROTOBUF_ULONGLONG(0xd01fef10a657842c), 800, 260},
+    {PROTOBUF_ULONGLONG(0x9b10a4e5e9913129), 827, 268},
+    {PROTOBUF_ULONGLONG(0xe7109bfba19c0c9d), 853, 276},
+    {PROTOBUF_ULONGLONG(0xac2820d9623bf429), 880, 284},
+    {PROTOBUF_ULONGLONG(0x80444b5e7aa7cf85), 907, 292},
+    {PROTOBUF_ULONGLONG(0xbf21e44003acdd2d), 933, 300},
+    {PROTOBUF_ULONGLONG(0x8e679c2f5e44ff8f), 960, 308},
+    {PROTOBUF_ULONGLONG(0xd433179d9c8cb841), 986, 316},
+    {PROTOBUF_ULONGLONG(0x9e19db92b4e31ba9), 1013, 324},
+    {PROTOBUF_ULONGLONG(0xeb96bf6ebadf77d9), 1039, 332},
+    {PROTOBUF_ULONGLONG(0xaf87023b9bf0ee6b), 1066, 340},
+};
+
+static const int kCachedPowersOfTenOffset = 348;  // -1 * the first exponent.
+static const int kCachedPowersOfTenDistance = 8;  // Decimal exponent step.
+
+// The scaled value is kept in [2^(kMinimalTargetExponent + 64),
+// 2^(kMaximalTargetExponent + 64)), so its integral part fits in 32 bits.
+static const int kMinimalTargetExponent = -60;
+static const int kMaximalTargetExponent = -32;
+
+// Returns the cached power of ten 10^*decimal_exponent whose product with a
+// normalized DiyFp of exponent "e" lands in the target exponent range.
+static DiyFp CachedPowerForExponent(int e, int* decimal_exponent) {
+  const int min_exponent = kMinimalTargetExponent - (e + 64);
+  // log10(2) = 0.30102999566398114
+  const int k = static_cast<int>(
+      std::ceil((min_exponent + 63) * 0.30102999566398114));
+  const int index =
+      (kCachedPowersOfTenOffset + k - 1) / kCachedPowersOfTenDistance + 1;
+  const CachedPowerOfTen& power = kCachedPowersOfTen[index];
+  GOOGLE_DCHECK_GE(e + power.binary_exponent + 64, kMinimalTargetExponent);
+  GOOGLE_DCHECK_LE(e + power.binary_exponent + 64, kMaximalTargetExponent);
+  *decimal_exponent = power.decimal_exponent;
+  return MakeDiyFp(power.significand, power.binary_exponent);
+}
+
+// Moves the last generated digit towards the value as long as the digits
+// stay within the rounding interval, and returns whether the result is
+// provably the closest shortest representation.
+static bool RoundWeed(char* digits, int length, uint64 distance_too_high_w,
+                      uint64 unsafe_interval, uint64 rest, uint64 ten_kappa,
+                      uint64 unit) {
+  const uint64 small_distance = distance_too_high_w - unit;
+  const uint64 big_distance = distance_too_high_w + unit;
+  while (rest < small_distance &&
+         unsafe_interval - rest >= ten_kappa &&
+         (rest + ten_kappa < small_distance ||
+          small_distance - rest >= rest + ten_kappa - small_distance)) {
+    --digits[length - 1];
+    rest += ten_kappa;
+  }
+  if (rest < big_distance &&
+      unsafe_interval - rest >= ten_kappa &&
+      (rest + ten_kappa < big_distance ||
+       big_distance - rest > rest + ten_kappa - big_distance)) {
+    return false;
+  }
+  return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+// Generates the shortest digits of the value "w" within the interval
+// (low, high), and sets *kappa so that the value is digits * 10^*kappa.
+static bool DigitGen(DiyFp low, DiyFp w, DiyFp high, char* digits,
+                     int* length, int* kappa) {
+  static const uint32 kSmallPowersOfTen[] = {
+      0, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+      1000000000};
+
+  uint64 unit = 1;
+  const DiyFp too_low = MakeDiyFp(low.f - unit, low.e);
+  const DiyFp too_high = MakeDiyFp(high.f + unit, high.e);
+  uint64 unsafe_interval = too_high.f - too_low.f;
+  const int one_shift = -w.e;
+  const uint64 one = static_cast<uint64>(1) << one_shift;
+  uint32 integrals = static_cast<uint32>(too_high.f >> one_shift);
+  uint64 fractionals = too_high.f & (one - 1);
+
+  // The largest power of ten not larger than integrals.
+  const int integral_bits = 64 - one_shift;
+  int divisor_exponent_plus_one = ((integral_bits + 1) * 1233 >> 12) + 1;
+  if (integrals < kSmallPowersOfTen[divisor_exponent_plus_one]) {
+    --divisor_exponent_plus_one;
+  }
+  uint32 divisor = kSmallPowersOfTen[divisor_exponent_plus_one];
+
+  *kappa = divisor_exponent_plus_one;
+  *length = 0;
+  while (*kappa > 0) {
+    digits[(*length)++] = '0' + integrals / divisor;
+    integrals %= divisor;
+    --*kappa;
+    const uint64 rest =
+        (static_cast<uint64>(integrals) << one_shift) + fractionals;
+    if (rest < unsafe_interval) {
+      return RoundWeed(digits, *length, too_high.f - w.f, unsafe_interval,
+                       rest, static_cast<uint64>(divisor) << one_shift, unit);
+    }
+    divisor /= 10;
+  }
+  for (;;) {
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+    digits[(*length)++] = '0' + static_cast<int>(fractionals >> one_shift);
+    fractionals &= one - 1;
+    --*kappa;
+    if (fractionals < unsafe_interval) {
+      return RoundWeed(digits, *length, (too_high.f - w.f) * unit,
+                       unsafe_interval, fractionals, one, unit);
+    }
+  }
+}
+
+// Sets digits * 10^*decimal_exponent to the shortest decimal which lies
+// within the rounding interval of the positive value significand *
+// 2^exponent, or returns false if it could not be determined.
+// "lower_boundary_is_closer" is true for powers of two, whose predecessor is
+// closer than their successor.
+static bool Grisu3(uint64 significand, int exponent,
+                   bool lower_boundary_is_closer, char* digits, int* length,
+                   int* decimal_exponent) {
+  const DiyFp w = NormalizeDiyFp(MakeDiyFp(significand, exponent));
+  const DiyFp plus =
+      NormalizeDiyFp(MakeDiyFp((significand << 1) + 1, exponent - 1));
+  DiyFp minus = lower_boundary_is_closer
+                    ? MakeDiyFp((significand << 2) - 1, exponent - 2)
+                    : MakeDiyFp((significand << 1) - 1, exponent - 1);
+  minus.f <<= minus.e - plus.e;
+  minus.e = plus.e;
+
+  int mk;
+  const DiyFp ten_mk = CachedPowerForExponent(w.e, &mk);
+  int kappa;
+  const bool result = DigitGen(
+      MultiplyDiyFp(minus, ten_mk), MultiplyDiyFp(w, ten_mk),
+      MultiplyDiyFp(plus, ten_mk), digits, length, &kappa);
+  *decimal_exponent = kappa - mk;
+  return result;
+}
+
+// The buffer for the digits of a double or float.
+static const int kShortestDigitsSize = 20;
+
+// Prints a positive "value" with snprintf() and "%.*e", at increasing
+// precisions starting from the one which never prints too many digits,
+// until the result parses back to "value", and extracts the digits from it.
+template <typename T>
+static void ShortestDigitsWithPrintf(T value, char* digits, int* length,
+                                     int* decimal_exponent) {
+  const bool is_float = sizeof(T) == sizeof(float);
+  const int max_precision = is_float ? FLT_DIG + 3 : DBL_DIG + 2;
+  char buffer[kDoubleToBufferSize];
+  for (int precision = is_float ? FLT_DIG : DBL_DIG;; ++precision) {
+    snprintf(buffer, sizeof(buffer), "%.*e", precision - 1,
+             static_cast<double>(value));
+    if (precision == max_precision) break;
+    if (is_float) {
+      float parsed_value;
+      if (safe_strtof(buffer, &parsed_value) && parsed_value == value) break;
+    } else {
+      // See DoubleToBuffer() for why this is volatile.
+      volatile double parsed_value = io::NoLocaleStrtod(buffer, nullptr);
+      if (parsed_value == value) break;
+    }
+  }
+  // The buffer holds the digits with a radix character after the first one,
+  // which depends on the locale, followed by "e" and the exponent.
+  const char* p = buffer;
+  *length = 0;
+  for (; *p != 'e'; ++p) {
+    if (ascii_isdigit(*p)) digits[(*length)++] = *p;
+  }
+  *decimal_exponent = atoi(p + 1) - (*length - 1);
+}
+
+// Writes digits * 10^decimal_exponent to "buffer" the way printf() would with
+// "%.*g" and "precision".
+static char* FormatShortestDigits(bool negative, char* digits, int length,
+                                  int decimal_exponent, int precision,
+                                  char* buffer) {
+  while (length > 1 && digits[length - 1] == '0') {
+    --length;
+    ++decimal_exponent;
+  }
+
+  char* p = buffer;
+  if (negative) *p++ = '-';
+  // The exponent of the value in scientific notation.
+  const int exponent = decimal_exponent + length - 1;
+  if (exponent < -4 || exponent >= precision) {
+    *p++ = digits[0];
+    if (length > 1) {
+      *p++ = '.';
+      memcpy(p, digits + 1, length - 1);
+      p += length - 1;
+    }
+    *p++ = 'e';
+    *p++ = exponent < 0 ? '-' : '+';
+    const int abs_exponent = exponent < 0 ? -exponent : exponent;
+    if (abs_exponent < 10) *p++ = '0';
+    FastUInt32ToBufferLeft(abs_exponent, p);
+    return buffer;
+  }
+
+  if (exponent < 0) {
+    *p++ = '0';
+    *p++ = '.';
+    for (int i = -1; i > exponent; --i) *p++ = '0';
+    memcpy(p, digits, length);
+    p += length;
+  } else if (exponent >= length - 1) {
+    memcpy(p, digits, length);
+    p += length;
+    for (int i = length - 1; i < exponent; ++i) *p++ = '0';
+  } else {
+    memcpy(p, digits, exponent + 1);
+    p += exponent + 1;
+    *p++ = '.';
+    memcpy(p, digits + exponent + 1, length - exponent - 1);
+    p += length - exponent - 1;
+  }
+  *p = '\0';
+  return buffer;
+}
+
 char* DoubleToBuffer(double value, char* buffer) {
   // DBL_DIG is 15 for IEEE-754 doubles, which are used on almost all
   // platforms these days.  Just in case some system exists where DBL_DIG
@@ -1273,32 +1614,34 @@ char* DoubleToBuffer(double value, char* buffer) {
   } else if (std::isnan(value)) {
     strcpy(buffer, "nan");
     return buffer;
+  } else if (value == 0) {
+    strcpy(buffer, std::signbit(value) ? "-0" : "0");
+    return buffer;
   }
 
-  int snprintf_result =
-    snprintf(buffer, kDoubleToBufferSize, "%.*g", DBL_DIG, value);
-
-  // The snprintf should never overflow because the buffer is significantly
-  // larger than the precision we asked for.
-  GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kDoubleToBufferSize);
-
-  // We need to make parsed_value volatile in order to force the compiler to
-  // write it out to the stack.  Otherwise, it may keep the value in a
-  // register, and if it does that, it may keep it as a long double instead
-  // of a double.  This long double may have extra bits that make it compare
-  // unequal to "value" even though it would be exactly equal if it were
-  // truncated to a double.
-  volatile double parsed_value = io::NoLocaleStrtod(buffer, nullptr);
-  if (parsed_value != value) {
-    int snprintf_result =
-      snprintf(buffer, kDoubleToBufferSize, "%.*g", DBL_DIG+2, value);
-
-    // Should never overflow; see above.
-    GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kDoubleToBufferSize);
+  const uint64 bits = bit_cast<uint64>(value);
+  const bool negative = (bits >> 63) != 0;
+  const int biased_exponent = static_cast<int>((bits >> 52) & 0x7FF);
+  uint64 significand = bits & ((static_cast<uint64>(1) << 52) - 1);
+  const bool lower_boundary_is_closer =
+      significand == 0 && biased_exponent > 1;
+  int exponent = -1074;
+  if (biased_exponent != 0) {
+    significand |= static_cast<uint64>(1) << 52;
+    exponent = biased_exponent - 1075;
   }
 
-  DelocalizeRadix(buffer);
-  return buffer;
+  char digits[kShortestDigitsSize];
+  int length;
+  int decimal_exponent;
+  if (!Grisu3(significand, exponent, lower_boundary_is_closer, digits,
+              &length, &decimal_exponent)) {
+    ShortestDigitsWithPrintf(std::fabs(value), digits, &length,
+                             &decimal_exponent);
+  }
+  return FormatShortestDigits(negative, digits, length, decimal_exponent,
+                              length <= DBL_DIG ? DBL_DIG : DBL_DIG + 2,
+                              buffer);
 }
 
 static int memcasecmp(const char *s1, const char *s2, size_t len) {
@@ -1359,6 +1702,14 @@ bool safe_strtod(const char* str, double* value) {
   return *str != '\0' && *endptr == '\0';
 }
 
+bool safe_strtod(StringPiece str, double* value) {
+  size_t end = io::NoLocaleStrtod(str, value);
+  if (end != 0) {
+    while (end < str.size() && ascii_isspace(str[end])) ++end;
+  }
+  return !str.empty() && end == str.size();
+}
+
 bool safe_strto32(const string& str, int32* value) {
   return safe_int_internal(str, value);
 }
@@ -1391,26 +1742,34 @@ char* FloatToBuffer(float value, char* buffer) {
   } else if (std::isnan(value)) {
     strcpy(buffer, "nan");
     return buffer;
+  } else if (value == 0) {
+    strcpy(buffer, std::signbit(value) ? "-0" : "0");
+    return buffer;
   }
 
-  int snprintf_result =
-    snprintf(buffer, kFloatToBufferSize, "%.*g", FLT_DIG, value);
-
-  // The snprintf should never overflow because the buffer is significantly
-  // larger than the precision we asked for.
-  GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kFloatToBufferSize);
-
-  float parsed_value;
-  if (!safe_strtof(buffer, &parsed_value) || parsed_value != value) {
-    int snprintf_result =
-      snprintf(buffer, kFloatToBufferSize, "%.*g", FLT_DIG+3, value);
-
-    // Should never overflow; see above.
-    GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kFloatToBufferSize);
+  const uint32 bits = bit_cast<uint32>(value);
+  const bool negative = (bits >> 31) != 0;
+  const int biased_exponent = static_cast<int>((bits >> 23) & 0xFF);
+  uint32 significand = bits & ((1u << 23) - 1);
+  const bool lower_boundary_is_closer =
+      significand == 0 && biased_exponent > 1;
+  int exponent = -149;
+  if (biased_exponent != 0) {
+    significand |= 1u << 23;
+    exponent = biased_exponent - 150;
   }
 
-  DelocalizeRadix(buffer);
-  return buffer;
+  char digits[kShortestDigitsSize];
+  int length;
+  int decimal_exponent;
+  if (!Grisu3(significand, exponent, lower_boundary_is_closer, digits,
+              &length, &decimal_exponent)) {
+    ShortestDigitsWithPrintf(std::fabs(value), digits, &length,
+                             &decimal_exponent);
+  }
+  return FormatShortestDigits(negative, digits, length, decimal_exponent,
+                              length <= FLT_DIG ? FLT_DIG : FLT_DIG + 3,
+                              buffer);
 }
 
 namespace strings {
@@ -2410,3 +2769,5 @@ void CleanStringLineEndings(string *str, bool auto_end_last_line) {
 
 }  // namespace protobuf
 }  // namespace google
+
+#include <google/protobuf/port_undef.inc>
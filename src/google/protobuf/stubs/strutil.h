@@ -435,9 +435,7 @@ inline bool safe_strtod(const string& str, double* value) {
 inline bool safe_strtof(StringPiece str, float* value) {
   return safe_strtof(str.ToString(), value);
 }
-inline bool safe_strtod(StringPiece str, double* value) {
-  return safe_strtod(str.ToString(), value);
-}
+PROTOBUF_EXPORT bool safe_strtod(StringPiece str, double* value);
 
 // ----------------------------------------------------------------------
 // FastIntToBuffer()
@@ -547,8 +545,8 @@ PROTOBUF_EXPORT string SimpleItoa(unsigned long long i);
 //    Description: converts a double or float to a string which, if
 //    passed to NoLocaleStrtod(), will produce the exact same original double
 //    (except in case of NaN; all NaNs are considered the same value).
-//    We try to keep the string short but it's not guaranteed to be as
-//    short as possible.
+//    The string has as few significant digits as possible, and does not
+//    depend on the current locale.
 //
 //    DoubleToBuffer() and FloatToBuffer() write the text to the given
 //    buffer and return it.  The buffer must be at least
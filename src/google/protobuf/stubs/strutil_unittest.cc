@@ -33,7 +33,10 @@
 #include <google/protobuf/stubs/strutil.h>
 
 #include <locale.h>
+#include <cmath>
+#include <limits>
 
+#include <google/protobuf/io/strtod.h>
 #include <google/protobuf/stubs/stl_util.h>
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
@@ -74,6 +77,98 @@ TEST(StringUtilityTest, ImmuneToLocales) {
   setlocale(LC_NUMERIC, old_locale.c_str());
 }
 
+TEST(StringUtilityTest, DoubleToBufferIsShortest) {
+  // Values that need at most DBL_DIG digits look like "%.15g".
+  EXPECT_EQ("0", SimpleDtoa(0.0));
+  EXPECT_EQ("-0", SimpleDtoa(-0.0));
+  EXPECT_EQ("0.1", SimpleDtoa(0.1));
+  EXPECT_EQ("-1.5", SimpleDtoa(-1.5));
+  EXPECT_EQ("100", SimpleDtoa(100.0));
+  EXPECT_EQ("0.0001", SimpleDtoa(0.0001));
+  EXPECT_EQ("1e-05", SimpleDtoa(0.00001));
+  EXPECT_EQ("123456789012345", SimpleDtoa(123456789012345.0));
+  EXPECT_EQ("1e+15", SimpleDtoa(1e15));
+  EXPECT_EQ("1e+100", SimpleDtoa(1e100));
+
+  // Others look like "%.17g", but without digits that are not needed.
+  EXPECT_EQ("0.30000000000000004", SimpleDtoa(0.1 + 0.2));
+  EXPECT_EQ("1.2345678901234568e+17", SimpleDtoa(123456789012345678.0));
+  EXPECT_EQ("1.7976931348623157e+308",
+            SimpleDtoa(std::numeric_limits<double>::max()));
+  EXPECT_EQ("2.2250738585072014e-308",
+            SimpleDtoa(std::numeric_limits<double>::min()));
+  EXPECT_EQ("5e-324", SimpleDtoa(std::numeric_limits<double>::denorm_min()));
+
+  EXPECT_EQ("0.1", SimpleFtoa(0.1f));
+  EXPECT_EQ("16777216", SimpleFtoa(16777216.0f));
+  EXPECT_EQ("3.4028235e+38", SimpleFtoa(std::numeric_limits<float>::max()));
+  EXPECT_EQ("1e-45", SimpleFtoa(std::numeric_limits<float>::denorm_min()));
+
+  EXPECT_EQ("inf", SimpleDtoa(std::numeric_limits<double>::infinity()));
+  EXPECT_EQ("-inf", SimpleFtoa(-std::numeric_limits<float>::infinity()));
+  EXPECT_EQ("nan", SimpleDtoa(std::numeric_limits<double>::quiet_NaN()));
+}
+
+TEST(StringUtilityTest, DoubleToBufferRoundTrips) {
+  // Walk through doubles and floats of all magnitudes, including the
+  // boundaries between exponents where the shortest digits are hardest to
+  // find.
+  char buffer[kDoubleToBufferSize];
+  for (int exponent = -1074; exponent <= 1023; exponent += 7) {
+    const double power = std::ldexp(1.0, exponent);
+    const double values[] = {
+        power, std::nextafter(power, 0.0),
+        std::nextafter(power, std::numeric_limits<double>::infinity()),
+        power * 1.2345678901234567};
+    for (int i = 0; i < GOOGLE_ARRAYSIZE(values); ++i) {
+      if (values[i] == 0 || std::isinf(values[i])) continue;
+      DoubleToBuffer(values[i], buffer);
+      EXPECT_EQ(values[i], io::NoLocaleStrtod(buffer, nullptr)) << buffer;
+    }
+  }
+  for (int exponent = -149; exponent <= 127; exponent += 3) {
+    float value = std::ldexp(1.0f, exponent);
+    FloatToBuffer(value, buffer);
+    // Not safe_strtof(), which rejects subnormal values.
+    EXPECT_EQ(value, strtof(buffer, nullptr)) << buffer;
+  }
+}
+
+TEST(StringUtilityTest, SafeStrtodMatchesStrtod) {
+  // Cases where the fast decimal path must get the rounding right or hand
+  // over to strtod(): halfway points, subnormals, overflow, long mantissas
+  // and syntax only strtod() accepts.
+  const char* const inputs[] = {
+      "0", "-0", "0.1", "1e23", "9007199254740993", "9007199254740992.5",
+      "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9e-324",
+      "1e-400", "1.7976931348623157e308", "1.7976931348623159e308",
+      "123456789012345678901234567890",
+      "1.00000000000000011102230246251565404236316680908203125",
+      "1.00000000000000011102230246251565404236316680908203124",
+      "1.00000000000000011102230246251565404236316680908203126",
+      "0x1p3", "inf", "-nan"};
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(inputs); ++i) {
+    double expected = strtod(inputs[i], nullptr);
+    double value;
+    ASSERT_TRUE(safe_strtod(inputs[i], &value)) << inputs[i];
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(value)) << inputs[i];
+    } else {
+      EXPECT_EQ(expected, value) << inputs[i];
+    }
+  }
+
+  // Only the piece is parsed, not whatever follows it in memory.
+  double value;
+  EXPECT_TRUE(safe_strtod(StringPiece("1.25e3456", 4), &value));
+  EXPECT_EQ(1.25, value);
+  EXPECT_TRUE(safe_strtod(StringPiece("1.5  ", 5), &value));
+  EXPECT_EQ(1.5, value);
+  EXPECT_FALSE(safe_strtod(StringPiece("1.5x", 4), &value));
+  EXPECT_FALSE(safe_strtod(StringPiece("", 0), &value));
+  EXPECT_FALSE(safe_strtod(StringPiece("e5", 2), &value));
+}
+
 #define EXPECT_EQ_ARRAY(len, x, y, msg)                     \
   for (int j = 0; j < len; ++j) {                           \
     EXPECT_EQ(x[j], y[j]) << "" # x << " != " # y           \
@@ -356,6 +356,52 @@ class TextFormat::Parser::ParserImpl {
                   message);
   }
 
+  // Resolves a field name as it appears in text format. Group names are
+  // expected to be capitalized as they appear in the .proto file, which
+  // actually matches their type names, not their field names. If
+  // allow_case_insensitive_field_ is set, falls back to a case-insensitive
+  // match. Lowercased names are built in lowercase_name_ so that resolving
+  // a field does not allocate once the buffer has grown.
+  const FieldDescriptor* FindFieldByTextName(const Descriptor* descriptor,
+                                             const std::string& name) {
+    const FieldDescriptor* field = descriptor->FindFieldByName(name);
+    bool lowercased = false;
+    if (field == NULL && HasUppercase(name)) {
+      // If the name has no uppercase letters, lowercasing it cannot change
+      // the result of the lookup above.
+      LowercaseName(name);
+      lowercased = true;
+      field = descriptor->FindFieldByName(lowercase_name_);
+      // If the case-insensitive match worked but the field is NOT a group,
+      if (field != NULL && field->type() != FieldDescriptor::TYPE_GROUP) {
+        field = NULL;
+      }
+    }
+    // Again, special-case group names as described above.
+    if (field != NULL && field->type() == FieldDescriptor::TYPE_GROUP &&
+        field->message_type()->name() != name) {
+      field = NULL;
+    }
+
+    if (field == NULL && allow_case_insensitive_field_) {
+      if (!lowercased) LowercaseName(name);
+      field = descriptor->FindFieldByLowercaseName(lowercase_name_);
+    }
+    return field;
+  }
+
+  static bool HasUppercase(const std::string& name) {
+    for (char c : name) {
+      if ('A' <= c && c <= 'Z') return true;
+    }
+    return false;
+  }
+
+  void LowercaseName(const std::string& name) {
+    lowercase_name_.assign(name);
+    LowerString(&lowercase_name_);
+  }
+
   // Consumes the specified message with the given starting delimiter.
   // This method checks to see that the end delimiter at the conclusion of
   // the consumption matches the starting delimiter passed in here.
@@ -462,31 +508,7 @@ class TextFormat::Parser::ParserImpl {
           field = descriptor->FindFieldByNumber(field_number);
         }
       } else {
-        field = descriptor->FindFieldByName(field_name);
-        // Group names are expected to be capitalized as they appear in the
-        // .proto file, which actually matches their type names, not their
-        // field names.
-        if (field == NULL) {
-          std::string lower_field_name = field_name;
-          LowerString(&lower_field_name);
-          field = descriptor->FindFieldByName(lower_field_name);
-          // If the case-insensitive match worked but the field is NOT a group,
-          if (field != NULL && field->type() != FieldDescriptor::TYPE_GROUP) {
-            field = NULL;
-          }
-        }
-        // Again, special-case group names as described above.
-        if (field != NULL && field->type() == FieldDescriptor::TYPE_GROUP &&
-            field->message_type()->name() != field_name) {
-          field = NULL;
-        }
-
-        if (field == NULL && allow_case_insensitive_field_) {
-          std::string lower_field_name = field_name;
-          LowerString(&lower_field_name);
-          field = descriptor->FindFieldByLowercaseName(lower_field_name);
-        }
-
+        field = FindFieldByTextName(descriptor, field_name);
         if (field == NULL) {
           reserved_field = descriptor->IsReservedName(field_name);
         }
@@ -1196,6 +1218,8 @@ class TextFormat::Parser::ParserImpl {
   const bool allow_partial_;
   int recursion_limit_;
   bool had_errors_;
+  // Scratch buffer for FindFieldByTextName().
+  std::string lowercase_name_;
 };
 
 // ===========================================================================
@@ -2060,54 +2084,88 @@ class MapEntryMessageComparator {
 namespace internal {
 class MapFieldPrinterHelper {
  public:
+  // A map element referenced through MapIterator. The key is copied out of
+  // the iterator, while the value still points into the map's storage.
+  struct MapEntryRef {
+    MapKey key;
+    MapValueRef value;
+  };
+
   // DynamicMapSorter::Sort cannot be used because it enfores syncing with
   // repeated field.
+  //
+  // If the repeated field view of the map is up to date, fills
+  // sorted_map_field with its entries and returns true. Otherwise collects
+  // the map elements in map_entries and fills sorted_map_entries with
+  // pointers to them, so that no map entry message needs to be created per
+  // element, and returns false.
   static bool SortMap(const Message& message, const Reflection* reflection,
-                      const FieldDescriptor* field, MessageFactory* factory,
-                      std::vector<const Message*>* sorted_map_field);
+                      const FieldDescriptor* field,
+                      std::vector<const Message*>* sorted_map_field,
+                      std::vector<MapEntryRef>* map_entries,
+                      std::vector<const MapEntryRef*>* sorted_map_entries);
+  // Overwrites the key and value of the given map entry message with the
+  // referenced map element. Used to reuse a single entry message for
+  // printing all elements of a map.
+  static void CopyEntry(const MapEntryRef& entry, Message* message);
   static void CopyKey(const MapKey& key, Message* message,
                       const FieldDescriptor* field_desc);
   static void CopyValue(const MapValueRef& value, Message* message,
                         const FieldDescriptor* field_desc);
+
+ private:
+  static bool MapEntryRefLess(const MapEntryRef* a, const MapEntryRef* b) {
+    return a->key < b->key;
+  }
 };
 
-// Returns true if elements contained in sorted_map_field need to be released.
 bool MapFieldPrinterHelper::SortMap(
     const Message& message, const Reflection* reflection,
-    const FieldDescriptor* field, MessageFactory* factory,
-    std::vector<const Message*>* sorted_map_field) {
-  bool need_release = false;
+    const FieldDescriptor* field,
+    std::vector<const Message*>* sorted_map_field,
+    std::vector<MapEntryRef>* map_entries,
+    std::vector<const MapEntryRef*>* sorted_map_entries) {
   const MapFieldBase& base = *reflection->GetMapData(message, field);
 
-  if (base.IsRepeatedFieldValid()) {
-    const RepeatedPtrField<Message>& map_field =
-        reflection->GetRepeatedPtrField<Message>(message, field);
-    for (int i = 0; i < map_field.size(); ++i) {
-      sorted_map_field->push_back(
-          const_cast<RepeatedPtrField<Message>*>(&map_field)->Mutable(i));
-    }
-  } else {
-    // TODO(teboring): For performance, instead of creating map entry message
-    // for each element, just store map keys and sort them.
-    const Descriptor* map_entry_desc = field->message_type();
-    const Message* prototype = factory->GetPrototype(map_entry_desc);
+  if (!base.IsRepeatedFieldValid()) {
+    // MapKey has no cheap move, so the elements stay put in map_entries
+    // (which never reallocates here) and only pointers to them are sorted.
+    const int size = reflection->MapSize(message, field);
+    map_entries->resize(size);
+    sorted_map_entries->reserve(size);
+    int i = 0;
     for (MapIterator iter =
              reflection->MapBegin(const_cast<Message*>(&message), field);
          iter != reflection->MapEnd(const_cast<Message*>(&message), field);
-         ++iter) {
-      Message* map_entry_message = prototype->New();
-      CopyKey(iter.GetKey(), map_entry_message, map_entry_desc->field(0));
-      CopyValue(iter.GetValueRef(), map_entry_message,
-                map_entry_desc->field(1));
-      sorted_map_field->push_back(map_entry_message);
-    }
-    need_release = true;
+         ++iter, ++i) {
+      MapEntryRef* entry = &(*map_entries)[i];
+      entry->key = iter.GetKey();
+      entry->value = iter.GetValueRef();
+      sorted_map_entries->push_back(entry);
+    }
+    std::stable_sort(sorted_map_entries->begin(), sorted_map_entries->end(),
+                     MapEntryRefLess);
+    return false;
+  }
+
+  const RepeatedPtrField<Message>& map_field =
+      reflection->GetRepeatedPtrField<Message>(message, field);
+  for (int i = 0; i < map_field.size(); ++i) {
+    sorted_map_field->push_back(
+        const_cast<RepeatedPtrField<Message>*>(&map_field)->Mutable(i));
   }
 
   MapEntryMessageComparator comparator(field->message_type());
   std::stable_sort(sorted_map_field->begin(), sorted_map_field->end(),
                    comparator);
-  return need_release;
+  return true;
+}
+
+void MapFieldPrinterHelper::CopyEntry(const MapEntryRef& entry,
+                                      Message* message) {
+  const Descriptor* map_entry_desc = message->GetDescriptor();
+  CopyKey(entry.key, message, map_entry_desc->field(0));
+  CopyValue(entry.value, message, map_entry_desc->field(1));
 }
 
 void MapFieldPrinterHelper::CopyKey(const MapKey& key, Message* message,
@@ -2155,12 +2213,10 @@ void MapFieldPrinterHelper::CopyValue(const MapValueRef& value,
     case FieldDescriptor::CPPTYPE_ENUM:
       reflection->SetEnumValue(message, field_desc, value.GetEnumValue());
       return;
-    case FieldDescriptor::CPPTYPE_MESSAGE: {
-      Message* sub_message = value.GetMessageValue().New();
-      sub_message->CopyFrom(value.GetMessageValue());
-      reflection->SetAllocatedMessage(message, sub_message, field_desc);
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      reflection->MutableMessage(message, field_desc)
+          ->CopyFrom(value.GetMessageValue());
       return;
-    }
     case FieldDescriptor::CPPTYPE_STRING:
       reflection->SetString(message, field_desc, value.GetStringValue());
       return;
@@ -2205,11 +2261,19 @@ void TextFormat::Printer::PrintField(const Message& message,
 
   DynamicMessageFactory factory;
   std::vector<const Message*> sorted_map_field;
-  bool need_release = false;
+  std::vector<internal::MapFieldPrinterHelper::MapEntryRef> map_entries;
+  std::vector<const internal::MapFieldPrinterHelper::MapEntryRef*>
+      sorted_map_entries;
+  // When the map is printed straight from its elements, every element is
+  // copied into this single entry message just before it is printed.
+  std::unique_ptr<Message> map_entry_message;
   bool is_map = field->is_map();
-  if (is_map) {
-    need_release = internal::MapFieldPrinterHelper::SortMap(
-        message, reflection, field, &factory, &sorted_map_field);
+  if (is_map &&
+      !internal::MapFieldPrinterHelper::SortMap(message, reflection, field,
+                                                &sorted_map_field, &map_entries,
+                                                &sorted_map_entries)) {
+    map_entry_message.reset(
+        factory.GetPrototype(field->message_type())->New());
   }
 
   for (int j = 0; j < count; ++j) {
@@ -2220,9 +2284,14 @@ void TextFormat::Printer::PrintField(const Message& message,
     if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
       const FastFieldValuePrinter* printer = FindWithDefault(
           custom_printers_, field, default_field_value_printer_.get());
+      if (map_entry_message != NULL) {
+        internal::MapFieldPrinterHelper::CopyEntry(*sorted_map_entries[j],
+                                                   map_entry_message.get());
+      }
       const Message& sub_message =
           field->is_repeated()
-              ? (is_map ? *sorted_map_field[j]
+              ? (is_map ? (map_entry_message != NULL ? *map_entry_message
+                                                     : *sorted_map_field[j])
                         : reflection->GetRepeatedMessage(message, field, j))
               : reflection->GetMessage(message, field);
       printer->PrintMessageStart(sub_message, field_index, count,
@@ -2243,12 +2312,6 @@ void TextFormat::Printer::PrintField(const Message& message,
       }
     }
   }
-
-  if (need_release) {
-    for (int j = 0; j < sorted_map_field.size(); ++j) {
-      delete sorted_map_field[j];
-    }
-  }
 }
 
 void TextFormat::Printer::PrintShortRepeatedField(
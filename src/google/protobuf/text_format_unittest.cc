@@ -1611,6 +1611,38 @@ TEST_F(TextFormatParserTest, AllowIgnoreCapitalizationError) {
   EXPECT_EQ(15, proto.optionalgroup().a());
 }
 
+TEST_F(TextFormatParserTest, FieldNameLookup) {
+  TextFormat::Parser parser;
+  protobuf_unittest::TestAllTypes proto;
+
+  // A group is found by its type name only, not by its field name.
+  EXPECT_TRUE(parser.ParseFromString("OptionalGroup { a: 1 }", &proto));
+  EXPECT_EQ(1, proto.optionalgroup().a());
+  EXPECT_FALSE(parser.ParseFromString("optionalgroup { a: 2 }", &proto));
+  EXPECT_TRUE(parser.ParseFromString("RepeatedGroup { a: 3 }", &proto));
+  ASSERT_EQ(1, proto.repeatedgroup_size());
+  EXPECT_EQ(3, proto.repeatedgroup(0).a());
+
+  // Lowercasing a name only matches a group spelled as its type name.
+  EXPECT_FALSE(parser.ParseFromString("Optionalgroup { a: 4 }", &proto));
+  EXPECT_FALSE(parser.ParseFromString("OPTIONALGROUP { a: 4 }", &proto));
+  EXPECT_FALSE(parser.ParseFromString("Optional_Int32: 4", &proto));
+
+  // Names matching exactly are not affected by case-insensitive lookup.
+  parser.AllowCaseInsensitiveField(true);
+  EXPECT_TRUE(parser.ParseFromString("optional_int32: 5", &proto));
+  EXPECT_EQ(5, proto.optional_int32());
+  EXPECT_TRUE(parser.ParseFromString("OptionalGroup { a: 6 }", &proto));
+  EXPECT_EQ(6, proto.optionalgroup().a());
+
+  // Other spellings are lowercased and matched against the field names.
+  EXPECT_TRUE(parser.ParseFromString("Optional_Int32: 7", &proto));
+  EXPECT_EQ(7, proto.optional_int32());
+  EXPECT_TRUE(parser.ParseFromString("OPTIONALGROUP { a: 8 }", &proto));
+  EXPECT_EQ(8, proto.optionalgroup().a());
+  EXPECT_FALSE(parser.ParseFromString("Optional_Int33: 9", &proto));
+}
+
 TEST_F(TextFormatParserTest, InvalidFieldValues) {
   // Invalid values for a double/float field.
   ExpectFailure("optional_double: \"hello\"\n",
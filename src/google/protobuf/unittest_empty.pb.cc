@@ -0,0 +1,59 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_empty.proto
+
+#include "google/protobuf/unittest_empty.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+void InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto() {
+}
+
+static constexpr ::PROTOBUF_NAMESPACE_ID::Metadata* file_level_metadata_google_2fprotobuf_2funittest_5fempty_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2funittest_5fempty_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2funittest_5fempty_2eproto = nullptr;
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2funittest_5fempty_2eproto::offsets[1] = {};
+static constexpr ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema* schemas = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::Message* const* file_default_instances = nullptr;
+
+static ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptorsTable assign_descriptors_table_google_2fprotobuf_2funittest_5fempty_2eproto = {
+  {}, AddDescriptors_google_2fprotobuf_2funittest_5fempty_2eproto, "google/protobuf/unittest_empty.proto", schemas,
+  file_default_instances, TableStruct_google_2fprotobuf_2funittest_5fempty_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2funittest_5fempty_2eproto, 0, file_level_enum_descriptors_google_2fprotobuf_2funittest_5fempty_2eproto, file_level_service_descriptors_google_2fprotobuf_2funittest_5fempty_2eproto,
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fempty_2eproto[] =
+  "\n$google/protobuf/unittest_empty.proto"
+  ;
+static ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fempty_2eproto = {
+  false, InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto, 
+  descriptor_table_protodef_google_2fprotobuf_2funittest_5fempty_2eproto,
+  "google/protobuf/unittest_empty.proto", &assign_descriptors_table_google_2fprotobuf_2funittest_5fempty_2eproto, 38,
+};
+
+void AddDescriptors_google_2fprotobuf_2funittest_5fempty_2eproto() {
+  static constexpr ::PROTOBUF_NAMESPACE_ID::internal::InitFunc deps[1] =
+  {
+  };
+ ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fempty_2eproto, deps, 0);
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2funittest_5fempty_2eproto = []() { AddDescriptors_google_2fprotobuf_2funittest_5fempty_2eproto(); return true; }();
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,300 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_import.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fimport_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fimport_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "google/protobuf/unittest_import_public.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fimport_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fimport_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2funittest_5fimport_2eproto();
+namespace protobuf_unittest_import {
+class ImportMessage;
+class ImportMessageDefaultTypeInternal;
+extern ImportMessageDefaultTypeInternal _ImportMessage_default_instance_;
+}  // namespace protobuf_unittest_import
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest_import::ImportMessage* Arena::CreateMaybeMessage<::protobuf_unittest_import::ImportMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest_import {
+
+enum ImportEnum {
+  IMPORT_FOO = 7,
+  IMPORT_BAR = 8,
+  IMPORT_BAZ = 9
+};
+bool ImportEnum_IsValid(int value);
+constexpr ImportEnum ImportEnum_MIN = IMPORT_FOO;
+constexpr ImportEnum ImportEnum_MAX = IMPORT_BAZ;
+constexpr int ImportEnum_ARRAYSIZE = ImportEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImportEnum_descriptor();
+inline const std::string& ImportEnum_Name(ImportEnum value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ImportEnum_descriptor(), value);
+}
+inline bool ImportEnum_Parse(
+    const std::string& name, ImportEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ImportEnum>(
+    ImportEnum_descriptor(), name, value);
+}
+enum ImportEnumForMap {
+  UNKNOWN = 0,
+  FOO = 1,
+  BAR = 2
+};
+bool ImportEnumForMap_IsValid(int value);
+constexpr ImportEnumForMap ImportEnumForMap_MIN = UNKNOWN;
+constexpr ImportEnumForMap ImportEnumForMap_MAX = BAR;
+constexpr int ImportEnumForMap_ARRAYSIZE = ImportEnumForMap_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImportEnumForMap_descriptor();
+inline const std::string& ImportEnumForMap_Name(ImportEnumForMap value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ImportEnumForMap_descriptor(), value);
+}
+inline bool ImportEnumForMap_Parse(
+    const std::string& name, ImportEnumForMap* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ImportEnumForMap>(
+    ImportEnumForMap_descriptor(), name, value);
+}
+// ===================================================================
+
+class ImportMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest_import.ImportMessage) */ {
+ public:
+  ImportMessage();
+  virtual ~ImportMessage();
+
+  ImportMessage(const ImportMessage& from);
+  ImportMessage(ImportMessage&& from) noexcept
+    : ImportMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ImportMessage& operator=(const ImportMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ImportMessage& operator=(ImportMessage&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArena() const final {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const final {
+    return MaybeArenaPtr();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const ImportMessage& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ImportMessage* internal_default_instance() {
+    return reinterpret_cast<const ImportMessage*>(
+               &_ImportMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void UnsafeArenaSwap(ImportMessage* other);
+  void Swap(ImportMessage* other);
+  friend void swap(ImportMessage& a, ImportMessage& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ImportMessage* New() const final {
+    return CreateMaybeMessage<ImportMessage>(nullptr);
+  }
+
+  ImportMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ImportMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ImportMessage& from);
+  void MergeFrom(const ImportMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ImportMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest_import.ImportMessage";
+  }
+  protected:
+  explicit ImportMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 d = 1;
+  bool has_d() const;
+  void clear_d();
+  static const int kDFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 d() const;
+  void set_d(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest_import.ImportMessage)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 d_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fimport_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ImportMessage
+
+// optional int32 d = 1;
+inline bool ImportMessage::has_d() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ImportMessage::clear_d() {
+  d_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ImportMessage::d() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_import.ImportMessage.d)
+  return d_;
+}
+inline void ImportMessage::set_d(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  d_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest_import.ImportMessage.d)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest_import
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::protobuf_unittest_import::ImportEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protobuf_unittest_import::ImportEnum>() {
+  return ::protobuf_unittest_import::ImportEnum_descriptor();
+}
+template <> struct is_proto_enum< ::protobuf_unittest_import::ImportEnumForMap> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protobuf_unittest_import::ImportEnumForMap>() {
+  return ::protobuf_unittest_import::ImportEnumForMap_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fimport_2eproto
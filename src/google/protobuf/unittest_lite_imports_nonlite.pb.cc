@@ -0,0 +1,371 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lite_imports_nonlite.proto
+
+#include "google/protobuf/unittest_lite_imports_nonlite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestRequired_google_2fprotobuf_2funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestAllTypes_google_2fprotobuf_2funittest_2eproto;
+namespace protobuf_unittest {
+class TestLiteImportsNonliteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestLiteImportsNonlite> _instance;
+} _TestLiteImportsNonlite_default_instance_;
+}  // namespace protobuf_unittest
+static void InitDefaultsTestLiteImportsNonlite_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestLiteImportsNonlite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestLiteImportsNonlite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestLiteImportsNonlite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_TestLiteImportsNonlite_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsTestLiteImportsNonlite_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto}, {
+      &scc_info_TestAllTypes_google_2fprotobuf_2funittest_2eproto.base,
+      &scc_info_TestRequired_google_2fprotobuf_2funittest_2eproto.base,}};
+
+namespace protobuf_unittest {
+
+// ===================================================================
+
+void TestLiteImportsNonlite::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestLiteImportsNonlite_default_instance_._instance.get_mutable()->message_ = const_cast< ::protobuf_unittest::TestAllTypes*>(
+      ::protobuf_unittest::TestAllTypes::internal_default_instance());
+  ::protobuf_unittest::_TestLiteImportsNonlite_default_instance_._instance.get_mutable()->message_with_required_ = const_cast< ::protobuf_unittest::TestRequired*>(
+      ::protobuf_unittest::TestRequired::internal_default_instance());
+}
+class TestLiteImportsNonlite::HasBitSetters {
+ public:
+  static const ::protobuf_unittest::TestAllTypes& message(const TestLiteImportsNonlite* msg);
+  static void set_has_message(TestLiteImportsNonlite* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+  static const ::protobuf_unittest::TestRequired& message_with_required(const TestLiteImportsNonlite* msg);
+  static void set_has_message_with_required(TestLiteImportsNonlite* msg) {
+    msg->_has_bits_[0] |= 0x00000002u;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypes&
+TestLiteImportsNonlite::HasBitSetters::message(const TestLiteImportsNonlite* msg) {
+  return *msg->message_;
+}
+const ::protobuf_unittest::TestRequired&
+TestLiteImportsNonlite::HasBitSetters::message_with_required(const TestLiteImportsNonlite* msg) {
+  return *msg->message_with_required_;
+}
+void TestLiteImportsNonlite::clear_message() {
+  if (message_ != nullptr) message_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestLiteImportsNonlite::clear_message_with_required() {
+  if (message_with_required_ != nullptr) message_with_required_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestLiteImportsNonlite::kMessageFieldNumber;
+const int TestLiteImportsNonlite::kMessageWithRequiredFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestLiteImportsNonlite::TestLiteImportsNonlite()
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestLiteImportsNonlite)
+}
+TestLiteImportsNonlite::TestLiteImportsNonlite(const TestLiteImportsNonlite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_message()) {
+    message_ = new ::protobuf_unittest::TestAllTypes(*from.message_);
+  } else {
+    message_ = nullptr;
+  }
+  if (from.has_message_with_required()) {
+    message_with_required_ = new ::protobuf_unittest::TestRequired(*from.message_with_required_);
+  } else {
+    message_with_required_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestLiteImportsNonlite)
+}
+
+void TestLiteImportsNonlite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestLiteImportsNonlite_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto.base);
+  ::memset(&message_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&message_with_required_) -
+      reinterpret_cast<char*>(&message_)) + sizeof(message_with_required_));
+}
+
+TestLiteImportsNonlite::~TestLiteImportsNonlite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestLiteImportsNonlite)
+  SharedDtor();
+}
+
+void TestLiteImportsNonlite::SharedDtor() {
+  if (this != internal_default_instance()) delete message_;
+  if (this != internal_default_instance()) delete message_with_required_;
+}
+
+void TestLiteImportsNonlite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestLiteImportsNonlite& TestLiteImportsNonlite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestLiteImportsNonlite_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestLiteImportsNonlite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestLiteImportsNonlite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(message_ != nullptr);
+      message_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(message_with_required_ != nullptr);
+      message_with_required_->Clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestLiteImportsNonlite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional .protobuf_unittest.TestAllTypes message = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest.TestRequired message_with_required = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_message_with_required(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestLiteImportsNonlite::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  ::PROTOBUF_NAMESPACE_ID::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestLiteImportsNonlite)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .protobuf_unittest.TestAllTypes message = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest.TestRequired message_with_required = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_message_with_required()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestLiteImportsNonlite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestLiteImportsNonlite)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestLiteImportsNonlite::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestLiteImportsNonlite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest.TestAllTypes message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::message(this), output);
+  }
+
+  // optional .protobuf_unittest.TestRequired message_with_required = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, HasBitSetters::message_with_required(this), output);
+  }
+
+  output->WriteRaw(_internal_metadata_.unknown_fields().data(),
+                   static_cast<int>(_internal_metadata_.unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestLiteImportsNonlite)
+}
+
+size_t TestLiteImportsNonlite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestLiteImportsNonlite)
+  size_t total_size = 0;
+
+  total_size += _internal_metadata_.unknown_fields().size();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .protobuf_unittest.TestAllTypes message = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *message_);
+    }
+
+    // optional .protobuf_unittest.TestRequired message_with_required = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *message_with_required_);
+    }
+
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestLiteImportsNonlite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestLiteImportsNonlite*>(
+      &from));
+}
+
+void TestLiteImportsNonlite::MergeFrom(const TestLiteImportsNonlite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestLiteImportsNonlite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      mutable_message()->::protobuf_unittest::TestAllTypes::MergeFrom(from.message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      mutable_message_with_required()->::protobuf_unittest::TestRequired::MergeFrom(from.message_with_required());
+    }
+  }
+}
+
+void TestLiteImportsNonlite::CopyFrom(const TestLiteImportsNonlite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestLiteImportsNonlite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestLiteImportsNonlite::IsInitialized() const {
+  if (has_message_with_required()) {
+    if (!this->message_with_required_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestLiteImportsNonlite::Swap(TestLiteImportsNonlite* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestLiteImportsNonlite::InternalSwap(TestLiteImportsNonlite* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(message_, other->message_);
+  swap(message_with_required_, other->message_with_required_);
+}
+
+std::string TestLiteImportsNonlite::GetTypeName() const {
+  return "protobuf_unittest.TestLiteImportsNonlite";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestLiteImportsNonlite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestLiteImportsNonlite >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest::TestLiteImportsNonlite >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
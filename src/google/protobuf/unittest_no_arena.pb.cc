@@ -0,0 +1,6390 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_no_arena.proto
+
+#include "google/protobuf/unittest_no_arena.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5farena_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ArenaMessage_google_2fprotobuf_2funittest_5farena_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fimport_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ImportMessage_google_2fprotobuf_2funittest_5fimport_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PublicImportMessage_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5farena_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5farena_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5farena_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5farena_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto;
+namespace protobuf_unittest_no_arena {
+class TestAllTypes_NestedMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypes_NestedMessage> _instance;
+} _TestAllTypes_NestedMessage_default_instance_;
+class TestAllTypes_OptionalGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypes_OptionalGroup> _instance;
+} _TestAllTypes_OptionalGroup_default_instance_;
+class TestAllTypes_RepeatedGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypes_RepeatedGroup> _instance;
+} _TestAllTypes_RepeatedGroup_default_instance_;
+class TestAllTypesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypes> _instance;
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+  const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage* oneof_nested_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_;
+  const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage* lazy_oneof_nested_message_;
+} _TestAllTypes_default_instance_;
+class ForeignMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ForeignMessage> _instance;
+} _ForeignMessage_default_instance_;
+class TestNoArenaMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNoArenaMessage> _instance;
+} _TestNoArenaMessage_default_instance_;
+}  // namespace protobuf_unittest_no_arena
+static void InitDefaultsTestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_no_arena::_TestAllTypes_NestedMessage_default_instance_;
+    new (ptr) ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto}, {}};
+
+static void InitDefaultsTestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_no_arena::_TestAllTypes_OptionalGroup_default_instance_;
+    new (ptr) ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto}, {}};
+
+static void InitDefaultsTestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_no_arena::_TestAllTypes_RepeatedGroup_default_instance_;
+    new (ptr) ::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto}, {}};
+
+static void InitDefaultsTestAllTypes_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.DefaultConstruct();
+  *::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get_mutable() = std::string("hello", 5);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get_mutable());
+  ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.DefaultConstruct();
+  *::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get_mutable() = std::string("world", 5);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get_mutable());
+  ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.DefaultConstruct();
+  *::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get_mutable() = std::string("abc", 3);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get_mutable());
+  ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.DefaultConstruct();
+  *::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get_mutable() = std::string("123", 3);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get_mutable());
+  {
+    void* ptr = &::protobuf_unittest_no_arena::_TestAllTypes_default_instance_;
+    new (ptr) ::protobuf_unittest_no_arena::TestAllTypes();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_no_arena::TestAllTypes::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5farena_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, InitDefaultsTestAllTypes_google_2fprotobuf_2funittest_5fno_5farena_2eproto}, {
+      &scc_info_TestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base,
+      &scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base,
+      &scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base,
+      &scc_info_ImportMessage_google_2fprotobuf_2funittest_5fimport_2eproto.base,
+      &scc_info_PublicImportMessage_google_2fprotobuf_2funittest_5fimport_5fpublic_2eproto.base,
+      &scc_info_TestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base,}};
+
+static void InitDefaultsForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_no_arena::_ForeignMessage_default_instance_;
+    new (ptr) ::protobuf_unittest_no_arena::ForeignMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_no_arena::ForeignMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto}, {}};
+
+static void InitDefaultsTestNoArenaMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest_no_arena::_TestNoArenaMessage_default_instance_;
+    new (ptr) ::protobuf_unittest_no_arena::TestNoArenaMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_no_arena::TestNoArenaMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestNoArenaMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestNoArenaMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto}, {
+      &scc_info_ArenaMessage_google_2fprotobuf_2funittest_5farena_2eproto.base,}};
+
+void InitDefaults_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestNoArenaMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+}
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[6];
+static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto[2];
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2funittest_5fno_5farena_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_NestedMessage, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_NestedMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_NestedMessage, bb_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup, a_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup, a_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_int32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_int64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_uint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_uint64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_sint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_sint64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_fixed32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_fixed64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_sfixed32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_sfixed64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_float_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_double_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_bool_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_string_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_bytes_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optionalgroup_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_nested_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_foreign_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_import_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_nested_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_foreign_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_import_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_string_piece_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_cord_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_public_import_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, optional_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_int32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_int64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_uint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_uint64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_sint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_sint64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_fixed32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_fixed64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_sfixed32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_sfixed64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_float_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_double_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_bool_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_string_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_bytes_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeatedgroup_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_nested_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_foreign_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_import_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_nested_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_foreign_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_import_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_string_piece_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_cord_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, repeated_lazy_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_int32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_int64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_uint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_uint64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_sint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_sint64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_fixed32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_fixed64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_sfixed32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_sfixed64_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_float_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_double_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_bool_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_string_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_bytes_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_nested_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_foreign_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_import_enum_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_string_piece_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, default_cord_),
+  offsetof(::protobuf_unittest_no_arena::TestAllTypesDefaultTypeInternal, oneof_uint32_),
+  offsetof(::protobuf_unittest_no_arena::TestAllTypesDefaultTypeInternal, oneof_nested_message_),
+  offsetof(::protobuf_unittest_no_arena::TestAllTypesDefaultTypeInternal, oneof_string_),
+  offsetof(::protobuf_unittest_no_arena::TestAllTypesDefaultTypeInternal, oneof_bytes_),
+  offsetof(::protobuf_unittest_no_arena::TestAllTypesDefaultTypeInternal, lazy_oneof_nested_message_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestAllTypes, oneof_field_),
+  15,
+  14,
+  16,
+  17,
+  19,
+  18,
+  20,
+  21,
+  23,
+  22,
+  24,
+  25,
+  26,
+  0,
+  1,
+  8,
+  9,
+  10,
+  11,
+  28,
+  29,
+  30,
+  2,
+  3,
+  12,
+  13,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  31,
+  32,
+  34,
+  33,
+  35,
+  36,
+  38,
+  37,
+  39,
+  40,
+  42,
+  41,
+  43,
+  4,
+  5,
+  44,
+  45,
+  27,
+  6,
+  7,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::ForeignMessage, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::ForeignMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::ForeignMessage, c_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestNoArenaMessage, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestNoArenaMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_no_arena::TestNoArenaMessage, arena_message_),
+  0,
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 6, sizeof(::protobuf_unittest_no_arena::TestAllTypes_NestedMessage)},
+  { 7, 13, sizeof(::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup)},
+  { 14, 20, sizeof(::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup)},
+  { 21, 103, sizeof(::protobuf_unittest_no_arena::TestAllTypes)},
+  { 179, 185, sizeof(::protobuf_unittest_no_arena::ForeignMessage)},
+  { 186, 192, sizeof(::protobuf_unittest_no_arena::TestNoArenaMessage)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_no_arena::_TestAllTypes_NestedMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_no_arena::_TestAllTypes_OptionalGroup_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_no_arena::_TestAllTypes_RepeatedGroup_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_no_arena::_TestAllTypes_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_no_arena::_ForeignMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_no_arena::_TestNoArenaMessage_default_instance_),
+};
+
+static ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptorsTable assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto = {
+  {}, AddDescriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto, "google/protobuf/unittest_no_arena.proto", schemas,
+  file_default_instances, TableStruct_google_2fprotobuf_2funittest_5fno_5farena_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto, 6, file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto, file_level_service_descriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto,
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fno_5farena_2eproto[] =
+  "\n\'google/protobuf/unittest_no_arena.prot"
+  "o\022\032protobuf_unittest_no_arena\032%google/pr"
+  "otobuf/unittest_import.proto\032$google/pro"
+  "tobuf/unittest_arena.proto\"\320\032\n\014TestAllTy"
+  "pes\022\026\n\016optional_int32\030\001 \001(\005\022\026\n\016optional_"
+  "int64\030\002 \001(\003\022\027\n\017optional_uint32\030\003 \001(\r\022\027\n\017"
+  "optional_uint64\030\004 \001(\004\022\027\n\017optional_sint32"
+  "\030\005 \001(\021\022\027\n\017optional_sint64\030\006 \001(\022\022\030\n\020optio"
+  "nal_fixed32\030\007 \001(\007\022\030\n\020optional_fixed64\030\010 "
+  "\001(\006\022\031\n\021optional_sfixed32\030\t \001(\017\022\031\n\021option"
+  "al_sfixed64\030\n \001(\020\022\026\n\016optional_float\030\013 \001("
+  "\002\022\027\n\017optional_double\030\014 \001(\001\022\025\n\roptional_b"
+  "ool\030\r \001(\010\022\027\n\017optional_string\030\016 \001(\t\022\026\n\016op"
+  "tional_bytes\030\017 \001(\014\022M\n\roptionalgroup\030\020 \001("
+  "\n26.protobuf_unittest_no_arena.TestAllTy"
+  "pes.OptionalGroup\022W\n\027optional_nested_mes"
+  "sage\030\022 \001(\01326.protobuf_unittest_no_arena."
+  "TestAllTypes.NestedMessage\022L\n\030optional_f"
+  "oreign_message\030\023 \001(\0132*.protobuf_unittest"
+  "_no_arena.ForeignMessage\022H\n\027optional_imp"
+  "ort_message\030\024 \001(\0132\'.protobuf_unittest_im"
+  "port.ImportMessage\022Q\n\024optional_nested_en"
+  "um\030\025 \001(\01623.protobuf_unittest_no_arena.Te"
+  "stAllTypes.NestedEnum\022F\n\025optional_foreig"
+  "n_enum\030\026 \001(\0162\'.protobuf_unittest_no_aren"
+  "a.ForeignEnum\022B\n\024optional_import_enum\030\027 "
+  "\001(\0162$.protobuf_unittest_import.ImportEnu"
+  "m\022!\n\025optional_string_piece\030\030 \001(\tB\002\010\002\022\031\n\r"
+  "optional_cord\030\031 \001(\tB\002\010\001\022U\n\036optional_publ"
+  "ic_import_message\030\032 \001(\0132-.protobuf_unitt"
+  "est_import.PublicImportMessage\022T\n\020option"
+  "al_message\030\033 \001(\01326.protobuf_unittest_no_"
+  "arena.TestAllTypes.NestedMessageB\002(\001\022\026\n\016"
+  "repeated_int32\030\037 \003(\005\022\026\n\016repeated_int64\030 "
+  " \003(\003\022\027\n\017repeated_uint32\030! \003(\r\022\027\n\017repeate"
+  "d_uint64\030\" \003(\004\022\027\n\017repeated_sint32\030# \003(\021\022"
+  "\027\n\017repeated_sint64\030$ \003(\022\022\030\n\020repeated_fix"
+  "ed32\030% \003(\007\022\030\n\020repeated_fixed64\030& \003(\006\022\031\n\021"
+  "repeated_sfixed32\030\' \003(\017\022\031\n\021repeated_sfix"
+  "ed64\030( \003(\020\022\026\n\016repeated_float\030) \003(\002\022\027\n\017re"
+  "peated_double\030* \003(\001\022\025\n\rrepeated_bool\030+ \003"
+  "(\010\022\027\n\017repeated_string\030, \003(\t\022\026\n\016repeated_"
+  "bytes\030- \003(\014\022M\n\rrepeatedgroup\030. \003(\n26.pro"
+  "tobuf_unittest_no_arena.TestAllTypes.Rep"
+  "eatedGroup\022W\n\027repeated_nested_message\0300 "
+  "\003(\01326.protobuf_unittest_no_arena.TestAll"
+  "Types.NestedMessage\022L\n\030repeated_foreign_"
+  "message\0301 \003(\0132*.protobuf_unittest_no_are"
+  "na.ForeignMessage\022H\n\027repeated_import_mes"
+  "sage\0302 \003(\0132\'.protobuf_unittest_import.Im"
+  "portMessage\022Q\n\024repeated_nested_enum\0303 \003("
+  "\01623.protobuf_unittest_no_arena.TestAllTy"
+  "pes.NestedEnum\022F\n\025repeated_foreign_enum\030"
+  "4 \003(\0162\'.protobuf_unittest_no_arena.Forei"
+  "gnEnum\022B\n\024repeated_import_enum\0305 \003(\0162$.p"
+  "rotobuf_unittest_import.ImportEnum\022!\n\025re"
+  "peated_string_piece\0306 \003(\tB\002\010\002\022\031\n\rrepeate"
+  "d_cord\0307 \003(\tB\002\010\001\022Y\n\025repeated_lazy_messag"
+  "e\0309 \003(\01326.protobuf_unittest_no_arena.Tes"
+  "tAllTypes.NestedMessageB\002(\001\022\031\n\rdefault_i"
+  "nt32\030= \001(\005:\00241\022\031\n\rdefault_int64\030> \001(\003:\0024"
+  "2\022\032\n\016default_uint32\030\? \001(\r:\00243\022\032\n\016default"
+  "_uint64\030@ \001(\004:\00244\022\033\n\016default_sint32\030A \001("
+  "\021:\003-45\022\032\n\016default_sint64\030B \001(\022:\00246\022\033\n\017de"
+  "fault_fixed32\030C \001(\007:\00247\022\033\n\017default_fixed"
+  "64\030D \001(\006:\00248\022\034\n\020default_sfixed32\030E \001(\017:\002"
+  "49\022\035\n\020default_sfixed64\030F \001(\020:\003-50\022\033\n\rdef"
+  "ault_float\030G \001(\002:\00451.5\022\035\n\016default_double"
+  "\030H \001(\001:\00552000\022\032\n\014default_bool\030I \001(\010:\004tru"
+  "e\022\035\n\016default_string\030J \001(\t:\005hello\022\034\n\rdefa"
+  "ult_bytes\030K \001(\014:\005world\022U\n\023default_nested"
+  "_enum\030Q \001(\01623.protobuf_unittest_no_arena"
+  ".TestAllTypes.NestedEnum:\003BAR\022R\n\024default"
+  "_foreign_enum\030R \001(\0162\'.protobuf_unittest_"
+  "no_arena.ForeignEnum:\013FOREIGN_BAR\022M\n\023def"
+  "ault_import_enum\030S \001(\0162$.protobuf_unitte"
+  "st_import.ImportEnum:\nIMPORT_BAR\022%\n\024defa"
+  "ult_string_piece\030T \001(\t:\003abcB\002\010\002\022\035\n\014defau"
+  "lt_cord\030U \001(\t:\003123B\002\010\001\022\026\n\014oneof_uint32\030o"
+  " \001(\rH\000\022V\n\024oneof_nested_message\030p \001(\01326.p"
+  "rotobuf_unittest_no_arena.TestAllTypes.N"
+  "estedMessageH\000\022\026\n\014oneof_string\030q \001(\tH\000\022\025"
+  "\n\013oneof_bytes\030r \001(\014H\000\022_\n\031lazy_oneof_nest"
+  "ed_message\030s \001(\01326.protobuf_unittest_no_"
+  "arena.TestAllTypes.NestedMessageB\002(\001H\000\032\033"
+  "\n\rNestedMessage\022\n\n\002bb\030\001 \001(\005\032\032\n\rOptionalG"
+  "roup\022\t\n\001a\030\021 \001(\005\032\032\n\rRepeatedGroup\022\t\n\001a\030/ "
+  "\001(\005\"9\n\nNestedEnum\022\007\n\003FOO\020\001\022\007\n\003BAR\020\002\022\007\n\003B"
+  "AZ\020\003\022\020\n\003NEG\020\377\377\377\377\377\377\377\377\377\001B\r\n\013oneof_field\"\033\n"
+  "\016ForeignMessage\022\t\n\001c\030\001 \001(\005\"P\n\022TestNoAren"
+  "aMessage\022:\n\rarena_message\030\001 \001(\0132#.proto2"
+  "_arena_unittest.ArenaMessage*@\n\013ForeignE"
+  "num\022\017\n\013FOREIGN_FOO\020\004\022\017\n\013FOREIGN_BAR\020\005\022\017\n"
+  "\013FOREIGN_BAZ\020\006B%B\rUnittestProtoH\001\200\001\001\210\001\001\220"
+  "\001\001\370\001\000\242\002\005NOARN"
+  ;
+static ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto = {
+  false, InitDefaults_google_2fprotobuf_2funittest_5fno_5farena_2eproto, 
+  descriptor_table_protodef_google_2fprotobuf_2funittest_5fno_5farena_2eproto,
+  "google/protobuf/unittest_no_arena.proto", &assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto, 3773,
+};
+
+void AddDescriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto() {
+  static constexpr ::PROTOBUF_NAMESPACE_ID::internal::InitFunc deps[2] =
+  {
+    ::AddDescriptors_google_2fprotobuf_2funittest_5fimport_2eproto,
+    ::AddDescriptors_google_2fprotobuf_2funittest_5farena_2eproto,
+  };
+ ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto, deps, 2);
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2funittest_5fno_5farena_2eproto = []() { AddDescriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto(); return true; }();
+namespace protobuf_unittest_no_arena {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TestAllTypes_NestedEnum_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto[0];
+}
+bool TestAllTypes_NestedEnum_IsValid(int value) {
+  switch (value) {
+    case -1:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+constexpr TestAllTypes_NestedEnum TestAllTypes::FOO;
+constexpr TestAllTypes_NestedEnum TestAllTypes::BAR;
+constexpr TestAllTypes_NestedEnum TestAllTypes::BAZ;
+constexpr TestAllTypes_NestedEnum TestAllTypes::NEG;
+constexpr TestAllTypes_NestedEnum TestAllTypes::NestedEnum_MIN;
+constexpr TestAllTypes_NestedEnum TestAllTypes::NestedEnum_MAX;
+constexpr int TestAllTypes::NestedEnum_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ForeignEnum_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5farena_2eproto[1];
+}
+bool ForeignEnum_IsValid(int value) {
+  switch (value) {
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void TestAllTypes_NestedMessage::InitAsDefaultInstance() {
+}
+class TestAllTypes_NestedMessage::HasBitSetters {
+ public:
+  static void set_has_bb(TestAllTypes_NestedMessage* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAllTypes_NestedMessage::kBbFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAllTypes_NestedMessage::TestAllTypes_NestedMessage()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+}
+TestAllTypes_NestedMessage::TestAllTypes_NestedMessage(const TestAllTypes_NestedMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  bb_ = from.bb_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+}
+
+void TestAllTypes_NestedMessage::SharedCtor() {
+  bb_ = 0;
+}
+
+TestAllTypes_NestedMessage::~TestAllTypes_NestedMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  SharedDtor();
+}
+
+void TestAllTypes_NestedMessage::SharedDtor() {
+}
+
+void TestAllTypes_NestedMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypes_NestedMessage& TestAllTypes_NestedMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypes_NestedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  bb_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAllTypes_NestedMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 bb = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_bb(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAllTypes_NestedMessage::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 bb = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          HasBitSetters::set_has_bb(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &bb_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAllTypes_NestedMessage::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 bb = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->bb(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypes_NestedMessage::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 bb = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->bb(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  return target;
+}
+
+size_t TestAllTypes_NestedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 bb = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->bb());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypes_NestedMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAllTypes_NestedMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAllTypes_NestedMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+    MergeFrom(*source);
+  }
+}
+
+void TestAllTypes_NestedMessage::MergeFrom(const TestAllTypes_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_bb()) {
+    set_bb(from.bb());
+  }
+}
+
+void TestAllTypes_NestedMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAllTypes_NestedMessage::CopyFrom(const TestAllTypes_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_no_arena.TestAllTypes.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypes_NestedMessage::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypes_NestedMessage::Swap(TestAllTypes_NestedMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAllTypes_NestedMessage::InternalSwap(TestAllTypes_NestedMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(bb_, other->bb_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAllTypes_NestedMessage::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TestAllTypes_OptionalGroup::InitAsDefaultInstance() {
+}
+class TestAllTypes_OptionalGroup::HasBitSetters {
+ public:
+  static void set_has_a(TestAllTypes_OptionalGroup* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAllTypes_OptionalGroup::kAFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAllTypes_OptionalGroup::TestAllTypes_OptionalGroup()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+}
+TestAllTypes_OptionalGroup::TestAllTypes_OptionalGroup(const TestAllTypes_OptionalGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+}
+
+void TestAllTypes_OptionalGroup::SharedCtor() {
+  a_ = 0;
+}
+
+TestAllTypes_OptionalGroup::~TestAllTypes_OptionalGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  SharedDtor();
+}
+
+void TestAllTypes_OptionalGroup::SharedDtor() {
+}
+
+void TestAllTypes_OptionalGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypes_OptionalGroup& TestAllTypes_OptionalGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypes_OptionalGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypes_OptionalGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAllTypes_OptionalGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 a = 17;
+      case 17: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 136) goto handle_unusual;
+        set_a(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAllTypes_OptionalGroup::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 a = 17;
+      case 17: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (136 & 0xFF)) {
+          HasBitSetters::set_has_a(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &a_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          input->SetLastTag(tag);
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAllTypes_OptionalGroup::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 17;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(17, this->a(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypes_OptionalGroup::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 17;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(17, this->a(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  return target;
+}
+
+size_t TestAllTypes_OptionalGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 17;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->a());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypes_OptionalGroup::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAllTypes_OptionalGroup* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAllTypes_OptionalGroup>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+    MergeFrom(*source);
+  }
+}
+
+void TestAllTypes_OptionalGroup::MergeFrom(const TestAllTypes_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_a()) {
+    set_a(from.a());
+  }
+}
+
+void TestAllTypes_OptionalGroup::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAllTypes_OptionalGroup::CopyFrom(const TestAllTypes_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_no_arena.TestAllTypes.OptionalGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypes_OptionalGroup::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypes_OptionalGroup::Swap(TestAllTypes_OptionalGroup* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAllTypes_OptionalGroup::InternalSwap(TestAllTypes_OptionalGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAllTypes_OptionalGroup::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TestAllTypes_RepeatedGroup::InitAsDefaultInstance() {
+}
+class TestAllTypes_RepeatedGroup::HasBitSetters {
+ public:
+  static void set_has_a(TestAllTypes_RepeatedGroup* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAllTypes_RepeatedGroup::kAFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAllTypes_RepeatedGroup::TestAllTypes_RepeatedGroup()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+}
+TestAllTypes_RepeatedGroup::TestAllTypes_RepeatedGroup(const TestAllTypes_RepeatedGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+}
+
+void TestAllTypes_RepeatedGroup::SharedCtor() {
+  a_ = 0;
+}
+
+TestAllTypes_RepeatedGroup::~TestAllTypes_RepeatedGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  SharedDtor();
+}
+
+void TestAllTypes_RepeatedGroup::SharedDtor() {
+}
+
+void TestAllTypes_RepeatedGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypes_RepeatedGroup& TestAllTypes_RepeatedGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypes_RepeatedGroup_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypes_RepeatedGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAllTypes_RepeatedGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 a = 47;
+      case 47: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 120) goto handle_unusual;
+        set_a(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAllTypes_RepeatedGroup::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 a = 47;
+      case 47: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (376 & 0xFF)) {
+          HasBitSetters::set_has_a(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &a_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          input->SetLastTag(tag);
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAllTypes_RepeatedGroup::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 47;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(47, this->a(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypes_RepeatedGroup::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 47;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(47, this->a(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  return target;
+}
+
+size_t TestAllTypes_RepeatedGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 47;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->a());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypes_RepeatedGroup::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAllTypes_RepeatedGroup* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAllTypes_RepeatedGroup>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+    MergeFrom(*source);
+  }
+}
+
+void TestAllTypes_RepeatedGroup::MergeFrom(const TestAllTypes_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_a()) {
+    set_a(from.a());
+  }
+}
+
+void TestAllTypes_RepeatedGroup::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAllTypes_RepeatedGroup::CopyFrom(const TestAllTypes_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_no_arena.TestAllTypes.RepeatedGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypes_RepeatedGroup::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypes_RepeatedGroup::Swap(TestAllTypes_RepeatedGroup* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAllTypes_RepeatedGroup::InternalSwap(TestAllTypes_RepeatedGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAllTypes_RepeatedGroup::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TestAllTypes::InitAsDefaultInstance() {
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_._instance.get_mutable()->optionalgroup_ = const_cast< ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup*>(
+      ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_._instance.get_mutable()->optional_nested_message_ = const_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage*>(
+      ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_._instance.get_mutable()->optional_foreign_message_ = const_cast< ::protobuf_unittest_no_arena::ForeignMessage*>(
+      ::protobuf_unittest_no_arena::ForeignMessage::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_._instance.get_mutable()->optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessage*>(
+      ::protobuf_unittest_import::ImportMessage::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_._instance.get_mutable()->optional_public_import_message_ = const_cast< ::protobuf_unittest_import::PublicImportMessage*>(
+      ::protobuf_unittest_import::PublicImportMessage::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_._instance.get_mutable()->optional_message_ = const_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage*>(
+      ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_.oneof_uint32_ = 0u;
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_.oneof_nested_message_ = const_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage*>(
+      ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::internal_default_instance());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_.oneof_string_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_.oneof_bytes_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::protobuf_unittest_no_arena::_TestAllTypes_default_instance_.lazy_oneof_nested_message_ = const_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage*>(
+      ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::internal_default_instance());
+}
+class TestAllTypes::HasBitSetters {
+ public:
+  static void set_has_optional_int32(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00008000u;
+  }
+  static void set_has_optional_int64(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00004000u;
+  }
+  static void set_has_optional_uint32(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00010000u;
+  }
+  static void set_has_optional_uint64(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00020000u;
+  }
+  static void set_has_optional_sint32(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00080000u;
+  }
+  static void set_has_optional_sint64(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00040000u;
+  }
+  static void set_has_optional_fixed32(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00100000u;
+  }
+  static void set_has_optional_fixed64(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00200000u;
+  }
+  static void set_has_optional_sfixed32(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00800000u;
+  }
+  static void set_has_optional_sfixed64(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00400000u;
+  }
+  static void set_has_optional_float(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x01000000u;
+  }
+  static void set_has_optional_double(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x02000000u;
+  }
+  static void set_has_optional_bool(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x04000000u;
+  }
+  static void set_has_optional_string(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+  static void set_has_optional_bytes(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000002u;
+  }
+  static const ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup& optionalgroup(const TestAllTypes* msg);
+  static void set_has_optionalgroup(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000100u;
+  }
+  static const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage& optional_nested_message(const TestAllTypes* msg);
+  static void set_has_optional_nested_message(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000200u;
+  }
+  static const ::protobuf_unittest_no_arena::ForeignMessage& optional_foreign_message(const TestAllTypes* msg);
+  static void set_has_optional_foreign_message(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000400u;
+  }
+  static const ::protobuf_unittest_import::ImportMessage& optional_import_message(const TestAllTypes* msg);
+  static void set_has_optional_import_message(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000800u;
+  }
+  static void set_has_optional_nested_enum(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x10000000u;
+  }
+  static void set_has_optional_foreign_enum(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x20000000u;
+  }
+  static void set_has_optional_import_enum(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x40000000u;
+  }
+  static void set_has_optional_string_piece(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000004u;
+  }
+  static void set_has_optional_cord(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000008u;
+  }
+  static const ::protobuf_unittest_import::PublicImportMessage& optional_public_import_message(const TestAllTypes* msg);
+  static void set_has_optional_public_import_message(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00001000u;
+  }
+  static const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage& optional_message(const TestAllTypes* msg);
+  static void set_has_optional_message(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00002000u;
+  }
+  static void set_has_default_int32(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x80000000u;
+  }
+  static void set_has_default_int64(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000001u;
+  }
+  static void set_has_default_uint32(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000004u;
+  }
+  static void set_has_default_uint64(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000002u;
+  }
+  static void set_has_default_sint32(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000008u;
+  }
+  static void set_has_default_sint64(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000010u;
+  }
+  static void set_has_default_fixed32(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000040u;
+  }
+  static void set_has_default_fixed64(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000020u;
+  }
+  static void set_has_default_sfixed32(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000080u;
+  }
+  static void set_has_default_sfixed64(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000100u;
+  }
+  static void set_has_default_float(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000400u;
+  }
+  static void set_has_default_double(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000200u;
+  }
+  static void set_has_default_bool(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00000800u;
+  }
+  static void set_has_default_string(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000010u;
+  }
+  static void set_has_default_bytes(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000020u;
+  }
+  static void set_has_default_nested_enum(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00001000u;
+  }
+  static void set_has_default_foreign_enum(TestAllTypes* msg) {
+    msg->_has_bits_[1] |= 0x00002000u;
+  }
+  static void set_has_default_import_enum(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x08000000u;
+  }
+  static void set_has_default_string_piece(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000040u;
+  }
+  static void set_has_default_cord(TestAllTypes* msg) {
+    msg->_has_bits_[0] |= 0x00000080u;
+  }
+  static const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage& oneof_nested_message(const TestAllTypes* msg);
+  static const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage& lazy_oneof_nested_message(const TestAllTypes* msg);
+};
+
+const ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup&
+TestAllTypes::HasBitSetters::optionalgroup(const TestAllTypes* msg) {
+  return *msg->optionalgroup_;
+}
+const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::optional_nested_message(const TestAllTypes* msg) {
+  return *msg->optional_nested_message_;
+}
+const ::protobuf_unittest_no_arena::ForeignMessage&
+TestAllTypes::HasBitSetters::optional_foreign_message(const TestAllTypes* msg) {
+  return *msg->optional_foreign_message_;
+}
+const ::protobuf_unittest_import::ImportMessage&
+TestAllTypes::HasBitSetters::optional_import_message(const TestAllTypes* msg) {
+  return *msg->optional_import_message_;
+}
+const ::protobuf_unittest_import::PublicImportMessage&
+TestAllTypes::HasBitSetters::optional_public_import_message(const TestAllTypes* msg) {
+  return *msg->optional_public_import_message_;
+}
+const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::optional_message(const TestAllTypes* msg) {
+  return *msg->optional_message_;
+}
+const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::oneof_nested_message(const TestAllTypes* msg) {
+  return *msg->oneof_field_.oneof_nested_message_;
+}
+const ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::lazy_oneof_nested_message(const TestAllTypes* msg) {
+  return *msg->oneof_field_.lazy_oneof_nested_message_;
+}
+void TestAllTypes::clear_optional_import_message() {
+  if (optional_import_message_ != nullptr) optional_import_message_->Clear();
+  _has_bits_[0] &= ~0x00000800u;
+}
+void TestAllTypes::clear_optional_public_import_message() {
+  if (optional_public_import_message_ != nullptr) optional_public_import_message_->Clear();
+  _has_bits_[0] &= ~0x00001000u;
+}
+void TestAllTypes::clear_repeated_import_message() {
+  repeated_import_message_.Clear();
+}
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_;
+void TestAllTypes::set_allocated_oneof_nested_message(::protobuf_unittest_no_arena::TestAllTypes_NestedMessage* oneof_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  clear_oneof_field();
+  if (oneof_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      oneof_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_nested_message, submessage_arena);
+    }
+    set_has_oneof_nested_message();
+    oneof_field_.oneof_nested_message_ = oneof_nested_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_no_arena.TestAllTypes.oneof_nested_message)
+}
+void TestAllTypes::set_allocated_lazy_oneof_nested_message(::protobuf_unittest_no_arena::TestAllTypes_NestedMessage* lazy_oneof_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  clear_oneof_field();
+  if (lazy_oneof_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      lazy_oneof_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lazy_oneof_nested_message, submessage_arena);
+    }
+    set_has_lazy_oneof_nested_message();
+    oneof_field_.lazy_oneof_nested_message_ = lazy_oneof_nested_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_no_arena.TestAllTypes.lazy_oneof_nested_message)
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAllTypes::kOptionalInt32FieldNumber;
+const int TestAllTypes::kOptionalInt64FieldNumber;
+const int TestAllTypes::kOptionalUint32FieldNumber;
+const int TestAllTypes::kOptionalUint64FieldNumber;
+const int TestAllTypes::kOptionalSint32FieldNumber;
+const int TestAllTypes::kOptionalSint64FieldNumber;
+const int TestAllTypes::kOptionalFixed32FieldNumber;
+const int TestAllTypes::kOptionalFixed64FieldNumber;
+const int TestAllTypes::kOptionalSfixed32FieldNumber;
+const int TestAllTypes::kOptionalSfixed64FieldNumber;
+const int TestAllTypes::kOptionalFloatFieldNumber;
+const int TestAllTypes::kOptionalDoubleFieldNumber;
+const int TestAllTypes::kOptionalBoolFieldNumber;
+const int TestAllTypes::kOptionalStringFieldNumber;
+const int TestAllTypes::kOptionalBytesFieldNumber;
+const int TestAllTypes::kOptionalgroupFieldNumber;
+const int TestAllTypes::kOptionalNestedMessageFieldNumber;
+const int TestAllTypes::kOptionalForeignMessageFieldNumber;
+const int TestAllTypes::kOptionalImportMessageFieldNumber;
+const int TestAllTypes::kOptionalNestedEnumFieldNumber;
+const int TestAllTypes::kOptionalForeignEnumFieldNumber;
+const int TestAllTypes::kOptionalImportEnumFieldNumber;
+const int TestAllTypes::kOptionalStringPieceFieldNumber;
+const int TestAllTypes::kOptionalCordFieldNumber;
+const int TestAllTypes::kOptionalPublicImportMessageFieldNumber;
+const int TestAllTypes::kOptionalMessageFieldNumber;
+const int TestAllTypes::kRepeatedInt32FieldNumber;
+const int TestAllTypes::kRepeatedInt64FieldNumber;
+const int TestAllTypes::kRepeatedUint32FieldNumber;
+const int TestAllTypes::kRepeatedUint64FieldNumber;
+const int TestAllTypes::kRepeatedSint32FieldNumber;
+const int TestAllTypes::kRepeatedSint64FieldNumber;
+const int TestAllTypes::kRepeatedFixed32FieldNumber;
+const int TestAllTypes::kRepeatedFixed64FieldNumber;
+const int TestAllTypes::kRepeatedSfixed32FieldNumber;
+const int TestAllTypes::kRepeatedSfixed64FieldNumber;
+const int TestAllTypes::kRepeatedFloatFieldNumber;
+const int TestAllTypes::kRepeatedDoubleFieldNumber;
+const int TestAllTypes::kRepeatedBoolFieldNumber;
+const int TestAllTypes::kRepeatedStringFieldNumber;
+const int TestAllTypes::kRepeatedBytesFieldNumber;
+const int TestAllTypes::kRepeatedgroupFieldNumber;
+const int TestAllTypes::kRepeatedNestedMessageFieldNumber;
+const int TestAllTypes::kRepeatedForeignMessageFieldNumber;
+const int TestAllTypes::kRepeatedImportMessageFieldNumber;
+const int TestAllTypes::kRepeatedNestedEnumFieldNumber;
+const int TestAllTypes::kRepeatedForeignEnumFieldNumber;
+const int TestAllTypes::kRepeatedImportEnumFieldNumber;
+const int TestAllTypes::kRepeatedStringPieceFieldNumber;
+const int TestAllTypes::kRepeatedCordFieldNumber;
+const int TestAllTypes::kRepeatedLazyMessageFieldNumber;
+const int TestAllTypes::kDefaultInt32FieldNumber;
+const int TestAllTypes::kDefaultInt64FieldNumber;
+const int TestAllTypes::kDefaultUint32FieldNumber;
+const int TestAllTypes::kDefaultUint64FieldNumber;
+const int TestAllTypes::kDefaultSint32FieldNumber;
+const int TestAllTypes::kDefaultSint64FieldNumber;
+const int TestAllTypes::kDefaultFixed32FieldNumber;
+const int TestAllTypes::kDefaultFixed64FieldNumber;
+const int TestAllTypes::kDefaultSfixed32FieldNumber;
+const int TestAllTypes::kDefaultSfixed64FieldNumber;
+const int TestAllTypes::kDefaultFloatFieldNumber;
+const int TestAllTypes::kDefaultDoubleFieldNumber;
+const int TestAllTypes::kDefaultBoolFieldNumber;
+const int TestAllTypes::kDefaultStringFieldNumber;
+const int TestAllTypes::kDefaultBytesFieldNumber;
+const int TestAllTypes::kDefaultNestedEnumFieldNumber;
+const int TestAllTypes::kDefaultForeignEnumFieldNumber;
+const int TestAllTypes::kDefaultImportEnumFieldNumber;
+const int TestAllTypes::kDefaultStringPieceFieldNumber;
+const int TestAllTypes::kDefaultCordFieldNumber;
+const int TestAllTypes::kOneofUint32FieldNumber;
+const int TestAllTypes::kOneofNestedMessageFieldNumber;
+const int TestAllTypes::kOneofStringFieldNumber;
+const int TestAllTypes::kOneofBytesFieldNumber;
+const int TestAllTypes::kLazyOneofNestedMessageFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAllTypes::TestAllTypes()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_no_arena.TestAllTypes)
+}
+TestAllTypes::TestAllTypes(const TestAllTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_),
+      repeated_int32_(from.repeated_int32_),
+      repeated_int64_(from.repeated_int64_),
+      repeated_uint32_(from.repeated_uint32_),
+      repeated_uint64_(from.repeated_uint64_),
+      repeated_sint32_(from.repeated_sint32_),
+      repeated_sint64_(from.repeated_sint64_),
+      repeated_fixed32_(from.repeated_fixed32_),
+      repeated_fixed64_(from.repeated_fixed64_),
+      repeated_sfixed32_(from.repeated_sfixed32_),
+      repeated_sfixed64_(from.repeated_sfixed64_),
+      repeated_float_(from.repeated_float_),
+      repeated_double_(from.repeated_double_),
+      repeated_bool_(from.repeated_bool_),
+      repeated_string_(from.repeated_string_),
+      repeated_bytes_(from.repeated_bytes_),
+      repeatedgroup_(from.repeatedgroup_),
+      repeated_nested_message_(from.repeated_nested_message_),
+      repeated_foreign_message_(from.repeated_foreign_message_),
+      repeated_import_message_(from.repeated_import_message_),
+      repeated_nested_enum_(from.repeated_nested_enum_),
+      repeated_foreign_enum_(from.repeated_foreign_enum_),
+      repeated_import_enum_(from.repeated_import_enum_),
+      repeated_string_piece_(from.repeated_string_piece_),
+      repeated_cord_(from.repeated_cord_),
+      repeated_lazy_message_(from.repeated_lazy_message_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.has_optional_string()) {
+    optional_string_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_);
+  }
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.has_optional_bytes()) {
+    optional_bytes_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_bytes_);
+  }
+  optional_string_piece_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.has_optional_string_piece()) {
+    optional_string_piece_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_piece_);
+  }
+  optional_cord_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.has_optional_cord()) {
+    optional_cord_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_cord_);
+  }
+  default_string_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get());
+  if (from.has_default_string()) {
+    default_string_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get(), from.default_string_);
+  }
+  default_bytes_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+  if (from.has_default_bytes()) {
+    default_bytes_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get(), from.default_bytes_);
+  }
+  default_string_piece_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+  if (from.has_default_string_piece()) {
+    default_string_piece_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get(), from.default_string_piece_);
+  }
+  default_cord_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get());
+  if (from.has_default_cord()) {
+    default_cord_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get(), from.default_cord_);
+  }
+  if (from.has_optionalgroup()) {
+    optionalgroup_ = new ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup(*from.optionalgroup_);
+  } else {
+    optionalgroup_ = nullptr;
+  }
+  if (from.has_optional_nested_message()) {
+    optional_nested_message_ = new ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage(*from.optional_nested_message_);
+  } else {
+    optional_nested_message_ = nullptr;
+  }
+  if (from.has_optional_foreign_message()) {
+    optional_foreign_message_ = new ::protobuf_unittest_no_arena::ForeignMessage(*from.optional_foreign_message_);
+  } else {
+    optional_foreign_message_ = nullptr;
+  }
+  if (from.has_optional_import_message()) {
+    optional_import_message_ = new ::protobuf_unittest_import::ImportMessage(*from.optional_import_message_);
+  } else {
+    optional_import_message_ = nullptr;
+  }
+  if (from.has_optional_public_import_message()) {
+    optional_public_import_message_ = new ::protobuf_unittest_import::PublicImportMessage(*from.optional_public_import_message_);
+  } else {
+    optional_public_import_message_ = nullptr;
+  }
+  if (from.has_optional_message()) {
+    optional_message_ = new ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage(*from.optional_message_);
+  } else {
+    optional_message_ = nullptr;
+  }
+  ::memcpy(&optional_int64_, &from.optional_int64_,
+    static_cast<size_t>(reinterpret_cast<char*>(&default_foreign_enum_) -
+    reinterpret_cast<char*>(&optional_int64_)) + sizeof(default_foreign_enum_));
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      set_oneof_uint32(from.oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      mutable_oneof_nested_message()->::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::MergeFrom(from.oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      set_oneof_string(from.oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      set_oneof_bytes(from.oneof_bytes());
+      break;
+    }
+    case kLazyOneofNestedMessage: {
+      mutable_lazy_oneof_nested_message()->::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::MergeFrom(from.lazy_oneof_nested_message());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_no_arena.TestAllTypes)
+}
+
+void TestAllTypes::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  default_string_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get());
+  default_bytes_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+  default_string_piece_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+  default_cord_.UnsafeSetDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get());
+  ::memset(&optionalgroup_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&optional_bool_) -
+      reinterpret_cast<char*>(&optionalgroup_)) + sizeof(optional_bool_));
+  default_import_enum_ = 8;
+  optional_nested_enum_ = 1;
+  optional_foreign_enum_ = 4;
+  optional_import_enum_ = 7;
+  default_int32_ = 41;
+  default_int64_ = PROTOBUF_LONGLONG(42);
+  default_uint64_ = PROTOBUF_ULONGLONG(44);
+  default_uint32_ = 43u;
+  default_sint32_ = -45;
+  default_sint64_ = PROTOBUF_LONGLONG(46);
+  default_fixed64_ = PROTOBUF_ULONGLONG(48);
+  default_fixed32_ = 47u;
+  default_sfixed32_ = 49;
+  default_sfixed64_ = PROTOBUF_LONGLONG(-50);
+  default_double_ = 52000;
+  default_float_ = 51.5f;
+  default_bool_ = true;
+  default_nested_enum_ = 2;
+  default_foreign_enum_ = 5;
+  clear_has_oneof_field();
+}
+
+TestAllTypes::~TestAllTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_no_arena.TestAllTypes)
+  SharedDtor();
+}
+
+void TestAllTypes::SharedDtor() {
+  optional_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  default_string_.DestroyNoArena(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get());
+  default_bytes_.DestroyNoArena(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+  default_string_piece_.DestroyNoArena(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+  default_cord_.DestroyNoArena(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get());
+  if (this != internal_default_instance()) delete optionalgroup_;
+  if (this != internal_default_instance()) delete optional_nested_message_;
+  if (this != internal_default_instance()) delete optional_foreign_message_;
+  if (this != internal_default_instance()) delete optional_import_message_;
+  if (this != internal_default_instance()) delete optional_public_import_message_;
+  if (this != internal_default_instance()) delete optional_message_;
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void TestAllTypes::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypes& TestAllTypes::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypes::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest_no_arena.TestAllTypes)
+  switch (oneof_field_case()) {
+    case kOneofUint32: {
+      // No need to clear
+      break;
+    }
+    case kOneofNestedMessage: {
+      delete oneof_field_.oneof_nested_message_;
+      break;
+    }
+    case kOneofString: {
+      oneof_field_.oneof_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+      break;
+    }
+    case kOneofBytes: {
+      oneof_field_.oneof_bytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+      break;
+    }
+    case kLazyOneofNestedMessage: {
+      delete oneof_field_.lazy_oneof_nested_message_;
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void TestAllTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_no_arena.TestAllTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_int32_.Clear();
+  repeated_int64_.Clear();
+  repeated_uint32_.Clear();
+  repeated_uint64_.Clear();
+  repeated_sint32_.Clear();
+  repeated_sint64_.Clear();
+  repeated_fixed32_.Clear();
+  repeated_fixed64_.Clear();
+  repeated_sfixed32_.Clear();
+  repeated_sfixed64_.Clear();
+  repeated_float_.Clear();
+  repeated_double_.Clear();
+  repeated_bool_.Clear();
+  repeated_string_.Clear();
+  repeated_bytes_.Clear();
+  repeatedgroup_.Clear();
+  repeated_nested_message_.Clear();
+  repeated_foreign_message_.Clear();
+  repeated_import_message_.Clear();
+  repeated_nested_enum_.Clear();
+  repeated_foreign_enum_.Clear();
+  repeated_import_enum_.Clear();
+  repeated_string_piece_.Clear();
+  repeated_cord_.Clear();
+  repeated_lazy_message_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      optional_string_.ClearNonDefaultToEmptyNoArena();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      optional_bytes_.ClearNonDefaultToEmptyNoArena();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      optional_string_piece_.ClearNonDefaultToEmptyNoArena();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      optional_cord_.ClearNonDefaultToEmptyNoArena();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      default_string_.UnsafeMutablePointer()->assign(*&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      default_bytes_.UnsafeMutablePointer()->assign(*&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      default_string_piece_.UnsafeMutablePointer()->assign(*&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      default_cord_.UnsafeMutablePointer()->assign(*&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get());
+    }
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(optionalgroup_ != nullptr);
+      optionalgroup_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(optional_nested_message_ != nullptr);
+      optional_nested_message_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(optional_foreign_message_ != nullptr);
+      optional_foreign_message_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(optional_import_message_ != nullptr);
+      optional_import_message_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(optional_public_import_message_ != nullptr);
+      optional_public_import_message_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(optional_message_ != nullptr);
+      optional_message_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000c000u) {
+    ::memset(&optional_int64_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&optional_int32_) -
+        reinterpret_cast<char*>(&optional_int64_)) + sizeof(optional_int32_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&optional_uint32_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&optional_sfixed32_) -
+        reinterpret_cast<char*>(&optional_uint32_)) + sizeof(optional_sfixed32_));
+  }
+  if (cached_has_bits & 0xff000000u) {
+    ::memset(&optional_float_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&optional_bool_) -
+        reinterpret_cast<char*>(&optional_float_)) + sizeof(optional_bool_));
+    default_import_enum_ = 8;
+    optional_nested_enum_ = 1;
+    optional_foreign_enum_ = 4;
+    optional_import_enum_ = 7;
+    default_int32_ = 41;
+  }
+  cached_has_bits = _has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    default_int64_ = PROTOBUF_LONGLONG(42);
+    default_uint64_ = PROTOBUF_ULONGLONG(44);
+    default_uint32_ = 43u;
+    default_sint32_ = -45;
+    default_sint64_ = PROTOBUF_LONGLONG(46);
+    default_fixed64_ = PROTOBUF_ULONGLONG(48);
+    default_fixed32_ = 47u;
+    default_sfixed32_ = 49;
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    default_sfixed64_ = PROTOBUF_LONGLONG(-50);
+    default_double_ = 52000;
+    default_float_ = 51.5f;
+    default_bool_ = true;
+    default_nested_enum_ = 2;
+    default_foreign_enum_ = 5;
+  }
+  clear_oneof_field();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAllTypes::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 optional_int32 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_optional_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional int64 optional_int64 = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 16) goto handle_unusual;
+        set_optional_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional uint32 optional_uint32 = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 24) goto handle_unusual;
+        set_optional_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional uint64 optional_uint64 = 4;
+      case 4: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 32) goto handle_unusual;
+        set_optional_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional sint32 optional_sint32 = 5;
+      case 5: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 40) goto handle_unusual;
+        set_optional_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional sint64 optional_sint64 = 6;
+      case 6: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 48) goto handle_unusual;
+        set_optional_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional fixed32 optional_fixed32 = 7;
+      case 7: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 61) goto handle_unusual;
+        set_optional_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        break;
+      }
+      // optional fixed64 optional_fixed64 = 8;
+      case 8: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 65) goto handle_unusual;
+        set_optional_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        break;
+      }
+      // optional sfixed32 optional_sfixed32 = 9;
+      case 9: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 77) goto handle_unusual;
+        set_optional_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+        break;
+      }
+      // optional sfixed64 optional_sfixed64 = 10;
+      case 10: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 81) goto handle_unusual;
+        set_optional_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+        break;
+      }
+      // optional float optional_float = 11;
+      case 11: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 93) goto handle_unusual;
+        set_optional_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+        ptr += sizeof(float);
+        break;
+      }
+      // optional double optional_double = 12;
+      case 12: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 97) goto handle_unusual;
+        set_optional_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+        ptr += sizeof(double);
+        break;
+      }
+      // optional bool optional_bool = 13;
+      case 13: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 104) goto handle_unusual;
+        set_optional_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional string optional_string = 14;
+      case 14: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 114) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_optional_string(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.optional_string");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional bytes optional_bytes = 15;
+      case 15: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 122) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_optional_bytes(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional group OptionalGroup = 16 { ... };
+      case 16: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 131) goto handle_unusual;
+        ptr = ctx->ParseGroup(mutable_optionalgroup(), ptr, tag);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_nested_message = 18;
+      case 18: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_nested_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.ForeignMessage optional_foreign_message = 19;
+      case 19: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 154) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_foreign_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+      case 20: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 162) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_import_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum optional_nested_enum = 21;
+      case 21: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 168) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(21, val, mutable_unknown_fields());
+          break;
+        }
+        set_optional_nested_enum(static_cast<::protobuf_unittest_no_arena::TestAllTypes_NestedEnum>(val));
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.ForeignEnum optional_foreign_enum = 22;
+      case 22: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 176) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_no_arena::ForeignEnum_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(22, val, mutable_unknown_fields());
+          break;
+        }
+        set_optional_foreign_enum(static_cast<::protobuf_unittest_no_arena::ForeignEnum>(val));
+        break;
+      }
+      // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+      case 23: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 184) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_import::ImportEnum_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(23, val, mutable_unknown_fields());
+          break;
+        }
+        set_optional_import_enum(static_cast<::protobuf_unittest_import::ImportEnum>(val));
+        break;
+      }
+      // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+      case 24: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 194) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_optional_string_piece(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.optional_string_piece");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional string optional_cord = 25 [ctype = CORD];
+      case 25: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 202) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_optional_cord(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.optional_cord");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+      case 26: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 210) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_public_import_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_message = 27 [lazy = true];
+      case 27: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 218) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated int32 repeated_int32 = 31;
+      case 31: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 248) {
+          do {
+            add_repeated_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 504 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 250) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(mutable_repeated_int32(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated int64 repeated_int64 = 32;
+      case 32: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0) {
+          do {
+            add_repeated_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 640 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 2) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_repeated_int64(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated uint32 repeated_uint32 = 33;
+      case 33: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
+          do {
+            add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 648 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(mutable_repeated_uint32(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated uint64 repeated_uint64 = 34;
+      case 34: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16) {
+          do {
+            add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 656 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(mutable_repeated_uint64(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated sint32 repeated_sint32 = 35;
+      case 35: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24) {
+          do {
+            add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 664 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(mutable_repeated_sint32(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated sint64 repeated_sint64 = 36;
+      case 36: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32) {
+          do {
+            add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 672 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 34) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(mutable_repeated_sint64(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated fixed32 repeated_fixed32 = 37;
+      case 37: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 45) {
+          do {
+            add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 685 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(mutable_repeated_fixed32(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated fixed64 repeated_fixed64 = 38;
+      case 38: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 49) {
+          do {
+            add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 689 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(mutable_repeated_fixed64(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated sfixed32 repeated_sfixed32 = 39;
+      case 39: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 61) {
+          do {
+            add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 701 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 58) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed32Parser(mutable_repeated_sfixed32(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated sfixed64 repeated_sfixed64 = 40;
+      case 40: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 65) {
+          do {
+            add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 705 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 66) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed64Parser(mutable_repeated_sfixed64(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated float repeated_float = 41;
+      case 41: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 77) {
+          do {
+            add_repeated_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 717 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 74) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(mutable_repeated_float(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated double repeated_double = 42;
+      case 42: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 81) {
+          do {
+            add_repeated_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+            ptr += sizeof(double);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 721 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 82) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(mutable_repeated_double(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated bool repeated_bool = 43;
+      case 43: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88) {
+          do {
+            add_repeated_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 728 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 90) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(mutable_repeated_bool(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated string repeated_string = 44;
+      case 44: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 98) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(add_repeated_string(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.repeated_string");
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 738 && (ptr += 2));
+        break;
+      }
+      // repeated bytes repeated_bytes = 45;
+      case 45: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 106) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(add_repeated_bytes(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 746 && (ptr += 2));
+        break;
+      }
+      // repeated group RepeatedGroup = 46 { ... };
+      case 46: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 115) goto handle_unusual;
+        do {
+          ptr = ctx->ParseGroup(add_repeatedgroup(), ptr, tag);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 755 && (ptr += 2));
+        break;
+      }
+      // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_nested_message = 48;
+      case 48: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_nested_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 898 && (ptr += 2));
+        break;
+      }
+      // repeated .protobuf_unittest_no_arena.ForeignMessage repeated_foreign_message = 49;
+      case 49: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_foreign_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 906 && (ptr += 2));
+        break;
+      }
+      // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+      case 50: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_import_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 914 && (ptr += 2));
+        break;
+      }
+      // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+      case 51: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 152) {
+          do {
+            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (!::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid(val)) {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(51, val, mutable_unknown_fields());
+              break;
+            }
+            add_repeated_nested_enum(static_cast<::protobuf_unittest_no_arena::TestAllTypes_NestedEnum>(val));
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 920 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 154) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(mutable_repeated_nested_enum(), ptr, ctx, ::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid, mutable_unknown_fields(), 51);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated .protobuf_unittest_no_arena.ForeignEnum repeated_foreign_enum = 52;
+      case 52: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 160) {
+          do {
+            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (!::protobuf_unittest_no_arena::ForeignEnum_IsValid(val)) {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(52, val, mutable_unknown_fields());
+              break;
+            }
+            add_repeated_foreign_enum(static_cast<::protobuf_unittest_no_arena::ForeignEnum>(val));
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 928 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 162) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(mutable_repeated_foreign_enum(), ptr, ctx, ::protobuf_unittest_no_arena::ForeignEnum_IsValid, mutable_unknown_fields(), 52);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+      case 53: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 168) {
+          do {
+            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+            GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+            if (!::protobuf_unittest_import::ImportEnum_IsValid(val)) {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(53, val, mutable_unknown_fields());
+              break;
+            }
+            add_repeated_import_enum(static_cast<::protobuf_unittest_import::ImportEnum>(val));
+            if (ctx->Done(&ptr)) return ptr;
+          } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 936 && (ptr += 2));
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 170) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(mutable_repeated_import_enum(), ptr, ctx, ::protobuf_unittest_import::ImportEnum_IsValid, mutable_unknown_fields(), 53);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+      case 54: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 178) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(add_repeated_string_piece(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.repeated_string_piece");
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 946 && (ptr += 2));
+        break;
+      }
+      // repeated string repeated_cord = 55 [ctype = CORD];
+      case 55: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 186) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(add_repeated_cord(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.repeated_cord");
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 954 && (ptr += 2));
+        break;
+      }
+      // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+      case 57: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 202) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_lazy_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 970 && (ptr += 2));
+        break;
+      }
+      // optional int32 default_int32 = 61 [default = 41];
+      case 61: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 232) goto handle_unusual;
+        set_default_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional int64 default_int64 = 62 [default = 42];
+      case 62: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 240) goto handle_unusual;
+        set_default_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional uint32 default_uint32 = 63 [default = 43];
+      case 63: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 248) goto handle_unusual;
+        set_default_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional uint64 default_uint64 = 64 [default = 44];
+      case 64: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 0) goto handle_unusual;
+        set_default_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional sint32 default_sint32 = 65 [default = -45];
+      case 65: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_default_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional sint64 default_sint64 = 66 [default = 46];
+      case 66: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 16) goto handle_unusual;
+        set_default_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional fixed32 default_fixed32 = 67 [default = 47];
+      case 67: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 29) goto handle_unusual;
+        set_default_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        break;
+      }
+      // optional fixed64 default_fixed64 = 68 [default = 48];
+      case 68: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 33) goto handle_unusual;
+        set_default_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        break;
+      }
+      // optional sfixed32 default_sfixed32 = 69 [default = 49];
+      case 69: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 45) goto handle_unusual;
+        set_default_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+        break;
+      }
+      // optional sfixed64 default_sfixed64 = 70 [default = -50];
+      case 70: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 49) goto handle_unusual;
+        set_default_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+        break;
+      }
+      // optional float default_float = 71 [default = 51.5];
+      case 71: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 61) goto handle_unusual;
+        set_default_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+        ptr += sizeof(float);
+        break;
+      }
+      // optional double default_double = 72 [default = 52000];
+      case 72: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 65) goto handle_unusual;
+        set_default_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+        ptr += sizeof(double);
+        break;
+      }
+      // optional bool default_bool = 73 [default = true];
+      case 73: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 72) goto handle_unusual;
+        set_default_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional string default_string = 74 [default = "hello"];
+      case 74: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 82) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_default_string(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.default_string");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional bytes default_bytes = 75 [default = "world"];
+      case 75: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 90) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_default_bytes(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+      case 81: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 136) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(81, val, mutable_unknown_fields());
+          break;
+        }
+        set_default_nested_enum(static_cast<::protobuf_unittest_no_arena::TestAllTypes_NestedEnum>(val));
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+      case 82: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 144) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_no_arena::ForeignEnum_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(82, val, mutable_unknown_fields());
+          break;
+        }
+        set_default_foreign_enum(static_cast<::protobuf_unittest_no_arena::ForeignEnum>(val));
+        break;
+      }
+      // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+      case 83: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 152) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (!::protobuf_unittest_import::ImportEnum_IsValid(val)) {
+          ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(83, val, mutable_unknown_fields());
+          break;
+        }
+        set_default_import_enum(static_cast<::protobuf_unittest_import::ImportEnum>(val));
+        break;
+      }
+      // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+      case 84: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 162) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_default_string_piece(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.default_string_piece");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional string default_cord = 85 [default = "123", ctype = CORD];
+      case 85: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 170) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_default_cord(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.default_cord");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional uint32 oneof_uint32 = 111;
+      case 111: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 120) goto handle_unusual;
+        set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage oneof_nested_message = 112;
+      case 112: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_oneof_nested_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional string oneof_string = 113;
+      case 113: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8Verify(mutable_oneof_string(), ptr, ctx, "protobuf_unittest_no_arena.TestAllTypes.oneof_string");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional bytes oneof_bytes = 114;
+      case 114: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_oneof_bytes(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage lazy_oneof_nested_message = 115 [lazy = true];
+      case 115: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 154) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_lazy_oneof_nested_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAllTypes::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_no_arena.TestAllTypes)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 optional_int32 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          HasBitSetters::set_has_optional_int32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &optional_int32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional int64 optional_int64 = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+          HasBitSetters::set_has_optional_int64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &optional_int64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 optional_uint32 = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+          HasBitSetters::set_has_optional_uint32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &optional_uint32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 optional_uint64 = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
+          HasBitSetters::set_has_optional_uint64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &optional_uint64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sint32 optional_sint32 = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
+          HasBitSetters::set_has_optional_sint32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 input, &optional_sint32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sint64 optional_sint64 = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
+          HasBitSetters::set_has_optional_sint64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 input, &optional_sint64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional fixed32 optional_fixed32 = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (61 & 0xFF)) {
+          HasBitSetters::set_has_optional_fixed32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, &optional_fixed32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional fixed64 optional_fixed64 = 8;
+      case 8: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (65 & 0xFF)) {
+          HasBitSetters::set_has_optional_fixed64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, &optional_fixed64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sfixed32 optional_sfixed32 = 9;
+      case 9: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (77 & 0xFF)) {
+          HasBitSetters::set_has_optional_sfixed32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 input, &optional_sfixed32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sfixed64 optional_sfixed64 = 10;
+      case 10: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (81 & 0xFF)) {
+          HasBitSetters::set_has_optional_sfixed64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 input, &optional_sfixed64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional float optional_float = 11;
+      case 11: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (93 & 0xFF)) {
+          HasBitSetters::set_has_optional_float(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &optional_float_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional double optional_double = 12;
+      case 12: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (97 & 0xFF)) {
+          HasBitSetters::set_has_optional_double(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &optional_double_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool optional_bool = 13;
+      case 13: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (104 & 0xFF)) {
+          HasBitSetters::set_has_optional_bool(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &optional_bool_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string optional_string = 14;
+      case 14: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (114 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_string()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->optional_string().data(), static_cast<int>(this->optional_string().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.optional_string");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes optional_bytes = 15;
+      case 15: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (122 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_optional_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional group OptionalGroup = 16 { ... };
+      case 16: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (131 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadGroup(
+                16, input, mutable_optionalgroup()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_nested_message = 18;
+      case 18: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (146 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.ForeignMessage optional_foreign_message = 19;
+      case 19: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (154 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_foreign_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+      case 20: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (162 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_import_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum optional_nested_enum = 21;
+      case 21: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (168 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid(value)) {
+            set_optional_nested_enum(static_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                21, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.ForeignEnum optional_foreign_enum = 22;
+      case 22: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (176 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_no_arena::ForeignEnum_IsValid(value)) {
+            set_optional_foreign_enum(static_cast< ::protobuf_unittest_no_arena::ForeignEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                22, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+      case 23: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (184 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_import::ImportEnum_IsValid(value)) {
+            set_optional_import_enum(static_cast< ::protobuf_unittest_import::ImportEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                23, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+      case 24: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (194 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_string_piece()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->optional_string_piece().data(), static_cast<int>(this->optional_string_piece().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.optional_string_piece");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string optional_cord = 25 [ctype = CORD];
+      case 25: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (202 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_cord()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->optional_cord().data(), static_cast<int>(this->optional_cord().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.optional_cord");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+      case 26: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (210 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_public_import_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_message = 27 [lazy = true];
+      case 27: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (218 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 repeated_int32 = 31;
+      case 31: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (248 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 2, 248u, input, this->mutable_repeated_int32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (250 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_repeated_int32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 repeated_int64 = 32;
+      case 32: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (256 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 2, 256u, input, this->mutable_repeated_int64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (258 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_repeated_int64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint32 repeated_uint32 = 33;
+      case 33: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (264 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 2, 264u, input, this->mutable_repeated_uint32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (266 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_repeated_uint32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 repeated_uint64 = 34;
+      case 34: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (272 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 2, 272u, input, this->mutable_repeated_uint64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (274 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_repeated_uint64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint32 repeated_sint32 = 35;
+      case 35: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (280 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 2, 280u, input, this->mutable_repeated_sint32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (282 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 input, this->mutable_repeated_sint32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint64 repeated_sint64 = 36;
+      case 36: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (288 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 2, 288u, input, this->mutable_repeated_sint64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (290 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 input, this->mutable_repeated_sint64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated fixed32 repeated_fixed32 = 37;
+      case 37: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (301 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 2, 301u, input, this->mutable_repeated_fixed32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (298 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, this->mutable_repeated_fixed32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated fixed64 repeated_fixed64 = 38;
+      case 38: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (305 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 2, 305u, input, this->mutable_repeated_fixed64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (306 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, this->mutable_repeated_fixed64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sfixed32 repeated_sfixed32 = 39;
+      case 39: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (317 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 2, 317u, input, this->mutable_repeated_sfixed32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (314 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 input, this->mutable_repeated_sfixed32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sfixed64 repeated_sfixed64 = 40;
+      case 40: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (321 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 2, 321u, input, this->mutable_repeated_sfixed64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (322 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 input, this->mutable_repeated_sfixed64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float repeated_float = 41;
+      case 41: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (333 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 2, 333u, input, this->mutable_repeated_float())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (330 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_repeated_float())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated double repeated_double = 42;
+      case 42: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (337 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 2, 337u, input, this->mutable_repeated_double())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (338 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, this->mutable_repeated_double())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated bool repeated_bool = 43;
+      case 43: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (344 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 2, 344u, input, this->mutable_repeated_bool())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (346 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 input, this->mutable_repeated_bool())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string repeated_string = 44;
+      case 44: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (354 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_string()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->repeated_string(this->repeated_string_size() - 1).data(),
+            static_cast<int>(this->repeated_string(this->repeated_string_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.repeated_string");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated bytes repeated_bytes = 45;
+      case 45: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (362 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->add_repeated_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated group RepeatedGroup = 46 { ... };
+      case 46: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (371 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadGroup(46, input, add_repeatedgroup()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_nested_message = 48;
+      case 48: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (386 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_no_arena.ForeignMessage repeated_foreign_message = 49;
+      case 49: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (394 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_foreign_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+      case 50: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (402 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_import_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+      case 51: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (408 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid(value)) {
+            add_repeated_nested_enum(static_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                51, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (410 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ReadPackedEnumPreserveUnknowns(
+                 input,
+                 51,
+                 ::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid,
+                 mutable_unknown_fields(),
+                 this->mutable_repeated_nested_enum())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_no_arena.ForeignEnum repeated_foreign_enum = 52;
+      case 52: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (416 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_no_arena::ForeignEnum_IsValid(value)) {
+            add_repeated_foreign_enum(static_cast< ::protobuf_unittest_no_arena::ForeignEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                52, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (418 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ReadPackedEnumPreserveUnknowns(
+                 input,
+                 52,
+                 ::protobuf_unittest_no_arena::ForeignEnum_IsValid,
+                 mutable_unknown_fields(),
+                 this->mutable_repeated_foreign_enum())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+      case 53: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (424 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_import::ImportEnum_IsValid(value)) {
+            add_repeated_import_enum(static_cast< ::protobuf_unittest_import::ImportEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                53, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (426 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ReadPackedEnumPreserveUnknowns(
+                 input,
+                 53,
+                 ::protobuf_unittest_import::ImportEnum_IsValid,
+                 mutable_unknown_fields(),
+                 this->mutable_repeated_import_enum())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+      case 54: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (434 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_string_piece()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->repeated_string_piece(this->repeated_string_piece_size() - 1).data(),
+            static_cast<int>(this->repeated_string_piece(this->repeated_string_piece_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.repeated_string_piece");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string repeated_cord = 55 [ctype = CORD];
+      case 55: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (442 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_cord()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->repeated_cord(this->repeated_cord_size() - 1).data(),
+            static_cast<int>(this->repeated_cord(this->repeated_cord_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.repeated_cord");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+      case 57: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (458 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_lazy_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional int32 default_int32 = 61 [default = 41];
+      case 61: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (488 & 0xFF)) {
+          HasBitSetters::set_has_default_int32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &default_int32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional int64 default_int64 = 62 [default = 42];
+      case 62: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (496 & 0xFF)) {
+          HasBitSetters::set_has_default_int64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &default_int64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 default_uint32 = 63 [default = 43];
+      case 63: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (504 & 0xFF)) {
+          HasBitSetters::set_has_default_uint32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &default_uint32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 default_uint64 = 64 [default = 44];
+      case 64: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (512 & 0xFF)) {
+          HasBitSetters::set_has_default_uint64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &default_uint64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sint32 default_sint32 = 65 [default = -45];
+      case 65: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (520 & 0xFF)) {
+          HasBitSetters::set_has_default_sint32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 input, &default_sint32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sint64 default_sint64 = 66 [default = 46];
+      case 66: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (528 & 0xFF)) {
+          HasBitSetters::set_has_default_sint64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 input, &default_sint64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional fixed32 default_fixed32 = 67 [default = 47];
+      case 67: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (541 & 0xFF)) {
+          HasBitSetters::set_has_default_fixed32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, &default_fixed32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional fixed64 default_fixed64 = 68 [default = 48];
+      case 68: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (545 & 0xFF)) {
+          HasBitSetters::set_has_default_fixed64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, &default_fixed64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sfixed32 default_sfixed32 = 69 [default = 49];
+      case 69: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (557 & 0xFF)) {
+          HasBitSetters::set_has_default_sfixed32(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 input, &default_sfixed32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sfixed64 default_sfixed64 = 70 [default = -50];
+      case 70: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (561 & 0xFF)) {
+          HasBitSetters::set_has_default_sfixed64(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 input, &default_sfixed64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional float default_float = 71 [default = 51.5];
+      case 71: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (573 & 0xFF)) {
+          HasBitSetters::set_has_default_float(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &default_float_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional double default_double = 72 [default = 52000];
+      case 72: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (577 & 0xFF)) {
+          HasBitSetters::set_has_default_double(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &default_double_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool default_bool = 73 [default = true];
+      case 73: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (584 & 0xFF)) {
+          HasBitSetters::set_has_default_bool(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &default_bool_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string default_string = 74 [default = "hello"];
+      case 74: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (594 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_default_string()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->default_string().data(), static_cast<int>(this->default_string().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.default_string");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes default_bytes = 75 [default = "world"];
+      case 75: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (602 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_default_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+      case 81: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (648 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_no_arena::TestAllTypes_NestedEnum_IsValid(value)) {
+            set_default_nested_enum(static_cast< ::protobuf_unittest_no_arena::TestAllTypes_NestedEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                81, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+      case 82: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (656 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_no_arena::ForeignEnum_IsValid(value)) {
+            set_default_foreign_enum(static_cast< ::protobuf_unittest_no_arena::ForeignEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                82, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+      case 83: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (664 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest_import::ImportEnum_IsValid(value)) {
+            set_default_import_enum(static_cast< ::protobuf_unittest_import::ImportEnum >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                83, static_cast<::PROTOBUF_NAMESPACE_ID::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+      case 84: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (674 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_default_string_piece()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->default_string_piece().data(), static_cast<int>(this->default_string_piece().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.default_string_piece");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string default_cord = 85 [default = "123", ctype = CORD];
+      case 85: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (682 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_default_cord()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->default_cord().data(), static_cast<int>(this->default_cord().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.default_cord");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 oneof_uint32 = 111;
+      case 111: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (888 & 0xFF)) {
+          clear_oneof_field();
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &oneof_field_.oneof_uint32_)));
+          set_has_oneof_uint32();
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage oneof_nested_message = 112;
+      case 112: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (898 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_oneof_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string oneof_string = 113;
+      case 113: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (906 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_oneof_string()));
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->oneof_string().data(), static_cast<int>(this->oneof_string().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::PARSE,
+            "protobuf_unittest_no_arena.TestAllTypes.oneof_string");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes oneof_bytes = 114;
+      case 114: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (914 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_oneof_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage lazy_oneof_nested_message = 115 [lazy = true];
+      case 115: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (922 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_lazy_oneof_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_no_arena.TestAllTypes)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_no_arena.TestAllTypes)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAllTypes::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_no_arena.TestAllTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 optional_int32 = 1;
+  if (cached_has_bits & 0x00008000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+
+  // optional int64 optional_int64 = 2;
+  if (cached_has_bits & 0x00004000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(2, this->optional_int64(), output);
+  }
+
+  // optional uint32 optional_uint32 = 3;
+  if (cached_has_bits & 0x00010000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(3, this->optional_uint32(), output);
+  }
+
+  // optional uint64 optional_uint64 = 4;
+  if (cached_has_bits & 0x00020000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(4, this->optional_uint64(), output);
+  }
+
+  // optional sint32 optional_sint32 = 5;
+  if (cached_has_bits & 0x00080000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32(5, this->optional_sint32(), output);
+  }
+
+  // optional sint64 optional_sint64 = 6;
+  if (cached_has_bits & 0x00040000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64(6, this->optional_sint64(), output);
+  }
+
+  // optional fixed32 optional_fixed32 = 7;
+  if (cached_has_bits & 0x00100000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32(7, this->optional_fixed32(), output);
+  }
+
+  // optional fixed64 optional_fixed64 = 8;
+  if (cached_has_bits & 0x00200000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64(8, this->optional_fixed64(), output);
+  }
+
+  // optional sfixed32 optional_sfixed32 = 9;
+  if (cached_has_bits & 0x00800000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32(9, this->optional_sfixed32(), output);
+  }
+
+  // optional sfixed64 optional_sfixed64 = 10;
+  if (cached_has_bits & 0x00400000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64(10, this->optional_sfixed64(), output);
+  }
+
+  // optional float optional_float = 11;
+  if (cached_has_bits & 0x01000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloat(11, this->optional_float(), output);
+  }
+
+  // optional double optional_double = 12;
+  if (cached_has_bits & 0x02000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDouble(12, this->optional_double(), output);
+  }
+
+  // optional bool optional_bool = 13;
+  if (cached_has_bits & 0x04000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(13, this->optional_bool(), output);
+  }
+
+  // optional string optional_string = 14;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->optional_string().data(), static_cast<int>(this->optional_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.optional_string");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      14, this->optional_string(), output);
+  }
+
+  // optional bytes optional_bytes = 15;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      15, this->optional_bytes(), output);
+  }
+
+  // optional group OptionalGroup = 16 { ... };
+  if (cached_has_bits & 0x00000100u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteGroupMaybeToArray(
+      16, HasBitSetters::optionalgroup(this), output);
+  }
+
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_nested_message = 18;
+  if (cached_has_bits & 0x00000200u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      18, HasBitSetters::optional_nested_message(this), output);
+  }
+
+  // optional .protobuf_unittest_no_arena.ForeignMessage optional_foreign_message = 19;
+  if (cached_has_bits & 0x00000400u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      19, HasBitSetters::optional_foreign_message(this), output);
+  }
+
+  // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  if (cached_has_bits & 0x00000800u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      20, HasBitSetters::optional_import_message(this), output);
+  }
+
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  if (cached_has_bits & 0x10000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      21, this->optional_nested_enum(), output);
+  }
+
+  // optional .protobuf_unittest_no_arena.ForeignEnum optional_foreign_enum = 22;
+  if (cached_has_bits & 0x20000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      22, this->optional_foreign_enum(), output);
+  }
+
+  // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+  if (cached_has_bits & 0x40000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      23, this->optional_import_enum(), output);
+  }
+
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->optional_string_piece().data(), static_cast<int>(this->optional_string_piece().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.optional_string_piece");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      24, this->optional_string_piece(), output);
+  }
+
+  // optional string optional_cord = 25 [ctype = CORD];
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->optional_cord().data(), static_cast<int>(this->optional_cord().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.optional_cord");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      25, this->optional_cord(), output);
+  }
+
+  // optional .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+  if (cached_has_bits & 0x00001000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      26, HasBitSetters::optional_public_import_message(this), output);
+  }
+
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_message = 27 [lazy = true];
+  if (cached_has_bits & 0x00002000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      27, HasBitSetters::optional_message(this), output);
+  }
+
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0, n = this->repeated_int32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(
+      31, this->repeated_int32(i), output);
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  for (int i = 0, n = this->repeated_int64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(
+      32, this->repeated_int64(i), output);
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  for (int i = 0, n = this->repeated_uint32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(
+      33, this->repeated_uint32(i), output);
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  for (int i = 0, n = this->repeated_uint64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(
+      34, this->repeated_uint64(i), output);
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  for (int i = 0, n = this->repeated_sint32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32(
+      35, this->repeated_sint32(i), output);
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  for (int i = 0, n = this->repeated_sint64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64(
+      36, this->repeated_sint64(i), output);
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  for (int i = 0, n = this->repeated_fixed32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32(
+      37, this->repeated_fixed32(i), output);
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  for (int i = 0, n = this->repeated_fixed64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64(
+      38, this->repeated_fixed64(i), output);
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  for (int i = 0, n = this->repeated_sfixed32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32(
+      39, this->repeated_sfixed32(i), output);
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  for (int i = 0, n = this->repeated_sfixed64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64(
+      40, this->repeated_sfixed64(i), output);
+  }
+
+  // repeated float repeated_float = 41;
+  for (int i = 0, n = this->repeated_float_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloat(
+      41, this->repeated_float(i), output);
+  }
+
+  // repeated double repeated_double = 42;
+  for (int i = 0, n = this->repeated_double_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDouble(
+      42, this->repeated_double(i), output);
+  }
+
+  // repeated bool repeated_bool = 43;
+  for (int i = 0, n = this->repeated_bool_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(
+      43, this->repeated_bool(i), output);
+  }
+
+  // repeated string repeated_string = 44;
+  for (int i = 0, n = this->repeated_string_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->repeated_string(i).data(), static_cast<int>(this->repeated_string(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.repeated_string");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      44, this->repeated_string(i), output);
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0, n = this->repeated_bytes_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytes(
+      45, this->repeated_bytes(i), output);
+  }
+
+  // repeated group RepeatedGroup = 46 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeatedgroup_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteGroupMaybeToArray(
+      46,
+      this->repeatedgroup(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_nested_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      48,
+      this->repeated_nested_message(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .protobuf_unittest_no_arena.ForeignMessage repeated_foreign_message = 49;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_foreign_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      49,
+      this->repeated_foreign_message(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_import_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      50,
+      this->repeated_import_message(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  for (int i = 0, n = this->repeated_nested_enum_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      51, this->repeated_nested_enum(i), output);
+  }
+
+  // repeated .protobuf_unittest_no_arena.ForeignEnum repeated_foreign_enum = 52;
+  for (int i = 0, n = this->repeated_foreign_enum_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      52, this->repeated_foreign_enum(i), output);
+  }
+
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  for (int i = 0, n = this->repeated_import_enum_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      53, this->repeated_import_enum(i), output);
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0, n = this->repeated_string_piece_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->repeated_string_piece(i).data(), static_cast<int>(this->repeated_string_piece(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.repeated_string_piece");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      54, this->repeated_string_piece(i), output);
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0, n = this->repeated_cord_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->repeated_cord(i).data(), static_cast<int>(this->repeated_cord(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.repeated_cord");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      55, this->repeated_cord(i), output);
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_lazy_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      57,
+      this->repeated_lazy_message(static_cast<int>(i)),
+      output);
+  }
+
+  // optional int32 default_int32 = 61 [default = 41];
+  if (cached_has_bits & 0x80000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(61, this->default_int32(), output);
+  }
+
+  cached_has_bits = _has_bits_[1];
+  // optional int64 default_int64 = 62 [default = 42];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(62, this->default_int64(), output);
+  }
+
+  // optional uint32 default_uint32 = 63 [default = 43];
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(63, this->default_uint32(), output);
+  }
+
+  // optional uint64 default_uint64 = 64 [default = 44];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(64, this->default_uint64(), output);
+  }
+
+  // optional sint32 default_sint32 = 65 [default = -45];
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32(65, this->default_sint32(), output);
+  }
+
+  // optional sint64 default_sint64 = 66 [default = 46];
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64(66, this->default_sint64(), output);
+  }
+
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  if (cached_has_bits & 0x00000040u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32(67, this->default_fixed32(), output);
+  }
+
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  if (cached_has_bits & 0x00000020u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64(68, this->default_fixed64(), output);
+  }
+
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  if (cached_has_bits & 0x00000080u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32(69, this->default_sfixed32(), output);
+  }
+
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  if (cached_has_bits & 0x00000100u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64(70, this->default_sfixed64(), output);
+  }
+
+  // optional float default_float = 71 [default = 51.5];
+  if (cached_has_bits & 0x00000400u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloat(71, this->default_float(), output);
+  }
+
+  // optional double default_double = 72 [default = 52000];
+  if (cached_has_bits & 0x00000200u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDouble(72, this->default_double(), output);
+  }
+
+  // optional bool default_bool = 73 [default = true];
+  if (cached_has_bits & 0x00000800u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(73, this->default_bool(), output);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional string default_string = 74 [default = "hello"];
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->default_string().data(), static_cast<int>(this->default_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.default_string");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      74, this->default_string(), output);
+  }
+
+  // optional bytes default_bytes = 75 [default = "world"];
+  if (cached_has_bits & 0x00000020u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      75, this->default_bytes(), output);
+  }
+
+  cached_has_bits = _has_bits_[1];
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+  if (cached_has_bits & 0x00001000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      81, this->default_nested_enum(), output);
+  }
+
+  // optional .protobuf_unittest_no_arena.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+  if (cached_has_bits & 0x00002000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      82, this->default_foreign_enum(), output);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+  if (cached_has_bits & 0x08000000u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      83, this->default_import_enum(), output);
+  }
+
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000040u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->default_string_piece().data(), static_cast<int>(this->default_string_piece().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.default_string_piece");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      84, this->default_string_piece(), output);
+  }
+
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  if (cached_has_bits & 0x00000080u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->default_cord().data(), static_cast<int>(this->default_cord().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.default_cord");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      85, this->default_cord(), output);
+  }
+
+  switch (oneof_field_case()) {
+    case kOneofUint32:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(111, this->oneof_uint32(), output);
+      break;
+    case kOneofNestedMessage:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+        112, HasBitSetters::oneof_nested_message(this), output);
+      break;
+    case kOneofString:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->oneof_string().data(), static_cast<int>(this->oneof_string().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "protobuf_unittest_no_arena.TestAllTypes.oneof_string");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+        113, this->oneof_string(), output);
+      break;
+    case kOneofBytes:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+        114, this->oneof_bytes(), output);
+      break;
+    case kLazyOneofNestedMessage:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+        115, HasBitSetters::lazy_oneof_nested_message(this), output);
+      break;
+    default: ;
+  }
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_no_arena.TestAllTypes)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypes::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_no_arena.TestAllTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 optional_int32 = 1;
+  if (cached_has_bits & 0x00008000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->optional_int32(), target);
+  }
+
+  // optional int64 optional_int64 = 2;
+  if (cached_has_bits & 0x00004000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->optional_int64(), target);
+  }
+
+  // optional uint32 optional_uint32 = 3;
+  if (cached_has_bits & 0x00010000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->optional_uint32(), target);
+  }
+
+  // optional uint64 optional_uint64 = 4;
+  if (cached_has_bits & 0x00020000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->optional_uint64(), target);
+  }
+
+  // optional sint32 optional_sint32 = 5;
+  if (cached_has_bits & 0x00080000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(5, this->optional_sint32(), target);
+  }
+
+  // optional sint64 optional_sint64 = 6;
+  if (cached_has_bits & 0x00040000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64ToArray(6, this->optional_sint64(), target);
+  }
+
+  // optional fixed32 optional_fixed32 = 7;
+  if (cached_has_bits & 0x00100000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(7, this->optional_fixed32(), target);
+  }
+
+  // optional fixed64 optional_fixed64 = 8;
+  if (cached_has_bits & 0x00200000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(8, this->optional_fixed64(), target);
+  }
+
+  // optional sfixed32 optional_sfixed32 = 9;
+  if (cached_has_bits & 0x00800000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32ToArray(9, this->optional_sfixed32(), target);
+  }
+
+  // optional sfixed64 optional_sfixed64 = 10;
+  if (cached_has_bits & 0x00400000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64ToArray(10, this->optional_sfixed64(), target);
+  }
+
+  // optional float optional_float = 11;
+  if (cached_has_bits & 0x01000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(11, this->optional_float(), target);
+  }
+
+  // optional double optional_double = 12;
+  if (cached_has_bits & 0x02000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(12, this->optional_double(), target);
+  }
+
+  // optional bool optional_bool = 13;
+  if (cached_has_bits & 0x04000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(13, this->optional_bool(), target);
+  }
+
+  // optional string optional_string = 14;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->optional_string().data(), static_cast<int>(this->optional_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.optional_string");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        14, this->optional_string(), target);
+  }
+
+  // optional bytes optional_bytes = 15;
+  if (cached_has_bits & 0x00000002u) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        15, this->optional_bytes(), target);
+  }
+
+  // optional group OptionalGroup = 16 { ... };
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroupToArray(
+        16, HasBitSetters::optionalgroup(this), target);
+  }
+
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_nested_message = 18;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        18, HasBitSetters::optional_nested_message(this), target);
+  }
+
+  // optional .protobuf_unittest_no_arena.ForeignMessage optional_foreign_message = 19;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        19, HasBitSetters::optional_foreign_message(this), target);
+  }
+
+  // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        20, HasBitSetters::optional_import_message(this), target);
+  }
+
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  if (cached_has_bits & 0x10000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      21, this->optional_nested_enum(), target);
+  }
+
+  // optional .protobuf_unittest_no_arena.ForeignEnum optional_foreign_enum = 22;
+  if (cached_has_bits & 0x20000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      22, this->optional_foreign_enum(), target);
+  }
+
+  // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+  if (cached_has_bits & 0x40000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      23, this->optional_import_enum(), target);
+  }
+
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->optional_string_piece().data(), static_cast<int>(this->optional_string_piece().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.optional_string_piece");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        24, this->optional_string_piece(), target);
+  }
+
+  // optional string optional_cord = 25 [ctype = CORD];
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->optional_cord().data(), static_cast<int>(this->optional_cord().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.optional_cord");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        25, this->optional_cord(), target);
+  }
+
+  // optional .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        26, HasBitSetters::optional_public_import_message(this), target);
+  }
+
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_message = 27 [lazy = true];
+  if (cached_has_bits & 0x00002000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        27, HasBitSetters::optional_message(this), target);
+  }
+
+  // repeated int32 repeated_int32 = 31;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteInt32ToArray(31, this->repeated_int32_, target);
+
+  // repeated int64 repeated_int64 = 32;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteInt64ToArray(32, this->repeated_int64_, target);
+
+  // repeated uint32 repeated_uint32 = 33;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteUInt32ToArray(33, this->repeated_uint32_, target);
+
+  // repeated uint64 repeated_uint64 = 34;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteUInt64ToArray(34, this->repeated_uint64_, target);
+
+  // repeated sint32 repeated_sint32 = 35;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteSInt32ToArray(35, this->repeated_sint32_, target);
+
+  // repeated sint64 repeated_sint64 = 36;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteSInt64ToArray(36, this->repeated_sint64_, target);
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteFixed32ToArray(37, this->repeated_fixed32_, target);
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteFixed64ToArray(38, this->repeated_fixed64_, target);
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteSFixed32ToArray(39, this->repeated_sfixed32_, target);
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteSFixed64ToArray(40, this->repeated_sfixed64_, target);
+
+  // repeated float repeated_float = 41;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteFloatToArray(41, this->repeated_float_, target);
+
+  // repeated double repeated_double = 42;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteDoubleToArray(42, this->repeated_double_, target);
+
+  // repeated bool repeated_bool = 43;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+    WriteBoolToArray(43, this->repeated_bool_, target);
+
+  // repeated string repeated_string = 44;
+  for (int i = 0, n = this->repeated_string_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->repeated_string(i).data(), static_cast<int>(this->repeated_string(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.repeated_string");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(44, this->repeated_string(i), target);
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0, n = this->repeated_bytes_size(); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteBytesToArray(45, this->repeated_bytes(i), target);
+  }
+
+  // repeated group RepeatedGroup = 46 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeatedgroup_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroupToArray(
+        46, this->repeatedgroup(static_cast<int>(i)), target);
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_nested_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        48, this->repeated_nested_message(static_cast<int>(i)), target);
+  }
+
+  // repeated .protobuf_unittest_no_arena.ForeignMessage repeated_foreign_message = 49;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_foreign_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        49, this->repeated_foreign_message(static_cast<int>(i)), target);
+  }
+
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_import_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        50, this->repeated_import_message(static_cast<int>(i)), target);
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    51, this->repeated_nested_enum_, target);
+
+  // repeated .protobuf_unittest_no_arena.ForeignEnum repeated_foreign_enum = 52;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    52, this->repeated_foreign_enum_, target);
+
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    53, this->repeated_import_enum_, target);
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0, n = this->repeated_string_piece_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->repeated_string_piece(i).data(), static_cast<int>(this->repeated_string_piece(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.repeated_string_piece");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(54, this->repeated_string_piece(i), target);
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0, n = this->repeated_cord_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->repeated_cord(i).data(), static_cast<int>(this->repeated_cord(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.repeated_cord");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(55, this->repeated_cord(i), target);
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_lazy_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        57, this->repeated_lazy_message(static_cast<int>(i)), target);
+  }
+
+  // optional int32 default_int32 = 61 [default = 41];
+  if (cached_has_bits & 0x80000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(61, this->default_int32(), target);
+  }
+
+  cached_has_bits = _has_bits_[1];
+  // optional int64 default_int64 = 62 [default = 42];
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(62, this->default_int64(), target);
+  }
+
+  // optional uint32 default_uint32 = 63 [default = 43];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(63, this->default_uint32(), target);
+  }
+
+  // optional uint64 default_uint64 = 64 [default = 44];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(64, this->default_uint64(), target);
+  }
+
+  // optional sint32 default_sint32 = 65 [default = -45];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(65, this->default_sint32(), target);
+  }
+
+  // optional sint64 default_sint64 = 66 [default = 46];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64ToArray(66, this->default_sint64(), target);
+  }
+
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(67, this->default_fixed32(), target);
+  }
+
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(68, this->default_fixed64(), target);
+  }
+
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32ToArray(69, this->default_sfixed32(), target);
+  }
+
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64ToArray(70, this->default_sfixed64(), target);
+  }
+
+  // optional float default_float = 71 [default = 51.5];
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(71, this->default_float(), target);
+  }
+
+  // optional double default_double = 72 [default = 52000];
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(72, this->default_double(), target);
+  }
+
+  // optional bool default_bool = 73 [default = true];
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(73, this->default_bool(), target);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional string default_string = 74 [default = "hello"];
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->default_string().data(), static_cast<int>(this->default_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.default_string");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        74, this->default_string(), target);
+  }
+
+  // optional bytes default_bytes = 75 [default = "world"];
+  if (cached_has_bits & 0x00000020u) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        75, this->default_bytes(), target);
+  }
+
+  cached_has_bits = _has_bits_[1];
+  // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+  if (cached_has_bits & 0x00001000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      81, this->default_nested_enum(), target);
+  }
+
+  // optional .protobuf_unittest_no_arena.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+  if (cached_has_bits & 0x00002000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      82, this->default_foreign_enum(), target);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+  if (cached_has_bits & 0x08000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      83, this->default_import_enum(), target);
+  }
+
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000040u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->default_string_piece().data(), static_cast<int>(this->default_string_piece().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.default_string_piece");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        84, this->default_string_piece(), target);
+  }
+
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  if (cached_has_bits & 0x00000080u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->default_cord().data(), static_cast<int>(this->default_cord().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_no_arena.TestAllTypes.default_cord");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        85, this->default_cord(), target);
+  }
+
+  switch (oneof_field_case()) {
+    case kOneofUint32:
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(111, this->oneof_uint32(), target);
+      break;
+    case kOneofNestedMessage:
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessageToArray(
+          112, HasBitSetters::oneof_nested_message(this), target);
+      break;
+    case kOneofString:
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->oneof_string().data(), static_cast<int>(this->oneof_string().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "protobuf_unittest_no_arena.TestAllTypes.oneof_string");
+      target =
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+          113, this->oneof_string(), target);
+      break;
+    case kOneofBytes:
+      target =
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+          114, this->oneof_bytes(), target);
+      break;
+    case kLazyOneofNestedMessage:
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessageToArray(
+          115, HasBitSetters::lazy_oneof_nested_message(this), target);
+      break;
+    default: ;
+  }
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_no_arena.TestAllTypes)
+  return target;
+}
+
+size_t TestAllTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_no_arena.TestAllTypes)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 31;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_int32_size());
+    total_size += data_size;
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->repeated_int64_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_int64_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->repeated_uint32_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_uint32_size());
+    total_size += data_size;
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt64Size(this->repeated_uint64_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_uint64_size());
+    total_size += data_size;
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt32Size(this->repeated_sint32_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_sint32_size());
+    total_size += data_size;
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt64Size(this->repeated_sint64_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_sint64_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_fixed32_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_fixed32_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_fixed64_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_fixed64_size());
+    total_size += data_size;
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_sfixed32_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_sfixed32_size());
+    total_size += data_size;
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_sfixed64_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_sfixed64_size());
+    total_size += data_size;
+  }
+
+  // repeated float repeated_float = 41;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_float_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_float_size());
+    total_size += data_size;
+  }
+
+  // repeated double repeated_double = 42;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_double_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_double_size());
+    total_size += data_size;
+  }
+
+  // repeated bool repeated_bool = 43;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_bool_size());
+    size_t data_size = 1UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_bool_size());
+    total_size += data_size;
+  }
+
+  // repeated string repeated_string = 44;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_string_size());
+  for (int i = 0, n = this->repeated_string_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->repeated_string(i));
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_bytes_size());
+  for (int i = 0, n = this->repeated_bytes_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      this->repeated_bytes(i));
+  }
+
+  // repeated group RepeatedGroup = 46 { ... };
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeatedgroup_size());
+    total_size += 4UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          this->repeatedgroup(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_nested_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_nested_message(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .protobuf_unittest_no_arena.ForeignMessage repeated_foreign_message = 49;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_foreign_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_foreign_message(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_import_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_import_message(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->repeated_nested_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->repeated_nested_enum(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  // repeated .protobuf_unittest_no_arena.ForeignEnum repeated_foreign_enum = 52;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->repeated_foreign_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->repeated_foreign_enum(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->repeated_import_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->repeated_import_enum(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_string_piece_size());
+  for (int i = 0, n = this->repeated_string_piece_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->repeated_string_piece(i));
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_cord_size());
+  for (int i = 0, n = this->repeated_cord_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->repeated_cord(i));
+  }
+
+  // repeated .protobuf_unittest_no_arena.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_lazy_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_lazy_message(static_cast<int>(i)));
+    }
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string optional_string = 14;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->optional_string());
+    }
+
+    // optional bytes optional_bytes = 15;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->optional_bytes());
+    }
+
+    // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->optional_string_piece());
+    }
+
+    // optional string optional_cord = 25 [ctype = CORD];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->optional_cord());
+    }
+
+    // optional string default_string = 74 [default = "hello"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->default_string());
+    }
+
+    // optional bytes default_bytes = 75 [default = "world"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->default_bytes());
+    }
+
+    // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->default_string_piece());
+    }
+
+    // optional string default_cord = 85 [default = "123", ctype = CORD];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->default_cord());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional group OptionalGroup = 16 { ... };
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *optionalgroup_);
+    }
+
+    // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_nested_message = 18;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_nested_message_);
+    }
+
+    // optional .protobuf_unittest_no_arena.ForeignMessage optional_foreign_message = 19;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_foreign_message_);
+    }
+
+    // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_import_message_);
+    }
+
+    // optional .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_public_import_message_);
+    }
+
+    // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage optional_message = 27 [lazy = true];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_message_);
+    }
+
+    // optional int64 optional_int64 = 2;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+          this->optional_int64());
+    }
+
+    // optional int32 optional_int32 = 1;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional uint32 optional_uint32 = 3;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->optional_uint32());
+    }
+
+    // optional uint64 optional_uint64 = 4;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->optional_uint64());
+    }
+
+    // optional sint64 optional_sint64 = 6;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt64Size(
+          this->optional_sint64());
+    }
+
+    // optional sint32 optional_sint32 = 5;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt32Size(
+          this->optional_sint32());
+    }
+
+    // optional fixed32 optional_fixed32 = 7;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional fixed64 optional_fixed64 = 8;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional sfixed64 optional_sfixed64 = 10;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional sfixed32 optional_sfixed32 = 9;
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  if (cached_has_bits & 0xff000000u) {
+    // optional float optional_float = 11;
+    if (cached_has_bits & 0x01000000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional double optional_double = 12;
+    if (cached_has_bits & 0x02000000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional bool optional_bool = 13;
+    if (cached_has_bits & 0x04000000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+    if (cached_has_bits & 0x08000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->default_import_enum());
+    }
+
+    // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum optional_nested_enum = 21;
+    if (cached_has_bits & 0x10000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->optional_nested_enum());
+    }
+
+    // optional .protobuf_unittest_no_arena.ForeignEnum optional_foreign_enum = 22;
+    if (cached_has_bits & 0x20000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->optional_foreign_enum());
+    }
+
+    // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+    if (cached_has_bits & 0x40000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->optional_import_enum());
+    }
+
+    // optional int32 default_int32 = 61 [default = 41];
+    if (cached_has_bits & 0x80000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->default_int32());
+    }
+
+  }
+  cached_has_bits = _has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional int64 default_int64 = 62 [default = 42];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+          this->default_int64());
+    }
+
+    // optional uint64 default_uint64 = 64 [default = 44];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->default_uint64());
+    }
+
+    // optional uint32 default_uint32 = 63 [default = 43];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->default_uint32());
+    }
+
+    // optional sint32 default_sint32 = 65 [default = -45];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt32Size(
+          this->default_sint32());
+    }
+
+    // optional sint64 default_sint64 = 66 [default = 46];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt64Size(
+          this->default_sint64());
+    }
+
+    // optional fixed64 default_fixed64 = 68 [default = 48];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 + 8;
+    }
+
+    // optional fixed32 default_fixed32 = 67 [default = 47];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 + 4;
+    }
+
+    // optional sfixed32 default_sfixed32 = 69 [default = 49];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 + 4;
+    }
+
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    // optional sfixed64 default_sfixed64 = 70 [default = -50];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double default_double = 72 [default = 52000];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 + 8;
+    }
+
+    // optional float default_float = 71 [default = 51.5];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 + 4;
+    }
+
+    // optional bool default_bool = 73 [default = true];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 + 1;
+    }
+
+    // optional .protobuf_unittest_no_arena.TestAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->default_nested_enum());
+    }
+
+    // optional .protobuf_unittest_no_arena.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->default_foreign_enum());
+    }
+
+  }
+  switch (oneof_field_case()) {
+    // optional uint32 oneof_uint32 = 111;
+    case kOneofUint32: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->oneof_uint32());
+      break;
+    }
+    // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage oneof_nested_message = 112;
+    case kOneofNestedMessage: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.oneof_nested_message_);
+      break;
+    }
+    // optional string oneof_string = 113;
+    case kOneofString: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->oneof_string());
+      break;
+    }
+    // optional bytes oneof_bytes = 114;
+    case kOneofBytes: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->oneof_bytes());
+      break;
+    }
+    // optional .protobuf_unittest_no_arena.TestAllTypes.NestedMessage lazy_oneof_nested_message = 115 [lazy = true];
+    case kLazyOneofNestedMessage: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.lazy_oneof_nested_message_);
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypes::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_no_arena.TestAllTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAllTypes* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAllTypes>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_no_arena.TestAllTypes)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_no_arena.TestAllTypes)
+    MergeFrom(*source);
+  }
+}
+
+void TestAllTypes::MergeFrom(const TestAllTypes& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_no_arena.TestAllTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_import_message_.MergeFrom(from.repeated_import_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  repeated_import_enum_.MergeFrom(from.repeated_import_enum_);
+  repeated_string_piece_.MergeFrom(from.repeated_string_piece_);
+  repeated_cord_.MergeFrom(from.repeated_cord_);
+  repeated_lazy_message_.MergeFrom(from.repeated_lazy_message_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _has_bits_[0] |= 0x00000001u;
+      optional_string_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _has_bits_[0] |= 0x00000002u;
+      optional_bytes_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_bytes_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _has_bits_[0] |= 0x00000004u;
+      optional_string_piece_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_piece_);
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _has_bits_[0] |= 0x00000008u;
+      optional_cord_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_cord_);
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _has_bits_[0] |= 0x00000010u;
+      default_string_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get(), from.default_string_);
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _has_bits_[0] |= 0x00000020u;
+      default_bytes_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get(), from.default_bytes_);
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _has_bits_[0] |= 0x00000040u;
+      default_string_piece_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get(), from.default_string_piece_);
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _has_bits_[0] |= 0x00000080u;
+      default_cord_.AssignWithDefault(&::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get(), from.default_cord_);
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      mutable_optionalgroup()->::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup::MergeFrom(from.optionalgroup());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      mutable_optional_nested_message()->::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::MergeFrom(from.optional_nested_message());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      mutable_optional_foreign_message()->::protobuf_unittest_no_arena::ForeignMessage::MergeFrom(from.optional_foreign_message());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      mutable_optional_import_message()->::protobuf_unittest_import::ImportMessage::MergeFrom(from.optional_import_message());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      mutable_optional_public_import_message()->::protobuf_unittest_import::PublicImportMessage::MergeFrom(from.optional_public_import_message());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      mutable_optional_message()->::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::MergeFrom(from.optional_message());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      optional_int64_ = from.optional_int64_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      optional_int32_ = from.optional_int32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      optional_uint32_ = from.optional_uint32_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      optional_uint64_ = from.optional_uint64_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      optional_sint64_ = from.optional_sint64_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      optional_sint32_ = from.optional_sint32_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      optional_fixed32_ = from.optional_fixed32_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      optional_fixed64_ = from.optional_fixed64_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      optional_sfixed64_ = from.optional_sfixed64_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      optional_sfixed32_ = from.optional_sfixed32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0xff000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      optional_float_ = from.optional_float_;
+    }
+    if (cached_has_bits & 0x02000000u) {
+      optional_double_ = from.optional_double_;
+    }
+    if (cached_has_bits & 0x04000000u) {
+      optional_bool_ = from.optional_bool_;
+    }
+    if (cached_has_bits & 0x08000000u) {
+      default_import_enum_ = from.default_import_enum_;
+    }
+    if (cached_has_bits & 0x10000000u) {
+      optional_nested_enum_ = from.optional_nested_enum_;
+    }
+    if (cached_has_bits & 0x20000000u) {
+      optional_foreign_enum_ = from.optional_foreign_enum_;
+    }
+    if (cached_has_bits & 0x40000000u) {
+      optional_import_enum_ = from.optional_import_enum_;
+    }
+    if (cached_has_bits & 0x80000000u) {
+      default_int32_ = from.default_int32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  cached_has_bits = from._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      default_int64_ = from.default_int64_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      default_uint64_ = from.default_uint64_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      default_uint32_ = from.default_uint32_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      default_sint32_ = from.default_sint32_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      default_sint64_ = from.default_sint64_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      default_fixed64_ = from.default_fixed64_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      default_fixed32_ = from.default_fixed32_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      default_sfixed32_ = from.default_sfixed32_;
+    }
+    _has_bits_[1] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      default_sfixed64_ = from.default_sfixed64_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      default_double_ = from.default_double_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      default_float_ = from.default_float_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      default_bool_ = from.default_bool_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      default_nested_enum_ = from.default_nested_enum_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      default_foreign_enum_ = from.default_foreign_enum_;
+    }
+    _has_bits_[1] |= cached_has_bits;
+  }
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      set_oneof_uint32(from.oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      mutable_oneof_nested_message()->::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::MergeFrom(from.oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      set_oneof_string(from.oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      set_oneof_bytes(from.oneof_bytes());
+      break;
+    }
+    case kLazyOneofNestedMessage: {
+      mutable_lazy_oneof_nested_message()->::protobuf_unittest_no_arena::TestAllTypes_NestedMessage::MergeFrom(from.lazy_oneof_nested_message());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestAllTypes::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_no_arena.TestAllTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAllTypes::CopyFrom(const TestAllTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_no_arena.TestAllTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypes::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypes::Swap(TestAllTypes* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAllTypes::InternalSwap(TestAllTypes* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(_has_bits_[1], other->_has_bits_[1]);
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+  repeated_int64_.InternalSwap(&other->repeated_int64_);
+  repeated_uint32_.InternalSwap(&other->repeated_uint32_);
+  repeated_uint64_.InternalSwap(&other->repeated_uint64_);
+  repeated_sint32_.InternalSwap(&other->repeated_sint32_);
+  repeated_sint64_.InternalSwap(&other->repeated_sint64_);
+  repeated_fixed32_.InternalSwap(&other->repeated_fixed32_);
+  repeated_fixed64_.InternalSwap(&other->repeated_fixed64_);
+  repeated_sfixed32_.InternalSwap(&other->repeated_sfixed32_);
+  repeated_sfixed64_.InternalSwap(&other->repeated_sfixed64_);
+  repeated_float_.InternalSwap(&other->repeated_float_);
+  repeated_double_.InternalSwap(&other->repeated_double_);
+  repeated_bool_.InternalSwap(&other->repeated_bool_);
+  repeated_string_.InternalSwap(CastToBase(&other->repeated_string_));
+  repeated_bytes_.InternalSwap(CastToBase(&other->repeated_bytes_));
+  CastToBase(&repeatedgroup_)->InternalSwap(CastToBase(&other->repeatedgroup_));
+  CastToBase(&repeated_nested_message_)->InternalSwap(CastToBase(&other->repeated_nested_message_));
+  CastToBase(&repeated_foreign_message_)->InternalSwap(CastToBase(&other->repeated_foreign_message_));
+  CastToBase(&repeated_import_message_)->InternalSwap(CastToBase(&other->repeated_import_message_));
+  repeated_nested_enum_.InternalSwap(&other->repeated_nested_enum_);
+  repeated_foreign_enum_.InternalSwap(&other->repeated_foreign_enum_);
+  repeated_import_enum_.InternalSwap(&other->repeated_import_enum_);
+  repeated_string_piece_.InternalSwap(CastToBase(&other->repeated_string_piece_));
+  repeated_cord_.InternalSwap(CastToBase(&other->repeated_cord_));
+  CastToBase(&repeated_lazy_message_)->InternalSwap(CastToBase(&other->repeated_lazy_message_));
+  optional_string_.Swap(&other->optional_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  optional_bytes_.Swap(&other->optional_bytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  optional_string_piece_.Swap(&other->optional_string_piece_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  optional_cord_.Swap(&other->optional_cord_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  default_string_.Swap(&other->default_string_, &::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_.get(),
+    GetArenaNoVirtual());
+  default_bytes_.Swap(&other->default_bytes_, &::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_bytes_.get(),
+    GetArenaNoVirtual());
+  default_string_piece_.Swap(&other->default_string_piece_, &::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_string_piece_.get(),
+    GetArenaNoVirtual());
+  default_cord_.Swap(&other->default_cord_, &::protobuf_unittest_no_arena::TestAllTypes::_i_give_permission_to_break_this_code_default_default_cord_.get(),
+    GetArenaNoVirtual());
+  swap(optionalgroup_, other->optionalgroup_);
+  swap(optional_nested_message_, other->optional_nested_message_);
+  swap(optional_foreign_message_, other->optional_foreign_message_);
+  swap(optional_import_message_, other->optional_import_message_);
+  swap(optional_public_import_message_, other->optional_public_import_message_);
+  swap(optional_message_, other->optional_message_);
+  swap(optional_int64_, other->optional_int64_);
+  swap(optional_int32_, other->optional_int32_);
+  swap(optional_uint32_, other->optional_uint32_);
+  swap(optional_uint64_, other->optional_uint64_);
+  swap(optional_sint64_, other->optional_sint64_);
+  swap(optional_sint32_, other->optional_sint32_);
+  swap(optional_fixed32_, other->optional_fixed32_);
+  swap(optional_fixed64_, other->optional_fixed64_);
+  swap(optional_sfixed64_, other->optional_sfixed64_);
+  swap(optional_sfixed32_, other->optional_sfixed32_);
+  swap(optional_float_, other->optional_float_);
+  swap(optional_double_, other->optional_double_);
+  swap(optional_bool_, other->optional_bool_);
+  swap(default_import_enum_, other->default_import_enum_);
+  swap(optional_nested_enum_, other->optional_nested_enum_);
+  swap(optional_foreign_enum_, other->optional_foreign_enum_);
+  swap(optional_import_enum_, other->optional_import_enum_);
+  swap(default_int32_, other->default_int32_);
+  swap(default_int64_, other->default_int64_);
+  swap(default_uint64_, other->default_uint64_);
+  swap(default_uint32_, other->default_uint32_);
+  swap(default_sint32_, other->default_sint32_);
+  swap(default_sint64_, other->default_sint64_);
+  swap(default_fixed64_, other->default_fixed64_);
+  swap(default_fixed32_, other->default_fixed32_);
+  swap(default_sfixed32_, other->default_sfixed32_);
+  swap(default_sfixed64_, other->default_sfixed64_);
+  swap(default_double_, other->default_double_);
+  swap(default_float_, other->default_float_);
+  swap(default_bool_, other->default_bool_);
+  swap(default_nested_enum_, other->default_nested_enum_);
+  swap(default_foreign_enum_, other->default_foreign_enum_);
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAllTypes::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ForeignMessage::InitAsDefaultInstance() {
+}
+class ForeignMessage::HasBitSetters {
+ public:
+  static void set_has_c(ForeignMessage* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ForeignMessage::kCFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ForeignMessage::ForeignMessage()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_no_arena.ForeignMessage)
+}
+ForeignMessage::ForeignMessage(const ForeignMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  c_ = from.c_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_no_arena.ForeignMessage)
+}
+
+void ForeignMessage::SharedCtor() {
+  c_ = 0;
+}
+
+ForeignMessage::~ForeignMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_no_arena.ForeignMessage)
+  SharedDtor();
+}
+
+void ForeignMessage::SharedDtor() {
+}
+
+void ForeignMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ForeignMessage& ForeignMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ForeignMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_no_arena.ForeignMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  c_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* ForeignMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional int32 c = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_c(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool ForeignMessage::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_no_arena.ForeignMessage)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 c = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+          HasBitSetters::set_has_c(this);
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &c_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_no_arena.ForeignMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_no_arena.ForeignMessage)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void ForeignMessage::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_no_arena.ForeignMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 c = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->c(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_no_arena.ForeignMessage)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ForeignMessage::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_no_arena.ForeignMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 c = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->c(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_no_arena.ForeignMessage)
+  return target;
+}
+
+size_t ForeignMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_no_arena.ForeignMessage)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 c = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->c());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ForeignMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_no_arena.ForeignMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ForeignMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ForeignMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_no_arena.ForeignMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_no_arena.ForeignMessage)
+    MergeFrom(*source);
+  }
+}
+
+void ForeignMessage::MergeFrom(const ForeignMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_no_arena.ForeignMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_c()) {
+    set_c(from.c());
+  }
+}
+
+void ForeignMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_no_arena.ForeignMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ForeignMessage::CopyFrom(const ForeignMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_no_arena.ForeignMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ForeignMessage::IsInitialized() const {
+  return true;
+}
+
+void ForeignMessage::Swap(ForeignMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ForeignMessage::InternalSwap(ForeignMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(c_, other->c_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ForeignMessage::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TestNoArenaMessage::InitAsDefaultInstance() {
+  ::protobuf_unittest_no_arena::_TestNoArenaMessage_default_instance_._instance.get_mutable()->arena_message_ = const_cast< ::proto2_arena_unittest::ArenaMessage*>(
+      ::proto2_arena_unittest::ArenaMessage::internal_default_instance());
+}
+class TestNoArenaMessage::HasBitSetters {
+ public:
+  static const ::proto2_arena_unittest::ArenaMessage& arena_message(const TestNoArenaMessage* msg);
+  static void set_has_arena_message(TestNoArenaMessage* msg) {
+    msg->_has_bits_[0] |= 0x00000001u;
+  }
+};
+
+const ::proto2_arena_unittest::ArenaMessage&
+TestNoArenaMessage::HasBitSetters::arena_message(const TestNoArenaMessage* msg) {
+  return *msg->arena_message_;
+}
+void TestNoArenaMessage::clear_arena_message() {
+  if (arena_message_ != nullptr) arena_message_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestNoArenaMessage::kArenaMessageFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestNoArenaMessage::TestNoArenaMessage()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest_no_arena.TestNoArenaMessage)
+}
+TestNoArenaMessage::TestNoArenaMessage(const TestNoArenaMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_arena_message()) {
+    arena_message_ = new ::proto2_arena_unittest::ArenaMessage(*from.arena_message_);
+  } else {
+    arena_message_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_no_arena.TestNoArenaMessage)
+}
+
+void TestNoArenaMessage::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestNoArenaMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  arena_message_ = nullptr;
+}
+
+TestNoArenaMessage::~TestNoArenaMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_no_arena.TestNoArenaMessage)
+  SharedDtor();
+}
+
+void TestNoArenaMessage::SharedDtor() {
+  if (this != internal_default_instance()) delete arena_message_;
+}
+
+void TestNoArenaMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestNoArenaMessage& TestNoArenaMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestNoArenaMessage_google_2fprotobuf_2funittest_5fno_5farena_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestNoArenaMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(arena_message_ != nullptr);
+    arena_message_->Clear();
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestNoArenaMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // optional .proto2_arena_unittest.ArenaMessage arena_message = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_arena_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestNoArenaMessage::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .proto2_arena_unittest.ArenaMessage arena_message = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_arena_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest_no_arena.TestNoArenaMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest_no_arena.TestNoArenaMessage)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestNoArenaMessage::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .proto2_arena_unittest.ArenaMessage arena_message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::arena_message(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest_no_arena.TestNoArenaMessage)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestNoArenaMessage::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .proto2_arena_unittest.ArenaMessage arena_message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::arena_message(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_no_arena.TestNoArenaMessage)
+  return target;
+}
+
+size_t TestNoArenaMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .proto2_arena_unittest.ArenaMessage arena_message = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *arena_message_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestNoArenaMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestNoArenaMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestNoArenaMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_no_arena.TestNoArenaMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_no_arena.TestNoArenaMessage)
+    MergeFrom(*source);
+  }
+}
+
+void TestNoArenaMessage::MergeFrom(const TestNoArenaMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_arena_message()) {
+    mutable_arena_message()->::proto2_arena_unittest::ArenaMessage::MergeFrom(from.arena_message());
+  }
+}
+
+void TestNoArenaMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestNoArenaMessage::CopyFrom(const TestNoArenaMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_no_arena.TestNoArenaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestNoArenaMessage::IsInitialized() const {
+  return true;
+}
+
+void TestNoArenaMessage::Swap(TestNoArenaMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestNoArenaMessage::InternalSwap(TestNoArenaMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(arena_message_, other->arena_message_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestNoArenaMessage::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5farena_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5farena_2eproto[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest_no_arena
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage* Arena::CreateMaybeMessage< ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_no_arena::TestAllTypes_NestedMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup* Arena::CreateMaybeMessage< ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_no_arena::TestAllTypes_OptionalGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup* Arena::CreateMaybeMessage< ::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_no_arena::TestAllTypes_RepeatedGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_no_arena::TestAllTypes* Arena::CreateMaybeMessage< ::protobuf_unittest_no_arena::TestAllTypes >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_no_arena::TestAllTypes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_no_arena::ForeignMessage* Arena::CreateMaybeMessage< ::protobuf_unittest_no_arena::ForeignMessage >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_no_arena::ForeignMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_no_arena::TestNoArenaMessage* Arena::CreateMaybeMessage< ::protobuf_unittest_no_arena::TestNoArenaMessage >(Arena* arena) {
+  return Arena::CreateInternal< ::protobuf_unittest_no_arena::TestNoArenaMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
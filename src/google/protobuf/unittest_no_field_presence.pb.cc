@@ -0,0 +1,4319 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_no_field_presence.proto
+
+#include "google/protobuf/unittest_no_field_presence.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestRequired_google_2fprotobuf_2funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestAllTypes_google_2fprotobuf_2funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto;
+namespace proto2_nofieldpresence_unittest {
+class TestAllTypes_NestedMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypes_NestedMessage> _instance;
+} _TestAllTypes_NestedMessage_default_instance_;
+class TestAllTypesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypes> _instance;
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+  const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* oneof_nested_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+  int oneof_enum_;
+} _TestAllTypes_default_instance_;
+class TestProto2RequiredDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestProto2Required> _instance;
+} _TestProto2Required_default_instance_;
+class ForeignMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ForeignMessage> _instance;
+} _ForeignMessage_default_instance_;
+}  // namespace proto2_nofieldpresence_unittest
+static void InitDefaultsTestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto2_nofieldpresence_unittest::_TestAllTypes_NestedMessage_default_instance_;
+    new (ptr) ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto}, {}};
+
+static void InitDefaultsTestAllTypes_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_;
+    new (ptr) ::proto2_nofieldpresence_unittest::TestAllTypes();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto2_nofieldpresence_unittest::TestAllTypes::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, InitDefaultsTestAllTypes_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto}, {
+      &scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base,
+      &scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base,
+      &scc_info_TestAllTypes_google_2fprotobuf_2funittest_2eproto.base,}};
+
+static void InitDefaultsTestProto2Required_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto2_nofieldpresence_unittest::_TestProto2Required_default_instance_;
+    new (ptr) ::proto2_nofieldpresence_unittest::TestProto2Required();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto2_nofieldpresence_unittest::TestProto2Required::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestProto2Required_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTestProto2Required_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto}, {
+      &scc_info_TestRequired_google_2fprotobuf_2funittest_2eproto.base,}};
+
+static void InitDefaultsForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto2_nofieldpresence_unittest::_ForeignMessage_default_instance_;
+    new (ptr) ::proto2_nofieldpresence_unittest::ForeignMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto2_nofieldpresence_unittest::ForeignMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto}, {}};
+
+void InitDefaults_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestProto2Required_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+}
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[4];
+static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[2];
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage, bb_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_int32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_int64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_uint32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_uint64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_sint32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_sint64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_fixed32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_fixed64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_sfixed32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_sfixed64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_float_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_double_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_bool_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_string_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_bytes_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_nested_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_foreign_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_proto2_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_nested_enum_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_foreign_enum_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_string_piece_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_cord_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, optional_lazy_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_int32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_int64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_uint32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_uint64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_sint32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_sint64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_fixed32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_fixed64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_sfixed32_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_sfixed64_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_float_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_double_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_bool_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_string_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_bytes_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_nested_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_foreign_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_proto2_message_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_nested_enum_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_foreign_enum_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_string_piece_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_cord_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, repeated_lazy_message_),
+  offsetof(::proto2_nofieldpresence_unittest::TestAllTypesDefaultTypeInternal, oneof_uint32_),
+  offsetof(::proto2_nofieldpresence_unittest::TestAllTypesDefaultTypeInternal, oneof_nested_message_),
+  offsetof(::proto2_nofieldpresence_unittest::TestAllTypesDefaultTypeInternal, oneof_string_),
+  offsetof(::proto2_nofieldpresence_unittest::TestAllTypesDefaultTypeInternal, oneof_enum_),
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestAllTypes, oneof_field_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestProto2Required, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::TestProto2Required, proto2_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::ForeignMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto2_nofieldpresence_unittest::ForeignMessage, c_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage)},
+  { 6, -1, sizeof(::proto2_nofieldpresence_unittest::TestAllTypes)},
+  { 62, -1, sizeof(::proto2_nofieldpresence_unittest::TestProto2Required)},
+  { 68, -1, sizeof(::proto2_nofieldpresence_unittest::ForeignMessage)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto2_nofieldpresence_unittest::_TestAllTypes_NestedMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto2_nofieldpresence_unittest::_TestProto2Required_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto2_nofieldpresence_unittest::_ForeignMessage_default_instance_),
+};
+
+static ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptorsTable assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto = {
+  {}, AddDescriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto, "google/protobuf/unittest_no_field_presence.proto", schemas,
+  file_default_instances, TableStruct_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto, 4, file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto, file_level_service_descriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto,
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[] =
+  "\n0google/protobuf/unittest_no_field_pres"
+  "ence.proto\022\037proto2_nofieldpresence_unitt"
+  "est\032\036google/protobuf/unittest.proto\"\232\021\n\014"
+  "TestAllTypes\022\026\n\016optional_int32\030\001 \001(\005\022\026\n\016"
+  "optional_int64\030\002 \001(\003\022\027\n\017optional_uint32\030"
+  "\003 \001(\r\022\027\n\017optional_uint64\030\004 \001(\004\022\027\n\017option"
+  "al_sint32\030\005 \001(\021\022\027\n\017optional_sint64\030\006 \001(\022"
+  "\022\030\n\020optional_fixed32\030\007 \001(\007\022\030\n\020optional_f"
+  "ixed64\030\010 \001(\006\022\031\n\021optional_sfixed32\030\t \001(\017\022"
+  "\031\n\021optional_sfixed64\030\n \001(\020\022\026\n\016optional_f"
+  "loat\030\013 \001(\002\022\027\n\017optional_double\030\014 \001(\001\022\025\n\ro"
+  "ptional_bool\030\r \001(\010\022\027\n\017optional_string\030\016 "
+  "\001(\t\022\026\n\016optional_bytes\030\017 \001(\014\022\\\n\027optional_"
+  "nested_message\030\022 \001(\0132;.proto2_nofieldpre"
+  "sence_unittest.TestAllTypes.NestedMessag"
+  "e\022Q\n\030optional_foreign_message\030\023 \001(\0132/.pr"
+  "oto2_nofieldpresence_unittest.ForeignMes"
+  "sage\022@\n\027optional_proto2_message\030\024 \001(\0132\037."
+  "protobuf_unittest.TestAllTypes\022V\n\024option"
+  "al_nested_enum\030\025 \001(\01628.proto2_nofieldpre"
+  "sence_unittest.TestAllTypes.NestedEnum\022K"
+  "\n\025optional_foreign_enum\030\026 \001(\0162,.proto2_n"
+  "ofieldpresence_unittest.ForeignEnum\022!\n\025o"
+  "ptional_string_piece\030\030 \001(\tB\002\010\002\022\031\n\roption"
+  "al_cord\030\031 \001(\tB\002\010\001\022^\n\025optional_lazy_messa"
+  "ge\030\036 \001(\0132;.proto2_nofieldpresence_unitte"
+  "st.TestAllTypes.NestedMessageB\002(\001\022\026\n\016rep"
+  "eated_int32\030\037 \003(\005\022\026\n\016repeated_int64\030  \003("
+  "\003\022\027\n\017repeated_uint32\030! \003(\r\022\027\n\017repeated_u"
+  "int64\030\" \003(\004\022\027\n\017repeated_sint32\030# \003(\021\022\027\n\017"
+  "repeated_sint64\030$ \003(\022\022\030\n\020repeated_fixed3"
+  "2\030% \003(\007\022\030\n\020repeated_fixed64\030& \003(\006\022\031\n\021rep"
+  "eated_sfixed32\030\' \003(\017\022\031\n\021repeated_sfixed6"
+  "4\030( \003(\020\022\026\n\016repeated_float\030) \003(\002\022\027\n\017repea"
+  "ted_double\030* \003(\001\022\025\n\rrepeated_bool\030+ \003(\010\022"
+  "\027\n\017repeated_string\030, \003(\t\022\026\n\016repeated_byt"
+  "es\030- \003(\014\022\\\n\027repeated_nested_message\0300 \003("
+  "\0132;.proto2_nofieldpresence_unittest.Test"
+  "AllTypes.NestedMessage\022Q\n\030repeated_forei"
+  "gn_message\0301 \003(\0132/.proto2_nofieldpresenc"
+  "e_unittest.ForeignMessage\022@\n\027repeated_pr"
+  "oto2_message\0302 \003(\0132\037.protobuf_unittest.T"
+  "estAllTypes\022V\n\024repeated_nested_enum\0303 \003("
+  "\01628.proto2_nofieldpresence_unittest.Test"
+  "AllTypes.NestedEnum\022K\n\025repeated_foreign_"
+  "enum\0304 \003(\0162,.proto2_nofieldpresence_unit"
+  "test.ForeignEnum\022!\n\025repeated_string_piec"
+  "e\0306 \003(\tB\002\010\002\022\031\n\rrepeated_cord\0307 \003(\tB\002\010\001\022^"
+  "\n\025repeated_lazy_message\0309 \003(\0132;.proto2_n"
+  "ofieldpresence_unittest.TestAllTypes.Nes"
+  "tedMessageB\002(\001\022\026\n\014oneof_uint32\030o \001(\rH\000\022["
+  "\n\024oneof_nested_message\030p \001(\0132;.proto2_no"
+  "fieldpresence_unittest.TestAllTypes.Nest"
+  "edMessageH\000\022\026\n\014oneof_string\030q \001(\tH\000\022N\n\no"
+  "neof_enum\030r \001(\01628.proto2_nofieldpresence"
+  "_unittest.TestAllTypes.NestedEnumH\000\032\033\n\rN"
+  "estedMessage\022\n\n\002bb\030\001 \001(\005\"\'\n\nNestedEnum\022\007"
+  "\n\003FOO\020\000\022\007\n\003BAR\020\001\022\007\n\003BAZ\020\002B\r\n\013oneof_field"
+  "\"E\n\022TestProto2Required\022/\n\006proto2\030\001 \001(\0132\037"
+  ".protobuf_unittest.TestRequired\"\033\n\016Forei"
+  "gnMessage\022\t\n\001c\030\001 \001(\005*@\n\013ForeignEnum\022\017\n\013F"
+  "OREIGN_FOO\020\000\022\017\n\013FOREIGN_BAR\020\001\022\017\n\013FOREIGN"
+  "_BAZ\020\002b\006proto3"
+  ;
+static ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto = {
+  false, InitDefaults_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto, 
+  descriptor_table_protodef_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto,
+  "google/protobuf/unittest_no_field_presence.proto", &assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto, 2494,
+};
+
+void AddDescriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto() {
+  static constexpr ::PROTOBUF_NAMESPACE_ID::internal::InitFunc deps[1] =
+  {
+    ::AddDescriptors_google_2fprotobuf_2funittest_2eproto,
+  };
+ ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto, deps, 1);
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto = []() { AddDescriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto(); return true; }();
+namespace proto2_nofieldpresence_unittest {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TestAllTypes_NestedEnum_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[0];
+}
+bool TestAllTypes_NestedEnum_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+constexpr TestAllTypes_NestedEnum TestAllTypes::FOO;
+constexpr TestAllTypes_NestedEnum TestAllTypes::BAR;
+constexpr TestAllTypes_NestedEnum TestAllTypes::BAZ;
+constexpr TestAllTypes_NestedEnum TestAllTypes::NestedEnum_MIN;
+constexpr TestAllTypes_NestedEnum TestAllTypes::NestedEnum_MAX;
+constexpr int TestAllTypes::NestedEnum_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ForeignEnum_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[1];
+}
+bool ForeignEnum_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void TestAllTypes_NestedMessage::InitAsDefaultInstance() {
+}
+class TestAllTypes_NestedMessage::HasBitSetters {
+ public:
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAllTypes_NestedMessage::kBbFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAllTypes_NestedMessage::TestAllTypes_NestedMessage()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+}
+TestAllTypes_NestedMessage::TestAllTypes_NestedMessage(const TestAllTypes_NestedMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  bb_ = from.bb_;
+  // @@protoc_insertion_point(copy_constructor:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+}
+
+void TestAllTypes_NestedMessage::SharedCtor() {
+  bb_ = 0;
+}
+
+TestAllTypes_NestedMessage::~TestAllTypes_NestedMessage() {
+  // @@protoc_insertion_point(destructor:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  SharedDtor();
+}
+
+void TestAllTypes_NestedMessage::SharedDtor() {
+}
+
+void TestAllTypes_NestedMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypes_NestedMessage& TestAllTypes_NestedMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypes_NestedMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypes_NestedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  bb_ = 0;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAllTypes_NestedMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // int32 bb = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_bb(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAllTypes_NestedMessage::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 bb = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &bb_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAllTypes_NestedMessage::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 bb = 1;
+  if (this->bb() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->bb(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypes_NestedMessage::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 bb = 1;
+  if (this->bb() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->bb(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  return target;
+}
+
+size_t TestAllTypes_NestedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 bb = 1;
+  if (this->bb() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->bb());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypes_NestedMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAllTypes_NestedMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAllTypes_NestedMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+    MergeFrom(*source);
+  }
+}
+
+void TestAllTypes_NestedMessage::MergeFrom(const TestAllTypes_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.bb() != 0) {
+    set_bb(from.bb());
+  }
+}
+
+void TestAllTypes_NestedMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAllTypes_NestedMessage::CopyFrom(const TestAllTypes_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypes_NestedMessage::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypes_NestedMessage::Swap(TestAllTypes_NestedMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAllTypes_NestedMessage::InternalSwap(TestAllTypes_NestedMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(bb_, other->bb_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAllTypes_NestedMessage::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TestAllTypes::InitAsDefaultInstance() {
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_._instance.get_mutable()->optional_nested_message_ = const_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(
+      ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::internal_default_instance());
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_._instance.get_mutable()->optional_foreign_message_ = const_cast< ::proto2_nofieldpresence_unittest::ForeignMessage*>(
+      ::proto2_nofieldpresence_unittest::ForeignMessage::internal_default_instance());
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_._instance.get_mutable()->optional_proto2_message_ = const_cast< ::protobuf_unittest::TestAllTypes*>(
+      ::protobuf_unittest::TestAllTypes::internal_default_instance());
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_._instance.get_mutable()->optional_lazy_message_ = const_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(
+      ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::internal_default_instance());
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_.oneof_uint32_ = 0u;
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_.oneof_nested_message_ = const_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage*>(
+      ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::internal_default_instance());
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_.oneof_string_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::proto2_nofieldpresence_unittest::_TestAllTypes_default_instance_.oneof_enum_ = 0;
+}
+class TestAllTypes::HasBitSetters {
+ public:
+  static const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& optional_nested_message(const TestAllTypes* msg);
+  static const ::proto2_nofieldpresence_unittest::ForeignMessage& optional_foreign_message(const TestAllTypes* msg);
+  static const ::protobuf_unittest::TestAllTypes& optional_proto2_message(const TestAllTypes* msg);
+  static const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& optional_lazy_message(const TestAllTypes* msg);
+  static const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage& oneof_nested_message(const TestAllTypes* msg);
+};
+
+const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::optional_nested_message(const TestAllTypes* msg) {
+  return *msg->optional_nested_message_;
+}
+const ::proto2_nofieldpresence_unittest::ForeignMessage&
+TestAllTypes::HasBitSetters::optional_foreign_message(const TestAllTypes* msg) {
+  return *msg->optional_foreign_message_;
+}
+const ::protobuf_unittest::TestAllTypes&
+TestAllTypes::HasBitSetters::optional_proto2_message(const TestAllTypes* msg) {
+  return *msg->optional_proto2_message_;
+}
+const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::optional_lazy_message(const TestAllTypes* msg) {
+  return *msg->optional_lazy_message_;
+}
+const ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage&
+TestAllTypes::HasBitSetters::oneof_nested_message(const TestAllTypes* msg) {
+  return *msg->oneof_field_.oneof_nested_message_;
+}
+void TestAllTypes::clear_optional_proto2_message() {
+  if (GetArenaNoVirtual() == nullptr && optional_proto2_message_ != nullptr) {
+    delete optional_proto2_message_;
+  }
+  optional_proto2_message_ = nullptr;
+}
+void TestAllTypes::clear_repeated_proto2_message() {
+  repeated_proto2_message_.Clear();
+}
+void TestAllTypes::set_allocated_oneof_nested_message(::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* oneof_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  clear_oneof_field();
+  if (oneof_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      oneof_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_nested_message, submessage_arena);
+    }
+    set_has_oneof_nested_message();
+    oneof_field_.oneof_nested_message_ = oneof_nested_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto2_nofieldpresence_unittest.TestAllTypes.oneof_nested_message)
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestAllTypes::kOptionalInt32FieldNumber;
+const int TestAllTypes::kOptionalInt64FieldNumber;
+const int TestAllTypes::kOptionalUint32FieldNumber;
+const int TestAllTypes::kOptionalUint64FieldNumber;
+const int TestAllTypes::kOptionalSint32FieldNumber;
+const int TestAllTypes::kOptionalSint64FieldNumber;
+const int TestAllTypes::kOptionalFixed32FieldNumber;
+const int TestAllTypes::kOptionalFixed64FieldNumber;
+const int TestAllTypes::kOptionalSfixed32FieldNumber;
+const int TestAllTypes::kOptionalSfixed64FieldNumber;
+const int TestAllTypes::kOptionalFloatFieldNumber;
+const int TestAllTypes::kOptionalDoubleFieldNumber;
+const int TestAllTypes::kOptionalBoolFieldNumber;
+const int TestAllTypes::kOptionalStringFieldNumber;
+const int TestAllTypes::kOptionalBytesFieldNumber;
+const int TestAllTypes::kOptionalNestedMessageFieldNumber;
+const int TestAllTypes::kOptionalForeignMessageFieldNumber;
+const int TestAllTypes::kOptionalProto2MessageFieldNumber;
+const int TestAllTypes::kOptionalNestedEnumFieldNumber;
+const int TestAllTypes::kOptionalForeignEnumFieldNumber;
+const int TestAllTypes::kOptionalStringPieceFieldNumber;
+const int TestAllTypes::kOptionalCordFieldNumber;
+const int TestAllTypes::kOptionalLazyMessageFieldNumber;
+const int TestAllTypes::kRepeatedInt32FieldNumber;
+const int TestAllTypes::kRepeatedInt64FieldNumber;
+const int TestAllTypes::kRepeatedUint32FieldNumber;
+const int TestAllTypes::kRepeatedUint64FieldNumber;
+const int TestAllTypes::kRepeatedSint32FieldNumber;
+const int TestAllTypes::kRepeatedSint64FieldNumber;
+const int TestAllTypes::kRepeatedFixed32FieldNumber;
+const int TestAllTypes::kRepeatedFixed64FieldNumber;
+const int TestAllTypes::kRepeatedSfixed32FieldNumber;
+const int TestAllTypes::kRepeatedSfixed64FieldNumber;
+const int TestAllTypes::kRepeatedFloatFieldNumber;
+const int TestAllTypes::kRepeatedDoubleFieldNumber;
+const int TestAllTypes::kRepeatedBoolFieldNumber;
+const int TestAllTypes::kRepeatedStringFieldNumber;
+const int TestAllTypes::kRepeatedBytesFieldNumber;
+const int TestAllTypes::kRepeatedNestedMessageFieldNumber;
+const int TestAllTypes::kRepeatedForeignMessageFieldNumber;
+const int TestAllTypes::kRepeatedProto2MessageFieldNumber;
+const int TestAllTypes::kRepeatedNestedEnumFieldNumber;
+const int TestAllTypes::kRepeatedForeignEnumFieldNumber;
+const int TestAllTypes::kRepeatedStringPieceFieldNumber;
+const int TestAllTypes::kRepeatedCordFieldNumber;
+const int TestAllTypes::kRepeatedLazyMessageFieldNumber;
+const int TestAllTypes::kOneofUint32FieldNumber;
+const int TestAllTypes::kOneofNestedMessageFieldNumber;
+const int TestAllTypes::kOneofStringFieldNumber;
+const int TestAllTypes::kOneofEnumFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestAllTypes::TestAllTypes()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto2_nofieldpresence_unittest.TestAllTypes)
+}
+TestAllTypes::TestAllTypes(const TestAllTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      repeated_int32_(from.repeated_int32_),
+      repeated_int64_(from.repeated_int64_),
+      repeated_uint32_(from.repeated_uint32_),
+      repeated_uint64_(from.repeated_uint64_),
+      repeated_sint32_(from.repeated_sint32_),
+      repeated_sint64_(from.repeated_sint64_),
+      repeated_fixed32_(from.repeated_fixed32_),
+      repeated_fixed64_(from.repeated_fixed64_),
+      repeated_sfixed32_(from.repeated_sfixed32_),
+      repeated_sfixed64_(from.repeated_sfixed64_),
+      repeated_float_(from.repeated_float_),
+      repeated_double_(from.repeated_double_),
+      repeated_bool_(from.repeated_bool_),
+      repeated_string_(from.repeated_string_),
+      repeated_bytes_(from.repeated_bytes_),
+      repeated_nested_message_(from.repeated_nested_message_),
+      repeated_foreign_message_(from.repeated_foreign_message_),
+      repeated_proto2_message_(from.repeated_proto2_message_),
+      repeated_nested_enum_(from.repeated_nested_enum_),
+      repeated_foreign_enum_(from.repeated_foreign_enum_),
+      repeated_string_piece_(from.repeated_string_piece_),
+      repeated_cord_(from.repeated_cord_),
+      repeated_lazy_message_(from.repeated_lazy_message_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.optional_string().size() > 0) {
+    optional_string_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_);
+  }
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.optional_bytes().size() > 0) {
+    optional_bytes_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_bytes_);
+  }
+  optional_string_piece_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.optional_string_piece().size() > 0) {
+    optional_string_piece_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_piece_);
+  }
+  optional_cord_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from.optional_cord().size() > 0) {
+    optional_cord_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_cord_);
+  }
+  if (from.has_optional_nested_message()) {
+    optional_nested_message_ = new ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage(*from.optional_nested_message_);
+  } else {
+    optional_nested_message_ = nullptr;
+  }
+  if (from.has_optional_foreign_message()) {
+    optional_foreign_message_ = new ::proto2_nofieldpresence_unittest::ForeignMessage(*from.optional_foreign_message_);
+  } else {
+    optional_foreign_message_ = nullptr;
+  }
+  if (from.has_optional_proto2_message()) {
+    optional_proto2_message_ = new ::protobuf_unittest::TestAllTypes(*from.optional_proto2_message_);
+  } else {
+    optional_proto2_message_ = nullptr;
+  }
+  if (from.has_optional_lazy_message()) {
+    optional_lazy_message_ = new ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage(*from.optional_lazy_message_);
+  } else {
+    optional_lazy_message_ = nullptr;
+  }
+  ::memcpy(&optional_int64_, &from.optional_int64_,
+    static_cast<size_t>(reinterpret_cast<char*>(&optional_foreign_enum_) -
+    reinterpret_cast<char*>(&optional_int64_)) + sizeof(optional_foreign_enum_));
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      set_oneof_uint32(from.oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      mutable_oneof_nested_message()->::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::MergeFrom(from.oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      set_oneof_string(from.oneof_string());
+      break;
+    }
+    case kOneofEnum: {
+      set_oneof_enum(from.oneof_enum());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto2_nofieldpresence_unittest.TestAllTypes)
+}
+
+void TestAllTypes::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&optional_nested_message_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&optional_foreign_enum_) -
+      reinterpret_cast<char*>(&optional_nested_message_)) + sizeof(optional_foreign_enum_));
+  clear_has_oneof_field();
+}
+
+TestAllTypes::~TestAllTypes() {
+  // @@protoc_insertion_point(destructor:proto2_nofieldpresence_unittest.TestAllTypes)
+  SharedDtor();
+}
+
+void TestAllTypes::SharedDtor() {
+  optional_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete optional_nested_message_;
+  if (this != internal_default_instance()) delete optional_foreign_message_;
+  if (this != internal_default_instance()) delete optional_proto2_message_;
+  if (this != internal_default_instance()) delete optional_lazy_message_;
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void TestAllTypes::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypes& TestAllTypes::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypes_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypes::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  switch (oneof_field_case()) {
+    case kOneofUint32: {
+      // No need to clear
+      break;
+    }
+    case kOneofNestedMessage: {
+      delete oneof_field_.oneof_nested_message_;
+      break;
+    }
+    case kOneofString: {
+      oneof_field_.oneof_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+      break;
+    }
+    case kOneofEnum: {
+      // No need to clear
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void TestAllTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_int32_.Clear();
+  repeated_int64_.Clear();
+  repeated_uint32_.Clear();
+  repeated_uint64_.Clear();
+  repeated_sint32_.Clear();
+  repeated_sint64_.Clear();
+  repeated_fixed32_.Clear();
+  repeated_fixed64_.Clear();
+  repeated_sfixed32_.Clear();
+  repeated_sfixed64_.Clear();
+  repeated_float_.Clear();
+  repeated_double_.Clear();
+  repeated_bool_.Clear();
+  repeated_string_.Clear();
+  repeated_bytes_.Clear();
+  repeated_nested_message_.Clear();
+  repeated_foreign_message_.Clear();
+  repeated_proto2_message_.Clear();
+  repeated_nested_enum_.Clear();
+  repeated_foreign_enum_.Clear();
+  repeated_string_piece_.Clear();
+  repeated_cord_.Clear();
+  repeated_lazy_message_.Clear();
+  optional_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == nullptr && optional_nested_message_ != nullptr) {
+    delete optional_nested_message_;
+  }
+  optional_nested_message_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && optional_foreign_message_ != nullptr) {
+    delete optional_foreign_message_;
+  }
+  optional_foreign_message_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && optional_proto2_message_ != nullptr) {
+    delete optional_proto2_message_;
+  }
+  optional_proto2_message_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && optional_lazy_message_ != nullptr) {
+    delete optional_lazy_message_;
+  }
+  optional_lazy_message_ = nullptr;
+  ::memset(&optional_int64_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&optional_foreign_enum_) -
+      reinterpret_cast<char*>(&optional_int64_)) + sizeof(optional_foreign_enum_));
+  clear_oneof_field();
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestAllTypes::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // int32 optional_int32 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_optional_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // int64 optional_int64 = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 16) goto handle_unusual;
+        set_optional_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // uint32 optional_uint32 = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 24) goto handle_unusual;
+        set_optional_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // uint64 optional_uint64 = 4;
+      case 4: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 32) goto handle_unusual;
+        set_optional_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // sint32 optional_sint32 = 5;
+      case 5: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 40) goto handle_unusual;
+        set_optional_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // sint64 optional_sint64 = 6;
+      case 6: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 48) goto handle_unusual;
+        set_optional_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // fixed32 optional_fixed32 = 7;
+      case 7: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 61) goto handle_unusual;
+        set_optional_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        break;
+      }
+      // fixed64 optional_fixed64 = 8;
+      case 8: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 65) goto handle_unusual;
+        set_optional_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        break;
+      }
+      // sfixed32 optional_sfixed32 = 9;
+      case 9: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 77) goto handle_unusual;
+        set_optional_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+        break;
+      }
+      // sfixed64 optional_sfixed64 = 10;
+      case 10: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 81) goto handle_unusual;
+        set_optional_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+        ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+        break;
+      }
+      // float optional_float = 11;
+      case 11: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 93) goto handle_unusual;
+        set_optional_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+        ptr += sizeof(float);
+        break;
+      }
+      // double optional_double = 12;
+      case 12: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 97) goto handle_unusual;
+        set_optional_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+        ptr += sizeof(double);
+        break;
+      }
+      // bool optional_bool = 13;
+      case 13: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 104) goto handle_unusual;
+        set_optional_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // string optional_string = 14;
+      case 14: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 114) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_optional_string(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.optional_string");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // bytes optional_bytes = 15;
+      case 15: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 122) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_optional_bytes(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+      case 18: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_nested_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+      case 19: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 154) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_foreign_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+      case 20: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 162) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_proto2_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+      case 21: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 168) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        set_optional_nested_enum(static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(val));
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+      case 22: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 176) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        set_optional_foreign_enum(static_cast<::proto2_nofieldpresence_unittest::ForeignEnum>(val));
+        break;
+      }
+      // string optional_string_piece = 24 [ctype = STRING_PIECE];
+      case 24: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 194) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_optional_string_piece(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // string optional_cord = 25 [ctype = CORD];
+      case 25: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 202) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_optional_cord(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.optional_cord");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+      case 30: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 242) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_optional_lazy_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // repeated int32 repeated_int32 = 31;
+      case 31: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(mutable_repeated_int32(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 248) goto handle_unusual;
+        do {
+          add_repeated_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 504 && (ptr += 2));
+        break;
+      }
+      // repeated int64 repeated_int64 = 32;
+      case 32: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_repeated_int64(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 0) goto handle_unusual;
+        do {
+          add_repeated_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 640 && (ptr += 2));
+        break;
+      }
+      // repeated uint32 repeated_uint32 = 33;
+      case 33: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(mutable_repeated_uint32(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        do {
+          add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 648 && (ptr += 2));
+        break;
+      }
+      // repeated uint64 repeated_uint64 = 34;
+      case 34: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(mutable_repeated_uint64(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 16) goto handle_unusual;
+        do {
+          add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 656 && (ptr += 2));
+        break;
+      }
+      // repeated sint32 repeated_sint32 = 35;
+      case 35: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(mutable_repeated_sint32(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 24) goto handle_unusual;
+        do {
+          add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 664 && (ptr += 2));
+        break;
+      }
+      // repeated sint64 repeated_sint64 = 36;
+      case 36: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(mutable_repeated_sint64(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 32) goto handle_unusual;
+        do {
+          add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 672 && (ptr += 2));
+        break;
+      }
+      // repeated fixed32 repeated_fixed32 = 37;
+      case 37: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(mutable_repeated_fixed32(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 45) goto handle_unusual;
+        do {
+          add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 685 && (ptr += 2));
+        break;
+      }
+      // repeated fixed64 repeated_fixed64 = 38;
+      case 38: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(mutable_repeated_fixed64(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 49) goto handle_unusual;
+        do {
+          add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 689 && (ptr += 2));
+        break;
+      }
+      // repeated sfixed32 repeated_sfixed32 = 39;
+      case 39: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed32Parser(mutable_repeated_sfixed32(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 61) goto handle_unusual;
+        do {
+          add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 701 && (ptr += 2));
+        break;
+      }
+      // repeated sfixed64 repeated_sfixed64 = 40;
+      case 40: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed64Parser(mutable_repeated_sfixed64(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 65) goto handle_unusual;
+        do {
+          add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 705 && (ptr += 2));
+        break;
+      }
+      // repeated float repeated_float = 41;
+      case 41: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(mutable_repeated_float(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 77) goto handle_unusual;
+        do {
+          add_repeated_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 717 && (ptr += 2));
+        break;
+      }
+      // repeated double repeated_double = 42;
+      case 42: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(mutable_repeated_double(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 81) goto handle_unusual;
+        do {
+          add_repeated_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 721 && (ptr += 2));
+        break;
+      }
+      // repeated bool repeated_bool = 43;
+      case 43: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(mutable_repeated_bool(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 88) goto handle_unusual;
+        do {
+          add_repeated_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 728 && (ptr += 2));
+        break;
+      }
+      // repeated string repeated_string = 44;
+      case 44: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 98) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(add_repeated_string(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string");
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 738 && (ptr += 2));
+        break;
+      }
+      // repeated bytes repeated_bytes = 45;
+      case 45: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 106) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(add_repeated_bytes(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 746 && (ptr += 2));
+        break;
+      }
+      // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+      case 48: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_nested_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 898 && (ptr += 2));
+        break;
+      }
+      // repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+      case 49: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_foreign_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 906 && (ptr += 2));
+        break;
+      }
+      // repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+      case 50: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_proto2_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 914 && (ptr += 2));
+        break;
+      }
+      // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+      case 51: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(mutable_repeated_nested_enum(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 152) goto handle_unusual;
+        do {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          add_repeated_nested_enum(static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(val));
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 920 && (ptr += 2));
+        break;
+      }
+      // repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+      case 52: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(mutable_repeated_foreign_enum(), ptr, ctx);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          break;
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 160) goto handle_unusual;
+        do {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          add_repeated_foreign_enum(static_cast<::proto2_nofieldpresence_unittest::ForeignEnum>(val));
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 928 && (ptr += 2));
+        break;
+      }
+      // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+      case 54: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 178) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(add_repeated_string_piece(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece");
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 946 && (ptr += 2));
+        break;
+      }
+      // repeated string repeated_cord = 55 [ctype = CORD];
+      case 55: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 186) goto handle_unusual;
+        do {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(add_repeated_cord(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord");
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 954 && (ptr += 2));
+        break;
+      }
+      // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+      case 57: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 202) goto handle_unusual;
+        do {
+          ptr = ctx->ParseMessage(add_repeated_lazy_message(), ptr);
+          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+          if (ctx->Done(&ptr)) return ptr;
+        } while ((::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr) & 65535) == 970 && (ptr += 2));
+        break;
+      }
+      // uint32 oneof_uint32 = 111;
+      case 111: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 120) goto handle_unusual;
+        set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+      case 112: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_oneof_nested_message(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // string oneof_string = 113;
+      case 113: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_oneof_string(), ptr, ctx, "proto2_nofieldpresence_unittest.TestAllTypes.oneof_string");
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+      case 114: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 144) goto handle_unusual;
+        ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        set_oneof_enum(static_cast<::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum>(val));
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestAllTypes::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 optional_int32 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &optional_int32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 optional_int64 = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &optional_int64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 optional_uint32 = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &optional_uint32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 optional_uint64 = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &optional_uint64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // sint32 optional_sint32 = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 input, &optional_sint32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // sint64 optional_sint64 = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 input, &optional_sint64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // fixed32 optional_fixed32 = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (61 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, &optional_fixed32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // fixed64 optional_fixed64 = 8;
+      case 8: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (65 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, &optional_fixed64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // sfixed32 optional_sfixed32 = 9;
+      case 9: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (77 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 input, &optional_sfixed32_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // sfixed64 optional_sfixed64 = 10;
+      case 10: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (81 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 input, &optional_sfixed64_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float optional_float = 11;
+      case 11: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (93 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &optional_float_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double optional_double = 12;
+      case 12: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (97 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &optional_double_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool optional_bool = 13;
+      case 13: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (104 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &optional_bool_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string optional_string = 14;
+      case 14: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (114 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_string()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->optional_string().data(), static_cast<int>(this->optional_string().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.optional_string"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes optional_bytes = 15;
+      case 15: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (122 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_optional_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+      case 18: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (146 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+      case 19: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (154 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_foreign_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+      case 20: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (162 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_proto2_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+      case 21: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (168 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_optional_nested_enum(static_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+      case 22: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (176 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_optional_foreign_enum(static_cast< ::proto2_nofieldpresence_unittest::ForeignEnum >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string optional_string_piece = 24 [ctype = STRING_PIECE];
+      case 24: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (194 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_string_piece()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->optional_string_piece().data(), static_cast<int>(this->optional_string_piece().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string optional_cord = 25 [ctype = CORD];
+      case 25: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (202 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_cord()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->optional_cord().data(), static_cast<int>(this->optional_cord().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.optional_cord"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+      case 30: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (242 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_optional_lazy_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 repeated_int32 = 31;
+      case 31: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (250 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_repeated_int32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (248 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 2, 250u, input, this->mutable_repeated_int32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 repeated_int64 = 32;
+      case 32: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (258 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_repeated_int64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (256 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 2, 258u, input, this->mutable_repeated_int64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint32 repeated_uint32 = 33;
+      case 33: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (266 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_repeated_uint32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (264 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 2, 266u, input, this->mutable_repeated_uint32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 repeated_uint64 = 34;
+      case 34: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (274 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_repeated_uint64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (272 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
+                 2, 274u, input, this->mutable_repeated_uint64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint32 repeated_sint32 = 35;
+      case 35: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (282 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 input, this->mutable_repeated_sint32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (280 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32>(
+                 2, 282u, input, this->mutable_repeated_sint32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint64 repeated_sint64 = 36;
+      case 36: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (290 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 input, this->mutable_repeated_sint64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (288 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64>(
+                 2, 290u, input, this->mutable_repeated_sint64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated fixed32 repeated_fixed32 = 37;
+      case 37: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (298 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, this->mutable_repeated_fixed32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (301 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32>(
+                 2, 298u, input, this->mutable_repeated_fixed32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated fixed64 repeated_fixed64 = 38;
+      case 38: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (306 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, this->mutable_repeated_fixed64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (305 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64>(
+                 2, 306u, input, this->mutable_repeated_fixed64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sfixed32 repeated_sfixed32 = 39;
+      case 39: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (314 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 input, this->mutable_repeated_sfixed32())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (317 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32>(
+                 2, 314u, input, this->mutable_repeated_sfixed32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sfixed64 repeated_sfixed64 = 40;
+      case 40: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (322 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 input, this->mutable_repeated_sfixed64())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (321 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64>(
+                 2, 322u, input, this->mutable_repeated_sfixed64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float repeated_float = 41;
+      case 41: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (330 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_repeated_float())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (333 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 2, 330u, input, this->mutable_repeated_float())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated double repeated_double = 42;
+      case 42: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (338 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, this->mutable_repeated_double())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (337 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   double, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE>(
+                 2, 338u, input, this->mutable_repeated_double())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated bool repeated_bool = 43;
+      case 43: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (346 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 input, this->mutable_repeated_bool())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (344 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
+                 2, 346u, input, this->mutable_repeated_bool())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string repeated_string = 44;
+      case 44: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (354 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_string()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->repeated_string(this->repeated_string_size() - 1).data(),
+            static_cast<int>(this->repeated_string(this->repeated_string_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated bytes repeated_bytes = 45;
+      case 45: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (362 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->add_repeated_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+      case 48: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (386 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+      case 49: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (394 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_foreign_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+      case 50: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (402 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_proto2_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+      case 51: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (410 & 0xFF)) {
+          ::PROTOBUF_NAMESPACE_ID::uint32 length;
+          DO_(input->ReadVarint32(&length));
+          ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(length));
+          while (input->BytesUntilLimit() > 0) {
+            int value = 0;
+            DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+            add_repeated_nested_enum(static_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum >(value));
+          }
+          input->PopLimit(limit);
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (408 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          add_repeated_nested_enum(static_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+      case 52: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (418 & 0xFF)) {
+          ::PROTOBUF_NAMESPACE_ID::uint32 length;
+          DO_(input->ReadVarint32(&length));
+          ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(length));
+          while (input->BytesUntilLimit() > 0) {
+            int value = 0;
+            DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+            add_repeated_foreign_enum(static_cast< ::proto2_nofieldpresence_unittest::ForeignEnum >(value));
+          }
+          input->PopLimit(limit);
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (416 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          add_repeated_foreign_enum(static_cast< ::proto2_nofieldpresence_unittest::ForeignEnum >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+      case 54: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (434 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_string_piece()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->repeated_string_piece(this->repeated_string_piece_size() - 1).data(),
+            static_cast<int>(this->repeated_string_piece(this->repeated_string_piece_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string repeated_cord = 55 [ctype = CORD];
+      case 55: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (442 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_cord()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->repeated_cord(this->repeated_cord_size() - 1).data(),
+            static_cast<int>(this->repeated_cord(this->repeated_cord_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+      case 57: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (458 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_repeated_lazy_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 oneof_uint32 = 111;
+      case 111: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (888 & 0xFF)) {
+          clear_oneof_field();
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &oneof_field_.oneof_uint32_)));
+          set_has_oneof_uint32();
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+      case 112: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (898 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_oneof_nested_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string oneof_string = 113;
+      case 113: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (906 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_oneof_string()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->oneof_string().data(), static_cast<int>(this->oneof_string().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "proto2_nofieldpresence_unittest.TestAllTypes.oneof_string"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+      case 114: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (912 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_oneof_enum(static_cast< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedEnum >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto2_nofieldpresence_unittest.TestAllTypes)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto2_nofieldpresence_unittest.TestAllTypes)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestAllTypes::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 optional_int32 = 1;
+  if (this->optional_int32() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+
+  // int64 optional_int64 = 2;
+  if (this->optional_int64() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(2, this->optional_int64(), output);
+  }
+
+  // uint32 optional_uint32 = 3;
+  if (this->optional_uint32() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(3, this->optional_uint32(), output);
+  }
+
+  // uint64 optional_uint64 = 4;
+  if (this->optional_uint64() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(4, this->optional_uint64(), output);
+  }
+
+  // sint32 optional_sint32 = 5;
+  if (this->optional_sint32() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32(5, this->optional_sint32(), output);
+  }
+
+  // sint64 optional_sint64 = 6;
+  if (this->optional_sint64() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64(6, this->optional_sint64(), output);
+  }
+
+  // fixed32 optional_fixed32 = 7;
+  if (this->optional_fixed32() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32(7, this->optional_fixed32(), output);
+  }
+
+  // fixed64 optional_fixed64 = 8;
+  if (this->optional_fixed64() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64(8, this->optional_fixed64(), output);
+  }
+
+  // sfixed32 optional_sfixed32 = 9;
+  if (this->optional_sfixed32() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32(9, this->optional_sfixed32(), output);
+  }
+
+  // sfixed64 optional_sfixed64 = 10;
+  if (this->optional_sfixed64() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64(10, this->optional_sfixed64(), output);
+  }
+
+  // float optional_float = 11;
+  if (this->optional_float() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloat(11, this->optional_float(), output);
+  }
+
+  // double optional_double = 12;
+  if (this->optional_double() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDouble(12, this->optional_double(), output);
+  }
+
+  // bool optional_bool = 13;
+  if (this->optional_bool() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(13, this->optional_bool(), output);
+  }
+
+  // string optional_string = 14;
+  if (this->optional_string().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->optional_string().data(), static_cast<int>(this->optional_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.optional_string");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      14, this->optional_string(), output);
+  }
+
+  // bytes optional_bytes = 15;
+  if (this->optional_bytes().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      15, this->optional_bytes(), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+  if (this->has_optional_nested_message()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      18, HasBitSetters::optional_nested_message(this), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+  if (this->has_optional_foreign_message()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      19, HasBitSetters::optional_foreign_message(this), output);
+  }
+
+  // .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+  if (this->has_optional_proto2_message()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      20, HasBitSetters::optional_proto2_message(this), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  if (this->optional_nested_enum() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      21, this->optional_nested_enum(), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+  if (this->optional_foreign_enum() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      22, this->optional_foreign_enum(), output);
+  }
+
+  // string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (this->optional_string_piece().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->optional_string_piece().data(), static_cast<int>(this->optional_string_piece().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      24, this->optional_string_piece(), output);
+  }
+
+  // string optional_cord = 25 [ctype = CORD];
+  if (this->optional_cord().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->optional_cord().data(), static_cast<int>(this->optional_cord().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.optional_cord");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      25, this->optional_cord(), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+  if (this->has_optional_lazy_message()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      30, HasBitSetters::optional_lazy_message(this), output);
+  }
+
+  // repeated int32 repeated_int32 = 31;
+  if (this->repeated_int32_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(31, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_int32_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_int32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32NoTag(
+      this->repeated_int32(i), output);
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  if (this->repeated_int64_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_int64_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_int64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64NoTag(
+      this->repeated_int64(i), output);
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  if (this->repeated_uint32_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(33, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_uint32_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_uint32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32NoTag(
+      this->repeated_uint32(i), output);
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  if (this->repeated_uint64_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(34, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_uint64_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_uint64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64NoTag(
+      this->repeated_uint64(i), output);
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  if (this->repeated_sint32_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(35, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_sint32_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_sint32_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32NoTag(
+      this->repeated_sint32(i), output);
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  if (this->repeated_sint64_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(36, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_sint64_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_sint64_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64NoTag(
+      this->repeated_sint64(i), output);
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  if (this->repeated_fixed32_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(37, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_fixed32_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32Array(
+      this->repeated_fixed32().data(), this->repeated_fixed32_size(), output);
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  if (this->repeated_fixed64_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(38, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_fixed64_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64Array(
+      this->repeated_fixed64().data(), this->repeated_fixed64_size(), output);
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  if (this->repeated_sfixed32_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(39, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_sfixed32_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32Array(
+      this->repeated_sfixed32().data(), this->repeated_sfixed32_size(), output);
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  if (this->repeated_sfixed64_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(40, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_sfixed64_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64Array(
+      this->repeated_sfixed64().data(), this->repeated_sfixed64_size(), output);
+  }
+
+  // repeated float repeated_float = 41;
+  if (this->repeated_float_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(41, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_float_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatArray(
+      this->repeated_float().data(), this->repeated_float_size(), output);
+  }
+
+  // repeated double repeated_double = 42;
+  if (this->repeated_double_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(42, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_double_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleArray(
+      this->repeated_double().data(), this->repeated_double_size(), output);
+  }
+
+  // repeated bool repeated_bool = 43;
+  if (this->repeated_bool_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(43, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_repeated_bool_cached_byte_size_.load(
+        std::memory_order_relaxed));
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolArray(
+      this->repeated_bool().data(), this->repeated_bool_size(), output);
+  }
+
+  // repeated string repeated_string = 44;
+  for (int i = 0, n = this->repeated_string_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->repeated_string(i).data(), static_cast<int>(this->repeated_string(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      44, this->repeated_string(i), output);
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0, n = this->repeated_bytes_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytes(
+      45, this->repeated_bytes(i), output);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_nested_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      48,
+      this->repeated_nested_message(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_foreign_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      49,
+      this->repeated_foreign_message(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_proto2_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      50,
+      this->repeated_proto2_message(static_cast<int>(i)),
+      output);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  if (this->repeated_nested_enum_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(
+      51,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    output->WriteVarint32(_repeated_nested_enum_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_nested_enum_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumNoTag(
+      this->repeated_nested_enum(i), output);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+  if (this->repeated_foreign_enum_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(
+      52,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    output->WriteVarint32(_repeated_foreign_enum_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->repeated_foreign_enum_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumNoTag(
+      this->repeated_foreign_enum(i), output);
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0, n = this->repeated_string_piece_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->repeated_string_piece(i).data(), static_cast<int>(this->repeated_string_piece(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      54, this->repeated_string_piece(i), output);
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0, n = this->repeated_cord_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->repeated_cord(i).data(), static_cast<int>(this->repeated_cord(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      55, this->repeated_cord(i), output);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_lazy_message_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      57,
+      this->repeated_lazy_message(static_cast<int>(i)),
+      output);
+  }
+
+  // uint32 oneof_uint32 = 111;
+  if (has_oneof_uint32()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(111, this->oneof_uint32(), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+  if (has_oneof_nested_message()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      112, HasBitSetters::oneof_nested_message(this), output);
+  }
+
+  // string oneof_string = 113;
+  if (has_oneof_string()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->oneof_string().data(), static_cast<int>(this->oneof_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.oneof_string");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      113, this->oneof_string(), output);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+  if (has_oneof_enum()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      114, this->oneof_enum(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto2_nofieldpresence_unittest.TestAllTypes)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypes::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 optional_int32 = 1;
+  if (this->optional_int32() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->optional_int32(), target);
+  }
+
+  // int64 optional_int64 = 2;
+  if (this->optional_int64() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->optional_int64(), target);
+  }
+
+  // uint32 optional_uint32 = 3;
+  if (this->optional_uint32() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->optional_uint32(), target);
+  }
+
+  // uint64 optional_uint64 = 4;
+  if (this->optional_uint64() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->optional_uint64(), target);
+  }
+
+  // sint32 optional_sint32 = 5;
+  if (this->optional_sint32() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(5, this->optional_sint32(), target);
+  }
+
+  // sint64 optional_sint64 = 6;
+  if (this->optional_sint64() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64ToArray(6, this->optional_sint64(), target);
+  }
+
+  // fixed32 optional_fixed32 = 7;
+  if (this->optional_fixed32() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(7, this->optional_fixed32(), target);
+  }
+
+  // fixed64 optional_fixed64 = 8;
+  if (this->optional_fixed64() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(8, this->optional_fixed64(), target);
+  }
+
+  // sfixed32 optional_sfixed32 = 9;
+  if (this->optional_sfixed32() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32ToArray(9, this->optional_sfixed32(), target);
+  }
+
+  // sfixed64 optional_sfixed64 = 10;
+  if (this->optional_sfixed64() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64ToArray(10, this->optional_sfixed64(), target);
+  }
+
+  // float optional_float = 11;
+  if (this->optional_float() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(11, this->optional_float(), target);
+  }
+
+  // double optional_double = 12;
+  if (this->optional_double() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(12, this->optional_double(), target);
+  }
+
+  // bool optional_bool = 13;
+  if (this->optional_bool() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(13, this->optional_bool(), target);
+  }
+
+  // string optional_string = 14;
+  if (this->optional_string().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->optional_string().data(), static_cast<int>(this->optional_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.optional_string");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        14, this->optional_string(), target);
+  }
+
+  // bytes optional_bytes = 15;
+  if (this->optional_bytes().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        15, this->optional_bytes(), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+  if (this->has_optional_nested_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        18, HasBitSetters::optional_nested_message(this), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+  if (this->has_optional_foreign_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        19, HasBitSetters::optional_foreign_message(this), target);
+  }
+
+  // .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+  if (this->has_optional_proto2_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        20, HasBitSetters::optional_proto2_message(this), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  if (this->optional_nested_enum() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      21, this->optional_nested_enum(), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+  if (this->optional_foreign_enum() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      22, this->optional_foreign_enum(), target);
+  }
+
+  // string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (this->optional_string_piece().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->optional_string_piece().data(), static_cast<int>(this->optional_string_piece().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.optional_string_piece");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        24, this->optional_string_piece(), target);
+  }
+
+  // string optional_cord = 25 [ctype = CORD];
+  if (this->optional_cord().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->optional_cord().data(), static_cast<int>(this->optional_cord().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.optional_cord");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        25, this->optional_cord(), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+  if (this->has_optional_lazy_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        30, HasBitSetters::optional_lazy_message(this), target);
+  }
+
+  // repeated int32 repeated_int32 = 31;
+  if (this->repeated_int32_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      31,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_int32_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->repeated_int32_, target);
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  if (this->repeated_int64_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_int64_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->repeated_int64_, target);
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  if (this->repeated_uint32_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      33,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_uint32_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->repeated_uint32_, target);
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  if (this->repeated_uint64_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      34,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_uint64_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->repeated_uint64_, target);
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  if (this->repeated_sint32_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      35,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_sint32_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteSInt32NoTagToArray(this->repeated_sint32_, target);
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  if (this->repeated_sint64_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      36,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_sint64_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteSInt64NoTagToArray(this->repeated_sint64_, target);
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  if (this->repeated_fixed32_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      37,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_fixed32_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteFixed32NoTagToArray(this->repeated_fixed32_, target);
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  if (this->repeated_fixed64_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      38,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_fixed64_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteFixed64NoTagToArray(this->repeated_fixed64_, target);
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  if (this->repeated_sfixed32_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      39,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_sfixed32_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteSFixed32NoTagToArray(this->repeated_sfixed32_, target);
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  if (this->repeated_sfixed64_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      40,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_sfixed64_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteSFixed64NoTagToArray(this->repeated_sfixed64_, target);
+  }
+
+  // repeated float repeated_float = 41;
+  if (this->repeated_float_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      41,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_float_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteFloatNoTagToArray(this->repeated_float_, target);
+  }
+
+  // repeated double repeated_double = 42;
+  if (this->repeated_double_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      42,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_double_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteDoubleNoTagToArray(this->repeated_double_, target);
+  }
+
+  // repeated bool repeated_bool = 43;
+  if (this->repeated_bool_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      43,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _repeated_bool_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteBoolNoTagToArray(this->repeated_bool_, target);
+  }
+
+  // repeated string repeated_string = 44;
+  for (int i = 0, n = this->repeated_string_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->repeated_string(i).data(), static_cast<int>(this->repeated_string(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(44, this->repeated_string(i), target);
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0, n = this->repeated_bytes_size(); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteBytesToArray(45, this->repeated_bytes(i), target);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_nested_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        48, this->repeated_nested_message(static_cast<int>(i)), target);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_foreign_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        49, this->repeated_foreign_message(static_cast<int>(i)), target);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_proto2_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        50, this->repeated_proto2_message(static_cast<int>(i)), target);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  if (this->repeated_nested_enum_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      51,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(      _repeated_nested_enum_cached_byte_size_.load(std::memory_order_relaxed),
+        target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumNoTagToArray(
+      this->repeated_nested_enum_, target);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+  if (this->repeated_foreign_enum_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      52,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(      _repeated_foreign_enum_cached_byte_size_.load(std::memory_order_relaxed),
+        target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumNoTagToArray(
+      this->repeated_foreign_enum_, target);
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0, n = this->repeated_string_piece_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->repeated_string_piece(i).data(), static_cast<int>(this->repeated_string_piece(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.repeated_string_piece");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(54, this->repeated_string_piece(i), target);
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0, n = this->repeated_cord_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->repeated_cord(i).data(), static_cast<int>(this->repeated_cord(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.repeated_cord");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(55, this->repeated_cord(i), target);
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->repeated_lazy_message_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        57, this->repeated_lazy_message(static_cast<int>(i)), target);
+  }
+
+  // uint32 oneof_uint32 = 111;
+  if (has_oneof_uint32()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(111, this->oneof_uint32(), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+  if (has_oneof_nested_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        112, HasBitSetters::oneof_nested_message(this), target);
+  }
+
+  // string oneof_string = 113;
+  if (has_oneof_string()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->oneof_string().data(), static_cast<int>(this->oneof_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto2_nofieldpresence_unittest.TestAllTypes.oneof_string");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        113, this->oneof_string(), target);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+  if (has_oneof_enum()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      114, this->oneof_enum(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto2_nofieldpresence_unittest.TestAllTypes)
+  return target;
+}
+
+size_t TestAllTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 31;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_int32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->repeated_int64_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_int64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->repeated_uint32_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_uint32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt64Size(this->repeated_uint64_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_uint64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt32Size(this->repeated_sint32_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_sint32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt64Size(this->repeated_sint64_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_sint64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_fixed32_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_fixed32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_fixed64_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_fixed64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_sfixed32_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_sfixed32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_sfixed64_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_sfixed64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float repeated_float = 41;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_float_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_float_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double repeated_double = 42;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_double_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_double_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bool repeated_bool = 43;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_bool_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_bool_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string repeated_string = 44;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_string_size());
+  for (int i = 0, n = this->repeated_string_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->repeated_string(i));
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_bytes_size());
+  for (int i = 0, n = this->repeated_bytes_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      this->repeated_bytes(i));
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_nested_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_nested_message(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.ForeignMessage repeated_foreign_message = 49;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_foreign_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_foreign_message(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .protobuf_unittest.TestAllTypes repeated_proto2_message = 50;
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_proto2_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_proto2_message(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->repeated_nested_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->repeated_nested_enum(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_nested_enum_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.ForeignEnum repeated_foreign_enum = 52;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->repeated_foreign_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->repeated_foreign_enum(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_foreign_enum_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_string_piece_size());
+  for (int i = 0, n = this->repeated_string_piece_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->repeated_string_piece(i));
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->repeated_cord_size());
+  for (int i = 0, n = this->repeated_cord_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->repeated_cord(i));
+  }
+
+  // repeated .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->repeated_lazy_message_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->repeated_lazy_message(static_cast<int>(i)));
+    }
+  }
+
+  // string optional_string = 14;
+  if (this->optional_string().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->optional_string());
+  }
+
+  // bytes optional_bytes = 15;
+  if (this->optional_bytes().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->optional_bytes());
+  }
+
+  // string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (this->optional_string_piece().size() > 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->optional_string_piece());
+  }
+
+  // string optional_cord = 25 [ctype = CORD];
+  if (this->optional_cord().size() > 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->optional_cord());
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+  if (this->has_optional_nested_message()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *optional_nested_message_);
+  }
+
+  // .proto2_nofieldpresence_unittest.ForeignMessage optional_foreign_message = 19;
+  if (this->has_optional_foreign_message()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *optional_foreign_message_);
+  }
+
+  // .protobuf_unittest.TestAllTypes optional_proto2_message = 20;
+  if (this->has_optional_proto2_message()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *optional_proto2_message_);
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage optional_lazy_message = 30 [lazy = true];
+  if (this->has_optional_lazy_message()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *optional_lazy_message_);
+  }
+
+  // int64 optional_int64 = 2;
+  if (this->optional_int64() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->optional_int64());
+  }
+
+  // int32 optional_int32 = 1;
+  if (this->optional_int32() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->optional_int32());
+  }
+
+  // uint32 optional_uint32 = 3;
+  if (this->optional_uint32() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->optional_uint32());
+  }
+
+  // uint64 optional_uint64 = 4;
+  if (this->optional_uint64() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->optional_uint64());
+  }
+
+  // sint64 optional_sint64 = 6;
+  if (this->optional_sint64() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt64Size(
+        this->optional_sint64());
+  }
+
+  // sint32 optional_sint32 = 5;
+  if (this->optional_sint32() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt32Size(
+        this->optional_sint32());
+  }
+
+  // fixed32 optional_fixed32 = 7;
+  if (this->optional_fixed32() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // fixed64 optional_fixed64 = 8;
+  if (this->optional_fixed64() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // sfixed64 optional_sfixed64 = 10;
+  if (this->optional_sfixed64() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // sfixed32 optional_sfixed32 = 9;
+  if (this->optional_sfixed32() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float optional_float = 11;
+  if (this->optional_float() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // double optional_double = 12;
+  if (this->optional_double() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool optional_bool = 13;
+  if (this->optional_bool() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  if (this->optional_nested_enum() != 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->optional_nested_enum());
+  }
+
+  // .proto2_nofieldpresence_unittest.ForeignEnum optional_foreign_enum = 22;
+  if (this->optional_foreign_enum() != 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->optional_foreign_enum());
+  }
+
+  switch (oneof_field_case()) {
+    // uint32 oneof_uint32 = 111;
+    case kOneofUint32: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->oneof_uint32());
+      break;
+    }
+    // .proto2_nofieldpresence_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+    case kOneofNestedMessage: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.oneof_nested_message_);
+      break;
+    }
+    // string oneof_string = 113;
+    case kOneofString: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->oneof_string());
+      break;
+    }
+    // .proto2_nofieldpresence_unittest.TestAllTypes.NestedEnum oneof_enum = 114;
+    case kOneofEnum: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->oneof_enum());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypes::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAllTypes* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAllTypes>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto2_nofieldpresence_unittest.TestAllTypes)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto2_nofieldpresence_unittest.TestAllTypes)
+    MergeFrom(*source);
+  }
+}
+
+void TestAllTypes::MergeFrom(const TestAllTypes& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_proto2_message_.MergeFrom(from.repeated_proto2_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  repeated_string_piece_.MergeFrom(from.repeated_string_piece_);
+  repeated_cord_.MergeFrom(from.repeated_cord_);
+  repeated_lazy_message_.MergeFrom(from.repeated_lazy_message_);
+  if (from.optional_string().size() > 0) {
+
+    optional_string_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_);
+  }
+  if (from.optional_bytes().size() > 0) {
+
+    optional_bytes_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_bytes_);
+  }
+  if (from.optional_string_piece().size() > 0) {
+
+    optional_string_piece_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_string_piece_);
+  }
+  if (from.optional_cord().size() > 0) {
+
+    optional_cord_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.optional_cord_);
+  }
+  if (from.has_optional_nested_message()) {
+    mutable_optional_nested_message()->::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::MergeFrom(from.optional_nested_message());
+  }
+  if (from.has_optional_foreign_message()) {
+    mutable_optional_foreign_message()->::proto2_nofieldpresence_unittest::ForeignMessage::MergeFrom(from.optional_foreign_message());
+  }
+  if (from.has_optional_proto2_message()) {
+    mutable_optional_proto2_message()->::protobuf_unittest::TestAllTypes::MergeFrom(from.optional_proto2_message());
+  }
+  if (from.has_optional_lazy_message()) {
+    mutable_optional_lazy_message()->::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::MergeFrom(from.optional_lazy_message());
+  }
+  if (from.optional_int64() != 0) {
+    set_optional_int64(from.optional_int64());
+  }
+  if (from.optional_int32() != 0) {
+    set_optional_int32(from.optional_int32());
+  }
+  if (from.optional_uint32() != 0) {
+    set_optional_uint32(from.optional_uint32());
+  }
+  if (from.optional_uint64() != 0) {
+    set_optional_uint64(from.optional_uint64());
+  }
+  if (from.optional_sint64() != 0) {
+    set_optional_sint64(from.optional_sint64());
+  }
+  if (from.optional_sint32() != 0) {
+    set_optional_sint32(from.optional_sint32());
+  }
+  if (from.optional_fixed32() != 0) {
+    set_optional_fixed32(from.optional_fixed32());
+  }
+  if (from.optional_fixed64() != 0) {
+    set_optional_fixed64(from.optional_fixed64());
+  }
+  if (from.optional_sfixed64() != 0) {
+    set_optional_sfixed64(from.optional_sfixed64());
+  }
+  if (from.optional_sfixed32() != 0) {
+    set_optional_sfixed32(from.optional_sfixed32());
+  }
+  if (from.optional_float() != 0) {
+    set_optional_float(from.optional_float());
+  }
+  if (from.optional_double() != 0) {
+    set_optional_double(from.optional_double());
+  }
+  if (from.optional_bool() != 0) {
+    set_optional_bool(from.optional_bool());
+  }
+  if (from.optional_nested_enum() != 0) {
+    set_optional_nested_enum(from.optional_nested_enum());
+  }
+  if (from.optional_foreign_enum() != 0) {
+    set_optional_foreign_enum(from.optional_foreign_enum());
+  }
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      set_oneof_uint32(from.oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      mutable_oneof_nested_message()->::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage::MergeFrom(from.oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      set_oneof_string(from.oneof_string());
+      break;
+    }
+    case kOneofEnum: {
+      set_oneof_enum(from.oneof_enum());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestAllTypes::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAllTypes::CopyFrom(const TestAllTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto2_nofieldpresence_unittest.TestAllTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypes::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypes::Swap(TestAllTypes* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestAllTypes::InternalSwap(TestAllTypes* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+  repeated_int64_.InternalSwap(&other->repeated_int64_);
+  repeated_uint32_.InternalSwap(&other->repeated_uint32_);
+  repeated_uint64_.InternalSwap(&other->repeated_uint64_);
+  repeated_sint32_.InternalSwap(&other->repeated_sint32_);
+  repeated_sint64_.InternalSwap(&other->repeated_sint64_);
+  repeated_fixed32_.InternalSwap(&other->repeated_fixed32_);
+  repeated_fixed64_.InternalSwap(&other->repeated_fixed64_);
+  repeated_sfixed32_.InternalSwap(&other->repeated_sfixed32_);
+  repeated_sfixed64_.InternalSwap(&other->repeated_sfixed64_);
+  repeated_float_.InternalSwap(&other->repeated_float_);
+  repeated_double_.InternalSwap(&other->repeated_double_);
+  repeated_bool_.InternalSwap(&other->repeated_bool_);
+  repeated_string_.InternalSwap(CastToBase(&other->repeated_string_));
+  repeated_bytes_.InternalSwap(CastToBase(&other->repeated_bytes_));
+  CastToBase(&repeated_nested_message_)->InternalSwap(CastToBase(&other->repeated_nested_message_));
+  CastToBase(&repeated_foreign_message_)->InternalSwap(CastToBase(&other->repeated_foreign_message_));
+  CastToBase(&repeated_proto2_message_)->InternalSwap(CastToBase(&other->repeated_proto2_message_));
+  repeated_nested_enum_.InternalSwap(&other->repeated_nested_enum_);
+  repeated_foreign_enum_.InternalSwap(&other->repeated_foreign_enum_);
+  repeated_string_piece_.InternalSwap(CastToBase(&other->repeated_string_piece_));
+  repeated_cord_.InternalSwap(CastToBase(&other->repeated_cord_));
+  CastToBase(&repeated_lazy_message_)->InternalSwap(CastToBase(&other->repeated_lazy_message_));
+  optional_string_.Swap(&other->optional_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  optional_bytes_.Swap(&other->optional_bytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  optional_string_piece_.Swap(&other->optional_string_piece_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  optional_cord_.Swap(&other->optional_cord_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(optional_nested_message_, other->optional_nested_message_);
+  swap(optional_foreign_message_, other->optional_foreign_message_);
+  swap(optional_proto2_message_, other->optional_proto2_message_);
+  swap(optional_lazy_message_, other->optional_lazy_message_);
+  swap(optional_int64_, other->optional_int64_);
+  swap(optional_int32_, other->optional_int32_);
+  swap(optional_uint32_, other->optional_uint32_);
+  swap(optional_uint64_, other->optional_uint64_);
+  swap(optional_sint64_, other->optional_sint64_);
+  swap(optional_sint32_, other->optional_sint32_);
+  swap(optional_fixed32_, other->optional_fixed32_);
+  swap(optional_fixed64_, other->optional_fixed64_);
+  swap(optional_sfixed64_, other->optional_sfixed64_);
+  swap(optional_sfixed32_, other->optional_sfixed32_);
+  swap(optional_float_, other->optional_float_);
+  swap(optional_double_, other->optional_double_);
+  swap(optional_bool_, other->optional_bool_);
+  swap(optional_nested_enum_, other->optional_nested_enum_);
+  swap(optional_foreign_enum_, other->optional_foreign_enum_);
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAllTypes::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TestProto2Required::InitAsDefaultInstance() {
+  ::proto2_nofieldpresence_unittest::_TestProto2Required_default_instance_._instance.get_mutable()->proto2_ = const_cast< ::protobuf_unittest::TestRequired*>(
+      ::protobuf_unittest::TestRequired::internal_default_instance());
+}
+class TestProto2Required::HasBitSetters {
+ public:
+  static const ::protobuf_unittest::TestRequired& proto2(const TestProto2Required* msg);
+};
+
+const ::protobuf_unittest::TestRequired&
+TestProto2Required::HasBitSetters::proto2(const TestProto2Required* msg) {
+  return *msg->proto2_;
+}
+void TestProto2Required::clear_proto2() {
+  if (GetArenaNoVirtual() == nullptr && proto2_ != nullptr) {
+    delete proto2_;
+  }
+  proto2_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestProto2Required::kProto2FieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestProto2Required::TestProto2Required()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto2_nofieldpresence_unittest.TestProto2Required)
+}
+TestProto2Required::TestProto2Required(const TestProto2Required& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_proto2()) {
+    proto2_ = new ::protobuf_unittest::TestRequired(*from.proto2_);
+  } else {
+    proto2_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto2_nofieldpresence_unittest.TestProto2Required)
+}
+
+void TestProto2Required::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_TestProto2Required_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  proto2_ = nullptr;
+}
+
+TestProto2Required::~TestProto2Required() {
+  // @@protoc_insertion_point(destructor:proto2_nofieldpresence_unittest.TestProto2Required)
+  SharedDtor();
+}
+
+void TestProto2Required::SharedDtor() {
+  if (this != internal_default_instance()) delete proto2_;
+}
+
+void TestProto2Required::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestProto2Required& TestProto2Required::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestProto2Required_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestProto2Required::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && proto2_ != nullptr) {
+    delete proto2_;
+  }
+  proto2_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* TestProto2Required::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .protobuf_unittest.TestRequired proto2 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_proto2(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool TestProto2Required::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .protobuf_unittest.TestRequired proto2 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_proto2()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto2_nofieldpresence_unittest.TestProto2Required)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto2_nofieldpresence_unittest.TestProto2Required)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void TestProto2Required::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestRequired proto2 = 1;
+  if (this->has_proto2()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::proto2(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto2_nofieldpresence_unittest.TestProto2Required)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestProto2Required::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestRequired proto2 = 1;
+  if (this->has_proto2()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::proto2(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto2_nofieldpresence_unittest.TestProto2Required)
+  return target;
+}
+
+size_t TestProto2Required::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestRequired proto2 = 1;
+  if (this->has_proto2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *proto2_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestProto2Required::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestProto2Required* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestProto2Required>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto2_nofieldpresence_unittest.TestProto2Required)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto2_nofieldpresence_unittest.TestProto2Required)
+    MergeFrom(*source);
+  }
+}
+
+void TestProto2Required::MergeFrom(const TestProto2Required& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_proto2()) {
+    mutable_proto2()->::protobuf_unittest::TestRequired::MergeFrom(from.proto2());
+  }
+}
+
+void TestProto2Required::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestProto2Required::CopyFrom(const TestProto2Required& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto2_nofieldpresence_unittest.TestProto2Required)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestProto2Required::IsInitialized() const {
+  if (has_proto2()) {
+    if (!this->proto2_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestProto2Required::Swap(TestProto2Required* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestProto2Required::InternalSwap(TestProto2Required* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(proto2_, other->proto2_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestProto2Required::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ForeignMessage::InitAsDefaultInstance() {
+}
+class ForeignMessage::HasBitSetters {
+ public:
+};
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ForeignMessage::kCFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ForeignMessage::ForeignMessage()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto2_nofieldpresence_unittest.ForeignMessage)
+}
+ForeignMessage::ForeignMessage(const ForeignMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  c_ = from.c_;
+  // @@protoc_insertion_point(copy_constructor:proto2_nofieldpresence_unittest.ForeignMessage)
+}
+
+void ForeignMessage::SharedCtor() {
+  c_ = 0;
+}
+
+ForeignMessage::~ForeignMessage() {
+  // @@protoc_insertion_point(destructor:proto2_nofieldpresence_unittest.ForeignMessage)
+  SharedDtor();
+}
+
+void ForeignMessage::SharedDtor() {
+}
+
+void ForeignMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ForeignMessage& ForeignMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ForeignMessage_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ForeignMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  c_ = 0;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* ForeignMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // int32 c = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 8) goto handle_unusual;
+        set_c(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool ForeignMessage::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 c = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
+                 input, &c_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto2_nofieldpresence_unittest.ForeignMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto2_nofieldpresence_unittest.ForeignMessage)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void ForeignMessage::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 c = 1;
+  if (this->c() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->c(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto2_nofieldpresence_unittest.ForeignMessage)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ForeignMessage::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 c = 1;
+  if (this->c() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->c(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto2_nofieldpresence_unittest.ForeignMessage)
+  return target;
+}
+
+size_t ForeignMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 c = 1;
+  if (this->c() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->c());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ForeignMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ForeignMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ForeignMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto2_nofieldpresence_unittest.ForeignMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto2_nofieldpresence_unittest.ForeignMessage)
+    MergeFrom(*source);
+  }
+}
+
+void ForeignMessage::MergeFrom(const ForeignMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.c() != 0) {
+    set_c(from.c());
+  }
+}
+
+void ForeignMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ForeignMessage::CopyFrom(const ForeignMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto2_nofieldpresence_unittest.ForeignMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ForeignMessage::IsInitialized() const {
+  return true;
+}
+
+void ForeignMessage::Swap(ForeignMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ForeignMessage::InternalSwap(ForeignMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(c_, other->c_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ForeignMessage::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2funittest_5fno_5ffield_5fpresence_2eproto[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto2_nofieldpresence_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage* Arena::CreateMaybeMessage< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage >(Arena* arena) {
+  return Arena::CreateInternal< ::proto2_nofieldpresence_unittest::TestAllTypes_NestedMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto2_nofieldpresence_unittest::TestAllTypes* Arena::CreateMaybeMessage< ::proto2_nofieldpresence_unittest::TestAllTypes >(Arena* arena) {
+  return Arena::CreateInternal< ::proto2_nofieldpresence_unittest::TestAllTypes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto2_nofieldpresence_unittest::TestProto2Required* Arena::CreateMaybeMessage< ::proto2_nofieldpresence_unittest::TestProto2Required >(Arena* arena) {
+  return Arena::CreateInternal< ::proto2_nofieldpresence_unittest::TestProto2Required >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto2_nofieldpresence_unittest::ForeignMessage* Arena::CreateMaybeMessage< ::proto2_nofieldpresence_unittest::ForeignMessage >(Arena* arena) {
+  return Arena::CreateInternal< ::proto2_nofieldpresence_unittest::ForeignMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
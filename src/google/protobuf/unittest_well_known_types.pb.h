@@ -0,0 +1,4304 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_well_known_types.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/api.pb.h>
+#include <google/protobuf/duration.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <google/protobuf/field_mask.pb.h>
+#include <google/protobuf/source_context.pb.h>
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/type.pb.h>
+#include <google/protobuf/wrappers.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[22]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto();
+namespace protobuf_unittest {
+class MapWellKnownTypes;
+class MapWellKnownTypesDefaultTypeInternal;
+extern MapWellKnownTypesDefaultTypeInternal _MapWellKnownTypes_default_instance_;
+class MapWellKnownTypes_AnyFieldEntry_DoNotUse;
+class MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_ApiFieldEntry_DoNotUse;
+class MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_BoolFieldEntry_DoNotUse;
+class MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_BytesFieldEntry_DoNotUse;
+class MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_DoubleFieldEntry_DoNotUse;
+class MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_DurationFieldEntry_DoNotUse;
+class MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_EmptyFieldEntry_DoNotUse;
+class MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse;
+class MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_FloatFieldEntry_DoNotUse;
+class MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Int32FieldEntry_DoNotUse;
+class MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Int64FieldEntry_DoNotUse;
+class MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_SourceContextFieldEntry_DoNotUse;
+class MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_StringFieldEntry_DoNotUse;
+class MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_StructFieldEntry_DoNotUse;
+class MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_TimestampFieldEntry_DoNotUse;
+class MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_TypeFieldEntry_DoNotUse;
+class MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Uint32FieldEntry_DoNotUse;
+class MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Uint64FieldEntry_DoNotUse;
+class MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal;
+extern MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal _MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_;
+class OneofWellKnownTypes;
+class OneofWellKnownTypesDefaultTypeInternal;
+extern OneofWellKnownTypesDefaultTypeInternal _OneofWellKnownTypes_default_instance_;
+class RepeatedWellKnownTypes;
+class RepeatedWellKnownTypesDefaultTypeInternal;
+extern RepeatedWellKnownTypesDefaultTypeInternal _RepeatedWellKnownTypes_default_instance_;
+class TestWellKnownTypes;
+class TestWellKnownTypesDefaultTypeInternal;
+extern TestWellKnownTypesDefaultTypeInternal _TestWellKnownTypes_default_instance_;
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest::MapWellKnownTypes* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::OneofWellKnownTypes* Arena::CreateMaybeMessage<::protobuf_unittest::OneofWellKnownTypes>(Arena*);
+template<> ::protobuf_unittest::RepeatedWellKnownTypes* Arena::CreateMaybeMessage<::protobuf_unittest::RepeatedWellKnownTypes>(Arena*);
+template<> ::protobuf_unittest::TestWellKnownTypes* Arena::CreateMaybeMessage<::protobuf_unittest::TestWellKnownTypes>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest {
+
+// ===================================================================
+
+class TestWellKnownTypes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestWellKnownTypes) */ {
+ public:
+  TestWellKnownTypes();
+  virtual ~TestWellKnownTypes();
+
+  TestWellKnownTypes(const TestWellKnownTypes& from);
+  TestWellKnownTypes(TestWellKnownTypes&& from) noexcept
+    : TestWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestWellKnownTypes& operator=(const TestWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestWellKnownTypes& operator=(TestWellKnownTypes&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestWellKnownTypes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const TestWellKnownTypes*>(
+               &_TestWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void Swap(TestWellKnownTypes* other);
+  friend void swap(TestWellKnownTypes& a, TestWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestWellKnownTypes* New() const final {
+    return CreateMaybeMessage<TestWellKnownTypes>(nullptr);
+  }
+
+  TestWellKnownTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestWellKnownTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestWellKnownTypes& from);
+  void MergeFrom(const TestWellKnownTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestWellKnownTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestWellKnownTypes";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.Any any_field = 1;
+  bool has_any_field() const;
+  void clear_any_field();
+  static const int kAnyFieldFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::Any& any_field() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any_field();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any_field();
+  void set_allocated_any_field(PROTOBUF_NAMESPACE_ID::Any* any_field);
+
+  // .google.protobuf.Api api_field = 2;
+  bool has_api_field() const;
+  void clear_api_field();
+  static const int kApiFieldFieldNumber = 2;
+  const PROTOBUF_NAMESPACE_ID::Api& api_field() const;
+  PROTOBUF_NAMESPACE_ID::Api* release_api_field();
+  PROTOBUF_NAMESPACE_ID::Api* mutable_api_field();
+  void set_allocated_api_field(PROTOBUF_NAMESPACE_ID::Api* api_field);
+
+  // .google.protobuf.Duration duration_field = 3;
+  bool has_duration_field() const;
+  void clear_duration_field();
+  static const int kDurationFieldFieldNumber = 3;
+  const PROTOBUF_NAMESPACE_ID::Duration& duration_field() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_duration_field();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration_field();
+  void set_allocated_duration_field(PROTOBUF_NAMESPACE_ID::Duration* duration_field);
+
+  // .google.protobuf.Empty empty_field = 4;
+  bool has_empty_field() const;
+  void clear_empty_field();
+  static const int kEmptyFieldFieldNumber = 4;
+  const PROTOBUF_NAMESPACE_ID::Empty& empty_field() const;
+  PROTOBUF_NAMESPACE_ID::Empty* release_empty_field();
+  PROTOBUF_NAMESPACE_ID::Empty* mutable_empty_field();
+  void set_allocated_empty_field(PROTOBUF_NAMESPACE_ID::Empty* empty_field);
+
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  bool has_field_mask_field() const;
+  void clear_field_mask_field();
+  static const int kFieldMaskFieldFieldNumber = 5;
+  const PROTOBUF_NAMESPACE_ID::FieldMask& field_mask_field() const;
+  PROTOBUF_NAMESPACE_ID::FieldMask* release_field_mask_field();
+  PROTOBUF_NAMESPACE_ID::FieldMask* mutable_field_mask_field();
+  void set_allocated_field_mask_field(PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field);
+
+  // .google.protobuf.SourceContext source_context_field = 6;
+  bool has_source_context_field() const;
+  void clear_source_context_field();
+  static const int kSourceContextFieldFieldNumber = 6;
+  const PROTOBUF_NAMESPACE_ID::SourceContext& source_context_field() const;
+  PROTOBUF_NAMESPACE_ID::SourceContext* release_source_context_field();
+  PROTOBUF_NAMESPACE_ID::SourceContext* mutable_source_context_field();
+  void set_allocated_source_context_field(PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field);
+
+  // .google.protobuf.Struct struct_field = 7;
+  bool has_struct_field() const;
+  void clear_struct_field();
+  static const int kStructFieldFieldNumber = 7;
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_field() const;
+  PROTOBUF_NAMESPACE_ID::Struct* release_struct_field();
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_field();
+  void set_allocated_struct_field(PROTOBUF_NAMESPACE_ID::Struct* struct_field);
+
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  bool has_timestamp_field() const;
+  void clear_timestamp_field();
+  static const int kTimestampFieldFieldNumber = 8;
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp_field() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp_field();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp_field();
+  void set_allocated_timestamp_field(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field);
+
+  // .google.protobuf.Type type_field = 9;
+  bool has_type_field() const;
+  void clear_type_field();
+  static const int kTypeFieldFieldNumber = 9;
+  const PROTOBUF_NAMESPACE_ID::Type& type_field() const;
+  PROTOBUF_NAMESPACE_ID::Type* release_type_field();
+  PROTOBUF_NAMESPACE_ID::Type* mutable_type_field();
+  void set_allocated_type_field(PROTOBUF_NAMESPACE_ID::Type* type_field);
+
+  // .google.protobuf.DoubleValue double_field = 10;
+  bool has_double_field() const;
+  void clear_double_field();
+  static const int kDoubleFieldFieldNumber = 10;
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& double_field() const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* release_double_field();
+  PROTOBUF_NAMESPACE_ID::DoubleValue* mutable_double_field();
+  void set_allocated_double_field(PROTOBUF_NAMESPACE_ID::DoubleValue* double_field);
+
+  // .google.protobuf.FloatValue float_field = 11;
+  bool has_float_field() const;
+  void clear_float_field();
+  static const int kFloatFieldFieldNumber = 11;
+  const PROTOBUF_NAMESPACE_ID::FloatValue& float_field() const;
+  PROTOBUF_NAMESPACE_ID::FloatValue* release_float_field();
+  PROTOBUF_NAMESPACE_ID::FloatValue* mutable_float_field();
+  void set_allocated_float_field(PROTOBUF_NAMESPACE_ID::FloatValue* float_field);
+
+  // .google.protobuf.Int64Value int64_field = 12;
+  bool has_int64_field() const;
+  void clear_int64_field();
+  static const int kInt64FieldFieldNumber = 12;
+  const PROTOBUF_NAMESPACE_ID::Int64Value& int64_field() const;
+  PROTOBUF_NAMESPACE_ID::Int64Value* release_int64_field();
+  PROTOBUF_NAMESPACE_ID::Int64Value* mutable_int64_field();
+  void set_allocated_int64_field(PROTOBUF_NAMESPACE_ID::Int64Value* int64_field);
+
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  bool has_uint64_field() const;
+  void clear_uint64_field();
+  static const int kUint64FieldFieldNumber = 13;
+  const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64_field() const;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* release_uint64_field();
+  PROTOBUF_NAMESPACE_ID::UInt64Value* mutable_uint64_field();
+  void set_allocated_uint64_field(PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field);
+
+  // .google.protobuf.Int32Value int32_field = 14;
+  bool has_int32_field() const;
+  void clear_int32_field();
+  static const int kInt32FieldFieldNumber = 14;
+  const PROTOBUF_NAMESPACE_ID::Int32Value& int32_field() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_int32_field();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_int32_field();
+  void set_allocated_int32_field(PROTOBUF_NAMESPACE_ID::Int32Value* int32_field);
+
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  bool has_uint32_field() const;
+  void clear_uint32_field();
+  static const int kUint32FieldFieldNumber = 15;
+  const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32_field() const;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* release_uint32_field();
+  PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_uint32_field();
+  void set_allocated_uint32_field(PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field);
+
+  // .google.protobuf.BoolValue bool_field = 16;
+  bool has_bool_field() const;
+  void clear_bool_field();
+  static const int kBoolFieldFieldNumber = 16;
+  const PROTOBUF_NAMESPACE_ID::BoolValue& bool_field() const;
+  PROTOBUF_NAMESPACE_ID::BoolValue* release_bool_field();
+  PROTOBUF_NAMESPACE_ID::BoolValue* mutable_bool_field();
+  void set_allocated_bool_field(PROTOBUF_NAMESPACE_ID::BoolValue* bool_field);
+
+  // .google.protobuf.StringValue string_field = 17;
+  bool has_string_field() const;
+  void clear_string_field();
+  static const int kStringFieldFieldNumber = 17;
+  const PROTOBUF_NAMESPACE_ID::StringValue& string_field() const;
+  PROTOBUF_NAMESPACE_ID::StringValue* release_string_field();
+  PROTOBUF_NAMESPACE_ID::StringValue* mutable_string_field();
+  void set_allocated_string_field(PROTOBUF_NAMESPACE_ID::StringValue* string_field);
+
+  // .google.protobuf.BytesValue bytes_field = 18;
+  bool has_bytes_field() const;
+  void clear_bytes_field();
+  static const int kBytesFieldFieldNumber = 18;
+  const PROTOBUF_NAMESPACE_ID::BytesValue& bytes_field() const;
+  PROTOBUF_NAMESPACE_ID::BytesValue* release_bytes_field();
+  PROTOBUF_NAMESPACE_ID::BytesValue* mutable_bytes_field();
+  void set_allocated_bytes_field(PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field);
+
+  // .google.protobuf.Value value_field = 19;
+  bool has_value_field() const;
+  void clear_value_field();
+  static const int kValueFieldFieldNumber = 19;
+  const PROTOBUF_NAMESPACE_ID::Value& value_field() const;
+  PROTOBUF_NAMESPACE_ID::Value* release_value_field();
+  PROTOBUF_NAMESPACE_ID::Value* mutable_value_field();
+  void set_allocated_value_field(PROTOBUF_NAMESPACE_ID::Value* value_field);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestWellKnownTypes)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::Any* any_field_;
+  PROTOBUF_NAMESPACE_ID::Api* api_field_;
+  PROTOBUF_NAMESPACE_ID::Duration* duration_field_;
+  PROTOBUF_NAMESPACE_ID::Empty* empty_field_;
+  PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field_;
+  PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field_;
+  PROTOBUF_NAMESPACE_ID::Struct* struct_field_;
+  PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field_;
+  PROTOBUF_NAMESPACE_ID::Type* type_field_;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* double_field_;
+  PROTOBUF_NAMESPACE_ID::FloatValue* float_field_;
+  PROTOBUF_NAMESPACE_ID::Int64Value* int64_field_;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field_;
+  PROTOBUF_NAMESPACE_ID::Int32Value* int32_field_;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field_;
+  PROTOBUF_NAMESPACE_ID::BoolValue* bool_field_;
+  PROTOBUF_NAMESPACE_ID::StringValue* string_field_;
+  PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field_;
+  PROTOBUF_NAMESPACE_ID::Value* value_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RepeatedWellKnownTypes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.RepeatedWellKnownTypes) */ {
+ public:
+  RepeatedWellKnownTypes();
+  virtual ~RepeatedWellKnownTypes();
+
+  RepeatedWellKnownTypes(const RepeatedWellKnownTypes& from);
+  RepeatedWellKnownTypes(RepeatedWellKnownTypes&& from) noexcept
+    : RepeatedWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline RepeatedWellKnownTypes& operator=(const RepeatedWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RepeatedWellKnownTypes& operator=(RepeatedWellKnownTypes&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const RepeatedWellKnownTypes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RepeatedWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const RepeatedWellKnownTypes*>(
+               &_RepeatedWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  void Swap(RepeatedWellKnownTypes* other);
+  friend void swap(RepeatedWellKnownTypes& a, RepeatedWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RepeatedWellKnownTypes* New() const final {
+    return CreateMaybeMessage<RepeatedWellKnownTypes>(nullptr);
+  }
+
+  RepeatedWellKnownTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RepeatedWellKnownTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const RepeatedWellKnownTypes& from);
+  void MergeFrom(const RepeatedWellKnownTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RepeatedWellKnownTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.RepeatedWellKnownTypes";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .google.protobuf.Any any_field = 1;
+  int any_field_size() const;
+  void clear_any_field();
+  static const int kAnyFieldFieldNumber = 1;
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >*
+      mutable_any_field();
+  const PROTOBUF_NAMESPACE_ID::Any& any_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Any* add_any_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >&
+      any_field() const;
+
+  // repeated .google.protobuf.Api api_field = 2;
+  int api_field_size() const;
+  void clear_api_field();
+  static const int kApiFieldFieldNumber = 2;
+  PROTOBUF_NAMESPACE_ID::Api* mutable_api_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Api >*
+      mutable_api_field();
+  const PROTOBUF_NAMESPACE_ID::Api& api_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Api* add_api_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Api >&
+      api_field() const;
+
+  // repeated .google.protobuf.Duration duration_field = 3;
+  int duration_field_size() const;
+  void clear_duration_field();
+  static const int kDurationFieldFieldNumber = 3;
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Duration >*
+      mutable_duration_field();
+  const PROTOBUF_NAMESPACE_ID::Duration& duration_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Duration* add_duration_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Duration >&
+      duration_field() const;
+
+  // repeated .google.protobuf.Empty empty_field = 4;
+  int empty_field_size() const;
+  void clear_empty_field();
+  static const int kEmptyFieldFieldNumber = 4;
+  PROTOBUF_NAMESPACE_ID::Empty* mutable_empty_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Empty >*
+      mutable_empty_field();
+  const PROTOBUF_NAMESPACE_ID::Empty& empty_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Empty* add_empty_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Empty >&
+      empty_field() const;
+
+  // repeated .google.protobuf.FieldMask field_mask_field = 5;
+  int field_mask_field_size() const;
+  void clear_field_mask_field();
+  static const int kFieldMaskFieldFieldNumber = 5;
+  PROTOBUF_NAMESPACE_ID::FieldMask* mutable_field_mask_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FieldMask >*
+      mutable_field_mask_field();
+  const PROTOBUF_NAMESPACE_ID::FieldMask& field_mask_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::FieldMask* add_field_mask_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FieldMask >&
+      field_mask_field() const;
+
+  // repeated .google.protobuf.SourceContext source_context_field = 6;
+  int source_context_field_size() const;
+  void clear_source_context_field();
+  static const int kSourceContextFieldFieldNumber = 6;
+  PROTOBUF_NAMESPACE_ID::SourceContext* mutable_source_context_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::SourceContext >*
+      mutable_source_context_field();
+  const PROTOBUF_NAMESPACE_ID::SourceContext& source_context_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::SourceContext* add_source_context_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::SourceContext >&
+      source_context_field() const;
+
+  // repeated .google.protobuf.Struct struct_field = 7;
+  int struct_field_size() const;
+  void clear_struct_field();
+  static const int kStructFieldFieldNumber = 7;
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Struct >*
+      mutable_struct_field();
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Struct* add_struct_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Struct >&
+      struct_field() const;
+
+  // repeated .google.protobuf.Timestamp timestamp_field = 8;
+  int timestamp_field_size() const;
+  void clear_timestamp_field();
+  static const int kTimestampFieldFieldNumber = 8;
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >*
+      mutable_timestamp_field();
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* add_timestamp_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >&
+      timestamp_field() const;
+
+  // repeated .google.protobuf.Type type_field = 9;
+  int type_field_size() const;
+  void clear_type_field();
+  static const int kTypeFieldFieldNumber = 9;
+  PROTOBUF_NAMESPACE_ID::Type* mutable_type_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Type >*
+      mutable_type_field();
+  const PROTOBUF_NAMESPACE_ID::Type& type_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Type* add_type_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Type >&
+      type_field() const;
+
+  // repeated .google.protobuf.DoubleValue double_field = 10;
+  int double_field_size() const;
+  void clear_double_field();
+  static const int kDoubleFieldFieldNumber = 10;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* mutable_double_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::DoubleValue >*
+      mutable_double_field();
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& double_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* add_double_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::DoubleValue >&
+      double_field() const;
+
+  // repeated .google.protobuf.FloatValue float_field = 11;
+  int float_field_size() const;
+  void clear_float_field();
+  static const int kFloatFieldFieldNumber = 11;
+  PROTOBUF_NAMESPACE_ID::FloatValue* mutable_float_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FloatValue >*
+      mutable_float_field();
+  const PROTOBUF_NAMESPACE_ID::FloatValue& float_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::FloatValue* add_float_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FloatValue >&
+      float_field() const;
+
+  // repeated .google.protobuf.Int64Value int64_field = 12;
+  int int64_field_size() const;
+  void clear_int64_field();
+  static const int kInt64FieldFieldNumber = 12;
+  PROTOBUF_NAMESPACE_ID::Int64Value* mutable_int64_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int64Value >*
+      mutable_int64_field();
+  const PROTOBUF_NAMESPACE_ID::Int64Value& int64_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Int64Value* add_int64_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int64Value >&
+      int64_field() const;
+
+  // repeated .google.protobuf.UInt64Value uint64_field = 13;
+  int uint64_field_size() const;
+  void clear_uint64_field();
+  static const int kUint64FieldFieldNumber = 13;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* mutable_uint64_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt64Value >*
+      mutable_uint64_field();
+  const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* add_uint64_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt64Value >&
+      uint64_field() const;
+
+  // repeated .google.protobuf.Int32Value int32_field = 14;
+  int int32_field_size() const;
+  void clear_int32_field();
+  static const int kInt32FieldFieldNumber = 14;
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_int32_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int32Value >*
+      mutable_int32_field();
+  const PROTOBUF_NAMESPACE_ID::Int32Value& int32_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* add_int32_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int32Value >&
+      int32_field() const;
+
+  // repeated .google.protobuf.UInt32Value uint32_field = 15;
+  int uint32_field_size() const;
+  void clear_uint32_field();
+  static const int kUint32FieldFieldNumber = 15;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_uint32_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt32Value >*
+      mutable_uint32_field();
+  const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* add_uint32_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt32Value >&
+      uint32_field() const;
+
+  // repeated .google.protobuf.BoolValue bool_field = 16;
+  int bool_field_size() const;
+  void clear_bool_field();
+  static const int kBoolFieldFieldNumber = 16;
+  PROTOBUF_NAMESPACE_ID::BoolValue* mutable_bool_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BoolValue >*
+      mutable_bool_field();
+  const PROTOBUF_NAMESPACE_ID::BoolValue& bool_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::BoolValue* add_bool_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BoolValue >&
+      bool_field() const;
+
+  // repeated .google.protobuf.StringValue string_field = 17;
+  int string_field_size() const;
+  void clear_string_field();
+  static const int kStringFieldFieldNumber = 17;
+  PROTOBUF_NAMESPACE_ID::StringValue* mutable_string_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::StringValue >*
+      mutable_string_field();
+  const PROTOBUF_NAMESPACE_ID::StringValue& string_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::StringValue* add_string_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::StringValue >&
+      string_field() const;
+
+  // repeated .google.protobuf.BytesValue bytes_field = 18;
+  int bytes_field_size() const;
+  void clear_bytes_field();
+  static const int kBytesFieldFieldNumber = 18;
+  PROTOBUF_NAMESPACE_ID::BytesValue* mutable_bytes_field(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BytesValue >*
+      mutable_bytes_field();
+  const PROTOBUF_NAMESPACE_ID::BytesValue& bytes_field(int index) const;
+  PROTOBUF_NAMESPACE_ID::BytesValue* add_bytes_field();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BytesValue >&
+      bytes_field() const;
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.RepeatedWellKnownTypes)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any > any_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Api > api_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Duration > duration_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Empty > empty_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FieldMask > field_mask_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::SourceContext > source_context_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Struct > struct_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp > timestamp_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Type > type_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::DoubleValue > double_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FloatValue > float_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int64Value > int64_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt64Value > uint64_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int32Value > int32_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt32Value > uint32_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BoolValue > bool_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::StringValue > string_field_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BytesValue > bytes_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OneofWellKnownTypes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.OneofWellKnownTypes) */ {
+ public:
+  OneofWellKnownTypes();
+  virtual ~OneofWellKnownTypes();
+
+  OneofWellKnownTypes(const OneofWellKnownTypes& from);
+  OneofWellKnownTypes(OneofWellKnownTypes&& from) noexcept
+    : OneofWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline OneofWellKnownTypes& operator=(const OneofWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OneofWellKnownTypes& operator=(OneofWellKnownTypes&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const OneofWellKnownTypes& default_instance();
+
+  enum OneofFieldCase {
+    kAnyField = 1,
+    kApiField = 2,
+    kDurationField = 3,
+    kEmptyField = 4,
+    kFieldMaskField = 5,
+    kSourceContextField = 6,
+    kStructField = 7,
+    kTimestampField = 8,
+    kTypeField = 9,
+    kDoubleField = 10,
+    kFloatField = 11,
+    kInt64Field = 12,
+    kUint64Field = 13,
+    kInt32Field = 14,
+    kUint32Field = 15,
+    kBoolField = 16,
+    kStringField = 17,
+    kBytesField = 18,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const OneofWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const OneofWellKnownTypes*>(
+               &_OneofWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(OneofWellKnownTypes* other);
+  friend void swap(OneofWellKnownTypes& a, OneofWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline OneofWellKnownTypes* New() const final {
+    return CreateMaybeMessage<OneofWellKnownTypes>(nullptr);
+  }
+
+  OneofWellKnownTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<OneofWellKnownTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const OneofWellKnownTypes& from);
+  void MergeFrom(const OneofWellKnownTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OneofWellKnownTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.OneofWellKnownTypes";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.Any any_field = 1;
+  bool has_any_field() const;
+  void clear_any_field();
+  static const int kAnyFieldFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::Any& any_field() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any_field();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any_field();
+  void set_allocated_any_field(PROTOBUF_NAMESPACE_ID::Any* any_field);
+
+  // .google.protobuf.Api api_field = 2;
+  bool has_api_field() const;
+  void clear_api_field();
+  static const int kApiFieldFieldNumber = 2;
+  const PROTOBUF_NAMESPACE_ID::Api& api_field() const;
+  PROTOBUF_NAMESPACE_ID::Api* release_api_field();
+  PROTOBUF_NAMESPACE_ID::Api* mutable_api_field();
+  void set_allocated_api_field(PROTOBUF_NAMESPACE_ID::Api* api_field);
+
+  // .google.protobuf.Duration duration_field = 3;
+  bool has_duration_field() const;
+  void clear_duration_field();
+  static const int kDurationFieldFieldNumber = 3;
+  const PROTOBUF_NAMESPACE_ID::Duration& duration_field() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_duration_field();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration_field();
+  void set_allocated_duration_field(PROTOBUF_NAMESPACE_ID::Duration* duration_field);
+
+  // .google.protobuf.Empty empty_field = 4;
+  bool has_empty_field() const;
+  void clear_empty_field();
+  static const int kEmptyFieldFieldNumber = 4;
+  const PROTOBUF_NAMESPACE_ID::Empty& empty_field() const;
+  PROTOBUF_NAMESPACE_ID::Empty* release_empty_field();
+  PROTOBUF_NAMESPACE_ID::Empty* mutable_empty_field();
+  void set_allocated_empty_field(PROTOBUF_NAMESPACE_ID::Empty* empty_field);
+
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  bool has_field_mask_field() const;
+  void clear_field_mask_field();
+  static const int kFieldMaskFieldFieldNumber = 5;
+  const PROTOBUF_NAMESPACE_ID::FieldMask& field_mask_field() const;
+  PROTOBUF_NAMESPACE_ID::FieldMask* release_field_mask_field();
+  PROTOBUF_NAMESPACE_ID::FieldMask* mutable_field_mask_field();
+  void set_allocated_field_mask_field(PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field);
+
+  // .google.protobuf.SourceContext source_context_field = 6;
+  bool has_source_context_field() const;
+  void clear_source_context_field();
+  static const int kSourceContextFieldFieldNumber = 6;
+  const PROTOBUF_NAMESPACE_ID::SourceContext& source_context_field() const;
+  PROTOBUF_NAMESPACE_ID::SourceContext* release_source_context_field();
+  PROTOBUF_NAMESPACE_ID::SourceContext* mutable_source_context_field();
+  void set_allocated_source_context_field(PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field);
+
+  // .google.protobuf.Struct struct_field = 7;
+  bool has_struct_field() const;
+  void clear_struct_field();
+  static const int kStructFieldFieldNumber = 7;
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_field() const;
+  PROTOBUF_NAMESPACE_ID::Struct* release_struct_field();
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_field();
+  void set_allocated_struct_field(PROTOBUF_NAMESPACE_ID::Struct* struct_field);
+
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  bool has_timestamp_field() const;
+  void clear_timestamp_field();
+  static const int kTimestampFieldFieldNumber = 8;
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp_field() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp_field();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp_field();
+  void set_allocated_timestamp_field(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field);
+
+  // .google.protobuf.Type type_field = 9;
+  bool has_type_field() const;
+  void clear_type_field();
+  static const int kTypeFieldFieldNumber = 9;
+  const PROTOBUF_NAMESPACE_ID::Type& type_field() const;
+  PROTOBUF_NAMESPACE_ID::Type* release_type_field();
+  PROTOBUF_NAMESPACE_ID::Type* mutable_type_field();
+  void set_allocated_type_field(PROTOBUF_NAMESPACE_ID::Type* type_field);
+
+  // .google.protobuf.DoubleValue double_field = 10;
+  bool has_double_field() const;
+  void clear_double_field();
+  static const int kDoubleFieldFieldNumber = 10;
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& double_field() const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* release_double_field();
+  PROTOBUF_NAMESPACE_ID::DoubleValue* mutable_double_field();
+  void set_allocated_double_field(PROTOBUF_NAMESPACE_ID::DoubleValue* double_field);
+
+  // .google.protobuf.FloatValue float_field = 11;
+  bool has_float_field() const;
+  void clear_float_field();
+  static const int kFloatFieldFieldNumber = 11;
+  const PROTOBUF_NAMESPACE_ID::FloatValue& float_field() const;
+  PROTOBUF_NAMESPACE_ID::FloatValue* release_float_field();
+  PROTOBUF_NAMESPACE_ID::FloatValue* mutable_float_field();
+  void set_allocated_float_field(PROTOBUF_NAMESPACE_ID::FloatValue* float_field);
+
+  // .google.protobuf.Int64Value int64_field = 12;
+  bool has_int64_field() const;
+  void clear_int64_field();
+  static const int kInt64FieldFieldNumber = 12;
+  const PROTOBUF_NAMESPACE_ID::Int64Value& int64_field() const;
+  PROTOBUF_NAMESPACE_ID::Int64Value* release_int64_field();
+  PROTOBUF_NAMESPACE_ID::Int64Value* mutable_int64_field();
+  void set_allocated_int64_field(PROTOBUF_NAMESPACE_ID::Int64Value* int64_field);
+
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  bool has_uint64_field() const;
+  void clear_uint64_field();
+  static const int kUint64FieldFieldNumber = 13;
+  const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64_field() const;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* release_uint64_field();
+  PROTOBUF_NAMESPACE_ID::UInt64Value* mutable_uint64_field();
+  void set_allocated_uint64_field(PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field);
+
+  // .google.protobuf.Int32Value int32_field = 14;
+  bool has_int32_field() const;
+  void clear_int32_field();
+  static const int kInt32FieldFieldNumber = 14;
+  const PROTOBUF_NAMESPACE_ID::Int32Value& int32_field() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_int32_field();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_int32_field();
+  void set_allocated_int32_field(PROTOBUF_NAMESPACE_ID::Int32Value* int32_field);
+
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  bool has_uint32_field() const;
+  void clear_uint32_field();
+  static const int kUint32FieldFieldNumber = 15;
+  const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32_field() const;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* release_uint32_field();
+  PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_uint32_field();
+  void set_allocated_uint32_field(PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field);
+
+  // .google.protobuf.BoolValue bool_field = 16;
+  bool has_bool_field() const;
+  void clear_bool_field();
+  static const int kBoolFieldFieldNumber = 16;
+  const PROTOBUF_NAMESPACE_ID::BoolValue& bool_field() const;
+  PROTOBUF_NAMESPACE_ID::BoolValue* release_bool_field();
+  PROTOBUF_NAMESPACE_ID::BoolValue* mutable_bool_field();
+  void set_allocated_bool_field(PROTOBUF_NAMESPACE_ID::BoolValue* bool_field);
+
+  // .google.protobuf.StringValue string_field = 17;
+  bool has_string_field() const;
+  void clear_string_field();
+  static const int kStringFieldFieldNumber = 17;
+  const PROTOBUF_NAMESPACE_ID::StringValue& string_field() const;
+  PROTOBUF_NAMESPACE_ID::StringValue* release_string_field();
+  PROTOBUF_NAMESPACE_ID::StringValue* mutable_string_field();
+  void set_allocated_string_field(PROTOBUF_NAMESPACE_ID::StringValue* string_field);
+
+  // .google.protobuf.BytesValue bytes_field = 18;
+  bool has_bytes_field() const;
+  void clear_bytes_field();
+  static const int kBytesFieldFieldNumber = 18;
+  const PROTOBUF_NAMESPACE_ID::BytesValue& bytes_field() const;
+  PROTOBUF_NAMESPACE_ID::BytesValue* release_bytes_field();
+  PROTOBUF_NAMESPACE_ID::BytesValue* mutable_bytes_field();
+  void set_allocated_bytes_field(PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field);
+
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.OneofWellKnownTypes)
+ private:
+  class HasBitSetters;
+  void set_has_any_field();
+  void set_has_api_field();
+  void set_has_duration_field();
+  void set_has_empty_field();
+  void set_has_field_mask_field();
+  void set_has_source_context_field();
+  void set_has_struct_field();
+  void set_has_timestamp_field();
+  void set_has_type_field();
+  void set_has_double_field();
+  void set_has_float_field();
+  void set_has_int64_field();
+  void set_has_uint64_field();
+  void set_has_int32_field();
+  void set_has_uint32_field();
+  void set_has_bool_field();
+  void set_has_string_field();
+  void set_has_bytes_field();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  union OneofFieldUnion {
+    OneofFieldUnion() {}
+    PROTOBUF_NAMESPACE_ID::Any* any_field_;
+    PROTOBUF_NAMESPACE_ID::Api* api_field_;
+    PROTOBUF_NAMESPACE_ID::Duration* duration_field_;
+    PROTOBUF_NAMESPACE_ID::Empty* empty_field_;
+    PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field_;
+    PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field_;
+    PROTOBUF_NAMESPACE_ID::Struct* struct_field_;
+    PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field_;
+    PROTOBUF_NAMESPACE_ID::Type* type_field_;
+    PROTOBUF_NAMESPACE_ID::DoubleValue* double_field_;
+    PROTOBUF_NAMESPACE_ID::FloatValue* float_field_;
+    PROTOBUF_NAMESPACE_ID::Int64Value* int64_field_;
+    PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field_;
+    PROTOBUF_NAMESPACE_ID::Int32Value* int32_field_;
+    PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field_;
+    PROTOBUF_NAMESPACE_ID::BoolValue* bool_field_;
+    PROTOBUF_NAMESPACE_ID::StringValue* string_field_;
+    PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field_;
+  } oneof_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_AnyFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_AnyFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_AnyFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_AnyFieldEntry_DoNotUse();
+  MapWellKnownTypes_AnyFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_AnyFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_AnyFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_AnyFieldEntry_DoNotUse*>(&_MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_ApiFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_ApiFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_ApiFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_ApiFieldEntry_DoNotUse();
+  MapWellKnownTypes_ApiFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_ApiFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_ApiFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_ApiFieldEntry_DoNotUse*>(&_MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_DurationFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_DurationFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_DurationFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_DurationFieldEntry_DoNotUse();
+  MapWellKnownTypes_DurationFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_DurationFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_DurationFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_DurationFieldEntry_DoNotUse*>(&_MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_EmptyFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_EmptyFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_EmptyFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_EmptyFieldEntry_DoNotUse();
+  MapWellKnownTypes_EmptyFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_EmptyFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_EmptyFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_EmptyFieldEntry_DoNotUse*>(&_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse();
+  MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse*>(&_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_SourceContextFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_SourceContextFieldEntry_DoNotUse();
+  MapWellKnownTypes_SourceContextFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_SourceContextFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_SourceContextFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_SourceContextFieldEntry_DoNotUse*>(&_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_StructFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_StructFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_StructFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_StructFieldEntry_DoNotUse();
+  MapWellKnownTypes_StructFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_StructFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_StructFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_StructFieldEntry_DoNotUse*>(&_MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_TimestampFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_TimestampFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_TimestampFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_TimestampFieldEntry_DoNotUse();
+  MapWellKnownTypes_TimestampFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_TimestampFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_TimestampFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_TimestampFieldEntry_DoNotUse*>(&_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_TypeFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_TypeFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_TypeFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_TypeFieldEntry_DoNotUse();
+  MapWellKnownTypes_TypeFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_TypeFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_TypeFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_TypeFieldEntry_DoNotUse*>(&_MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_DoubleFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_DoubleFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_DoubleFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_DoubleFieldEntry_DoNotUse();
+  MapWellKnownTypes_DoubleFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_DoubleFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_DoubleFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_DoubleFieldEntry_DoNotUse*>(&_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_FloatFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_FloatFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_FloatFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_FloatFieldEntry_DoNotUse();
+  MapWellKnownTypes_FloatFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_FloatFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_FloatFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_FloatFieldEntry_DoNotUse*>(&_MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Int64FieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Int64FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Int64FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_Int64FieldEntry_DoNotUse();
+  MapWellKnownTypes_Int64FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_Int64FieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_Int64FieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_Int64FieldEntry_DoNotUse*>(&_MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Uint64FieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Uint64FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Uint64FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_Uint64FieldEntry_DoNotUse();
+  MapWellKnownTypes_Uint64FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_Uint64FieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_Uint64FieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_Uint64FieldEntry_DoNotUse*>(&_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Int32FieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Int32FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Int32FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_Int32FieldEntry_DoNotUse();
+  MapWellKnownTypes_Int32FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_Int32FieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_Int32FieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_Int32FieldEntry_DoNotUse*>(&_MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_Uint32FieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Uint32FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_Uint32FieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_Uint32FieldEntry_DoNotUse();
+  MapWellKnownTypes_Uint32FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_Uint32FieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_Uint32FieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_Uint32FieldEntry_DoNotUse*>(&_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_BoolFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_BoolFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_BoolFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_BoolFieldEntry_DoNotUse();
+  MapWellKnownTypes_BoolFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_BoolFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_BoolFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_BoolFieldEntry_DoNotUse*>(&_MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_StringFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_StringFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_StringFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_StringFieldEntry_DoNotUse();
+  MapWellKnownTypes_StringFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_StringFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_StringFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_StringFieldEntry_DoNotUse*>(&_MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes_BytesFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_BytesFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapWellKnownTypes_BytesFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapWellKnownTypes_BytesFieldEntry_DoNotUse();
+  MapWellKnownTypes_BytesFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapWellKnownTypes_BytesFieldEntry_DoNotUse& other);
+  static const MapWellKnownTypes_BytesFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapWellKnownTypes_BytesFieldEntry_DoNotUse*>(&_MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapWellKnownTypes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.MapWellKnownTypes) */ {
+ public:
+  MapWellKnownTypes();
+  virtual ~MapWellKnownTypes();
+
+  MapWellKnownTypes(const MapWellKnownTypes& from);
+  MapWellKnownTypes(MapWellKnownTypes&& from) noexcept
+    : MapWellKnownTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline MapWellKnownTypes& operator=(const MapWellKnownTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapWellKnownTypes& operator=(MapWellKnownTypes&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapWellKnownTypes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapWellKnownTypes* internal_default_instance() {
+    return reinterpret_cast<const MapWellKnownTypes*>(
+               &_MapWellKnownTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  void Swap(MapWellKnownTypes* other);
+  friend void swap(MapWellKnownTypes& a, MapWellKnownTypes& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapWellKnownTypes* New() const final {
+    return CreateMaybeMessage<MapWellKnownTypes>(nullptr);
+  }
+
+  MapWellKnownTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapWellKnownTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapWellKnownTypes& from);
+  void MergeFrom(const MapWellKnownTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapWellKnownTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.MapWellKnownTypes";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<int32, .google.protobuf.Any> any_field = 1;
+  int any_field_size() const;
+  void clear_any_field();
+  static const int kAnyFieldFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >&
+      any_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >*
+      mutable_any_field();
+
+  // map<int32, .google.protobuf.Api> api_field = 2;
+  int api_field_size() const;
+  void clear_api_field();
+  static const int kApiFieldFieldNumber = 2;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >&
+      api_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >*
+      mutable_api_field();
+
+  // map<int32, .google.protobuf.Duration> duration_field = 3;
+  int duration_field_size() const;
+  void clear_duration_field();
+  static const int kDurationFieldFieldNumber = 3;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >&
+      duration_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >*
+      mutable_duration_field();
+
+  // map<int32, .google.protobuf.Empty> empty_field = 4;
+  int empty_field_size() const;
+  void clear_empty_field();
+  static const int kEmptyFieldFieldNumber = 4;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >&
+      empty_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >*
+      mutable_empty_field();
+
+  // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+  int field_mask_field_size() const;
+  void clear_field_mask_field();
+  static const int kFieldMaskFieldFieldNumber = 5;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >&
+      field_mask_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >*
+      mutable_field_mask_field();
+
+  // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+  int source_context_field_size() const;
+  void clear_source_context_field();
+  static const int kSourceContextFieldFieldNumber = 6;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >&
+      source_context_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >*
+      mutable_source_context_field();
+
+  // map<int32, .google.protobuf.Struct> struct_field = 7;
+  int struct_field_size() const;
+  void clear_struct_field();
+  static const int kStructFieldFieldNumber = 7;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >&
+      struct_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >*
+      mutable_struct_field();
+
+  // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+  int timestamp_field_size() const;
+  void clear_timestamp_field();
+  static const int kTimestampFieldFieldNumber = 8;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >&
+      timestamp_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >*
+      mutable_timestamp_field();
+
+  // map<int32, .google.protobuf.Type> type_field = 9;
+  int type_field_size() const;
+  void clear_type_field();
+  static const int kTypeFieldFieldNumber = 9;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >&
+      type_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >*
+      mutable_type_field();
+
+  // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+  int double_field_size() const;
+  void clear_double_field();
+  static const int kDoubleFieldFieldNumber = 10;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >&
+      double_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >*
+      mutable_double_field();
+
+  // map<int32, .google.protobuf.FloatValue> float_field = 11;
+  int float_field_size() const;
+  void clear_float_field();
+  static const int kFloatFieldFieldNumber = 11;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >&
+      float_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >*
+      mutable_float_field();
+
+  // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+  int int64_field_size() const;
+  void clear_int64_field();
+  static const int kInt64FieldFieldNumber = 12;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >&
+      int64_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >*
+      mutable_int64_field();
+
+  // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+  int uint64_field_size() const;
+  void clear_uint64_field();
+  static const int kUint64FieldFieldNumber = 13;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >&
+      uint64_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >*
+      mutable_uint64_field();
+
+  // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+  int int32_field_size() const;
+  void clear_int32_field();
+  static const int kInt32FieldFieldNumber = 14;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >&
+      int32_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >*
+      mutable_int32_field();
+
+  // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+  int uint32_field_size() const;
+  void clear_uint32_field();
+  static const int kUint32FieldFieldNumber = 15;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >&
+      uint32_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >*
+      mutable_uint32_field();
+
+  // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+  int bool_field_size() const;
+  void clear_bool_field();
+  static const int kBoolFieldFieldNumber = 16;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >&
+      bool_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >*
+      mutable_bool_field();
+
+  // map<int32, .google.protobuf.StringValue> string_field = 17;
+  int string_field_size() const;
+  void clear_string_field();
+  static const int kStringFieldFieldNumber = 17;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >&
+      string_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >*
+      mutable_string_field();
+
+  // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+  int bytes_field_size() const;
+  void clear_bytes_field();
+  static const int kBytesFieldFieldNumber = 18;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >&
+      bytes_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >*
+      mutable_bytes_field();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.MapWellKnownTypes)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_AnyFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > any_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_ApiFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > api_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_DurationFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > duration_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_EmptyFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > empty_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > field_mask_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_SourceContextFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > source_context_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_StructFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > struct_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_TimestampFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > timestamp_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_TypeFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > type_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_DoubleFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > double_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_FloatFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > float_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_Int64FieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > int64_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_Uint64FieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > uint64_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_Int32FieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > int32_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_Uint32FieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > uint32_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_BoolFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > bool_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_StringFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > string_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapWellKnownTypes_BytesFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > bytes_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TestWellKnownTypes
+
+// .google.protobuf.Any any_field = 1;
+inline bool TestWellKnownTypes::has_any_field() const {
+  return this != internal_default_instance() && any_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& TestWellKnownTypes::any_field() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.any_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* TestWellKnownTypes::release_any_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.any_field)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_field_;
+  any_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* TestWellKnownTypes::mutable_any_field() {
+  
+  if (any_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    any_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.any_field)
+  return any_field_;
+}
+inline void TestWellKnownTypes::set_allocated_any_field(PROTOBUF_NAMESPACE_ID::Any* any_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_field_);
+  }
+  if (any_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_field_ = any_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.any_field)
+}
+
+// .google.protobuf.Api api_field = 2;
+inline bool TestWellKnownTypes::has_api_field() const {
+  return this != internal_default_instance() && api_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Api& TestWellKnownTypes::api_field() const {
+  const PROTOBUF_NAMESPACE_ID::Api* p = api_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.api_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Api*>(
+      &PROTOBUF_NAMESPACE_ID::_Api_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Api* TestWellKnownTypes::release_api_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.api_field)
+  
+  PROTOBUF_NAMESPACE_ID::Api* temp = api_field_;
+  api_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Api* TestWellKnownTypes::mutable_api_field() {
+  
+  if (api_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Api>(GetArenaNoVirtual());
+    api_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.api_field)
+  return api_field_;
+}
+inline void TestWellKnownTypes::set_allocated_api_field(PROTOBUF_NAMESPACE_ID::Api* api_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(api_field_);
+  }
+  if (api_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      api_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, api_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  api_field_ = api_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.api_field)
+}
+
+// .google.protobuf.Duration duration_field = 3;
+inline bool TestWellKnownTypes::has_duration_field() const {
+  return this != internal_default_instance() && duration_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& TestWellKnownTypes::duration_field() const {
+  const PROTOBUF_NAMESPACE_ID::Duration* p = duration_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.duration_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Duration*>(
+      &PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TestWellKnownTypes::release_duration_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.duration_field)
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration_field_;
+  duration_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TestWellKnownTypes::mutable_duration_field() {
+  
+  if (duration_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Duration>(GetArenaNoVirtual());
+    duration_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.duration_field)
+  return duration_field_;
+}
+inline void TestWellKnownTypes::set_allocated_duration_field(PROTOBUF_NAMESPACE_ID::Duration* duration_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_field_);
+  }
+  if (duration_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration_field_ = duration_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.duration_field)
+}
+
+// .google.protobuf.Empty empty_field = 4;
+inline bool TestWellKnownTypes::has_empty_field() const {
+  return this != internal_default_instance() && empty_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Empty& TestWellKnownTypes::empty_field() const {
+  const PROTOBUF_NAMESPACE_ID::Empty* p = empty_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.empty_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Empty*>(
+      &PROTOBUF_NAMESPACE_ID::_Empty_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Empty* TestWellKnownTypes::release_empty_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.empty_field)
+  
+  PROTOBUF_NAMESPACE_ID::Empty* temp = empty_field_;
+  empty_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Empty* TestWellKnownTypes::mutable_empty_field() {
+  
+  if (empty_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Empty>(GetArenaNoVirtual());
+    empty_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.empty_field)
+  return empty_field_;
+}
+inline void TestWellKnownTypes::set_allocated_empty_field(PROTOBUF_NAMESPACE_ID::Empty* empty_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(empty_field_);
+  }
+  if (empty_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(empty_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      empty_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_field_ = empty_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.empty_field)
+}
+
+// .google.protobuf.FieldMask field_mask_field = 5;
+inline bool TestWellKnownTypes::has_field_mask_field() const {
+  return this != internal_default_instance() && field_mask_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::FieldMask& TestWellKnownTypes::field_mask_field() const {
+  const PROTOBUF_NAMESPACE_ID::FieldMask* p = field_mask_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::FieldMask*>(
+      &PROTOBUF_NAMESPACE_ID::_FieldMask_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::FieldMask* TestWellKnownTypes::release_field_mask_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+  
+  PROTOBUF_NAMESPACE_ID::FieldMask* temp = field_mask_field_;
+  field_mask_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::FieldMask* TestWellKnownTypes::mutable_field_mask_field() {
+  
+  if (field_mask_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::FieldMask>(GetArenaNoVirtual());
+    field_mask_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+  return field_mask_field_;
+}
+inline void TestWellKnownTypes::set_allocated_field_mask_field(PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(field_mask_field_);
+  }
+  if (field_mask_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(field_mask_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      field_mask_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, field_mask_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  field_mask_field_ = field_mask_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.field_mask_field)
+}
+
+// .google.protobuf.SourceContext source_context_field = 6;
+inline bool TestWellKnownTypes::has_source_context_field() const {
+  return this != internal_default_instance() && source_context_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::SourceContext& TestWellKnownTypes::source_context_field() const {
+  const PROTOBUF_NAMESPACE_ID::SourceContext* p = source_context_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.source_context_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::SourceContext*>(
+      &PROTOBUF_NAMESPACE_ID::_SourceContext_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::SourceContext* TestWellKnownTypes::release_source_context_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.source_context_field)
+  
+  PROTOBUF_NAMESPACE_ID::SourceContext* temp = source_context_field_;
+  source_context_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::SourceContext* TestWellKnownTypes::mutable_source_context_field() {
+  
+  if (source_context_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::SourceContext>(GetArenaNoVirtual());
+    source_context_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.source_context_field)
+  return source_context_field_;
+}
+inline void TestWellKnownTypes::set_allocated_source_context_field(PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(source_context_field_);
+  }
+  if (source_context_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      source_context_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, source_context_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  source_context_field_ = source_context_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.source_context_field)
+}
+
+// .google.protobuf.Struct struct_field = 7;
+inline bool TestWellKnownTypes::has_struct_field() const {
+  return this != internal_default_instance() && struct_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& TestWellKnownTypes::struct_field() const {
+  const PROTOBUF_NAMESPACE_ID::Struct* p = struct_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.struct_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Struct*>(
+      &PROTOBUF_NAMESPACE_ID::_Struct_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* TestWellKnownTypes::release_struct_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.struct_field)
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct_field_;
+  struct_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* TestWellKnownTypes::mutable_struct_field() {
+  
+  if (struct_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Struct>(GetArenaNoVirtual());
+    struct_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.struct_field)
+  return struct_field_;
+}
+inline void TestWellKnownTypes::set_allocated_struct_field(PROTOBUF_NAMESPACE_ID::Struct* struct_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_field_);
+  }
+  if (struct_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  struct_field_ = struct_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.struct_field)
+}
+
+// .google.protobuf.Timestamp timestamp_field = 8;
+inline bool TestWellKnownTypes::has_timestamp_field() const {
+  return this != internal_default_instance() && timestamp_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TestWellKnownTypes::timestamp_field() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timestamp_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TestWellKnownTypes::release_timestamp_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_field_;
+  timestamp_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TestWellKnownTypes::mutable_timestamp_field() {
+  
+  if (timestamp_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaNoVirtual());
+    timestamp_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+  return timestamp_field_;
+}
+inline void TestWellKnownTypes::set_allocated_timestamp_field(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_field_);
+  }
+  if (timestamp_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      timestamp_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timestamp_field_ = timestamp_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.timestamp_field)
+}
+
+// .google.protobuf.Type type_field = 9;
+inline bool TestWellKnownTypes::has_type_field() const {
+  return this != internal_default_instance() && type_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Type& TestWellKnownTypes::type_field() const {
+  const PROTOBUF_NAMESPACE_ID::Type* p = type_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.type_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Type*>(
+      &PROTOBUF_NAMESPACE_ID::_Type_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Type* TestWellKnownTypes::release_type_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.type_field)
+  
+  PROTOBUF_NAMESPACE_ID::Type* temp = type_field_;
+  type_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Type* TestWellKnownTypes::mutable_type_field() {
+  
+  if (type_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Type>(GetArenaNoVirtual());
+    type_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.type_field)
+  return type_field_;
+}
+inline void TestWellKnownTypes::set_allocated_type_field(PROTOBUF_NAMESPACE_ID::Type* type_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_field_);
+  }
+  if (type_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      type_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, type_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  type_field_ = type_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.type_field)
+}
+
+// .google.protobuf.DoubleValue double_field = 10;
+inline bool TestWellKnownTypes::has_double_field() const {
+  return this != internal_default_instance() && double_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& TestWellKnownTypes::double_field() const {
+  const PROTOBUF_NAMESPACE_ID::DoubleValue* p = double_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.double_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      &PROTOBUF_NAMESPACE_ID::_DoubleValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* TestWellKnownTypes::release_double_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.double_field)
+  
+  PROTOBUF_NAMESPACE_ID::DoubleValue* temp = double_field_;
+  double_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* TestWellKnownTypes::mutable_double_field() {
+  
+  if (double_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::DoubleValue>(GetArenaNoVirtual());
+    double_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.double_field)
+  return double_field_;
+}
+inline void TestWellKnownTypes::set_allocated_double_field(PROTOBUF_NAMESPACE_ID::DoubleValue* double_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(double_field_);
+  }
+  if (double_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(double_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      double_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, double_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  double_field_ = double_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.double_field)
+}
+
+// .google.protobuf.FloatValue float_field = 11;
+inline bool TestWellKnownTypes::has_float_field() const {
+  return this != internal_default_instance() && float_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::FloatValue& TestWellKnownTypes::float_field() const {
+  const PROTOBUF_NAMESPACE_ID::FloatValue* p = float_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.float_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      &PROTOBUF_NAMESPACE_ID::_FloatValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* TestWellKnownTypes::release_float_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.float_field)
+  
+  PROTOBUF_NAMESPACE_ID::FloatValue* temp = float_field_;
+  float_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* TestWellKnownTypes::mutable_float_field() {
+  
+  if (float_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::FloatValue>(GetArenaNoVirtual());
+    float_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.float_field)
+  return float_field_;
+}
+inline void TestWellKnownTypes::set_allocated_float_field(PROTOBUF_NAMESPACE_ID::FloatValue* float_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(float_field_);
+  }
+  if (float_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(float_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      float_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, float_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  float_field_ = float_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.float_field)
+}
+
+// .google.protobuf.Int64Value int64_field = 12;
+inline bool TestWellKnownTypes::has_int64_field() const {
+  return this != internal_default_instance() && int64_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int64Value& TestWellKnownTypes::int64_field() const {
+  const PROTOBUF_NAMESPACE_ID::Int64Value* p = int64_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.int64_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int64Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* TestWellKnownTypes::release_int64_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.int64_field)
+  
+  PROTOBUF_NAMESPACE_ID::Int64Value* temp = int64_field_;
+  int64_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* TestWellKnownTypes::mutable_int64_field() {
+  
+  if (int64_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int64Value>(GetArenaNoVirtual());
+    int64_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.int64_field)
+  return int64_field_;
+}
+inline void TestWellKnownTypes::set_allocated_int64_field(PROTOBUF_NAMESPACE_ID::Int64Value* int64_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(int64_field_);
+  }
+  if (int64_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int64_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      int64_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int64_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int64_field_ = int64_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.int64_field)
+}
+
+// .google.protobuf.UInt64Value uint64_field = 13;
+inline bool TestWellKnownTypes::has_uint64_field() const {
+  return this != internal_default_instance() && uint64_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt64Value& TestWellKnownTypes::uint64_field() const {
+  const PROTOBUF_NAMESPACE_ID::UInt64Value* p = uint64_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.uint64_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      &PROTOBUF_NAMESPACE_ID::_UInt64Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* TestWellKnownTypes::release_uint64_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.uint64_field)
+  
+  PROTOBUF_NAMESPACE_ID::UInt64Value* temp = uint64_field_;
+  uint64_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* TestWellKnownTypes::mutable_uint64_field() {
+  
+  if (uint64_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::UInt64Value>(GetArenaNoVirtual());
+    uint64_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.uint64_field)
+  return uint64_field_;
+}
+inline void TestWellKnownTypes::set_allocated_uint64_field(PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint64_field_);
+  }
+  if (uint64_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint64_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint64_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint64_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint64_field_ = uint64_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.uint64_field)
+}
+
+// .google.protobuf.Int32Value int32_field = 14;
+inline bool TestWellKnownTypes::has_int32_field() const {
+  return this != internal_default_instance() && int32_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& TestWellKnownTypes::int32_field() const {
+  const PROTOBUF_NAMESPACE_ID::Int32Value* p = int32_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.int32_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* TestWellKnownTypes::release_int32_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.int32_field)
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = int32_field_;
+  int32_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* TestWellKnownTypes::mutable_int32_field() {
+  
+  if (int32_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int32Value>(GetArenaNoVirtual());
+    int32_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.int32_field)
+  return int32_field_;
+}
+inline void TestWellKnownTypes::set_allocated_int32_field(PROTOBUF_NAMESPACE_ID::Int32Value* int32_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(int32_field_);
+  }
+  if (int32_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int32_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      int32_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int32_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int32_field_ = int32_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.int32_field)
+}
+
+// .google.protobuf.UInt32Value uint32_field = 15;
+inline bool TestWellKnownTypes::has_uint32_field() const {
+  return this != internal_default_instance() && uint32_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt32Value& TestWellKnownTypes::uint32_field() const {
+  const PROTOBUF_NAMESPACE_ID::UInt32Value* p = uint32_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.uint32_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* TestWellKnownTypes::release_uint32_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.uint32_field)
+  
+  PROTOBUF_NAMESPACE_ID::UInt32Value* temp = uint32_field_;
+  uint32_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* TestWellKnownTypes::mutable_uint32_field() {
+  
+  if (uint32_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaNoVirtual());
+    uint32_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.uint32_field)
+  return uint32_field_;
+}
+inline void TestWellKnownTypes::set_allocated_uint32_field(PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint32_field_);
+  }
+  if (uint32_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint32_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint32_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint32_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint32_field_ = uint32_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.uint32_field)
+}
+
+// .google.protobuf.BoolValue bool_field = 16;
+inline bool TestWellKnownTypes::has_bool_field() const {
+  return this != internal_default_instance() && bool_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::BoolValue& TestWellKnownTypes::bool_field() const {
+  const PROTOBUF_NAMESPACE_ID::BoolValue* p = bool_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.bool_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      &PROTOBUF_NAMESPACE_ID::_BoolValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* TestWellKnownTypes::release_bool_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.bool_field)
+  
+  PROTOBUF_NAMESPACE_ID::BoolValue* temp = bool_field_;
+  bool_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* TestWellKnownTypes::mutable_bool_field() {
+  
+  if (bool_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::BoolValue>(GetArenaNoVirtual());
+    bool_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.bool_field)
+  return bool_field_;
+}
+inline void TestWellKnownTypes::set_allocated_bool_field(PROTOBUF_NAMESPACE_ID::BoolValue* bool_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bool_field_);
+  }
+  if (bool_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bool_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      bool_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bool_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bool_field_ = bool_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.bool_field)
+}
+
+// .google.protobuf.StringValue string_field = 17;
+inline bool TestWellKnownTypes::has_string_field() const {
+  return this != internal_default_instance() && string_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::StringValue& TestWellKnownTypes::string_field() const {
+  const PROTOBUF_NAMESPACE_ID::StringValue* p = string_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.string_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::StringValue*>(
+      &PROTOBUF_NAMESPACE_ID::_StringValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* TestWellKnownTypes::release_string_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.string_field)
+  
+  PROTOBUF_NAMESPACE_ID::StringValue* temp = string_field_;
+  string_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* TestWellKnownTypes::mutable_string_field() {
+  
+  if (string_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::StringValue>(GetArenaNoVirtual());
+    string_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.string_field)
+  return string_field_;
+}
+inline void TestWellKnownTypes::set_allocated_string_field(PROTOBUF_NAMESPACE_ID::StringValue* string_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(string_field_);
+  }
+  if (string_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(string_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      string_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, string_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  string_field_ = string_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.string_field)
+}
+
+// .google.protobuf.BytesValue bytes_field = 18;
+inline bool TestWellKnownTypes::has_bytes_field() const {
+  return this != internal_default_instance() && bytes_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::BytesValue& TestWellKnownTypes::bytes_field() const {
+  const PROTOBUF_NAMESPACE_ID::BytesValue* p = bytes_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.bytes_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      &PROTOBUF_NAMESPACE_ID::_BytesValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* TestWellKnownTypes::release_bytes_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.bytes_field)
+  
+  PROTOBUF_NAMESPACE_ID::BytesValue* temp = bytes_field_;
+  bytes_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* TestWellKnownTypes::mutable_bytes_field() {
+  
+  if (bytes_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::BytesValue>(GetArenaNoVirtual());
+    bytes_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.bytes_field)
+  return bytes_field_;
+}
+inline void TestWellKnownTypes::set_allocated_bytes_field(PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bytes_field_);
+  }
+  if (bytes_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bytes_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      bytes_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bytes_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bytes_field_ = bytes_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.bytes_field)
+}
+
+// .google.protobuf.Value value_field = 19;
+inline bool TestWellKnownTypes::has_value_field() const {
+  return this != internal_default_instance() && value_field_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Value& TestWellKnownTypes::value_field() const {
+  const PROTOBUF_NAMESPACE_ID::Value* p = value_field_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestWellKnownTypes.value_field)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Value* TestWellKnownTypes::release_value_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestWellKnownTypes.value_field)
+  
+  PROTOBUF_NAMESPACE_ID::Value* temp = value_field_;
+  value_field_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Value* TestWellKnownTypes::mutable_value_field() {
+  
+  if (value_field_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Value>(GetArenaNoVirtual());
+    value_field_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestWellKnownTypes.value_field)
+  return value_field_;
+}
+inline void TestWellKnownTypes::set_allocated_value_field(PROTOBUF_NAMESPACE_ID::Value* value_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(value_field_);
+  }
+  if (value_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      value_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value_field, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  value_field_ = value_field;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestWellKnownTypes.value_field)
+}
+
+// -------------------------------------------------------------------
+
+// RepeatedWellKnownTypes
+
+// repeated .google.protobuf.Any any_field = 1;
+inline int RepeatedWellKnownTypes::any_field_size() const {
+  return any_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Any* RepeatedWellKnownTypes::mutable_any_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return any_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >*
+RepeatedWellKnownTypes::mutable_any_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return &any_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& RepeatedWellKnownTypes::any_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return any_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* RepeatedWellKnownTypes::add_any_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return any_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >&
+RepeatedWellKnownTypes::any_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.any_field)
+  return any_field_;
+}
+
+// repeated .google.protobuf.Api api_field = 2;
+inline int RepeatedWellKnownTypes::api_field_size() const {
+  return api_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Api* RepeatedWellKnownTypes::mutable_api_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return api_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Api >*
+RepeatedWellKnownTypes::mutable_api_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return &api_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Api& RepeatedWellKnownTypes::api_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return api_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Api* RepeatedWellKnownTypes::add_api_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return api_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Api >&
+RepeatedWellKnownTypes::api_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.api_field)
+  return api_field_;
+}
+
+// repeated .google.protobuf.Duration duration_field = 3;
+inline int RepeatedWellKnownTypes::duration_field_size() const {
+  return duration_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* RepeatedWellKnownTypes::mutable_duration_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return duration_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Duration >*
+RepeatedWellKnownTypes::mutable_duration_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return &duration_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& RepeatedWellKnownTypes::duration_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return duration_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* RepeatedWellKnownTypes::add_duration_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return duration_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Duration >&
+RepeatedWellKnownTypes::duration_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.duration_field)
+  return duration_field_;
+}
+
+// repeated .google.protobuf.Empty empty_field = 4;
+inline int RepeatedWellKnownTypes::empty_field_size() const {
+  return empty_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Empty* RepeatedWellKnownTypes::mutable_empty_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return empty_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Empty >*
+RepeatedWellKnownTypes::mutable_empty_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return &empty_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Empty& RepeatedWellKnownTypes::empty_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return empty_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Empty* RepeatedWellKnownTypes::add_empty_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return empty_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Empty >&
+RepeatedWellKnownTypes::empty_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.empty_field)
+  return empty_field_;
+}
+
+// repeated .google.protobuf.FieldMask field_mask_field = 5;
+inline int RepeatedWellKnownTypes::field_mask_field_size() const {
+  return field_mask_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::FieldMask* RepeatedWellKnownTypes::mutable_field_mask_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return field_mask_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FieldMask >*
+RepeatedWellKnownTypes::mutable_field_mask_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return &field_mask_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::FieldMask& RepeatedWellKnownTypes::field_mask_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return field_mask_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::FieldMask* RepeatedWellKnownTypes::add_field_mask_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return field_mask_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FieldMask >&
+RepeatedWellKnownTypes::field_mask_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.field_mask_field)
+  return field_mask_field_;
+}
+
+// repeated .google.protobuf.SourceContext source_context_field = 6;
+inline int RepeatedWellKnownTypes::source_context_field_size() const {
+  return source_context_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::SourceContext* RepeatedWellKnownTypes::mutable_source_context_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return source_context_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::SourceContext >*
+RepeatedWellKnownTypes::mutable_source_context_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return &source_context_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::SourceContext& RepeatedWellKnownTypes::source_context_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return source_context_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::SourceContext* RepeatedWellKnownTypes::add_source_context_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return source_context_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::SourceContext >&
+RepeatedWellKnownTypes::source_context_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.source_context_field)
+  return source_context_field_;
+}
+
+// repeated .google.protobuf.Struct struct_field = 7;
+inline int RepeatedWellKnownTypes::struct_field_size() const {
+  return struct_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* RepeatedWellKnownTypes::mutable_struct_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return struct_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Struct >*
+RepeatedWellKnownTypes::mutable_struct_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return &struct_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& RepeatedWellKnownTypes::struct_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return struct_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* RepeatedWellKnownTypes::add_struct_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return struct_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Struct >&
+RepeatedWellKnownTypes::struct_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.struct_field)
+  return struct_field_;
+}
+
+// repeated .google.protobuf.Timestamp timestamp_field = 8;
+inline int RepeatedWellKnownTypes::timestamp_field_size() const {
+  return timestamp_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* RepeatedWellKnownTypes::mutable_timestamp_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return timestamp_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >*
+RepeatedWellKnownTypes::mutable_timestamp_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return &timestamp_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& RepeatedWellKnownTypes::timestamp_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return timestamp_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* RepeatedWellKnownTypes::add_timestamp_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return timestamp_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >&
+RepeatedWellKnownTypes::timestamp_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.timestamp_field)
+  return timestamp_field_;
+}
+
+// repeated .google.protobuf.Type type_field = 9;
+inline int RepeatedWellKnownTypes::type_field_size() const {
+  return type_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Type* RepeatedWellKnownTypes::mutable_type_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return type_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Type >*
+RepeatedWellKnownTypes::mutable_type_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return &type_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Type& RepeatedWellKnownTypes::type_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return type_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Type* RepeatedWellKnownTypes::add_type_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return type_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Type >&
+RepeatedWellKnownTypes::type_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.type_field)
+  return type_field_;
+}
+
+// repeated .google.protobuf.DoubleValue double_field = 10;
+inline int RepeatedWellKnownTypes::double_field_size() const {
+  return double_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* RepeatedWellKnownTypes::mutable_double_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return double_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::DoubleValue >*
+RepeatedWellKnownTypes::mutable_double_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return &double_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& RepeatedWellKnownTypes::double_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return double_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* RepeatedWellKnownTypes::add_double_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return double_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::DoubleValue >&
+RepeatedWellKnownTypes::double_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.double_field)
+  return double_field_;
+}
+
+// repeated .google.protobuf.FloatValue float_field = 11;
+inline int RepeatedWellKnownTypes::float_field_size() const {
+  return float_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* RepeatedWellKnownTypes::mutable_float_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return float_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FloatValue >*
+RepeatedWellKnownTypes::mutable_float_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return &float_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::FloatValue& RepeatedWellKnownTypes::float_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return float_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* RepeatedWellKnownTypes::add_float_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return float_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::FloatValue >&
+RepeatedWellKnownTypes::float_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.float_field)
+  return float_field_;
+}
+
+// repeated .google.protobuf.Int64Value int64_field = 12;
+inline int RepeatedWellKnownTypes::int64_field_size() const {
+  return int64_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* RepeatedWellKnownTypes::mutable_int64_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return int64_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int64Value >*
+RepeatedWellKnownTypes::mutable_int64_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return &int64_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int64Value& RepeatedWellKnownTypes::int64_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return int64_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* RepeatedWellKnownTypes::add_int64_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return int64_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int64Value >&
+RepeatedWellKnownTypes::int64_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.int64_field)
+  return int64_field_;
+}
+
+// repeated .google.protobuf.UInt64Value uint64_field = 13;
+inline int RepeatedWellKnownTypes::uint64_field_size() const {
+  return uint64_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* RepeatedWellKnownTypes::mutable_uint64_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return uint64_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt64Value >*
+RepeatedWellKnownTypes::mutable_uint64_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return &uint64_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt64Value& RepeatedWellKnownTypes::uint64_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return uint64_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* RepeatedWellKnownTypes::add_uint64_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return uint64_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt64Value >&
+RepeatedWellKnownTypes::uint64_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.uint64_field)
+  return uint64_field_;
+}
+
+// repeated .google.protobuf.Int32Value int32_field = 14;
+inline int RepeatedWellKnownTypes::int32_field_size() const {
+  return int32_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* RepeatedWellKnownTypes::mutable_int32_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return int32_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int32Value >*
+RepeatedWellKnownTypes::mutable_int32_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return &int32_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& RepeatedWellKnownTypes::int32_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return int32_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* RepeatedWellKnownTypes::add_int32_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return int32_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Int32Value >&
+RepeatedWellKnownTypes::int32_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.int32_field)
+  return int32_field_;
+}
+
+// repeated .google.protobuf.UInt32Value uint32_field = 15;
+inline int RepeatedWellKnownTypes::uint32_field_size() const {
+  return uint32_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* RepeatedWellKnownTypes::mutable_uint32_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return uint32_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt32Value >*
+RepeatedWellKnownTypes::mutable_uint32_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return &uint32_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt32Value& RepeatedWellKnownTypes::uint32_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return uint32_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* RepeatedWellKnownTypes::add_uint32_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return uint32_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::UInt32Value >&
+RepeatedWellKnownTypes::uint32_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.uint32_field)
+  return uint32_field_;
+}
+
+// repeated .google.protobuf.BoolValue bool_field = 16;
+inline int RepeatedWellKnownTypes::bool_field_size() const {
+  return bool_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* RepeatedWellKnownTypes::mutable_bool_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return bool_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BoolValue >*
+RepeatedWellKnownTypes::mutable_bool_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return &bool_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::BoolValue& RepeatedWellKnownTypes::bool_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return bool_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* RepeatedWellKnownTypes::add_bool_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return bool_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BoolValue >&
+RepeatedWellKnownTypes::bool_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.bool_field)
+  return bool_field_;
+}
+
+// repeated .google.protobuf.StringValue string_field = 17;
+inline int RepeatedWellKnownTypes::string_field_size() const {
+  return string_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* RepeatedWellKnownTypes::mutable_string_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return string_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::StringValue >*
+RepeatedWellKnownTypes::mutable_string_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return &string_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::StringValue& RepeatedWellKnownTypes::string_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return string_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* RepeatedWellKnownTypes::add_string_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return string_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::StringValue >&
+RepeatedWellKnownTypes::string_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.string_field)
+  return string_field_;
+}
+
+// repeated .google.protobuf.BytesValue bytes_field = 18;
+inline int RepeatedWellKnownTypes::bytes_field_size() const {
+  return bytes_field_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* RepeatedWellKnownTypes::mutable_bytes_field(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return bytes_field_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BytesValue >*
+RepeatedWellKnownTypes::mutable_bytes_field() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return &bytes_field_;
+}
+inline const PROTOBUF_NAMESPACE_ID::BytesValue& RepeatedWellKnownTypes::bytes_field(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return bytes_field_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* RepeatedWellKnownTypes::add_bytes_field() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return bytes_field_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::BytesValue >&
+RepeatedWellKnownTypes::bytes_field() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.RepeatedWellKnownTypes.bytes_field)
+  return bytes_field_;
+}
+
+// -------------------------------------------------------------------
+
+// OneofWellKnownTypes
+
+// .google.protobuf.Any any_field = 1;
+inline bool OneofWellKnownTypes::has_any_field() const {
+  return oneof_field_case() == kAnyField;
+}
+inline void OneofWellKnownTypes::set_has_any_field() {
+  _oneof_case_[0] = kAnyField;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* OneofWellKnownTypes::release_any_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.any_field)
+  if (has_any_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Any* temp = oneof_field_.any_field_;
+    oneof_field_.any_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& OneofWellKnownTypes::any_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.any_field)
+  return has_any_field()
+      ? *oneof_field_.any_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Any*>(&PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* OneofWellKnownTypes::mutable_any_field() {
+  if (!has_any_field()) {
+    clear_oneof_field();
+    set_has_any_field();
+    oneof_field_.any_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Any >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.any_field)
+  return oneof_field_.any_field_;
+}
+
+// .google.protobuf.Api api_field = 2;
+inline bool OneofWellKnownTypes::has_api_field() const {
+  return oneof_field_case() == kApiField;
+}
+inline void OneofWellKnownTypes::set_has_api_field() {
+  _oneof_case_[0] = kApiField;
+}
+inline PROTOBUF_NAMESPACE_ID::Api* OneofWellKnownTypes::release_api_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.api_field)
+  if (has_api_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Api* temp = oneof_field_.api_field_;
+    oneof_field_.api_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Api& OneofWellKnownTypes::api_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.api_field)
+  return has_api_field()
+      ? *oneof_field_.api_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Api*>(&PROTOBUF_NAMESPACE_ID::_Api_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Api* OneofWellKnownTypes::mutable_api_field() {
+  if (!has_api_field()) {
+    clear_oneof_field();
+    set_has_api_field();
+    oneof_field_.api_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Api >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.api_field)
+  return oneof_field_.api_field_;
+}
+
+// .google.protobuf.Duration duration_field = 3;
+inline bool OneofWellKnownTypes::has_duration_field() const {
+  return oneof_field_case() == kDurationField;
+}
+inline void OneofWellKnownTypes::set_has_duration_field() {
+  _oneof_case_[0] = kDurationField;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* OneofWellKnownTypes::release_duration_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  if (has_duration_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Duration* temp = oneof_field_.duration_field_;
+    oneof_field_.duration_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& OneofWellKnownTypes::duration_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  return has_duration_field()
+      ? *oneof_field_.duration_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Duration*>(&PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* OneofWellKnownTypes::mutable_duration_field() {
+  if (!has_duration_field()) {
+    clear_oneof_field();
+    set_has_duration_field();
+    oneof_field_.duration_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Duration >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.duration_field)
+  return oneof_field_.duration_field_;
+}
+
+// .google.protobuf.Empty empty_field = 4;
+inline bool OneofWellKnownTypes::has_empty_field() const {
+  return oneof_field_case() == kEmptyField;
+}
+inline void OneofWellKnownTypes::set_has_empty_field() {
+  _oneof_case_[0] = kEmptyField;
+}
+inline PROTOBUF_NAMESPACE_ID::Empty* OneofWellKnownTypes::release_empty_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  if (has_empty_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Empty* temp = oneof_field_.empty_field_;
+    oneof_field_.empty_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Empty& OneofWellKnownTypes::empty_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  return has_empty_field()
+      ? *oneof_field_.empty_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Empty*>(&PROTOBUF_NAMESPACE_ID::_Empty_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Empty* OneofWellKnownTypes::mutable_empty_field() {
+  if (!has_empty_field()) {
+    clear_oneof_field();
+    set_has_empty_field();
+    oneof_field_.empty_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Empty >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.empty_field)
+  return oneof_field_.empty_field_;
+}
+
+// .google.protobuf.FieldMask field_mask_field = 5;
+inline bool OneofWellKnownTypes::has_field_mask_field() const {
+  return oneof_field_case() == kFieldMaskField;
+}
+inline void OneofWellKnownTypes::set_has_field_mask_field() {
+  _oneof_case_[0] = kFieldMaskField;
+}
+inline PROTOBUF_NAMESPACE_ID::FieldMask* OneofWellKnownTypes::release_field_mask_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  if (has_field_mask_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::FieldMask* temp = oneof_field_.field_mask_field_;
+    oneof_field_.field_mask_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::FieldMask& OneofWellKnownTypes::field_mask_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  return has_field_mask_field()
+      ? *oneof_field_.field_mask_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::FieldMask*>(&PROTOBUF_NAMESPACE_ID::_FieldMask_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::FieldMask* OneofWellKnownTypes::mutable_field_mask_field() {
+  if (!has_field_mask_field()) {
+    clear_oneof_field();
+    set_has_field_mask_field();
+    oneof_field_.field_mask_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::FieldMask >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+  return oneof_field_.field_mask_field_;
+}
+
+// .google.protobuf.SourceContext source_context_field = 6;
+inline bool OneofWellKnownTypes::has_source_context_field() const {
+  return oneof_field_case() == kSourceContextField;
+}
+inline void OneofWellKnownTypes::set_has_source_context_field() {
+  _oneof_case_[0] = kSourceContextField;
+}
+inline PROTOBUF_NAMESPACE_ID::SourceContext* OneofWellKnownTypes::release_source_context_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  if (has_source_context_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::SourceContext* temp = oneof_field_.source_context_field_;
+    oneof_field_.source_context_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::SourceContext& OneofWellKnownTypes::source_context_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  return has_source_context_field()
+      ? *oneof_field_.source_context_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::SourceContext*>(&PROTOBUF_NAMESPACE_ID::_SourceContext_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::SourceContext* OneofWellKnownTypes::mutable_source_context_field() {
+  if (!has_source_context_field()) {
+    clear_oneof_field();
+    set_has_source_context_field();
+    oneof_field_.source_context_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::SourceContext >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+  return oneof_field_.source_context_field_;
+}
+
+// .google.protobuf.Struct struct_field = 7;
+inline bool OneofWellKnownTypes::has_struct_field() const {
+  return oneof_field_case() == kStructField;
+}
+inline void OneofWellKnownTypes::set_has_struct_field() {
+  _oneof_case_[0] = kStructField;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* OneofWellKnownTypes::release_struct_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  if (has_struct_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Struct* temp = oneof_field_.struct_field_;
+    oneof_field_.struct_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& OneofWellKnownTypes::struct_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  return has_struct_field()
+      ? *oneof_field_.struct_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Struct*>(&PROTOBUF_NAMESPACE_ID::_Struct_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* OneofWellKnownTypes::mutable_struct_field() {
+  if (!has_struct_field()) {
+    clear_oneof_field();
+    set_has_struct_field();
+    oneof_field_.struct_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Struct >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.struct_field)
+  return oneof_field_.struct_field_;
+}
+
+// .google.protobuf.Timestamp timestamp_field = 8;
+inline bool OneofWellKnownTypes::has_timestamp_field() const {
+  return oneof_field_case() == kTimestampField;
+}
+inline void OneofWellKnownTypes::set_has_timestamp_field() {
+  _oneof_case_[0] = kTimestampField;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* OneofWellKnownTypes::release_timestamp_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  if (has_timestamp_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Timestamp* temp = oneof_field_.timestamp_field_;
+    oneof_field_.timestamp_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& OneofWellKnownTypes::timestamp_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  return has_timestamp_field()
+      ? *oneof_field_.timestamp_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(&PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* OneofWellKnownTypes::mutable_timestamp_field() {
+  if (!has_timestamp_field()) {
+    clear_oneof_field();
+    set_has_timestamp_field();
+    oneof_field_.timestamp_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Timestamp >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+  return oneof_field_.timestamp_field_;
+}
+
+// .google.protobuf.Type type_field = 9;
+inline bool OneofWellKnownTypes::has_type_field() const {
+  return oneof_field_case() == kTypeField;
+}
+inline void OneofWellKnownTypes::set_has_type_field() {
+  _oneof_case_[0] = kTypeField;
+}
+inline PROTOBUF_NAMESPACE_ID::Type* OneofWellKnownTypes::release_type_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.type_field)
+  if (has_type_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Type* temp = oneof_field_.type_field_;
+    oneof_field_.type_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Type& OneofWellKnownTypes::type_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.type_field)
+  return has_type_field()
+      ? *oneof_field_.type_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Type*>(&PROTOBUF_NAMESPACE_ID::_Type_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Type* OneofWellKnownTypes::mutable_type_field() {
+  if (!has_type_field()) {
+    clear_oneof_field();
+    set_has_type_field();
+    oneof_field_.type_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Type >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.type_field)
+  return oneof_field_.type_field_;
+}
+
+// .google.protobuf.DoubleValue double_field = 10;
+inline bool OneofWellKnownTypes::has_double_field() const {
+  return oneof_field_case() == kDoubleField;
+}
+inline void OneofWellKnownTypes::set_has_double_field() {
+  _oneof_case_[0] = kDoubleField;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* OneofWellKnownTypes::release_double_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.double_field)
+  if (has_double_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::DoubleValue* temp = oneof_field_.double_field_;
+    oneof_field_.double_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& OneofWellKnownTypes::double_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.double_field)
+  return has_double_field()
+      ? *oneof_field_.double_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(&PROTOBUF_NAMESPACE_ID::_DoubleValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* OneofWellKnownTypes::mutable_double_field() {
+  if (!has_double_field()) {
+    clear_oneof_field();
+    set_has_double_field();
+    oneof_field_.double_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::DoubleValue >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.double_field)
+  return oneof_field_.double_field_;
+}
+
+// .google.protobuf.FloatValue float_field = 11;
+inline bool OneofWellKnownTypes::has_float_field() const {
+  return oneof_field_case() == kFloatField;
+}
+inline void OneofWellKnownTypes::set_has_float_field() {
+  _oneof_case_[0] = kFloatField;
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* OneofWellKnownTypes::release_float_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.float_field)
+  if (has_float_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::FloatValue* temp = oneof_field_.float_field_;
+    oneof_field_.float_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::FloatValue& OneofWellKnownTypes::float_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.float_field)
+  return has_float_field()
+      ? *oneof_field_.float_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(&PROTOBUF_NAMESPACE_ID::_FloatValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* OneofWellKnownTypes::mutable_float_field() {
+  if (!has_float_field()) {
+    clear_oneof_field();
+    set_has_float_field();
+    oneof_field_.float_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::FloatValue >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.float_field)
+  return oneof_field_.float_field_;
+}
+
+// .google.protobuf.Int64Value int64_field = 12;
+inline bool OneofWellKnownTypes::has_int64_field() const {
+  return oneof_field_case() == kInt64Field;
+}
+inline void OneofWellKnownTypes::set_has_int64_field() {
+  _oneof_case_[0] = kInt64Field;
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* OneofWellKnownTypes::release_int64_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  if (has_int64_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Int64Value* temp = oneof_field_.int64_field_;
+    oneof_field_.int64_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Int64Value& OneofWellKnownTypes::int64_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  return has_int64_field()
+      ? *oneof_field_.int64_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Int64Value*>(&PROTOBUF_NAMESPACE_ID::_Int64Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* OneofWellKnownTypes::mutable_int64_field() {
+  if (!has_int64_field()) {
+    clear_oneof_field();
+    set_has_int64_field();
+    oneof_field_.int64_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Int64Value >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.int64_field)
+  return oneof_field_.int64_field_;
+}
+
+// .google.protobuf.UInt64Value uint64_field = 13;
+inline bool OneofWellKnownTypes::has_uint64_field() const {
+  return oneof_field_case() == kUint64Field;
+}
+inline void OneofWellKnownTypes::set_has_uint64_field() {
+  _oneof_case_[0] = kUint64Field;
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* OneofWellKnownTypes::release_uint64_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  if (has_uint64_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::UInt64Value* temp = oneof_field_.uint64_field_;
+    oneof_field_.uint64_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt64Value& OneofWellKnownTypes::uint64_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  return has_uint64_field()
+      ? *oneof_field_.uint64_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::UInt64Value*>(&PROTOBUF_NAMESPACE_ID::_UInt64Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* OneofWellKnownTypes::mutable_uint64_field() {
+  if (!has_uint64_field()) {
+    clear_oneof_field();
+    set_has_uint64_field();
+    oneof_field_.uint64_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::UInt64Value >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+  return oneof_field_.uint64_field_;
+}
+
+// .google.protobuf.Int32Value int32_field = 14;
+inline bool OneofWellKnownTypes::has_int32_field() const {
+  return oneof_field_case() == kInt32Field;
+}
+inline void OneofWellKnownTypes::set_has_int32_field() {
+  _oneof_case_[0] = kInt32Field;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* OneofWellKnownTypes::release_int32_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  if (has_int32_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::Int32Value* temp = oneof_field_.int32_field_;
+    oneof_field_.int32_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& OneofWellKnownTypes::int32_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  return has_int32_field()
+      ? *oneof_field_.int32_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(&PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* OneofWellKnownTypes::mutable_int32_field() {
+  if (!has_int32_field()) {
+    clear_oneof_field();
+    set_has_int32_field();
+    oneof_field_.int32_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::Int32Value >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.int32_field)
+  return oneof_field_.int32_field_;
+}
+
+// .google.protobuf.UInt32Value uint32_field = 15;
+inline bool OneofWellKnownTypes::has_uint32_field() const {
+  return oneof_field_case() == kUint32Field;
+}
+inline void OneofWellKnownTypes::set_has_uint32_field() {
+  _oneof_case_[0] = kUint32Field;
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* OneofWellKnownTypes::release_uint32_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  if (has_uint32_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::UInt32Value* temp = oneof_field_.uint32_field_;
+    oneof_field_.uint32_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt32Value& OneofWellKnownTypes::uint32_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  return has_uint32_field()
+      ? *oneof_field_.uint32_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(&PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* OneofWellKnownTypes::mutable_uint32_field() {
+  if (!has_uint32_field()) {
+    clear_oneof_field();
+    set_has_uint32_field();
+    oneof_field_.uint32_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::UInt32Value >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+  return oneof_field_.uint32_field_;
+}
+
+// .google.protobuf.BoolValue bool_field = 16;
+inline bool OneofWellKnownTypes::has_bool_field() const {
+  return oneof_field_case() == kBoolField;
+}
+inline void OneofWellKnownTypes::set_has_bool_field() {
+  _oneof_case_[0] = kBoolField;
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* OneofWellKnownTypes::release_bool_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  if (has_bool_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::BoolValue* temp = oneof_field_.bool_field_;
+    oneof_field_.bool_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::BoolValue& OneofWellKnownTypes::bool_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  return has_bool_field()
+      ? *oneof_field_.bool_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::BoolValue*>(&PROTOBUF_NAMESPACE_ID::_BoolValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* OneofWellKnownTypes::mutable_bool_field() {
+  if (!has_bool_field()) {
+    clear_oneof_field();
+    set_has_bool_field();
+    oneof_field_.bool_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::BoolValue >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.bool_field)
+  return oneof_field_.bool_field_;
+}
+
+// .google.protobuf.StringValue string_field = 17;
+inline bool OneofWellKnownTypes::has_string_field() const {
+  return oneof_field_case() == kStringField;
+}
+inline void OneofWellKnownTypes::set_has_string_field() {
+  _oneof_case_[0] = kStringField;
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* OneofWellKnownTypes::release_string_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.string_field)
+  if (has_string_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::StringValue* temp = oneof_field_.string_field_;
+    oneof_field_.string_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::StringValue& OneofWellKnownTypes::string_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.string_field)
+  return has_string_field()
+      ? *oneof_field_.string_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::StringValue*>(&PROTOBUF_NAMESPACE_ID::_StringValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* OneofWellKnownTypes::mutable_string_field() {
+  if (!has_string_field()) {
+    clear_oneof_field();
+    set_has_string_field();
+    oneof_field_.string_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::StringValue >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.string_field)
+  return oneof_field_.string_field_;
+}
+
+// .google.protobuf.BytesValue bytes_field = 18;
+inline bool OneofWellKnownTypes::has_bytes_field() const {
+  return oneof_field_case() == kBytesField;
+}
+inline void OneofWellKnownTypes::set_has_bytes_field() {
+  _oneof_case_[0] = kBytesField;
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* OneofWellKnownTypes::release_bytes_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  if (has_bytes_field()) {
+    clear_has_oneof_field();
+      PROTOBUF_NAMESPACE_ID::BytesValue* temp = oneof_field_.bytes_field_;
+    oneof_field_.bytes_field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const PROTOBUF_NAMESPACE_ID::BytesValue& OneofWellKnownTypes::bytes_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  return has_bytes_field()
+      ? *oneof_field_.bytes_field_
+      : *reinterpret_cast< PROTOBUF_NAMESPACE_ID::BytesValue*>(&PROTOBUF_NAMESPACE_ID::_BytesValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* OneofWellKnownTypes::mutable_bytes_field() {
+  if (!has_bytes_field()) {
+    clear_oneof_field();
+    set_has_bytes_field();
+    oneof_field_.bytes_field_ = CreateMaybeMessage< PROTOBUF_NAMESPACE_ID::BytesValue >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+  return oneof_field_.bytes_field_;
+}
+
+inline bool OneofWellKnownTypes::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void OneofWellKnownTypes::clear_has_oneof_field() {
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline OneofWellKnownTypes::OneofFieldCase OneofWellKnownTypes::oneof_field_case() const {
+  return OneofWellKnownTypes::OneofFieldCase(_oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapWellKnownTypes
+
+// map<int32, .google.protobuf.Any> any_field = 1;
+inline int MapWellKnownTypes::any_field_size() const {
+  return any_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >&
+MapWellKnownTypes::any_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.any_field)
+  return any_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >*
+MapWellKnownTypes::mutable_any_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.any_field)
+  return any_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Api> api_field = 2;
+inline int MapWellKnownTypes::api_field_size() const {
+  return api_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >&
+MapWellKnownTypes::api_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.api_field)
+  return api_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >*
+MapWellKnownTypes::mutable_api_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.api_field)
+  return api_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Duration> duration_field = 3;
+inline int MapWellKnownTypes::duration_field_size() const {
+  return duration_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >&
+MapWellKnownTypes::duration_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.duration_field)
+  return duration_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >*
+MapWellKnownTypes::mutable_duration_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.duration_field)
+  return duration_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Empty> empty_field = 4;
+inline int MapWellKnownTypes::empty_field_size() const {
+  return empty_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >&
+MapWellKnownTypes::empty_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.empty_field)
+  return empty_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >*
+MapWellKnownTypes::mutable_empty_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.empty_field)
+  return empty_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+inline int MapWellKnownTypes::field_mask_field_size() const {
+  return field_mask_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >&
+MapWellKnownTypes::field_mask_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.field_mask_field)
+  return field_mask_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >*
+MapWellKnownTypes::mutable_field_mask_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.field_mask_field)
+  return field_mask_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+inline int MapWellKnownTypes::source_context_field_size() const {
+  return source_context_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >&
+MapWellKnownTypes::source_context_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.source_context_field)
+  return source_context_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >*
+MapWellKnownTypes::mutable_source_context_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.source_context_field)
+  return source_context_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Struct> struct_field = 7;
+inline int MapWellKnownTypes::struct_field_size() const {
+  return struct_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >&
+MapWellKnownTypes::struct_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.struct_field)
+  return struct_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >*
+MapWellKnownTypes::mutable_struct_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.struct_field)
+  return struct_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+inline int MapWellKnownTypes::timestamp_field_size() const {
+  return timestamp_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >&
+MapWellKnownTypes::timestamp_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.timestamp_field)
+  return timestamp_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >*
+MapWellKnownTypes::mutable_timestamp_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.timestamp_field)
+  return timestamp_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Type> type_field = 9;
+inline int MapWellKnownTypes::type_field_size() const {
+  return type_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >&
+MapWellKnownTypes::type_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.type_field)
+  return type_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >*
+MapWellKnownTypes::mutable_type_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.type_field)
+  return type_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.DoubleValue> double_field = 10;
+inline int MapWellKnownTypes::double_field_size() const {
+  return double_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >&
+MapWellKnownTypes::double_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.double_field)
+  return double_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >*
+MapWellKnownTypes::mutable_double_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.double_field)
+  return double_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.FloatValue> float_field = 11;
+inline int MapWellKnownTypes::float_field_size() const {
+  return float_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >&
+MapWellKnownTypes::float_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.float_field)
+  return float_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >*
+MapWellKnownTypes::mutable_float_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.float_field)
+  return float_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Int64Value> int64_field = 12;
+inline int MapWellKnownTypes::int64_field_size() const {
+  return int64_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >&
+MapWellKnownTypes::int64_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.int64_field)
+  return int64_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >*
+MapWellKnownTypes::mutable_int64_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.int64_field)
+  return int64_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+inline int MapWellKnownTypes::uint64_field_size() const {
+  return uint64_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >&
+MapWellKnownTypes::uint64_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.uint64_field)
+  return uint64_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >*
+MapWellKnownTypes::mutable_uint64_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.uint64_field)
+  return uint64_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.Int32Value> int32_field = 14;
+inline int MapWellKnownTypes::int32_field_size() const {
+  return int32_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >&
+MapWellKnownTypes::int32_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.int32_field)
+  return int32_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >*
+MapWellKnownTypes::mutable_int32_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.int32_field)
+  return int32_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+inline int MapWellKnownTypes::uint32_field_size() const {
+  return uint32_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >&
+MapWellKnownTypes::uint32_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.uint32_field)
+  return uint32_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >*
+MapWellKnownTypes::mutable_uint32_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.uint32_field)
+  return uint32_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.BoolValue> bool_field = 16;
+inline int MapWellKnownTypes::bool_field_size() const {
+  return bool_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >&
+MapWellKnownTypes::bool_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.bool_field)
+  return bool_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >*
+MapWellKnownTypes::mutable_bool_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.bool_field)
+  return bool_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.StringValue> string_field = 17;
+inline int MapWellKnownTypes::string_field_size() const {
+  return string_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >&
+MapWellKnownTypes::string_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.string_field)
+  return string_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >*
+MapWellKnownTypes::mutable_string_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.string_field)
+  return string_field_.MutableMap();
+}
+
+// map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+inline int MapWellKnownTypes::bytes_field_size() const {
+  return bytes_field_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >&
+MapWellKnownTypes::bytes_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MapWellKnownTypes.bytes_field)
+  return bytes_field_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >*
+MapWellKnownTypes::mutable_bytes_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MapWellKnownTypes.bytes_field)
+  return bytes_field_.MutableMap();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto
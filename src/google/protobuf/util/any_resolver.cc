@@ -0,0 +1,171 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/any_resolver.h>
+
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+
+namespace {
+
+const int kInitialTableCapacity = 16;
+
+}  // namespace
+
+AnyResolver::Table::Table(int capacity)
+    : mask(capacity - 1), slots(new std::atomic<const Entry*>[capacity]) {
+  for (int i = 0; i < capacity; i++) {
+    slots[i].store(NULL, std::memory_order_relaxed);
+  }
+}
+
+const AnyResolver::Entry* AnyResolver::Table::Find(
+    StringPiece type_url) const {
+  for (size_t i = hash<StringPiece>()(type_url) & mask;; i = (i + 1) & mask) {
+    const Entry* entry = slots[i].load(std::memory_order_acquire);
+    if (entry == NULL || entry->type_url == type_url) {
+      return entry;
+    }
+  }
+}
+
+void AnyResolver::Table::Insert(const Entry* entry) {
+  size_t i = hash<StringPiece>()(entry->type_url) & mask;
+  while (slots[i].load(std::memory_order_relaxed) != NULL) {
+    i = (i + 1) & mask;
+  }
+  slots[i].store(entry, std::memory_order_release);
+}
+
+AnyResolver::AnyResolver()
+    : AnyResolver(DescriptorPool::generated_pool(),
+                  MessageFactory::generated_factory()) {}
+
+AnyResolver::AnyResolver(const DescriptorPool* pool, MessageFactory* factory)
+    : pool_(pool), factory_(factory), failed_type_urls_(0) {
+  tables_.emplace_back(new Table(kInitialTableCapacity));
+  table_.store(tables_.back().get(), std::memory_order_release);
+}
+
+AnyResolver::~AnyResolver() {}
+
+const Message* AnyResolver::FindPrototype(StringPiece type_url) {
+  const Entry* entry =
+      table_.load(std::memory_order_acquire)->Find(type_url);
+  if (entry != NULL) {
+    return entry->prototype;
+  }
+
+  internal::MutexLock lock(&mutex_);
+  // Another thread may have added the type while we waited for the lock.
+  entry = tables_.back()->Find(type_url);
+  if (entry != NULL) {
+    return entry->prototype;
+  }
+
+  const Message* prototype = NULL;
+  const StringPiece::size_type slash = type_url.rfind('/');
+  if (slash != StringPiece::npos && slash + 1 < type_url.size()) {
+    const Descriptor* descriptor =
+        pool_->FindMessageTypeByName(type_url.substr(slash + 1).ToString());
+    if (descriptor != NULL) {
+      prototype = factory_->GetPrototype(descriptor);
+    }
+  }
+  if (prototype == NULL) {
+    if (failed_type_urls_ >= kMaxFailedTypeUrls) {
+      return NULL;
+    }
+    failed_type_urls_++;
+  }
+
+  Entry* new_entry = new Entry;
+  new_entry->type_url = type_url.ToString();
+  new_entry->prototype = prototype;
+  AddEntry(new_entry);
+  return prototype;
+}
+
+void AnyResolver::AddEntry(Entry* entry) {
+  entries_.emplace_back(entry);
+  Table* table = tables_.back().get();
+  if (entries_.size() * 2 > table->mask + 1) {
+    // Fill the new table before publishing it, so that readers never see it
+    // without the entries of the old one.
+    table = new Table((table->mask + 1) * 2);
+    tables_.emplace_back(table);
+    for (int i = 0; i < entries_.size(); i++) {
+      table->Insert(entries_[i].get());
+    }
+    table_.store(table, std::memory_order_release);
+  } else {
+    table->Insert(entry);
+  }
+}
+
+Message* AnyResolver::Unpack(const Any& any, Arena* arena) {
+  const Message* prototype = FindPrototype(any.type_url());
+  if (prototype == NULL) {
+    return NULL;
+  }
+  Message* message = prototype->New(arena);
+  if (!message->ParseFromArray(any.value().data(),
+                               static_cast<int>(any.value().size()))) {
+    if (arena == NULL) {
+      delete message;
+    }
+    return NULL;
+  }
+  return message;
+}
+
+bool AnyResolver::Unpack(const Any& any, Message* target) {
+  const std::string& type_url = any.type_url();
+  const std::string& full_name = target->GetDescriptor()->full_name();
+  // Compares the type name after the last '/' without looking it up.
+  if (type_url.size() <= full_name.size() ||
+      type_url[type_url.size() - full_name.size() - 1] != '/' ||
+      type_url.compare(type_url.size() - full_name.size(), full_name.size(),
+                       full_name) != 0) {
+    return false;
+  }
+  return target->ParseFromArray(any.value().data(),
+                                static_cast<int>(any.value().size()));
+}
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,144 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Defines AnyResolver, which unpacks google.protobuf.Any messages whose type
+// is only known at run time.
+
+#ifndef GOOGLE_PROTOBUF_UTIL_ANY_RESOLVER_H__
+#define GOOGLE_PROTOBUF_UTIL_ANY_RESOLVER_H__
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/mutex.h>
+#include <google/protobuf/stubs/stringpiece.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+class Any;
+class Arena;
+class DescriptorPool;
+class Message;
+class MessageFactory;
+
+namespace util {
+
+// Unpacks Any messages into messages of the type named by their type URL:
+//
+//   util::AnyResolver resolver;
+//   std::unique_ptr<Message> payload(resolver.Unpack(any));
+//
+// Each type URL is only looked up in the DescriptorPool and MessageFactory
+// the first time it is seen. After that, FindPrototype() and Unpack() read the
+// cache without taking a lock, so one resolver can be shared by all threads.
+// Type URLs that cannot be resolved are cached as well, up to
+// kMaxFailedTypeUrls of them, so that a stream of unknown types cannot grow
+// the cache without bound.
+class PROTOBUF_EXPORT AnyResolver {
+ public:
+  // Resolves the types of the generated pool with the generated factory.
+  AnyResolver();
+  // Resolves the types of "pool" with "factory". Neither is owned; both must
+  // outlive the resolver.
+  AnyResolver(const DescriptorPool* pool, MessageFactory* factory);
+  ~AnyResolver();
+
+  static const int kMaxFailedTypeUrls = 1024;
+
+  // Returns the prototype of the type named by "type_url", such as
+  // "type.googleapis.com/google.protobuf.Duration", or NULL if the type is
+  // not found.
+  const Message* FindPrototype(StringPiece type_url);
+
+  // Creates a message of the type named by the type URL of "any" on "arena",
+  // or on the heap if "arena" is omitted, and parses the payload into it. The
+  // payload is parsed from the bytes of "any" without copying them first.
+  // Returns NULL if the type is not found or the payload does not parse.
+  Message* Unpack(const Any& any, Arena* arena = NULL);
+
+  // Parses the payload of "any" into "target", replacing its contents, if the
+  // type URL of "any" names the type of "target". Returns false if it names
+  // another type or the payload does not parse.
+  bool Unpack(const Any& any, Message* target);
+
+ private:
+  // Entries are never modified or freed once added to a table.
+  struct Entry {
+    std::string type_url;
+    // NULL if the type URL could not be resolved.
+    const Message* prototype;
+  };
+
+  // An open addressing hash table of entries which readers probe without a
+  // lock. It is at most half full, so every probe ends at an empty slot.
+  struct Table {
+    explicit Table(int capacity);
+
+    const Entry* Find(StringPiece type_url) const;
+    // Requires the mutex.
+    void Insert(const Entry* entry);
+
+    const int mask;
+    std::unique_ptr<std::atomic<const Entry*>[]> slots;
+  };
+
+  // Requires the mutex.
+  void AddEntry(Entry* entry);
+
+  const DescriptorPool* pool_;
+  MessageFactory* factory_;
+  // The current table. It is replaced by one twice as large when it gets
+  // half full; the old one is kept in "tables_" until the resolver is
+  // destroyed because readers may still be probing it, which costs less
+  // memory than the current table as the sizes grow geometrically.
+  std::atomic<const Table*> table_;
+
+  // Guards the members below, which are only used on a cache miss.
+  internal::WrappedMutex mutex_;
+  std::vector<std::unique_ptr<Table> > tables_;
+  std::vector<std::unique_ptr<Entry> > entries_;
+  int failed_type_urls_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(AnyResolver);
+};
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_UTIL_ANY_RESOLVER_H__
@@ -0,0 +1,205 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/any_resolver.h>
+
+#include <memory>
+
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace {
+
+using protobuf_unittest::TestAllTypes;
+
+const char kTestAllTypesUrl[] =
+    "type.googleapis.com/protobuf_unittest.TestAllTypes";
+
+// Builds "file" and its dependencies in "pool".
+void AddFile(const FileDescriptor* file, DescriptorPool* pool) {
+  if (pool->FindFileByName(file->name()) != NULL) {
+    return;
+  }
+  for (int i = 0; i < file->dependency_count(); i++) {
+    AddFile(file->dependency(i), pool);
+  }
+  FileDescriptorProto proto;
+  file->CopyTo(&proto);
+  ASSERT_TRUE(pool->BuildFile(proto) != NULL);
+}
+
+TEST(AnyResolverTest, FindPrototype) {
+  AnyResolver resolver;
+  const Message* prototype = resolver.FindPrototype(kTestAllTypesUrl);
+  EXPECT_EQ(&TestAllTypes::default_instance(), prototype);
+  // The second lookup is served from the cache.
+  EXPECT_EQ(prototype, resolver.FindPrototype(kTestAllTypesUrl));
+  // The prefix of the type URL does not matter.
+  EXPECT_EQ(prototype, resolver.FindPrototype(
+                           "example.com/protobuf_unittest.TestAllTypes"));
+
+  EXPECT_TRUE(resolver.FindPrototype("type.googleapis.com/NoSuchType") == NULL);
+  EXPECT_TRUE(resolver.FindPrototype("protobuf_unittest.TestAllTypes") == NULL);
+  EXPECT_TRUE(resolver.FindPrototype("type.googleapis.com/") == NULL);
+}
+
+TEST(AnyResolverTest, Unpack) {
+  TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  Any any;
+  any.PackFrom(message);
+
+  AnyResolver resolver;
+  std::unique_ptr<Message> unpacked(resolver.Unpack(any));
+  ASSERT_TRUE(unpacked != NULL);
+  EXPECT_EQ(TestAllTypes::descriptor(), unpacked->GetDescriptor());
+  EXPECT_TRUE(MessageDifferencer::Equals(message, *unpacked));
+
+  Arena arena;
+  Message* arena_unpacked = resolver.Unpack(any, &arena);
+  ASSERT_TRUE(arena_unpacked != NULL);
+  EXPECT_EQ(&arena, arena_unpacked->GetArena());
+  EXPECT_TRUE(MessageDifferencer::Equals(message, *arena_unpacked));
+}
+
+TEST(AnyResolverTest, UnpackFailures) {
+  AnyResolver resolver;
+  Any any;
+  any.set_type_url("type.googleapis.com/NoSuchType");
+  EXPECT_TRUE(resolver.Unpack(any) == NULL);
+
+  any.set_type_url(kTestAllTypesUrl);
+  any.set_value("\xff");
+  EXPECT_TRUE(resolver.Unpack(any) == NULL);
+  Arena arena;
+  EXPECT_TRUE(resolver.Unpack(any, &arena) == NULL);
+}
+
+TEST(AnyResolverTest, FailedLookupsAreCached) {
+  DescriptorPool pool;
+  DynamicMessageFactory factory(&pool);
+  AnyResolver resolver(&pool, &factory);
+  const std::string type_url =
+      "type.googleapis.com/protobuf_unittest.TestAllTypes";
+  EXPECT_TRUE(resolver.FindPrototype(type_url) == NULL);
+
+  // Types added to the pool later are not seen, as the failure is cached.
+  AddFile(TestAllTypes::descriptor()->file(), &pool);
+  EXPECT_TRUE(resolver.FindPrototype(type_url) == NULL);
+
+  // Only a bounded number of failures is cached.
+  for (int i = 0; i < AnyResolver::kMaxFailedTypeUrls; i++) {
+    EXPECT_TRUE(resolver.FindPrototype(StrCat("example.com/NoSuchType", i)) ==
+                NULL);
+  }
+  EXPECT_TRUE(resolver.FindPrototype(
+                  "example.com/protobuf_unittest.TestAllTypes") != NULL);
+}
+
+TEST(AnyResolverTest, ManyTypes) {
+  // Resolves enough types to grow the cache several times, and checks that
+  // all of them are still found afterwards.
+  const Descriptor* descriptors[] = {
+      TestAllTypes::descriptor(),
+      TestAllTypes::NestedMessage::descriptor(),
+      protobuf_unittest::TestAllExtensions::descriptor(),
+      protobuf_unittest::ForeignMessage::descriptor(),
+      protobuf_unittest::TestRequired::descriptor(),
+      protobuf_unittest::TestEmptyMessage::descriptor(),
+  };
+  AnyResolver resolver;
+  for (int round = 0; round < 2; round++) {
+    for (int i = 0; i < 100; i++) {
+      const Descriptor* descriptor =
+          descriptors[i % GOOGLE_ARRAYSIZE(descriptors)];
+      EXPECT_EQ(MessageFactory::generated_factory()->GetPrototype(descriptor),
+                resolver.FindPrototype(
+                    StrCat("example.com/", i, "/", descriptor->full_name())));
+    }
+  }
+}
+
+TEST(AnyResolverTest, UnpackTo) {
+  TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  Any any;
+  any.PackFrom(message);
+
+  AnyResolver resolver;
+  TestAllTypes unpacked;
+  unpacked.set_optional_int32(12345);
+  ASSERT_TRUE(resolver.Unpack(any, &unpacked));
+  EXPECT_TRUE(MessageDifferencer::Equals(message, unpacked));
+
+  protobuf_unittest::ForeignMessage other_type;
+  EXPECT_FALSE(resolver.Unpack(any, &other_type));
+  any.set_type_url("type.googleapis.com/xprotobuf_unittest.TestAllTypes");
+  EXPECT_FALSE(resolver.Unpack(any, &unpacked));
+  any.set_type_url("protobuf_unittest.TestAllTypes");
+  EXPECT_FALSE(resolver.Unpack(any, &unpacked));
+
+  any.set_type_url(kTestAllTypesUrl);
+  any.set_value("\xff");
+  EXPECT_FALSE(resolver.Unpack(any, &unpacked));
+}
+
+TEST(AnyResolverTest, DynamicTypes) {
+  DescriptorPool pool;
+  AddFile(TestAllTypes::descriptor()->file(), &pool);
+  DynamicMessageFactory factory(&pool);
+
+  TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  Any any;
+  any.PackFrom(message);
+
+  AnyResolver resolver(&pool, &factory);
+  std::unique_ptr<Message> unpacked(resolver.Unpack(any));
+  ASSERT_TRUE(unpacked != NULL);
+  EXPECT_EQ(pool.FindMessageTypeByName("protobuf_unittest.TestAllTypes"),
+            unpacked->GetDescriptor());
+  EXPECT_EQ(message.SerializeAsString(), unpacked->SerializeAsString());
+}
+
+}  // namespace
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
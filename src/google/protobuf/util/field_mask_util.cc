@@ -30,9 +30,17 @@
 
 #include <google/protobuf/util/field_mask_util.h>
 
+#include <algorithm>
+#include <climits>
+
 #include <google/protobuf/stubs/strutil.h>
 
 #include <google/protobuf/stubs/map_util.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/wire_format.h>
 
 namespace google {
 namespace protobuf {
@@ -168,6 +176,84 @@ void FieldMaskUtil::GetFieldMaskForAllFields(
 }
 
 namespace {
+// Merges a field from one message to another, as for a leaf path of a
+// FieldMask.
+void MergeField(const Message& source, const FieldDescriptor* field,
+                const FieldMaskUtil::MergeOptions& options,
+                Message* destination) {
+  const Reflection* source_reflection = source.GetReflection();
+  const Reflection* destination_reflection = destination->GetReflection();
+  if (!field->is_repeated()) {
+    switch (field->cpp_type()) {
+#define COPY_VALUE(TYPE, Name)                                              \
+  case FieldDescriptor::CPPTYPE_##TYPE: {                                   \
+    if (source_reflection->HasField(source, field)) {                       \
+      destination_reflection->Set##Name(                                    \
+          destination, field, source_reflection->Get##Name(source, field)); \
+    } else {                                                                \
+      destination_reflection->ClearField(destination, field);               \
+    }                                                                       \
+    break;                                                                  \
+  }
+      COPY_VALUE(BOOL, Bool)
+      COPY_VALUE(INT32, Int32)
+      COPY_VALUE(INT64, Int64)
+      COPY_VALUE(UINT32, UInt32)
+      COPY_VALUE(UINT64, UInt64)
+      COPY_VALUE(FLOAT, Float)
+      COPY_VALUE(DOUBLE, Double)
+      COPY_VALUE(ENUM, Enum)
+      COPY_VALUE(STRING, String)
+#undef COPY_VALUE
+      case FieldDescriptor::CPPTYPE_MESSAGE: {
+        if (options.replace_message_fields()) {
+          destination_reflection->ClearField(destination, field);
+        }
+        if (source_reflection->HasField(source, field)) {
+          destination_reflection->MutableMessage(destination, field)
+              ->MergeFrom(source_reflection->GetMessage(source, field));
+        }
+        break;
+      }
+    }
+  } else {
+    if (options.replace_repeated_fields()) {
+      destination_reflection->ClearField(destination, field);
+    }
+    switch (field->cpp_type()) {
+#define COPY_REPEATED_VALUE(TYPE, Name)                            \
+  case FieldDescriptor::CPPTYPE_##TYPE: {                          \
+    int size = source_reflection->FieldSize(source, field);        \
+    for (int i = 0; i < size; ++i) {                               \
+      destination_reflection->Add##Name(                           \
+          destination, field,                                      \
+          source_reflection->GetRepeated##Name(source, field, i)); \
+    }                                                              \
+    break;                                                         \
+  }
+      COPY_REPEATED_VALUE(BOOL, Bool)
+      COPY_REPEATED_VALUE(INT32, Int32)
+      COPY_REPEATED_VALUE(INT64, Int64)
+      COPY_REPEATED_VALUE(UINT32, UInt32)
+      COPY_REPEATED_VALUE(UINT64, UInt64)
+      COPY_REPEATED_VALUE(FLOAT, Float)
+      COPY_REPEATED_VALUE(DOUBLE, Double)
+      COPY_REPEATED_VALUE(ENUM, Enum)
+      COPY_REPEATED_VALUE(STRING, String)
+#undef COPY_REPEATED_VALUE
+      case FieldDescriptor::CPPTYPE_MESSAGE: {
+        int size = source_reflection->FieldSize(source, field);
+        for (int i = 0; i < size; ++i) {
+          destination_reflection->AddMessage(destination, field)
+              ->MergeFrom(
+                  source_reflection->GetRepeatedMessage(source, field, i));
+        }
+        break;
+      }
+    }
+  }
+}
+
 // A FieldMaskTree represents a FieldMask in a tree structure. For example,
 // given a FieldMask "foo.bar,foo.baz,bar.baz", the FieldMaskTree will be:
 //
@@ -476,75 +562,7 @@ void FieldMaskTree::MergeMessage(const Node* node, const Message& source,
                    destination_reflection->MutableMessage(destination, field));
       continue;
     }
-    if (!field->is_repeated()) {
-      switch (field->cpp_type()) {
-#define COPY_VALUE(TYPE, Name)                                              \
-  case FieldDescriptor::CPPTYPE_##TYPE: {                                   \
-    if (source_reflection->HasField(source, field)) {                       \
-      destination_reflection->Set##Name(                                    \
-          destination, field, source_reflection->Get##Name(source, field)); \
-    } else {                                                                \
-      destination_reflection->ClearField(destination, field);               \
-    }                                                                       \
-    break;                                                                  \
-  }
-        COPY_VALUE(BOOL, Bool)
-        COPY_VALUE(INT32, Int32)
-        COPY_VALUE(INT64, Int64)
-        COPY_VALUE(UINT32, UInt32)
-        COPY_VALUE(UINT64, UInt64)
-        COPY_VALUE(FLOAT, Float)
-        COPY_VALUE(DOUBLE, Double)
-        COPY_VALUE(ENUM, Enum)
-        COPY_VALUE(STRING, String)
-#undef COPY_VALUE
-        case FieldDescriptor::CPPTYPE_MESSAGE: {
-          if (options.replace_message_fields()) {
-            destination_reflection->ClearField(destination, field);
-          }
-          if (source_reflection->HasField(source, field)) {
-            destination_reflection->MutableMessage(destination, field)
-                ->MergeFrom(source_reflection->GetMessage(source, field));
-          }
-          break;
-        }
-      }
-    } else {
-      if (options.replace_repeated_fields()) {
-        destination_reflection->ClearField(destination, field);
-      }
-      switch (field->cpp_type()) {
-#define COPY_REPEATED_VALUE(TYPE, Name)                            \
-  case FieldDescriptor::CPPTYPE_##TYPE: {                          \
-    int size = source_reflection->FieldSize(source, field);        \
-    for (int i = 0; i < size; ++i) {                               \
-      destination_reflection->Add##Name(                           \
-          destination, field,                                      \
-          source_reflection->GetRepeated##Name(source, field, i)); \
-    }                                                              \
-    break;                                                         \
-  }
-        COPY_REPEATED_VALUE(BOOL, Bool)
-        COPY_REPEATED_VALUE(INT32, Int32)
-        COPY_REPEATED_VALUE(INT64, Int64)
-        COPY_REPEATED_VALUE(UINT32, UInt32)
-        COPY_REPEATED_VALUE(UINT64, UInt64)
-        COPY_REPEATED_VALUE(FLOAT, Float)
-        COPY_REPEATED_VALUE(DOUBLE, Double)
-        COPY_REPEATED_VALUE(ENUM, Enum)
-        COPY_REPEATED_VALUE(STRING, String)
-#undef COPY_REPEATED_VALUE
-        case FieldDescriptor::CPPTYPE_MESSAGE: {
-          int size = source_reflection->FieldSize(source, field);
-          for (int i = 0; i < size; ++i) {
-            destination_reflection->AddMessage(destination, field)
-                ->MergeFrom(
-                    source_reflection->GetRepeatedMessage(source, field, i));
-          }
-          break;
-        }
-      }
-    }
+    MergeField(source, field, options, destination);
   }
 }
 
@@ -713,6 +731,342 @@ bool FieldMaskUtil::TrimMessage(const FieldMask& mask, Message* message,
   return tree.TrimMessage(GOOGLE_CHECK_NOTNULL(message));
 }
 
+// A node of a CompiledFieldMask, for one message type.
+struct FieldMaskUtil::CompiledFieldMask::Node {
+  struct Child {
+    Child() : field(NULL), invalid_sub_path(false) {}
+
+    const FieldDescriptor* field;
+    // The mask below a singular message field, or NULL if the whole field is
+    // in the mask.
+    std::unique_ptr<Node> node;
+    // True if the mask has paths below a field that cannot have sub-fields.
+    // As with an uncompiled FieldMask, such a field is skipped when merging
+    // and kept as a whole when trimming.
+    bool invalid_sub_path;
+
+    static bool FieldNumberLess(const Child& a, const Child& b) {
+      return a.field->number() < b.field->number();
+    }
+  };
+
+  explicit Node(const Descriptor* descriptor)
+      : child_index(descriptor->field_count(), -1) {}
+
+  // Returns the child for the given field, adding it if necessary.
+  Child* FindOrAddChild(const FieldDescriptor* field) {
+    int& index = child_index[field->index()];
+    if (index < 0) {
+      index = children.size();
+      children.emplace_back();
+      children.back().field = field;
+    }
+    return &children[index];
+  }
+
+  void MergeMessage(const Message& source,
+                    const FieldMaskUtil::MergeOptions& options,
+                    Message* destination) const;
+  bool TrimMessage(bool keep_required_fields, Message* message) const;
+  // Returns the size of the fields of "message" selected by this node when
+  // serialized. The sizes of the selected parts of sub-messages are appended
+  // to "sizes" in the order Serialize() consumes them.
+  size_t ByteSize(const Message& message, std::vector<int>* sizes) const;
+  void Serialize(const Message& message,
+                 std::vector<int>::const_iterator* next_size,
+                 io::CodedOutputStream* output) const;
+  // Sorts the children of this node and of all nodes below it by field
+  // number, the order in which fields are serialized.
+  void SortChildren();
+  // Trims a message that is not covered by the mask but must be kept because
+  // it is in a required field.
+  static bool TrimToRequiredFields(Message* message);
+
+  std::vector<Child> children;
+  // The index in children of each field of the message type, or -1 if the
+  // field is not in the mask.
+  std::vector<int> child_index;
+};
+
+FieldMaskUtil::CompiledFieldMask::CompiledFieldMask(
+    const Descriptor* descriptor, const FieldMask& mask)
+    : descriptor_(descriptor), root_(new Node(descriptor)) {
+  // The canonical form has no paths covered by other paths.
+  FieldMask canonical_mask;
+  ToCanonicalForm(mask, &canonical_mask);
+  for (int i = 0; i < canonical_mask.paths_size(); ++i) {
+    AddPath(canonical_mask.paths(i));
+  }
+  root_->SortChildren();
+}
+
+FieldMaskUtil::CompiledFieldMask::~CompiledFieldMask() {}
+
+void FieldMaskUtil::CompiledFieldMask::AddPath(const std::string& path) {
+  std::vector<std::string> parts = Split(path, ".");
+  if (parts.empty()) {
+    return;
+  }
+  const Descriptor* descriptor = descriptor_;
+  Node* node = root_.get();
+  for (int i = 0; i < parts.size(); ++i) {
+    const FieldDescriptor* field = descriptor->FindFieldByName(parts[i]);
+    if (field == NULL) {
+      GOOGLE_LOG(ERROR) << "Cannot find field \"" << parts[i] << "\" in message "
+                 << descriptor->full_name();
+      return;
+    }
+    Node::Child* child = node->FindOrAddChild(field);
+    if (i == parts.size() - 1 || child->invalid_sub_path) {
+      return;
+    }
+    // Sub-paths are only allowed for singular message fields.
+    if (field->is_repeated() ||
+        field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+      GOOGLE_LOG(ERROR) << "Field \"" << parts[i] << "\" in message "
+                 << descriptor->full_name()
+                 << " is not a singular message field and cannot "
+                 << "have sub-fields.";
+      child->invalid_sub_path = true;
+      return;
+    }
+    descriptor = field->message_type();
+    if (child->node == NULL) {
+      child->node.reset(new Node(descriptor));
+    }
+    node = child->node.get();
+  }
+}
+
+void FieldMaskUtil::CompiledFieldMask::Node::MergeMessage(
+    const Message& source, const FieldMaskUtil::MergeOptions& options,
+    Message* destination) const {
+  const Reflection* source_reflection = source.GetReflection();
+  const Reflection* destination_reflection = destination->GetReflection();
+  for (int i = 0; i < children.size(); ++i) {
+    const Child& child = children[i];
+    if (child.invalid_sub_path) {
+      continue;
+    }
+    if (child.node != NULL) {
+      child.node->MergeMessage(
+          source_reflection->GetMessage(source, child.field), options,
+          destination_reflection->MutableMessage(destination, child.field));
+      continue;
+    }
+    MergeField(source, child.field, options, destination);
+  }
+}
+
+bool FieldMaskUtil::CompiledFieldMask::Node::TrimMessage(
+    bool keep_required_fields, Message* message) const {
+  const Reflection* reflection = message->GetReflection();
+  const Descriptor* descriptor = message->GetDescriptor();
+  const int32 field_count = descriptor->field_count();
+  bool modified = false;
+  for (int index = 0; index < field_count; ++index) {
+    const FieldDescriptor* field = descriptor->field(index);
+    const int child_index = this->child_index[index];
+    if (child_index < 0) {
+      if (keep_required_fields && field->is_required()) {
+        if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+            reflection->HasField(*message, field)) {
+          modified = TrimToRequiredFields(
+                         reflection->MutableMessage(message, field)) ||
+                     modified;
+        }
+        continue;
+      }
+      if (field->is_repeated()) {
+        if (reflection->FieldSize(*message, field) != 0) {
+          modified = true;
+        }
+      } else {
+        if (reflection->HasField(*message, field)) {
+          modified = true;
+        }
+      }
+      reflection->ClearField(message, field);
+    } else {
+      const Node* child = children[child_index].node.get();
+      if (child != NULL && reflection->HasField(*message, field)) {
+        modified =
+            child->TrimMessage(keep_required_fields,
+                               reflection->MutableMessage(message, field)) ||
+            modified;
+      }
+    }
+  }
+  return modified;
+}
+
+bool FieldMaskUtil::CompiledFieldMask::Node::TrimToRequiredFields(
+    Message* message) {
+  // A message type without required fields is kept as a whole.
+  const Descriptor* descriptor = message->GetDescriptor();
+  bool has_required_fields = false;
+  for (int index = 0; index < descriptor->field_count(); ++index) {
+    if (descriptor->field(index)->is_required()) {
+      has_required_fields = true;
+      break;
+    }
+  }
+  if (!has_required_fields) {
+    return false;
+  }
+  return Node(descriptor).TrimMessage(true, message);
+}
+
+void FieldMaskUtil::CompiledFieldMask::Node::SortChildren() {
+  std::sort(children.begin(), children.end(), Child::FieldNumberLess);
+  for (int i = 0; i < children.size(); ++i) {
+    child_index[children[i].field->index()] = i;
+    if (children[i].node != NULL) {
+      children[i].node->SortChildren();
+    }
+  }
+}
+
+size_t FieldMaskUtil::CompiledFieldMask::Node::ByteSize(
+    const Message& message, std::vector<int>* sizes) const {
+  const Reflection* reflection = message.GetReflection();
+  size_t total_size = 0;
+  for (int i = 0; i < children.size(); ++i) {
+    const Child& child = children[i];
+    if (child.node == NULL) {
+      // FieldByteSize() counts the default value of unset singular fields.
+      if (child.field->is_repeated() ||
+          reflection->HasField(message, child.field)) {
+        // WireFormat also caches the sizes of sub-messages for Serialize().
+        total_size +=
+            internal::WireFormat::FieldByteSize(child.field, message);
+      }
+      continue;
+    }
+    if (!reflection->HasField(message, child.field)) {
+      continue;
+    }
+    const int size_index = sizes->size();
+    sizes->push_back(0);
+    size_t size = child.node->ByteSize(
+        reflection->GetMessage(message, child.field), sizes);
+    (*sizes)[size_index] = internal::ToCachedSize(size);
+    // TagSize() includes the end tag of groups.
+    total_size += internal::WireFormat::TagSize(child.field->number(),
+                                                child.field->type());
+    if (child.field->type() != FieldDescriptor::TYPE_GROUP) {
+      total_size += io::CodedOutputStream::VarintSize32(size);
+    }
+    total_size += size;
+  }
+  // Like TrimMessage(), the mask keeps the extensions and unknown fields of
+  // the messages it selects fields from.
+  const internal::ExtensionSet* extensions =
+      internal::ReflectionInternals::GetExtensionSet(message);
+  if (extensions != NULL) {
+    total_size += extensions->ByteSize();
+  }
+  total_size += internal::WireFormat::ComputeUnknownFieldsSize(
+      reflection->GetUnknownFields(message));
+  return total_size;
+}
+
+void FieldMaskUtil::CompiledFieldMask::Node::Serialize(
+    const Message& message, std::vector<int>::const_iterator* next_size,
+    io::CodedOutputStream* output) const {
+  const Reflection* reflection = message.GetReflection();
+  // Extensions are written in field number order with the selected fields,
+  // as by generated code.
+  const internal::ExtensionSet* extensions =
+      internal::ReflectionInternals::GetExtensionSet(message);
+  int next_extension_number = 0;
+  for (int i = 0; i < children.size(); ++i) {
+    const Child& child = children[i];
+    if (extensions != NULL) {
+      extensions->SerializeWithCachedSizes(next_extension_number,
+                                           child.field->number(), output);
+      next_extension_number = child.field->number() + 1;
+    }
+    if (child.node == NULL) {
+      internal::WireFormat::SerializeFieldWithCachedSizes(child.field, message,
+                                                          output);
+      continue;
+    }
+    if (!reflection->HasField(message, child.field)) {
+      continue;
+    }
+    const int size = *(*next_size)++;
+    output->WriteTag(internal::WireFormat::MakeTag(child.field));
+    if (child.field->type() == FieldDescriptor::TYPE_GROUP) {
+      child.node->Serialize(reflection->GetMessage(message, child.field),
+                            next_size, output);
+      output->WriteTag(internal::WireFormatLite::MakeTag(
+          child.field->number(), internal::WireFormatLite::WIRETYPE_END_GROUP));
+    } else {
+      output->WriteVarint32(size);
+      child.node->Serialize(reflection->GetMessage(message, child.field),
+                            next_size, output);
+    }
+  }
+  if (extensions != NULL) {
+    extensions->SerializeWithCachedSizes(next_extension_number, INT_MAX,
+                                         output);
+  }
+  internal::WireFormat::SerializeUnknownFields(
+      reflection->GetUnknownFields(message), output);
+}
+
+void FieldMaskUtil::MergeMessageTo(const Message& source,
+                                   const CompiledFieldMask& mask,
+                                   const MergeOptions& options,
+                                   Message* destination) {
+  GOOGLE_CHECK(source.GetDescriptor() == mask.descriptor());
+  GOOGLE_CHECK(destination->GetDescriptor() == mask.descriptor());
+  mask.root_->MergeMessage(source, options, destination);
+}
+
+bool FieldMaskUtil::TrimMessage(const CompiledFieldMask& mask,
+                                Message* message) {
+  return TrimMessage(mask, message, TrimOptions());
+}
+
+bool FieldMaskUtil::TrimMessage(const CompiledFieldMask& mask, Message* message,
+                                const TrimOptions& options) {
+  GOOGLE_CHECK(GOOGLE_CHECK_NOTNULL(message)->GetDescriptor() == mask.descriptor());
+  // Do nothing if the mask is empty.
+  if (mask.root_->children.empty()) {
+    return false;
+  }
+  return mask.root_->TrimMessage(options.keep_required_fields(), message);
+}
+
+bool FieldMaskUtil::SerializeMessageTo(const Message& message,
+                                       const CompiledFieldMask& mask,
+                                       io::CodedOutputStream* output) {
+  GOOGLE_CHECK(message.GetDescriptor() == mask.descriptor());
+  if (mask.root_->children.empty()) {
+    return message.SerializePartialToCodedStream(output);
+  }
+  std::vector<int> sizes;
+  size_t size = mask.root_->ByteSize(message, &sizes);
+  if (size > INT_MAX) {
+    GOOGLE_LOG(ERROR) << message.GetTypeName()
+               << " exceeded maximum protobuf size of 2GB: " << size;
+    return false;
+  }
+  std::vector<int>::const_iterator next_size = sizes.begin();
+  mask.root_->Serialize(message, &next_size, output);
+  return !output->HadError();
+}
+
+bool FieldMaskUtil::SerializeMessageToString(const Message& message,
+                                             const CompiledFieldMask& mask,
+                                             std::string* output) {
+  io::StringOutputStream output_stream(output);
+  io::CodedOutputStream encoder(&output_stream);
+  return SerializeMessageTo(message, mask, &encoder);
+}
+
 }  // namespace util
 }  // namespace protobuf
 }  // namespace google
@@ -33,6 +33,7 @@
 #ifndef GOOGLE_PROTOBUF_UTIL_FIELD_MASK_UTIL_H__
 #define GOOGLE_PROTOBUF_UTIL_FIELD_MASK_UTIL_H__
 
+#include <memory>
 #include <string>
 
 #include <google/protobuf/descriptor.h>
@@ -43,6 +44,10 @@
 
 namespace google {
 namespace protobuf {
+namespace io {
+class CodedOutputStream;
+}  // namespace io
+
 namespace util {
 
 class PROTOBUF_EXPORT FieldMaskUtil {
@@ -162,6 +167,36 @@ class PROTOBUF_EXPORT FieldMaskUtil {
   static bool TrimMessage(const FieldMask& mask, Message* message,
                           const TrimOptions& options);
 
+  class CompiledFieldMask;
+  // Same as the methods above, but take a FieldMask compiled in advance for
+  // the type of the messages, so that its paths are not parsed and its fields
+  // not looked up again on every call.
+  static void MergeMessageTo(const Message& source,
+                             const CompiledFieldMask& mask,
+                             const MergeOptions& options, Message* destination);
+  static bool TrimMessage(const CompiledFieldMask& mask, Message* message);
+  static bool TrimMessage(const CompiledFieldMask& mask, Message* message,
+                          const TrimOptions& options);
+
+  // Serializes the fields of "message" selected by "mask" to "output". The
+  // result is the same as trimming a copy of "message" with TrimMessage() and
+  // serializing it, without copying the message: the extensions and unknown
+  // fields of "message" and of the sub-messages the mask selects fields from
+  // are written too, as a mask can only name regular fields. Required fields
+  // outside of the mask are not written, so the output may need to be parsed
+  // with ParsePartialFrom*().
+  // An empty mask selects the whole message, which is written as by
+  // SerializePartialToCodedStream().
+  // Returns false if the message is too large to serialize or writing to
+  // "output" failed.
+  static bool SerializeMessageTo(const Message& message,
+                                 const CompiledFieldMask& mask,
+                                 io::CodedOutputStream* output);
+  // Same as above, but appends the serialized fields to "output".
+  static bool SerializeMessageToString(const Message& message,
+                                       const CompiledFieldMask& mask,
+                                       std::string* output);
+
  private:
   friend class SnakeCaseCamelCaseTest;
   // Converts a field name from snake_case to camelCase:
@@ -238,6 +273,35 @@ class PROTOBUF_EXPORT FieldMaskUtil::TrimOptions {
   bool keep_required_fields_;
 };
 
+// A FieldMask resolved against a message type, for applying the same mask to
+// many messages. A CompiledFieldMask is immutable once constructed and can be
+// shared by multiple threads. Example:
+//
+//   static const FieldMaskUtil::CompiledFieldMask* mask =
+//       new FieldMaskUtil::CompiledFieldMask(Foo::descriptor(), field_mask);
+//   FieldMaskUtil::MergeMessageTo(source, *mask, options, &destination);
+class PROTOBUF_EXPORT FieldMaskUtil::CompiledFieldMask {
+ public:
+  // Paths that do not name a field of the given type are logged and ignored,
+  // as MergeMessageTo() does for an uncompiled FieldMask.
+  CompiledFieldMask(const Descriptor* descriptor, const FieldMask& mask);
+  ~CompiledFieldMask();
+
+  // The message type this mask applies to.
+  const Descriptor* descriptor() const { return descriptor_; }
+
+ private:
+  friend class FieldMaskUtil;
+  struct Node;
+
+  void AddPath(const std::string& path);
+
+  const Descriptor* descriptor_;
+  std::unique_ptr<Node> root_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(CompiledFieldMask);
+};
+
 }  // namespace util
 }  // namespace protobuf
 }  // namespace google
@@ -114,6 +114,7 @@ TEST_F(SnakeCaseCamelCaseTest, RoundTripTest) {
 }
 
 using protobuf_unittest::TestAllTypes;
+using protobuf_unittest::TestFieldOrderings;
 using protobuf_unittest::TestRequired;
 using protobuf_unittest::TestRequiredMessage;
 using protobuf_unittest::NestedTestAllTypes;
@@ -816,6 +817,155 @@ TEST(FieldMaskUtilTest, TrimMessageReturnValue) {
   // supported.
 }
 
+TEST(FieldMaskUtilTest, CompiledFieldMaskMatchesFieldMask) {
+  const char* const kMasks[] = {
+      "optional_int32",
+      "optional_int32,repeated_string,optional_nested_message",
+      "optional_nested_message.bb,repeated_nested_message,oneof_uint32",
+      "optional_foreign_message.c,optional_foreign_message",
+      "optional_bytes,oneof_nested_message.bb,optional_import_message.d",
+  };
+  TestAllTypes src;
+  TestUtil::SetAllFields(&src);
+  FieldMaskUtil::MergeOptions merge_options;
+  merge_options.set_replace_repeated_fields(true);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kMasks); ++i) {
+    SCOPED_TRACE(kMasks[i]);
+    FieldMask mask;
+    FieldMaskUtil::FromString(kMasks[i], &mask);
+    FieldMaskUtil::CompiledFieldMask compiled(TestAllTypes::descriptor(),
+                                              mask);
+
+    TestAllTypes expected, actual;
+    TestUtil::SetAllFields(&expected);
+    TestUtil::SetAllFields(&actual);
+    FieldMaskUtil::MergeMessageTo(src, mask, merge_options, &expected);
+    FieldMaskUtil::MergeMessageTo(src, compiled, merge_options, &actual);
+    EXPECT_EQ(expected.DebugString(), actual.DebugString());
+
+    expected = src;
+    actual = src;
+    EXPECT_EQ(FieldMaskUtil::TrimMessage(mask, &expected),
+              FieldMaskUtil::TrimMessage(compiled, &actual));
+    EXPECT_EQ(expected.DebugString(), actual.DebugString());
+    // A trimmed message is not modified by a second trim.
+    EXPECT_FALSE(FieldMaskUtil::TrimMessage(compiled, &actual));
+  }
+
+  // An empty mask trims nothing.
+  FieldMaskUtil::CompiledFieldMask empty(TestAllTypes::descriptor(),
+                                         FieldMask());
+  TestAllTypes msg(src);
+  EXPECT_FALSE(FieldMaskUtil::TrimMessage(empty, &msg));
+  EXPECT_EQ(src.DebugString(), msg.DebugString());
+}
+
+TEST(FieldMaskUtilTest, CompiledFieldMaskKeepRequiredFields) {
+  TestRequiredMessage msg;
+  msg.mutable_optional_message()->set_a(1234);
+  msg.mutable_optional_message()->set_dummy2(1);
+  msg.mutable_optional_message()->set_dummy4(2);
+  msg.mutable_required_message()->set_a(1234);
+  msg.mutable_required_message()->set_b(3456);
+  msg.mutable_required_message()->set_c(5678);
+  msg.mutable_required_message()->set_dummy2(7890);
+  msg.add_repeated_message()->set_a(1234);
+
+  const char* const kMasks[] = {
+      "optional_message.dummy2",
+      "required_message",
+      "required_message.dummy2",
+      "repeated_message",
+  };
+  FieldMaskUtil::TrimOptions options;
+  for (int keep_required = 0; keep_required < 2; ++keep_required) {
+    options.set_keep_required_fields(keep_required);
+    for (int i = 0; i < GOOGLE_ARRAYSIZE(kMasks); ++i) {
+      SCOPED_TRACE(kMasks[i]);
+      FieldMask mask;
+      FieldMaskUtil::FromString(kMasks[i], &mask);
+      FieldMaskUtil::CompiledFieldMask compiled(
+          TestRequiredMessage::descriptor(), mask);
+      TestRequiredMessage expected(msg), actual(msg);
+      EXPECT_EQ(FieldMaskUtil::TrimMessage(mask, &expected, options),
+                FieldMaskUtil::TrimMessage(compiled, &actual, options));
+      EXPECT_EQ(expected.DebugString(), actual.DebugString());
+    }
+  }
+}
+
+TEST(FieldMaskUtilTest, SerializeMessageTo) {
+  const char* const kMasks[] = {
+      "",
+      "optional_int32",
+      "optional_int32,repeated_string,optional_nested_message",
+      "optional_nested_message.bb,repeated_nested_message,oneof_uint32",
+      "optionalgroup.a,repeatedgroup,optional_foreign_message.c",
+      "optional_bytes,oneof_nested_message.bb,optional_import_message.d",
+      "repeated_int32.foo,optional_lazy_message.bb,optional_string",
+  };
+  TestAllTypes msg;
+  TestUtil::SetAllFields(&msg);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kMasks); ++i) {
+    SCOPED_TRACE(kMasks[i]);
+    FieldMask mask;
+    FieldMaskUtil::FromString(kMasks[i], &mask);
+    FieldMaskUtil::CompiledFieldMask compiled(TestAllTypes::descriptor(),
+                                              mask);
+    TestAllTypes trimmed(msg);
+    FieldMaskUtil::TrimMessage(compiled, &trimmed);
+    std::string projected;
+    ASSERT_TRUE(FieldMaskUtil::SerializeMessageToString(msg, compiled,
+                                                        &projected));
+    EXPECT_EQ(trimmed.SerializeAsString(), projected);
+  }
+
+  // Unset sub-messages in the mask are not written.
+  FieldMask mask;
+  FieldMaskUtil::FromString("optional_nested_message.bb", &mask);
+  FieldMaskUtil::CompiledFieldMask compiled(TestAllTypes::descriptor(), mask);
+  std::string projected;
+  ASSERT_TRUE(FieldMaskUtil::SerializeMessageToString(TestAllTypes(), compiled,
+                                                      &projected));
+  EXPECT_EQ("", projected);
+}
+
+TEST(FieldMaskUtilTest, SerializeMessageToWritesExtensionsAndUnknownFields) {
+  const char* const kMasks[] = {
+      "",
+      "my_int",
+      "my_string,my_float",
+      "my_int,optional_nested_message",
+      "my_float,optional_nested_message.bb",
+      "optional_nested_message.oo",
+  };
+  TestFieldOrderings msg;
+  msg.set_my_int(1);
+  msg.set_my_string("foo");
+  msg.set_my_float(1.5);
+  msg.SetExtension(protobuf_unittest::my_extension_int, 2);
+  msg.SetExtension(protobuf_unittest::my_extension_string, "bar");
+  msg.mutable_unknown_fields()->AddVarint(1000, 3);
+  msg.mutable_optional_nested_message()->set_bb(4);
+  msg.mutable_optional_nested_message()->mutable_unknown_fields()->AddVarint(
+      1000, 5);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kMasks); ++i) {
+    SCOPED_TRACE(kMasks[i]);
+    FieldMask mask;
+    FieldMaskUtil::FromString(kMasks[i], &mask);
+    FieldMaskUtil::CompiledFieldMask compiled(TestFieldOrderings::descriptor(),
+                                              mask);
+    TestFieldOrderings trimmed(msg);
+    FieldMaskUtil::TrimMessage(compiled, &trimmed);
+    std::string expected;
+    ASSERT_TRUE(trimmed.SerializeToString(&expected));
+    std::string projected;
+    ASSERT_TRUE(
+        FieldMaskUtil::SerializeMessageToString(msg, compiled, &projected));
+    EXPECT_EQ(expected, projected);
+  }
+}
+
 
 }  // namespace
 }  // namespace util
@@ -33,6 +33,10 @@
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace google {
 namespace protobuf {
 namespace util {
@@ -305,6 +309,43 @@ StringPiece EscapeCodePoint(uint32 cp, char* buffer, bool force_output) {
   return sp;
 }
 
+// Returns true if the ASCII character c is copied to the output as is.
+inline bool IsUnescapedAscii(char c) {
+  return c >= 0x20 && c < 0x7f &&
+         kCommonEscapes[static_cast<uint8>(c)][0] == '\0';
+}
+
+// Returns the length of the run of printable ASCII characters needing no
+// escaping at the start of str. These runs make up most of free text and are
+// copied to the output in one go instead of being decoded code point by code
+// point. Checks 16 bytes at a time where SSE2 is available.
+int UnescapedAsciiLength(StringPiece str) {
+  const char* begin = str.data();
+  const char* end = begin + str.size();
+  const char* p = begin;
+#ifdef __SSE2__
+  const __m128i space = _mm_set1_epi8(0x20);
+  const __m128i del = _mm_set1_epi8(0x7f);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i less = _mm_set1_epi8('<');
+  const __m128i greater = _mm_set1_epi8('>');
+  for (; end - p >= 16; p += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    // The signed comparison against space also catches bytes >= 0x80.
+    __m128i escaped = _mm_or_si128(
+        _mm_or_si128(_mm_cmplt_epi8(chunk, space), _mm_cmpeq_epi8(chunk, del)),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                  _mm_cmpeq_epi8(chunk, backslash)),
+                     _mm_or_si128(_mm_cmpeq_epi8(chunk, less),
+                                  _mm_cmpeq_epi8(chunk, greater))));
+    if (_mm_movemask_epi8(escaped) != 0) break;
+  }
+#endif
+  while (p < end && IsUnescapedAscii(*p)) ++p;
+  return p - begin;
+}
+
 }  // namespace
 
 void JsonEscaping::Escape(strings::ByteSource* input,
@@ -316,8 +357,8 @@ void JsonEscaping::Escape(strings::ByteSource* input,
     StringPiece str = input->Peek();
     StringPiece escaped;
     int i = 0;
-    int num_read;
-    bool ok;
+    int num_read = 0;
+    bool ok = true;
     bool cp_was_split = num_left > 0;
     // Loop until we encounter either
     //   i) a code point that needs to be escaped; or
@@ -325,6 +366,10 @@ void JsonEscaping::Escape(strings::ByteSource* input,
     // iii) a character that is not a valid utf8; or
     //  iv) end of the StringPiece str is reached.
     do {
+      if (num_left == 0) {
+        i += UnescapedAsciiLength(str.substr(i));
+        if (i == str.length()) break;  // case iv
+      }
       ok = ReadCodePoint(str, i, &cp, &num_left, &num_read);
       if (num_left > 0 || !ok) break;  // case iii or iv
       escaped = EscapeCodePoint(cp, buffer, cp_was_split);
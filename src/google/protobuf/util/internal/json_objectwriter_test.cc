@@ -269,6 +269,21 @@ TEST_F(JsonObjectWriterTest, StringsEscapedAndEnclosedInDoubleQuotes) {
             output_.substr(0, out_stream_->ByteCount()));
 }
 
+TEST_F(JsonObjectWriterTest, LongStringsEscaped) {
+  ow_ = new JsonObjectWriter("", out_stream_);
+  ow_->StartObject("")
+      ->RenderString("string",
+                     "The quick brown fox jumps over the lazy dog <again>. "
+                     "0123456789abcdef\"0123456789abcdef\\"
+                     "\xc3\xa9t\xc3\xa9 and \xe2\x80\xa8 then plain text\x7f")
+      ->EndObject();
+  EXPECT_EQ(
+      "{\"string\":\"The quick brown fox jumps over the lazy dog "
+      "\\u003cagain\\u003e. 0123456789abcdef\\\"0123456789abcdef\\\\"
+      "\xc3\xa9t\xc3\xa9 and \\u2028 then plain text\\u007f\"}",
+      output_.substr(0, out_stream_->ByteCount()));
+}
+
 TEST_F(JsonObjectWriterTest, Stringification) {
   ow_ = new JsonObjectWriter("", out_stream_);
   ow_->StartObject("")
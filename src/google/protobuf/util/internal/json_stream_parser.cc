@@ -45,6 +45,10 @@
 #include <google/protobuf/util/internal/json_escaping.h>
 #include <google/protobuf/stubs/mathlimits.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 
 namespace google {
 namespace protobuf {
@@ -97,6 +101,41 @@ static bool MatchKey(StringPiece input) {
   return !input.empty() && IsLetter(input[0]);
 }
 
+// Returns the number of bytes that the byte by byte loop in
+// ParseStringHelper() steps over, one UTF-8 character at a time like
+// Advance(), before it reaches a backslash or the quote character "quote".
+// Returns str.size() if it reaches neither. Runs of ASCII characters are
+// checked 16 bytes at a time.
+static int StringRunLength(StringPiece str, char quote) {
+  const char* begin = str.data();
+  const char* end = begin + str.size();
+  const char* p = begin;
+#ifdef __SSE2__
+  const __m128i quotes = _mm_set1_epi8(quote);
+  const __m128i backslashes = _mm_set1_epi8('\\');
+  while (end - p >= 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    int special = _mm_movemask_epi8(_mm_or_si128(
+        _mm_cmpeq_epi8(chunk, quotes), _mm_cmpeq_epi8(chunk, backslashes)));
+    if (special == 0 && _mm_movemask_epi8(chunk) == 0) {
+      p += 16;
+      continue;
+    }
+    // Multi-byte characters can hide a quote or a backslash after an invalid
+    // lead byte, so step over them the same way Advance() does.
+    for (const char* chunk_end = p + 16; p < chunk_end;) {
+      if (*p == quote || *p == '\\') return p - begin;
+      p += std::min<int>(end - p, UTF8FirstLetterNumBytes(p, end - p));
+    }
+  }
+#endif
+  while (p < end) {
+    if (*p == quote || *p == '\\') return p - begin;
+    p += std::min<int>(end - p, UTF8FirstLetterNumBytes(p, end - p));
+  }
+  return str.size();
+}
+
 JsonStreamParser::JsonStreamParser(ObjectWriter* ow)
     : ow_(ow),
       stack_(),
@@ -322,6 +361,9 @@ util::Status JsonStreamParser::ParseStringHelper() {
   // Track where we last copied data from so we can minimize copying.
   const char* last = p_.data();
   while (!p_.empty()) {
+    // Step over the characters that are copied as is in one go.
+    p_.remove_prefix(StringRunLength(p_, string_open_));
+    if (p_.empty()) break;
     const char* data = p_.data();
     if (*data == '\\') {
       // We're about to handle an escape, copy all bytes from last to data.
@@ -391,8 +433,6 @@ util::Status JsonStreamParser::ParseStringHelper() {
       Advance();
       return util::Status();
     }
-    // Normal character, just advance past it.
-    Advance();
   }
   // If we ran out of characters, copy over what we have so far.
   if (last < p_.data()) {
@@ -501,7 +541,7 @@ util::Status JsonStreamParser::ParseNumber() {
   return result;
 }
 
-util::Status JsonStreamParser::ParseDoubleHelper(const std::string& number,
+util::Status JsonStreamParser::ParseDoubleHelper(StringPiece number,
                                                  NumberResult* result) {
   if (!safe_strtod(number, &result->double_val)) {
     return ReportFailure("Unable to parse number.");
@@ -544,8 +584,7 @@ util::Status JsonStreamParser::ParseNumberHelper(NumberResult* result) {
     return util::Status(util::error::CANCELLED, "");
   }
 
-  // Create a string containing just the number, so we can use safe_strtoX
-  std::string number = std::string(p_.substr(0, index));
+  StringPiece number = p_.substr(0, index);
 
   // Floating point number, parse as a double.
   if (floating) {
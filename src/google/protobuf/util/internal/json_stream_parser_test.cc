@@ -309,6 +309,23 @@ TEST_F(JsonStreamParserTest, SimpleSingleQuotedString) {
   }
 }
 
+TEST_F(JsonStreamParserTest, LongStringWithEscapes) {
+  // Long enough for runs of plain characters to be scanned in blocks, with
+  // escapes, quotes of the other kind and multi-byte characters at various
+  // offsets from the block boundaries.
+  StringPiece str =
+      "\"The quick brown fox jumps over the lazy dog. \\\"Quoted\\\" 'single'"
+      " \xc3\xa9t\xc3\xa9 \xe4\xb8\xad\xe6\x96\x87 \\u00e9\\n"
+      "0123456789abcdefghijklmnopqrstuvwxyz\\\\end\"";
+  for (int i = 0; i <= str.length(); ++i) {
+    ow_.RenderString("",
+                     "The quick brown fox jumps over the lazy dog. \"Quoted\""
+                     " 'single' \xc3\xa9t\xc3\xa9 \xe4\xb8\xad\xe6\x96\x87 "
+                     "\xc3\xa9\n0123456789abcdefghijklmnopqrstuvwxyz\\end");
+    DoTest(str, i);
+  }
+}
+
 // - string key, unquoted key, numeric key
 TEST_F(JsonStreamParserTest, ObjectKeyTypes) {
   StringPiece str =
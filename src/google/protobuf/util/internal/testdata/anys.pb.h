@@ -0,0 +1,3398 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/anys.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/duration.pb.h>
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/wrappers.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[8]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto();
+namespace proto_util_converter {
+namespace testing {
+class AnyIn;
+class AnyInDefaultTypeInternal;
+extern AnyInDefaultTypeInternal _AnyIn_default_instance_;
+class AnyM;
+class AnyMDefaultTypeInternal;
+extern AnyMDefaultTypeInternal _AnyM_default_instance_;
+class AnyOut;
+class AnyOutDefaultTypeInternal;
+extern AnyOutDefaultTypeInternal _AnyOut_default_instance_;
+class AnyTestCases;
+class AnyTestCasesDefaultTypeInternal;
+extern AnyTestCasesDefaultTypeInternal _AnyTestCases_default_instance_;
+class AnyWrapper;
+class AnyWrapperDefaultTypeInternal;
+extern AnyWrapperDefaultTypeInternal _AnyWrapper_default_instance_;
+class Data;
+class DataDefaultTypeInternal;
+extern DataDefaultTypeInternal _Data_default_instance_;
+class Data_MapDataEntry_DoNotUse;
+class Data_MapDataEntry_DoNotUseDefaultTypeInternal;
+extern Data_MapDataEntry_DoNotUseDefaultTypeInternal _Data_MapDataEntry_DoNotUse_default_instance_;
+class Imports;
+class ImportsDefaultTypeInternal;
+extern ImportsDefaultTypeInternal _Imports_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::AnyIn* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyIn>(Arena*);
+template<> ::proto_util_converter::testing::AnyM* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyM>(Arena*);
+template<> ::proto_util_converter::testing::AnyOut* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyOut>(Arena*);
+template<> ::proto_util_converter::testing::AnyTestCases* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyTestCases>(Arena*);
+template<> ::proto_util_converter::testing::AnyWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(Arena*);
+template<> ::proto_util_converter::testing::Data* Arena::CreateMaybeMessage<::proto_util_converter::testing::Data>(Arena*);
+template<> ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::Data_MapDataEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::Imports* Arena::CreateMaybeMessage<::proto_util_converter::testing::Imports>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+class AnyTestCases final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyTestCases) */ {
+ public:
+  AnyTestCases();
+  virtual ~AnyTestCases();
+
+  AnyTestCases(const AnyTestCases& from);
+  AnyTestCases(AnyTestCases&& from) noexcept
+    : AnyTestCases() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyTestCases& operator=(const AnyTestCases& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyTestCases& operator=(AnyTestCases&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const AnyTestCases& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyTestCases* internal_default_instance() {
+    return reinterpret_cast<const AnyTestCases*>(
+               &_AnyTestCases_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void Swap(AnyTestCases* other);
+  friend void swap(AnyTestCases& a, AnyTestCases& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyTestCases* New() const final {
+    return CreateMaybeMessage<AnyTestCases>(nullptr);
+  }
+
+  AnyTestCases* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyTestCases>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyTestCases& from);
+  void MergeFrom(const AnyTestCases& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyTestCases* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyTestCases";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .proto_util_converter.testing.AnyWrapper empty_any = 1;
+  bool has_empty_any() const;
+  void clear_empty_any();
+  static const int kEmptyAnyFieldNumber = 1;
+  const ::proto_util_converter::testing::AnyWrapper& empty_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_empty_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_empty_any();
+  void set_allocated_empty_any(::proto_util_converter::testing::AnyWrapper* empty_any);
+
+  // .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+  bool has_type_only_any() const;
+  void clear_type_only_any();
+  static const int kTypeOnlyAnyFieldNumber = 2;
+  const ::proto_util_converter::testing::AnyWrapper& type_only_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_type_only_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_type_only_any();
+  void set_allocated_type_only_any(::proto_util_converter::testing::AnyWrapper* type_only_any);
+
+  // .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+  bool has_wrapper_any() const;
+  void clear_wrapper_any();
+  static const int kWrapperAnyFieldNumber = 3;
+  const ::proto_util_converter::testing::AnyWrapper& wrapper_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_wrapper_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_wrapper_any();
+  void set_allocated_wrapper_any(::proto_util_converter::testing::AnyWrapper* wrapper_any);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+  bool has_any_with_timestamp_value() const;
+  void clear_any_with_timestamp_value();
+  static const int kAnyWithTimestampValueFieldNumber = 4;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_timestamp_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_timestamp_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_timestamp_value();
+  void set_allocated_any_with_timestamp_value(::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+  bool has_any_with_duration_value() const;
+  void clear_any_with_duration_value();
+  static const int kAnyWithDurationValueFieldNumber = 5;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_duration_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_duration_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_duration_value();
+  void set_allocated_any_with_duration_value(::proto_util_converter::testing::AnyWrapper* any_with_duration_value);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+  bool has_any_with_struct_value() const;
+  void clear_any_with_struct_value();
+  static const int kAnyWithStructValueFieldNumber = 6;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_struct_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_struct_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_struct_value();
+  void set_allocated_any_with_struct_value(::proto_util_converter::testing::AnyWrapper* any_with_struct_value);
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+  bool has_recursive_any() const;
+  void clear_recursive_any();
+  static const int kRecursiveAnyFieldNumber = 7;
+  const ::proto_util_converter::testing::AnyWrapper& recursive_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_recursive_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_recursive_any();
+  void set_allocated_recursive_any(::proto_util_converter::testing::AnyWrapper* recursive_any);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+  bool has_any_with_message_value() const;
+  void clear_any_with_message_value();
+  static const int kAnyWithMessageValueFieldNumber = 8;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_value();
+  void set_allocated_any_with_message_value(::proto_util_converter::testing::AnyWrapper* any_with_message_value);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+  bool has_any_with_nested_message() const;
+  void clear_any_with_nested_message();
+  static const int kAnyWithNestedMessageFieldNumber = 9;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_nested_message() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_nested_message();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_nested_message();
+  void set_allocated_any_with_nested_message(::proto_util_converter::testing::AnyWrapper* any_with_nested_message);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+  bool has_any_with_message_with_wrapper_type() const;
+  void clear_any_with_message_with_wrapper_type();
+  static const int kAnyWithMessageWithWrapperTypeFieldNumber = 10;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_with_wrapper_type() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_with_wrapper_type();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_with_wrapper_type();
+  void set_allocated_any_with_message_with_wrapper_type(::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+  bool has_any_with_message_with_timestamp() const;
+  void clear_any_with_message_with_timestamp();
+  static const int kAnyWithMessageWithTimestampFieldNumber = 11;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_with_timestamp() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_with_timestamp();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_with_timestamp();
+  void set_allocated_any_with_message_with_timestamp(::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+  bool has_any_with_message_containing_map() const;
+  void clear_any_with_message_containing_map();
+  static const int kAnyWithMessageContainingMapFieldNumber = 12;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_map() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_containing_map();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_containing_map();
+  void set_allocated_any_with_message_containing_map(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+  bool has_any_with_message_containing_struct() const;
+  void clear_any_with_message_containing_struct();
+  static const int kAnyWithMessageContainingStructFieldNumber = 13;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_struct() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_containing_struct();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_containing_struct();
+  void set_allocated_any_with_message_containing_struct(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct);
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+  bool has_any_with_message_containing_repeated_message() const;
+  void clear_any_with_message_containing_repeated_message();
+  static const int kAnyWithMessageContainingRepeatedMessageFieldNumber = 14;
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_repeated_message() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_containing_repeated_message();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_containing_repeated_message();
+  void set_allocated_any_with_message_containing_repeated_message(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message);
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+  bool has_recursive_any_with_type_field_at_end() const;
+  void clear_recursive_any_with_type_field_at_end();
+  static const int kRecursiveAnyWithTypeFieldAtEndFieldNumber = 15;
+  const ::proto_util_converter::testing::AnyWrapper& recursive_any_with_type_field_at_end() const;
+  ::proto_util_converter::testing::AnyWrapper* release_recursive_any_with_type_field_at_end();
+  ::proto_util_converter::testing::AnyWrapper* mutable_recursive_any_with_type_field_at_end();
+  void set_allocated_recursive_any_with_type_field_at_end(::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end);
+
+  // .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+  bool has_repeated_any() const;
+  void clear_repeated_any();
+  static const int kRepeatedAnyFieldNumber = 16;
+  const ::proto_util_converter::testing::AnyWrapper& repeated_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_repeated_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_repeated_any();
+  void set_allocated_repeated_any(::proto_util_converter::testing::AnyWrapper* repeated_any);
+
+  // .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+  bool has_empty_any_with_null_type_url() const;
+  void clear_empty_any_with_null_type_url();
+  static const int kEmptyAnyWithNullTypeUrlFieldNumber = 17;
+  const ::proto_util_converter::testing::AnyWrapper& empty_any_with_null_type_url() const;
+  ::proto_util_converter::testing::AnyWrapper* release_empty_any_with_null_type_url();
+  ::proto_util_converter::testing::AnyWrapper* mutable_empty_any_with_null_type_url();
+  void set_allocated_empty_any_with_null_type_url(::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url);
+
+  // .google.protobuf.Any top_level_any = 50;
+  bool has_top_level_any() const;
+  void clear_top_level_any();
+  static const int kTopLevelAnyFieldNumber = 50;
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any();
+  void set_allocated_top_level_any(PROTOBUF_NAMESPACE_ID::Any* top_level_any);
+
+  // .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+  bool has_top_level_any_with_type_field_at_end() const;
+  void clear_top_level_any_with_type_field_at_end();
+  static const int kTopLevelAnyWithTypeFieldAtEndFieldNumber = 51;
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_type_field_at_end() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_with_type_field_at_end();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_with_type_field_at_end();
+  void set_allocated_top_level_any_with_type_field_at_end(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end);
+
+  // .google.protobuf.Any top_level_any_with_pivot_one = 52;
+  bool has_top_level_any_with_pivot_one() const;
+  void clear_top_level_any_with_pivot_one();
+  static const int kTopLevelAnyWithPivotOneFieldNumber = 52;
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_pivot_one() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_with_pivot_one();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_with_pivot_one();
+  void set_allocated_top_level_any_with_pivot_one(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one);
+
+  // .google.protobuf.Any top_level_any_with_pivot_two = 53;
+  bool has_top_level_any_with_pivot_two() const;
+  void clear_top_level_any_with_pivot_two();
+  static const int kTopLevelAnyWithPivotTwoFieldNumber = 53;
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_pivot_two() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_with_pivot_two();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_with_pivot_two();
+  void set_allocated_top_level_any_with_pivot_two(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two);
+
+  // .google.protobuf.Any top_level_any_unordered = 54;
+  bool has_top_level_any_unordered() const;
+  void clear_top_level_any_unordered();
+  static const int kTopLevelAnyUnorderedFieldNumber = 54;
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_unordered() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_unordered();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_unordered();
+  void set_allocated_top_level_any_unordered(PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyTestCases)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::proto_util_converter::testing::AnyWrapper* empty_any_;
+  ::proto_util_converter::testing::AnyWrapper* type_only_any_;
+  ::proto_util_converter::testing::AnyWrapper* wrapper_any_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_duration_value_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_struct_value_;
+  ::proto_util_converter::testing::AnyWrapper* recursive_any_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_value_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_nested_message_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message_;
+  ::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end_;
+  ::proto_util_converter::testing::AnyWrapper* repeated_any_;
+  ::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyWrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyWrapper) */ {
+ public:
+  AnyWrapper();
+  virtual ~AnyWrapper();
+
+  AnyWrapper(const AnyWrapper& from);
+  AnyWrapper(AnyWrapper&& from) noexcept
+    : AnyWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyWrapper& operator=(const AnyWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyWrapper& operator=(AnyWrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const AnyWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyWrapper* internal_default_instance() {
+    return reinterpret_cast<const AnyWrapper*>(
+               &_AnyWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  void Swap(AnyWrapper* other);
+  friend void swap(AnyWrapper& a, AnyWrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyWrapper* New() const final {
+    return CreateMaybeMessage<AnyWrapper>(nullptr);
+  }
+
+  AnyWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyWrapper& from);
+  void MergeFrom(const AnyWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyWrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.Any any = 1;
+  bool has_any() const;
+  void clear_any();
+  static const int kAnyFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::Any& any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any();
+  void set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyWrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::Any* any_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Imports final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Imports) */ {
+ public:
+  Imports();
+  virtual ~Imports();
+
+  Imports(const Imports& from);
+  Imports(Imports&& from) noexcept
+    : Imports() {
+    *this = ::std::move(from);
+  }
+
+  inline Imports& operator=(const Imports& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Imports& operator=(Imports&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Imports& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Imports* internal_default_instance() {
+    return reinterpret_cast<const Imports*>(
+               &_Imports_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(Imports* other);
+  friend void swap(Imports& a, Imports& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Imports* New() const final {
+    return CreateMaybeMessage<Imports>(nullptr);
+  }
+
+  Imports* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Imports>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Imports& from);
+  void MergeFrom(const Imports& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Imports* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Imports";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.DoubleValue dbl = 1;
+  bool has_dbl() const;
+  void clear_dbl();
+  static const int kDblFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& dbl() const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* release_dbl();
+  PROTOBUF_NAMESPACE_ID::DoubleValue* mutable_dbl();
+  void set_allocated_dbl(PROTOBUF_NAMESPACE_ID::DoubleValue* dbl);
+
+  // .google.protobuf.Struct struct = 2;
+  bool has_struct_() const;
+  void clear_struct_();
+  static const int kStructFieldNumber = 2;
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_() const;
+  PROTOBUF_NAMESPACE_ID::Struct* release_struct_();
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_();
+  void set_allocated_struct_(PROTOBUF_NAMESPACE_ID::Struct* struct_);
+
+  // .google.protobuf.Timestamp timestamp = 3;
+  bool has_timestamp() const;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 3;
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+
+  // .google.protobuf.Duration duration = 4;
+  bool has_duration() const;
+  void clear_duration();
+  static const int kDurationFieldNumber = 4;
+  const PROTOBUF_NAMESPACE_ID::Duration& duration() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_duration();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration();
+  void set_allocated_duration(PROTOBUF_NAMESPACE_ID::Duration* duration);
+
+  // .google.protobuf.Int32Value i32 = 5;
+  bool has_i32() const;
+  void clear_i32();
+  static const int kI32FieldNumber = 5;
+  const PROTOBUF_NAMESPACE_ID::Int32Value& i32() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_i32();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_i32();
+  void set_allocated_i32(PROTOBUF_NAMESPACE_ID::Int32Value* i32);
+
+  // .proto_util_converter.testing.Data data = 100;
+  bool has_data() const;
+  void clear_data();
+  static const int kDataFieldNumber = 100;
+  const ::proto_util_converter::testing::Data& data() const;
+  ::proto_util_converter::testing::Data* release_data();
+  ::proto_util_converter::testing::Data* mutable_data();
+  void set_allocated_data(::proto_util_converter::testing::Data* data);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Imports)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* dbl_;
+  PROTOBUF_NAMESPACE_ID::Struct* struct__;
+  PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
+  PROTOBUF_NAMESPACE_ID::Duration* duration_;
+  PROTOBUF_NAMESPACE_ID::Int32Value* i32_;
+  ::proto_util_converter::testing::Data* data_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Data_MapDataEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Data_MapDataEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Data_MapDataEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  Data_MapDataEntry_DoNotUse();
+  Data_MapDataEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Data_MapDataEntry_DoNotUse& other);
+  static const Data_MapDataEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Data_MapDataEntry_DoNotUse*>(&_Data_MapDataEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.Data.MapDataEntry.key");
+ }
+  bool ValidateValue() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.Data.MapDataEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class Data final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Data) */ {
+ public:
+  Data();
+  virtual ~Data();
+
+  Data(const Data& from);
+  Data(Data&& from) noexcept
+    : Data() {
+    *this = ::std::move(from);
+  }
+
+  inline Data& operator=(const Data& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Data& operator=(Data&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Data& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Data* internal_default_instance() {
+    return reinterpret_cast<const Data*>(
+               &_Data_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  void Swap(Data* other);
+  friend void swap(Data& a, Data& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Data* New() const final {
+    return CreateMaybeMessage<Data>(nullptr);
+  }
+
+  Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Data>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Data& from);
+  void MergeFrom(const Data& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Data* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Data";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // repeated string msgs = 3;
+  int msgs_size() const;
+  void clear_msgs();
+  static const int kMsgsFieldNumber = 3;
+  const std::string& msgs(int index) const;
+  std::string* mutable_msgs(int index);
+  void set_msgs(int index, const std::string& value);
+  void set_msgs(int index, std::string&& value);
+  void set_msgs(int index, const char* value);
+  void set_msgs(int index, const char* value, size_t size);
+  std::string* add_msgs();
+  void add_msgs(const std::string& value);
+  void add_msgs(std::string&& value);
+  void add_msgs(const char* value);
+  void add_msgs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& msgs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_msgs();
+
+  // map<string, string> map_data = 7;
+  int map_data_size() const;
+  void clear_map_data();
+  static const int kMapDataFieldNumber = 7;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_data() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_data();
+
+  // repeated .proto_util_converter.testing.Data repeated_data = 9;
+  int repeated_data_size() const;
+  void clear_repeated_data();
+  static const int kRepeatedDataFieldNumber = 9;
+  ::proto_util_converter::testing::Data* mutable_repeated_data(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >*
+      mutable_repeated_data();
+  const ::proto_util_converter::testing::Data& repeated_data(int index) const;
+  ::proto_util_converter::testing::Data* add_repeated_data();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >&
+      repeated_data() const;
+
+  // repeated .google.protobuf.Any repeated_any = 10;
+  int repeated_any_size() const;
+  void clear_repeated_any();
+  static const int kRepeatedAnyFieldNumber = 10;
+  PROTOBUF_NAMESPACE_ID::Any* mutable_repeated_any(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >*
+      mutable_repeated_any();
+  const PROTOBUF_NAMESPACE_ID::Any& repeated_any(int index) const;
+  PROTOBUF_NAMESPACE_ID::Any* add_repeated_any();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >&
+      repeated_any() const;
+
+  // string str = 2;
+  void clear_str();
+  static const int kStrFieldNumber = 2;
+  const std::string& str() const;
+  void set_str(const std::string& value);
+  void set_str(std::string&& value);
+  void set_str(const char* value);
+  void set_str(const char* value, size_t size);
+  std::string* mutable_str();
+  std::string* release_str();
+  void set_allocated_str(std::string* str);
+
+  // .proto_util_converter.testing.Data nested_data = 4;
+  bool has_nested_data() const;
+  void clear_nested_data();
+  static const int kNestedDataFieldNumber = 4;
+  const ::proto_util_converter::testing::Data& nested_data() const;
+  ::proto_util_converter::testing::Data* release_nested_data();
+  ::proto_util_converter::testing::Data* mutable_nested_data();
+  void set_allocated_nested_data(::proto_util_converter::testing::Data* nested_data);
+
+  // .google.protobuf.Int32Value int_wrapper = 5;
+  bool has_int_wrapper() const;
+  void clear_int_wrapper();
+  static const int kIntWrapperFieldNumber = 5;
+  const PROTOBUF_NAMESPACE_ID::Int32Value& int_wrapper() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_int_wrapper();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_int_wrapper();
+  void set_allocated_int_wrapper(PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper);
+
+  // .google.protobuf.Timestamp time = 6;
+  bool has_time() const;
+  void clear_time();
+  static const int kTimeFieldNumber = 6;
+  const PROTOBUF_NAMESPACE_ID::Timestamp& time() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_time();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_time();
+  void set_allocated_time(PROTOBUF_NAMESPACE_ID::Timestamp* time);
+
+  // .google.protobuf.Struct struct_data = 8;
+  bool has_struct_data() const;
+  void clear_struct_data();
+  static const int kStructDataFieldNumber = 8;
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_data() const;
+  PROTOBUF_NAMESPACE_ID::Struct* release_struct_data();
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_data();
+  void set_allocated_struct_data(PROTOBUF_NAMESPACE_ID::Struct* struct_data);
+
+  // int32 attr = 1;
+  void clear_attr();
+  static const int kAttrFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 attr() const;
+  void set_attr(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Data)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> msgs_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      Data_MapDataEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_data_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data > repeated_data_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any > repeated_any_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_;
+  ::proto_util_converter::testing::Data* nested_data_;
+  PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper_;
+  PROTOBUF_NAMESPACE_ID::Timestamp* time_;
+  PROTOBUF_NAMESPACE_ID::Struct* struct_data_;
+  ::PROTOBUF_NAMESPACE_ID::int32 attr_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyIn final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyIn) */ {
+ public:
+  AnyIn();
+  virtual ~AnyIn();
+
+  AnyIn(const AnyIn& from);
+  AnyIn(AnyIn&& from) noexcept
+    : AnyIn() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyIn& operator=(const AnyIn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyIn& operator=(AnyIn&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const AnyIn& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyIn* internal_default_instance() {
+    return reinterpret_cast<const AnyIn*>(
+               &_AnyIn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  void Swap(AnyIn* other);
+  friend void swap(AnyIn& a, AnyIn& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyIn* New() const final {
+    return CreateMaybeMessage<AnyIn>(nullptr);
+  }
+
+  AnyIn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyIn>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyIn& from);
+  void MergeFrom(const AnyIn& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyIn* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyIn";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string something = 1;
+  void clear_something();
+  static const int kSomethingFieldNumber = 1;
+  const std::string& something() const;
+  void set_something(const std::string& value);
+  void set_something(std::string&& value);
+  void set_something(const char* value);
+  void set_something(const char* value, size_t size);
+  std::string* mutable_something();
+  std::string* release_something();
+  void set_allocated_something(std::string* something);
+
+  // .google.protobuf.Any any = 2;
+  bool has_any() const;
+  void clear_any();
+  static const int kAnyFieldNumber = 2;
+  const PROTOBUF_NAMESPACE_ID::Any& any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any();
+  void set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyIn)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr something_;
+  PROTOBUF_NAMESPACE_ID::Any* any_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyOut final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyOut) */ {
+ public:
+  AnyOut();
+  virtual ~AnyOut();
+
+  AnyOut(const AnyOut& from);
+  AnyOut(AnyOut&& from) noexcept
+    : AnyOut() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyOut& operator=(const AnyOut& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyOut& operator=(AnyOut&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const AnyOut& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyOut* internal_default_instance() {
+    return reinterpret_cast<const AnyOut*>(
+               &_AnyOut_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  void Swap(AnyOut* other);
+  friend void swap(AnyOut& a, AnyOut& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyOut* New() const final {
+    return CreateMaybeMessage<AnyOut>(nullptr);
+  }
+
+  AnyOut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyOut>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyOut& from);
+  void MergeFrom(const AnyOut& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyOut* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyOut";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.Any any = 1;
+  bool has_any() const;
+  void clear_any();
+  static const int kAnyFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::Any& any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any();
+  void set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyOut)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::Any* any_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyM final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyM) */ {
+ public:
+  AnyM();
+  virtual ~AnyM();
+
+  AnyM(const AnyM& from);
+  AnyM(AnyM&& from) noexcept
+    : AnyM() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyM& operator=(const AnyM& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyM& operator=(AnyM&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const AnyM& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyM* internal_default_instance() {
+    return reinterpret_cast<const AnyM*>(
+               &_AnyM_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  void Swap(AnyM* other);
+  friend void swap(AnyM& a, AnyM& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyM* New() const final {
+    return CreateMaybeMessage<AnyM>(nullptr);
+  }
+
+  AnyM* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyM>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyM& from);
+  void MergeFrom(const AnyM& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyM* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyM";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string foo = 1;
+  void clear_foo();
+  static const int kFooFieldNumber = 1;
+  const std::string& foo() const;
+  void set_foo(const std::string& value);
+  void set_foo(std::string&& value);
+  void set_foo(const char* value);
+  void set_foo(const char* value, size_t size);
+  std::string* mutable_foo();
+  std::string* release_foo();
+  void set_allocated_foo(std::string* foo);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyM)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr foo_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// AnyTestCases
+
+// .proto_util_converter.testing.AnyWrapper empty_any = 1;
+inline bool AnyTestCases::has_empty_any() const {
+  return this != internal_default_instance() && empty_any_ != nullptr;
+}
+inline void AnyTestCases::clear_empty_any() {
+  if (GetArenaNoVirtual() == nullptr && empty_any_ != nullptr) {
+    delete empty_any_;
+  }
+  empty_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::empty_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = empty_any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.empty_any)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_empty_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.empty_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = empty_any_;
+  empty_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_empty_any() {
+  
+  if (empty_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    empty_any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.empty_any)
+  return empty_any_;
+}
+inline void AnyTestCases::set_allocated_empty_any(::proto_util_converter::testing::AnyWrapper* empty_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_any_;
+  }
+  if (empty_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_any_ = empty_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.empty_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+inline bool AnyTestCases::has_type_only_any() const {
+  return this != internal_default_instance() && type_only_any_ != nullptr;
+}
+inline void AnyTestCases::clear_type_only_any() {
+  if (GetArenaNoVirtual() == nullptr && type_only_any_ != nullptr) {
+    delete type_only_any_;
+  }
+  type_only_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::type_only_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = type_only_any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.type_only_any)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_type_only_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.type_only_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = type_only_any_;
+  type_only_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_type_only_any() {
+  
+  if (type_only_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    type_only_any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.type_only_any)
+  return type_only_any_;
+}
+inline void AnyTestCases::set_allocated_type_only_any(::proto_util_converter::testing::AnyWrapper* type_only_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete type_only_any_;
+  }
+  if (type_only_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      type_only_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, type_only_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  type_only_any_ = type_only_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.type_only_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+inline bool AnyTestCases::has_wrapper_any() const {
+  return this != internal_default_instance() && wrapper_any_ != nullptr;
+}
+inline void AnyTestCases::clear_wrapper_any() {
+  if (GetArenaNoVirtual() == nullptr && wrapper_any_ != nullptr) {
+    delete wrapper_any_;
+  }
+  wrapper_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::wrapper_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = wrapper_any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.wrapper_any)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_wrapper_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.wrapper_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = wrapper_any_;
+  wrapper_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_wrapper_any() {
+  
+  if (wrapper_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    wrapper_any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.wrapper_any)
+  return wrapper_any_;
+}
+inline void AnyTestCases::set_allocated_wrapper_any(::proto_util_converter::testing::AnyWrapper* wrapper_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete wrapper_any_;
+  }
+  if (wrapper_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      wrapper_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, wrapper_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  wrapper_any_ = wrapper_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.wrapper_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+inline bool AnyTestCases::has_any_with_timestamp_value() const {
+  return this != internal_default_instance() && any_with_timestamp_value_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_timestamp_value() {
+  if (GetArenaNoVirtual() == nullptr && any_with_timestamp_value_ != nullptr) {
+    delete any_with_timestamp_value_;
+  }
+  any_with_timestamp_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_timestamp_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_timestamp_value_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_timestamp_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_timestamp_value_;
+  any_with_timestamp_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_timestamp_value() {
+  
+  if (any_with_timestamp_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_timestamp_value_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+  return any_with_timestamp_value_;
+}
+inline void AnyTestCases::set_allocated_any_with_timestamp_value(::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_timestamp_value_;
+  }
+  if (any_with_timestamp_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_timestamp_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_timestamp_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_timestamp_value_ = any_with_timestamp_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+inline bool AnyTestCases::has_any_with_duration_value() const {
+  return this != internal_default_instance() && any_with_duration_value_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_duration_value() {
+  if (GetArenaNoVirtual() == nullptr && any_with_duration_value_ != nullptr) {
+    delete any_with_duration_value_;
+  }
+  any_with_duration_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_duration_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_duration_value_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_duration_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_duration_value_;
+  any_with_duration_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_duration_value() {
+  
+  if (any_with_duration_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_duration_value_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+  return any_with_duration_value_;
+}
+inline void AnyTestCases::set_allocated_any_with_duration_value(::proto_util_converter::testing::AnyWrapper* any_with_duration_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_duration_value_;
+  }
+  if (any_with_duration_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_duration_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_duration_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_duration_value_ = any_with_duration_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+inline bool AnyTestCases::has_any_with_struct_value() const {
+  return this != internal_default_instance() && any_with_struct_value_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_struct_value() {
+  if (GetArenaNoVirtual() == nullptr && any_with_struct_value_ != nullptr) {
+    delete any_with_struct_value_;
+  }
+  any_with_struct_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_struct_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_struct_value_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_struct_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_struct_value_;
+  any_with_struct_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_struct_value() {
+  
+  if (any_with_struct_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_struct_value_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+  return any_with_struct_value_;
+}
+inline void AnyTestCases::set_allocated_any_with_struct_value(::proto_util_converter::testing::AnyWrapper* any_with_struct_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_struct_value_;
+  }
+  if (any_with_struct_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_struct_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_struct_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_struct_value_ = any_with_struct_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+inline bool AnyTestCases::has_recursive_any() const {
+  return this != internal_default_instance() && recursive_any_ != nullptr;
+}
+inline void AnyTestCases::clear_recursive_any() {
+  if (GetArenaNoVirtual() == nullptr && recursive_any_ != nullptr) {
+    delete recursive_any_;
+  }
+  recursive_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::recursive_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = recursive_any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.recursive_any)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_recursive_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.recursive_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = recursive_any_;
+  recursive_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_recursive_any() {
+  
+  if (recursive_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    recursive_any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.recursive_any)
+  return recursive_any_;
+}
+inline void AnyTestCases::set_allocated_recursive_any(::proto_util_converter::testing::AnyWrapper* recursive_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete recursive_any_;
+  }
+  if (recursive_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      recursive_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, recursive_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  recursive_any_ = recursive_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.recursive_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+inline bool AnyTestCases::has_any_with_message_value() const {
+  return this != internal_default_instance() && any_with_message_value_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_message_value() {
+  if (GetArenaNoVirtual() == nullptr && any_with_message_value_ != nullptr) {
+    delete any_with_message_value_;
+  }
+  any_with_message_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_value_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_value_;
+  any_with_message_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_value() {
+  
+  if (any_with_message_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_message_value_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+  return any_with_message_value_;
+}
+inline void AnyTestCases::set_allocated_any_with_message_value(::proto_util_converter::testing::AnyWrapper* any_with_message_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_message_value_;
+  }
+  if (any_with_message_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_message_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_value_ = any_with_message_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+inline bool AnyTestCases::has_any_with_nested_message() const {
+  return this != internal_default_instance() && any_with_nested_message_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_nested_message() {
+  if (GetArenaNoVirtual() == nullptr && any_with_nested_message_ != nullptr) {
+    delete any_with_nested_message_;
+  }
+  any_with_nested_message_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_nested_message() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_nested_message_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_nested_message() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_nested_message_;
+  any_with_nested_message_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_nested_message() {
+  
+  if (any_with_nested_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_nested_message_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+  return any_with_nested_message_;
+}
+inline void AnyTestCases::set_allocated_any_with_nested_message(::proto_util_converter::testing::AnyWrapper* any_with_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_nested_message_;
+  }
+  if (any_with_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_nested_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_nested_message_ = any_with_nested_message;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+inline bool AnyTestCases::has_any_with_message_with_wrapper_type() const {
+  return this != internal_default_instance() && any_with_message_with_wrapper_type_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_message_with_wrapper_type() {
+  if (GetArenaNoVirtual() == nullptr && any_with_message_with_wrapper_type_ != nullptr) {
+    delete any_with_message_with_wrapper_type_;
+  }
+  any_with_message_with_wrapper_type_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_with_wrapper_type() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_with_wrapper_type_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_with_wrapper_type() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_with_wrapper_type_;
+  any_with_message_with_wrapper_type_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_with_wrapper_type() {
+  
+  if (any_with_message_with_wrapper_type_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_message_with_wrapper_type_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+  return any_with_message_with_wrapper_type_;
+}
+inline void AnyTestCases::set_allocated_any_with_message_with_wrapper_type(::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_message_with_wrapper_type_;
+  }
+  if (any_with_message_with_wrapper_type) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_message_with_wrapper_type = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_with_wrapper_type, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_with_wrapper_type_ = any_with_message_with_wrapper_type;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+inline bool AnyTestCases::has_any_with_message_with_timestamp() const {
+  return this != internal_default_instance() && any_with_message_with_timestamp_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_message_with_timestamp() {
+  if (GetArenaNoVirtual() == nullptr && any_with_message_with_timestamp_ != nullptr) {
+    delete any_with_message_with_timestamp_;
+  }
+  any_with_message_with_timestamp_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_with_timestamp() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_with_timestamp_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_with_timestamp() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_with_timestamp_;
+  any_with_message_with_timestamp_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_with_timestamp() {
+  
+  if (any_with_message_with_timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_message_with_timestamp_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+  return any_with_message_with_timestamp_;
+}
+inline void AnyTestCases::set_allocated_any_with_message_with_timestamp(::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_message_with_timestamp_;
+  }
+  if (any_with_message_with_timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_message_with_timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_with_timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_with_timestamp_ = any_with_message_with_timestamp;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+inline bool AnyTestCases::has_any_with_message_containing_map() const {
+  return this != internal_default_instance() && any_with_message_containing_map_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_message_containing_map() {
+  if (GetArenaNoVirtual() == nullptr && any_with_message_containing_map_ != nullptr) {
+    delete any_with_message_containing_map_;
+  }
+  any_with_message_containing_map_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_containing_map() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_containing_map_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_containing_map() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_map_;
+  any_with_message_containing_map_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_containing_map() {
+  
+  if (any_with_message_containing_map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_message_containing_map_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+  return any_with_message_containing_map_;
+}
+inline void AnyTestCases::set_allocated_any_with_message_containing_map(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_message_containing_map_;
+  }
+  if (any_with_message_containing_map) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_message_containing_map = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_containing_map, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_containing_map_ = any_with_message_containing_map;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+inline bool AnyTestCases::has_any_with_message_containing_struct() const {
+  return this != internal_default_instance() && any_with_message_containing_struct_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_message_containing_struct() {
+  if (GetArenaNoVirtual() == nullptr && any_with_message_containing_struct_ != nullptr) {
+    delete any_with_message_containing_struct_;
+  }
+  any_with_message_containing_struct_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_containing_struct() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_containing_struct_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_containing_struct() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_struct_;
+  any_with_message_containing_struct_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_containing_struct() {
+  
+  if (any_with_message_containing_struct_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_message_containing_struct_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+  return any_with_message_containing_struct_;
+}
+inline void AnyTestCases::set_allocated_any_with_message_containing_struct(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_message_containing_struct_;
+  }
+  if (any_with_message_containing_struct) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_message_containing_struct = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_containing_struct, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_containing_struct_ = any_with_message_containing_struct;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+inline bool AnyTestCases::has_any_with_message_containing_repeated_message() const {
+  return this != internal_default_instance() && any_with_message_containing_repeated_message_ != nullptr;
+}
+inline void AnyTestCases::clear_any_with_message_containing_repeated_message() {
+  if (GetArenaNoVirtual() == nullptr && any_with_message_containing_repeated_message_ != nullptr) {
+    delete any_with_message_containing_repeated_message_;
+  }
+  any_with_message_containing_repeated_message_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_containing_repeated_message() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_containing_repeated_message_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_containing_repeated_message() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_repeated_message_;
+  any_with_message_containing_repeated_message_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_containing_repeated_message() {
+  
+  if (any_with_message_containing_repeated_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    any_with_message_containing_repeated_message_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+  return any_with_message_containing_repeated_message_;
+}
+inline void AnyTestCases::set_allocated_any_with_message_containing_repeated_message(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete any_with_message_containing_repeated_message_;
+  }
+  if (any_with_message_containing_repeated_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any_with_message_containing_repeated_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_containing_repeated_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_containing_repeated_message_ = any_with_message_containing_repeated_message;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+}
+
+// .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+inline bool AnyTestCases::has_recursive_any_with_type_field_at_end() const {
+  return this != internal_default_instance() && recursive_any_with_type_field_at_end_ != nullptr;
+}
+inline void AnyTestCases::clear_recursive_any_with_type_field_at_end() {
+  if (GetArenaNoVirtual() == nullptr && recursive_any_with_type_field_at_end_ != nullptr) {
+    delete recursive_any_with_type_field_at_end_;
+  }
+  recursive_any_with_type_field_at_end_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::recursive_any_with_type_field_at_end() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = recursive_any_with_type_field_at_end_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_recursive_any_with_type_field_at_end() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = recursive_any_with_type_field_at_end_;
+  recursive_any_with_type_field_at_end_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_recursive_any_with_type_field_at_end() {
+  
+  if (recursive_any_with_type_field_at_end_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    recursive_any_with_type_field_at_end_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+  return recursive_any_with_type_field_at_end_;
+}
+inline void AnyTestCases::set_allocated_recursive_any_with_type_field_at_end(::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete recursive_any_with_type_field_at_end_;
+  }
+  if (recursive_any_with_type_field_at_end) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      recursive_any_with_type_field_at_end = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, recursive_any_with_type_field_at_end, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  recursive_any_with_type_field_at_end_ = recursive_any_with_type_field_at_end;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+}
+
+// .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+inline bool AnyTestCases::has_repeated_any() const {
+  return this != internal_default_instance() && repeated_any_ != nullptr;
+}
+inline void AnyTestCases::clear_repeated_any() {
+  if (GetArenaNoVirtual() == nullptr && repeated_any_ != nullptr) {
+    delete repeated_any_;
+  }
+  repeated_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::repeated_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = repeated_any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.repeated_any)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_repeated_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.repeated_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = repeated_any_;
+  repeated_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_repeated_any() {
+  
+  if (repeated_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    repeated_any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.repeated_any)
+  return repeated_any_;
+}
+inline void AnyTestCases::set_allocated_repeated_any(::proto_util_converter::testing::AnyWrapper* repeated_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete repeated_any_;
+  }
+  if (repeated_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      repeated_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, repeated_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  repeated_any_ = repeated_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.repeated_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+inline bool AnyTestCases::has_empty_any_with_null_type_url() const {
+  return this != internal_default_instance() && empty_any_with_null_type_url_ != nullptr;
+}
+inline void AnyTestCases::clear_empty_any_with_null_type_url() {
+  if (GetArenaNoVirtual() == nullptr && empty_any_with_null_type_url_ != nullptr) {
+    delete empty_any_with_null_type_url_;
+  }
+  empty_any_with_null_type_url_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::empty_any_with_null_type_url() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = empty_any_with_null_type_url_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_empty_any_with_null_type_url() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = empty_any_with_null_type_url_;
+  empty_any_with_null_type_url_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_empty_any_with_null_type_url() {
+  
+  if (empty_any_with_null_type_url_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    empty_any_with_null_type_url_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+  return empty_any_with_null_type_url_;
+}
+inline void AnyTestCases::set_allocated_empty_any_with_null_type_url(::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_any_with_null_type_url_;
+  }
+  if (empty_any_with_null_type_url) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_any_with_null_type_url = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_any_with_null_type_url, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_any_with_null_type_url_ = empty_any_with_null_type_url;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+}
+
+// .google.protobuf.Any top_level_any = 50;
+inline bool AnyTestCases::has_top_level_any() const {
+  return this != internal_default_instance() && top_level_any_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_;
+  top_level_any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any() {
+  
+  if (top_level_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    top_level_any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any)
+  return top_level_any_;
+}
+inline void AnyTestCases::set_allocated_top_level_any(PROTOBUF_NAMESPACE_ID::Any* top_level_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_);
+  }
+  if (top_level_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      top_level_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_ = top_level_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any)
+}
+
+// .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+inline bool AnyTestCases::has_top_level_any_with_type_field_at_end() const {
+  return this != internal_default_instance() && top_level_any_with_type_field_at_end_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_with_type_field_at_end() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_with_type_field_at_end_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_with_type_field_at_end() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_type_field_at_end_;
+  top_level_any_with_type_field_at_end_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_with_type_field_at_end() {
+  
+  if (top_level_any_with_type_field_at_end_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    top_level_any_with_type_field_at_end_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+  return top_level_any_with_type_field_at_end_;
+}
+inline void AnyTestCases::set_allocated_top_level_any_with_type_field_at_end(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_type_field_at_end_);
+  }
+  if (top_level_any_with_type_field_at_end) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      top_level_any_with_type_field_at_end = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_with_type_field_at_end, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_with_type_field_at_end_ = top_level_any_with_type_field_at_end;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+}
+
+// .google.protobuf.Any top_level_any_with_pivot_one = 52;
+inline bool AnyTestCases::has_top_level_any_with_pivot_one() const {
+  return this != internal_default_instance() && top_level_any_with_pivot_one_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_with_pivot_one() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_with_pivot_one_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_with_pivot_one() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_pivot_one_;
+  top_level_any_with_pivot_one_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_with_pivot_one() {
+  
+  if (top_level_any_with_pivot_one_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    top_level_any_with_pivot_one_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+  return top_level_any_with_pivot_one_;
+}
+inline void AnyTestCases::set_allocated_top_level_any_with_pivot_one(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_one_);
+  }
+  if (top_level_any_with_pivot_one) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      top_level_any_with_pivot_one = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_with_pivot_one, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_with_pivot_one_ = top_level_any_with_pivot_one;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+}
+
+// .google.protobuf.Any top_level_any_with_pivot_two = 53;
+inline bool AnyTestCases::has_top_level_any_with_pivot_two() const {
+  return this != internal_default_instance() && top_level_any_with_pivot_two_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_with_pivot_two() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_with_pivot_two_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_with_pivot_two() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_pivot_two_;
+  top_level_any_with_pivot_two_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_with_pivot_two() {
+  
+  if (top_level_any_with_pivot_two_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    top_level_any_with_pivot_two_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+  return top_level_any_with_pivot_two_;
+}
+inline void AnyTestCases::set_allocated_top_level_any_with_pivot_two(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_two_);
+  }
+  if (top_level_any_with_pivot_two) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      top_level_any_with_pivot_two = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_with_pivot_two, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_with_pivot_two_ = top_level_any_with_pivot_two;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+}
+
+// .google.protobuf.Any top_level_any_unordered = 54;
+inline bool AnyTestCases::has_top_level_any_unordered() const {
+  return this != internal_default_instance() && top_level_any_unordered_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_unordered() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_unordered_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_unordered() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_unordered_;
+  top_level_any_unordered_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_unordered() {
+  
+  if (top_level_any_unordered_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    top_level_any_unordered_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+  return top_level_any_unordered_;
+}
+inline void AnyTestCases::set_allocated_top_level_any_unordered(PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_unordered_);
+  }
+  if (top_level_any_unordered) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      top_level_any_unordered = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_unordered, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_unordered_ = top_level_any_unordered;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+}
+
+// -------------------------------------------------------------------
+
+// AnyWrapper
+
+// .google.protobuf.Any any = 1;
+inline bool AnyWrapper::has_any() const {
+  return this != internal_default_instance() && any_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyWrapper::any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyWrapper.any)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyWrapper::release_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyWrapper.any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyWrapper::mutable_any() {
+  
+  if (any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyWrapper.any)
+  return any_;
+}
+inline void AnyWrapper::set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  if (any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_ = any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyWrapper.any)
+}
+
+// -------------------------------------------------------------------
+
+// Imports
+
+// .google.protobuf.DoubleValue dbl = 1;
+inline bool Imports::has_dbl() const {
+  return this != internal_default_instance() && dbl_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& Imports::dbl() const {
+  const PROTOBUF_NAMESPACE_ID::DoubleValue* p = dbl_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.dbl)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      &PROTOBUF_NAMESPACE_ID::_DoubleValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* Imports::release_dbl() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.dbl)
+  
+  PROTOBUF_NAMESPACE_ID::DoubleValue* temp = dbl_;
+  dbl_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* Imports::mutable_dbl() {
+  
+  if (dbl_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::DoubleValue>(GetArenaNoVirtual());
+    dbl_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.dbl)
+  return dbl_;
+}
+inline void Imports::set_allocated_dbl(PROTOBUF_NAMESPACE_ID::DoubleValue* dbl) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dbl_);
+  }
+  if (dbl) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dbl)->GetArena();
+    if (message_arena != submessage_arena) {
+      dbl = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dbl, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  dbl_ = dbl;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.dbl)
+}
+
+// .google.protobuf.Struct struct = 2;
+inline bool Imports::has_struct_() const {
+  return this != internal_default_instance() && struct__ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& Imports::struct_() const {
+  const PROTOBUF_NAMESPACE_ID::Struct* p = struct__;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.struct)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Struct*>(
+      &PROTOBUF_NAMESPACE_ID::_Struct_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Imports::release_struct_() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.struct)
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct__;
+  struct__ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Imports::mutable_struct_() {
+  
+  if (struct__ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Struct>(GetArenaNoVirtual());
+    struct__ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.struct)
+  return struct__;
+}
+inline void Imports::set_allocated_struct_(PROTOBUF_NAMESPACE_ID::Struct* struct_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct__);
+  }
+  if (struct_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  struct__ = struct_;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.struct)
+}
+
+// .google.protobuf.Timestamp timestamp = 3;
+inline bool Imports::has_timestamp() const {
+  return this != internal_default_instance() && timestamp_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& Imports::timestamp() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timestamp_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.timestamp)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Imports::release_timestamp() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.timestamp)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
+  timestamp_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Imports::mutable_timestamp() {
+  
+  if (timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaNoVirtual());
+    timestamp_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.timestamp)
+  return timestamp_;
+}
+inline void Imports::set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+  }
+  if (timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp)->GetArena();
+    if (message_arena != submessage_arena) {
+      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timestamp_ = timestamp;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.timestamp)
+}
+
+// .google.protobuf.Duration duration = 4;
+inline bool Imports::has_duration() const {
+  return this != internal_default_instance() && duration_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& Imports::duration() const {
+  const PROTOBUF_NAMESPACE_ID::Duration* p = duration_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.duration)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Duration*>(
+      &PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* Imports::release_duration() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.duration)
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration_;
+  duration_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* Imports::mutable_duration() {
+  
+  if (duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Duration>(GetArenaNoVirtual());
+    duration_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.duration)
+  return duration_;
+}
+inline void Imports::set_allocated_duration(PROTOBUF_NAMESPACE_ID::Duration* duration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_);
+  }
+  if (duration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration_ = duration;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.duration)
+}
+
+// .google.protobuf.Int32Value i32 = 5;
+inline bool Imports::has_i32() const {
+  return this != internal_default_instance() && i32_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Imports::i32() const {
+  const PROTOBUF_NAMESPACE_ID::Int32Value* p = i32_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.i32)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Imports::release_i32() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.i32)
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = i32_;
+  i32_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Imports::mutable_i32() {
+  
+  if (i32_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int32Value>(GetArenaNoVirtual());
+    i32_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.i32)
+  return i32_;
+}
+inline void Imports::set_allocated_i32(PROTOBUF_NAMESPACE_ID::Int32Value* i32) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(i32_);
+  }
+  if (i32) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(i32)->GetArena();
+    if (message_arena != submessage_arena) {
+      i32 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, i32, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  i32_ = i32;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.i32)
+}
+
+// .proto_util_converter.testing.Data data = 100;
+inline bool Imports::has_data() const {
+  return this != internal_default_instance() && data_ != nullptr;
+}
+inline void Imports::clear_data() {
+  if (GetArenaNoVirtual() == nullptr && data_ != nullptr) {
+    delete data_;
+  }
+  data_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Data& Imports::data() const {
+  const ::proto_util_converter::testing::Data* p = data_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.data)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Data*>(
+      &::proto_util_converter::testing::_Data_default_instance_);
+}
+inline ::proto_util_converter::testing::Data* Imports::release_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.data)
+  
+  ::proto_util_converter::testing::Data* temp = data_;
+  data_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Data* Imports::mutable_data() {
+  
+  if (data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Data>(GetArenaNoVirtual());
+    data_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.data)
+  return data_;
+}
+inline void Imports::set_allocated_data(::proto_util_converter::testing::Data* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.data)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Data
+
+// int32 attr = 1;
+inline void Data::clear_attr() {
+  attr_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Data::attr() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.attr)
+  return attr_;
+}
+inline void Data::set_attr(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  attr_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.attr)
+}
+
+// string str = 2;
+inline void Data::clear_str() {
+  str_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& Data::str() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.str)
+  return str_.GetNoArena();
+}
+inline void Data::set_str(const std::string& value) {
+  
+  str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.str)
+}
+inline void Data::set_str(std::string&& value) {
+  
+  str_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Data.str)
+}
+inline void Data::set_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Data.str)
+}
+inline void Data::set_str(const char* value, size_t size) {
+  
+  str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Data.str)
+}
+inline std::string* Data::mutable_str() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.str)
+  return str_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Data::release_str() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.str)
+  
+  return str_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Data::set_allocated_str(std::string* str) {
+  if (str != nullptr) {
+    
+  } else {
+    
+  }
+  str_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), str);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.str)
+}
+
+// repeated string msgs = 3;
+inline int Data::msgs_size() const {
+  return msgs_.size();
+}
+inline void Data::clear_msgs() {
+  msgs_.Clear();
+}
+inline const std::string& Data::msgs(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.msgs)
+  return msgs_.Get(index);
+}
+inline std::string* Data::mutable_msgs(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.msgs)
+  return msgs_.Mutable(index);
+}
+inline void Data::set_msgs(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.msgs)
+  msgs_.Mutable(index)->assign(value);
+}
+inline void Data::set_msgs(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.msgs)
+  msgs_.Mutable(index)->assign(std::move(value));
+}
+inline void Data::set_msgs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  msgs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::set_msgs(int index, const char* value, size_t size) {
+  msgs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Data.msgs)
+}
+inline std::string* Data::add_msgs() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Data.msgs)
+  return msgs_.Add();
+}
+inline void Data::add_msgs(const std::string& value) {
+  msgs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::add_msgs(std::string&& value) {
+  msgs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::add_msgs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  msgs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::add_msgs(const char* value, size_t size) {
+  msgs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Data.msgs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Data::msgs() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Data.msgs)
+  return msgs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Data::mutable_msgs() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Data.msgs)
+  return &msgs_;
+}
+
+// .proto_util_converter.testing.Data nested_data = 4;
+inline bool Data::has_nested_data() const {
+  return this != internal_default_instance() && nested_data_ != nullptr;
+}
+inline void Data::clear_nested_data() {
+  if (GetArenaNoVirtual() == nullptr && nested_data_ != nullptr) {
+    delete nested_data_;
+  }
+  nested_data_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Data& Data::nested_data() const {
+  const ::proto_util_converter::testing::Data* p = nested_data_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.nested_data)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Data*>(
+      &::proto_util_converter::testing::_Data_default_instance_);
+}
+inline ::proto_util_converter::testing::Data* Data::release_nested_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.nested_data)
+  
+  ::proto_util_converter::testing::Data* temp = nested_data_;
+  nested_data_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Data* Data::mutable_nested_data() {
+  
+  if (nested_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Data>(GetArenaNoVirtual());
+    nested_data_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.nested_data)
+  return nested_data_;
+}
+inline void Data::set_allocated_nested_data(::proto_util_converter::testing::Data* nested_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete nested_data_;
+  }
+  if (nested_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      nested_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nested_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  nested_data_ = nested_data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.nested_data)
+}
+
+// .google.protobuf.Int32Value int_wrapper = 5;
+inline bool Data::has_int_wrapper() const {
+  return this != internal_default_instance() && int_wrapper_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Data::int_wrapper() const {
+  const PROTOBUF_NAMESPACE_ID::Int32Value* p = int_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.int_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Data::release_int_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.int_wrapper)
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = int_wrapper_;
+  int_wrapper_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Data::mutable_int_wrapper() {
+  
+  if (int_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int32Value>(GetArenaNoVirtual());
+    int_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.int_wrapper)
+  return int_wrapper_;
+}
+inline void Data::set_allocated_int_wrapper(PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(int_wrapper_);
+  }
+  if (int_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int_wrapper)->GetArena();
+    if (message_arena != submessage_arena) {
+      int_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int_wrapper_ = int_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.int_wrapper)
+}
+
+// .google.protobuf.Timestamp time = 6;
+inline bool Data::has_time() const {
+  return this != internal_default_instance() && time_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& Data::time() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = time_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.time)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Data::release_time() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.time)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = time_;
+  time_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Data::mutable_time() {
+  
+  if (time_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaNoVirtual());
+    time_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.time)
+  return time_;
+}
+inline void Data::set_allocated_time(PROTOBUF_NAMESPACE_ID::Timestamp* time) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_);
+  }
+  if (time) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time)->GetArena();
+    if (message_arena != submessage_arena) {
+      time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  time_ = time;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.time)
+}
+
+// map<string, string> map_data = 7;
+inline int Data::map_data_size() const {
+  return map_data_.size();
+}
+inline void Data::clear_map_data() {
+  map_data_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+Data::map_data() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.Data.map_data)
+  return map_data_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+Data::mutable_map_data() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.Data.map_data)
+  return map_data_.MutableMap();
+}
+
+// .google.protobuf.Struct struct_data = 8;
+inline bool Data::has_struct_data() const {
+  return this != internal_default_instance() && struct_data_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& Data::struct_data() const {
+  const PROTOBUF_NAMESPACE_ID::Struct* p = struct_data_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.struct_data)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Struct*>(
+      &PROTOBUF_NAMESPACE_ID::_Struct_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Data::release_struct_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.struct_data)
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct_data_;
+  struct_data_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Data::mutable_struct_data() {
+  
+  if (struct_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Struct>(GetArenaNoVirtual());
+    struct_data_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.struct_data)
+  return struct_data_;
+}
+inline void Data::set_allocated_struct_data(PROTOBUF_NAMESPACE_ID::Struct* struct_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_data_);
+  }
+  if (struct_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_data)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  struct_data_ = struct_data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.struct_data)
+}
+
+// repeated .proto_util_converter.testing.Data repeated_data = 9;
+inline int Data::repeated_data_size() const {
+  return repeated_data_.size();
+}
+inline void Data::clear_repeated_data() {
+  repeated_data_.Clear();
+}
+inline ::proto_util_converter::testing::Data* Data::mutable_repeated_data(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.repeated_data)
+  return repeated_data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >*
+Data::mutable_repeated_data() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Data.repeated_data)
+  return &repeated_data_;
+}
+inline const ::proto_util_converter::testing::Data& Data::repeated_data(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.repeated_data)
+  return repeated_data_.Get(index);
+}
+inline ::proto_util_converter::testing::Data* Data::add_repeated_data() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.repeated_data)
+  return repeated_data_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >&
+Data::repeated_data() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Data.repeated_data)
+  return repeated_data_;
+}
+
+// repeated .google.protobuf.Any repeated_any = 10;
+inline int Data::repeated_any_size() const {
+  return repeated_any_.size();
+}
+inline PROTOBUF_NAMESPACE_ID::Any* Data::mutable_repeated_any(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.repeated_any)
+  return repeated_any_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >*
+Data::mutable_repeated_any() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Data.repeated_any)
+  return &repeated_any_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& Data::repeated_any(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.repeated_any)
+  return repeated_any_.Get(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* Data::add_repeated_any() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.repeated_any)
+  return repeated_any_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >&
+Data::repeated_any() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Data.repeated_any)
+  return repeated_any_;
+}
+
+// -------------------------------------------------------------------
+
+// AnyIn
+
+// string something = 1;
+inline void AnyIn::clear_something() {
+  something_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& AnyIn::something() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyIn.something)
+  return something_.GetNoArena();
+}
+inline void AnyIn::set_something(const std::string& value) {
+  
+  something_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.AnyIn.something)
+}
+inline void AnyIn::set_something(std::string&& value) {
+  
+  something_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.AnyIn.something)
+}
+inline void AnyIn::set_something(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  something_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.AnyIn.something)
+}
+inline void AnyIn::set_something(const char* value, size_t size) {
+  
+  something_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.AnyIn.something)
+}
+inline std::string* AnyIn::mutable_something() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyIn.something)
+  return something_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* AnyIn::release_something() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyIn.something)
+  
+  return something_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void AnyIn::set_allocated_something(std::string* something) {
+  if (something != nullptr) {
+    
+  } else {
+    
+  }
+  something_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), something);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyIn.something)
+}
+
+// .google.protobuf.Any any = 2;
+inline bool AnyIn::has_any() const {
+  return this != internal_default_instance() && any_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyIn::any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyIn.any)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyIn::release_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyIn.any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyIn::mutable_any() {
+  
+  if (any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyIn.any)
+  return any_;
+}
+inline void AnyIn::set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  if (any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_ = any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyIn.any)
+}
+
+// -------------------------------------------------------------------
+
+// AnyOut
+
+// .google.protobuf.Any any = 1;
+inline bool AnyOut::has_any() const {
+  return this != internal_default_instance() && any_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyOut::any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyOut.any)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyOut::release_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyOut.any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyOut::mutable_any() {
+  
+  if (any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArenaNoVirtual());
+    any_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyOut.any)
+  return any_;
+}
+inline void AnyOut::set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  if (any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_ = any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyOut.any)
+}
+
+// -------------------------------------------------------------------
+
+// AnyM
+
+// string foo = 1;
+inline void AnyM::clear_foo() {
+  foo_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& AnyM::foo() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyM.foo)
+  return foo_.GetNoArena();
+}
+inline void AnyM::set_foo(const std::string& value) {
+  
+  foo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.AnyM.foo)
+}
+inline void AnyM::set_foo(std::string&& value) {
+  
+  foo_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.AnyM.foo)
+}
+inline void AnyM::set_foo(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  foo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.AnyM.foo)
+}
+inline void AnyM::set_foo(const char* value, size_t size) {
+  
+  foo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.AnyM.foo)
+}
+inline std::string* AnyM::mutable_foo() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyM.foo)
+  return foo_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* AnyM::release_foo() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyM.foo)
+  
+  return foo_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void AnyM::set_allocated_foo(std::string* foo) {
+  if (foo != nullptr) {
+    
+  } else {
+    
+  }
+  foo_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), foo);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyM.foo)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
@@ -0,0 +1,5378 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/books.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "google/protobuf/util/internal/testdata/anys.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[13]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto();
+namespace proto_util_converter {
+namespace testing {
+class Author;
+class AuthorDefaultTypeInternal;
+extern AuthorDefaultTypeInternal _Author_default_instance_;
+class BadAuthor;
+class BadAuthorDefaultTypeInternal;
+extern BadAuthorDefaultTypeInternal _BadAuthor_default_instance_;
+class BadNestedBook;
+class BadNestedBookDefaultTypeInternal;
+extern BadNestedBookDefaultTypeInternal _BadNestedBook_default_instance_;
+class Book;
+class BookDefaultTypeInternal;
+extern BookDefaultTypeInternal _Book_default_instance_;
+class Book_Data;
+class Book_DataDefaultTypeInternal;
+extern Book_DataDefaultTypeInternal _Book_Data_default_instance_;
+class Book_Label;
+class Book_LabelDefaultTypeInternal;
+extern Book_LabelDefaultTypeInternal _Book_Label_default_instance_;
+class Cyclic;
+class CyclicDefaultTypeInternal;
+extern CyclicDefaultTypeInternal _Cyclic_default_instance_;
+class NestedBook;
+class NestedBookDefaultTypeInternal;
+extern NestedBookDefaultTypeInternal _NestedBook_default_instance_;
+class PackedPrimitive;
+class PackedPrimitiveDefaultTypeInternal;
+extern PackedPrimitiveDefaultTypeInternal _PackedPrimitive_default_instance_;
+class Primitive;
+class PrimitiveDefaultTypeInternal;
+extern PrimitiveDefaultTypeInternal _Primitive_default_instance_;
+class Publisher;
+class PublisherDefaultTypeInternal;
+extern PublisherDefaultTypeInternal _Publisher_default_instance_;
+class TestJsonName1;
+class TestJsonName1DefaultTypeInternal;
+extern TestJsonName1DefaultTypeInternal _TestJsonName1_default_instance_;
+class TestJsonName2;
+class TestJsonName2DefaultTypeInternal;
+extern TestJsonName2DefaultTypeInternal _TestJsonName2_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::Author* Arena::CreateMaybeMessage<::proto_util_converter::testing::Author>(Arena*);
+template<> ::proto_util_converter::testing::BadAuthor* Arena::CreateMaybeMessage<::proto_util_converter::testing::BadAuthor>(Arena*);
+template<> ::proto_util_converter::testing::BadNestedBook* Arena::CreateMaybeMessage<::proto_util_converter::testing::BadNestedBook>(Arena*);
+template<> ::proto_util_converter::testing::Book* Arena::CreateMaybeMessage<::proto_util_converter::testing::Book>(Arena*);
+template<> ::proto_util_converter::testing::Book_Data* Arena::CreateMaybeMessage<::proto_util_converter::testing::Book_Data>(Arena*);
+template<> ::proto_util_converter::testing::Book_Label* Arena::CreateMaybeMessage<::proto_util_converter::testing::Book_Label>(Arena*);
+template<> ::proto_util_converter::testing::Cyclic* Arena::CreateMaybeMessage<::proto_util_converter::testing::Cyclic>(Arena*);
+template<> ::proto_util_converter::testing::NestedBook* Arena::CreateMaybeMessage<::proto_util_converter::testing::NestedBook>(Arena*);
+template<> ::proto_util_converter::testing::PackedPrimitive* Arena::CreateMaybeMessage<::proto_util_converter::testing::PackedPrimitive>(Arena*);
+template<> ::proto_util_converter::testing::Primitive* Arena::CreateMaybeMessage<::proto_util_converter::testing::Primitive>(Arena*);
+template<> ::proto_util_converter::testing::Publisher* Arena::CreateMaybeMessage<::proto_util_converter::testing::Publisher>(Arena*);
+template<> ::proto_util_converter::testing::TestJsonName1* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestJsonName1>(Arena*);
+template<> ::proto_util_converter::testing::TestJsonName2* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestJsonName2>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+enum Book_Type {
+  Book_Type_FICTION = 1,
+  Book_Type_KIDS = 2,
+  Book_Type_ACTION_AND_ADVENTURE = 3,
+  Book_Type_arts_and_photography = 4,
+  Book_Type_I18N_Tech = 5
+};
+bool Book_Type_IsValid(int value);
+constexpr Book_Type Book_Type_Type_MIN = Book_Type_FICTION;
+constexpr Book_Type Book_Type_Type_MAX = Book_Type_I18N_Tech;
+constexpr int Book_Type_Type_ARRAYSIZE = Book_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Book_Type_descriptor();
+inline const std::string& Book_Type_Name(Book_Type value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Book_Type_descriptor(), value);
+}
+inline bool Book_Type_Parse(
+    const std::string& name, Book_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Book_Type>(
+    Book_Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class Book_Data final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Book.Data) */ {
+ public:
+  Book_Data();
+  virtual ~Book_Data();
+
+  Book_Data(const Book_Data& from);
+  Book_Data(Book_Data&& from) noexcept
+    : Book_Data() {
+    *this = ::std::move(from);
+  }
+
+  inline Book_Data& operator=(const Book_Data& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Book_Data& operator=(Book_Data&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Book_Data& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Book_Data* internal_default_instance() {
+    return reinterpret_cast<const Book_Data*>(
+               &_Book_Data_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void Swap(Book_Data* other);
+  friend void swap(Book_Data& a, Book_Data& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Book_Data* New() const final {
+    return CreateMaybeMessage<Book_Data>(nullptr);
+  }
+
+  Book_Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Book_Data>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Book_Data& from);
+  void MergeFrom(const Book_Data& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Book_Data* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Book.Data";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string copyright = 8;
+  bool has_copyright() const;
+  void clear_copyright();
+  static const int kCopyrightFieldNumber = 8;
+  const std::string& copyright() const;
+  void set_copyright(const std::string& value);
+  void set_copyright(std::string&& value);
+  void set_copyright(const char* value);
+  void set_copyright(const char* value, size_t size);
+  std::string* mutable_copyright();
+  std::string* release_copyright();
+  void set_allocated_copyright(std::string* copyright);
+
+  // optional uint32 year = 7;
+  bool has_year() const;
+  void clear_year();
+  static const int kYearFieldNumber = 7;
+  ::PROTOBUF_NAMESPACE_ID::uint32 year() const;
+  void set_year(::PROTOBUF_NAMESPACE_ID::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Book.Data)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr copyright_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 year_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Book_Label final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Book.Label) */ {
+ public:
+  Book_Label();
+  virtual ~Book_Label();
+
+  Book_Label(const Book_Label& from);
+  Book_Label(Book_Label&& from) noexcept
+    : Book_Label() {
+    *this = ::std::move(from);
+  }
+
+  inline Book_Label& operator=(const Book_Label& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Book_Label& operator=(Book_Label&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Book_Label& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Book_Label* internal_default_instance() {
+    return reinterpret_cast<const Book_Label*>(
+               &_Book_Label_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  void Swap(Book_Label* other);
+  friend void swap(Book_Label& a, Book_Label& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Book_Label* New() const final {
+    return CreateMaybeMessage<Book_Label>(nullptr);
+  }
+
+  Book_Label* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Book_Label>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Book_Label& from);
+  void MergeFrom(const Book_Label& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Book_Label* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Book.Label";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string key = 1;
+  bool has_key() const;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const std::string& key() const;
+  void set_key(const std::string& value);
+  void set_key(std::string&& value);
+  void set_key(const char* value);
+  void set_key(const char* value, size_t size);
+  std::string* mutable_key();
+  std::string* release_key();
+  void set_allocated_key(std::string* key);
+
+  // optional string value = 2;
+  bool has_value() const;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const std::string& value() const;
+  void set_value(const std::string& value);
+  void set_value(std::string&& value);
+  void set_value(const char* value);
+  void set_value(const char* value, size_t size);
+  std::string* mutable_value();
+  std::string* release_value();
+  void set_allocated_value(std::string* value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Book.Label)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Book final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Book) */ {
+ public:
+  Book();
+  virtual ~Book();
+
+  Book(const Book& from);
+  Book(Book&& from) noexcept
+    : Book() {
+    *this = ::std::move(from);
+  }
+
+  inline Book& operator=(const Book& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Book& operator=(Book&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Book& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Book* internal_default_instance() {
+    return reinterpret_cast<const Book*>(
+               &_Book_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(Book* other);
+  friend void swap(Book& a, Book& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Book* New() const final {
+    return CreateMaybeMessage<Book>(nullptr);
+  }
+
+  Book* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Book>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Book& from);
+  void MergeFrom(const Book& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Book* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Book";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Book_Data Data;
+  typedef Book_Label Label;
+
+  typedef Book_Type Type;
+  static constexpr Type FICTION =
+    Book_Type_FICTION;
+  static constexpr Type KIDS =
+    Book_Type_KIDS;
+  static constexpr Type ACTION_AND_ADVENTURE =
+    Book_Type_ACTION_AND_ADVENTURE;
+  static constexpr Type arts_and_photography =
+    Book_Type_arts_and_photography;
+  static constexpr Type I18N_Tech =
+    Book_Type_I18N_Tech;
+  static inline bool Type_IsValid(int value) {
+    return Book_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    Book_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    Book_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    Book_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return Book_Type_descriptor();
+  }
+  static inline const std::string& Type_Name(Type value) {
+    return Book_Type_Name(value);
+  }
+  static inline bool Type_Parse(const std::string& name,
+      Type* value) {
+    return Book_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // repeated .proto_util_converter.testing.Book.Label labels = 10;
+  int labels_size() const;
+  void clear_labels();
+  static const int kLabelsFieldNumber = 10;
+  ::proto_util_converter::testing::Book_Label* mutable_labels(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >*
+      mutable_labels();
+  const ::proto_util_converter::testing::Book_Label& labels(int index) const;
+  ::proto_util_converter::testing::Book_Label* add_labels();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >&
+      labels() const;
+
+  // repeated int32 primitive_repeated = 14;
+  int primitive_repeated_size() const;
+  void clear_primitive_repeated();
+  static const int kPrimitiveRepeatedFieldNumber = 14;
+  ::PROTOBUF_NAMESPACE_ID::int32 primitive_repeated(int index) const;
+  void set_primitive_repeated(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_primitive_repeated(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      primitive_repeated() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_primitive_repeated();
+
+  // optional string title = 1;
+  bool has_title() const;
+  void clear_title();
+  static const int kTitleFieldNumber = 1;
+  const std::string& title() const;
+  void set_title(const std::string& value);
+  void set_title(std::string&& value);
+  void set_title(const char* value);
+  void set_title(const char* value, size_t size);
+  std::string* mutable_title();
+  std::string* release_title();
+  void set_allocated_title(std::string* title);
+
+  // optional bytes content = 5;
+  bool has_content() const;
+  void clear_content();
+  static const int kContentFieldNumber = 5;
+  const std::string& content() const;
+  void set_content(const std::string& value);
+  void set_content(std::string&& value);
+  void set_content(const char* value);
+  void set_content(const void* value, size_t size);
+  std::string* mutable_content();
+  std::string* release_content();
+  void set_allocated_content(std::string* content);
+
+  // optional string snake_field = 12;
+  bool has_snake_field() const;
+  void clear_snake_field();
+  static const int kSnakeFieldFieldNumber = 12;
+  const std::string& snake_field() const;
+  void set_snake_field(const std::string& value);
+  void set_snake_field(std::string&& value);
+  void set_snake_field(const char* value);
+  void set_snake_field(const char* value, size_t size);
+  std::string* mutable_snake_field();
+  std::string* release_snake_field();
+  void set_allocated_snake_field(std::string* snake_field);
+
+  // optional .proto_util_converter.testing.Author author = 2;
+  bool has_author() const;
+  void clear_author();
+  static const int kAuthorFieldNumber = 2;
+  const ::proto_util_converter::testing::Author& author() const;
+  ::proto_util_converter::testing::Author* release_author();
+  ::proto_util_converter::testing::Author* mutable_author();
+  void set_allocated_author(::proto_util_converter::testing::Author* author);
+
+  // optional group Data = 6 { ... };
+  bool has_data() const;
+  void clear_data();
+  static const int kDataFieldNumber = 6;
+  const ::proto_util_converter::testing::Book_Data& data() const;
+  ::proto_util_converter::testing::Book_Data* release_data();
+  ::proto_util_converter::testing::Book_Data* mutable_data();
+  void set_allocated_data(::proto_util_converter::testing::Book_Data* data);
+
+  // optional .proto_util_converter.testing.Publisher publisher = 9;
+  bool has_publisher() const;
+  void clear_publisher();
+  static const int kPublisherFieldNumber = 9;
+  const ::proto_util_converter::testing::Publisher& publisher() const;
+  ::proto_util_converter::testing::Publisher* release_publisher();
+  ::proto_util_converter::testing::Publisher* mutable_publisher();
+  void set_allocated_publisher(::proto_util_converter::testing::Publisher* publisher);
+
+  // optional .proto_util_converter.testing.AnyWrapper type_not_found = 13;
+  bool has_type_not_found() const;
+  void clear_type_not_found();
+  static const int kTypeNotFoundFieldNumber = 13;
+  const ::proto_util_converter::testing::AnyWrapper& type_not_found() const;
+  ::proto_util_converter::testing::AnyWrapper* release_type_not_found();
+  ::proto_util_converter::testing::AnyWrapper* mutable_type_not_found();
+  void set_allocated_type_not_found(::proto_util_converter::testing::AnyWrapper* type_not_found);
+
+  // optional int64 published = 4;
+  bool has_published() const;
+  void clear_published();
+  static const int kPublishedFieldNumber = 4;
+  ::PROTOBUF_NAMESPACE_ID::int64 published() const;
+  void set_published(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // optional uint32 length = 3;
+  bool has_length() const;
+  void clear_length();
+  static const int kLengthFieldNumber = 3;
+  ::PROTOBUF_NAMESPACE_ID::uint32 length() const;
+  void set_length(::PROTOBUF_NAMESPACE_ID::uint32 value);
+
+  // optional .proto_util_converter.testing.Book.Type type = 11;
+  bool has_type() const;
+  void clear_type();
+  static const int kTypeFieldNumber = 11;
+  ::proto_util_converter::testing::Book_Type type() const;
+  void set_type(::proto_util_converter::testing::Book_Type value);
+
+  GOOGLE_PROTOBUF_EXTENSION_ACCESSORS(Book)
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Book)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label > labels_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > primitive_repeated_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr snake_field_;
+  ::proto_util_converter::testing::Author* author_;
+  ::proto_util_converter::testing::Book_Data* data_;
+  ::proto_util_converter::testing::Publisher* publisher_;
+  ::proto_util_converter::testing::AnyWrapper* type_not_found_;
+  ::PROTOBUF_NAMESPACE_ID::int64 published_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 length_;
+  int type_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Publisher final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Publisher) */ {
+ public:
+  Publisher();
+  virtual ~Publisher();
+
+  Publisher(const Publisher& from);
+  Publisher(Publisher&& from) noexcept
+    : Publisher() {
+    *this = ::std::move(from);
+  }
+
+  inline Publisher& operator=(const Publisher& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Publisher& operator=(Publisher&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Publisher& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Publisher* internal_default_instance() {
+    return reinterpret_cast<const Publisher*>(
+               &_Publisher_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  void Swap(Publisher* other);
+  friend void swap(Publisher& a, Publisher& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Publisher* New() const final {
+    return CreateMaybeMessage<Publisher>(nullptr);
+  }
+
+  Publisher* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Publisher>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Publisher& from);
+  void MergeFrom(const Publisher& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Publisher* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Publisher";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string name = 1;
+  bool has_name() const;
+  void clear_name();
+  static const int kNameFieldNumber = 1;
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Publisher)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Author final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Author) */ {
+ public:
+  Author();
+  virtual ~Author();
+
+  Author(const Author& from);
+  Author(Author&& from) noexcept
+    : Author() {
+    *this = ::std::move(from);
+  }
+
+  inline Author& operator=(const Author& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Author& operator=(Author&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Author& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Author* internal_default_instance() {
+    return reinterpret_cast<const Author*>(
+               &_Author_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  void Swap(Author* other);
+  friend void swap(Author& a, Author& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Author* New() const final {
+    return CreateMaybeMessage<Author>(nullptr);
+  }
+
+  Author* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Author>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Author& from);
+  void MergeFrom(const Author& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Author* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Author";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string pseudonym = 3;
+  int pseudonym_size() const;
+  void clear_pseudonym();
+  static const int kPseudonymFieldNumber = 3;
+  const std::string& pseudonym(int index) const;
+  std::string* mutable_pseudonym(int index);
+  void set_pseudonym(int index, const std::string& value);
+  void set_pseudonym(int index, std::string&& value);
+  void set_pseudonym(int index, const char* value);
+  void set_pseudonym(int index, const char* value, size_t size);
+  std::string* add_pseudonym();
+  void add_pseudonym(const std::string& value);
+  void add_pseudonym(std::string&& value);
+  void add_pseudonym(const char* value);
+  void add_pseudonym(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& pseudonym() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_pseudonym();
+
+  // repeated .proto_util_converter.testing.Author friend = 5;
+  int friend__size() const;
+  void clear_friend_();
+  static const int kFriendFieldNumber = 5;
+  ::proto_util_converter::testing::Author* mutable_friend_(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+      mutable_friend_();
+  const ::proto_util_converter::testing::Author& friend_(int index) const;
+  ::proto_util_converter::testing::Author* add_friend_();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+      friend_() const;
+
+  // optional string name = 2;
+  bool has_name() const;
+  void clear_name();
+  static const int kNameFieldNumber = 2;
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+
+  // optional uint64 id = 1[json_name = "@id"];
+  bool has_id() const;
+  void clear_id();
+  static const int kIdFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::uint64 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+
+  // optional bool alive = 4;
+  bool has_alive() const;
+  void clear_alive();
+  static const int kAliveFieldNumber = 4;
+  bool alive() const;
+  void set_alive(bool value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Author)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pseudonym_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author > friend__;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 id_;
+  bool alive_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BadAuthor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BadAuthor) */ {
+ public:
+  BadAuthor();
+  virtual ~BadAuthor();
+
+  BadAuthor(const BadAuthor& from);
+  BadAuthor(BadAuthor&& from) noexcept
+    : BadAuthor() {
+    *this = ::std::move(from);
+  }
+
+  inline BadAuthor& operator=(const BadAuthor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BadAuthor& operator=(BadAuthor&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const BadAuthor& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BadAuthor* internal_default_instance() {
+    return reinterpret_cast<const BadAuthor*>(
+               &_BadAuthor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  void Swap(BadAuthor* other);
+  friend void swap(BadAuthor& a, BadAuthor& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BadAuthor* New() const final {
+    return CreateMaybeMessage<BadAuthor>(nullptr);
+  }
+
+  BadAuthor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BadAuthor>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BadAuthor& from);
+  void MergeFrom(const BadAuthor& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BadAuthor* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BadAuthor";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated uint64 name = 2;
+  int name_size() const;
+  void clear_name();
+  static const int kNameFieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::uint64 name(int index) const;
+  void set_name(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_name(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_name();
+
+  // repeated bool alive = 4 [packed = true];
+  int alive_size() const;
+  void clear_alive();
+  static const int kAliveFieldNumber = 4;
+  bool alive(int index) const;
+  void set_alive(int index, bool value);
+  void add_alive(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      alive() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_alive();
+
+  // optional string id = 1;
+  bool has_id() const;
+  void clear_id();
+  static const int kIdFieldNumber = 1;
+  const std::string& id() const;
+  void set_id(const std::string& value);
+  void set_id(std::string&& value);
+  void set_id(const char* value);
+  void set_id(const char* value, size_t size);
+  std::string* mutable_id();
+  std::string* release_id();
+  void set_allocated_id(std::string* id);
+
+  // optional string pseudonym = 3;
+  bool has_pseudonym() const;
+  void clear_pseudonym();
+  static const int kPseudonymFieldNumber = 3;
+  const std::string& pseudonym() const;
+  void set_pseudonym(const std::string& value);
+  void set_pseudonym(std::string&& value);
+  void set_pseudonym(const char* value);
+  void set_pseudonym(const char* value, size_t size);
+  std::string* mutable_pseudonym();
+  std::string* release_pseudonym();
+  void set_allocated_pseudonym(std::string* pseudonym);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BadAuthor)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > name_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > alive_;
+  mutable std::atomic<int> _alive_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pseudonym_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Primitive final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Primitive) */ {
+ public:
+  Primitive();
+  virtual ~Primitive();
+
+  Primitive(const Primitive& from);
+  Primitive(Primitive&& from) noexcept
+    : Primitive() {
+    *this = ::std::move(from);
+  }
+
+  inline Primitive& operator=(const Primitive& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Primitive& operator=(Primitive&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Primitive& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Primitive* internal_default_instance() {
+    return reinterpret_cast<const Primitive*>(
+               &_Primitive_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  void Swap(Primitive* other);
+  friend void swap(Primitive& a, Primitive& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Primitive* New() const final {
+    return CreateMaybeMessage<Primitive>(nullptr);
+  }
+
+  Primitive* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Primitive>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Primitive& from);
+  void MergeFrom(const Primitive& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Primitive* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Primitive";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated fixed32 rep_fix32 = 16;
+  int rep_fix32_size() const;
+  void clear_rep_fix32();
+  static const int kRepFix32FieldNumber = 16;
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_fix32(int index) const;
+  void set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_fix32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_fix32();
+
+  // repeated uint32 rep_u32 = 17;
+  int rep_u32_size() const;
+  void clear_rep_u32();
+  static const int kRepU32FieldNumber = 17;
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_u32(int index) const;
+  void set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_u32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_u32();
+
+  // repeated int32 rep_i32 = 18;
+  int rep_i32_size() const;
+  void clear_rep_i32();
+  static const int kRepI32FieldNumber = 18;
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_i32(int index) const;
+  void set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_i32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_i32();
+
+  // repeated sfixed32 rep_sf32 = 19;
+  int rep_sf32_size() const;
+  void clear_rep_sf32();
+  static const int kRepSf32FieldNumber = 19;
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_sf32(int index) const;
+  void set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_sf32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_sf32();
+
+  // repeated sint32 rep_s32 = 20;
+  int rep_s32_size() const;
+  void clear_rep_s32();
+  static const int kRepS32FieldNumber = 20;
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_s32(int index) const;
+  void set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_s32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_s32();
+
+  // repeated fixed64 rep_fix64 = 21;
+  int rep_fix64_size() const;
+  void clear_rep_fix64();
+  static const int kRepFix64FieldNumber = 21;
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_fix64(int index) const;
+  void set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_fix64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_fix64();
+
+  // repeated uint64 rep_u64 = 22;
+  int rep_u64_size() const;
+  void clear_rep_u64();
+  static const int kRepU64FieldNumber = 22;
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_u64(int index) const;
+  void set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_u64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_u64();
+
+  // repeated int64 rep_i64 = 23;
+  int rep_i64_size() const;
+  void clear_rep_i64();
+  static const int kRepI64FieldNumber = 23;
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_i64(int index) const;
+  void set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_i64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_i64();
+
+  // repeated sfixed64 rep_sf64 = 24;
+  int rep_sf64_size() const;
+  void clear_rep_sf64();
+  static const int kRepSf64FieldNumber = 24;
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_sf64(int index) const;
+  void set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_sf64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_sf64();
+
+  // repeated sint64 rep_s64 = 25;
+  int rep_s64_size() const;
+  void clear_rep_s64();
+  static const int kRepS64FieldNumber = 25;
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_s64(int index) const;
+  void set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_s64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_s64();
+
+  // repeated string rep_str = 26;
+  int rep_str_size() const;
+  void clear_rep_str();
+  static const int kRepStrFieldNumber = 26;
+  const std::string& rep_str(int index) const;
+  std::string* mutable_rep_str(int index);
+  void set_rep_str(int index, const std::string& value);
+  void set_rep_str(int index, std::string&& value);
+  void set_rep_str(int index, const char* value);
+  void set_rep_str(int index, const char* value, size_t size);
+  std::string* add_rep_str();
+  void add_rep_str(const std::string& value);
+  void add_rep_str(std::string&& value);
+  void add_rep_str(const char* value);
+  void add_rep_str(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rep_str() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rep_str();
+
+  // repeated bytes rep_bytes = 27;
+  int rep_bytes_size() const;
+  void clear_rep_bytes();
+  static const int kRepBytesFieldNumber = 27;
+  const std::string& rep_bytes(int index) const;
+  std::string* mutable_rep_bytes(int index);
+  void set_rep_bytes(int index, const std::string& value);
+  void set_rep_bytes(int index, std::string&& value);
+  void set_rep_bytes(int index, const char* value);
+  void set_rep_bytes(int index, const void* value, size_t size);
+  std::string* add_rep_bytes();
+  void add_rep_bytes(const std::string& value);
+  void add_rep_bytes(std::string&& value);
+  void add_rep_bytes(const char* value);
+  void add_rep_bytes(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rep_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rep_bytes();
+
+  // repeated float rep_float = 28;
+  int rep_float_size() const;
+  void clear_rep_float();
+  static const int kRepFloatFieldNumber = 28;
+  float rep_float(int index) const;
+  void set_rep_float(int index, float value);
+  void add_rep_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      rep_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_rep_float();
+
+  // repeated double rep_double = 29;
+  int rep_double_size() const;
+  void clear_rep_double();
+  static const int kRepDoubleFieldNumber = 29;
+  double rep_double(int index) const;
+  void set_rep_double(int index, double value);
+  void add_rep_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      rep_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_rep_double();
+
+  // repeated bool rep_bool = 30;
+  int rep_bool_size() const;
+  void clear_rep_bool();
+  static const int kRepBoolFieldNumber = 30;
+  bool rep_bool(int index) const;
+  void set_rep_bool(int index, bool value);
+  void add_rep_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      rep_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_rep_bool();
+
+  // optional string str = 11;
+  bool has_str() const;
+  void clear_str();
+  static const int kStrFieldNumber = 11;
+  const std::string& str() const;
+  void set_str(const std::string& value);
+  void set_str(std::string&& value);
+  void set_str(const char* value);
+  void set_str(const char* value, size_t size);
+  std::string* mutable_str();
+  std::string* release_str();
+  void set_allocated_str(std::string* str);
+
+  // optional bytes bytes = 12;
+  bool has_bytes() const;
+  void clear_bytes();
+  static const int kBytesFieldNumber = 12;
+  const std::string& bytes() const;
+  void set_bytes(const std::string& value);
+  void set_bytes(std::string&& value);
+  void set_bytes(const char* value);
+  void set_bytes(const void* value, size_t size);
+  std::string* mutable_bytes();
+  std::string* release_bytes();
+  void set_allocated_bytes(std::string* bytes);
+
+  // optional fixed32 fix32 = 1;
+  bool has_fix32() const;
+  void clear_fix32();
+  static const int kFix32FieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::uint32 fix32() const;
+  void set_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+
+  // optional uint32 u32 = 2;
+  bool has_u32() const;
+  void clear_u32();
+  static const int kU32FieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::uint32 u32() const;
+  void set_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+
+  // optional int32 i32 = 3;
+  bool has_i32() const;
+  void clear_i32();
+  static const int kI32FieldNumber = 3;
+  ::PROTOBUF_NAMESPACE_ID::int32 i32() const;
+  void set_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional sfixed32 sf32 = 4;
+  bool has_sf32() const;
+  void clear_sf32();
+  static const int kSf32FieldNumber = 4;
+  ::PROTOBUF_NAMESPACE_ID::int32 sf32() const;
+  void set_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional fixed64 fix64 = 6;
+  bool has_fix64() const;
+  void clear_fix64();
+  static const int kFix64FieldNumber = 6;
+  ::PROTOBUF_NAMESPACE_ID::uint64 fix64() const;
+  void set_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+
+  // optional uint64 u64 = 7;
+  bool has_u64() const;
+  void clear_u64();
+  static const int kU64FieldNumber = 7;
+  ::PROTOBUF_NAMESPACE_ID::uint64 u64() const;
+  void set_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+
+  // optional int64 i64 = 8;
+  bool has_i64() const;
+  void clear_i64();
+  static const int kI64FieldNumber = 8;
+  ::PROTOBUF_NAMESPACE_ID::int64 i64() const;
+  void set_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // optional sfixed64 sf64 = 9;
+  bool has_sf64() const;
+  void clear_sf64();
+  static const int kSf64FieldNumber = 9;
+  ::PROTOBUF_NAMESPACE_ID::int64 sf64() const;
+  void set_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // optional sint32 s32 = 5;
+  bool has_s32() const;
+  void clear_s32();
+  static const int kS32FieldNumber = 5;
+  ::PROTOBUF_NAMESPACE_ID::int32 s32() const;
+  void set_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional float float = 13;
+  bool has_float_() const;
+  void clear_float_();
+  static const int kFloatFieldNumber = 13;
+  float float_() const;
+  void set_float_(float value);
+
+  // optional sint64 s64 = 10;
+  bool has_s64() const;
+  void clear_s64();
+  static const int kS64FieldNumber = 10;
+  ::PROTOBUF_NAMESPACE_ID::int64 s64() const;
+  void set_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // optional double double = 14;
+  bool has_double_() const;
+  void clear_double_();
+  static const int kDoubleFieldNumber = 14;
+  double double_() const;
+  void set_double_(double value);
+
+  // optional bool bool = 15;
+  bool has_bool_() const;
+  void clear_bool_();
+  static const int kBoolFieldNumber = 15;
+  bool bool_() const;
+  void set_bool_(bool value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Primitive)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_fix32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_u32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_i32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_sf32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_s32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_fix64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_u64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_i64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_sf64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_s64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rep_str_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rep_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > rep_float_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > rep_double_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > rep_bool_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bytes_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 fix32_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 u32_;
+  ::PROTOBUF_NAMESPACE_ID::int32 i32_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sf32_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 fix64_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 u64_;
+  ::PROTOBUF_NAMESPACE_ID::int64 i64_;
+  ::PROTOBUF_NAMESPACE_ID::int64 sf64_;
+  ::PROTOBUF_NAMESPACE_ID::int32 s32_;
+  float float__;
+  ::PROTOBUF_NAMESPACE_ID::int64 s64_;
+  double double__;
+  bool bool__;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PackedPrimitive final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.PackedPrimitive) */ {
+ public:
+  PackedPrimitive();
+  virtual ~PackedPrimitive();
+
+  PackedPrimitive(const PackedPrimitive& from);
+  PackedPrimitive(PackedPrimitive&& from) noexcept
+    : PackedPrimitive() {
+    *this = ::std::move(from);
+  }
+
+  inline PackedPrimitive& operator=(const PackedPrimitive& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedPrimitive& operator=(PackedPrimitive&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const PackedPrimitive& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PackedPrimitive* internal_default_instance() {
+    return reinterpret_cast<const PackedPrimitive*>(
+               &_PackedPrimitive_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  void Swap(PackedPrimitive* other);
+  friend void swap(PackedPrimitive& a, PackedPrimitive& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PackedPrimitive* New() const final {
+    return CreateMaybeMessage<PackedPrimitive>(nullptr);
+  }
+
+  PackedPrimitive* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PackedPrimitive>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PackedPrimitive& from);
+  void MergeFrom(const PackedPrimitive& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackedPrimitive* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.PackedPrimitive";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated fixed32 rep_fix32 = 16 [packed = true];
+  int rep_fix32_size() const;
+  void clear_rep_fix32();
+  static const int kRepFix32FieldNumber = 16;
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_fix32(int index) const;
+  void set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_fix32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_fix32();
+
+  // repeated uint32 rep_u32 = 17 [packed = true];
+  int rep_u32_size() const;
+  void clear_rep_u32();
+  static const int kRepU32FieldNumber = 17;
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_u32(int index) const;
+  void set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_u32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_u32();
+
+  // repeated int32 rep_i32 = 18 [packed = true];
+  int rep_i32_size() const;
+  void clear_rep_i32();
+  static const int kRepI32FieldNumber = 18;
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_i32(int index) const;
+  void set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_i32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_i32();
+
+  // repeated sfixed32 rep_sf32 = 19 [packed = true];
+  int rep_sf32_size() const;
+  void clear_rep_sf32();
+  static const int kRepSf32FieldNumber = 19;
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_sf32(int index) const;
+  void set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_sf32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_sf32();
+
+  // repeated sint32 rep_s32 = 20 [packed = true];
+  int rep_s32_size() const;
+  void clear_rep_s32();
+  static const int kRepS32FieldNumber = 20;
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_s32(int index) const;
+  void set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_s32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_s32();
+
+  // repeated fixed64 rep_fix64 = 21 [packed = true];
+  int rep_fix64_size() const;
+  void clear_rep_fix64();
+  static const int kRepFix64FieldNumber = 21;
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_fix64(int index) const;
+  void set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_fix64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_fix64();
+
+  // repeated uint64 rep_u64 = 22 [packed = true];
+  int rep_u64_size() const;
+  void clear_rep_u64();
+  static const int kRepU64FieldNumber = 22;
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_u64(int index) const;
+  void set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_u64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_u64();
+
+  // repeated int64 rep_i64 = 23 [packed = true];
+  int rep_i64_size() const;
+  void clear_rep_i64();
+  static const int kRepI64FieldNumber = 23;
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_i64(int index) const;
+  void set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_i64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_i64();
+
+  // repeated sfixed64 rep_sf64 = 24 [packed = true];
+  int rep_sf64_size() const;
+  void clear_rep_sf64();
+  static const int kRepSf64FieldNumber = 24;
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_sf64(int index) const;
+  void set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_sf64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_sf64();
+
+  // repeated sint64 rep_s64 = 25 [packed = true];
+  int rep_s64_size() const;
+  void clear_rep_s64();
+  static const int kRepS64FieldNumber = 25;
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_s64(int index) const;
+  void set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_s64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_s64();
+
+  // repeated float rep_float = 28 [packed = true];
+  int rep_float_size() const;
+  void clear_rep_float();
+  static const int kRepFloatFieldNumber = 28;
+  float rep_float(int index) const;
+  void set_rep_float(int index, float value);
+  void add_rep_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      rep_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_rep_float();
+
+  // repeated double rep_double = 29 [packed = true];
+  int rep_double_size() const;
+  void clear_rep_double();
+  static const int kRepDoubleFieldNumber = 29;
+  double rep_double(int index) const;
+  void set_rep_double(int index, double value);
+  void add_rep_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      rep_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_rep_double();
+
+  // repeated bool rep_bool = 30 [packed = true];
+  int rep_bool_size() const;
+  void clear_rep_bool();
+  static const int kRepBoolFieldNumber = 30;
+  bool rep_bool(int index) const;
+  void set_rep_bool(int index, bool value);
+  void add_rep_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      rep_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_rep_bool();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.PackedPrimitive)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_fix32_;
+  mutable std::atomic<int> _rep_fix32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_u32_;
+  mutable std::atomic<int> _rep_u32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_i32_;
+  mutable std::atomic<int> _rep_i32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_sf32_;
+  mutable std::atomic<int> _rep_sf32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_s32_;
+  mutable std::atomic<int> _rep_s32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_fix64_;
+  mutable std::atomic<int> _rep_fix64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_u64_;
+  mutable std::atomic<int> _rep_u64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_i64_;
+  mutable std::atomic<int> _rep_i64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_sf64_;
+  mutable std::atomic<int> _rep_sf64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_s64_;
+  mutable std::atomic<int> _rep_s64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > rep_float_;
+  mutable std::atomic<int> _rep_float_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > rep_double_;
+  mutable std::atomic<int> _rep_double_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > rep_bool_;
+  mutable std::atomic<int> _rep_bool_cached_byte_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NestedBook final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.NestedBook) */ {
+ public:
+  NestedBook();
+  virtual ~NestedBook();
+
+  NestedBook(const NestedBook& from);
+  NestedBook(NestedBook&& from) noexcept
+    : NestedBook() {
+    *this = ::std::move(from);
+  }
+
+  inline NestedBook& operator=(const NestedBook& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NestedBook& operator=(NestedBook&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const NestedBook& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const NestedBook* internal_default_instance() {
+    return reinterpret_cast<const NestedBook*>(
+               &_NestedBook_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  void Swap(NestedBook* other);
+  friend void swap(NestedBook& a, NestedBook& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline NestedBook* New() const final {
+    return CreateMaybeMessage<NestedBook>(nullptr);
+  }
+
+  NestedBook* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<NestedBook>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const NestedBook& from);
+  void MergeFrom(const NestedBook& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NestedBook* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.NestedBook";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional .proto_util_converter.testing.Book book = 1;
+  bool has_book() const;
+  void clear_book();
+  static const int kBookFieldNumber = 1;
+  const ::proto_util_converter::testing::Book& book() const;
+  ::proto_util_converter::testing::Book* release_book();
+  ::proto_util_converter::testing::Book* mutable_book();
+  void set_allocated_book(::proto_util_converter::testing::Book* book);
+
+  static const int kAnotherBookFieldNumber = 301;
+  static ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::proto_util_converter::testing::Book,
+      ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::proto_util_converter::testing::NestedBook >, 11, false >
+    another_book;
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.NestedBook)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::proto_util_converter::testing::Book* book_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BadNestedBook final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BadNestedBook) */ {
+ public:
+  BadNestedBook();
+  virtual ~BadNestedBook();
+
+  BadNestedBook(const BadNestedBook& from);
+  BadNestedBook(BadNestedBook&& from) noexcept
+    : BadNestedBook() {
+    *this = ::std::move(from);
+  }
+
+  inline BadNestedBook& operator=(const BadNestedBook& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BadNestedBook& operator=(BadNestedBook&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const BadNestedBook& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BadNestedBook* internal_default_instance() {
+    return reinterpret_cast<const BadNestedBook*>(
+               &_BadNestedBook_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  void Swap(BadNestedBook* other);
+  friend void swap(BadNestedBook& a, BadNestedBook& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BadNestedBook* New() const final {
+    return CreateMaybeMessage<BadNestedBook>(nullptr);
+  }
+
+  BadNestedBook* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BadNestedBook>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BadNestedBook& from);
+  void MergeFrom(const BadNestedBook& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BadNestedBook* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BadNestedBook";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated uint32 book = 1 [packed = true];
+  int book_size() const;
+  void clear_book();
+  static const int kBookFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::uint32 book(int index) const;
+  void set_book(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_book(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      book() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_book();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BadNestedBook)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > book_;
+  mutable std::atomic<int> _book_cached_byte_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Cyclic final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Cyclic) */ {
+ public:
+  Cyclic();
+  virtual ~Cyclic();
+
+  Cyclic(const Cyclic& from);
+  Cyclic(Cyclic&& from) noexcept
+    : Cyclic() {
+    *this = ::std::move(from);
+  }
+
+  inline Cyclic& operator=(const Cyclic& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Cyclic& operator=(Cyclic&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Cyclic& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Cyclic* internal_default_instance() {
+    return reinterpret_cast<const Cyclic*>(
+               &_Cyclic_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  void Swap(Cyclic* other);
+  friend void swap(Cyclic& a, Cyclic& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Cyclic* New() const final {
+    return CreateMaybeMessage<Cyclic>(nullptr);
+  }
+
+  Cyclic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Cyclic>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Cyclic& from);
+  void MergeFrom(const Cyclic& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Cyclic* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Cyclic";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .proto_util_converter.testing.Author m_author = 5;
+  int m_author_size() const;
+  void clear_m_author();
+  static const int kMAuthorFieldNumber = 5;
+  ::proto_util_converter::testing::Author* mutable_m_author(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+      mutable_m_author();
+  const ::proto_util_converter::testing::Author& m_author(int index) const;
+  ::proto_util_converter::testing::Author* add_m_author();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+      m_author() const;
+
+  // optional string m_str = 2;
+  bool has_m_str() const;
+  void clear_m_str();
+  static const int kMStrFieldNumber = 2;
+  const std::string& m_str() const;
+  void set_m_str(const std::string& value);
+  void set_m_str(std::string&& value);
+  void set_m_str(const char* value);
+  void set_m_str(const char* value, size_t size);
+  std::string* mutable_m_str();
+  std::string* release_m_str();
+  void set_allocated_m_str(std::string* m_str);
+
+  // optional .proto_util_converter.testing.Book m_book = 3;
+  bool has_m_book() const;
+  void clear_m_book();
+  static const int kMBookFieldNumber = 3;
+  const ::proto_util_converter::testing::Book& m_book() const;
+  ::proto_util_converter::testing::Book* release_m_book();
+  ::proto_util_converter::testing::Book* mutable_m_book();
+  void set_allocated_m_book(::proto_util_converter::testing::Book* m_book);
+
+  // optional .proto_util_converter.testing.Cyclic m_cyclic = 4;
+  bool has_m_cyclic() const;
+  void clear_m_cyclic();
+  static const int kMCyclicFieldNumber = 4;
+  const ::proto_util_converter::testing::Cyclic& m_cyclic() const;
+  ::proto_util_converter::testing::Cyclic* release_m_cyclic();
+  ::proto_util_converter::testing::Cyclic* mutable_m_cyclic();
+  void set_allocated_m_cyclic(::proto_util_converter::testing::Cyclic* m_cyclic);
+
+  // optional int32 m_int = 1;
+  bool has_m_int() const;
+  void clear_m_int();
+  static const int kMIntFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 m_int() const;
+  void set_m_int(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Cyclic)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author > m_author_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr m_str_;
+  ::proto_util_converter::testing::Book* m_book_;
+  ::proto_util_converter::testing::Cyclic* m_cyclic_;
+  ::PROTOBUF_NAMESPACE_ID::int32 m_int_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJsonName1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestJsonName1) */ {
+ public:
+  TestJsonName1();
+  virtual ~TestJsonName1();
+
+  TestJsonName1(const TestJsonName1& from);
+  TestJsonName1(TestJsonName1&& from) noexcept
+    : TestJsonName1() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJsonName1& operator=(const TestJsonName1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJsonName1& operator=(TestJsonName1&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestJsonName1& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJsonName1* internal_default_instance() {
+    return reinterpret_cast<const TestJsonName1*>(
+               &_TestJsonName1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  void Swap(TestJsonName1* other);
+  friend void swap(TestJsonName1& a, TestJsonName1& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJsonName1* New() const final {
+    return CreateMaybeMessage<TestJsonName1>(nullptr);
+  }
+
+  TestJsonName1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJsonName1>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJsonName1& from);
+  void MergeFrom(const TestJsonName1& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJsonName1* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestJsonName1";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 one_value = 1[json_name = "value"];
+  bool has_one_value() const;
+  void clear_one_value();
+  static const int kOneValueFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 one_value() const;
+  void set_one_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestJsonName1)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 one_value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJsonName2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestJsonName2) */ {
+ public:
+  TestJsonName2();
+  virtual ~TestJsonName2();
+
+  TestJsonName2(const TestJsonName2& from);
+  TestJsonName2(TestJsonName2&& from) noexcept
+    : TestJsonName2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJsonName2& operator=(const TestJsonName2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJsonName2& operator=(TestJsonName2&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestJsonName2& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJsonName2* internal_default_instance() {
+    return reinterpret_cast<const TestJsonName2*>(
+               &_TestJsonName2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  void Swap(TestJsonName2* other);
+  friend void swap(TestJsonName2& a, TestJsonName2& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJsonName2* New() const final {
+    return CreateMaybeMessage<TestJsonName2>(nullptr);
+  }
+
+  TestJsonName2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJsonName2>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJsonName2& from);
+  void MergeFrom(const TestJsonName2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJsonName2* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestJsonName2";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 another_value = 1[json_name = "value"];
+  bool has_another_value() const;
+  void clear_another_value();
+  static const int kAnotherValueFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 another_value() const;
+  void set_another_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestJsonName2)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 another_value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// ===================================================================
+
+static const int kMoreAuthorFieldNumber = 201;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::proto_util_converter::testing::Book,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::proto_util_converter::testing::Author >, 11, false >
+  more_author;
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Book_Data
+
+// optional uint32 year = 7;
+inline bool Book_Data::has_year() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Book_Data::clear_year() {
+  year_ = 0u;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Book_Data::year() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Data.year)
+  return year_;
+}
+inline void Book_Data::set_year(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  year_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Data.year)
+}
+
+// optional string copyright = 8;
+inline bool Book_Data::has_copyright() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Book_Data::clear_copyright() {
+  copyright_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Book_Data::copyright() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Data.copyright)
+  return copyright_.GetNoArena();
+}
+inline void Book_Data::set_copyright(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Data.copyright)
+}
+inline void Book_Data::set_copyright(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.Data.copyright)
+}
+inline void Book_Data::set_copyright(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.Data.copyright)
+}
+inline void Book_Data::set_copyright(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.Data.copyright)
+}
+inline std::string* Book_Data::mutable_copyright() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.Data.copyright)
+  return copyright_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Book_Data::release_copyright() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.Data.copyright)
+  if (!has_copyright()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return copyright_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Book_Data::set_allocated_copyright(std::string* copyright) {
+  if (copyright != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  copyright_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), copyright);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.Data.copyright)
+}
+
+// -------------------------------------------------------------------
+
+// Book_Label
+
+// optional string key = 1;
+inline bool Book_Label::has_key() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Book_Label::clear_key() {
+  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Book_Label::key() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Label.key)
+  return key_.GetNoArena();
+}
+inline void Book_Label::set_key(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Label.key)
+}
+inline void Book_Label::set_key(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  key_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.Label.key)
+}
+inline void Book_Label::set_key(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.Label.key)
+}
+inline void Book_Label::set_key(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.Label.key)
+}
+inline std::string* Book_Label::mutable_key() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.Label.key)
+  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Book_Label::release_key() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.Label.key)
+  if (!has_key()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return key_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Book_Label::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.Label.key)
+}
+
+// optional string value = 2;
+inline bool Book_Label::has_value() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Book_Label::clear_value() {
+  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Book_Label::value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Label.value)
+  return value_.GetNoArena();
+}
+inline void Book_Label::set_value(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Label.value)
+}
+inline void Book_Label::set_value(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  value_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.Label.value)
+}
+inline void Book_Label::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.Label.value)
+}
+inline void Book_Label::set_value(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.Label.value)
+}
+inline std::string* Book_Label::mutable_value() {
+  _has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.Label.value)
+  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Book_Label::release_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.Label.value)
+  if (!has_value()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return value_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Book_Label::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.Label.value)
+}
+
+// -------------------------------------------------------------------
+
+// Book
+
+// optional string title = 1;
+inline bool Book::has_title() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Book::clear_title() {
+  title_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Book::title() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.title)
+  return title_.GetNoArena();
+}
+inline void Book::set_title(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  title_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.title)
+}
+inline void Book::set_title(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  title_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.title)
+}
+inline void Book::set_title(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  title_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.title)
+}
+inline void Book::set_title(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  title_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.title)
+}
+inline std::string* Book::mutable_title() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.title)
+  return title_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Book::release_title() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.title)
+  if (!has_title()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return title_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Book::set_allocated_title(std::string* title) {
+  if (title != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  title_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), title);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.title)
+}
+
+// optional .proto_util_converter.testing.Author author = 2;
+inline bool Book::has_author() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Book::clear_author() {
+  if (author_ != nullptr) author_->Clear();
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline const ::proto_util_converter::testing::Author& Book::author() const {
+  const ::proto_util_converter::testing::Author* p = author_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.author)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Author*>(
+      &::proto_util_converter::testing::_Author_default_instance_);
+}
+inline ::proto_util_converter::testing::Author* Book::release_author() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.author)
+  _has_bits_[0] &= ~0x00000008u;
+  ::proto_util_converter::testing::Author* temp = author_;
+  author_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Author* Book::mutable_author() {
+  _has_bits_[0] |= 0x00000008u;
+  if (author_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Author>(GetArenaNoVirtual());
+    author_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.author)
+  return author_;
+}
+inline void Book::set_allocated_author(::proto_util_converter::testing::Author* author) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete author_;
+  }
+  if (author) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      author = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, author, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  author_ = author;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.author)
+}
+
+// optional uint32 length = 3;
+inline bool Book::has_length() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void Book::clear_length() {
+  length_ = 0u;
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Book::length() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.length)
+  return length_;
+}
+inline void Book::set_length(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000100u;
+  length_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.length)
+}
+
+// optional int64 published = 4;
+inline bool Book::has_published() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void Book::clear_published() {
+  published_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Book::published() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.published)
+  return published_;
+}
+inline void Book::set_published(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000080u;
+  published_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.published)
+}
+
+// optional bytes content = 5;
+inline bool Book::has_content() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Book::clear_content() {
+  content_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Book::content() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.content)
+  return content_.GetNoArena();
+}
+inline void Book::set_content(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.content)
+}
+inline void Book::set_content(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  content_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.content)
+}
+inline void Book::set_content(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.content)
+}
+inline void Book::set_content(const void* value, size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.content)
+}
+inline std::string* Book::mutable_content() {
+  _has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.content)
+  return content_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Book::release_content() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.content)
+  if (!has_content()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return content_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Book::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  content_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.content)
+}
+
+// optional group Data = 6 { ... };
+inline bool Book::has_data() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Book::clear_data() {
+  if (data_ != nullptr) data_->Clear();
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline const ::proto_util_converter::testing::Book_Data& Book::data() const {
+  const ::proto_util_converter::testing::Book_Data* p = data_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.data)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Book_Data*>(
+      &::proto_util_converter::testing::_Book_Data_default_instance_);
+}
+inline ::proto_util_converter::testing::Book_Data* Book::release_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.data)
+  _has_bits_[0] &= ~0x00000010u;
+  ::proto_util_converter::testing::Book_Data* temp = data_;
+  data_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Book_Data* Book::mutable_data() {
+  _has_bits_[0] |= 0x00000010u;
+  if (data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Book_Data>(GetArenaNoVirtual());
+    data_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.data)
+  return data_;
+}
+inline void Book::set_allocated_data(::proto_util_converter::testing::Book_Data* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.data)
+}
+
+// optional .proto_util_converter.testing.Publisher publisher = 9;
+inline bool Book::has_publisher() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Book::clear_publisher() {
+  if (publisher_ != nullptr) publisher_->Clear();
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline const ::proto_util_converter::testing::Publisher& Book::publisher() const {
+  const ::proto_util_converter::testing::Publisher* p = publisher_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.publisher)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Publisher*>(
+      &::proto_util_converter::testing::_Publisher_default_instance_);
+}
+inline ::proto_util_converter::testing::Publisher* Book::release_publisher() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.publisher)
+  _has_bits_[0] &= ~0x00000020u;
+  ::proto_util_converter::testing::Publisher* temp = publisher_;
+  publisher_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Publisher* Book::mutable_publisher() {
+  _has_bits_[0] |= 0x00000020u;
+  if (publisher_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Publisher>(GetArenaNoVirtual());
+    publisher_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.publisher)
+  return publisher_;
+}
+inline void Book::set_allocated_publisher(::proto_util_converter::testing::Publisher* publisher) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete publisher_;
+  }
+  if (publisher) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      publisher = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, publisher, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000020u;
+  } else {
+    _has_bits_[0] &= ~0x00000020u;
+  }
+  publisher_ = publisher;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.publisher)
+}
+
+// repeated .proto_util_converter.testing.Book.Label labels = 10;
+inline int Book::labels_size() const {
+  return labels_.size();
+}
+inline void Book::clear_labels() {
+  labels_.Clear();
+}
+inline ::proto_util_converter::testing::Book_Label* Book::mutable_labels(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.labels)
+  return labels_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >*
+Book::mutable_labels() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Book.labels)
+  return &labels_;
+}
+inline const ::proto_util_converter::testing::Book_Label& Book::labels(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.labels)
+  return labels_.Get(index);
+}
+inline ::proto_util_converter::testing::Book_Label* Book::add_labels() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Book.labels)
+  return labels_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >&
+Book::labels() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Book.labels)
+  return labels_;
+}
+
+// optional .proto_util_converter.testing.Book.Type type = 11;
+inline bool Book::has_type() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void Book::clear_type() {
+  type_ = 1;
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline ::proto_util_converter::testing::Book_Type Book::type() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.type)
+  return static_cast< ::proto_util_converter::testing::Book_Type >(type_);
+}
+inline void Book::set_type(::proto_util_converter::testing::Book_Type value) {
+  assert(::proto_util_converter::testing::Book_Type_IsValid(value));
+  _has_bits_[0] |= 0x00000200u;
+  type_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.type)
+}
+
+// optional string snake_field = 12;
+inline bool Book::has_snake_field() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Book::clear_snake_field() {
+  snake_field_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Book::snake_field() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.snake_field)
+  return snake_field_.GetNoArena();
+}
+inline void Book::set_snake_field(const std::string& value) {
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.snake_field)
+}
+inline void Book::set_snake_field(std::string&& value) {
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.snake_field)
+}
+inline void Book::set_snake_field(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.snake_field)
+}
+inline void Book::set_snake_field(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.snake_field)
+}
+inline std::string* Book::mutable_snake_field() {
+  _has_bits_[0] |= 0x00000004u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.snake_field)
+  return snake_field_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Book::release_snake_field() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.snake_field)
+  if (!has_snake_field()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000004u;
+  return snake_field_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Book::set_allocated_snake_field(std::string* snake_field) {
+  if (snake_field != nullptr) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  snake_field_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), snake_field);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.snake_field)
+}
+
+// optional .proto_util_converter.testing.AnyWrapper type_not_found = 13;
+inline bool Book::has_type_not_found() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& Book::type_not_found() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = type_not_found_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.type_not_found)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::AnyWrapper* Book::release_type_not_found() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.type_not_found)
+  _has_bits_[0] &= ~0x00000040u;
+  ::proto_util_converter::testing::AnyWrapper* temp = type_not_found_;
+  type_not_found_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* Book::mutable_type_not_found() {
+  _has_bits_[0] |= 0x00000040u;
+  if (type_not_found_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArenaNoVirtual());
+    type_not_found_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.type_not_found)
+  return type_not_found_;
+}
+inline void Book::set_allocated_type_not_found(::proto_util_converter::testing::AnyWrapper* type_not_found) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_not_found_);
+  }
+  if (type_not_found) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      type_not_found = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, type_not_found, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000040u;
+  } else {
+    _has_bits_[0] &= ~0x00000040u;
+  }
+  type_not_found_ = type_not_found;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.type_not_found)
+}
+
+// repeated int32 primitive_repeated = 14;
+inline int Book::primitive_repeated_size() const {
+  return primitive_repeated_.size();
+}
+inline void Book::clear_primitive_repeated() {
+  primitive_repeated_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Book::primitive_repeated(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.primitive_repeated)
+  return primitive_repeated_.Get(index);
+}
+inline void Book::set_primitive_repeated(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  primitive_repeated_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.primitive_repeated)
+}
+inline void Book::add_primitive_repeated(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  primitive_repeated_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Book.primitive_repeated)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Book::primitive_repeated() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Book.primitive_repeated)
+  return primitive_repeated_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Book::mutable_primitive_repeated() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Book.primitive_repeated)
+  return &primitive_repeated_;
+}
+
+// -------------------------------------------------------------------
+
+// Publisher
+
+// required string name = 1;
+inline bool Publisher::has_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Publisher::clear_name() {
+  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Publisher::name() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Publisher.name)
+  return name_.GetNoArena();
+}
+inline void Publisher::set_name(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Publisher.name)
+}
+inline void Publisher::set_name(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Publisher.name)
+}
+inline void Publisher::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Publisher.name)
+}
+inline void Publisher::set_name(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Publisher.name)
+}
+inline std::string* Publisher::mutable_name() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Publisher.name)
+  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Publisher::release_name() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Publisher.name)
+  if (!has_name()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Publisher::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Publisher.name)
+}
+
+// -------------------------------------------------------------------
+
+// Author
+
+// optional uint64 id = 1[json_name = "@id"];
+inline bool Author::has_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Author::clear_id() {
+  id_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Author::id() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.id)
+  return id_;
+}
+inline void Author::set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000002u;
+  id_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.id)
+}
+
+// optional string name = 2;
+inline bool Author::has_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Author::clear_name() {
+  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Author::name() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.name)
+  return name_.GetNoArena();
+}
+inline void Author::set_name(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.name)
+}
+inline void Author::set_name(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Author.name)
+}
+inline void Author::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Author.name)
+}
+inline void Author::set_name(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Author.name)
+}
+inline std::string* Author::mutable_name() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Author.name)
+  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Author::release_name() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Author.name)
+  if (!has_name()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Author::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Author.name)
+}
+
+// repeated string pseudonym = 3;
+inline int Author::pseudonym_size() const {
+  return pseudonym_.size();
+}
+inline void Author::clear_pseudonym() {
+  pseudonym_.Clear();
+}
+inline const std::string& Author::pseudonym(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.pseudonym)
+  return pseudonym_.Get(index);
+}
+inline std::string* Author::mutable_pseudonym(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Author.pseudonym)
+  return pseudonym_.Mutable(index);
+}
+inline void Author::set_pseudonym(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.pseudonym)
+  pseudonym_.Mutable(index)->assign(value);
+}
+inline void Author::set_pseudonym(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.pseudonym)
+  pseudonym_.Mutable(index)->assign(std::move(value));
+}
+inline void Author::set_pseudonym(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  pseudonym_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::set_pseudonym(int index, const char* value, size_t size) {
+  pseudonym_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Author.pseudonym)
+}
+inline std::string* Author::add_pseudonym() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Author.pseudonym)
+  return pseudonym_.Add();
+}
+inline void Author::add_pseudonym(const std::string& value) {
+  pseudonym_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::add_pseudonym(std::string&& value) {
+  pseudonym_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::add_pseudonym(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  pseudonym_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::add_pseudonym(const char* value, size_t size) {
+  pseudonym_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Author.pseudonym)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Author::pseudonym() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Author.pseudonym)
+  return pseudonym_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Author::mutable_pseudonym() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Author.pseudonym)
+  return &pseudonym_;
+}
+
+// optional bool alive = 4;
+inline bool Author::has_alive() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Author::clear_alive() {
+  alive_ = false;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline bool Author::alive() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.alive)
+  return alive_;
+}
+inline void Author::set_alive(bool value) {
+  _has_bits_[0] |= 0x00000004u;
+  alive_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.alive)
+}
+
+// repeated .proto_util_converter.testing.Author friend = 5;
+inline int Author::friend__size() const {
+  return friend__.size();
+}
+inline void Author::clear_friend_() {
+  friend__.Clear();
+}
+inline ::proto_util_converter::testing::Author* Author::mutable_friend_(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Author.friend)
+  return friend__.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+Author::mutable_friend_() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Author.friend)
+  return &friend__;
+}
+inline const ::proto_util_converter::testing::Author& Author::friend_(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.friend)
+  return friend__.Get(index);
+}
+inline ::proto_util_converter::testing::Author* Author::add_friend_() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Author.friend)
+  return friend__.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+Author::friend_() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Author.friend)
+  return friend__;
+}
+
+// -------------------------------------------------------------------
+
+// BadAuthor
+
+// optional string id = 1;
+inline bool BadAuthor::has_id() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void BadAuthor::clear_id() {
+  id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BadAuthor::id() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.id)
+  return id_.GetNoArena();
+}
+inline void BadAuthor::set_id(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.id)
+}
+inline void BadAuthor::set_id(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  id_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.BadAuthor.id)
+}
+inline void BadAuthor::set_id(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.BadAuthor.id)
+}
+inline void BadAuthor::set_id(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.BadAuthor.id)
+}
+inline std::string* BadAuthor::mutable_id() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.BadAuthor.id)
+  return id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* BadAuthor::release_id() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.BadAuthor.id)
+  if (!has_id()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void BadAuthor::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), id);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.BadAuthor.id)
+}
+
+// repeated uint64 name = 2;
+inline int BadAuthor::name_size() const {
+  return name_.size();
+}
+inline void BadAuthor::clear_name() {
+  name_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 BadAuthor::name(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.name)
+  return name_.Get(index);
+}
+inline void BadAuthor::set_name(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  name_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.name)
+}
+inline void BadAuthor::add_name(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  name_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.BadAuthor.name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+BadAuthor::name() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.BadAuthor.name)
+  return name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+BadAuthor::mutable_name() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.BadAuthor.name)
+  return &name_;
+}
+
+// optional string pseudonym = 3;
+inline bool BadAuthor::has_pseudonym() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void BadAuthor::clear_pseudonym() {
+  pseudonym_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BadAuthor::pseudonym() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.pseudonym)
+  return pseudonym_.GetNoArena();
+}
+inline void BadAuthor::set_pseudonym(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline void BadAuthor::set_pseudonym(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline void BadAuthor::set_pseudonym(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline void BadAuthor::set_pseudonym(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline std::string* BadAuthor::mutable_pseudonym() {
+  _has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.BadAuthor.pseudonym)
+  return pseudonym_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* BadAuthor::release_pseudonym() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.BadAuthor.pseudonym)
+  if (!has_pseudonym()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return pseudonym_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void BadAuthor::set_allocated_pseudonym(std::string* pseudonym) {
+  if (pseudonym != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  pseudonym_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), pseudonym);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+
+// repeated bool alive = 4 [packed = true];
+inline int BadAuthor::alive_size() const {
+  return alive_.size();
+}
+inline void BadAuthor::clear_alive() {
+  alive_.Clear();
+}
+inline bool BadAuthor::alive(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.alive)
+  return alive_.Get(index);
+}
+inline void BadAuthor::set_alive(int index, bool value) {
+  alive_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.alive)
+}
+inline void BadAuthor::add_alive(bool value) {
+  alive_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.BadAuthor.alive)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+BadAuthor::alive() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.BadAuthor.alive)
+  return alive_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+BadAuthor::mutable_alive() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.BadAuthor.alive)
+  return &alive_;
+}
+
+// -------------------------------------------------------------------
+
+// Primitive
+
+// optional fixed32 fix32 = 1;
+inline bool Primitive::has_fix32() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Primitive::clear_fix32() {
+  fix32_ = 0u;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::fix32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.fix32)
+  return fix32_;
+}
+inline void Primitive::set_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  fix32_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.fix32)
+}
+
+// optional uint32 u32 = 2;
+inline bool Primitive::has_u32() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Primitive::clear_u32() {
+  u32_ = 0u;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::u32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.u32)
+  return u32_;
+}
+inline void Primitive::set_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  u32_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.u32)
+}
+
+// optional int32 i32 = 3;
+inline bool Primitive::has_i32() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Primitive::clear_i32() {
+  i32_ = 0;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::i32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.i32)
+  return i32_;
+}
+inline void Primitive::set_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000010u;
+  i32_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.i32)
+}
+
+// optional sfixed32 sf32 = 4;
+inline bool Primitive::has_sf32() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Primitive::clear_sf32() {
+  sf32_ = 0;
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::sf32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.sf32)
+  return sf32_;
+}
+inline void Primitive::set_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000020u;
+  sf32_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.sf32)
+}
+
+// optional sint32 s32 = 5;
+inline bool Primitive::has_s32() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void Primitive::clear_s32() {
+  s32_ = 0;
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::s32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.s32)
+  return s32_;
+}
+inline void Primitive::set_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000400u;
+  s32_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.s32)
+}
+
+// optional fixed64 fix64 = 6;
+inline bool Primitive::has_fix64() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void Primitive::clear_fix64() {
+  fix64_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::fix64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.fix64)
+  return fix64_;
+}
+inline void Primitive::set_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000040u;
+  fix64_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.fix64)
+}
+
+// optional uint64 u64 = 7;
+inline bool Primitive::has_u64() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void Primitive::clear_u64() {
+  u64_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::u64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.u64)
+  return u64_;
+}
+inline void Primitive::set_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000080u;
+  u64_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.u64)
+}
+
+// optional int64 i64 = 8;
+inline bool Primitive::has_i64() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void Primitive::clear_i64() {
+  i64_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::i64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.i64)
+  return i64_;
+}
+inline void Primitive::set_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000100u;
+  i64_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.i64)
+}
+
+// optional sfixed64 sf64 = 9;
+inline bool Primitive::has_sf64() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void Primitive::clear_sf64() {
+  sf64_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::sf64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.sf64)
+  return sf64_;
+}
+inline void Primitive::set_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000200u;
+  sf64_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.sf64)
+}
+
+// optional sint64 s64 = 10;
+inline bool Primitive::has_s64() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void Primitive::clear_s64() {
+  s64_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::s64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.s64)
+  return s64_;
+}
+inline void Primitive::set_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00001000u;
+  s64_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.s64)
+}
+
+// optional string str = 11;
+inline bool Primitive::has_str() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Primitive::clear_str() {
+  str_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Primitive::str() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.str)
+  return str_.GetNoArena();
+}
+inline void Primitive::set_str(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.str)
+}
+inline void Primitive::set_str(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  str_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Primitive.str)
+}
+inline void Primitive::set_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.str)
+}
+inline void Primitive::set_str(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.str)
+}
+inline std::string* Primitive::mutable_str() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.str)
+  return str_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Primitive::release_str() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Primitive.str)
+  if (!has_str()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return str_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Primitive::set_allocated_str(std::string* str) {
+  if (str != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  str_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), str);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Primitive.str)
+}
+
+// optional bytes bytes = 12;
+inline bool Primitive::has_bytes() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Primitive::clear_bytes() {
+  bytes_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Primitive::bytes() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.bytes)
+  return bytes_.GetNoArena();
+}
+inline void Primitive::set_bytes(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.bytes)
+}
+inline void Primitive::set_bytes(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Primitive.bytes)
+}
+inline void Primitive::set_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.bytes)
+}
+inline void Primitive::set_bytes(const void* value, size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.bytes)
+}
+inline std::string* Primitive::mutable_bytes() {
+  _has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.bytes)
+  return bytes_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Primitive::release_bytes() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Primitive.bytes)
+  if (!has_bytes()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return bytes_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Primitive::set_allocated_bytes(std::string* bytes) {
+  if (bytes != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  bytes_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bytes);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Primitive.bytes)
+}
+
+// optional float float = 13;
+inline bool Primitive::has_float_() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void Primitive::clear_float_() {
+  float__ = 0;
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline float Primitive::float_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.float)
+  return float__;
+}
+inline void Primitive::set_float_(float value) {
+  _has_bits_[0] |= 0x00000800u;
+  float__ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.float)
+}
+
+// optional double double = 14;
+inline bool Primitive::has_double_() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void Primitive::clear_double_() {
+  double__ = 0;
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline double Primitive::double_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.double)
+  return double__;
+}
+inline void Primitive::set_double_(double value) {
+  _has_bits_[0] |= 0x00002000u;
+  double__ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.double)
+}
+
+// optional bool bool = 15;
+inline bool Primitive::has_bool_() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void Primitive::clear_bool_() {
+  bool__ = false;
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline bool Primitive::bool_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.bool)
+  return bool__;
+}
+inline void Primitive::set_bool_(bool value) {
+  _has_bits_[0] |= 0x00004000u;
+  bool__ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.bool)
+}
+
+// repeated fixed32 rep_fix32 = 16;
+inline int Primitive::rep_fix32_size() const {
+  return rep_fix32_.size();
+}
+inline void Primitive::clear_rep_fix32() {
+  rep_fix32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::rep_fix32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_fix32)
+  return rep_fix32_.Get(index);
+}
+inline void Primitive::set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_fix32)
+}
+inline void Primitive::add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_fix32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+Primitive::rep_fix32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_fix32)
+  return rep_fix32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+Primitive::mutable_rep_fix32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_fix32)
+  return &rep_fix32_;
+}
+
+// repeated uint32 rep_u32 = 17;
+inline int Primitive::rep_u32_size() const {
+  return rep_u32_.size();
+}
+inline void Primitive::clear_rep_u32() {
+  rep_u32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::rep_u32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_u32)
+  return rep_u32_.Get(index);
+}
+inline void Primitive::set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_u32)
+}
+inline void Primitive::add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_u32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+Primitive::rep_u32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_u32)
+  return rep_u32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+Primitive::mutable_rep_u32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_u32)
+  return &rep_u32_;
+}
+
+// repeated int32 rep_i32 = 18;
+inline int Primitive::rep_i32_size() const {
+  return rep_i32_.size();
+}
+inline void Primitive::clear_rep_i32() {
+  rep_i32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::rep_i32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_i32)
+  return rep_i32_.Get(index);
+}
+inline void Primitive::set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_i32)
+}
+inline void Primitive::add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_i32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::rep_i32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_i32)
+  return rep_i32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::mutable_rep_i32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_i32)
+  return &rep_i32_;
+}
+
+// repeated sfixed32 rep_sf32 = 19;
+inline int Primitive::rep_sf32_size() const {
+  return rep_sf32_.size();
+}
+inline void Primitive::clear_rep_sf32() {
+  rep_sf32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::rep_sf32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_sf32)
+  return rep_sf32_.Get(index);
+}
+inline void Primitive::set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_sf32)
+}
+inline void Primitive::add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_sf32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::rep_sf32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_sf32)
+  return rep_sf32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::mutable_rep_sf32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_sf32)
+  return &rep_sf32_;
+}
+
+// repeated sint32 rep_s32 = 20;
+inline int Primitive::rep_s32_size() const {
+  return rep_s32_.size();
+}
+inline void Primitive::clear_rep_s32() {
+  rep_s32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::rep_s32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_s32)
+  return rep_s32_.Get(index);
+}
+inline void Primitive::set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_s32)
+}
+inline void Primitive::add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_s32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::rep_s32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_s32)
+  return rep_s32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::mutable_rep_s32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_s32)
+  return &rep_s32_;
+}
+
+// repeated fixed64 rep_fix64 = 21;
+inline int Primitive::rep_fix64_size() const {
+  return rep_fix64_.size();
+}
+inline void Primitive::clear_rep_fix64() {
+  rep_fix64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::rep_fix64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_fix64)
+  return rep_fix64_.Get(index);
+}
+inline void Primitive::set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_fix64)
+}
+inline void Primitive::add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_fix64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+Primitive::rep_fix64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_fix64)
+  return rep_fix64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+Primitive::mutable_rep_fix64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_fix64)
+  return &rep_fix64_;
+}
+
+// repeated uint64 rep_u64 = 22;
+inline int Primitive::rep_u64_size() const {
+  return rep_u64_.size();
+}
+inline void Primitive::clear_rep_u64() {
+  rep_u64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::rep_u64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_u64)
+  return rep_u64_.Get(index);
+}
+inline void Primitive::set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_u64)
+}
+inline void Primitive::add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_u64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+Primitive::rep_u64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_u64)
+  return rep_u64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+Primitive::mutable_rep_u64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_u64)
+  return &rep_u64_;
+}
+
+// repeated int64 rep_i64 = 23;
+inline int Primitive::rep_i64_size() const {
+  return rep_i64_.size();
+}
+inline void Primitive::clear_rep_i64() {
+  rep_i64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::rep_i64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_i64)
+  return rep_i64_.Get(index);
+}
+inline void Primitive::set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_i64)
+}
+inline void Primitive::add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_i64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::rep_i64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_i64)
+  return rep_i64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::mutable_rep_i64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_i64)
+  return &rep_i64_;
+}
+
+// repeated sfixed64 rep_sf64 = 24;
+inline int Primitive::rep_sf64_size() const {
+  return rep_sf64_.size();
+}
+inline void Primitive::clear_rep_sf64() {
+  rep_sf64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::rep_sf64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_sf64)
+  return rep_sf64_.Get(index);
+}
+inline void Primitive::set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_sf64)
+}
+inline void Primitive::add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_sf64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::rep_sf64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_sf64)
+  return rep_sf64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::mutable_rep_sf64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_sf64)
+  return &rep_sf64_;
+}
+
+// repeated sint64 rep_s64 = 25;
+inline int Primitive::rep_s64_size() const {
+  return rep_s64_.size();
+}
+inline void Primitive::clear_rep_s64() {
+  rep_s64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::rep_s64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_s64)
+  return rep_s64_.Get(index);
+}
+inline void Primitive::set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_s64)
+}
+inline void Primitive::add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_s64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::rep_s64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_s64)
+  return rep_s64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::mutable_rep_s64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_s64)
+  return &rep_s64_;
+}
+
+// repeated string rep_str = 26;
+inline int Primitive::rep_str_size() const {
+  return rep_str_.size();
+}
+inline void Primitive::clear_rep_str() {
+  rep_str_.Clear();
+}
+inline const std::string& Primitive::rep_str(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_str)
+  return rep_str_.Get(index);
+}
+inline std::string* Primitive::mutable_rep_str(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.rep_str)
+  return rep_str_.Mutable(index);
+}
+inline void Primitive::set_rep_str(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_str)
+  rep_str_.Mutable(index)->assign(value);
+}
+inline void Primitive::set_rep_str(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_str)
+  rep_str_.Mutable(index)->assign(std::move(value));
+}
+inline void Primitive::set_rep_str(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::set_rep_str(int index, const char* value, size_t size) {
+  rep_str_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.rep_str)
+}
+inline std::string* Primitive::add_rep_str() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Primitive.rep_str)
+  return rep_str_.Add();
+}
+inline void Primitive::add_rep_str(const std::string& value) {
+  rep_str_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::add_rep_str(std::string&& value) {
+  rep_str_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::add_rep_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::add_rep_str(const char* value, size_t size) {
+  rep_str_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Primitive.rep_str)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Primitive::rep_str() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_str)
+  return rep_str_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Primitive::mutable_rep_str() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_str)
+  return &rep_str_;
+}
+
+// repeated bytes rep_bytes = 27;
+inline int Primitive::rep_bytes_size() const {
+  return rep_bytes_.size();
+}
+inline void Primitive::clear_rep_bytes() {
+  rep_bytes_.Clear();
+}
+inline const std::string& Primitive::rep_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_bytes)
+  return rep_bytes_.Get(index);
+}
+inline std::string* Primitive::mutable_rep_bytes(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.rep_bytes)
+  return rep_bytes_.Mutable(index);
+}
+inline void Primitive::set_rep_bytes(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_bytes)
+  rep_bytes_.Mutable(index)->assign(value);
+}
+inline void Primitive::set_rep_bytes(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_bytes)
+  rep_bytes_.Mutable(index)->assign(std::move(value));
+}
+inline void Primitive::set_rep_bytes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_bytes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::set_rep_bytes(int index, const void* value, size_t size) {
+  rep_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline std::string* Primitive::add_rep_bytes() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Primitive.rep_bytes)
+  return rep_bytes_.Add();
+}
+inline void Primitive::add_rep_bytes(const std::string& value) {
+  rep_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::add_rep_bytes(std::string&& value) {
+  rep_bytes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::add_rep_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::add_rep_bytes(const void* value, size_t size) {
+  rep_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Primitive::rep_bytes() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_bytes)
+  return rep_bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Primitive::mutable_rep_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_bytes)
+  return &rep_bytes_;
+}
+
+// repeated float rep_float = 28;
+inline int Primitive::rep_float_size() const {
+  return rep_float_.size();
+}
+inline void Primitive::clear_rep_float() {
+  rep_float_.Clear();
+}
+inline float Primitive::rep_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_float)
+  return rep_float_.Get(index);
+}
+inline void Primitive::set_rep_float(int index, float value) {
+  rep_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_float)
+}
+inline void Primitive::add_rep_float(float value) {
+  rep_float_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Primitive::rep_float() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_float)
+  return rep_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Primitive::mutable_rep_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_float)
+  return &rep_float_;
+}
+
+// repeated double rep_double = 29;
+inline int Primitive::rep_double_size() const {
+  return rep_double_.size();
+}
+inline void Primitive::clear_rep_double() {
+  rep_double_.Clear();
+}
+inline double Primitive::rep_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_double)
+  return rep_double_.Get(index);
+}
+inline void Primitive::set_rep_double(int index, double value) {
+  rep_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_double)
+}
+inline void Primitive::add_rep_double(double value) {
+  rep_double_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Primitive::rep_double() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_double)
+  return rep_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Primitive::mutable_rep_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_double)
+  return &rep_double_;
+}
+
+// repeated bool rep_bool = 30;
+inline int Primitive::rep_bool_size() const {
+  return rep_bool_.size();
+}
+inline void Primitive::clear_rep_bool() {
+  rep_bool_.Clear();
+}
+inline bool Primitive::rep_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_bool)
+  return rep_bool_.Get(index);
+}
+inline void Primitive::set_rep_bool(int index, bool value) {
+  rep_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_bool)
+}
+inline void Primitive::add_rep_bool(bool value) {
+  rep_bool_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+Primitive::rep_bool() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_bool)
+  return rep_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+Primitive::mutable_rep_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_bool)
+  return &rep_bool_;
+}
+
+// -------------------------------------------------------------------
+
+// PackedPrimitive
+
+// repeated fixed32 rep_fix32 = 16 [packed = true];
+inline int PackedPrimitive::rep_fix32_size() const {
+  return rep_fix32_.size();
+}
+inline void PackedPrimitive::clear_rep_fix32() {
+  rep_fix32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PackedPrimitive::rep_fix32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+  return rep_fix32_.Get(index);
+}
+inline void PackedPrimitive::set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+}
+inline void PackedPrimitive::add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+PackedPrimitive::rep_fix32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+  return rep_fix32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+PackedPrimitive::mutable_rep_fix32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+  return &rep_fix32_;
+}
+
+// repeated uint32 rep_u32 = 17 [packed = true];
+inline int PackedPrimitive::rep_u32_size() const {
+  return rep_u32_.size();
+}
+inline void PackedPrimitive::clear_rep_u32() {
+  rep_u32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PackedPrimitive::rep_u32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_u32)
+  return rep_u32_.Get(index);
+}
+inline void PackedPrimitive::set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_u32)
+}
+inline void PackedPrimitive::add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_u32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+PackedPrimitive::rep_u32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_u32)
+  return rep_u32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+PackedPrimitive::mutable_rep_u32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_u32)
+  return &rep_u32_;
+}
+
+// repeated int32 rep_i32 = 18 [packed = true];
+inline int PackedPrimitive::rep_i32_size() const {
+  return rep_i32_.size();
+}
+inline void PackedPrimitive::clear_rep_i32() {
+  rep_i32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::rep_i32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_i32)
+  return rep_i32_.Get(index);
+}
+inline void PackedPrimitive::set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_i32)
+}
+inline void PackedPrimitive::add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_i32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::rep_i32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_i32)
+  return rep_i32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::mutable_rep_i32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_i32)
+  return &rep_i32_;
+}
+
+// repeated sfixed32 rep_sf32 = 19 [packed = true];
+inline int PackedPrimitive::rep_sf32_size() const {
+  return rep_sf32_.size();
+}
+inline void PackedPrimitive::clear_rep_sf32() {
+  rep_sf32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::rep_sf32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+  return rep_sf32_.Get(index);
+}
+inline void PackedPrimitive::set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+}
+inline void PackedPrimitive::add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::rep_sf32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+  return rep_sf32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::mutable_rep_sf32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+  return &rep_sf32_;
+}
+
+// repeated sint32 rep_s32 = 20 [packed = true];
+inline int PackedPrimitive::rep_s32_size() const {
+  return rep_s32_.size();
+}
+inline void PackedPrimitive::clear_rep_s32() {
+  rep_s32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::rep_s32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_s32)
+  return rep_s32_.Get(index);
+}
+inline void PackedPrimitive::set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_s32)
+}
+inline void PackedPrimitive::add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_s32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::rep_s32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_s32)
+  return rep_s32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::mutable_rep_s32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_s32)
+  return &rep_s32_;
+}
+
+// repeated fixed64 rep_fix64 = 21 [packed = true];
+inline int PackedPrimitive::rep_fix64_size() const {
+  return rep_fix64_.size();
+}
+inline void PackedPrimitive::clear_rep_fix64() {
+  rep_fix64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PackedPrimitive::rep_fix64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+  return rep_fix64_.Get(index);
+}
+inline void PackedPrimitive::set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+}
+inline void PackedPrimitive::add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+PackedPrimitive::rep_fix64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+  return rep_fix64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+PackedPrimitive::mutable_rep_fix64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+  return &rep_fix64_;
+}
+
+// repeated uint64 rep_u64 = 22 [packed = true];
+inline int PackedPrimitive::rep_u64_size() const {
+  return rep_u64_.size();
+}
+inline void PackedPrimitive::clear_rep_u64() {
+  rep_u64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PackedPrimitive::rep_u64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_u64)
+  return rep_u64_.Get(index);
+}
+inline void PackedPrimitive::set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_u64)
+}
+inline void PackedPrimitive::add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_u64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+PackedPrimitive::rep_u64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_u64)
+  return rep_u64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+PackedPrimitive::mutable_rep_u64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_u64)
+  return &rep_u64_;
+}
+
+// repeated int64 rep_i64 = 23 [packed = true];
+inline int PackedPrimitive::rep_i64_size() const {
+  return rep_i64_.size();
+}
+inline void PackedPrimitive::clear_rep_i64() {
+  rep_i64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::rep_i64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_i64)
+  return rep_i64_.Get(index);
+}
+inline void PackedPrimitive::set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_i64)
+}
+inline void PackedPrimitive::add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_i64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::rep_i64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_i64)
+  return rep_i64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::mutable_rep_i64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_i64)
+  return &rep_i64_;
+}
+
+// repeated sfixed64 rep_sf64 = 24 [packed = true];
+inline int PackedPrimitive::rep_sf64_size() const {
+  return rep_sf64_.size();
+}
+inline void PackedPrimitive::clear_rep_sf64() {
+  rep_sf64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::rep_sf64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+  return rep_sf64_.Get(index);
+}
+inline void PackedPrimitive::set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+}
+inline void PackedPrimitive::add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::rep_sf64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+  return rep_sf64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::mutable_rep_sf64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+  return &rep_sf64_;
+}
+
+// repeated sint64 rep_s64 = 25 [packed = true];
+inline int PackedPrimitive::rep_s64_size() const {
+  return rep_s64_.size();
+}
+inline void PackedPrimitive::clear_rep_s64() {
+  rep_s64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::rep_s64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_s64)
+  return rep_s64_.Get(index);
+}
+inline void PackedPrimitive::set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_s64)
+}
+inline void PackedPrimitive::add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_s64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::rep_s64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_s64)
+  return rep_s64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::mutable_rep_s64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_s64)
+  return &rep_s64_;
+}
+
+// repeated float rep_float = 28 [packed = true];
+inline int PackedPrimitive::rep_float_size() const {
+  return rep_float_.size();
+}
+inline void PackedPrimitive::clear_rep_float() {
+  rep_float_.Clear();
+}
+inline float PackedPrimitive::rep_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_float)
+  return rep_float_.Get(index);
+}
+inline void PackedPrimitive::set_rep_float(int index, float value) {
+  rep_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_float)
+}
+inline void PackedPrimitive::add_rep_float(float value) {
+  rep_float_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+PackedPrimitive::rep_float() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_float)
+  return rep_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+PackedPrimitive::mutable_rep_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_float)
+  return &rep_float_;
+}
+
+// repeated double rep_double = 29 [packed = true];
+inline int PackedPrimitive::rep_double_size() const {
+  return rep_double_.size();
+}
+inline void PackedPrimitive::clear_rep_double() {
+  rep_double_.Clear();
+}
+inline double PackedPrimitive::rep_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_double)
+  return rep_double_.Get(index);
+}
+inline void PackedPrimitive::set_rep_double(int index, double value) {
+  rep_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_double)
+}
+inline void PackedPrimitive::add_rep_double(double value) {
+  rep_double_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+PackedPrimitive::rep_double() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_double)
+  return rep_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+PackedPrimitive::mutable_rep_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_double)
+  return &rep_double_;
+}
+
+// repeated bool rep_bool = 30 [packed = true];
+inline int PackedPrimitive::rep_bool_size() const {
+  return rep_bool_.size();
+}
+inline void PackedPrimitive::clear_rep_bool() {
+  rep_bool_.Clear();
+}
+inline bool PackedPrimitive::rep_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_bool)
+  return rep_bool_.Get(index);
+}
+inline void PackedPrimitive::set_rep_bool(int index, bool value) {
+  rep_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_bool)
+}
+inline void PackedPrimitive::add_rep_bool(bool value) {
+  rep_bool_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+PackedPrimitive::rep_bool() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_bool)
+  return rep_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+PackedPrimitive::mutable_rep_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_bool)
+  return &rep_bool_;
+}
+
+// -------------------------------------------------------------------
+
+// NestedBook
+
+// optional .proto_util_converter.testing.Book book = 1;
+inline bool NestedBook::has_book() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void NestedBook::clear_book() {
+  if (book_ != nullptr) book_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto_util_converter::testing::Book& NestedBook::book() const {
+  const ::proto_util_converter::testing::Book* p = book_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.NestedBook.book)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Book*>(
+      &::proto_util_converter::testing::_Book_default_instance_);
+}
+inline ::proto_util_converter::testing::Book* NestedBook::release_book() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.NestedBook.book)
+  _has_bits_[0] &= ~0x00000001u;
+  ::proto_util_converter::testing::Book* temp = book_;
+  book_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Book* NestedBook::mutable_book() {
+  _has_bits_[0] |= 0x00000001u;
+  if (book_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Book>(GetArenaNoVirtual());
+    book_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.NestedBook.book)
+  return book_;
+}
+inline void NestedBook::set_allocated_book(::proto_util_converter::testing::Book* book) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete book_;
+  }
+  if (book) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      book = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, book, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  book_ = book;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.NestedBook.book)
+}
+
+// -------------------------------------------------------------------
+
+// BadNestedBook
+
+// repeated uint32 book = 1 [packed = true];
+inline int BadNestedBook::book_size() const {
+  return book_.size();
+}
+inline void BadNestedBook::clear_book() {
+  book_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 BadNestedBook::book(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadNestedBook.book)
+  return book_.Get(index);
+}
+inline void BadNestedBook::set_book(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  book_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadNestedBook.book)
+}
+inline void BadNestedBook::add_book(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  book_.Add(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.BadNestedBook.book)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+BadNestedBook::book() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.BadNestedBook.book)
+  return book_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+BadNestedBook::mutable_book() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.BadNestedBook.book)
+  return &book_;
+}
+
+// -------------------------------------------------------------------
+
+// Cyclic
+
+// optional int32 m_int = 1;
+inline bool Cyclic::has_m_int() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Cyclic::clear_m_int() {
+  m_int_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Cyclic::m_int() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_int)
+  return m_int_;
+}
+inline void Cyclic::set_m_int(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  m_int_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Cyclic.m_int)
+}
+
+// optional string m_str = 2;
+inline bool Cyclic::has_m_str() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Cyclic::clear_m_str() {
+  m_str_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Cyclic::m_str() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_str)
+  return m_str_.GetNoArena();
+}
+inline void Cyclic::set_m_str(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Cyclic.m_str)
+}
+inline void Cyclic::set_m_str(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Cyclic.m_str)
+}
+inline void Cyclic::set_m_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Cyclic.m_str)
+}
+inline void Cyclic::set_m_str(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Cyclic.m_str)
+}
+inline std::string* Cyclic::mutable_m_str() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_str)
+  return m_str_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Cyclic::release_m_str() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Cyclic.m_str)
+  if (!has_m_str()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return m_str_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Cyclic::set_allocated_m_str(std::string* m_str) {
+  if (m_str != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  m_str_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), m_str);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Cyclic.m_str)
+}
+
+// optional .proto_util_converter.testing.Book m_book = 3;
+inline bool Cyclic::has_m_book() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Cyclic::clear_m_book() {
+  if (m_book_ != nullptr) m_book_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto_util_converter::testing::Book& Cyclic::m_book() const {
+  const ::proto_util_converter::testing::Book* p = m_book_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_book)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Book*>(
+      &::proto_util_converter::testing::_Book_default_instance_);
+}
+inline ::proto_util_converter::testing::Book* Cyclic::release_m_book() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Cyclic.m_book)
+  _has_bits_[0] &= ~0x00000002u;
+  ::proto_util_converter::testing::Book* temp = m_book_;
+  m_book_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Book* Cyclic::mutable_m_book() {
+  _has_bits_[0] |= 0x00000002u;
+  if (m_book_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Book>(GetArenaNoVirtual());
+    m_book_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_book)
+  return m_book_;
+}
+inline void Cyclic::set_allocated_m_book(::proto_util_converter::testing::Book* m_book) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete m_book_;
+  }
+  if (m_book) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      m_book = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, m_book, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  m_book_ = m_book;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Cyclic.m_book)
+}
+
+// repeated .proto_util_converter.testing.Author m_author = 5;
+inline int Cyclic::m_author_size() const {
+  return m_author_.size();
+}
+inline void Cyclic::clear_m_author() {
+  m_author_.Clear();
+}
+inline ::proto_util_converter::testing::Author* Cyclic::mutable_m_author(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_author)
+  return m_author_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+Cyclic::mutable_m_author() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Cyclic.m_author)
+  return &m_author_;
+}
+inline const ::proto_util_converter::testing::Author& Cyclic::m_author(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_author)
+  return m_author_.Get(index);
+}
+inline ::proto_util_converter::testing::Author* Cyclic::add_m_author() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Cyclic.m_author)
+  return m_author_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+Cyclic::m_author() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Cyclic.m_author)
+  return m_author_;
+}
+
+// optional .proto_util_converter.testing.Cyclic m_cyclic = 4;
+inline bool Cyclic::has_m_cyclic() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Cyclic::clear_m_cyclic() {
+  if (m_cyclic_ != nullptr) m_cyclic_->Clear();
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const ::proto_util_converter::testing::Cyclic& Cyclic::m_cyclic() const {
+  const ::proto_util_converter::testing::Cyclic* p = m_cyclic_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_cyclic)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Cyclic*>(
+      &::proto_util_converter::testing::_Cyclic_default_instance_);
+}
+inline ::proto_util_converter::testing::Cyclic* Cyclic::release_m_cyclic() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Cyclic.m_cyclic)
+  _has_bits_[0] &= ~0x00000004u;
+  ::proto_util_converter::testing::Cyclic* temp = m_cyclic_;
+  m_cyclic_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Cyclic* Cyclic::mutable_m_cyclic() {
+  _has_bits_[0] |= 0x00000004u;
+  if (m_cyclic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Cyclic>(GetArenaNoVirtual());
+    m_cyclic_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_cyclic)
+  return m_cyclic_;
+}
+inline void Cyclic::set_allocated_m_cyclic(::proto_util_converter::testing::Cyclic* m_cyclic) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete m_cyclic_;
+  }
+  if (m_cyclic) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      m_cyclic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, m_cyclic, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  m_cyclic_ = m_cyclic;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Cyclic.m_cyclic)
+}
+
+// -------------------------------------------------------------------
+
+// TestJsonName1
+
+// optional int32 one_value = 1[json_name = "value"];
+inline bool TestJsonName1::has_one_value() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestJsonName1::clear_one_value() {
+  one_value_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJsonName1::one_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestJsonName1.one_value)
+  return one_value_;
+}
+inline void TestJsonName1::set_one_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  one_value_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestJsonName1.one_value)
+}
+
+// -------------------------------------------------------------------
+
+// TestJsonName2
+
+// optional int32 another_value = 1[json_name = "value"];
+inline bool TestJsonName2::has_another_value() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestJsonName2::clear_another_value() {
+  another_value_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJsonName2::another_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestJsonName2.another_value)
+  return another_value_;
+}
+inline void TestJsonName2::set_another_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  another_value_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestJsonName2.another_value)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto_util_converter::testing::Book_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto_util_converter::testing::Book_Type>() {
+  return ::proto_util_converter::testing::Book_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
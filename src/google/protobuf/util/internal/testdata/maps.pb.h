@@ -0,0 +1,4980 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/maps.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/any.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[31]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto();
+namespace proto_util_converter {
+namespace testing {
+class BoolToString;
+class BoolToStringDefaultTypeInternal;
+extern BoolToStringDefaultTypeInternal _BoolToString_default_instance_;
+class BoolToString_MapEntry_DoNotUse;
+class BoolToString_MapEntry_DoNotUseDefaultTypeInternal;
+extern BoolToString_MapEntry_DoNotUseDefaultTypeInternal _BoolToString_MapEntry_DoNotUse_default_instance_;
+class DummyRequest;
+class DummyRequestDefaultTypeInternal;
+extern DummyRequestDefaultTypeInternal _DummyRequest_default_instance_;
+class EmptyMap;
+class EmptyMapDefaultTypeInternal;
+extern EmptyMapDefaultTypeInternal _EmptyMap_default_instance_;
+class EmptyMap_MapEntry_DoNotUse;
+class EmptyMap_MapEntry_DoNotUseDefaultTypeInternal;
+extern EmptyMap_MapEntry_DoNotUseDefaultTypeInternal _EmptyMap_MapEntry_DoNotUse_default_instance_;
+class IntToString;
+class IntToStringDefaultTypeInternal;
+extern IntToStringDefaultTypeInternal _IntToString_default_instance_;
+class IntToString_MapEntry_DoNotUse;
+class IntToString_MapEntry_DoNotUseDefaultTypeInternal;
+extern IntToString_MapEntry_DoNotUseDefaultTypeInternal _IntToString_MapEntry_DoNotUse_default_instance_;
+class MapIn;
+class MapInDefaultTypeInternal;
+extern MapInDefaultTypeInternal _MapIn_default_instance_;
+class MapIn_MapAnyEntry_DoNotUse;
+class MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal;
+extern MapIn_MapAnyEntry_DoNotUseDefaultTypeInternal _MapIn_MapAnyEntry_DoNotUse_default_instance_;
+class MapIn_MapInputEntry_DoNotUse;
+class MapIn_MapInputEntry_DoNotUseDefaultTypeInternal;
+extern MapIn_MapInputEntry_DoNotUseDefaultTypeInternal _MapIn_MapInputEntry_DoNotUse_default_instance_;
+class MapM;
+class MapMDefaultTypeInternal;
+extern MapMDefaultTypeInternal _MapM_default_instance_;
+class MapOfObjects;
+class MapOfObjectsDefaultTypeInternal;
+extern MapOfObjectsDefaultTypeInternal _MapOfObjects_default_instance_;
+class MapOfObjects_M;
+class MapOfObjects_MDefaultTypeInternal;
+extern MapOfObjects_MDefaultTypeInternal _MapOfObjects_M_default_instance_;
+class MapOfObjects_MapEntry_DoNotUse;
+class MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal;
+extern MapOfObjects_MapEntry_DoNotUseDefaultTypeInternal _MapOfObjects_MapEntry_DoNotUse_default_instance_;
+class MapOut;
+class MapOutDefaultTypeInternal;
+extern MapOutDefaultTypeInternal _MapOut_default_instance_;
+class MapOutWireFormat;
+class MapOutWireFormatDefaultTypeInternal;
+extern MapOutWireFormatDefaultTypeInternal _MapOutWireFormat_default_instance_;
+class MapOutWireFormat_Map1Entry;
+class MapOutWireFormat_Map1EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map1EntryDefaultTypeInternal _MapOutWireFormat_Map1Entry_default_instance_;
+class MapOutWireFormat_Map2Entry;
+class MapOutWireFormat_Map2EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map2EntryDefaultTypeInternal _MapOutWireFormat_Map2Entry_default_instance_;
+class MapOutWireFormat_Map3Entry;
+class MapOutWireFormat_Map3EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map3EntryDefaultTypeInternal _MapOutWireFormat_Map3Entry_default_instance_;
+class MapOutWireFormat_Map4Entry;
+class MapOutWireFormat_Map4EntryDefaultTypeInternal;
+extern MapOutWireFormat_Map4EntryDefaultTypeInternal _MapOutWireFormat_Map4Entry_default_instance_;
+class MapOut_Map1Entry_DoNotUse;
+class MapOut_Map1Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map1Entry_DoNotUseDefaultTypeInternal _MapOut_Map1Entry_DoNotUse_default_instance_;
+class MapOut_Map2Entry_DoNotUse;
+class MapOut_Map2Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map2Entry_DoNotUseDefaultTypeInternal _MapOut_Map2Entry_DoNotUse_default_instance_;
+class MapOut_Map3Entry_DoNotUse;
+class MapOut_Map3Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map3Entry_DoNotUseDefaultTypeInternal _MapOut_Map3Entry_DoNotUse_default_instance_;
+class MapOut_Map4Entry_DoNotUse;
+class MapOut_Map4Entry_DoNotUseDefaultTypeInternal;
+extern MapOut_Map4Entry_DoNotUseDefaultTypeInternal _MapOut_Map4Entry_DoNotUse_default_instance_;
+class MapsTestCases;
+class MapsTestCasesDefaultTypeInternal;
+extern MapsTestCasesDefaultTypeInternal _MapsTestCases_default_instance_;
+class Mixed1;
+class Mixed1DefaultTypeInternal;
+extern Mixed1DefaultTypeInternal _Mixed1_default_instance_;
+class Mixed1_MapEntry_DoNotUse;
+class Mixed1_MapEntry_DoNotUseDefaultTypeInternal;
+extern Mixed1_MapEntry_DoNotUseDefaultTypeInternal _Mixed1_MapEntry_DoNotUse_default_instance_;
+class Mixed2;
+class Mixed2DefaultTypeInternal;
+extern Mixed2DefaultTypeInternal _Mixed2_default_instance_;
+class Mixed2_MapEntry_DoNotUse;
+class Mixed2_MapEntry_DoNotUseDefaultTypeInternal;
+extern Mixed2_MapEntry_DoNotUseDefaultTypeInternal _Mixed2_MapEntry_DoNotUse_default_instance_;
+class StringtoInt;
+class StringtoIntDefaultTypeInternal;
+extern StringtoIntDefaultTypeInternal _StringtoInt_default_instance_;
+class StringtoInt_MapEntry_DoNotUse;
+class StringtoInt_MapEntry_DoNotUseDefaultTypeInternal;
+extern StringtoInt_MapEntry_DoNotUseDefaultTypeInternal _StringtoInt_MapEntry_DoNotUse_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::BoolToString* Arena::CreateMaybeMessage<::proto_util_converter::testing::BoolToString>(Arena*);
+template<> ::proto_util_converter::testing::BoolToString_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::BoolToString_MapEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::DummyRequest* Arena::CreateMaybeMessage<::proto_util_converter::testing::DummyRequest>(Arena*);
+template<> ::proto_util_converter::testing::EmptyMap* Arena::CreateMaybeMessage<::proto_util_converter::testing::EmptyMap>(Arena*);
+template<> ::proto_util_converter::testing::EmptyMap_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::EmptyMap_MapEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::IntToString* Arena::CreateMaybeMessage<::proto_util_converter::testing::IntToString>(Arena*);
+template<> ::proto_util_converter::testing::IntToString_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::IntToString_MapEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapIn* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapIn>(Arena*);
+template<> ::proto_util_converter::testing::MapIn_MapAnyEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapIn_MapAnyEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapIn_MapInputEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapIn_MapInputEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapM* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapM>(Arena*);
+template<> ::proto_util_converter::testing::MapOfObjects* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOfObjects>(Arena*);
+template<> ::proto_util_converter::testing::MapOfObjects_M* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOfObjects_M>(Arena*);
+template<> ::proto_util_converter::testing::MapOfObjects_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOfObjects_MapEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapOut* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOut>(Arena*);
+template<> ::proto_util_converter::testing::MapOutWireFormat* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOutWireFormat>(Arena*);
+template<> ::proto_util_converter::testing::MapOutWireFormat_Map1Entry* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOutWireFormat_Map1Entry>(Arena*);
+template<> ::proto_util_converter::testing::MapOutWireFormat_Map2Entry* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOutWireFormat_Map2Entry>(Arena*);
+template<> ::proto_util_converter::testing::MapOutWireFormat_Map3Entry* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOutWireFormat_Map3Entry>(Arena*);
+template<> ::proto_util_converter::testing::MapOutWireFormat_Map4Entry* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOutWireFormat_Map4Entry>(Arena*);
+template<> ::proto_util_converter::testing::MapOut_Map1Entry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOut_Map1Entry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapOut_Map2Entry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOut_Map2Entry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapOut_Map3Entry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOut_Map3Entry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapOut_Map4Entry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapOut_Map4Entry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::MapsTestCases* Arena::CreateMaybeMessage<::proto_util_converter::testing::MapsTestCases>(Arena*);
+template<> ::proto_util_converter::testing::Mixed1* Arena::CreateMaybeMessage<::proto_util_converter::testing::Mixed1>(Arena*);
+template<> ::proto_util_converter::testing::Mixed1_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::Mixed1_MapEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::Mixed2* Arena::CreateMaybeMessage<::proto_util_converter::testing::Mixed2>(Arena*);
+template<> ::proto_util_converter::testing::Mixed2_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::Mixed2_MapEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::StringtoInt* Arena::CreateMaybeMessage<::proto_util_converter::testing::StringtoInt>(Arena*);
+template<> ::proto_util_converter::testing::StringtoInt_MapEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::StringtoInt_MapEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+enum Mixed2_E {
+  Mixed2_E_E0 = 0,
+  Mixed2_E_E1 = 1,
+  Mixed2_E_E2 = 2,
+  Mixed2_E_E3 = 3,
+  Mixed2_E_Mixed2_E_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  Mixed2_E_Mixed2_E_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool Mixed2_E_IsValid(int value);
+constexpr Mixed2_E Mixed2_E_E_MIN = Mixed2_E_E0;
+constexpr Mixed2_E Mixed2_E_E_MAX = Mixed2_E_E3;
+constexpr int Mixed2_E_E_ARRAYSIZE = Mixed2_E_E_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Mixed2_E_descriptor();
+inline const std::string& Mixed2_E_Name(Mixed2_E value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Mixed2_E_descriptor(), value);
+}
+inline bool Mixed2_E_Parse(
+    const std::string& name, Mixed2_E* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Mixed2_E>(
+    Mixed2_E_descriptor(), name, value);
+}
+// ===================================================================
+
+class MapsTestCases final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapsTestCases) */ {
+ public:
+  MapsTestCases();
+  virtual ~MapsTestCases();
+
+  MapsTestCases(const MapsTestCases& from);
+  MapsTestCases(MapsTestCases&& from) noexcept
+    : MapsTestCases() {
+    *this = ::std::move(from);
+  }
+
+  inline MapsTestCases& operator=(const MapsTestCases& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapsTestCases& operator=(MapsTestCases&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapsTestCases& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapsTestCases* internal_default_instance() {
+    return reinterpret_cast<const MapsTestCases*>(
+               &_MapsTestCases_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void Swap(MapsTestCases* other);
+  friend void swap(MapsTestCases& a, MapsTestCases& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapsTestCases* New() const final {
+    return CreateMaybeMessage<MapsTestCases>(nullptr);
+  }
+
+  MapsTestCases* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapsTestCases>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapsTestCases& from);
+  void MergeFrom(const MapsTestCases& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapsTestCases* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapsTestCases";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .proto_util_converter.testing.EmptyMap empty_map = 1;
+  bool has_empty_map() const;
+  void clear_empty_map();
+  static const int kEmptyMapFieldNumber = 1;
+  const ::proto_util_converter::testing::EmptyMap& empty_map() const;
+  ::proto_util_converter::testing::EmptyMap* release_empty_map();
+  ::proto_util_converter::testing::EmptyMap* mutable_empty_map();
+  void set_allocated_empty_map(::proto_util_converter::testing::EmptyMap* empty_map);
+
+  // .proto_util_converter.testing.StringtoInt string_to_int = 2;
+  bool has_string_to_int() const;
+  void clear_string_to_int();
+  static const int kStringToIntFieldNumber = 2;
+  const ::proto_util_converter::testing::StringtoInt& string_to_int() const;
+  ::proto_util_converter::testing::StringtoInt* release_string_to_int();
+  ::proto_util_converter::testing::StringtoInt* mutable_string_to_int();
+  void set_allocated_string_to_int(::proto_util_converter::testing::StringtoInt* string_to_int);
+
+  // .proto_util_converter.testing.IntToString int_to_string = 3;
+  bool has_int_to_string() const;
+  void clear_int_to_string();
+  static const int kIntToStringFieldNumber = 3;
+  const ::proto_util_converter::testing::IntToString& int_to_string() const;
+  ::proto_util_converter::testing::IntToString* release_int_to_string();
+  ::proto_util_converter::testing::IntToString* mutable_int_to_string();
+  void set_allocated_int_to_string(::proto_util_converter::testing::IntToString* int_to_string);
+
+  // .proto_util_converter.testing.Mixed1 mixed1 = 4;
+  bool has_mixed1() const;
+  void clear_mixed1();
+  static const int kMixed1FieldNumber = 4;
+  const ::proto_util_converter::testing::Mixed1& mixed1() const;
+  ::proto_util_converter::testing::Mixed1* release_mixed1();
+  ::proto_util_converter::testing::Mixed1* mutable_mixed1();
+  void set_allocated_mixed1(::proto_util_converter::testing::Mixed1* mixed1);
+
+  // .proto_util_converter.testing.Mixed2 mixed2 = 5;
+  bool has_mixed2() const;
+  void clear_mixed2();
+  static const int kMixed2FieldNumber = 5;
+  const ::proto_util_converter::testing::Mixed2& mixed2() const;
+  ::proto_util_converter::testing::Mixed2* release_mixed2();
+  ::proto_util_converter::testing::Mixed2* mutable_mixed2();
+  void set_allocated_mixed2(::proto_util_converter::testing::Mixed2* mixed2);
+
+  // .proto_util_converter.testing.MapOfObjects map_of_objects = 6;
+  bool has_map_of_objects() const;
+  void clear_map_of_objects();
+  static const int kMapOfObjectsFieldNumber = 6;
+  const ::proto_util_converter::testing::MapOfObjects& map_of_objects() const;
+  ::proto_util_converter::testing::MapOfObjects* release_map_of_objects();
+  ::proto_util_converter::testing::MapOfObjects* mutable_map_of_objects();
+  void set_allocated_map_of_objects(::proto_util_converter::testing::MapOfObjects* map_of_objects);
+
+  // .proto_util_converter.testing.StringtoInt empty_key_string_to_int1 = 7;
+  bool has_empty_key_string_to_int1() const;
+  void clear_empty_key_string_to_int1();
+  static const int kEmptyKeyStringToInt1FieldNumber = 7;
+  const ::proto_util_converter::testing::StringtoInt& empty_key_string_to_int1() const;
+  ::proto_util_converter::testing::StringtoInt* release_empty_key_string_to_int1();
+  ::proto_util_converter::testing::StringtoInt* mutable_empty_key_string_to_int1();
+  void set_allocated_empty_key_string_to_int1(::proto_util_converter::testing::StringtoInt* empty_key_string_to_int1);
+
+  // .proto_util_converter.testing.StringtoInt empty_key_string_to_int2 = 8;
+  bool has_empty_key_string_to_int2() const;
+  void clear_empty_key_string_to_int2();
+  static const int kEmptyKeyStringToInt2FieldNumber = 8;
+  const ::proto_util_converter::testing::StringtoInt& empty_key_string_to_int2() const;
+  ::proto_util_converter::testing::StringtoInt* release_empty_key_string_to_int2();
+  ::proto_util_converter::testing::StringtoInt* mutable_empty_key_string_to_int2();
+  void set_allocated_empty_key_string_to_int2(::proto_util_converter::testing::StringtoInt* empty_key_string_to_int2);
+
+  // .proto_util_converter.testing.StringtoInt empty_key_string_to_int3 = 9;
+  bool has_empty_key_string_to_int3() const;
+  void clear_empty_key_string_to_int3();
+  static const int kEmptyKeyStringToInt3FieldNumber = 9;
+  const ::proto_util_converter::testing::StringtoInt& empty_key_string_to_int3() const;
+  ::proto_util_converter::testing::StringtoInt* release_empty_key_string_to_int3();
+  ::proto_util_converter::testing::StringtoInt* mutable_empty_key_string_to_int3();
+  void set_allocated_empty_key_string_to_int3(::proto_util_converter::testing::StringtoInt* empty_key_string_to_int3);
+
+  // .proto_util_converter.testing.BoolToString empty_key_bool_to_string = 10;
+  bool has_empty_key_bool_to_string() const;
+  void clear_empty_key_bool_to_string();
+  static const int kEmptyKeyBoolToStringFieldNumber = 10;
+  const ::proto_util_converter::testing::BoolToString& empty_key_bool_to_string() const;
+  ::proto_util_converter::testing::BoolToString* release_empty_key_bool_to_string();
+  ::proto_util_converter::testing::BoolToString* mutable_empty_key_bool_to_string();
+  void set_allocated_empty_key_bool_to_string(::proto_util_converter::testing::BoolToString* empty_key_bool_to_string);
+
+  // .proto_util_converter.testing.IntToString empty_key_int_to_string = 11;
+  bool has_empty_key_int_to_string() const;
+  void clear_empty_key_int_to_string();
+  static const int kEmptyKeyIntToStringFieldNumber = 11;
+  const ::proto_util_converter::testing::IntToString& empty_key_int_to_string() const;
+  ::proto_util_converter::testing::IntToString* release_empty_key_int_to_string();
+  ::proto_util_converter::testing::IntToString* mutable_empty_key_int_to_string();
+  void set_allocated_empty_key_int_to_string(::proto_util_converter::testing::IntToString* empty_key_int_to_string);
+
+  // .proto_util_converter.testing.Mixed1 empty_key_mixed = 12;
+  bool has_empty_key_mixed() const;
+  void clear_empty_key_mixed();
+  static const int kEmptyKeyMixedFieldNumber = 12;
+  const ::proto_util_converter::testing::Mixed1& empty_key_mixed() const;
+  ::proto_util_converter::testing::Mixed1* release_empty_key_mixed();
+  ::proto_util_converter::testing::Mixed1* mutable_empty_key_mixed();
+  void set_allocated_empty_key_mixed(::proto_util_converter::testing::Mixed1* empty_key_mixed);
+
+  // .proto_util_converter.testing.MapOfObjects empty_key_map_objects = 13;
+  bool has_empty_key_map_objects() const;
+  void clear_empty_key_map_objects();
+  static const int kEmptyKeyMapObjectsFieldNumber = 13;
+  const ::proto_util_converter::testing::MapOfObjects& empty_key_map_objects() const;
+  ::proto_util_converter::testing::MapOfObjects* release_empty_key_map_objects();
+  ::proto_util_converter::testing::MapOfObjects* mutable_empty_key_map_objects();
+  void set_allocated_empty_key_map_objects(::proto_util_converter::testing::MapOfObjects* empty_key_map_objects);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapsTestCases)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::proto_util_converter::testing::EmptyMap* empty_map_;
+  ::proto_util_converter::testing::StringtoInt* string_to_int_;
+  ::proto_util_converter::testing::IntToString* int_to_string_;
+  ::proto_util_converter::testing::Mixed1* mixed1_;
+  ::proto_util_converter::testing::Mixed2* mixed2_;
+  ::proto_util_converter::testing::MapOfObjects* map_of_objects_;
+  ::proto_util_converter::testing::StringtoInt* empty_key_string_to_int1_;
+  ::proto_util_converter::testing::StringtoInt* empty_key_string_to_int2_;
+  ::proto_util_converter::testing::StringtoInt* empty_key_string_to_int3_;
+  ::proto_util_converter::testing::BoolToString* empty_key_bool_to_string_;
+  ::proto_util_converter::testing::IntToString* empty_key_int_to_string_;
+  ::proto_util_converter::testing::Mixed1* empty_key_mixed_;
+  ::proto_util_converter::testing::MapOfObjects* empty_key_map_objects_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EmptyMap_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<EmptyMap_MapEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<EmptyMap_MapEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  EmptyMap_MapEntry_DoNotUse();
+  EmptyMap_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const EmptyMap_MapEntry_DoNotUse& other);
+  static const EmptyMap_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const EmptyMap_MapEntry_DoNotUse*>(&_EmptyMap_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class EmptyMap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.EmptyMap) */ {
+ public:
+  EmptyMap();
+  virtual ~EmptyMap();
+
+  EmptyMap(const EmptyMap& from);
+  EmptyMap(EmptyMap&& from) noexcept
+    : EmptyMap() {
+    *this = ::std::move(from);
+  }
+
+  inline EmptyMap& operator=(const EmptyMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EmptyMap& operator=(EmptyMap&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const EmptyMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const EmptyMap* internal_default_instance() {
+    return reinterpret_cast<const EmptyMap*>(
+               &_EmptyMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(EmptyMap* other);
+  friend void swap(EmptyMap& a, EmptyMap& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline EmptyMap* New() const final {
+    return CreateMaybeMessage<EmptyMap>(nullptr);
+  }
+
+  EmptyMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<EmptyMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const EmptyMap& from);
+  void MergeFrom(const EmptyMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EmptyMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.EmptyMap";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<int32, int32> map = 1;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.EmptyMap)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      EmptyMap_MapEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StringtoInt_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StringtoInt_MapEntry_DoNotUse, 
+    std::string, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StringtoInt_MapEntry_DoNotUse, 
+    std::string, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  StringtoInt_MapEntry_DoNotUse();
+  StringtoInt_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const StringtoInt_MapEntry_DoNotUse& other);
+  static const StringtoInt_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const StringtoInt_MapEntry_DoNotUse*>(&_StringtoInt_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.StringtoInt.MapEntry.key");
+ }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class StringtoInt final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.StringtoInt) */ {
+ public:
+  StringtoInt();
+  virtual ~StringtoInt();
+
+  StringtoInt(const StringtoInt& from);
+  StringtoInt(StringtoInt&& from) noexcept
+    : StringtoInt() {
+    *this = ::std::move(from);
+  }
+
+  inline StringtoInt& operator=(const StringtoInt& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StringtoInt& operator=(StringtoInt&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const StringtoInt& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const StringtoInt* internal_default_instance() {
+    return reinterpret_cast<const StringtoInt*>(
+               &_StringtoInt_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  void Swap(StringtoInt* other);
+  friend void swap(StringtoInt& a, StringtoInt& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline StringtoInt* New() const final {
+    return CreateMaybeMessage<StringtoInt>(nullptr);
+  }
+
+  StringtoInt* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<StringtoInt>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const StringtoInt& from);
+  void MergeFrom(const StringtoInt& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StringtoInt* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.StringtoInt";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<string, int32> map = 1;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.StringtoInt)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      StringtoInt_MapEntry_DoNotUse,
+      std::string, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IntToString_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<IntToString_MapEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<IntToString_MapEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  IntToString_MapEntry_DoNotUse();
+  IntToString_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const IntToString_MapEntry_DoNotUse& other);
+  static const IntToString_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const IntToString_MapEntry_DoNotUse*>(&_IntToString_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.IntToString.MapEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class IntToString final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.IntToString) */ {
+ public:
+  IntToString();
+  virtual ~IntToString();
+
+  IntToString(const IntToString& from);
+  IntToString(IntToString&& from) noexcept
+    : IntToString() {
+    *this = ::std::move(from);
+  }
+
+  inline IntToString& operator=(const IntToString& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IntToString& operator=(IntToString&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const IntToString& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const IntToString* internal_default_instance() {
+    return reinterpret_cast<const IntToString*>(
+               &_IntToString_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  void Swap(IntToString* other);
+  friend void swap(IntToString& a, IntToString& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline IntToString* New() const final {
+    return CreateMaybeMessage<IntToString>(nullptr);
+  }
+
+  IntToString* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<IntToString>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const IntToString& from);
+  void MergeFrom(const IntToString& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IntToString* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.IntToString";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<int32, string> map = 1;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      mutable_map();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.IntToString)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      IntToString_MapEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BoolToString_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BoolToString_MapEntry_DoNotUse, 
+    bool, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BoolToString_MapEntry_DoNotUse, 
+    bool, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  BoolToString_MapEntry_DoNotUse();
+  BoolToString_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const BoolToString_MapEntry_DoNotUse& other);
+  static const BoolToString_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BoolToString_MapEntry_DoNotUse*>(&_BoolToString_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.BoolToString.MapEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class BoolToString final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BoolToString) */ {
+ public:
+  BoolToString();
+  virtual ~BoolToString();
+
+  BoolToString(const BoolToString& from);
+  BoolToString(BoolToString&& from) noexcept
+    : BoolToString() {
+    *this = ::std::move(from);
+  }
+
+  inline BoolToString& operator=(const BoolToString& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoolToString& operator=(BoolToString&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const BoolToString& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BoolToString* internal_default_instance() {
+    return reinterpret_cast<const BoolToString*>(
+               &_BoolToString_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  void Swap(BoolToString* other);
+  friend void swap(BoolToString& a, BoolToString& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BoolToString* New() const final {
+    return CreateMaybeMessage<BoolToString>(nullptr);
+  }
+
+  BoolToString* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BoolToString>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BoolToString& from);
+  void MergeFrom(const BoolToString& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BoolToString* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BoolToString";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<bool, string> map = 1;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >*
+      mutable_map();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BoolToString)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      BoolToString_MapEntry_DoNotUse,
+      bool, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Mixed1_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Mixed1_MapEntry_DoNotUse, 
+    std::string, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Mixed1_MapEntry_DoNotUse, 
+    std::string, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > SuperType;
+  Mixed1_MapEntry_DoNotUse();
+  Mixed1_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Mixed1_MapEntry_DoNotUse& other);
+  static const Mixed1_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Mixed1_MapEntry_DoNotUse*>(&_Mixed1_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.Mixed1.MapEntry.key");
+ }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class Mixed1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Mixed1) */ {
+ public:
+  Mixed1();
+  virtual ~Mixed1();
+
+  Mixed1(const Mixed1& from);
+  Mixed1(Mixed1&& from) noexcept
+    : Mixed1() {
+    *this = ::std::move(from);
+  }
+
+  inline Mixed1& operator=(const Mixed1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Mixed1& operator=(Mixed1&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Mixed1& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Mixed1* internal_default_instance() {
+    return reinterpret_cast<const Mixed1*>(
+               &_Mixed1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  void Swap(Mixed1* other);
+  friend void swap(Mixed1& a, Mixed1& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Mixed1* New() const final {
+    return CreateMaybeMessage<Mixed1>(nullptr);
+  }
+
+  Mixed1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Mixed1>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Mixed1& from);
+  void MergeFrom(const Mixed1& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Mixed1* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Mixed1";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<string, float> map = 2;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 2;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, float >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, float >*
+      mutable_map();
+
+  // string msg = 1;
+  void clear_msg();
+  static const int kMsgFieldNumber = 1;
+  const std::string& msg() const;
+  void set_msg(const std::string& value);
+  void set_msg(std::string&& value);
+  void set_msg(const char* value);
+  void set_msg(const char* value, size_t size);
+  std::string* mutable_msg();
+  std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Mixed1)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      Mixed1_MapEntry_DoNotUse,
+      std::string, float,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+      0 > map_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Mixed2_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Mixed2_MapEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Mixed2_MapEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > SuperType;
+  Mixed2_MapEntry_DoNotUse();
+  Mixed2_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Mixed2_MapEntry_DoNotUse& other);
+  static const Mixed2_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Mixed2_MapEntry_DoNotUse*>(&_Mixed2_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class Mixed2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Mixed2) */ {
+ public:
+  Mixed2();
+  virtual ~Mixed2();
+
+  Mixed2(const Mixed2& from);
+  Mixed2(Mixed2&& from) noexcept
+    : Mixed2() {
+    *this = ::std::move(from);
+  }
+
+  inline Mixed2& operator=(const Mixed2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Mixed2& operator=(Mixed2&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Mixed2& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Mixed2* internal_default_instance() {
+    return reinterpret_cast<const Mixed2*>(
+               &_Mixed2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  void Swap(Mixed2* other);
+  friend void swap(Mixed2& a, Mixed2& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Mixed2* New() const final {
+    return CreateMaybeMessage<Mixed2>(nullptr);
+  }
+
+  Mixed2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Mixed2>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Mixed2& from);
+  void MergeFrom(const Mixed2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Mixed2* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Mixed2";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  typedef Mixed2_E E;
+  static constexpr E E0 =
+    Mixed2_E_E0;
+  static constexpr E E1 =
+    Mixed2_E_E1;
+  static constexpr E E2 =
+    Mixed2_E_E2;
+  static constexpr E E3 =
+    Mixed2_E_E3;
+  static inline bool E_IsValid(int value) {
+    return Mixed2_E_IsValid(value);
+  }
+  static constexpr E E_MIN =
+    Mixed2_E_E_MIN;
+  static constexpr E E_MAX =
+    Mixed2_E_E_MAX;
+  static constexpr int E_ARRAYSIZE =
+    Mixed2_E_E_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  E_descriptor() {
+    return Mixed2_E_descriptor();
+  }
+  static inline const std::string& E_Name(E value) {
+    return Mixed2_E_Name(value);
+  }
+  static inline bool E_Parse(const std::string& name,
+      E* value) {
+    return Mixed2_E_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // map<int32, bool> map = 1;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, bool >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, bool >*
+      mutable_map();
+
+  // .proto_util_converter.testing.Mixed2.E ee = 2;
+  void clear_ee();
+  static const int kEeFieldNumber = 2;
+  ::proto_util_converter::testing::Mixed2_E ee() const;
+  void set_ee(::proto_util_converter::testing::Mixed2_E value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Mixed2)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      Mixed2_MapEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, bool,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      0 > map_;
+  int ee_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOfObjects_M final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOfObjects.M) */ {
+ public:
+  MapOfObjects_M();
+  virtual ~MapOfObjects_M();
+
+  MapOfObjects_M(const MapOfObjects_M& from);
+  MapOfObjects_M(MapOfObjects_M&& from) noexcept
+    : MapOfObjects_M() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOfObjects_M& operator=(const MapOfObjects_M& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOfObjects_M& operator=(MapOfObjects_M&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOfObjects_M& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOfObjects_M* internal_default_instance() {
+    return reinterpret_cast<const MapOfObjects_M*>(
+               &_MapOfObjects_M_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  void Swap(MapOfObjects_M* other);
+  friend void swap(MapOfObjects_M& a, MapOfObjects_M& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOfObjects_M* New() const final {
+    return CreateMaybeMessage<MapOfObjects_M>(nullptr);
+  }
+
+  MapOfObjects_M* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOfObjects_M>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOfObjects_M& from);
+  void MergeFrom(const MapOfObjects_M& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOfObjects_M* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOfObjects.M";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string inner_text = 1;
+  void clear_inner_text();
+  static const int kInnerTextFieldNumber = 1;
+  const std::string& inner_text() const;
+  void set_inner_text(const std::string& value);
+  void set_inner_text(std::string&& value);
+  void set_inner_text(const char* value);
+  void set_inner_text(const char* value, size_t size);
+  std::string* mutable_inner_text();
+  std::string* release_inner_text();
+  void set_allocated_inner_text(std::string* inner_text);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOfObjects.M)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr inner_text_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOfObjects_MapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOfObjects_MapEntry_DoNotUse, 
+    std::string, ::proto_util_converter::testing::MapOfObjects_M,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOfObjects_MapEntry_DoNotUse, 
+    std::string, ::proto_util_converter::testing::MapOfObjects_M,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapOfObjects_MapEntry_DoNotUse();
+  MapOfObjects_MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapOfObjects_MapEntry_DoNotUse& other);
+  static const MapOfObjects_MapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapOfObjects_MapEntry_DoNotUse*>(&_MapOfObjects_MapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapOfObjects.MapEntry.key");
+ }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapOfObjects final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOfObjects) */ {
+ public:
+  MapOfObjects();
+  virtual ~MapOfObjects();
+
+  MapOfObjects(const MapOfObjects& from);
+  MapOfObjects(MapOfObjects&& from) noexcept
+    : MapOfObjects() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOfObjects& operator=(const MapOfObjects& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOfObjects& operator=(MapOfObjects&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOfObjects& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOfObjects* internal_default_instance() {
+    return reinterpret_cast<const MapOfObjects*>(
+               &_MapOfObjects_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  void Swap(MapOfObjects* other);
+  friend void swap(MapOfObjects& a, MapOfObjects& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOfObjects* New() const final {
+    return CreateMaybeMessage<MapOfObjects>(nullptr);
+  }
+
+  MapOfObjects* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOfObjects>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOfObjects& from);
+  void MergeFrom(const MapOfObjects& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOfObjects* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOfObjects";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MapOfObjects_M M;
+
+  // accessors -------------------------------------------------------
+
+  // map<string, .proto_util_converter.testing.MapOfObjects.M> map = 1;
+  int map_size() const;
+  void clear_map();
+  static const int kMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOfObjects_M >&
+      map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOfObjects_M >*
+      mutable_map();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOfObjects)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapOfObjects_MapEntry_DoNotUse,
+      std::string, ::proto_util_converter::testing::MapOfObjects_M,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DummyRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.DummyRequest) */ {
+ public:
+  DummyRequest();
+  virtual ~DummyRequest();
+
+  DummyRequest(const DummyRequest& from);
+  DummyRequest(DummyRequest&& from) noexcept
+    : DummyRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DummyRequest& operator=(const DummyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DummyRequest& operator=(DummyRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const DummyRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DummyRequest* internal_default_instance() {
+    return reinterpret_cast<const DummyRequest*>(
+               &_DummyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  void Swap(DummyRequest* other);
+  friend void swap(DummyRequest& a, DummyRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DummyRequest* New() const final {
+    return CreateMaybeMessage<DummyRequest>(nullptr);
+  }
+
+  DummyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<DummyRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const DummyRequest& from);
+  void MergeFrom(const DummyRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DummyRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.DummyRequest";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.DummyRequest)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapIn_MapInputEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapIn_MapInputEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapIn_MapInputEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  MapIn_MapInputEntry_DoNotUse();
+  MapIn_MapInputEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapIn_MapInputEntry_DoNotUse& other);
+  static const MapIn_MapInputEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapIn_MapInputEntry_DoNotUse*>(&_MapIn_MapInputEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapIn.MapInputEntry.key");
+ }
+  bool ValidateValue() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapIn.MapInputEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapIn_MapAnyEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapIn_MapAnyEntry_DoNotUse, 
+    std::string, PROTOBUF_NAMESPACE_ID::Any,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapIn_MapAnyEntry_DoNotUse, 
+    std::string, PROTOBUF_NAMESPACE_ID::Any,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapIn_MapAnyEntry_DoNotUse();
+  MapIn_MapAnyEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapIn_MapAnyEntry_DoNotUse& other);
+  static const MapIn_MapAnyEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapIn_MapAnyEntry_DoNotUse*>(&_MapIn_MapAnyEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapIn.MapAnyEntry.key");
+ }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapIn final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapIn) */ {
+ public:
+  MapIn();
+  virtual ~MapIn();
+
+  MapIn(const MapIn& from);
+  MapIn(MapIn&& from) noexcept
+    : MapIn() {
+    *this = ::std::move(from);
+  }
+
+  inline MapIn& operator=(const MapIn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapIn& operator=(MapIn&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapIn& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapIn* internal_default_instance() {
+    return reinterpret_cast<const MapIn*>(
+               &_MapIn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  void Swap(MapIn* other);
+  friend void swap(MapIn& a, MapIn& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapIn* New() const final {
+    return CreateMaybeMessage<MapIn>(nullptr);
+  }
+
+  MapIn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapIn>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapIn& from);
+  void MergeFrom(const MapIn& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapIn* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapIn";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // repeated string things = 2;
+  int things_size() const;
+  void clear_things();
+  static const int kThingsFieldNumber = 2;
+  const std::string& things(int index) const;
+  std::string* mutable_things(int index);
+  void set_things(int index, const std::string& value);
+  void set_things(int index, std::string&& value);
+  void set_things(int index, const char* value);
+  void set_things(int index, const char* value, size_t size);
+  std::string* add_things();
+  void add_things(const std::string& value);
+  void add_things(std::string&& value);
+  void add_things(const char* value);
+  void add_things(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& things() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_things();
+
+  // map<string, string> map_input = 3;
+  int map_input_size() const;
+  void clear_map_input();
+  static const int kMapInputFieldNumber = 3;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_input() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_input();
+
+  // map<string, .google.protobuf.Any> map_any = 4;
+  int map_any_size() const;
+  void clear_map_any();
+  static const int kMapAnyFieldNumber = 4;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Any >&
+      map_any() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Any >*
+      mutable_map_any();
+
+  // string other = 1;
+  void clear_other();
+  static const int kOtherFieldNumber = 1;
+  const std::string& other() const;
+  void set_other(const std::string& value);
+  void set_other(std::string&& value);
+  void set_other(const char* value);
+  void set_other(const char* value, size_t size);
+  std::string* mutable_other();
+  std::string* release_other();
+  void set_allocated_other(std::string* other);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapIn)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> things_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapIn_MapInputEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_input_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapIn_MapAnyEntry_DoNotUse,
+      std::string, PROTOBUF_NAMESPACE_ID::Any,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_any_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr other_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOut_Map1Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map1Entry_DoNotUse, 
+    std::string, ::proto_util_converter::testing::MapM,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map1Entry_DoNotUse, 
+    std::string, ::proto_util_converter::testing::MapM,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapOut_Map1Entry_DoNotUse();
+  MapOut_Map1Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapOut_Map1Entry_DoNotUse& other);
+  static const MapOut_Map1Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapOut_Map1Entry_DoNotUse*>(&_MapOut_Map1Entry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapOut.Map1Entry.key");
+ }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapOut_Map2Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map2Entry_DoNotUse, 
+    std::string, ::proto_util_converter::testing::MapOut,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map2Entry_DoNotUse, 
+    std::string, ::proto_util_converter::testing::MapOut,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MapOut_Map2Entry_DoNotUse();
+  MapOut_Map2Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapOut_Map2Entry_DoNotUse& other);
+  static const MapOut_Map2Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapOut_Map2Entry_DoNotUse*>(&_MapOut_Map2Entry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapOut.Map2Entry.key");
+ }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapOut_Map3Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map3Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map3Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  MapOut_Map3Entry_DoNotUse();
+  MapOut_Map3Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapOut_Map3Entry_DoNotUse& other);
+  static const MapOut_Map3Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapOut_Map3Entry_DoNotUse*>(&_MapOut_Map3Entry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapOut.Map3Entry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapOut_Map4Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map4Entry_DoNotUse, 
+    bool, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MapOut_Map4Entry_DoNotUse, 
+    bool, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  MapOut_Map4Entry_DoNotUse();
+  MapOut_Map4Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MapOut_Map4Entry_DoNotUse& other);
+  static const MapOut_Map4Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MapOut_Map4Entry_DoNotUse*>(&_MapOut_Map4Entry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.MapOut.Map4Entry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class MapOut final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOut) */ {
+ public:
+  MapOut();
+  virtual ~MapOut();
+
+  MapOut(const MapOut& from);
+  MapOut(MapOut&& from) noexcept
+    : MapOut() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOut& operator=(const MapOut& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOut& operator=(MapOut&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOut& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOut* internal_default_instance() {
+    return reinterpret_cast<const MapOut*>(
+               &_MapOut_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  void Swap(MapOut* other);
+  friend void swap(MapOut& a, MapOut& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOut* New() const final {
+    return CreateMaybeMessage<MapOut>(nullptr);
+  }
+
+  MapOut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOut>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOut& from);
+  void MergeFrom(const MapOut& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOut* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOut";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<string, .proto_util_converter.testing.MapM> map1 = 1;
+  int map1_size() const;
+  void clear_map1();
+  static const int kMap1FieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapM >&
+      map1() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapM >*
+      mutable_map1();
+
+  // map<string, .proto_util_converter.testing.MapOut> map2 = 2;
+  int map2_size() const;
+  void clear_map2();
+  static const int kMap2FieldNumber = 2;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOut >&
+      map2() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOut >*
+      mutable_map2();
+
+  // map<int32, string> map3 = 3;
+  int map3_size() const;
+  void clear_map3();
+  static const int kMap3FieldNumber = 3;
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      map3() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      mutable_map3();
+
+  // map<bool, string> map4 = 5;
+  int map4_size() const;
+  void clear_map4();
+  static const int kMap4FieldNumber = 5;
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >&
+      map4() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >*
+      mutable_map4();
+
+  // string bar = 4;
+  void clear_bar();
+  static const int kBarFieldNumber = 4;
+  const std::string& bar() const;
+  void set_bar(const std::string& value);
+  void set_bar(std::string&& value);
+  void set_bar(const char* value);
+  void set_bar(const char* value, size_t size);
+  std::string* mutable_bar();
+  std::string* release_bar();
+  void set_allocated_bar(std::string* bar);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOut)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapOut_Map1Entry_DoNotUse,
+      std::string, ::proto_util_converter::testing::MapM,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map1_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapOut_Map2Entry_DoNotUse,
+      std::string, ::proto_util_converter::testing::MapOut,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map2_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapOut_Map3Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map3_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MapOut_Map4Entry_DoNotUse,
+      bool, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map4_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bar_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map1Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOutWireFormat.Map1Entry) */ {
+ public:
+  MapOutWireFormat_Map1Entry();
+  virtual ~MapOutWireFormat_Map1Entry();
+
+  MapOutWireFormat_Map1Entry(const MapOutWireFormat_Map1Entry& from);
+  MapOutWireFormat_Map1Entry(MapOutWireFormat_Map1Entry&& from) noexcept
+    : MapOutWireFormat_Map1Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map1Entry& operator=(const MapOutWireFormat_Map1Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map1Entry& operator=(MapOutWireFormat_Map1Entry&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOutWireFormat_Map1Entry& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOutWireFormat_Map1Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map1Entry*>(
+               &_MapOutWireFormat_Map1Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  void Swap(MapOutWireFormat_Map1Entry* other);
+  friend void swap(MapOutWireFormat_Map1Entry& a, MapOutWireFormat_Map1Entry& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOutWireFormat_Map1Entry* New() const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map1Entry>(nullptr);
+  }
+
+  MapOutWireFormat_Map1Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map1Entry>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOutWireFormat_Map1Entry& from);
+  void MergeFrom(const MapOutWireFormat_Map1Entry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOutWireFormat_Map1Entry* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOutWireFormat.Map1Entry";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const std::string& key() const;
+  void set_key(const std::string& value);
+  void set_key(std::string&& value);
+  void set_key(const char* value);
+  void set_key(const char* value, size_t size);
+  std::string* mutable_key();
+  std::string* release_key();
+  void set_allocated_key(std::string* key);
+
+  // .proto_util_converter.testing.MapM value = 2;
+  bool has_value() const;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const ::proto_util_converter::testing::MapM& value() const;
+  ::proto_util_converter::testing::MapM* release_value();
+  ::proto_util_converter::testing::MapM* mutable_value();
+  void set_allocated_value(::proto_util_converter::testing::MapM* value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOutWireFormat.Map1Entry)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+  ::proto_util_converter::testing::MapM* value_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map2Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOutWireFormat.Map2Entry) */ {
+ public:
+  MapOutWireFormat_Map2Entry();
+  virtual ~MapOutWireFormat_Map2Entry();
+
+  MapOutWireFormat_Map2Entry(const MapOutWireFormat_Map2Entry& from);
+  MapOutWireFormat_Map2Entry(MapOutWireFormat_Map2Entry&& from) noexcept
+    : MapOutWireFormat_Map2Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map2Entry& operator=(const MapOutWireFormat_Map2Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map2Entry& operator=(MapOutWireFormat_Map2Entry&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOutWireFormat_Map2Entry& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOutWireFormat_Map2Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map2Entry*>(
+               &_MapOutWireFormat_Map2Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  void Swap(MapOutWireFormat_Map2Entry* other);
+  friend void swap(MapOutWireFormat_Map2Entry& a, MapOutWireFormat_Map2Entry& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOutWireFormat_Map2Entry* New() const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map2Entry>(nullptr);
+  }
+
+  MapOutWireFormat_Map2Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map2Entry>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOutWireFormat_Map2Entry& from);
+  void MergeFrom(const MapOutWireFormat_Map2Entry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOutWireFormat_Map2Entry* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOutWireFormat.Map2Entry";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const std::string& key() const;
+  void set_key(const std::string& value);
+  void set_key(std::string&& value);
+  void set_key(const char* value);
+  void set_key(const char* value, size_t size);
+  std::string* mutable_key();
+  std::string* release_key();
+  void set_allocated_key(std::string* key);
+
+  // .proto_util_converter.testing.MapOut value = 2;
+  bool has_value() const;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const ::proto_util_converter::testing::MapOut& value() const;
+  ::proto_util_converter::testing::MapOut* release_value();
+  ::proto_util_converter::testing::MapOut* mutable_value();
+  void set_allocated_value(::proto_util_converter::testing::MapOut* value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOutWireFormat.Map2Entry)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+  ::proto_util_converter::testing::MapOut* value_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map3Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOutWireFormat.Map3Entry) */ {
+ public:
+  MapOutWireFormat_Map3Entry();
+  virtual ~MapOutWireFormat_Map3Entry();
+
+  MapOutWireFormat_Map3Entry(const MapOutWireFormat_Map3Entry& from);
+  MapOutWireFormat_Map3Entry(MapOutWireFormat_Map3Entry&& from) noexcept
+    : MapOutWireFormat_Map3Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map3Entry& operator=(const MapOutWireFormat_Map3Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map3Entry& operator=(MapOutWireFormat_Map3Entry&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOutWireFormat_Map3Entry& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOutWireFormat_Map3Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map3Entry*>(
+               &_MapOutWireFormat_Map3Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  void Swap(MapOutWireFormat_Map3Entry* other);
+  friend void swap(MapOutWireFormat_Map3Entry& a, MapOutWireFormat_Map3Entry& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOutWireFormat_Map3Entry* New() const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map3Entry>(nullptr);
+  }
+
+  MapOutWireFormat_Map3Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map3Entry>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOutWireFormat_Map3Entry& from);
+  void MergeFrom(const MapOutWireFormat_Map3Entry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOutWireFormat_Map3Entry* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOutWireFormat.Map3Entry";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string value = 2;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const std::string& value() const;
+  void set_value(const std::string& value);
+  void set_value(std::string&& value);
+  void set_value(const char* value);
+  void set_value(const char* value, size_t size);
+  std::string* mutable_value();
+  std::string* release_value();
+  void set_allocated_value(std::string* value);
+
+  // int32 key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 key() const;
+  void set_key(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOutWireFormat.Map3Entry)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  ::PROTOBUF_NAMESPACE_ID::int32 key_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOutWireFormat_Map4Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOutWireFormat.Map4Entry) */ {
+ public:
+  MapOutWireFormat_Map4Entry();
+  virtual ~MapOutWireFormat_Map4Entry();
+
+  MapOutWireFormat_Map4Entry(const MapOutWireFormat_Map4Entry& from);
+  MapOutWireFormat_Map4Entry(MapOutWireFormat_Map4Entry&& from) noexcept
+    : MapOutWireFormat_Map4Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat_Map4Entry& operator=(const MapOutWireFormat_Map4Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat_Map4Entry& operator=(MapOutWireFormat_Map4Entry&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOutWireFormat_Map4Entry& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOutWireFormat_Map4Entry* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat_Map4Entry*>(
+               &_MapOutWireFormat_Map4Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  void Swap(MapOutWireFormat_Map4Entry* other);
+  friend void swap(MapOutWireFormat_Map4Entry& a, MapOutWireFormat_Map4Entry& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOutWireFormat_Map4Entry* New() const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map4Entry>(nullptr);
+  }
+
+  MapOutWireFormat_Map4Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOutWireFormat_Map4Entry>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOutWireFormat_Map4Entry& from);
+  void MergeFrom(const MapOutWireFormat_Map4Entry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOutWireFormat_Map4Entry* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOutWireFormat.Map4Entry";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string value = 2;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const std::string& value() const;
+  void set_value(const std::string& value);
+  void set_value(std::string&& value);
+  void set_value(const char* value);
+  void set_value(const char* value, size_t size);
+  std::string* mutable_value();
+  std::string* release_value();
+  void set_allocated_value(std::string* value);
+
+  // bool key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  bool key() const;
+  void set_key(bool value);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOutWireFormat.Map4Entry)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  bool key_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapOutWireFormat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapOutWireFormat) */ {
+ public:
+  MapOutWireFormat();
+  virtual ~MapOutWireFormat();
+
+  MapOutWireFormat(const MapOutWireFormat& from);
+  MapOutWireFormat(MapOutWireFormat&& from) noexcept
+    : MapOutWireFormat() {
+    *this = ::std::move(from);
+  }
+
+  inline MapOutWireFormat& operator=(const MapOutWireFormat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapOutWireFormat& operator=(MapOutWireFormat&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapOutWireFormat& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapOutWireFormat* internal_default_instance() {
+    return reinterpret_cast<const MapOutWireFormat*>(
+               &_MapOutWireFormat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  void Swap(MapOutWireFormat* other);
+  friend void swap(MapOutWireFormat& a, MapOutWireFormat& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapOutWireFormat* New() const final {
+    return CreateMaybeMessage<MapOutWireFormat>(nullptr);
+  }
+
+  MapOutWireFormat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapOutWireFormat>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapOutWireFormat& from);
+  void MergeFrom(const MapOutWireFormat& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapOutWireFormat* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapOutWireFormat";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MapOutWireFormat_Map1Entry Map1Entry;
+  typedef MapOutWireFormat_Map2Entry Map2Entry;
+  typedef MapOutWireFormat_Map3Entry Map3Entry;
+  typedef MapOutWireFormat_Map4Entry Map4Entry;
+
+  // accessors -------------------------------------------------------
+
+  // repeated .proto_util_converter.testing.MapOutWireFormat.Map1Entry map1 = 1;
+  int map1_size() const;
+  void clear_map1();
+  static const int kMap1FieldNumber = 1;
+  ::proto_util_converter::testing::MapOutWireFormat_Map1Entry* mutable_map1(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map1Entry >*
+      mutable_map1();
+  const ::proto_util_converter::testing::MapOutWireFormat_Map1Entry& map1(int index) const;
+  ::proto_util_converter::testing::MapOutWireFormat_Map1Entry* add_map1();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map1Entry >&
+      map1() const;
+
+  // repeated .proto_util_converter.testing.MapOutWireFormat.Map2Entry map2 = 2;
+  int map2_size() const;
+  void clear_map2();
+  static const int kMap2FieldNumber = 2;
+  ::proto_util_converter::testing::MapOutWireFormat_Map2Entry* mutable_map2(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map2Entry >*
+      mutable_map2();
+  const ::proto_util_converter::testing::MapOutWireFormat_Map2Entry& map2(int index) const;
+  ::proto_util_converter::testing::MapOutWireFormat_Map2Entry* add_map2();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map2Entry >&
+      map2() const;
+
+  // repeated .proto_util_converter.testing.MapOutWireFormat.Map3Entry map3 = 3;
+  int map3_size() const;
+  void clear_map3();
+  static const int kMap3FieldNumber = 3;
+  ::proto_util_converter::testing::MapOutWireFormat_Map3Entry* mutable_map3(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map3Entry >*
+      mutable_map3();
+  const ::proto_util_converter::testing::MapOutWireFormat_Map3Entry& map3(int index) const;
+  ::proto_util_converter::testing::MapOutWireFormat_Map3Entry* add_map3();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map3Entry >&
+      map3() const;
+
+  // repeated .proto_util_converter.testing.MapOutWireFormat.Map4Entry map4 = 5;
+  int map4_size() const;
+  void clear_map4();
+  static const int kMap4FieldNumber = 5;
+  ::proto_util_converter::testing::MapOutWireFormat_Map4Entry* mutable_map4(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map4Entry >*
+      mutable_map4();
+  const ::proto_util_converter::testing::MapOutWireFormat_Map4Entry& map4(int index) const;
+  ::proto_util_converter::testing::MapOutWireFormat_Map4Entry* add_map4();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map4Entry >&
+      map4() const;
+
+  // string bar = 4;
+  void clear_bar();
+  static const int kBarFieldNumber = 4;
+  const std::string& bar() const;
+  void set_bar(const std::string& value);
+  void set_bar(std::string&& value);
+  void set_bar(const char* value);
+  void set_bar(const char* value, size_t size);
+  std::string* mutable_bar();
+  std::string* release_bar();
+  void set_allocated_bar(std::string* bar);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapOutWireFormat)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map1Entry > map1_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map2Entry > map2_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map3Entry > map3_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map4Entry > map4_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bar_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MapM final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.MapM) */ {
+ public:
+  MapM();
+  virtual ~MapM();
+
+  MapM(const MapM& from);
+  MapM(MapM&& from) noexcept
+    : MapM() {
+    *this = ::std::move(from);
+  }
+
+  inline MapM& operator=(const MapM& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MapM& operator=(MapM&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const MapM& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MapM* internal_default_instance() {
+    return reinterpret_cast<const MapM*>(
+               &_MapM_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  void Swap(MapM* other);
+  friend void swap(MapM& a, MapM& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MapM* New() const final {
+    return CreateMaybeMessage<MapM>(nullptr);
+  }
+
+  MapM* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MapM>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MapM& from);
+  void MergeFrom(const MapM& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MapM* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.MapM";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string foo = 1;
+  void clear_foo();
+  static const int kFooFieldNumber = 1;
+  const std::string& foo() const;
+  void set_foo(const std::string& value);
+  void set_foo(std::string&& value);
+  void set_foo(const char* value);
+  void set_foo(const char* value, size_t size);
+  std::string* mutable_foo();
+  std::string* release_foo();
+  void set_allocated_foo(std::string* foo);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.MapM)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr foo_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MapsTestCases
+
+// .proto_util_converter.testing.EmptyMap empty_map = 1;
+inline bool MapsTestCases::has_empty_map() const {
+  return this != internal_default_instance() && empty_map_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_map() {
+  if (GetArenaNoVirtual() == nullptr && empty_map_ != nullptr) {
+    delete empty_map_;
+  }
+  empty_map_ = nullptr;
+}
+inline const ::proto_util_converter::testing::EmptyMap& MapsTestCases::empty_map() const {
+  const ::proto_util_converter::testing::EmptyMap* p = empty_map_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_map)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::EmptyMap*>(
+      &::proto_util_converter::testing::_EmptyMap_default_instance_);
+}
+inline ::proto_util_converter::testing::EmptyMap* MapsTestCases::release_empty_map() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_map)
+  
+  ::proto_util_converter::testing::EmptyMap* temp = empty_map_;
+  empty_map_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::EmptyMap* MapsTestCases::mutable_empty_map() {
+  
+  if (empty_map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::EmptyMap>(GetArenaNoVirtual());
+    empty_map_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_map)
+  return empty_map_;
+}
+inline void MapsTestCases::set_allocated_empty_map(::proto_util_converter::testing::EmptyMap* empty_map) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_map_;
+  }
+  if (empty_map) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_map = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_map, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_map_ = empty_map;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_map)
+}
+
+// .proto_util_converter.testing.StringtoInt string_to_int = 2;
+inline bool MapsTestCases::has_string_to_int() const {
+  return this != internal_default_instance() && string_to_int_ != nullptr;
+}
+inline void MapsTestCases::clear_string_to_int() {
+  if (GetArenaNoVirtual() == nullptr && string_to_int_ != nullptr) {
+    delete string_to_int_;
+  }
+  string_to_int_ = nullptr;
+}
+inline const ::proto_util_converter::testing::StringtoInt& MapsTestCases::string_to_int() const {
+  const ::proto_util_converter::testing::StringtoInt* p = string_to_int_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.string_to_int)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::StringtoInt*>(
+      &::proto_util_converter::testing::_StringtoInt_default_instance_);
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::release_string_to_int() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.string_to_int)
+  
+  ::proto_util_converter::testing::StringtoInt* temp = string_to_int_;
+  string_to_int_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::mutable_string_to_int() {
+  
+  if (string_to_int_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::StringtoInt>(GetArenaNoVirtual());
+    string_to_int_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.string_to_int)
+  return string_to_int_;
+}
+inline void MapsTestCases::set_allocated_string_to_int(::proto_util_converter::testing::StringtoInt* string_to_int) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete string_to_int_;
+  }
+  if (string_to_int) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      string_to_int = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, string_to_int, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  string_to_int_ = string_to_int;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.string_to_int)
+}
+
+// .proto_util_converter.testing.IntToString int_to_string = 3;
+inline bool MapsTestCases::has_int_to_string() const {
+  return this != internal_default_instance() && int_to_string_ != nullptr;
+}
+inline void MapsTestCases::clear_int_to_string() {
+  if (GetArenaNoVirtual() == nullptr && int_to_string_ != nullptr) {
+    delete int_to_string_;
+  }
+  int_to_string_ = nullptr;
+}
+inline const ::proto_util_converter::testing::IntToString& MapsTestCases::int_to_string() const {
+  const ::proto_util_converter::testing::IntToString* p = int_to_string_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.int_to_string)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::IntToString*>(
+      &::proto_util_converter::testing::_IntToString_default_instance_);
+}
+inline ::proto_util_converter::testing::IntToString* MapsTestCases::release_int_to_string() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.int_to_string)
+  
+  ::proto_util_converter::testing::IntToString* temp = int_to_string_;
+  int_to_string_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::IntToString* MapsTestCases::mutable_int_to_string() {
+  
+  if (int_to_string_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::IntToString>(GetArenaNoVirtual());
+    int_to_string_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.int_to_string)
+  return int_to_string_;
+}
+inline void MapsTestCases::set_allocated_int_to_string(::proto_util_converter::testing::IntToString* int_to_string) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete int_to_string_;
+  }
+  if (int_to_string) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      int_to_string = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int_to_string, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int_to_string_ = int_to_string;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.int_to_string)
+}
+
+// .proto_util_converter.testing.Mixed1 mixed1 = 4;
+inline bool MapsTestCases::has_mixed1() const {
+  return this != internal_default_instance() && mixed1_ != nullptr;
+}
+inline void MapsTestCases::clear_mixed1() {
+  if (GetArenaNoVirtual() == nullptr && mixed1_ != nullptr) {
+    delete mixed1_;
+  }
+  mixed1_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Mixed1& MapsTestCases::mixed1() const {
+  const ::proto_util_converter::testing::Mixed1* p = mixed1_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.mixed1)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Mixed1*>(
+      &::proto_util_converter::testing::_Mixed1_default_instance_);
+}
+inline ::proto_util_converter::testing::Mixed1* MapsTestCases::release_mixed1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.mixed1)
+  
+  ::proto_util_converter::testing::Mixed1* temp = mixed1_;
+  mixed1_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Mixed1* MapsTestCases::mutable_mixed1() {
+  
+  if (mixed1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Mixed1>(GetArenaNoVirtual());
+    mixed1_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.mixed1)
+  return mixed1_;
+}
+inline void MapsTestCases::set_allocated_mixed1(::proto_util_converter::testing::Mixed1* mixed1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete mixed1_;
+  }
+  if (mixed1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      mixed1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mixed1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  mixed1_ = mixed1;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.mixed1)
+}
+
+// .proto_util_converter.testing.Mixed2 mixed2 = 5;
+inline bool MapsTestCases::has_mixed2() const {
+  return this != internal_default_instance() && mixed2_ != nullptr;
+}
+inline void MapsTestCases::clear_mixed2() {
+  if (GetArenaNoVirtual() == nullptr && mixed2_ != nullptr) {
+    delete mixed2_;
+  }
+  mixed2_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Mixed2& MapsTestCases::mixed2() const {
+  const ::proto_util_converter::testing::Mixed2* p = mixed2_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.mixed2)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Mixed2*>(
+      &::proto_util_converter::testing::_Mixed2_default_instance_);
+}
+inline ::proto_util_converter::testing::Mixed2* MapsTestCases::release_mixed2() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.mixed2)
+  
+  ::proto_util_converter::testing::Mixed2* temp = mixed2_;
+  mixed2_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Mixed2* MapsTestCases::mutable_mixed2() {
+  
+  if (mixed2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Mixed2>(GetArenaNoVirtual());
+    mixed2_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.mixed2)
+  return mixed2_;
+}
+inline void MapsTestCases::set_allocated_mixed2(::proto_util_converter::testing::Mixed2* mixed2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete mixed2_;
+  }
+  if (mixed2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      mixed2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mixed2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  mixed2_ = mixed2;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.mixed2)
+}
+
+// .proto_util_converter.testing.MapOfObjects map_of_objects = 6;
+inline bool MapsTestCases::has_map_of_objects() const {
+  return this != internal_default_instance() && map_of_objects_ != nullptr;
+}
+inline void MapsTestCases::clear_map_of_objects() {
+  if (GetArenaNoVirtual() == nullptr && map_of_objects_ != nullptr) {
+    delete map_of_objects_;
+  }
+  map_of_objects_ = nullptr;
+}
+inline const ::proto_util_converter::testing::MapOfObjects& MapsTestCases::map_of_objects() const {
+  const ::proto_util_converter::testing::MapOfObjects* p = map_of_objects_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.map_of_objects)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::MapOfObjects*>(
+      &::proto_util_converter::testing::_MapOfObjects_default_instance_);
+}
+inline ::proto_util_converter::testing::MapOfObjects* MapsTestCases::release_map_of_objects() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.map_of_objects)
+  
+  ::proto_util_converter::testing::MapOfObjects* temp = map_of_objects_;
+  map_of_objects_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::MapOfObjects* MapsTestCases::mutable_map_of_objects() {
+  
+  if (map_of_objects_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::MapOfObjects>(GetArenaNoVirtual());
+    map_of_objects_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.map_of_objects)
+  return map_of_objects_;
+}
+inline void MapsTestCases::set_allocated_map_of_objects(::proto_util_converter::testing::MapOfObjects* map_of_objects) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete map_of_objects_;
+  }
+  if (map_of_objects) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      map_of_objects = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, map_of_objects, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  map_of_objects_ = map_of_objects;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.map_of_objects)
+}
+
+// .proto_util_converter.testing.StringtoInt empty_key_string_to_int1 = 7;
+inline bool MapsTestCases::has_empty_key_string_to_int1() const {
+  return this != internal_default_instance() && empty_key_string_to_int1_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_string_to_int1() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_string_to_int1_ != nullptr) {
+    delete empty_key_string_to_int1_;
+  }
+  empty_key_string_to_int1_ = nullptr;
+}
+inline const ::proto_util_converter::testing::StringtoInt& MapsTestCases::empty_key_string_to_int1() const {
+  const ::proto_util_converter::testing::StringtoInt* p = empty_key_string_to_int1_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int1)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::StringtoInt*>(
+      &::proto_util_converter::testing::_StringtoInt_default_instance_);
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::release_empty_key_string_to_int1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int1)
+  
+  ::proto_util_converter::testing::StringtoInt* temp = empty_key_string_to_int1_;
+  empty_key_string_to_int1_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::mutable_empty_key_string_to_int1() {
+  
+  if (empty_key_string_to_int1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::StringtoInt>(GetArenaNoVirtual());
+    empty_key_string_to_int1_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int1)
+  return empty_key_string_to_int1_;
+}
+inline void MapsTestCases::set_allocated_empty_key_string_to_int1(::proto_util_converter::testing::StringtoInt* empty_key_string_to_int1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_string_to_int1_;
+  }
+  if (empty_key_string_to_int1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_string_to_int1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_string_to_int1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_string_to_int1_ = empty_key_string_to_int1;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int1)
+}
+
+// .proto_util_converter.testing.StringtoInt empty_key_string_to_int2 = 8;
+inline bool MapsTestCases::has_empty_key_string_to_int2() const {
+  return this != internal_default_instance() && empty_key_string_to_int2_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_string_to_int2() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_string_to_int2_ != nullptr) {
+    delete empty_key_string_to_int2_;
+  }
+  empty_key_string_to_int2_ = nullptr;
+}
+inline const ::proto_util_converter::testing::StringtoInt& MapsTestCases::empty_key_string_to_int2() const {
+  const ::proto_util_converter::testing::StringtoInt* p = empty_key_string_to_int2_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int2)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::StringtoInt*>(
+      &::proto_util_converter::testing::_StringtoInt_default_instance_);
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::release_empty_key_string_to_int2() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int2)
+  
+  ::proto_util_converter::testing::StringtoInt* temp = empty_key_string_to_int2_;
+  empty_key_string_to_int2_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::mutable_empty_key_string_to_int2() {
+  
+  if (empty_key_string_to_int2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::StringtoInt>(GetArenaNoVirtual());
+    empty_key_string_to_int2_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int2)
+  return empty_key_string_to_int2_;
+}
+inline void MapsTestCases::set_allocated_empty_key_string_to_int2(::proto_util_converter::testing::StringtoInt* empty_key_string_to_int2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_string_to_int2_;
+  }
+  if (empty_key_string_to_int2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_string_to_int2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_string_to_int2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_string_to_int2_ = empty_key_string_to_int2;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int2)
+}
+
+// .proto_util_converter.testing.StringtoInt empty_key_string_to_int3 = 9;
+inline bool MapsTestCases::has_empty_key_string_to_int3() const {
+  return this != internal_default_instance() && empty_key_string_to_int3_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_string_to_int3() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_string_to_int3_ != nullptr) {
+    delete empty_key_string_to_int3_;
+  }
+  empty_key_string_to_int3_ = nullptr;
+}
+inline const ::proto_util_converter::testing::StringtoInt& MapsTestCases::empty_key_string_to_int3() const {
+  const ::proto_util_converter::testing::StringtoInt* p = empty_key_string_to_int3_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int3)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::StringtoInt*>(
+      &::proto_util_converter::testing::_StringtoInt_default_instance_);
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::release_empty_key_string_to_int3() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int3)
+  
+  ::proto_util_converter::testing::StringtoInt* temp = empty_key_string_to_int3_;
+  empty_key_string_to_int3_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::StringtoInt* MapsTestCases::mutable_empty_key_string_to_int3() {
+  
+  if (empty_key_string_to_int3_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::StringtoInt>(GetArenaNoVirtual());
+    empty_key_string_to_int3_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int3)
+  return empty_key_string_to_int3_;
+}
+inline void MapsTestCases::set_allocated_empty_key_string_to_int3(::proto_util_converter::testing::StringtoInt* empty_key_string_to_int3) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_string_to_int3_;
+  }
+  if (empty_key_string_to_int3) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_string_to_int3 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_string_to_int3, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_string_to_int3_ = empty_key_string_to_int3;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_string_to_int3)
+}
+
+// .proto_util_converter.testing.BoolToString empty_key_bool_to_string = 10;
+inline bool MapsTestCases::has_empty_key_bool_to_string() const {
+  return this != internal_default_instance() && empty_key_bool_to_string_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_bool_to_string() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_bool_to_string_ != nullptr) {
+    delete empty_key_bool_to_string_;
+  }
+  empty_key_bool_to_string_ = nullptr;
+}
+inline const ::proto_util_converter::testing::BoolToString& MapsTestCases::empty_key_bool_to_string() const {
+  const ::proto_util_converter::testing::BoolToString* p = empty_key_bool_to_string_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_bool_to_string)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::BoolToString*>(
+      &::proto_util_converter::testing::_BoolToString_default_instance_);
+}
+inline ::proto_util_converter::testing::BoolToString* MapsTestCases::release_empty_key_bool_to_string() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_bool_to_string)
+  
+  ::proto_util_converter::testing::BoolToString* temp = empty_key_bool_to_string_;
+  empty_key_bool_to_string_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::BoolToString* MapsTestCases::mutable_empty_key_bool_to_string() {
+  
+  if (empty_key_bool_to_string_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::BoolToString>(GetArenaNoVirtual());
+    empty_key_bool_to_string_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_bool_to_string)
+  return empty_key_bool_to_string_;
+}
+inline void MapsTestCases::set_allocated_empty_key_bool_to_string(::proto_util_converter::testing::BoolToString* empty_key_bool_to_string) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_bool_to_string_;
+  }
+  if (empty_key_bool_to_string) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_bool_to_string = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_bool_to_string, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_bool_to_string_ = empty_key_bool_to_string;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_bool_to_string)
+}
+
+// .proto_util_converter.testing.IntToString empty_key_int_to_string = 11;
+inline bool MapsTestCases::has_empty_key_int_to_string() const {
+  return this != internal_default_instance() && empty_key_int_to_string_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_int_to_string() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_int_to_string_ != nullptr) {
+    delete empty_key_int_to_string_;
+  }
+  empty_key_int_to_string_ = nullptr;
+}
+inline const ::proto_util_converter::testing::IntToString& MapsTestCases::empty_key_int_to_string() const {
+  const ::proto_util_converter::testing::IntToString* p = empty_key_int_to_string_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_int_to_string)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::IntToString*>(
+      &::proto_util_converter::testing::_IntToString_default_instance_);
+}
+inline ::proto_util_converter::testing::IntToString* MapsTestCases::release_empty_key_int_to_string() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_int_to_string)
+  
+  ::proto_util_converter::testing::IntToString* temp = empty_key_int_to_string_;
+  empty_key_int_to_string_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::IntToString* MapsTestCases::mutable_empty_key_int_to_string() {
+  
+  if (empty_key_int_to_string_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::IntToString>(GetArenaNoVirtual());
+    empty_key_int_to_string_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_int_to_string)
+  return empty_key_int_to_string_;
+}
+inline void MapsTestCases::set_allocated_empty_key_int_to_string(::proto_util_converter::testing::IntToString* empty_key_int_to_string) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_int_to_string_;
+  }
+  if (empty_key_int_to_string) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_int_to_string = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_int_to_string, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_int_to_string_ = empty_key_int_to_string;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_int_to_string)
+}
+
+// .proto_util_converter.testing.Mixed1 empty_key_mixed = 12;
+inline bool MapsTestCases::has_empty_key_mixed() const {
+  return this != internal_default_instance() && empty_key_mixed_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_mixed() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_mixed_ != nullptr) {
+    delete empty_key_mixed_;
+  }
+  empty_key_mixed_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Mixed1& MapsTestCases::empty_key_mixed() const {
+  const ::proto_util_converter::testing::Mixed1* p = empty_key_mixed_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_mixed)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Mixed1*>(
+      &::proto_util_converter::testing::_Mixed1_default_instance_);
+}
+inline ::proto_util_converter::testing::Mixed1* MapsTestCases::release_empty_key_mixed() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_mixed)
+  
+  ::proto_util_converter::testing::Mixed1* temp = empty_key_mixed_;
+  empty_key_mixed_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Mixed1* MapsTestCases::mutable_empty_key_mixed() {
+  
+  if (empty_key_mixed_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Mixed1>(GetArenaNoVirtual());
+    empty_key_mixed_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_mixed)
+  return empty_key_mixed_;
+}
+inline void MapsTestCases::set_allocated_empty_key_mixed(::proto_util_converter::testing::Mixed1* empty_key_mixed) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_mixed_;
+  }
+  if (empty_key_mixed) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_mixed = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_mixed, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_mixed_ = empty_key_mixed;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_mixed)
+}
+
+// .proto_util_converter.testing.MapOfObjects empty_key_map_objects = 13;
+inline bool MapsTestCases::has_empty_key_map_objects() const {
+  return this != internal_default_instance() && empty_key_map_objects_ != nullptr;
+}
+inline void MapsTestCases::clear_empty_key_map_objects() {
+  if (GetArenaNoVirtual() == nullptr && empty_key_map_objects_ != nullptr) {
+    delete empty_key_map_objects_;
+  }
+  empty_key_map_objects_ = nullptr;
+}
+inline const ::proto_util_converter::testing::MapOfObjects& MapsTestCases::empty_key_map_objects() const {
+  const ::proto_util_converter::testing::MapOfObjects* p = empty_key_map_objects_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapsTestCases.empty_key_map_objects)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::MapOfObjects*>(
+      &::proto_util_converter::testing::_MapOfObjects_default_instance_);
+}
+inline ::proto_util_converter::testing::MapOfObjects* MapsTestCases::release_empty_key_map_objects() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapsTestCases.empty_key_map_objects)
+  
+  ::proto_util_converter::testing::MapOfObjects* temp = empty_key_map_objects_;
+  empty_key_map_objects_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::MapOfObjects* MapsTestCases::mutable_empty_key_map_objects() {
+  
+  if (empty_key_map_objects_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::MapOfObjects>(GetArenaNoVirtual());
+    empty_key_map_objects_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapsTestCases.empty_key_map_objects)
+  return empty_key_map_objects_;
+}
+inline void MapsTestCases::set_allocated_empty_key_map_objects(::proto_util_converter::testing::MapOfObjects* empty_key_map_objects) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete empty_key_map_objects_;
+  }
+  if (empty_key_map_objects) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      empty_key_map_objects = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_key_map_objects, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_key_map_objects_ = empty_key_map_objects;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapsTestCases.empty_key_map_objects)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// EmptyMap
+
+// map<int32, int32> map = 1;
+inline int EmptyMap::map_size() const {
+  return map_.size();
+}
+inline void EmptyMap::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+EmptyMap::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.EmptyMap.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+EmptyMap::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.EmptyMap.map)
+  return map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// StringtoInt
+
+// map<string, int32> map = 1;
+inline int StringtoInt::map_size() const {
+  return map_.size();
+}
+inline void StringtoInt::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >&
+StringtoInt::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.StringtoInt.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >*
+StringtoInt::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.StringtoInt.map)
+  return map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// IntToString
+
+// map<int32, string> map = 1;
+inline int IntToString::map_size() const {
+  return map_.size();
+}
+inline void IntToString::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+IntToString::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.IntToString.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+IntToString::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.IntToString.map)
+  return map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// BoolToString
+
+// map<bool, string> map = 1;
+inline int BoolToString::map_size() const {
+  return map_.size();
+}
+inline void BoolToString::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >&
+BoolToString::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.BoolToString.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >*
+BoolToString::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.BoolToString.map)
+  return map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Mixed1
+
+// string msg = 1;
+inline void Mixed1::clear_msg() {
+  msg_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& Mixed1::msg() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Mixed1.msg)
+  return msg_.GetNoArena();
+}
+inline void Mixed1::set_msg(const std::string& value) {
+  
+  msg_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Mixed1.msg)
+}
+inline void Mixed1::set_msg(std::string&& value) {
+  
+  msg_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Mixed1.msg)
+}
+inline void Mixed1::set_msg(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  msg_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Mixed1.msg)
+}
+inline void Mixed1::set_msg(const char* value, size_t size) {
+  
+  msg_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Mixed1.msg)
+}
+inline std::string* Mixed1::mutable_msg() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Mixed1.msg)
+  return msg_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* Mixed1::release_msg() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Mixed1.msg)
+  
+  return msg_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void Mixed1::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    
+  } else {
+    
+  }
+  msg_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), msg);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Mixed1.msg)
+}
+
+// map<string, float> map = 2;
+inline int Mixed1::map_size() const {
+  return map_.size();
+}
+inline void Mixed1::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, float >&
+Mixed1::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.Mixed1.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, float >*
+Mixed1::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.Mixed1.map)
+  return map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Mixed2
+
+// map<int32, bool> map = 1;
+inline int Mixed2::map_size() const {
+  return map_.size();
+}
+inline void Mixed2::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, bool >&
+Mixed2::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.Mixed2.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, bool >*
+Mixed2::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.Mixed2.map)
+  return map_.MutableMap();
+}
+
+// .proto_util_converter.testing.Mixed2.E ee = 2;
+inline void Mixed2::clear_ee() {
+  ee_ = 0;
+}
+inline ::proto_util_converter::testing::Mixed2_E Mixed2::ee() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Mixed2.ee)
+  return static_cast< ::proto_util_converter::testing::Mixed2_E >(ee_);
+}
+inline void Mixed2::set_ee(::proto_util_converter::testing::Mixed2_E value) {
+  
+  ee_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Mixed2.ee)
+}
+
+// -------------------------------------------------------------------
+
+// MapOfObjects_M
+
+// string inner_text = 1;
+inline void MapOfObjects_M::clear_inner_text() {
+  inner_text_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOfObjects_M::inner_text() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOfObjects.M.inner_text)
+  return inner_text_.GetNoArena();
+}
+inline void MapOfObjects_M::set_inner_text(const std::string& value) {
+  
+  inner_text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOfObjects.M.inner_text)
+}
+inline void MapOfObjects_M::set_inner_text(std::string&& value) {
+  
+  inner_text_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOfObjects.M.inner_text)
+}
+inline void MapOfObjects_M::set_inner_text(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  inner_text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOfObjects.M.inner_text)
+}
+inline void MapOfObjects_M::set_inner_text(const char* value, size_t size) {
+  
+  inner_text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOfObjects.M.inner_text)
+}
+inline std::string* MapOfObjects_M::mutable_inner_text() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOfObjects.M.inner_text)
+  return inner_text_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOfObjects_M::release_inner_text() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOfObjects.M.inner_text)
+  
+  return inner_text_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOfObjects_M::set_allocated_inner_text(std::string* inner_text) {
+  if (inner_text != nullptr) {
+    
+  } else {
+    
+  }
+  inner_text_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), inner_text);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOfObjects.M.inner_text)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapOfObjects
+
+// map<string, .proto_util_converter.testing.MapOfObjects.M> map = 1;
+inline int MapOfObjects::map_size() const {
+  return map_.size();
+}
+inline void MapOfObjects::clear_map() {
+  map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOfObjects_M >&
+MapOfObjects::map() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapOfObjects.map)
+  return map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOfObjects_M >*
+MapOfObjects::mutable_map() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapOfObjects.map)
+  return map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// DummyRequest
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapIn
+
+// string other = 1;
+inline void MapIn::clear_other() {
+  other_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapIn::other() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapIn.other)
+  return other_.GetNoArena();
+}
+inline void MapIn::set_other(const std::string& value) {
+  
+  other_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapIn.other)
+}
+inline void MapIn::set_other(std::string&& value) {
+  
+  other_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapIn.other)
+}
+inline void MapIn::set_other(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  other_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapIn.other)
+}
+inline void MapIn::set_other(const char* value, size_t size) {
+  
+  other_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapIn.other)
+}
+inline std::string* MapIn::mutable_other() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapIn.other)
+  return other_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapIn::release_other() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapIn.other)
+  
+  return other_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapIn::set_allocated_other(std::string* other) {
+  if (other != nullptr) {
+    
+  } else {
+    
+  }
+  other_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), other);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapIn.other)
+}
+
+// repeated string things = 2;
+inline int MapIn::things_size() const {
+  return things_.size();
+}
+inline void MapIn::clear_things() {
+  things_.Clear();
+}
+inline const std::string& MapIn::things(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapIn.things)
+  return things_.Get(index);
+}
+inline std::string* MapIn::mutable_things(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapIn.things)
+  return things_.Mutable(index);
+}
+inline void MapIn::set_things(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapIn.things)
+  things_.Mutable(index)->assign(value);
+}
+inline void MapIn::set_things(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapIn.things)
+  things_.Mutable(index)->assign(std::move(value));
+}
+inline void MapIn::set_things(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  things_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapIn.things)
+}
+inline void MapIn::set_things(int index, const char* value, size_t size) {
+  things_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapIn.things)
+}
+inline std::string* MapIn::add_things() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.MapIn.things)
+  return things_.Add();
+}
+inline void MapIn::add_things(const std::string& value) {
+  things_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.MapIn.things)
+}
+inline void MapIn::add_things(std::string&& value) {
+  things_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.MapIn.things)
+}
+inline void MapIn::add_things(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  things_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.MapIn.things)
+}
+inline void MapIn::add_things(const char* value, size_t size) {
+  things_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.MapIn.things)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MapIn::things() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.MapIn.things)
+  return things_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MapIn::mutable_things() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.MapIn.things)
+  return &things_;
+}
+
+// map<string, string> map_input = 3;
+inline int MapIn::map_input_size() const {
+  return map_input_.size();
+}
+inline void MapIn::clear_map_input() {
+  map_input_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+MapIn::map_input() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapIn.map_input)
+  return map_input_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+MapIn::mutable_map_input() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapIn.map_input)
+  return map_input_.MutableMap();
+}
+
+// map<string, .google.protobuf.Any> map_any = 4;
+inline int MapIn::map_any_size() const {
+  return map_any_.size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Any >&
+MapIn::map_any() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapIn.map_any)
+  return map_any_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Any >*
+MapIn::mutable_map_any() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapIn.map_any)
+  return map_any_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MapOut
+
+// map<string, .proto_util_converter.testing.MapM> map1 = 1;
+inline int MapOut::map1_size() const {
+  return map1_.size();
+}
+inline void MapOut::clear_map1() {
+  map1_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapM >&
+MapOut::map1() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapOut.map1)
+  return map1_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapM >*
+MapOut::mutable_map1() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapOut.map1)
+  return map1_.MutableMap();
+}
+
+// map<string, .proto_util_converter.testing.MapOut> map2 = 2;
+inline int MapOut::map2_size() const {
+  return map2_.size();
+}
+inline void MapOut::clear_map2() {
+  map2_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOut >&
+MapOut::map2() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapOut.map2)
+  return map2_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto_util_converter::testing::MapOut >*
+MapOut::mutable_map2() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapOut.map2)
+  return map2_.MutableMap();
+}
+
+// map<int32, string> map3 = 3;
+inline int MapOut::map3_size() const {
+  return map3_.size();
+}
+inline void MapOut::clear_map3() {
+  map3_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+MapOut::map3() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapOut.map3)
+  return map3_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+MapOut::mutable_map3() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapOut.map3)
+  return map3_.MutableMap();
+}
+
+// map<bool, string> map4 = 5;
+inline int MapOut::map4_size() const {
+  return map4_.size();
+}
+inline void MapOut::clear_map4() {
+  map4_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >&
+MapOut::map4() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.MapOut.map4)
+  return map4_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, std::string >*
+MapOut::mutable_map4() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.MapOut.map4)
+  return map4_.MutableMap();
+}
+
+// string bar = 4;
+inline void MapOut::clear_bar() {
+  bar_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOut::bar() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOut.bar)
+  return bar_.GetNoArena();
+}
+inline void MapOut::set_bar(const std::string& value) {
+  
+  bar_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOut.bar)
+}
+inline void MapOut::set_bar(std::string&& value) {
+  
+  bar_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOut.bar)
+}
+inline void MapOut::set_bar(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  bar_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOut.bar)
+}
+inline void MapOut::set_bar(const char* value, size_t size) {
+  
+  bar_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOut.bar)
+}
+inline std::string* MapOut::mutable_bar() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOut.bar)
+  return bar_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOut::release_bar() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOut.bar)
+  
+  return bar_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOut::set_allocated_bar(std::string* bar) {
+  if (bar != nullptr) {
+    
+  } else {
+    
+  }
+  bar_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bar);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOut.bar)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map1Entry
+
+// string key = 1;
+inline void MapOutWireFormat_Map1Entry::clear_key() {
+  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOutWireFormat_Map1Entry::key() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+  return key_.GetNoArena();
+}
+inline void MapOutWireFormat_Map1Entry::set_key(const std::string& value) {
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+}
+inline void MapOutWireFormat_Map1Entry::set_key(std::string&& value) {
+  
+  key_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+}
+inline void MapOutWireFormat_Map1Entry::set_key(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+}
+inline void MapOutWireFormat_Map1Entry::set_key(const char* value, size_t size) {
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+}
+inline std::string* MapOutWireFormat_Map1Entry::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOutWireFormat_Map1Entry::release_key() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+  
+  return key_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOutWireFormat_Map1Entry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.Map1Entry.key)
+}
+
+// .proto_util_converter.testing.MapM value = 2;
+inline bool MapOutWireFormat_Map1Entry::has_value() const {
+  return this != internal_default_instance() && value_ != nullptr;
+}
+inline void MapOutWireFormat_Map1Entry::clear_value() {
+  if (GetArenaNoVirtual() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::MapM& MapOutWireFormat_Map1Entry::value() const {
+  const ::proto_util_converter::testing::MapM* p = value_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map1Entry.value)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::MapM*>(
+      &::proto_util_converter::testing::_MapM_default_instance_);
+}
+inline ::proto_util_converter::testing::MapM* MapOutWireFormat_Map1Entry::release_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.Map1Entry.value)
+  
+  ::proto_util_converter::testing::MapM* temp = value_;
+  value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::MapM* MapOutWireFormat_Map1Entry::mutable_value() {
+  
+  if (value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::MapM>(GetArenaNoVirtual());
+    value_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.Map1Entry.value)
+  return value_;
+}
+inline void MapOutWireFormat_Map1Entry::set_allocated_value(::proto_util_converter::testing::MapM* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete value_;
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.Map1Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map2Entry
+
+// string key = 1;
+inline void MapOutWireFormat_Map2Entry::clear_key() {
+  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOutWireFormat_Map2Entry::key() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+  return key_.GetNoArena();
+}
+inline void MapOutWireFormat_Map2Entry::set_key(const std::string& value) {
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+}
+inline void MapOutWireFormat_Map2Entry::set_key(std::string&& value) {
+  
+  key_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+}
+inline void MapOutWireFormat_Map2Entry::set_key(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+}
+inline void MapOutWireFormat_Map2Entry::set_key(const char* value, size_t size) {
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+}
+inline std::string* MapOutWireFormat_Map2Entry::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOutWireFormat_Map2Entry::release_key() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+  
+  return key_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOutWireFormat_Map2Entry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.Map2Entry.key)
+}
+
+// .proto_util_converter.testing.MapOut value = 2;
+inline bool MapOutWireFormat_Map2Entry::has_value() const {
+  return this != internal_default_instance() && value_ != nullptr;
+}
+inline void MapOutWireFormat_Map2Entry::clear_value() {
+  if (GetArenaNoVirtual() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::MapOut& MapOutWireFormat_Map2Entry::value() const {
+  const ::proto_util_converter::testing::MapOut* p = value_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map2Entry.value)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::MapOut*>(
+      &::proto_util_converter::testing::_MapOut_default_instance_);
+}
+inline ::proto_util_converter::testing::MapOut* MapOutWireFormat_Map2Entry::release_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.Map2Entry.value)
+  
+  ::proto_util_converter::testing::MapOut* temp = value_;
+  value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::MapOut* MapOutWireFormat_Map2Entry::mutable_value() {
+  
+  if (value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::MapOut>(GetArenaNoVirtual());
+    value_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.Map2Entry.value)
+  return value_;
+}
+inline void MapOutWireFormat_Map2Entry::set_allocated_value(::proto_util_converter::testing::MapOut* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete value_;
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.Map2Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map3Entry
+
+// int32 key = 1;
+inline void MapOutWireFormat_Map3Entry::clear_key() {
+  key_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 MapOutWireFormat_Map3Entry::key() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map3Entry.key)
+  return key_;
+}
+inline void MapOutWireFormat_Map3Entry::set_key(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  key_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.Map3Entry.key)
+}
+
+// string value = 2;
+inline void MapOutWireFormat_Map3Entry::clear_value() {
+  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOutWireFormat_Map3Entry::value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+  return value_.GetNoArena();
+}
+inline void MapOutWireFormat_Map3Entry::set_value(const std::string& value) {
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+}
+inline void MapOutWireFormat_Map3Entry::set_value(std::string&& value) {
+  
+  value_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+}
+inline void MapOutWireFormat_Map3Entry::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+}
+inline void MapOutWireFormat_Map3Entry::set_value(const char* value, size_t size) {
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+}
+inline std::string* MapOutWireFormat_Map3Entry::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOutWireFormat_Map3Entry::release_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+  
+  return value_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOutWireFormat_Map3Entry::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.Map3Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat_Map4Entry
+
+// bool key = 1;
+inline void MapOutWireFormat_Map4Entry::clear_key() {
+  key_ = false;
+}
+inline bool MapOutWireFormat_Map4Entry::key() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map4Entry.key)
+  return key_;
+}
+inline void MapOutWireFormat_Map4Entry::set_key(bool value) {
+  
+  key_ = value;
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.Map4Entry.key)
+}
+
+// string value = 2;
+inline void MapOutWireFormat_Map4Entry::clear_value() {
+  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOutWireFormat_Map4Entry::value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+  return value_.GetNoArena();
+}
+inline void MapOutWireFormat_Map4Entry::set_value(const std::string& value) {
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+}
+inline void MapOutWireFormat_Map4Entry::set_value(std::string&& value) {
+  
+  value_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+}
+inline void MapOutWireFormat_Map4Entry::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+}
+inline void MapOutWireFormat_Map4Entry::set_value(const char* value, size_t size) {
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+}
+inline std::string* MapOutWireFormat_Map4Entry::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOutWireFormat_Map4Entry::release_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+  
+  return value_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOutWireFormat_Map4Entry::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.Map4Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// MapOutWireFormat
+
+// repeated .proto_util_converter.testing.MapOutWireFormat.Map1Entry map1 = 1;
+inline int MapOutWireFormat::map1_size() const {
+  return map1_.size();
+}
+inline void MapOutWireFormat::clear_map1() {
+  map1_.Clear();
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map1Entry* MapOutWireFormat::mutable_map1(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.map1)
+  return map1_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map1Entry >*
+MapOutWireFormat::mutable_map1() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.MapOutWireFormat.map1)
+  return &map1_;
+}
+inline const ::proto_util_converter::testing::MapOutWireFormat_Map1Entry& MapOutWireFormat::map1(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.map1)
+  return map1_.Get(index);
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map1Entry* MapOutWireFormat::add_map1() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.MapOutWireFormat.map1)
+  return map1_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map1Entry >&
+MapOutWireFormat::map1() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.MapOutWireFormat.map1)
+  return map1_;
+}
+
+// repeated .proto_util_converter.testing.MapOutWireFormat.Map2Entry map2 = 2;
+inline int MapOutWireFormat::map2_size() const {
+  return map2_.size();
+}
+inline void MapOutWireFormat::clear_map2() {
+  map2_.Clear();
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map2Entry* MapOutWireFormat::mutable_map2(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.map2)
+  return map2_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map2Entry >*
+MapOutWireFormat::mutable_map2() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.MapOutWireFormat.map2)
+  return &map2_;
+}
+inline const ::proto_util_converter::testing::MapOutWireFormat_Map2Entry& MapOutWireFormat::map2(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.map2)
+  return map2_.Get(index);
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map2Entry* MapOutWireFormat::add_map2() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.MapOutWireFormat.map2)
+  return map2_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map2Entry >&
+MapOutWireFormat::map2() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.MapOutWireFormat.map2)
+  return map2_;
+}
+
+// repeated .proto_util_converter.testing.MapOutWireFormat.Map3Entry map3 = 3;
+inline int MapOutWireFormat::map3_size() const {
+  return map3_.size();
+}
+inline void MapOutWireFormat::clear_map3() {
+  map3_.Clear();
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map3Entry* MapOutWireFormat::mutable_map3(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.map3)
+  return map3_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map3Entry >*
+MapOutWireFormat::mutable_map3() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.MapOutWireFormat.map3)
+  return &map3_;
+}
+inline const ::proto_util_converter::testing::MapOutWireFormat_Map3Entry& MapOutWireFormat::map3(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.map3)
+  return map3_.Get(index);
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map3Entry* MapOutWireFormat::add_map3() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.MapOutWireFormat.map3)
+  return map3_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map3Entry >&
+MapOutWireFormat::map3() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.MapOutWireFormat.map3)
+  return map3_;
+}
+
+// repeated .proto_util_converter.testing.MapOutWireFormat.Map4Entry map4 = 5;
+inline int MapOutWireFormat::map4_size() const {
+  return map4_.size();
+}
+inline void MapOutWireFormat::clear_map4() {
+  map4_.Clear();
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map4Entry* MapOutWireFormat::mutable_map4(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.map4)
+  return map4_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map4Entry >*
+MapOutWireFormat::mutable_map4() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.MapOutWireFormat.map4)
+  return &map4_;
+}
+inline const ::proto_util_converter::testing::MapOutWireFormat_Map4Entry& MapOutWireFormat::map4(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.map4)
+  return map4_.Get(index);
+}
+inline ::proto_util_converter::testing::MapOutWireFormat_Map4Entry* MapOutWireFormat::add_map4() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.MapOutWireFormat.map4)
+  return map4_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::MapOutWireFormat_Map4Entry >&
+MapOutWireFormat::map4() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.MapOutWireFormat.map4)
+  return map4_;
+}
+
+// string bar = 4;
+inline void MapOutWireFormat::clear_bar() {
+  bar_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapOutWireFormat::bar() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapOutWireFormat.bar)
+  return bar_.GetNoArena();
+}
+inline void MapOutWireFormat::set_bar(const std::string& value) {
+  
+  bar_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapOutWireFormat.bar)
+}
+inline void MapOutWireFormat::set_bar(std::string&& value) {
+  
+  bar_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapOutWireFormat.bar)
+}
+inline void MapOutWireFormat::set_bar(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  bar_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapOutWireFormat.bar)
+}
+inline void MapOutWireFormat::set_bar(const char* value, size_t size) {
+  
+  bar_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapOutWireFormat.bar)
+}
+inline std::string* MapOutWireFormat::mutable_bar() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapOutWireFormat.bar)
+  return bar_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapOutWireFormat::release_bar() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapOutWireFormat.bar)
+  
+  return bar_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapOutWireFormat::set_allocated_bar(std::string* bar) {
+  if (bar != nullptr) {
+    
+  } else {
+    
+  }
+  bar_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bar);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapOutWireFormat.bar)
+}
+
+// -------------------------------------------------------------------
+
+// MapM
+
+// string foo = 1;
+inline void MapM::clear_foo() {
+  foo_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& MapM::foo() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.MapM.foo)
+  return foo_.GetNoArena();
+}
+inline void MapM::set_foo(const std::string& value) {
+  
+  foo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.MapM.foo)
+}
+inline void MapM::set_foo(std::string&& value) {
+  
+  foo_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.MapM.foo)
+}
+inline void MapM::set_foo(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  foo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.MapM.foo)
+}
+inline void MapM::set_foo(const char* value, size_t size) {
+  
+  foo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.MapM.foo)
+}
+inline std::string* MapM::mutable_foo() {
+  
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.MapM.foo)
+  return foo_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* MapM::release_foo() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.MapM.foo)
+  
+  return foo_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void MapM::set_allocated_foo(std::string* foo) {
+  if (foo != nullptr) {
+    
+  } else {
+    
+  }
+  foo_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), foo);
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.MapM.foo)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto_util_converter::testing::Mixed2_E> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto_util_converter::testing::Mixed2_E>() {
+  return ::proto_util_converter::testing::Mixed2_E_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fmaps_2eproto
@@ -0,0 +1,4274 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/wrappers.proto
+
+#include "google/protobuf/util/internal/testdata/wrappers.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class WrappersTestCasesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<WrappersTestCases> _instance;
+} _WrappersTestCases_default_instance_;
+class DoubleWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DoubleWrapper> _instance;
+} _DoubleWrapper_default_instance_;
+class FloatWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FloatWrapper> _instance;
+} _FloatWrapper_default_instance_;
+class Int64WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Int64Wrapper> _instance;
+} _Int64Wrapper_default_instance_;
+class UInt64WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UInt64Wrapper> _instance;
+} _UInt64Wrapper_default_instance_;
+class Int32WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Int32Wrapper> _instance;
+} _Int32Wrapper_default_instance_;
+class UInt32WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UInt32Wrapper> _instance;
+} _UInt32Wrapper_default_instance_;
+class BoolWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BoolWrapper> _instance;
+} _BoolWrapper_default_instance_;
+class StringWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StringWrapper> _instance;
+} _StringWrapper_default_instance_;
+class BytesWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BytesWrapper> _instance;
+} _BytesWrapper_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+static void InitDefaultsWrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_WrappersTestCases_default_instance_;
+    new (ptr) ::proto_util_converter::testing::WrappersTestCases();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::WrappersTestCases::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<9> scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 9, InitDefaultsWrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsDoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_DoubleWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::DoubleWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::DoubleWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsDoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsFloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_FloatWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::FloatWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::FloatWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsFloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Int64Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Int64Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Int64Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsUInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_UInt64Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::UInt64Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::UInt64Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsUInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Int32Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Int32Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Int32Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsUInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_UInt32Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::UInt32Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::UInt32Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsUInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsBoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_BoolWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::BoolWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::BoolWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsBoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsStringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_StringWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::StringWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::StringWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsStringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsBytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_BytesWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::BytesWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::BytesWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsBytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+void InitDefaults_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+}
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[10];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, double_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, float_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int64_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint64_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int32_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint32_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bool_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, string_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bytes_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, double_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, float_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int64_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint64_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int32_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint32_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bool_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, string_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bytes_wrapper_default_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::DoubleWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::DoubleWrapper, double__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::FloatWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::FloatWrapper, float__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int64Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int64Wrapper, int64_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt64Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt64Wrapper, uint64_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int32Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int32Wrapper, int32_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt32Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt32Wrapper, uint32_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BoolWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BoolWrapper, bool__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StringWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StringWrapper, string_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BytesWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BytesWrapper, bytes_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto_util_converter::testing::WrappersTestCases)},
+  { 23, -1, sizeof(::proto_util_converter::testing::DoubleWrapper)},
+  { 29, -1, sizeof(::proto_util_converter::testing::FloatWrapper)},
+  { 35, -1, sizeof(::proto_util_converter::testing::Int64Wrapper)},
+  { 41, -1, sizeof(::proto_util_converter::testing::UInt64Wrapper)},
+  { 47, -1, sizeof(::proto_util_converter::testing::Int32Wrapper)},
+  { 53, -1, sizeof(::proto_util_converter::testing::UInt32Wrapper)},
+  { 59, -1, sizeof(::proto_util_converter::testing::BoolWrapper)},
+  { 65, -1, sizeof(::proto_util_converter::testing::StringWrapper)},
+  { 71, -1, sizeof(::proto_util_converter::testing::BytesWrapper)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_WrappersTestCases_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_DoubleWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_FloatWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Int64Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_UInt64Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Int32Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_UInt32Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_BoolWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_StringWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_BytesWrapper_default_instance_),
+};
+
+static ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptorsTable assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = {
+  {}, AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, "google/protobuf/util/internal/testdata/wrappers.proto", schemas,
+  file_default_instances, TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, 10, file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto,
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[] =
+  "\n5google/protobuf/util/internal/testdata"
+  "/wrappers.proto\022\034proto_util_converter.te"
+  "sting\032\036google/protobuf/wrappers.proto\"\235\n"
+  "\n\021WrappersTestCases\022C\n\016double_wrapper\030\001 "
+  "\001(\0132+.proto_util_converter.testing.Doubl"
+  "eWrapper\022A\n\rfloat_wrapper\030\002 \001(\0132*.proto_"
+  "util_converter.testing.FloatWrapper\022A\n\ri"
+  "nt64_wrapper\030\003 \001(\0132*.proto_util_converte"
+  "r.testing.Int64Wrapper\022C\n\016uint64_wrapper"
+  "\030\004 \001(\0132+.proto_util_converter.testing.UI"
+  "nt64Wrapper\022A\n\rint32_wrapper\030\005 \001(\0132*.pro"
+  "to_util_converter.testing.Int32Wrapper\022C"
+  "\n\016uint32_wrapper\030\006 \001(\0132+.proto_util_conv"
+  "erter.testing.UInt32Wrapper\022\?\n\014bool_wrap"
+  "per\030\007 \001(\0132).proto_util_converter.testing"
+  ".BoolWrapper\022C\n\016string_wrapper\030\010 \001(\0132+.p"
+  "roto_util_converter.testing.StringWrappe"
+  "r\022A\n\rbytes_wrapper\030\t \001(\0132*.proto_util_co"
+  "nverter.testing.BytesWrapper\022K\n\026double_w"
+  "rapper_default\030\n \001(\0132+.proto_util_conver"
+  "ter.testing.DoubleWrapper\022I\n\025float_wrapp"
+  "er_default\030\013 \001(\0132*.proto_util_converter."
+  "testing.FloatWrapper\022I\n\025int64_wrapper_de"
+  "fault\030\014 \001(\0132*.proto_util_converter.testi"
+  "ng.Int64Wrapper\022K\n\026uint64_wrapper_defaul"
+  "t\030\r \001(\0132+.proto_util_converter.testing.U"
+  "Int64Wrapper\022I\n\025int32_wrapper_default\030\016 "
+  "\001(\0132*.proto_util_converter.testing.Int32"
+  "Wrapper\022K\n\026uint32_wrapper_default\030\017 \001(\0132"
+  "+.proto_util_converter.testing.UInt32Wra"
+  "pper\022G\n\024bool_wrapper_default\030\020 \001(\0132).pro"
+  "to_util_converter.testing.BoolWrapper\022K\n"
+  "\026string_wrapper_default\030\021 \001(\0132+.proto_ut"
+  "il_converter.testing.StringWrapper\022I\n\025by"
+  "tes_wrapper_default\030\022 \001(\0132*.proto_util_c"
+  "onverter.testing.BytesWrapper\"=\n\rDoubleW"
+  "rapper\022,\n\006double\030\001 \001(\0132\034.google.protobuf"
+  ".DoubleValue\":\n\014FloatWrapper\022*\n\005float\030\001 "
+  "\001(\0132\033.google.protobuf.FloatValue\":\n\014Int6"
+  "4Wrapper\022*\n\005int64\030\001 \001(\0132\033.google.protobu"
+  "f.Int64Value\"=\n\rUInt64Wrapper\022,\n\006uint64\030"
+  "\001 \001(\0132\034.google.protobuf.UInt64Value\":\n\014I"
+  "nt32Wrapper\022*\n\005int32\030\001 \001(\0132\033.google.prot"
+  "obuf.Int32Value\"=\n\rUInt32Wrapper\022,\n\006uint"
+  "32\030\001 \001(\0132\034.google.protobuf.UInt32Value\"7"
+  "\n\013BoolWrapper\022(\n\004bool\030\001 \001(\0132\032.google.pro"
+  "tobuf.BoolValue\"=\n\rStringWrapper\022,\n\006stri"
+  "ng\030\001 \001(\0132\034.google.protobuf.StringValue\":"
+  "\n\014BytesWrapper\022*\n\005bytes\030\001 \001(\0132\033.google.p"
+  "rotobuf.BytesValue2\177\n\023WrappersTestServic"
+  "e\022h\n\004Call\022/.proto_util_converter.testing"
+  ".WrappersTestCases\032/.proto_util_converte"
+  "r.testing.WrappersTestCasesb\006proto3"
+  ;
+static ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = {
+  false, InitDefaults_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, 
+  descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto,
+  "google/protobuf/util/internal/testdata/wrappers.proto", &assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, 2115,
+};
+
+void AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  static constexpr ::PROTOBUF_NAMESPACE_ID::internal::InitFunc deps[1] =
+  {
+    ::AddDescriptors_google_2fprotobuf_2fwrappers_2eproto,
+  };
+ ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, deps, 1);
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = []() { AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto(); return true; }();
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+void WrappersTestCases::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->double_wrapper_ = const_cast< ::proto_util_converter::testing::DoubleWrapper*>(
+      ::proto_util_converter::testing::DoubleWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->float_wrapper_ = const_cast< ::proto_util_converter::testing::FloatWrapper*>(
+      ::proto_util_converter::testing::FloatWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int64_wrapper_ = const_cast< ::proto_util_converter::testing::Int64Wrapper*>(
+      ::proto_util_converter::testing::Int64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint64_wrapper_ = const_cast< ::proto_util_converter::testing::UInt64Wrapper*>(
+      ::proto_util_converter::testing::UInt64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int32_wrapper_ = const_cast< ::proto_util_converter::testing::Int32Wrapper*>(
+      ::proto_util_converter::testing::Int32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint32_wrapper_ = const_cast< ::proto_util_converter::testing::UInt32Wrapper*>(
+      ::proto_util_converter::testing::UInt32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bool_wrapper_ = const_cast< ::proto_util_converter::testing::BoolWrapper*>(
+      ::proto_util_converter::testing::BoolWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->string_wrapper_ = const_cast< ::proto_util_converter::testing::StringWrapper*>(
+      ::proto_util_converter::testing::StringWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bytes_wrapper_ = const_cast< ::proto_util_converter::testing::BytesWrapper*>(
+      ::proto_util_converter::testing::BytesWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->double_wrapper_default_ = const_cast< ::proto_util_converter::testing::DoubleWrapper*>(
+      ::proto_util_converter::testing::DoubleWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->float_wrapper_default_ = const_cast< ::proto_util_converter::testing::FloatWrapper*>(
+      ::proto_util_converter::testing::FloatWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int64_wrapper_default_ = const_cast< ::proto_util_converter::testing::Int64Wrapper*>(
+      ::proto_util_converter::testing::Int64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint64_wrapper_default_ = const_cast< ::proto_util_converter::testing::UInt64Wrapper*>(
+      ::proto_util_converter::testing::UInt64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int32_wrapper_default_ = const_cast< ::proto_util_converter::testing::Int32Wrapper*>(
+      ::proto_util_converter::testing::Int32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint32_wrapper_default_ = const_cast< ::proto_util_converter::testing::UInt32Wrapper*>(
+      ::proto_util_converter::testing::UInt32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bool_wrapper_default_ = const_cast< ::proto_util_converter::testing::BoolWrapper*>(
+      ::proto_util_converter::testing::BoolWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->string_wrapper_default_ = const_cast< ::proto_util_converter::testing::StringWrapper*>(
+      ::proto_util_converter::testing::StringWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bytes_wrapper_default_ = const_cast< ::proto_util_converter::testing::BytesWrapper*>(
+      ::proto_util_converter::testing::BytesWrapper::internal_default_instance());
+}
+class WrappersTestCases::HasBitSetters {
+ public:
+  static const ::proto_util_converter::testing::DoubleWrapper& double_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::FloatWrapper& float_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int64Wrapper& int64_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt64Wrapper& uint64_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int32Wrapper& int32_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt32Wrapper& uint32_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BoolWrapper& bool_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::StringWrapper& string_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BytesWrapper& bytes_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::DoubleWrapper& double_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::FloatWrapper& float_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int64Wrapper& int64_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt64Wrapper& uint64_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int32Wrapper& int32_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt32Wrapper& uint32_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BoolWrapper& bool_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::StringWrapper& string_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BytesWrapper& bytes_wrapper_default(const WrappersTestCases* msg);
+};
+
+const ::proto_util_converter::testing::DoubleWrapper&
+WrappersTestCases::HasBitSetters::double_wrapper(const WrappersTestCases* msg) {
+  return *msg->double_wrapper_;
+}
+const ::proto_util_converter::testing::FloatWrapper&
+WrappersTestCases::HasBitSetters::float_wrapper(const WrappersTestCases* msg) {
+  return *msg->float_wrapper_;
+}
+const ::proto_util_converter::testing::Int64Wrapper&
+WrappersTestCases::HasBitSetters::int64_wrapper(const WrappersTestCases* msg) {
+  return *msg->int64_wrapper_;
+}
+const ::proto_util_converter::testing::UInt64Wrapper&
+WrappersTestCases::HasBitSetters::uint64_wrapper(const WrappersTestCases* msg) {
+  return *msg->uint64_wrapper_;
+}
+const ::proto_util_converter::testing::Int32Wrapper&
+WrappersTestCases::HasBitSetters::int32_wrapper(const WrappersTestCases* msg) {
+  return *msg->int32_wrapper_;
+}
+const ::proto_util_converter::testing::UInt32Wrapper&
+WrappersTestCases::HasBitSetters::uint32_wrapper(const WrappersTestCases* msg) {
+  return *msg->uint32_wrapper_;
+}
+const ::proto_util_converter::testing::BoolWrapper&
+WrappersTestCases::HasBitSetters::bool_wrapper(const WrappersTestCases* msg) {
+  return *msg->bool_wrapper_;
+}
+const ::proto_util_converter::testing::StringWrapper&
+WrappersTestCases::HasBitSetters::string_wrapper(const WrappersTestCases* msg) {
+  return *msg->string_wrapper_;
+}
+const ::proto_util_converter::testing::BytesWrapper&
+WrappersTestCases::HasBitSetters::bytes_wrapper(const WrappersTestCases* msg) {
+  return *msg->bytes_wrapper_;
+}
+const ::proto_util_converter::testing::DoubleWrapper&
+WrappersTestCases::HasBitSetters::double_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->double_wrapper_default_;
+}
+const ::proto_util_converter::testing::FloatWrapper&
+WrappersTestCases::HasBitSetters::float_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->float_wrapper_default_;
+}
+const ::proto_util_converter::testing::Int64Wrapper&
+WrappersTestCases::HasBitSetters::int64_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->int64_wrapper_default_;
+}
+const ::proto_util_converter::testing::UInt64Wrapper&
+WrappersTestCases::HasBitSetters::uint64_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->uint64_wrapper_default_;
+}
+const ::proto_util_converter::testing::Int32Wrapper&
+WrappersTestCases::HasBitSetters::int32_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->int32_wrapper_default_;
+}
+const ::proto_util_converter::testing::UInt32Wrapper&
+WrappersTestCases::HasBitSetters::uint32_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->uint32_wrapper_default_;
+}
+const ::proto_util_converter::testing::BoolWrapper&
+WrappersTestCases::HasBitSetters::bool_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->bool_wrapper_default_;
+}
+const ::proto_util_converter::testing::StringWrapper&
+WrappersTestCases::HasBitSetters::string_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->string_wrapper_default_;
+}
+const ::proto_util_converter::testing::BytesWrapper&
+WrappersTestCases::HasBitSetters::bytes_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->bytes_wrapper_default_;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int WrappersTestCases::kDoubleWrapperFieldNumber;
+const int WrappersTestCases::kFloatWrapperFieldNumber;
+const int WrappersTestCases::kInt64WrapperFieldNumber;
+const int WrappersTestCases::kUint64WrapperFieldNumber;
+const int WrappersTestCases::kInt32WrapperFieldNumber;
+const int WrappersTestCases::kUint32WrapperFieldNumber;
+const int WrappersTestCases::kBoolWrapperFieldNumber;
+const int WrappersTestCases::kStringWrapperFieldNumber;
+const int WrappersTestCases::kBytesWrapperFieldNumber;
+const int WrappersTestCases::kDoubleWrapperDefaultFieldNumber;
+const int WrappersTestCases::kFloatWrapperDefaultFieldNumber;
+const int WrappersTestCases::kInt64WrapperDefaultFieldNumber;
+const int WrappersTestCases::kUint64WrapperDefaultFieldNumber;
+const int WrappersTestCases::kInt32WrapperDefaultFieldNumber;
+const int WrappersTestCases::kUint32WrapperDefaultFieldNumber;
+const int WrappersTestCases::kBoolWrapperDefaultFieldNumber;
+const int WrappersTestCases::kStringWrapperDefaultFieldNumber;
+const int WrappersTestCases::kBytesWrapperDefaultFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+WrappersTestCases::WrappersTestCases()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.WrappersTestCases)
+}
+WrappersTestCases::WrappersTestCases(const WrappersTestCases& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_double_wrapper()) {
+    double_wrapper_ = new ::proto_util_converter::testing::DoubleWrapper(*from.double_wrapper_);
+  } else {
+    double_wrapper_ = nullptr;
+  }
+  if (from.has_float_wrapper()) {
+    float_wrapper_ = new ::proto_util_converter::testing::FloatWrapper(*from.float_wrapper_);
+  } else {
+    float_wrapper_ = nullptr;
+  }
+  if (from.has_int64_wrapper()) {
+    int64_wrapper_ = new ::proto_util_converter::testing::Int64Wrapper(*from.int64_wrapper_);
+  } else {
+    int64_wrapper_ = nullptr;
+  }
+  if (from.has_uint64_wrapper()) {
+    uint64_wrapper_ = new ::proto_util_converter::testing::UInt64Wrapper(*from.uint64_wrapper_);
+  } else {
+    uint64_wrapper_ = nullptr;
+  }
+  if (from.has_int32_wrapper()) {
+    int32_wrapper_ = new ::proto_util_converter::testing::Int32Wrapper(*from.int32_wrapper_);
+  } else {
+    int32_wrapper_ = nullptr;
+  }
+  if (from.has_uint32_wrapper()) {
+    uint32_wrapper_ = new ::proto_util_converter::testing::UInt32Wrapper(*from.uint32_wrapper_);
+  } else {
+    uint32_wrapper_ = nullptr;
+  }
+  if (from.has_bool_wrapper()) {
+    bool_wrapper_ = new ::proto_util_converter::testing::BoolWrapper(*from.bool_wrapper_);
+  } else {
+    bool_wrapper_ = nullptr;
+  }
+  if (from.has_string_wrapper()) {
+    string_wrapper_ = new ::proto_util_converter::testing::StringWrapper(*from.string_wrapper_);
+  } else {
+    string_wrapper_ = nullptr;
+  }
+  if (from.has_bytes_wrapper()) {
+    bytes_wrapper_ = new ::proto_util_converter::testing::BytesWrapper(*from.bytes_wrapper_);
+  } else {
+    bytes_wrapper_ = nullptr;
+  }
+  if (from.has_double_wrapper_default()) {
+    double_wrapper_default_ = new ::proto_util_converter::testing::DoubleWrapper(*from.double_wrapper_default_);
+  } else {
+    double_wrapper_default_ = nullptr;
+  }
+  if (from.has_float_wrapper_default()) {
+    float_wrapper_default_ = new ::proto_util_converter::testing::FloatWrapper(*from.float_wrapper_default_);
+  } else {
+    float_wrapper_default_ = nullptr;
+  }
+  if (from.has_int64_wrapper_default()) {
+    int64_wrapper_default_ = new ::proto_util_converter::testing::Int64Wrapper(*from.int64_wrapper_default_);
+  } else {
+    int64_wrapper_default_ = nullptr;
+  }
+  if (from.has_uint64_wrapper_default()) {
+    uint64_wrapper_default_ = new ::proto_util_converter::testing::UInt64Wrapper(*from.uint64_wrapper_default_);
+  } else {
+    uint64_wrapper_default_ = nullptr;
+  }
+  if (from.has_int32_wrapper_default()) {
+    int32_wrapper_default_ = new ::proto_util_converter::testing::Int32Wrapper(*from.int32_wrapper_default_);
+  } else {
+    int32_wrapper_default_ = nullptr;
+  }
+  if (from.has_uint32_wrapper_default()) {
+    uint32_wrapper_default_ = new ::proto_util_converter::testing::UInt32Wrapper(*from.uint32_wrapper_default_);
+  } else {
+    uint32_wrapper_default_ = nullptr;
+  }
+  if (from.has_bool_wrapper_default()) {
+    bool_wrapper_default_ = new ::proto_util_converter::testing::BoolWrapper(*from.bool_wrapper_default_);
+  } else {
+    bool_wrapper_default_ = nullptr;
+  }
+  if (from.has_string_wrapper_default()) {
+    string_wrapper_default_ = new ::proto_util_converter::testing::StringWrapper(*from.string_wrapper_default_);
+  } else {
+    string_wrapper_default_ = nullptr;
+  }
+  if (from.has_bytes_wrapper_default()) {
+    bytes_wrapper_default_ = new ::proto_util_converter::testing::BytesWrapper(*from.bytes_wrapper_default_);
+  } else {
+    bytes_wrapper_default_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.WrappersTestCases)
+}
+
+void WrappersTestCases::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::memset(&double_wrapper_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bytes_wrapper_default_) -
+      reinterpret_cast<char*>(&double_wrapper_)) + sizeof(bytes_wrapper_default_));
+}
+
+WrappersTestCases::~WrappersTestCases() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.WrappersTestCases)
+  SharedDtor();
+}
+
+void WrappersTestCases::SharedDtor() {
+  if (this != internal_default_instance()) delete double_wrapper_;
+  if (this != internal_default_instance()) delete float_wrapper_;
+  if (this != internal_default_instance()) delete int64_wrapper_;
+  if (this != internal_default_instance()) delete uint64_wrapper_;
+  if (this != internal_default_instance()) delete int32_wrapper_;
+  if (this != internal_default_instance()) delete uint32_wrapper_;
+  if (this != internal_default_instance()) delete bool_wrapper_;
+  if (this != internal_default_instance()) delete string_wrapper_;
+  if (this != internal_default_instance()) delete bytes_wrapper_;
+  if (this != internal_default_instance()) delete double_wrapper_default_;
+  if (this != internal_default_instance()) delete float_wrapper_default_;
+  if (this != internal_default_instance()) delete int64_wrapper_default_;
+  if (this != internal_default_instance()) delete uint64_wrapper_default_;
+  if (this != internal_default_instance()) delete int32_wrapper_default_;
+  if (this != internal_default_instance()) delete uint32_wrapper_default_;
+  if (this != internal_default_instance()) delete bool_wrapper_default_;
+  if (this != internal_default_instance()) delete string_wrapper_default_;
+  if (this != internal_default_instance()) delete bytes_wrapper_default_;
+}
+
+void WrappersTestCases::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const WrappersTestCases& WrappersTestCases::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void WrappersTestCases::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.WrappersTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && double_wrapper_ != nullptr) {
+    delete double_wrapper_;
+  }
+  double_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && float_wrapper_ != nullptr) {
+    delete float_wrapper_;
+  }
+  float_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && int64_wrapper_ != nullptr) {
+    delete int64_wrapper_;
+  }
+  int64_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && uint64_wrapper_ != nullptr) {
+    delete uint64_wrapper_;
+  }
+  uint64_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && int32_wrapper_ != nullptr) {
+    delete int32_wrapper_;
+  }
+  int32_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && uint32_wrapper_ != nullptr) {
+    delete uint32_wrapper_;
+  }
+  uint32_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && bool_wrapper_ != nullptr) {
+    delete bool_wrapper_;
+  }
+  bool_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && string_wrapper_ != nullptr) {
+    delete string_wrapper_;
+  }
+  string_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && bytes_wrapper_ != nullptr) {
+    delete bytes_wrapper_;
+  }
+  bytes_wrapper_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && double_wrapper_default_ != nullptr) {
+    delete double_wrapper_default_;
+  }
+  double_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && float_wrapper_default_ != nullptr) {
+    delete float_wrapper_default_;
+  }
+  float_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && int64_wrapper_default_ != nullptr) {
+    delete int64_wrapper_default_;
+  }
+  int64_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && uint64_wrapper_default_ != nullptr) {
+    delete uint64_wrapper_default_;
+  }
+  uint64_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && int32_wrapper_default_ != nullptr) {
+    delete int32_wrapper_default_;
+  }
+  int32_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && uint32_wrapper_default_ != nullptr) {
+    delete uint32_wrapper_default_;
+  }
+  uint32_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && bool_wrapper_default_ != nullptr) {
+    delete bool_wrapper_default_;
+  }
+  bool_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && string_wrapper_default_ != nullptr) {
+    delete string_wrapper_default_;
+  }
+  string_wrapper_default_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && bytes_wrapper_default_ != nullptr) {
+    delete bytes_wrapper_default_;
+  }
+  bytes_wrapper_default_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* WrappersTestCases::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_double_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+      case 2: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 18) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_float_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+      case 3: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 26) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_int64_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+      case 4: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 34) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_uint64_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+      case 5: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 42) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_int32_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+      case 6: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 50) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_uint32_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+      case 7: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 58) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_bool_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+      case 8: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 66) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_string_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+      case 9: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 74) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_bytes_wrapper(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+      case 10: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 82) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_double_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+      case 11: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 90) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_float_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+      case 12: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 98) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_int64_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+      case 13: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 106) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_uint64_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+      case 14: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 114) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_int32_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+      case 15: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 122) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_uint32_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+      case 16: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 130) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_bool_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+      case 17: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 138) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_string_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+      case 18: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 146) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_bytes_wrapper_default(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool WrappersTestCases::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.WrappersTestCases)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_double_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_float_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_int64_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_uint64_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_int32_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_uint32_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (58 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_bool_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+      case 8: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (66 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_string_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+      case 9: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (74 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_bytes_wrapper()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+      case 10: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (82 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_double_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+      case 11: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (90 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_float_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+      case 12: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (98 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_int64_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+      case 13: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (106 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_uint64_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+      case 14: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (114 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_int32_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+      case 15: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (122 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_uint32_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+      case 16: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (130 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_bool_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+      case 17: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (138 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_string_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+      case 18: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (146 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_bytes_wrapper_default()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.WrappersTestCases)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.WrappersTestCases)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void WrappersTestCases::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.WrappersTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+  if (this->has_double_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::double_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+  if (this->has_float_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, HasBitSetters::float_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+  if (this->has_int64_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, HasBitSetters::int64_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+  if (this->has_uint64_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, HasBitSetters::uint64_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+  if (this->has_int32_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, HasBitSetters::int32_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+  if (this->has_uint32_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, HasBitSetters::uint32_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+  if (this->has_bool_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, HasBitSetters::bool_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+  if (this->has_string_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, HasBitSetters::string_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+  if (this->has_bytes_wrapper()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      9, HasBitSetters::bytes_wrapper(this), output);
+  }
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+  if (this->has_double_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, HasBitSetters::double_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+  if (this->has_float_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, HasBitSetters::float_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+  if (this->has_int64_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      12, HasBitSetters::int64_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+  if (this->has_uint64_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      13, HasBitSetters::uint64_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+  if (this->has_int32_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      14, HasBitSetters::int32_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+  if (this->has_uint32_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      15, HasBitSetters::uint32_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+  if (this->has_bool_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      16, HasBitSetters::bool_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+  if (this->has_string_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      17, HasBitSetters::string_wrapper_default(this), output);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+  if (this->has_bytes_wrapper_default()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      18, HasBitSetters::bytes_wrapper_default(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.WrappersTestCases)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* WrappersTestCases::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.WrappersTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+  if (this->has_double_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::double_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+  if (this->has_float_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        2, HasBitSetters::float_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+  if (this->has_int64_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        3, HasBitSetters::int64_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+  if (this->has_uint64_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        4, HasBitSetters::uint64_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+  if (this->has_int32_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        5, HasBitSetters::int32_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+  if (this->has_uint32_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        6, HasBitSetters::uint32_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+  if (this->has_bool_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, HasBitSetters::bool_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+  if (this->has_string_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        8, HasBitSetters::string_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+  if (this->has_bytes_wrapper()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        9, HasBitSetters::bytes_wrapper(this), target);
+  }
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+  if (this->has_double_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        10, HasBitSetters::double_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+  if (this->has_float_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        11, HasBitSetters::float_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+  if (this->has_int64_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        12, HasBitSetters::int64_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+  if (this->has_uint64_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        13, HasBitSetters::uint64_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+  if (this->has_int32_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        14, HasBitSetters::int32_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+  if (this->has_uint32_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        15, HasBitSetters::uint32_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+  if (this->has_bool_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        16, HasBitSetters::bool_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+  if (this->has_string_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        17, HasBitSetters::string_wrapper_default(this), target);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+  if (this->has_bytes_wrapper_default()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        18, HasBitSetters::bytes_wrapper_default(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.WrappersTestCases)
+  return target;
+}
+
+size_t WrappersTestCases::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.WrappersTestCases)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+  if (this->has_double_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double_wrapper_);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+  if (this->has_float_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float_wrapper_);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+  if (this->has_int64_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_wrapper_);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+  if (this->has_uint64_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_wrapper_);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+  if (this->has_int32_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_wrapper_);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+  if (this->has_uint32_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_wrapper_);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+  if (this->has_bool_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool_wrapper_);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+  if (this->has_string_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_wrapper_);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+  if (this->has_bytes_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_wrapper_);
+  }
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+  if (this->has_double_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+  if (this->has_float_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+  if (this->has_int64_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+  if (this->has_uint64_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+  if (this->has_int32_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+  if (this->has_uint32_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+  if (this->has_bool_wrapper_default()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+  if (this->has_string_wrapper_default()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+  if (this->has_bytes_wrapper_default()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_wrapper_default_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void WrappersTestCases::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.WrappersTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  const WrappersTestCases* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<WrappersTestCases>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.WrappersTestCases)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.WrappersTestCases)
+    MergeFrom(*source);
+  }
+}
+
+void WrappersTestCases::MergeFrom(const WrappersTestCases& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.WrappersTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_double_wrapper()) {
+    mutable_double_wrapper()->::proto_util_converter::testing::DoubleWrapper::MergeFrom(from.double_wrapper());
+  }
+  if (from.has_float_wrapper()) {
+    mutable_float_wrapper()->::proto_util_converter::testing::FloatWrapper::MergeFrom(from.float_wrapper());
+  }
+  if (from.has_int64_wrapper()) {
+    mutable_int64_wrapper()->::proto_util_converter::testing::Int64Wrapper::MergeFrom(from.int64_wrapper());
+  }
+  if (from.has_uint64_wrapper()) {
+    mutable_uint64_wrapper()->::proto_util_converter::testing::UInt64Wrapper::MergeFrom(from.uint64_wrapper());
+  }
+  if (from.has_int32_wrapper()) {
+    mutable_int32_wrapper()->::proto_util_converter::testing::Int32Wrapper::MergeFrom(from.int32_wrapper());
+  }
+  if (from.has_uint32_wrapper()) {
+    mutable_uint32_wrapper()->::proto_util_converter::testing::UInt32Wrapper::MergeFrom(from.uint32_wrapper());
+  }
+  if (from.has_bool_wrapper()) {
+    mutable_bool_wrapper()->::proto_util_converter::testing::BoolWrapper::MergeFrom(from.bool_wrapper());
+  }
+  if (from.has_string_wrapper()) {
+    mutable_string_wrapper()->::proto_util_converter::testing::StringWrapper::MergeFrom(from.string_wrapper());
+  }
+  if (from.has_bytes_wrapper()) {
+    mutable_bytes_wrapper()->::proto_util_converter::testing::BytesWrapper::MergeFrom(from.bytes_wrapper());
+  }
+  if (from.has_double_wrapper_default()) {
+    mutable_double_wrapper_default()->::proto_util_converter::testing::DoubleWrapper::MergeFrom(from.double_wrapper_default());
+  }
+  if (from.has_float_wrapper_default()) {
+    mutable_float_wrapper_default()->::proto_util_converter::testing::FloatWrapper::MergeFrom(from.float_wrapper_default());
+  }
+  if (from.has_int64_wrapper_default()) {
+    mutable_int64_wrapper_default()->::proto_util_converter::testing::Int64Wrapper::MergeFrom(from.int64_wrapper_default());
+  }
+  if (from.has_uint64_wrapper_default()) {
+    mutable_uint64_wrapper_default()->::proto_util_converter::testing::UInt64Wrapper::MergeFrom(from.uint64_wrapper_default());
+  }
+  if (from.has_int32_wrapper_default()) {
+    mutable_int32_wrapper_default()->::proto_util_converter::testing::Int32Wrapper::MergeFrom(from.int32_wrapper_default());
+  }
+  if (from.has_uint32_wrapper_default()) {
+    mutable_uint32_wrapper_default()->::proto_util_converter::testing::UInt32Wrapper::MergeFrom(from.uint32_wrapper_default());
+  }
+  if (from.has_bool_wrapper_default()) {
+    mutable_bool_wrapper_default()->::proto_util_converter::testing::BoolWrapper::MergeFrom(from.bool_wrapper_default());
+  }
+  if (from.has_string_wrapper_default()) {
+    mutable_string_wrapper_default()->::proto_util_converter::testing::StringWrapper::MergeFrom(from.string_wrapper_default());
+  }
+  if (from.has_bytes_wrapper_default()) {
+    mutable_bytes_wrapper_default()->::proto_util_converter::testing::BytesWrapper::MergeFrom(from.bytes_wrapper_default());
+  }
+}
+
+void WrappersTestCases::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.WrappersTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void WrappersTestCases::CopyFrom(const WrappersTestCases& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.WrappersTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WrappersTestCases::IsInitialized() const {
+  return true;
+}
+
+void WrappersTestCases::Swap(WrappersTestCases* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void WrappersTestCases::InternalSwap(WrappersTestCases* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(double_wrapper_, other->double_wrapper_);
+  swap(float_wrapper_, other->float_wrapper_);
+  swap(int64_wrapper_, other->int64_wrapper_);
+  swap(uint64_wrapper_, other->uint64_wrapper_);
+  swap(int32_wrapper_, other->int32_wrapper_);
+  swap(uint32_wrapper_, other->uint32_wrapper_);
+  swap(bool_wrapper_, other->bool_wrapper_);
+  swap(string_wrapper_, other->string_wrapper_);
+  swap(bytes_wrapper_, other->bytes_wrapper_);
+  swap(double_wrapper_default_, other->double_wrapper_default_);
+  swap(float_wrapper_default_, other->float_wrapper_default_);
+  swap(int64_wrapper_default_, other->int64_wrapper_default_);
+  swap(uint64_wrapper_default_, other->uint64_wrapper_default_);
+  swap(int32_wrapper_default_, other->int32_wrapper_default_);
+  swap(uint32_wrapper_default_, other->uint32_wrapper_default_);
+  swap(bool_wrapper_default_, other->bool_wrapper_default_);
+  swap(string_wrapper_default_, other->string_wrapper_default_);
+  swap(bytes_wrapper_default_, other->bytes_wrapper_default_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WrappersTestCases::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void DoubleWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_DoubleWrapper_default_instance_._instance.get_mutable()->double__ = const_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      PROTOBUF_NAMESPACE_ID::DoubleValue::internal_default_instance());
+}
+class DoubleWrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::DoubleValue& double_(const DoubleWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::DoubleValue&
+DoubleWrapper::HasBitSetters::double_(const DoubleWrapper* msg) {
+  return *msg->double__;
+}
+void DoubleWrapper::clear_double_() {
+  if (GetArenaNoVirtual() == nullptr && double__ != nullptr) {
+    delete double__;
+  }
+  double__ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DoubleWrapper::kDoubleFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DoubleWrapper::DoubleWrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.DoubleWrapper)
+}
+DoubleWrapper::DoubleWrapper(const DoubleWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_double_()) {
+    double__ = new PROTOBUF_NAMESPACE_ID::DoubleValue(*from.double__);
+  } else {
+    double__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.DoubleWrapper)
+}
+
+void DoubleWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  double__ = nullptr;
+}
+
+DoubleWrapper::~DoubleWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.DoubleWrapper)
+  SharedDtor();
+}
+
+void DoubleWrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete double__;
+}
+
+void DoubleWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const DoubleWrapper& DoubleWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void DoubleWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.DoubleWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && double__ != nullptr) {
+    delete double__;
+  }
+  double__ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* DoubleWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.DoubleValue double = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_double_(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool DoubleWrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.DoubleWrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.DoubleValue double = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_double_()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.DoubleWrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.DoubleWrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void DoubleWrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.DoubleWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue double = 1;
+  if (this->has_double_()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::double_(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.DoubleWrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* DoubleWrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.DoubleWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue double = 1;
+  if (this->has_double_()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::double_(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.DoubleWrapper)
+  return target;
+}
+
+size_t DoubleWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.DoubleWrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue double = 1;
+  if (this->has_double_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double__);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DoubleWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.DoubleWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DoubleWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DoubleWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.DoubleWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.DoubleWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void DoubleWrapper::MergeFrom(const DoubleWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.DoubleWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_double_()) {
+    mutable_double_()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from.double_());
+  }
+}
+
+void DoubleWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.DoubleWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DoubleWrapper::CopyFrom(const DoubleWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.DoubleWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DoubleWrapper::IsInitialized() const {
+  return true;
+}
+
+void DoubleWrapper::Swap(DoubleWrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DoubleWrapper::InternalSwap(DoubleWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(double__, other->double__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DoubleWrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void FloatWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_FloatWrapper_default_instance_._instance.get_mutable()->float__ = const_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      PROTOBUF_NAMESPACE_ID::FloatValue::internal_default_instance());
+}
+class FloatWrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::FloatValue& float_(const FloatWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::FloatValue&
+FloatWrapper::HasBitSetters::float_(const FloatWrapper* msg) {
+  return *msg->float__;
+}
+void FloatWrapper::clear_float_() {
+  if (GetArenaNoVirtual() == nullptr && float__ != nullptr) {
+    delete float__;
+  }
+  float__ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int FloatWrapper::kFloatFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+FloatWrapper::FloatWrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.FloatWrapper)
+}
+FloatWrapper::FloatWrapper(const FloatWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_float_()) {
+    float__ = new PROTOBUF_NAMESPACE_ID::FloatValue(*from.float__);
+  } else {
+    float__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.FloatWrapper)
+}
+
+void FloatWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  float__ = nullptr;
+}
+
+FloatWrapper::~FloatWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.FloatWrapper)
+  SharedDtor();
+}
+
+void FloatWrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete float__;
+}
+
+void FloatWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const FloatWrapper& FloatWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void FloatWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.FloatWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && float__ != nullptr) {
+    delete float__;
+  }
+  float__ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* FloatWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.FloatValue float = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_float_(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool FloatWrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.FloatWrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.FloatValue float = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_float_()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.FloatWrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.FloatWrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void FloatWrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.FloatWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.FloatValue float = 1;
+  if (this->has_float_()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::float_(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.FloatWrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* FloatWrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.FloatWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.FloatValue float = 1;
+  if (this->has_float_()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::float_(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.FloatWrapper)
+  return target;
+}
+
+size_t FloatWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.FloatWrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.FloatValue float = 1;
+  if (this->has_float_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float__);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FloatWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.FloatWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const FloatWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FloatWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.FloatWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.FloatWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void FloatWrapper::MergeFrom(const FloatWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.FloatWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_float_()) {
+    mutable_float_()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from.float_());
+  }
+}
+
+void FloatWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.FloatWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void FloatWrapper::CopyFrom(const FloatWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.FloatWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FloatWrapper::IsInitialized() const {
+  return true;
+}
+
+void FloatWrapper::Swap(FloatWrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void FloatWrapper::InternalSwap(FloatWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(float__, other->float__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FloatWrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void Int64Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_Int64Wrapper_default_instance_._instance.get_mutable()->int64_ = const_cast< PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      PROTOBUF_NAMESPACE_ID::Int64Value::internal_default_instance());
+}
+class Int64Wrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Int64Value& int64(const Int64Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Int64Value&
+Int64Wrapper::HasBitSetters::int64(const Int64Wrapper* msg) {
+  return *msg->int64_;
+}
+void Int64Wrapper::clear_int64() {
+  if (GetArenaNoVirtual() == nullptr && int64_ != nullptr) {
+    delete int64_;
+  }
+  int64_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Int64Wrapper::kInt64FieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Int64Wrapper::Int64Wrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.Int64Wrapper)
+}
+Int64Wrapper::Int64Wrapper(const Int64Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_int64()) {
+    int64_ = new PROTOBUF_NAMESPACE_ID::Int64Value(*from.int64_);
+  } else {
+    int64_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Int64Wrapper)
+}
+
+void Int64Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  int64_ = nullptr;
+}
+
+Int64Wrapper::~Int64Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Int64Wrapper)
+  SharedDtor();
+}
+
+void Int64Wrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete int64_;
+}
+
+void Int64Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Int64Wrapper& Int64Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Int64Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Int64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && int64_ != nullptr) {
+    delete int64_;
+  }
+  int64_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* Int64Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Int64Value int64 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_int64(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool Int64Wrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.Int64Wrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.Int64Value int64 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_int64()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.Int64Wrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.Int64Wrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void Int64Wrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.Int64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int64Value int64 = 1;
+  if (this->has_int64()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::int64(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.Int64Wrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Int64Wrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Int64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int64Value int64 = 1;
+  if (this->has_int64()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::int64(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Int64Wrapper)
+  return target;
+}
+
+size_t Int64Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Int64Wrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int64Value int64 = 1;
+  if (this->has_int64()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Int64Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Int64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Int64Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Int64Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Int64Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Int64Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void Int64Wrapper::MergeFrom(const Int64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Int64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_int64()) {
+    mutable_int64()->PROTOBUF_NAMESPACE_ID::Int64Value::MergeFrom(from.int64());
+  }
+}
+
+void Int64Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Int64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Int64Wrapper::CopyFrom(const Int64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Int64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Int64Wrapper::IsInitialized() const {
+  return true;
+}
+
+void Int64Wrapper::Swap(Int64Wrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Int64Wrapper::InternalSwap(Int64Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(int64_, other->int64_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Int64Wrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void UInt64Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_UInt64Wrapper_default_instance_._instance.get_mutable()->uint64_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt64Value::internal_default_instance());
+}
+class UInt64Wrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64(const UInt64Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::UInt64Value&
+UInt64Wrapper::HasBitSetters::uint64(const UInt64Wrapper* msg) {
+  return *msg->uint64_;
+}
+void UInt64Wrapper::clear_uint64() {
+  if (GetArenaNoVirtual() == nullptr && uint64_ != nullptr) {
+    delete uint64_;
+  }
+  uint64_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int UInt64Wrapper::kUint64FieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+UInt64Wrapper::UInt64Wrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.UInt64Wrapper)
+}
+UInt64Wrapper::UInt64Wrapper(const UInt64Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_uint64()) {
+    uint64_ = new PROTOBUF_NAMESPACE_ID::UInt64Value(*from.uint64_);
+  } else {
+    uint64_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.UInt64Wrapper)
+}
+
+void UInt64Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  uint64_ = nullptr;
+}
+
+UInt64Wrapper::~UInt64Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.UInt64Wrapper)
+  SharedDtor();
+}
+
+void UInt64Wrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete uint64_;
+}
+
+void UInt64Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const UInt64Wrapper& UInt64Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void UInt64Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.UInt64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && uint64_ != nullptr) {
+    delete uint64_;
+  }
+  uint64_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* UInt64Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.UInt64Value uint64 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_uint64(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool UInt64Wrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.UInt64Wrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.UInt64Value uint64 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_uint64()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.UInt64Wrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.UInt64Wrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void UInt64Wrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.UInt64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt64Value uint64 = 1;
+  if (this->has_uint64()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::uint64(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.UInt64Wrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* UInt64Wrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.UInt64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt64Value uint64 = 1;
+  if (this->has_uint64()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::uint64(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.UInt64Wrapper)
+  return target;
+}
+
+size_t UInt64Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.UInt64Wrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt64Value uint64 = 1;
+  if (this->has_uint64()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void UInt64Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.UInt64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const UInt64Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UInt64Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.UInt64Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.UInt64Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void UInt64Wrapper::MergeFrom(const UInt64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.UInt64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_uint64()) {
+    mutable_uint64()->PROTOBUF_NAMESPACE_ID::UInt64Value::MergeFrom(from.uint64());
+  }
+}
+
+void UInt64Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.UInt64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void UInt64Wrapper::CopyFrom(const UInt64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.UInt64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UInt64Wrapper::IsInitialized() const {
+  return true;
+}
+
+void UInt64Wrapper::Swap(UInt64Wrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void UInt64Wrapper::InternalSwap(UInt64Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(uint64_, other->uint64_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UInt64Wrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void Int32Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_Int32Wrapper_default_instance_._instance.get_mutable()->int32_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+}
+class Int32Wrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& int32(const Int32Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+Int32Wrapper::HasBitSetters::int32(const Int32Wrapper* msg) {
+  return *msg->int32_;
+}
+void Int32Wrapper::clear_int32() {
+  if (GetArenaNoVirtual() == nullptr && int32_ != nullptr) {
+    delete int32_;
+  }
+  int32_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Int32Wrapper::kInt32FieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Int32Wrapper::Int32Wrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.Int32Wrapper)
+}
+Int32Wrapper::Int32Wrapper(const Int32Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_int32()) {
+    int32_ = new PROTOBUF_NAMESPACE_ID::Int32Value(*from.int32_);
+  } else {
+    int32_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Int32Wrapper)
+}
+
+void Int32Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  int32_ = nullptr;
+}
+
+Int32Wrapper::~Int32Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Int32Wrapper)
+  SharedDtor();
+}
+
+void Int32Wrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete int32_;
+}
+
+void Int32Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Int32Wrapper& Int32Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Int32Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Int32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && int32_ != nullptr) {
+    delete int32_;
+  }
+  int32_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* Int32Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Int32Value int32 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_int32(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool Int32Wrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.Int32Wrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.Int32Value int32 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_int32()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.Int32Wrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.Int32Wrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void Int32Wrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.Int32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int32Value int32 = 1;
+  if (this->has_int32()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::int32(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.Int32Wrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Int32Wrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Int32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int32Value int32 = 1;
+  if (this->has_int32()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::int32(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Int32Wrapper)
+  return target;
+}
+
+size_t Int32Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Int32Wrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int32Value int32 = 1;
+  if (this->has_int32()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Int32Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Int32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Int32Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Int32Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Int32Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Int32Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void Int32Wrapper::MergeFrom(const Int32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Int32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_int32()) {
+    mutable_int32()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from.int32());
+  }
+}
+
+void Int32Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Int32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Int32Wrapper::CopyFrom(const Int32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Int32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Int32Wrapper::IsInitialized() const {
+  return true;
+}
+
+void Int32Wrapper::Swap(Int32Wrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Int32Wrapper::InternalSwap(Int32Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(int32_, other->int32_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Int32Wrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void UInt32Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_UInt32Wrapper_default_instance_._instance.get_mutable()->uint32_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt32Value::internal_default_instance());
+}
+class UInt32Wrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32(const UInt32Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::UInt32Value&
+UInt32Wrapper::HasBitSetters::uint32(const UInt32Wrapper* msg) {
+  return *msg->uint32_;
+}
+void UInt32Wrapper::clear_uint32() {
+  if (GetArenaNoVirtual() == nullptr && uint32_ != nullptr) {
+    delete uint32_;
+  }
+  uint32_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int UInt32Wrapper::kUint32FieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+UInt32Wrapper::UInt32Wrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.UInt32Wrapper)
+}
+UInt32Wrapper::UInt32Wrapper(const UInt32Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_uint32()) {
+    uint32_ = new PROTOBUF_NAMESPACE_ID::UInt32Value(*from.uint32_);
+  } else {
+    uint32_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.UInt32Wrapper)
+}
+
+void UInt32Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  uint32_ = nullptr;
+}
+
+UInt32Wrapper::~UInt32Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.UInt32Wrapper)
+  SharedDtor();
+}
+
+void UInt32Wrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete uint32_;
+}
+
+void UInt32Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const UInt32Wrapper& UInt32Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void UInt32Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.UInt32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && uint32_ != nullptr) {
+    delete uint32_;
+  }
+  uint32_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* UInt32Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.UInt32Value uint32 = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_uint32(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool UInt32Wrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.UInt32Wrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.UInt32Value uint32 = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_uint32()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.UInt32Wrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.UInt32Wrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void UInt32Wrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.UInt32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt32Value uint32 = 1;
+  if (this->has_uint32()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::uint32(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.UInt32Wrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* UInt32Wrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.UInt32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt32Value uint32 = 1;
+  if (this->has_uint32()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::uint32(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.UInt32Wrapper)
+  return target;
+}
+
+size_t UInt32Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.UInt32Wrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt32Value uint32 = 1;
+  if (this->has_uint32()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void UInt32Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.UInt32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const UInt32Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UInt32Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.UInt32Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.UInt32Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void UInt32Wrapper::MergeFrom(const UInt32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.UInt32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_uint32()) {
+    mutable_uint32()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from.uint32());
+  }
+}
+
+void UInt32Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.UInt32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void UInt32Wrapper::CopyFrom(const UInt32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.UInt32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UInt32Wrapper::IsInitialized() const {
+  return true;
+}
+
+void UInt32Wrapper::Swap(UInt32Wrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void UInt32Wrapper::InternalSwap(UInt32Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(uint32_, other->uint32_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UInt32Wrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void BoolWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_BoolWrapper_default_instance_._instance.get_mutable()->bool__ = const_cast< PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      PROTOBUF_NAMESPACE_ID::BoolValue::internal_default_instance());
+}
+class BoolWrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::BoolValue& bool_(const BoolWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::BoolValue&
+BoolWrapper::HasBitSetters::bool_(const BoolWrapper* msg) {
+  return *msg->bool__;
+}
+void BoolWrapper::clear_bool_() {
+  if (GetArenaNoVirtual() == nullptr && bool__ != nullptr) {
+    delete bool__;
+  }
+  bool__ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int BoolWrapper::kBoolFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+BoolWrapper::BoolWrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.BoolWrapper)
+}
+BoolWrapper::BoolWrapper(const BoolWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_bool_()) {
+    bool__ = new PROTOBUF_NAMESPACE_ID::BoolValue(*from.bool__);
+  } else {
+    bool__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.BoolWrapper)
+}
+
+void BoolWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  bool__ = nullptr;
+}
+
+BoolWrapper::~BoolWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.BoolWrapper)
+  SharedDtor();
+}
+
+void BoolWrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete bool__;
+}
+
+void BoolWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BoolWrapper& BoolWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BoolWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.BoolWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && bool__ != nullptr) {
+    delete bool__;
+  }
+  bool__ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* BoolWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.BoolValue bool = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_bool_(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool BoolWrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.BoolWrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.BoolValue bool = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_bool_()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.BoolWrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.BoolWrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void BoolWrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.BoolWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BoolValue bool = 1;
+  if (this->has_bool_()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::bool_(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.BoolWrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BoolWrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.BoolWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BoolValue bool = 1;
+  if (this->has_bool_()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::bool_(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.BoolWrapper)
+  return target;
+}
+
+size_t BoolWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.BoolWrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.BoolValue bool = 1;
+  if (this->has_bool_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool__);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BoolWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.BoolWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BoolWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BoolWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.BoolWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.BoolWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void BoolWrapper::MergeFrom(const BoolWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.BoolWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_bool_()) {
+    mutable_bool_()->PROTOBUF_NAMESPACE_ID::BoolValue::MergeFrom(from.bool_());
+  }
+}
+
+void BoolWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.BoolWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BoolWrapper::CopyFrom(const BoolWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.BoolWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BoolWrapper::IsInitialized() const {
+  return true;
+}
+
+void BoolWrapper::Swap(BoolWrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void BoolWrapper::InternalSwap(BoolWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(bool__, other->bool__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BoolWrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void StringWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_StringWrapper_default_instance_._instance.get_mutable()->string_ = const_cast< PROTOBUF_NAMESPACE_ID::StringValue*>(
+      PROTOBUF_NAMESPACE_ID::StringValue::internal_default_instance());
+}
+class StringWrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::StringValue& string(const StringWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::StringValue&
+StringWrapper::HasBitSetters::string(const StringWrapper* msg) {
+  return *msg->string_;
+}
+void StringWrapper::clear_string() {
+  if (GetArenaNoVirtual() == nullptr && string_ != nullptr) {
+    delete string_;
+  }
+  string_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int StringWrapper::kStringFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+StringWrapper::StringWrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.StringWrapper)
+}
+StringWrapper::StringWrapper(const StringWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_string()) {
+    string_ = new PROTOBUF_NAMESPACE_ID::StringValue(*from.string_);
+  } else {
+    string_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.StringWrapper)
+}
+
+void StringWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  string_ = nullptr;
+}
+
+StringWrapper::~StringWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.StringWrapper)
+  SharedDtor();
+}
+
+void StringWrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete string_;
+}
+
+void StringWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const StringWrapper& StringWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void StringWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.StringWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && string_ != nullptr) {
+    delete string_;
+  }
+  string_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* StringWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.StringValue string = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_string(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool StringWrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.StringWrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.StringValue string = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_string()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.StringWrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.StringWrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void StringWrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.StringWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.StringValue string = 1;
+  if (this->has_string()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::string(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.StringWrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* StringWrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.StringWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.StringValue string = 1;
+  if (this->has_string()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::string(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.StringWrapper)
+  return target;
+}
+
+size_t StringWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.StringWrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.StringValue string = 1;
+  if (this->has_string()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StringWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.StringWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const StringWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StringWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.StringWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.StringWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void StringWrapper::MergeFrom(const StringWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.StringWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_string()) {
+    mutable_string()->PROTOBUF_NAMESPACE_ID::StringValue::MergeFrom(from.string());
+  }
+}
+
+void StringWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.StringWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StringWrapper::CopyFrom(const StringWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.StringWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StringWrapper::IsInitialized() const {
+  return true;
+}
+
+void StringWrapper::Swap(StringWrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void StringWrapper::InternalSwap(StringWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(string_, other->string_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StringWrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void BytesWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_BytesWrapper_default_instance_._instance.get_mutable()->bytes_ = const_cast< PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      PROTOBUF_NAMESPACE_ID::BytesValue::internal_default_instance());
+}
+class BytesWrapper::HasBitSetters {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::BytesValue& bytes(const BytesWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::BytesValue&
+BytesWrapper::HasBitSetters::bytes(const BytesWrapper* msg) {
+  return *msg->bytes_;
+}
+void BytesWrapper::clear_bytes() {
+  if (GetArenaNoVirtual() == nullptr && bytes_ != nullptr) {
+    delete bytes_;
+  }
+  bytes_ = nullptr;
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int BytesWrapper::kBytesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+BytesWrapper::BytesWrapper()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:proto_util_converter.testing.BytesWrapper)
+}
+BytesWrapper::BytesWrapper(const BytesWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_bytes()) {
+    bytes_ = new PROTOBUF_NAMESPACE_ID::BytesValue(*from.bytes_);
+  } else {
+    bytes_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.BytesWrapper)
+}
+
+void BytesWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(
+      &scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  bytes_ = nullptr;
+}
+
+BytesWrapper::~BytesWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.BytesWrapper)
+  SharedDtor();
+}
+
+void BytesWrapper::SharedDtor() {
+  if (this != internal_default_instance()) delete bytes_;
+}
+
+void BytesWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BytesWrapper& BytesWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BytesWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.BytesWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && bytes_ != nullptr) {
+    delete bytes_;
+  }
+  bytes_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* BytesWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.BytesValue bytes = 1;
+      case 1: {
+        if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) != 10) goto handle_unusual;
+        ptr = ctx->ParseMessage(mutable_bytes(), ptr);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        break;
+      }
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          return ptr;
+        }
+        ptr = UnknownFieldParse(tag,
+          _internal_metadata_.mutable_unknown_fields(), ptr, ctx);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
+        break;
+      }
+    }  // switch
+  }  // while
+  return ptr;
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool BytesWrapper::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:proto_util_converter.testing.BytesWrapper)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .google.protobuf.BytesValue bytes = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_bytes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:proto_util_converter.testing.BytesWrapper)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:proto_util_converter.testing.BytesWrapper)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void BytesWrapper::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:proto_util_converter.testing.BytesWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BytesValue bytes = 1;
+  if (this->has_bytes()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, HasBitSetters::bytes(this), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:proto_util_converter.testing.BytesWrapper)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BytesWrapper::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.BytesWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BytesValue bytes = 1;
+  if (this->has_bytes()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, HasBitSetters::bytes(this), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.BytesWrapper)
+  return target;
+}
+
+size_t BytesWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.BytesWrapper)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.BytesValue bytes = 1;
+  if (this->has_bytes()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BytesWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.BytesWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BytesWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BytesWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.BytesWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.BytesWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void BytesWrapper::MergeFrom(const BytesWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.BytesWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_bytes()) {
+    mutable_bytes()->PROTOBUF_NAMESPACE_ID::BytesValue::MergeFrom(from.bytes());
+  }
+}
+
+void BytesWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.BytesWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BytesWrapper::CopyFrom(const BytesWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.BytesWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BytesWrapper::IsInitialized() const {
+  return true;
+}
+
+void BytesWrapper::Swap(BytesWrapper* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void BytesWrapper::InternalSwap(BytesWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(bytes_, other->bytes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BytesWrapper::GetMetadata() const {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::assign_descriptors_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto);
+  return ::file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::WrappersTestCases* Arena::CreateMaybeMessage< ::proto_util_converter::testing::WrappersTestCases >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::WrappersTestCases >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::DoubleWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::DoubleWrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::DoubleWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::FloatWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::FloatWrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::FloatWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Int64Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Int64Wrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::Int64Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::UInt64Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::UInt64Wrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::UInt64Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Int32Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Int32Wrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::Int32Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::UInt32Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::UInt32Wrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::UInt32Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::BoolWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::BoolWrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::BoolWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::StringWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::StringWrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::StringWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::BytesWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::BytesWrapper >(Arena* arena) {
+  return Arena::CreateInternal< ::proto_util_converter::testing::BytesWrapper >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2845 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/wrappers.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wrappers.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[10]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto();
+namespace proto_util_converter {
+namespace testing {
+class BoolWrapper;
+class BoolWrapperDefaultTypeInternal;
+extern BoolWrapperDefaultTypeInternal _BoolWrapper_default_instance_;
+class BytesWrapper;
+class BytesWrapperDefaultTypeInternal;
+extern BytesWrapperDefaultTypeInternal _BytesWrapper_default_instance_;
+class DoubleWrapper;
+class DoubleWrapperDefaultTypeInternal;
+extern DoubleWrapperDefaultTypeInternal _DoubleWrapper_default_instance_;
+class FloatWrapper;
+class FloatWrapperDefaultTypeInternal;
+extern FloatWrapperDefaultTypeInternal _FloatWrapper_default_instance_;
+class Int32Wrapper;
+class Int32WrapperDefaultTypeInternal;
+extern Int32WrapperDefaultTypeInternal _Int32Wrapper_default_instance_;
+class Int64Wrapper;
+class Int64WrapperDefaultTypeInternal;
+extern Int64WrapperDefaultTypeInternal _Int64Wrapper_default_instance_;
+class StringWrapper;
+class StringWrapperDefaultTypeInternal;
+extern StringWrapperDefaultTypeInternal _StringWrapper_default_instance_;
+class UInt32Wrapper;
+class UInt32WrapperDefaultTypeInternal;
+extern UInt32WrapperDefaultTypeInternal _UInt32Wrapper_default_instance_;
+class UInt64Wrapper;
+class UInt64WrapperDefaultTypeInternal;
+extern UInt64WrapperDefaultTypeInternal _UInt64Wrapper_default_instance_;
+class WrappersTestCases;
+class WrappersTestCasesDefaultTypeInternal;
+extern WrappersTestCasesDefaultTypeInternal _WrappersTestCases_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::BoolWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::BoolWrapper>(Arena*);
+template<> ::proto_util_converter::testing::BytesWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::BytesWrapper>(Arena*);
+template<> ::proto_util_converter::testing::DoubleWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::DoubleWrapper>(Arena*);
+template<> ::proto_util_converter::testing::FloatWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::FloatWrapper>(Arena*);
+template<> ::proto_util_converter::testing::Int32Wrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::Int32Wrapper>(Arena*);
+template<> ::proto_util_converter::testing::Int64Wrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::Int64Wrapper>(Arena*);
+template<> ::proto_util_converter::testing::StringWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::StringWrapper>(Arena*);
+template<> ::proto_util_converter::testing::UInt32Wrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::UInt32Wrapper>(Arena*);
+template<> ::proto_util_converter::testing::UInt64Wrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::UInt64Wrapper>(Arena*);
+template<> ::proto_util_converter::testing::WrappersTestCases* Arena::CreateMaybeMessage<::proto_util_converter::testing::WrappersTestCases>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+class WrappersTestCases final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.WrappersTestCases) */ {
+ public:
+  WrappersTestCases();
+  virtual ~WrappersTestCases();
+
+  WrappersTestCases(const WrappersTestCases& from);
+  WrappersTestCases(WrappersTestCases&& from) noexcept
+    : WrappersTestCases() {
+    *this = ::std::move(from);
+  }
+
+  inline WrappersTestCases& operator=(const WrappersTestCases& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WrappersTestCases& operator=(WrappersTestCases&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const WrappersTestCases& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const WrappersTestCases* internal_default_instance() {
+    return reinterpret_cast<const WrappersTestCases*>(
+               &_WrappersTestCases_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void Swap(WrappersTestCases* other);
+  friend void swap(WrappersTestCases& a, WrappersTestCases& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline WrappersTestCases* New() const final {
+    return CreateMaybeMessage<WrappersTestCases>(nullptr);
+  }
+
+  WrappersTestCases* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<WrappersTestCases>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const WrappersTestCases& from);
+  void MergeFrom(const WrappersTestCases& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WrappersTestCases* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.WrappersTestCases";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+  bool has_double_wrapper() const;
+  void clear_double_wrapper();
+  static const int kDoubleWrapperFieldNumber = 1;
+  const ::proto_util_converter::testing::DoubleWrapper& double_wrapper() const;
+  ::proto_util_converter::testing::DoubleWrapper* release_double_wrapper();
+  ::proto_util_converter::testing::DoubleWrapper* mutable_double_wrapper();
+  void set_allocated_double_wrapper(::proto_util_converter::testing::DoubleWrapper* double_wrapper);
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+  bool has_float_wrapper() const;
+  void clear_float_wrapper();
+  static const int kFloatWrapperFieldNumber = 2;
+  const ::proto_util_converter::testing::FloatWrapper& float_wrapper() const;
+  ::proto_util_converter::testing::FloatWrapper* release_float_wrapper();
+  ::proto_util_converter::testing::FloatWrapper* mutable_float_wrapper();
+  void set_allocated_float_wrapper(::proto_util_converter::testing::FloatWrapper* float_wrapper);
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+  bool has_int64_wrapper() const;
+  void clear_int64_wrapper();
+  static const int kInt64WrapperFieldNumber = 3;
+  const ::proto_util_converter::testing::Int64Wrapper& int64_wrapper() const;
+  ::proto_util_converter::testing::Int64Wrapper* release_int64_wrapper();
+  ::proto_util_converter::testing::Int64Wrapper* mutable_int64_wrapper();
+  void set_allocated_int64_wrapper(::proto_util_converter::testing::Int64Wrapper* int64_wrapper);
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+  bool has_uint64_wrapper() const;
+  void clear_uint64_wrapper();
+  static const int kUint64WrapperFieldNumber = 4;
+  const ::proto_util_converter::testing::UInt64Wrapper& uint64_wrapper() const;
+  ::proto_util_converter::testing::UInt64Wrapper* release_uint64_wrapper();
+  ::proto_util_converter::testing::UInt64Wrapper* mutable_uint64_wrapper();
+  void set_allocated_uint64_wrapper(::proto_util_converter::testing::UInt64Wrapper* uint64_wrapper);
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+  bool has_int32_wrapper() const;
+  void clear_int32_wrapper();
+  static const int kInt32WrapperFieldNumber = 5;
+  const ::proto_util_converter::testing::Int32Wrapper& int32_wrapper() const;
+  ::proto_util_converter::testing::Int32Wrapper* release_int32_wrapper();
+  ::proto_util_converter::testing::Int32Wrapper* mutable_int32_wrapper();
+  void set_allocated_int32_wrapper(::proto_util_converter::testing::Int32Wrapper* int32_wrapper);
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+  bool has_uint32_wrapper() const;
+  void clear_uint32_wrapper();
+  static const int kUint32WrapperFieldNumber = 6;
+  const ::proto_util_converter::testing::UInt32Wrapper& uint32_wrapper() const;
+  ::proto_util_converter::testing::UInt32Wrapper* release_uint32_wrapper();
+  ::proto_util_converter::testing::UInt32Wrapper* mutable_uint32_wrapper();
+  void set_allocated_uint32_wrapper(::proto_util_converter::testing::UInt32Wrapper* uint32_wrapper);
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+  bool has_bool_wrapper() const;
+  void clear_bool_wrapper();
+  static const int kBoolWrapperFieldNumber = 7;
+  const ::proto_util_converter::testing::BoolWrapper& bool_wrapper() const;
+  ::proto_util_converter::testing::BoolWrapper* release_bool_wrapper();
+  ::proto_util_converter::testing::BoolWrapper* mutable_bool_wrapper();
+  void set_allocated_bool_wrapper(::proto_util_converter::testing::BoolWrapper* bool_wrapper);
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+  bool has_string_wrapper() const;
+  void clear_string_wrapper();
+  static const int kStringWrapperFieldNumber = 8;
+  const ::proto_util_converter::testing::StringWrapper& string_wrapper() const;
+  ::proto_util_converter::testing::StringWrapper* release_string_wrapper();
+  ::proto_util_converter::testing::StringWrapper* mutable_string_wrapper();
+  void set_allocated_string_wrapper(::proto_util_converter::testing::StringWrapper* string_wrapper);
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+  bool has_bytes_wrapper() const;
+  void clear_bytes_wrapper();
+  static const int kBytesWrapperFieldNumber = 9;
+  const ::proto_util_converter::testing::BytesWrapper& bytes_wrapper() const;
+  ::proto_util_converter::testing::BytesWrapper* release_bytes_wrapper();
+  ::proto_util_converter::testing::BytesWrapper* mutable_bytes_wrapper();
+  void set_allocated_bytes_wrapper(::proto_util_converter::testing::BytesWrapper* bytes_wrapper);
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+  bool has_double_wrapper_default() const;
+  void clear_double_wrapper_default();
+  static const int kDoubleWrapperDefaultFieldNumber = 10;
+  const ::proto_util_converter::testing::DoubleWrapper& double_wrapper_default() const;
+  ::proto_util_converter::testing::DoubleWrapper* release_double_wrapper_default();
+  ::proto_util_converter::testing::DoubleWrapper* mutable_double_wrapper_default();
+  void set_allocated_double_wrapper_default(::proto_util_converter::testing::DoubleWrapper* double_wrapper_default);
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+  bool has_float_wrapper_default() const;
+  void clear_float_wrapper_default();
+  static const int kFloatWrapperDefaultFieldNumber = 11;
+  const ::proto_util_converter::testing::FloatWrapper& float_wrapper_default() const;
+  ::proto_util_converter::testing::FloatWrapper* release_float_wrapper_default();
+  ::proto_util_converter::testing::FloatWrapper* mutable_float_wrapper_default();
+  void set_allocated_float_wrapper_default(::proto_util_converter::testing::FloatWrapper* float_wrapper_default);
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+  bool has_int64_wrapper_default() const;
+  void clear_int64_wrapper_default();
+  static const int kInt64WrapperDefaultFieldNumber = 12;
+  const ::proto_util_converter::testing::Int64Wrapper& int64_wrapper_default() const;
+  ::proto_util_converter::testing::Int64Wrapper* release_int64_wrapper_default();
+  ::proto_util_converter::testing::Int64Wrapper* mutable_int64_wrapper_default();
+  void set_allocated_int64_wrapper_default(::proto_util_converter::testing::Int64Wrapper* int64_wrapper_default);
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+  bool has_uint64_wrapper_default() const;
+  void clear_uint64_wrapper_default();
+  static const int kUint64WrapperDefaultFieldNumber = 13;
+  const ::proto_util_converter::testing::UInt64Wrapper& uint64_wrapper_default() const;
+  ::proto_util_converter::testing::UInt64Wrapper* release_uint64_wrapper_default();
+  ::proto_util_converter::testing::UInt64Wrapper* mutable_uint64_wrapper_default();
+  void set_allocated_uint64_wrapper_default(::proto_util_converter::testing::UInt64Wrapper* uint64_wrapper_default);
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+  bool has_int32_wrapper_default() const;
+  void clear_int32_wrapper_default();
+  static const int kInt32WrapperDefaultFieldNumber = 14;
+  const ::proto_util_converter::testing::Int32Wrapper& int32_wrapper_default() const;
+  ::proto_util_converter::testing::Int32Wrapper* release_int32_wrapper_default();
+  ::proto_util_converter::testing::Int32Wrapper* mutable_int32_wrapper_default();
+  void set_allocated_int32_wrapper_default(::proto_util_converter::testing::Int32Wrapper* int32_wrapper_default);
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+  bool has_uint32_wrapper_default() const;
+  void clear_uint32_wrapper_default();
+  static const int kUint32WrapperDefaultFieldNumber = 15;
+  const ::proto_util_converter::testing::UInt32Wrapper& uint32_wrapper_default() const;
+  ::proto_util_converter::testing::UInt32Wrapper* release_uint32_wrapper_default();
+  ::proto_util_converter::testing::UInt32Wrapper* mutable_uint32_wrapper_default();
+  void set_allocated_uint32_wrapper_default(::proto_util_converter::testing::UInt32Wrapper* uint32_wrapper_default);
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+  bool has_bool_wrapper_default() const;
+  void clear_bool_wrapper_default();
+  static const int kBoolWrapperDefaultFieldNumber = 16;
+  const ::proto_util_converter::testing::BoolWrapper& bool_wrapper_default() const;
+  ::proto_util_converter::testing::BoolWrapper* release_bool_wrapper_default();
+  ::proto_util_converter::testing::BoolWrapper* mutable_bool_wrapper_default();
+  void set_allocated_bool_wrapper_default(::proto_util_converter::testing::BoolWrapper* bool_wrapper_default);
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+  bool has_string_wrapper_default() const;
+  void clear_string_wrapper_default();
+  static const int kStringWrapperDefaultFieldNumber = 17;
+  const ::proto_util_converter::testing::StringWrapper& string_wrapper_default() const;
+  ::proto_util_converter::testing::StringWrapper* release_string_wrapper_default();
+  ::proto_util_converter::testing::StringWrapper* mutable_string_wrapper_default();
+  void set_allocated_string_wrapper_default(::proto_util_converter::testing::StringWrapper* string_wrapper_default);
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+  bool has_bytes_wrapper_default() const;
+  void clear_bytes_wrapper_default();
+  static const int kBytesWrapperDefaultFieldNumber = 18;
+  const ::proto_util_converter::testing::BytesWrapper& bytes_wrapper_default() const;
+  ::proto_util_converter::testing::BytesWrapper* release_bytes_wrapper_default();
+  ::proto_util_converter::testing::BytesWrapper* mutable_bytes_wrapper_default();
+  void set_allocated_bytes_wrapper_default(::proto_util_converter::testing::BytesWrapper* bytes_wrapper_default);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.WrappersTestCases)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::proto_util_converter::testing::DoubleWrapper* double_wrapper_;
+  ::proto_util_converter::testing::FloatWrapper* float_wrapper_;
+  ::proto_util_converter::testing::Int64Wrapper* int64_wrapper_;
+  ::proto_util_converter::testing::UInt64Wrapper* uint64_wrapper_;
+  ::proto_util_converter::testing::Int32Wrapper* int32_wrapper_;
+  ::proto_util_converter::testing::UInt32Wrapper* uint32_wrapper_;
+  ::proto_util_converter::testing::BoolWrapper* bool_wrapper_;
+  ::proto_util_converter::testing::StringWrapper* string_wrapper_;
+  ::proto_util_converter::testing::BytesWrapper* bytes_wrapper_;
+  ::proto_util_converter::testing::DoubleWrapper* double_wrapper_default_;
+  ::proto_util_converter::testing::FloatWrapper* float_wrapper_default_;
+  ::proto_util_converter::testing::Int64Wrapper* int64_wrapper_default_;
+  ::proto_util_converter::testing::UInt64Wrapper* uint64_wrapper_default_;
+  ::proto_util_converter::testing::Int32Wrapper* int32_wrapper_default_;
+  ::proto_util_converter::testing::UInt32Wrapper* uint32_wrapper_default_;
+  ::proto_util_converter::testing::BoolWrapper* bool_wrapper_default_;
+  ::proto_util_converter::testing::StringWrapper* string_wrapper_default_;
+  ::proto_util_converter::testing::BytesWrapper* bytes_wrapper_default_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DoubleWrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.DoubleWrapper) */ {
+ public:
+  DoubleWrapper();
+  virtual ~DoubleWrapper();
+
+  DoubleWrapper(const DoubleWrapper& from);
+  DoubleWrapper(DoubleWrapper&& from) noexcept
+    : DoubleWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline DoubleWrapper& operator=(const DoubleWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DoubleWrapper& operator=(DoubleWrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const DoubleWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DoubleWrapper* internal_default_instance() {
+    return reinterpret_cast<const DoubleWrapper*>(
+               &_DoubleWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  void Swap(DoubleWrapper* other);
+  friend void swap(DoubleWrapper& a, DoubleWrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DoubleWrapper* New() const final {
+    return CreateMaybeMessage<DoubleWrapper>(nullptr);
+  }
+
+  DoubleWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<DoubleWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const DoubleWrapper& from);
+  void MergeFrom(const DoubleWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DoubleWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.DoubleWrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.DoubleValue double = 1;
+  bool has_double_() const;
+  void clear_double_();
+  static const int kDoubleFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& double_() const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* release_double_();
+  PROTOBUF_NAMESPACE_ID::DoubleValue* mutable_double_();
+  void set_allocated_double_(PROTOBUF_NAMESPACE_ID::DoubleValue* double_);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.DoubleWrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* double__;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FloatWrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.FloatWrapper) */ {
+ public:
+  FloatWrapper();
+  virtual ~FloatWrapper();
+
+  FloatWrapper(const FloatWrapper& from);
+  FloatWrapper(FloatWrapper&& from) noexcept
+    : FloatWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline FloatWrapper& operator=(const FloatWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FloatWrapper& operator=(FloatWrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const FloatWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const FloatWrapper* internal_default_instance() {
+    return reinterpret_cast<const FloatWrapper*>(
+               &_FloatWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(FloatWrapper* other);
+  friend void swap(FloatWrapper& a, FloatWrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline FloatWrapper* New() const final {
+    return CreateMaybeMessage<FloatWrapper>(nullptr);
+  }
+
+  FloatWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<FloatWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const FloatWrapper& from);
+  void MergeFrom(const FloatWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FloatWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.FloatWrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.FloatValue float = 1;
+  bool has_float_() const;
+  void clear_float_();
+  static const int kFloatFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::FloatValue& float_() const;
+  PROTOBUF_NAMESPACE_ID::FloatValue* release_float_();
+  PROTOBUF_NAMESPACE_ID::FloatValue* mutable_float_();
+  void set_allocated_float_(PROTOBUF_NAMESPACE_ID::FloatValue* float_);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.FloatWrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::FloatValue* float__;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Int64Wrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Int64Wrapper) */ {
+ public:
+  Int64Wrapper();
+  virtual ~Int64Wrapper();
+
+  Int64Wrapper(const Int64Wrapper& from);
+  Int64Wrapper(Int64Wrapper&& from) noexcept
+    : Int64Wrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline Int64Wrapper& operator=(const Int64Wrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Int64Wrapper& operator=(Int64Wrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Int64Wrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Int64Wrapper* internal_default_instance() {
+    return reinterpret_cast<const Int64Wrapper*>(
+               &_Int64Wrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  void Swap(Int64Wrapper* other);
+  friend void swap(Int64Wrapper& a, Int64Wrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Int64Wrapper* New() const final {
+    return CreateMaybeMessage<Int64Wrapper>(nullptr);
+  }
+
+  Int64Wrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Int64Wrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Int64Wrapper& from);
+  void MergeFrom(const Int64Wrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Int64Wrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Int64Wrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.Int64Value int64 = 1;
+  bool has_int64() const;
+  void clear_int64();
+  static const int kInt64FieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::Int64Value& int64() const;
+  PROTOBUF_NAMESPACE_ID::Int64Value* release_int64();
+  PROTOBUF_NAMESPACE_ID::Int64Value* mutable_int64();
+  void set_allocated_int64(PROTOBUF_NAMESPACE_ID::Int64Value* int64);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Int64Wrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::Int64Value* int64_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UInt64Wrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.UInt64Wrapper) */ {
+ public:
+  UInt64Wrapper();
+  virtual ~UInt64Wrapper();
+
+  UInt64Wrapper(const UInt64Wrapper& from);
+  UInt64Wrapper(UInt64Wrapper&& from) noexcept
+    : UInt64Wrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline UInt64Wrapper& operator=(const UInt64Wrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UInt64Wrapper& operator=(UInt64Wrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const UInt64Wrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const UInt64Wrapper* internal_default_instance() {
+    return reinterpret_cast<const UInt64Wrapper*>(
+               &_UInt64Wrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  void Swap(UInt64Wrapper* other);
+  friend void swap(UInt64Wrapper& a, UInt64Wrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline UInt64Wrapper* New() const final {
+    return CreateMaybeMessage<UInt64Wrapper>(nullptr);
+  }
+
+  UInt64Wrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<UInt64Wrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const UInt64Wrapper& from);
+  void MergeFrom(const UInt64Wrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UInt64Wrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.UInt64Wrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.UInt64Value uint64 = 1;
+  bool has_uint64() const;
+  void clear_uint64();
+  static const int kUint64FieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64() const;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* release_uint64();
+  PROTOBUF_NAMESPACE_ID::UInt64Value* mutable_uint64();
+  void set_allocated_uint64(PROTOBUF_NAMESPACE_ID::UInt64Value* uint64);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.UInt64Wrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Int32Wrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Int32Wrapper) */ {
+ public:
+  Int32Wrapper();
+  virtual ~Int32Wrapper();
+
+  Int32Wrapper(const Int32Wrapper& from);
+  Int32Wrapper(Int32Wrapper&& from) noexcept
+    : Int32Wrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline Int32Wrapper& operator=(const Int32Wrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Int32Wrapper& operator=(Int32Wrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const Int32Wrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Int32Wrapper* internal_default_instance() {
+    return reinterpret_cast<const Int32Wrapper*>(
+               &_Int32Wrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  void Swap(Int32Wrapper* other);
+  friend void swap(Int32Wrapper& a, Int32Wrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Int32Wrapper* New() const final {
+    return CreateMaybeMessage<Int32Wrapper>(nullptr);
+  }
+
+  Int32Wrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Int32Wrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Int32Wrapper& from);
+  void MergeFrom(const Int32Wrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Int32Wrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Int32Wrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.Int32Value int32 = 1;
+  bool has_int32() const;
+  void clear_int32();
+  static const int kInt32FieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::Int32Value& int32() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_int32();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_int32();
+  void set_allocated_int32(PROTOBUF_NAMESPACE_ID::Int32Value* int32);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Int32Wrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::Int32Value* int32_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UInt32Wrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.UInt32Wrapper) */ {
+ public:
+  UInt32Wrapper();
+  virtual ~UInt32Wrapper();
+
+  UInt32Wrapper(const UInt32Wrapper& from);
+  UInt32Wrapper(UInt32Wrapper&& from) noexcept
+    : UInt32Wrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline UInt32Wrapper& operator=(const UInt32Wrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UInt32Wrapper& operator=(UInt32Wrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const UInt32Wrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const UInt32Wrapper* internal_default_instance() {
+    return reinterpret_cast<const UInt32Wrapper*>(
+               &_UInt32Wrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  void Swap(UInt32Wrapper* other);
+  friend void swap(UInt32Wrapper& a, UInt32Wrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline UInt32Wrapper* New() const final {
+    return CreateMaybeMessage<UInt32Wrapper>(nullptr);
+  }
+
+  UInt32Wrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<UInt32Wrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const UInt32Wrapper& from);
+  void MergeFrom(const UInt32Wrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UInt32Wrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.UInt32Wrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.UInt32Value uint32 = 1;
+  bool has_uint32() const;
+  void clear_uint32();
+  static const int kUint32FieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32() const;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* release_uint32();
+  PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_uint32();
+  void set_allocated_uint32(PROTOBUF_NAMESPACE_ID::UInt32Value* uint32);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.UInt32Wrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BoolWrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BoolWrapper) */ {
+ public:
+  BoolWrapper();
+  virtual ~BoolWrapper();
+
+  BoolWrapper(const BoolWrapper& from);
+  BoolWrapper(BoolWrapper&& from) noexcept
+    : BoolWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline BoolWrapper& operator=(const BoolWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoolWrapper& operator=(BoolWrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const BoolWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BoolWrapper* internal_default_instance() {
+    return reinterpret_cast<const BoolWrapper*>(
+               &_BoolWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  void Swap(BoolWrapper* other);
+  friend void swap(BoolWrapper& a, BoolWrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BoolWrapper* New() const final {
+    return CreateMaybeMessage<BoolWrapper>(nullptr);
+  }
+
+  BoolWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BoolWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BoolWrapper& from);
+  void MergeFrom(const BoolWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BoolWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BoolWrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.BoolValue bool = 1;
+  bool has_bool_() const;
+  void clear_bool_();
+  static const int kBoolFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::BoolValue& bool_() const;
+  PROTOBUF_NAMESPACE_ID::BoolValue* release_bool_();
+  PROTOBUF_NAMESPACE_ID::BoolValue* mutable_bool_();
+  void set_allocated_bool_(PROTOBUF_NAMESPACE_ID::BoolValue* bool_);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BoolWrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::BoolValue* bool__;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StringWrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.StringWrapper) */ {
+ public:
+  StringWrapper();
+  virtual ~StringWrapper();
+
+  StringWrapper(const StringWrapper& from);
+  StringWrapper(StringWrapper&& from) noexcept
+    : StringWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline StringWrapper& operator=(const StringWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StringWrapper& operator=(StringWrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const StringWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const StringWrapper* internal_default_instance() {
+    return reinterpret_cast<const StringWrapper*>(
+               &_StringWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  void Swap(StringWrapper* other);
+  friend void swap(StringWrapper& a, StringWrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline StringWrapper* New() const final {
+    return CreateMaybeMessage<StringWrapper>(nullptr);
+  }
+
+  StringWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<StringWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const StringWrapper& from);
+  void MergeFrom(const StringWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StringWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.StringWrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.StringValue string = 1;
+  bool has_string() const;
+  void clear_string();
+  static const int kStringFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::StringValue& string() const;
+  PROTOBUF_NAMESPACE_ID::StringValue* release_string();
+  PROTOBUF_NAMESPACE_ID::StringValue* mutable_string();
+  void set_allocated_string(PROTOBUF_NAMESPACE_ID::StringValue* string);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.StringWrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::StringValue* string_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BytesWrapper final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BytesWrapper) */ {
+ public:
+  BytesWrapper();
+  virtual ~BytesWrapper();
+
+  BytesWrapper(const BytesWrapper& from);
+  BytesWrapper(BytesWrapper&& from) noexcept
+    : BytesWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline BytesWrapper& operator=(const BytesWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BytesWrapper& operator=(BytesWrapper&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const BytesWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BytesWrapper* internal_default_instance() {
+    return reinterpret_cast<const BytesWrapper*>(
+               &_BytesWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  void Swap(BytesWrapper* other);
+  friend void swap(BytesWrapper& a, BytesWrapper& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BytesWrapper* New() const final {
+    return CreateMaybeMessage<BytesWrapper>(nullptr);
+  }
+
+  BytesWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BytesWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BytesWrapper& from);
+  void MergeFrom(const BytesWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BytesWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BytesWrapper";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .google.protobuf.BytesValue bytes = 1;
+  bool has_bytes() const;
+  void clear_bytes();
+  static const int kBytesFieldNumber = 1;
+  const PROTOBUF_NAMESPACE_ID::BytesValue& bytes() const;
+  PROTOBUF_NAMESPACE_ID::BytesValue* release_bytes();
+  PROTOBUF_NAMESPACE_ID::BytesValue* mutable_bytes();
+  void set_allocated_bytes(PROTOBUF_NAMESPACE_ID::BytesValue* bytes);
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BytesWrapper)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  PROTOBUF_NAMESPACE_ID::BytesValue* bytes_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// WrappersTestCases
+
+// .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+inline bool WrappersTestCases::has_double_wrapper() const {
+  return this != internal_default_instance() && double_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_double_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && double_wrapper_ != nullptr) {
+    delete double_wrapper_;
+  }
+  double_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DoubleWrapper& WrappersTestCases::double_wrapper() const {
+  const ::proto_util_converter::testing::DoubleWrapper* p = double_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.double_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DoubleWrapper*>(
+      &::proto_util_converter::testing::_DoubleWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::DoubleWrapper* WrappersTestCases::release_double_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.double_wrapper)
+  
+  ::proto_util_converter::testing::DoubleWrapper* temp = double_wrapper_;
+  double_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DoubleWrapper* WrappersTestCases::mutable_double_wrapper() {
+  
+  if (double_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DoubleWrapper>(GetArenaNoVirtual());
+    double_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.double_wrapper)
+  return double_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_double_wrapper(::proto_util_converter::testing::DoubleWrapper* double_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete double_wrapper_;
+  }
+  if (double_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      double_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, double_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  double_wrapper_ = double_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.double_wrapper)
+}
+
+// .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+inline bool WrappersTestCases::has_float_wrapper() const {
+  return this != internal_default_instance() && float_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_float_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && float_wrapper_ != nullptr) {
+    delete float_wrapper_;
+  }
+  float_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::FloatWrapper& WrappersTestCases::float_wrapper() const {
+  const ::proto_util_converter::testing::FloatWrapper* p = float_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.float_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::FloatWrapper*>(
+      &::proto_util_converter::testing::_FloatWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::FloatWrapper* WrappersTestCases::release_float_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.float_wrapper)
+  
+  ::proto_util_converter::testing::FloatWrapper* temp = float_wrapper_;
+  float_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::FloatWrapper* WrappersTestCases::mutable_float_wrapper() {
+  
+  if (float_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::FloatWrapper>(GetArenaNoVirtual());
+    float_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.float_wrapper)
+  return float_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_float_wrapper(::proto_util_converter::testing::FloatWrapper* float_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete float_wrapper_;
+  }
+  if (float_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      float_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, float_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  float_wrapper_ = float_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.float_wrapper)
+}
+
+// .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+inline bool WrappersTestCases::has_int64_wrapper() const {
+  return this != internal_default_instance() && int64_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_int64_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && int64_wrapper_ != nullptr) {
+    delete int64_wrapper_;
+  }
+  int64_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Int64Wrapper& WrappersTestCases::int64_wrapper() const {
+  const ::proto_util_converter::testing::Int64Wrapper* p = int64_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.int64_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Int64Wrapper*>(
+      &::proto_util_converter::testing::_Int64Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::Int64Wrapper* WrappersTestCases::release_int64_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.int64_wrapper)
+  
+  ::proto_util_converter::testing::Int64Wrapper* temp = int64_wrapper_;
+  int64_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Int64Wrapper* WrappersTestCases::mutable_int64_wrapper() {
+  
+  if (int64_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Int64Wrapper>(GetArenaNoVirtual());
+    int64_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.int64_wrapper)
+  return int64_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_int64_wrapper(::proto_util_converter::testing::Int64Wrapper* int64_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete int64_wrapper_;
+  }
+  if (int64_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      int64_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int64_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int64_wrapper_ = int64_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.int64_wrapper)
+}
+
+// .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+inline bool WrappersTestCases::has_uint64_wrapper() const {
+  return this != internal_default_instance() && uint64_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_uint64_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && uint64_wrapper_ != nullptr) {
+    delete uint64_wrapper_;
+  }
+  uint64_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::UInt64Wrapper& WrappersTestCases::uint64_wrapper() const {
+  const ::proto_util_converter::testing::UInt64Wrapper* p = uint64_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.uint64_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::UInt64Wrapper*>(
+      &::proto_util_converter::testing::_UInt64Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::UInt64Wrapper* WrappersTestCases::release_uint64_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.uint64_wrapper)
+  
+  ::proto_util_converter::testing::UInt64Wrapper* temp = uint64_wrapper_;
+  uint64_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::UInt64Wrapper* WrappersTestCases::mutable_uint64_wrapper() {
+  
+  if (uint64_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::UInt64Wrapper>(GetArenaNoVirtual());
+    uint64_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.uint64_wrapper)
+  return uint64_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_uint64_wrapper(::proto_util_converter::testing::UInt64Wrapper* uint64_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete uint64_wrapper_;
+  }
+  if (uint64_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      uint64_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint64_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint64_wrapper_ = uint64_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.uint64_wrapper)
+}
+
+// .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+inline bool WrappersTestCases::has_int32_wrapper() const {
+  return this != internal_default_instance() && int32_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_int32_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && int32_wrapper_ != nullptr) {
+    delete int32_wrapper_;
+  }
+  int32_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Int32Wrapper& WrappersTestCases::int32_wrapper() const {
+  const ::proto_util_converter::testing::Int32Wrapper* p = int32_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.int32_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Int32Wrapper*>(
+      &::proto_util_converter::testing::_Int32Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::Int32Wrapper* WrappersTestCases::release_int32_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.int32_wrapper)
+  
+  ::proto_util_converter::testing::Int32Wrapper* temp = int32_wrapper_;
+  int32_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Int32Wrapper* WrappersTestCases::mutable_int32_wrapper() {
+  
+  if (int32_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Int32Wrapper>(GetArenaNoVirtual());
+    int32_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.int32_wrapper)
+  return int32_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_int32_wrapper(::proto_util_converter::testing::Int32Wrapper* int32_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete int32_wrapper_;
+  }
+  if (int32_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      int32_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int32_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int32_wrapper_ = int32_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.int32_wrapper)
+}
+
+// .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+inline bool WrappersTestCases::has_uint32_wrapper() const {
+  return this != internal_default_instance() && uint32_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_uint32_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && uint32_wrapper_ != nullptr) {
+    delete uint32_wrapper_;
+  }
+  uint32_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::UInt32Wrapper& WrappersTestCases::uint32_wrapper() const {
+  const ::proto_util_converter::testing::UInt32Wrapper* p = uint32_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.uint32_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::UInt32Wrapper*>(
+      &::proto_util_converter::testing::_UInt32Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::UInt32Wrapper* WrappersTestCases::release_uint32_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.uint32_wrapper)
+  
+  ::proto_util_converter::testing::UInt32Wrapper* temp = uint32_wrapper_;
+  uint32_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::UInt32Wrapper* WrappersTestCases::mutable_uint32_wrapper() {
+  
+  if (uint32_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::UInt32Wrapper>(GetArenaNoVirtual());
+    uint32_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.uint32_wrapper)
+  return uint32_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_uint32_wrapper(::proto_util_converter::testing::UInt32Wrapper* uint32_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete uint32_wrapper_;
+  }
+  if (uint32_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      uint32_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint32_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint32_wrapper_ = uint32_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.uint32_wrapper)
+}
+
+// .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+inline bool WrappersTestCases::has_bool_wrapper() const {
+  return this != internal_default_instance() && bool_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_bool_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && bool_wrapper_ != nullptr) {
+    delete bool_wrapper_;
+  }
+  bool_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::BoolWrapper& WrappersTestCases::bool_wrapper() const {
+  const ::proto_util_converter::testing::BoolWrapper* p = bool_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.bool_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::BoolWrapper*>(
+      &::proto_util_converter::testing::_BoolWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::BoolWrapper* WrappersTestCases::release_bool_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.bool_wrapper)
+  
+  ::proto_util_converter::testing::BoolWrapper* temp = bool_wrapper_;
+  bool_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::BoolWrapper* WrappersTestCases::mutable_bool_wrapper() {
+  
+  if (bool_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::BoolWrapper>(GetArenaNoVirtual());
+    bool_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.bool_wrapper)
+  return bool_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_bool_wrapper(::proto_util_converter::testing::BoolWrapper* bool_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete bool_wrapper_;
+  }
+  if (bool_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      bool_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bool_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bool_wrapper_ = bool_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.bool_wrapper)
+}
+
+// .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+inline bool WrappersTestCases::has_string_wrapper() const {
+  return this != internal_default_instance() && string_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_string_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && string_wrapper_ != nullptr) {
+    delete string_wrapper_;
+  }
+  string_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::StringWrapper& WrappersTestCases::string_wrapper() const {
+  const ::proto_util_converter::testing::StringWrapper* p = string_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.string_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::StringWrapper*>(
+      &::proto_util_converter::testing::_StringWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::StringWrapper* WrappersTestCases::release_string_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.string_wrapper)
+  
+  ::proto_util_converter::testing::StringWrapper* temp = string_wrapper_;
+  string_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::StringWrapper* WrappersTestCases::mutable_string_wrapper() {
+  
+  if (string_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::StringWrapper>(GetArenaNoVirtual());
+    string_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.string_wrapper)
+  return string_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_string_wrapper(::proto_util_converter::testing::StringWrapper* string_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete string_wrapper_;
+  }
+  if (string_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      string_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, string_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  string_wrapper_ = string_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.string_wrapper)
+}
+
+// .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+inline bool WrappersTestCases::has_bytes_wrapper() const {
+  return this != internal_default_instance() && bytes_wrapper_ != nullptr;
+}
+inline void WrappersTestCases::clear_bytes_wrapper() {
+  if (GetArenaNoVirtual() == nullptr && bytes_wrapper_ != nullptr) {
+    delete bytes_wrapper_;
+  }
+  bytes_wrapper_ = nullptr;
+}
+inline const ::proto_util_converter::testing::BytesWrapper& WrappersTestCases::bytes_wrapper() const {
+  const ::proto_util_converter::testing::BytesWrapper* p = bytes_wrapper_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.bytes_wrapper)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::BytesWrapper*>(
+      &::proto_util_converter::testing::_BytesWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::BytesWrapper* WrappersTestCases::release_bytes_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.bytes_wrapper)
+  
+  ::proto_util_converter::testing::BytesWrapper* temp = bytes_wrapper_;
+  bytes_wrapper_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::BytesWrapper* WrappersTestCases::mutable_bytes_wrapper() {
+  
+  if (bytes_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::BytesWrapper>(GetArenaNoVirtual());
+    bytes_wrapper_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.bytes_wrapper)
+  return bytes_wrapper_;
+}
+inline void WrappersTestCases::set_allocated_bytes_wrapper(::proto_util_converter::testing::BytesWrapper* bytes_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete bytes_wrapper_;
+  }
+  if (bytes_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      bytes_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bytes_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bytes_wrapper_ = bytes_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.bytes_wrapper)
+}
+
+// .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+inline bool WrappersTestCases::has_double_wrapper_default() const {
+  return this != internal_default_instance() && double_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_double_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && double_wrapper_default_ != nullptr) {
+    delete double_wrapper_default_;
+  }
+  double_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DoubleWrapper& WrappersTestCases::double_wrapper_default() const {
+  const ::proto_util_converter::testing::DoubleWrapper* p = double_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.double_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DoubleWrapper*>(
+      &::proto_util_converter::testing::_DoubleWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::DoubleWrapper* WrappersTestCases::release_double_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.double_wrapper_default)
+  
+  ::proto_util_converter::testing::DoubleWrapper* temp = double_wrapper_default_;
+  double_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DoubleWrapper* WrappersTestCases::mutable_double_wrapper_default() {
+  
+  if (double_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DoubleWrapper>(GetArenaNoVirtual());
+    double_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.double_wrapper_default)
+  return double_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_double_wrapper_default(::proto_util_converter::testing::DoubleWrapper* double_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete double_wrapper_default_;
+  }
+  if (double_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      double_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, double_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  double_wrapper_default_ = double_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.double_wrapper_default)
+}
+
+// .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+inline bool WrappersTestCases::has_float_wrapper_default() const {
+  return this != internal_default_instance() && float_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_float_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && float_wrapper_default_ != nullptr) {
+    delete float_wrapper_default_;
+  }
+  float_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::FloatWrapper& WrappersTestCases::float_wrapper_default() const {
+  const ::proto_util_converter::testing::FloatWrapper* p = float_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.float_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::FloatWrapper*>(
+      &::proto_util_converter::testing::_FloatWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::FloatWrapper* WrappersTestCases::release_float_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.float_wrapper_default)
+  
+  ::proto_util_converter::testing::FloatWrapper* temp = float_wrapper_default_;
+  float_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::FloatWrapper* WrappersTestCases::mutable_float_wrapper_default() {
+  
+  if (float_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::FloatWrapper>(GetArenaNoVirtual());
+    float_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.float_wrapper_default)
+  return float_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_float_wrapper_default(::proto_util_converter::testing::FloatWrapper* float_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete float_wrapper_default_;
+  }
+  if (float_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      float_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, float_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  float_wrapper_default_ = float_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.float_wrapper_default)
+}
+
+// .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+inline bool WrappersTestCases::has_int64_wrapper_default() const {
+  return this != internal_default_instance() && int64_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_int64_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && int64_wrapper_default_ != nullptr) {
+    delete int64_wrapper_default_;
+  }
+  int64_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Int64Wrapper& WrappersTestCases::int64_wrapper_default() const {
+  const ::proto_util_converter::testing::Int64Wrapper* p = int64_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.int64_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Int64Wrapper*>(
+      &::proto_util_converter::testing::_Int64Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::Int64Wrapper* WrappersTestCases::release_int64_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.int64_wrapper_default)
+  
+  ::proto_util_converter::testing::Int64Wrapper* temp = int64_wrapper_default_;
+  int64_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Int64Wrapper* WrappersTestCases::mutable_int64_wrapper_default() {
+  
+  if (int64_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Int64Wrapper>(GetArenaNoVirtual());
+    int64_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.int64_wrapper_default)
+  return int64_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_int64_wrapper_default(::proto_util_converter::testing::Int64Wrapper* int64_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete int64_wrapper_default_;
+  }
+  if (int64_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      int64_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int64_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int64_wrapper_default_ = int64_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.int64_wrapper_default)
+}
+
+// .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+inline bool WrappersTestCases::has_uint64_wrapper_default() const {
+  return this != internal_default_instance() && uint64_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_uint64_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && uint64_wrapper_default_ != nullptr) {
+    delete uint64_wrapper_default_;
+  }
+  uint64_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::UInt64Wrapper& WrappersTestCases::uint64_wrapper_default() const {
+  const ::proto_util_converter::testing::UInt64Wrapper* p = uint64_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.uint64_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::UInt64Wrapper*>(
+      &::proto_util_converter::testing::_UInt64Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::UInt64Wrapper* WrappersTestCases::release_uint64_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.uint64_wrapper_default)
+  
+  ::proto_util_converter::testing::UInt64Wrapper* temp = uint64_wrapper_default_;
+  uint64_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::UInt64Wrapper* WrappersTestCases::mutable_uint64_wrapper_default() {
+  
+  if (uint64_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::UInt64Wrapper>(GetArenaNoVirtual());
+    uint64_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.uint64_wrapper_default)
+  return uint64_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_uint64_wrapper_default(::proto_util_converter::testing::UInt64Wrapper* uint64_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete uint64_wrapper_default_;
+  }
+  if (uint64_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      uint64_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint64_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint64_wrapper_default_ = uint64_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.uint64_wrapper_default)
+}
+
+// .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+inline bool WrappersTestCases::has_int32_wrapper_default() const {
+  return this != internal_default_instance() && int32_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_int32_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && int32_wrapper_default_ != nullptr) {
+    delete int32_wrapper_default_;
+  }
+  int32_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Int32Wrapper& WrappersTestCases::int32_wrapper_default() const {
+  const ::proto_util_converter::testing::Int32Wrapper* p = int32_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.int32_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Int32Wrapper*>(
+      &::proto_util_converter::testing::_Int32Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::Int32Wrapper* WrappersTestCases::release_int32_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.int32_wrapper_default)
+  
+  ::proto_util_converter::testing::Int32Wrapper* temp = int32_wrapper_default_;
+  int32_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Int32Wrapper* WrappersTestCases::mutable_int32_wrapper_default() {
+  
+  if (int32_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Int32Wrapper>(GetArenaNoVirtual());
+    int32_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.int32_wrapper_default)
+  return int32_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_int32_wrapper_default(::proto_util_converter::testing::Int32Wrapper* int32_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete int32_wrapper_default_;
+  }
+  if (int32_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      int32_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int32_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int32_wrapper_default_ = int32_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.int32_wrapper_default)
+}
+
+// .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+inline bool WrappersTestCases::has_uint32_wrapper_default() const {
+  return this != internal_default_instance() && uint32_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_uint32_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && uint32_wrapper_default_ != nullptr) {
+    delete uint32_wrapper_default_;
+  }
+  uint32_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::UInt32Wrapper& WrappersTestCases::uint32_wrapper_default() const {
+  const ::proto_util_converter::testing::UInt32Wrapper* p = uint32_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.uint32_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::UInt32Wrapper*>(
+      &::proto_util_converter::testing::_UInt32Wrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::UInt32Wrapper* WrappersTestCases::release_uint32_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.uint32_wrapper_default)
+  
+  ::proto_util_converter::testing::UInt32Wrapper* temp = uint32_wrapper_default_;
+  uint32_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::UInt32Wrapper* WrappersTestCases::mutable_uint32_wrapper_default() {
+  
+  if (uint32_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::UInt32Wrapper>(GetArenaNoVirtual());
+    uint32_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.uint32_wrapper_default)
+  return uint32_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_uint32_wrapper_default(::proto_util_converter::testing::UInt32Wrapper* uint32_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete uint32_wrapper_default_;
+  }
+  if (uint32_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      uint32_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint32_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint32_wrapper_default_ = uint32_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.uint32_wrapper_default)
+}
+
+// .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+inline bool WrappersTestCases::has_bool_wrapper_default() const {
+  return this != internal_default_instance() && bool_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_bool_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && bool_wrapper_default_ != nullptr) {
+    delete bool_wrapper_default_;
+  }
+  bool_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::BoolWrapper& WrappersTestCases::bool_wrapper_default() const {
+  const ::proto_util_converter::testing::BoolWrapper* p = bool_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.bool_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::BoolWrapper*>(
+      &::proto_util_converter::testing::_BoolWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::BoolWrapper* WrappersTestCases::release_bool_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.bool_wrapper_default)
+  
+  ::proto_util_converter::testing::BoolWrapper* temp = bool_wrapper_default_;
+  bool_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::BoolWrapper* WrappersTestCases::mutable_bool_wrapper_default() {
+  
+  if (bool_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::BoolWrapper>(GetArenaNoVirtual());
+    bool_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.bool_wrapper_default)
+  return bool_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_bool_wrapper_default(::proto_util_converter::testing::BoolWrapper* bool_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete bool_wrapper_default_;
+  }
+  if (bool_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      bool_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bool_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bool_wrapper_default_ = bool_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.bool_wrapper_default)
+}
+
+// .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+inline bool WrappersTestCases::has_string_wrapper_default() const {
+  return this != internal_default_instance() && string_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_string_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && string_wrapper_default_ != nullptr) {
+    delete string_wrapper_default_;
+  }
+  string_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::StringWrapper& WrappersTestCases::string_wrapper_default() const {
+  const ::proto_util_converter::testing::StringWrapper* p = string_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.string_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::StringWrapper*>(
+      &::proto_util_converter::testing::_StringWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::StringWrapper* WrappersTestCases::release_string_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.string_wrapper_default)
+  
+  ::proto_util_converter::testing::StringWrapper* temp = string_wrapper_default_;
+  string_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::StringWrapper* WrappersTestCases::mutable_string_wrapper_default() {
+  
+  if (string_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::StringWrapper>(GetArenaNoVirtual());
+    string_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.string_wrapper_default)
+  return string_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_string_wrapper_default(::proto_util_converter::testing::StringWrapper* string_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete string_wrapper_default_;
+  }
+  if (string_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      string_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, string_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  string_wrapper_default_ = string_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.string_wrapper_default)
+}
+
+// .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+inline bool WrappersTestCases::has_bytes_wrapper_default() const {
+  return this != internal_default_instance() && bytes_wrapper_default_ != nullptr;
+}
+inline void WrappersTestCases::clear_bytes_wrapper_default() {
+  if (GetArenaNoVirtual() == nullptr && bytes_wrapper_default_ != nullptr) {
+    delete bytes_wrapper_default_;
+  }
+  bytes_wrapper_default_ = nullptr;
+}
+inline const ::proto_util_converter::testing::BytesWrapper& WrappersTestCases::bytes_wrapper_default() const {
+  const ::proto_util_converter::testing::BytesWrapper* p = bytes_wrapper_default_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.WrappersTestCases.bytes_wrapper_default)
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::BytesWrapper*>(
+      &::proto_util_converter::testing::_BytesWrapper_default_instance_);
+}
+inline ::proto_util_converter::testing::BytesWrapper* WrappersTestCases::release_bytes_wrapper_default() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.WrappersTestCases.bytes_wrapper_default)
+  
+  ::proto_util_converter::testing::BytesWrapper* temp = bytes_wrapper_default_;
+  bytes_wrapper_default_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::BytesWrapper* WrappersTestCases::mutable_bytes_wrapper_default() {
+  
+  if (bytes_wrapper_default_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::BytesWrapper>(GetArenaNoVirtual());
+    bytes_wrapper_default_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.WrappersTestCases.bytes_wrapper_default)
+  return bytes_wrapper_default_;
+}
+inline void WrappersTestCases::set_allocated_bytes_wrapper_default(::proto_util_converter::testing::BytesWrapper* bytes_wrapper_default) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete bytes_wrapper_default_;
+  }
+  if (bytes_wrapper_default) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      bytes_wrapper_default = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bytes_wrapper_default, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bytes_wrapper_default_ = bytes_wrapper_default;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.WrappersTestCases.bytes_wrapper_default)
+}
+
+// -------------------------------------------------------------------
+
+// DoubleWrapper
+
+// .google.protobuf.DoubleValue double = 1;
+inline bool DoubleWrapper::has_double_() const {
+  return this != internal_default_instance() && double__ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& DoubleWrapper::double_() const {
+  const PROTOBUF_NAMESPACE_ID::DoubleValue* p = double__;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.DoubleWrapper.double)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      &PROTOBUF_NAMESPACE_ID::_DoubleValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* DoubleWrapper::release_double_() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.DoubleWrapper.double)
+  
+  PROTOBUF_NAMESPACE_ID::DoubleValue* temp = double__;
+  double__ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* DoubleWrapper::mutable_double_() {
+  
+  if (double__ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::DoubleValue>(GetArenaNoVirtual());
+    double__ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.DoubleWrapper.double)
+  return double__;
+}
+inline void DoubleWrapper::set_allocated_double_(PROTOBUF_NAMESPACE_ID::DoubleValue* double_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(double__);
+  }
+  if (double_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(double_)->GetArena();
+    if (message_arena != submessage_arena) {
+      double_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, double_, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  double__ = double_;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.DoubleWrapper.double)
+}
+
+// -------------------------------------------------------------------
+
+// FloatWrapper
+
+// .google.protobuf.FloatValue float = 1;
+inline bool FloatWrapper::has_float_() const {
+  return this != internal_default_instance() && float__ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::FloatValue& FloatWrapper::float_() const {
+  const PROTOBUF_NAMESPACE_ID::FloatValue* p = float__;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.FloatWrapper.float)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      &PROTOBUF_NAMESPACE_ID::_FloatValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* FloatWrapper::release_float_() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.FloatWrapper.float)
+  
+  PROTOBUF_NAMESPACE_ID::FloatValue* temp = float__;
+  float__ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::FloatValue* FloatWrapper::mutable_float_() {
+  
+  if (float__ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::FloatValue>(GetArenaNoVirtual());
+    float__ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.FloatWrapper.float)
+  return float__;
+}
+inline void FloatWrapper::set_allocated_float_(PROTOBUF_NAMESPACE_ID::FloatValue* float_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(float__);
+  }
+  if (float_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(float_)->GetArena();
+    if (message_arena != submessage_arena) {
+      float_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, float_, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  float__ = float_;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.FloatWrapper.float)
+}
+
+// -------------------------------------------------------------------
+
+// Int64Wrapper
+
+// .google.protobuf.Int64Value int64 = 1;
+inline bool Int64Wrapper::has_int64() const {
+  return this != internal_default_instance() && int64_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int64Value& Int64Wrapper::int64() const {
+  const PROTOBUF_NAMESPACE_ID::Int64Value* p = int64_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Int64Wrapper.int64)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int64Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* Int64Wrapper::release_int64() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Int64Wrapper.int64)
+  
+  PROTOBUF_NAMESPACE_ID::Int64Value* temp = int64_;
+  int64_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int64Value* Int64Wrapper::mutable_int64() {
+  
+  if (int64_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int64Value>(GetArenaNoVirtual());
+    int64_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Int64Wrapper.int64)
+  return int64_;
+}
+inline void Int64Wrapper::set_allocated_int64(PROTOBUF_NAMESPACE_ID::Int64Value* int64) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(int64_);
+  }
+  if (int64) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int64)->GetArena();
+    if (message_arena != submessage_arena) {
+      int64 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int64, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int64_ = int64;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Int64Wrapper.int64)
+}
+
+// -------------------------------------------------------------------
+
+// UInt64Wrapper
+
+// .google.protobuf.UInt64Value uint64 = 1;
+inline bool UInt64Wrapper::has_uint64() const {
+  return this != internal_default_instance() && uint64_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt64Value& UInt64Wrapper::uint64() const {
+  const PROTOBUF_NAMESPACE_ID::UInt64Value* p = uint64_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.UInt64Wrapper.uint64)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      &PROTOBUF_NAMESPACE_ID::_UInt64Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* UInt64Wrapper::release_uint64() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.UInt64Wrapper.uint64)
+  
+  PROTOBUF_NAMESPACE_ID::UInt64Value* temp = uint64_;
+  uint64_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::UInt64Value* UInt64Wrapper::mutable_uint64() {
+  
+  if (uint64_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::UInt64Value>(GetArenaNoVirtual());
+    uint64_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.UInt64Wrapper.uint64)
+  return uint64_;
+}
+inline void UInt64Wrapper::set_allocated_uint64(PROTOBUF_NAMESPACE_ID::UInt64Value* uint64) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint64_);
+  }
+  if (uint64) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint64)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint64 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint64, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint64_ = uint64;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.UInt64Wrapper.uint64)
+}
+
+// -------------------------------------------------------------------
+
+// Int32Wrapper
+
+// .google.protobuf.Int32Value int32 = 1;
+inline bool Int32Wrapper::has_int32() const {
+  return this != internal_default_instance() && int32_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Int32Wrapper::int32() const {
+  const PROTOBUF_NAMESPACE_ID::Int32Value* p = int32_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Int32Wrapper.int32)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Int32Wrapper::release_int32() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Int32Wrapper.int32)
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = int32_;
+  int32_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Int32Wrapper::mutable_int32() {
+  
+  if (int32_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int32Value>(GetArenaNoVirtual());
+    int32_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Int32Wrapper.int32)
+  return int32_;
+}
+inline void Int32Wrapper::set_allocated_int32(PROTOBUF_NAMESPACE_ID::Int32Value* int32) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(int32_);
+  }
+  if (int32) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int32)->GetArena();
+    if (message_arena != submessage_arena) {
+      int32 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int32, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int32_ = int32;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Int32Wrapper.int32)
+}
+
+// -------------------------------------------------------------------
+
+// UInt32Wrapper
+
+// .google.protobuf.UInt32Value uint32 = 1;
+inline bool UInt32Wrapper::has_uint32() const {
+  return this != internal_default_instance() && uint32_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::UInt32Value& UInt32Wrapper::uint32() const {
+  const PROTOBUF_NAMESPACE_ID::UInt32Value* p = uint32_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.UInt32Wrapper.uint32)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* UInt32Wrapper::release_uint32() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.UInt32Wrapper.uint32)
+  
+  PROTOBUF_NAMESPACE_ID::UInt32Value* temp = uint32_;
+  uint32_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::UInt32Value* UInt32Wrapper::mutable_uint32() {
+  
+  if (uint32_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaNoVirtual());
+    uint32_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.UInt32Wrapper.uint32)
+  return uint32_;
+}
+inline void UInt32Wrapper::set_allocated_uint32(PROTOBUF_NAMESPACE_ID::UInt32Value* uint32) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint32_);
+  }
+  if (uint32) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint32)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint32 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint32, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  uint32_ = uint32;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.UInt32Wrapper.uint32)
+}
+
+// -------------------------------------------------------------------
+
+// BoolWrapper
+
+// .google.protobuf.BoolValue bool = 1;
+inline bool BoolWrapper::has_bool_() const {
+  return this != internal_default_instance() && bool__ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::BoolValue& BoolWrapper::bool_() const {
+  const PROTOBUF_NAMESPACE_ID::BoolValue* p = bool__;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BoolWrapper.bool)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      &PROTOBUF_NAMESPACE_ID::_BoolValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* BoolWrapper::release_bool_() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.BoolWrapper.bool)
+  
+  PROTOBUF_NAMESPACE_ID::BoolValue* temp = bool__;
+  bool__ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::BoolValue* BoolWrapper::mutable_bool_() {
+  
+  if (bool__ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::BoolValue>(GetArenaNoVirtual());
+    bool__ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.BoolWrapper.bool)
+  return bool__;
+}
+inline void BoolWrapper::set_allocated_bool_(PROTOBUF_NAMESPACE_ID::BoolValue* bool_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bool__);
+  }
+  if (bool_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bool_)->GetArena();
+    if (message_arena != submessage_arena) {
+      bool_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bool_, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bool__ = bool_;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.BoolWrapper.bool)
+}
+
+// -------------------------------------------------------------------
+
+// StringWrapper
+
+// .google.protobuf.StringValue string = 1;
+inline bool StringWrapper::has_string() const {
+  return this != internal_default_instance() && string_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::StringValue& StringWrapper::string() const {
+  const PROTOBUF_NAMESPACE_ID::StringValue* p = string_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.StringWrapper.string)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::StringValue*>(
+      &PROTOBUF_NAMESPACE_ID::_StringValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* StringWrapper::release_string() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.StringWrapper.string)
+  
+  PROTOBUF_NAMESPACE_ID::StringValue* temp = string_;
+  string_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::StringValue* StringWrapper::mutable_string() {
+  
+  if (string_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::StringValue>(GetArenaNoVirtual());
+    string_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.StringWrapper.string)
+  return string_;
+}
+inline void StringWrapper::set_allocated_string(PROTOBUF_NAMESPACE_ID::StringValue* string) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(string_);
+  }
+  if (string) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(string)->GetArena();
+    if (message_arena != submessage_arena) {
+      string = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, string, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  string_ = string;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.StringWrapper.string)
+}
+
+// -------------------------------------------------------------------
+
+// BytesWrapper
+
+// .google.protobuf.BytesValue bytes = 1;
+inline bool BytesWrapper::has_bytes() const {
+  return this != internal_default_instance() && bytes_ != nullptr;
+}
+inline const PROTOBUF_NAMESPACE_ID::BytesValue& BytesWrapper::bytes() const {
+  const PROTOBUF_NAMESPACE_ID::BytesValue* p = bytes_;
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BytesWrapper.bytes)
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      &PROTOBUF_NAMESPACE_ID::_BytesValue_default_instance_);
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* BytesWrapper::release_bytes() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.BytesWrapper.bytes)
+  
+  PROTOBUF_NAMESPACE_ID::BytesValue* temp = bytes_;
+  bytes_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::BytesValue* BytesWrapper::mutable_bytes() {
+  
+  if (bytes_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::BytesValue>(GetArenaNoVirtual());
+    bytes_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.BytesWrapper.bytes)
+  return bytes_;
+}
+inline void BytesWrapper::set_allocated_bytes(PROTOBUF_NAMESPACE_ID::BytesValue* bytes) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bytes_);
+  }
+  if (bytes) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bytes)->GetArena();
+    if (message_arena != submessage_arena) {
+      bytes = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bytes, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bytes_ = bytes;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.BytesWrapper.bytes)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto
@@ -0,0 +1,3254 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/json_format.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2fjson_5fformat_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2fjson_5fformat_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3007000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[16]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+void AddDescriptors_google_2fprotobuf_2futil_2fjson_5fformat_2eproto();
+namespace protobuf_unittest {
+class TestBase64ByteArrays;
+class TestBase64ByteArraysDefaultTypeInternal;
+extern TestBase64ByteArraysDefaultTypeInternal _TestBase64ByteArrays_default_instance_;
+class TestBoolMap;
+class TestBoolMapDefaultTypeInternal;
+extern TestBoolMapDefaultTypeInternal _TestBoolMap_default_instance_;
+class TestBoolMap_BoolMapEntry_DoNotUse;
+class TestBoolMap_BoolMapEntry_DoNotUseDefaultTypeInternal;
+extern TestBoolMap_BoolMapEntry_DoNotUseDefaultTypeInternal _TestBoolMap_BoolMapEntry_DoNotUse_default_instance_;
+class TestCamelCase;
+class TestCamelCaseDefaultTypeInternal;
+extern TestCamelCaseDefaultTypeInternal _TestCamelCase_default_instance_;
+class TestFlagsAndStrings;
+class TestFlagsAndStringsDefaultTypeInternal;
+extern TestFlagsAndStringsDefaultTypeInternal _TestFlagsAndStrings_default_instance_;
+class TestFlagsAndStrings_RepeatedGroup;
+class TestFlagsAndStrings_RepeatedGroupDefaultTypeInternal;
+extern TestFlagsAndStrings_RepeatedGroupDefaultTypeInternal _TestFlagsAndStrings_RepeatedGroup_default_instance_;
+class TestJavaScriptJSON;
+class TestJavaScriptJSONDefaultTypeInternal;
+extern TestJavaScriptJSONDefaultTypeInternal _TestJavaScriptJSON_default_instance_;
+class TestJavaScriptOrderJSON1;
+class TestJavaScriptOrderJSON1DefaultTypeInternal;
+extern TestJavaScriptOrderJSON1DefaultTypeInternal _TestJavaScriptOrderJSON1_default_instance_;
+class TestJavaScriptOrderJSON2;
+class TestJavaScriptOrderJSON2DefaultTypeInternal;
+extern TestJavaScriptOrderJSON2DefaultTypeInternal _TestJavaScriptOrderJSON2_default_instance_;
+class TestLargeInt;
+class TestLargeIntDefaultTypeInternal;
+extern TestLargeIntDefaultTypeInternal _TestLargeInt_default_instance_;
+class TestNumbers;
+class TestNumbersDefaultTypeInternal;
+extern TestNumbersDefaultTypeInternal _TestNumbers_default_instance_;
+class TestRecursion;
+class TestRecursionDefaultTypeInternal;
+extern TestRecursionDefaultTypeInternal _TestRecursion_default_instance_;
+class TestStringMap;
+class TestStringMapDefaultTypeInternal;
+extern TestStringMapDefaultTypeInternal _TestStringMap_default_instance_;
+class TestStringMap_StringMapEntry_DoNotUse;
+class TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal;
+extern TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal _TestStringMap_StringMapEntry_DoNotUse_default_instance_;
+class TestStringSerializer;
+class TestStringSerializerDefaultTypeInternal;
+extern TestStringSerializerDefaultTypeInternal _TestStringSerializer_default_instance_;
+class TestStringSerializer_StringMapEntry_DoNotUse;
+class TestStringSerializer_StringMapEntry_DoNotUseDefaultTypeInternal;
+extern TestStringSerializer_StringMapEntry_DoNotUseDefaultTypeInternal _TestStringSerializer_StringMapEntry_DoNotUse_default_instance_;
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest::TestBase64ByteArrays* Arena::CreateMaybeMessage<::protobuf_unittest::TestBase64ByteArrays>(Arena*);
+template<> ::protobuf_unittest::TestBoolMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestBoolMap>(Arena*);
+template<> ::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestBoolMap_BoolMapEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestCamelCase* Arena::CreateMaybeMessage<::protobuf_unittest::TestCamelCase>(Arena*);
+template<> ::protobuf_unittest::TestFlagsAndStrings* Arena::CreateMaybeMessage<::protobuf_unittest::TestFlagsAndStrings>(Arena*);
+template<> ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup* Arena::CreateMaybeMessage<::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup>(Arena*);
+template<> ::protobuf_unittest::TestJavaScriptJSON* Arena::CreateMaybeMessage<::protobuf_unittest::TestJavaScriptJSON>(Arena*);
+template<> ::protobuf_unittest::TestJavaScriptOrderJSON1* Arena::CreateMaybeMessage<::protobuf_unittest::TestJavaScriptOrderJSON1>(Arena*);
+template<> ::protobuf_unittest::TestJavaScriptOrderJSON2* Arena::CreateMaybeMessage<::protobuf_unittest::TestJavaScriptOrderJSON2>(Arena*);
+template<> ::protobuf_unittest::TestLargeInt* Arena::CreateMaybeMessage<::protobuf_unittest::TestLargeInt>(Arena*);
+template<> ::protobuf_unittest::TestNumbers* Arena::CreateMaybeMessage<::protobuf_unittest::TestNumbers>(Arena*);
+template<> ::protobuf_unittest::TestRecursion* Arena::CreateMaybeMessage<::protobuf_unittest::TestRecursion>(Arena*);
+template<> ::protobuf_unittest::TestStringMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestStringMap>(Arena*);
+template<> ::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestStringMap_StringMapEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestStringSerializer* Arena::CreateMaybeMessage<::protobuf_unittest::TestStringSerializer>(Arena*);
+template<> ::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestStringSerializer_StringMapEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest {
+
+enum TestNumbers_MyType {
+  TestNumbers_MyType_OK = 0,
+  TestNumbers_MyType_WARNING = 1,
+  TestNumbers_MyType_ERROR = 2
+};
+bool TestNumbers_MyType_IsValid(int value);
+constexpr TestNumbers_MyType TestNumbers_MyType_MyType_MIN = TestNumbers_MyType_OK;
+constexpr TestNumbers_MyType TestNumbers_MyType_MyType_MAX = TestNumbers_MyType_ERROR;
+constexpr int TestNumbers_MyType_MyType_ARRAYSIZE = TestNumbers_MyType_MyType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TestNumbers_MyType_descriptor();
+inline const std::string& TestNumbers_MyType_Name(TestNumbers_MyType value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TestNumbers_MyType_descriptor(), value);
+}
+inline bool TestNumbers_MyType_Parse(
+    const std::string& name, TestNumbers_MyType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TestNumbers_MyType>(
+    TestNumbers_MyType_descriptor(), name, value);
+}
+// ===================================================================
+
+class TestFlagsAndStrings_RepeatedGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup) */ {
+ public:
+  TestFlagsAndStrings_RepeatedGroup();
+  virtual ~TestFlagsAndStrings_RepeatedGroup();
+
+  TestFlagsAndStrings_RepeatedGroup(const TestFlagsAndStrings_RepeatedGroup& from);
+  TestFlagsAndStrings_RepeatedGroup(TestFlagsAndStrings_RepeatedGroup&& from) noexcept
+    : TestFlagsAndStrings_RepeatedGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline TestFlagsAndStrings_RepeatedGroup& operator=(const TestFlagsAndStrings_RepeatedGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestFlagsAndStrings_RepeatedGroup& operator=(TestFlagsAndStrings_RepeatedGroup&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestFlagsAndStrings_RepeatedGroup& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestFlagsAndStrings_RepeatedGroup* internal_default_instance() {
+    return reinterpret_cast<const TestFlagsAndStrings_RepeatedGroup*>(
+               &_TestFlagsAndStrings_RepeatedGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  void Swap(TestFlagsAndStrings_RepeatedGroup* other);
+  friend void swap(TestFlagsAndStrings_RepeatedGroup& a, TestFlagsAndStrings_RepeatedGroup& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestFlagsAndStrings_RepeatedGroup* New() const final {
+    return CreateMaybeMessage<TestFlagsAndStrings_RepeatedGroup>(nullptr);
+  }
+
+  TestFlagsAndStrings_RepeatedGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestFlagsAndStrings_RepeatedGroup>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestFlagsAndStrings_RepeatedGroup& from);
+  void MergeFrom(const TestFlagsAndStrings_RepeatedGroup& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestFlagsAndStrings_RepeatedGroup* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestFlagsAndStrings.RepeatedGroup";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string f = 3;
+  bool has_f() const;
+  void clear_f();
+  static const int kFFieldNumber = 3;
+  const std::string& f() const;
+  void set_f(const std::string& value);
+  void set_f(std::string&& value);
+  void set_f(const char* value);
+  void set_f(const char* value, size_t size);
+  std::string* mutable_f();
+  std::string* release_f();
+  void set_allocated_f(std::string* f);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr f_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestFlagsAndStrings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestFlagsAndStrings) */ {
+ public:
+  TestFlagsAndStrings();
+  virtual ~TestFlagsAndStrings();
+
+  TestFlagsAndStrings(const TestFlagsAndStrings& from);
+  TestFlagsAndStrings(TestFlagsAndStrings&& from) noexcept
+    : TestFlagsAndStrings() {
+    *this = ::std::move(from);
+  }
+
+  inline TestFlagsAndStrings& operator=(const TestFlagsAndStrings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestFlagsAndStrings& operator=(TestFlagsAndStrings&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestFlagsAndStrings& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestFlagsAndStrings* internal_default_instance() {
+    return reinterpret_cast<const TestFlagsAndStrings*>(
+               &_TestFlagsAndStrings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  void Swap(TestFlagsAndStrings* other);
+  friend void swap(TestFlagsAndStrings& a, TestFlagsAndStrings& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestFlagsAndStrings* New() const final {
+    return CreateMaybeMessage<TestFlagsAndStrings>(nullptr);
+  }
+
+  TestFlagsAndStrings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestFlagsAndStrings>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestFlagsAndStrings& from);
+  void MergeFrom(const TestFlagsAndStrings& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestFlagsAndStrings* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestFlagsAndStrings";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TestFlagsAndStrings_RepeatedGroup RepeatedGroup;
+
+  // accessors -------------------------------------------------------
+
+  // repeated group RepeatedGroup = 2 { ... };
+  int repeatedgroup_size() const;
+  void clear_repeatedgroup();
+  static const int kRepeatedgroupFieldNumber = 2;
+  ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup* mutable_repeatedgroup(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup >*
+      mutable_repeatedgroup();
+  const ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup& repeatedgroup(int index) const;
+  ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup* add_repeatedgroup();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup >&
+      repeatedgroup() const;
+
+  // required int32 A = 1;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 a() const;
+  void set_a(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestFlagsAndStrings)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup > repeatedgroup_;
+  ::PROTOBUF_NAMESPACE_ID::int32 a_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestBase64ByteArrays final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestBase64ByteArrays) */ {
+ public:
+  TestBase64ByteArrays();
+  virtual ~TestBase64ByteArrays();
+
+  TestBase64ByteArrays(const TestBase64ByteArrays& from);
+  TestBase64ByteArrays(TestBase64ByteArrays&& from) noexcept
+    : TestBase64ByteArrays() {
+    *this = ::std::move(from);
+  }
+
+  inline TestBase64ByteArrays& operator=(const TestBase64ByteArrays& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestBase64ByteArrays& operator=(TestBase64ByteArrays&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestBase64ByteArrays& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestBase64ByteArrays* internal_default_instance() {
+    return reinterpret_cast<const TestBase64ByteArrays*>(
+               &_TestBase64ByteArrays_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  void Swap(TestBase64ByteArrays* other);
+  friend void swap(TestBase64ByteArrays& a, TestBase64ByteArrays& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestBase64ByteArrays* New() const final {
+    return CreateMaybeMessage<TestBase64ByteArrays>(nullptr);
+  }
+
+  TestBase64ByteArrays* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestBase64ByteArrays>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestBase64ByteArrays& from);
+  void MergeFrom(const TestBase64ByteArrays& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestBase64ByteArrays* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestBase64ByteArrays";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required bytes a = 1;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 1;
+  const std::string& a() const;
+  void set_a(const std::string& value);
+  void set_a(std::string&& value);
+  void set_a(const char* value);
+  void set_a(const void* value, size_t size);
+  std::string* mutable_a();
+  std::string* release_a();
+  void set_allocated_a(std::string* a);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestBase64ByteArrays)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr a_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJavaScriptJSON final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestJavaScriptJSON) */ {
+ public:
+  TestJavaScriptJSON();
+  virtual ~TestJavaScriptJSON();
+
+  TestJavaScriptJSON(const TestJavaScriptJSON& from);
+  TestJavaScriptJSON(TestJavaScriptJSON&& from) noexcept
+    : TestJavaScriptJSON() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJavaScriptJSON& operator=(const TestJavaScriptJSON& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJavaScriptJSON& operator=(TestJavaScriptJSON&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestJavaScriptJSON& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJavaScriptJSON* internal_default_instance() {
+    return reinterpret_cast<const TestJavaScriptJSON*>(
+               &_TestJavaScriptJSON_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  void Swap(TestJavaScriptJSON* other);
+  friend void swap(TestJavaScriptJSON& a, TestJavaScriptJSON& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJavaScriptJSON* New() const final {
+    return CreateMaybeMessage<TestJavaScriptJSON>(nullptr);
+  }
+
+  TestJavaScriptJSON* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJavaScriptJSON>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJavaScriptJSON& from);
+  void MergeFrom(const TestJavaScriptJSON& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJavaScriptJSON* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestJavaScriptJSON";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string in = 3;
+  bool has_in() const;
+  void clear_in();
+  static const int kInFieldNumber = 3;
+  const std::string& in() const;
+  void set_in(const std::string& value);
+  void set_in(std::string&& value);
+  void set_in(const char* value);
+  void set_in(const char* value, size_t size);
+  std::string* mutable_in();
+  std::string* release_in();
+  void set_allocated_in(std::string* in);
+
+  // optional string Var = 4;
+  bool has_var() const;
+  void clear_var();
+  static const int kVarFieldNumber = 4;
+  const std::string& var() const;
+  void set_var(const std::string& value);
+  void set_var(std::string&& value);
+  void set_var(const char* value);
+  void set_var(const char* value, size_t size);
+  std::string* mutable_var();
+  std::string* release_var();
+  void set_allocated_var(std::string* var);
+
+  // optional int32 a = 1;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 a() const;
+  void set_a(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional float final = 2;
+  bool has_final() const;
+  void clear_final();
+  static const int kFinalFieldNumber = 2;
+  float final() const;
+  void set_final(float value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestJavaScriptJSON)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr in_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var_;
+  ::PROTOBUF_NAMESPACE_ID::int32 a_;
+  float final_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJavaScriptOrderJSON1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestJavaScriptOrderJSON1) */ {
+ public:
+  TestJavaScriptOrderJSON1();
+  virtual ~TestJavaScriptOrderJSON1();
+
+  TestJavaScriptOrderJSON1(const TestJavaScriptOrderJSON1& from);
+  TestJavaScriptOrderJSON1(TestJavaScriptOrderJSON1&& from) noexcept
+    : TestJavaScriptOrderJSON1() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJavaScriptOrderJSON1& operator=(const TestJavaScriptOrderJSON1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJavaScriptOrderJSON1& operator=(TestJavaScriptOrderJSON1&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestJavaScriptOrderJSON1& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJavaScriptOrderJSON1* internal_default_instance() {
+    return reinterpret_cast<const TestJavaScriptOrderJSON1*>(
+               &_TestJavaScriptOrderJSON1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  void Swap(TestJavaScriptOrderJSON1* other);
+  friend void swap(TestJavaScriptOrderJSON1& a, TestJavaScriptOrderJSON1& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJavaScriptOrderJSON1* New() const final {
+    return CreateMaybeMessage<TestJavaScriptOrderJSON1>(nullptr);
+  }
+
+  TestJavaScriptOrderJSON1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJavaScriptOrderJSON1>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJavaScriptOrderJSON1& from);
+  void MergeFrom(const TestJavaScriptOrderJSON1& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJavaScriptOrderJSON1* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestJavaScriptOrderJSON1";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 d = 1;
+  bool has_d() const;
+  void clear_d();
+  static const int kDFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 d() const;
+  void set_d(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional int32 c = 2;
+  bool has_c() const;
+  void clear_c();
+  static const int kCFieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::int32 c() const;
+  void set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional bool x = 3;
+  bool has_x() const;
+  void clear_x();
+  static const int kXFieldNumber = 3;
+  bool x() const;
+  void set_x(bool value);
+
+  // optional int32 b = 4;
+  bool has_b() const;
+  void clear_b();
+  static const int kBFieldNumber = 4;
+  ::PROTOBUF_NAMESPACE_ID::int32 b() const;
+  void set_b(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional int32 a = 5;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 5;
+  ::PROTOBUF_NAMESPACE_ID::int32 a() const;
+  void set_a(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestJavaScriptOrderJSON1)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 d_;
+  ::PROTOBUF_NAMESPACE_ID::int32 c_;
+  bool x_;
+  ::PROTOBUF_NAMESPACE_ID::int32 b_;
+  ::PROTOBUF_NAMESPACE_ID::int32 a_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJavaScriptOrderJSON2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestJavaScriptOrderJSON2) */ {
+ public:
+  TestJavaScriptOrderJSON2();
+  virtual ~TestJavaScriptOrderJSON2();
+
+  TestJavaScriptOrderJSON2(const TestJavaScriptOrderJSON2& from);
+  TestJavaScriptOrderJSON2(TestJavaScriptOrderJSON2&& from) noexcept
+    : TestJavaScriptOrderJSON2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJavaScriptOrderJSON2& operator=(const TestJavaScriptOrderJSON2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJavaScriptOrderJSON2& operator=(TestJavaScriptOrderJSON2&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestJavaScriptOrderJSON2& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJavaScriptOrderJSON2* internal_default_instance() {
+    return reinterpret_cast<const TestJavaScriptOrderJSON2*>(
+               &_TestJavaScriptOrderJSON2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  void Swap(TestJavaScriptOrderJSON2* other);
+  friend void swap(TestJavaScriptOrderJSON2& a, TestJavaScriptOrderJSON2& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJavaScriptOrderJSON2* New() const final {
+    return CreateMaybeMessage<TestJavaScriptOrderJSON2>(nullptr);
+  }
+
+  TestJavaScriptOrderJSON2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJavaScriptOrderJSON2>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJavaScriptOrderJSON2& from);
+  void MergeFrom(const TestJavaScriptOrderJSON2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJavaScriptOrderJSON2* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestJavaScriptOrderJSON2";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .protobuf_unittest.TestJavaScriptOrderJSON1 z = 6;
+  int z_size() const;
+  void clear_z();
+  static const int kZFieldNumber = 6;
+  ::protobuf_unittest::TestJavaScriptOrderJSON1* mutable_z(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestJavaScriptOrderJSON1 >*
+      mutable_z();
+  const ::protobuf_unittest::TestJavaScriptOrderJSON1& z(int index) const;
+  ::protobuf_unittest::TestJavaScriptOrderJSON1* add_z();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestJavaScriptOrderJSON1 >&
+      z() const;
+
+  // optional int32 d = 1;
+  bool has_d() const;
+  void clear_d();
+  static const int kDFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 d() const;
+  void set_d(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional int32 c = 2;
+  bool has_c() const;
+  void clear_c();
+  static const int kCFieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::int32 c() const;
+  void set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional bool x = 3;
+  bool has_x() const;
+  void clear_x();
+  static const int kXFieldNumber = 3;
+  bool x() const;
+  void set_x(bool value);
+
+  // optional int32 b = 4;
+  bool has_b() const;
+  void clear_b();
+  static const int kBFieldNumber = 4;
+  ::PROTOBUF_NAMESPACE_ID::int32 b() const;
+  void set_b(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional int32 a = 5;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 5;
+  ::PROTOBUF_NAMESPACE_ID::int32 a() const;
+  void set_a(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestJavaScriptOrderJSON2)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestJavaScriptOrderJSON1 > z_;
+  ::PROTOBUF_NAMESPACE_ID::int32 d_;
+  ::PROTOBUF_NAMESPACE_ID::int32 c_;
+  bool x_;
+  ::PROTOBUF_NAMESPACE_ID::int32 b_;
+  ::PROTOBUF_NAMESPACE_ID::int32 a_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestLargeInt final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestLargeInt) */ {
+ public:
+  TestLargeInt();
+  virtual ~TestLargeInt();
+
+  TestLargeInt(const TestLargeInt& from);
+  TestLargeInt(TestLargeInt&& from) noexcept
+    : TestLargeInt() {
+    *this = ::std::move(from);
+  }
+
+  inline TestLargeInt& operator=(const TestLargeInt& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestLargeInt& operator=(TestLargeInt&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestLargeInt& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestLargeInt* internal_default_instance() {
+    return reinterpret_cast<const TestLargeInt*>(
+               &_TestLargeInt_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  void Swap(TestLargeInt* other);
+  friend void swap(TestLargeInt& a, TestLargeInt& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestLargeInt* New() const final {
+    return CreateMaybeMessage<TestLargeInt>(nullptr);
+  }
+
+  TestLargeInt* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestLargeInt>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestLargeInt& from);
+  void MergeFrom(const TestLargeInt& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestLargeInt* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestLargeInt";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required int64 a = 1;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int64 a() const;
+  void set_a(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // required uint64 b = 2;
+  bool has_b() const;
+  void clear_b();
+  static const int kBFieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::uint64 b() const;
+  void set_b(::PROTOBUF_NAMESPACE_ID::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestLargeInt)
+ private:
+  class HasBitSetters;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int64 a_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 b_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestNumbers final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestNumbers) */ {
+ public:
+  TestNumbers();
+  virtual ~TestNumbers();
+
+  TestNumbers(const TestNumbers& from);
+  TestNumbers(TestNumbers&& from) noexcept
+    : TestNumbers() {
+    *this = ::std::move(from);
+  }
+
+  inline TestNumbers& operator=(const TestNumbers& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestNumbers& operator=(TestNumbers&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestNumbers& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestNumbers* internal_default_instance() {
+    return reinterpret_cast<const TestNumbers*>(
+               &_TestNumbers_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  void Swap(TestNumbers* other);
+  friend void swap(TestNumbers& a, TestNumbers& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestNumbers* New() const final {
+    return CreateMaybeMessage<TestNumbers>(nullptr);
+  }
+
+  TestNumbers* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestNumbers>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestNumbers& from);
+  void MergeFrom(const TestNumbers& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestNumbers* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestNumbers";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TestNumbers_MyType MyType;
+  static constexpr MyType OK =
+    TestNumbers_MyType_OK;
+  static constexpr MyType WARNING =
+    TestNumbers_MyType_WARNING;
+  static constexpr MyType ERROR =
+    TestNumbers_MyType_ERROR;
+  static inline bool MyType_IsValid(int value) {
+    return TestNumbers_MyType_IsValid(value);
+  }
+  static constexpr MyType MyType_MIN =
+    TestNumbers_MyType_MyType_MIN;
+  static constexpr MyType MyType_MAX =
+    TestNumbers_MyType_MyType_MAX;
+  static constexpr int MyType_ARRAYSIZE =
+    TestNumbers_MyType_MyType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  MyType_descriptor() {
+    return TestNumbers_MyType_descriptor();
+  }
+  static inline const std::string& MyType_Name(MyType value) {
+    return TestNumbers_MyType_Name(value);
+  }
+  static inline bool MyType_Parse(const std::string& name,
+      MyType* value) {
+    return TestNumbers_MyType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // optional .protobuf_unittest.TestNumbers.MyType a = 1;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 1;
+  ::protobuf_unittest::TestNumbers_MyType a() const;
+  void set_a(::protobuf_unittest::TestNumbers_MyType value);
+
+  // optional int32 b = 2;
+  bool has_b() const;
+  void clear_b();
+  static const int kBFieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::int32 b() const;
+  void set_b(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional float c = 3;
+  bool has_c() const;
+  void clear_c();
+  static const int kCFieldNumber = 3;
+  float c() const;
+  void set_c(float value);
+
+  // optional bool d = 4;
+  bool has_d() const;
+  void clear_d();
+  static const int kDFieldNumber = 4;
+  bool d() const;
+  void set_d(bool value);
+
+  // optional double e = 5;
+  bool has_e() const;
+  void clear_e();
+  static const int kEFieldNumber = 5;
+  double e() const;
+  void set_e(double value);
+
+  // optional uint32 f = 6;
+  bool has_f() const;
+  void clear_f();
+  static const int kFFieldNumber = 6;
+  ::PROTOBUF_NAMESPACE_ID::uint32 f() const;
+  void set_f(::PROTOBUF_NAMESPACE_ID::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestNumbers)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  int a_;
+  ::PROTOBUF_NAMESPACE_ID::int32 b_;
+  float c_;
+  bool d_;
+  double e_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 f_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestCamelCase final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestCamelCase) */ {
+ public:
+  TestCamelCase();
+  virtual ~TestCamelCase();
+
+  TestCamelCase(const TestCamelCase& from);
+  TestCamelCase(TestCamelCase&& from) noexcept
+    : TestCamelCase() {
+    *this = ::std::move(from);
+  }
+
+  inline TestCamelCase& operator=(const TestCamelCase& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestCamelCase& operator=(TestCamelCase&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestCamelCase& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestCamelCase* internal_default_instance() {
+    return reinterpret_cast<const TestCamelCase*>(
+               &_TestCamelCase_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  void Swap(TestCamelCase* other);
+  friend void swap(TestCamelCase& a, TestCamelCase& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestCamelCase* New() const final {
+    return CreateMaybeMessage<TestCamelCase>(nullptr);
+  }
+
+  TestCamelCase* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestCamelCase>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestCamelCase& from);
+  void MergeFrom(const TestCamelCase& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestCamelCase* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestCamelCase";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string normal_field = 1;
+  bool has_normal_field() const;
+  void clear_normal_field();
+  static const int kNormalFieldFieldNumber = 1;
+  const std::string& normal_field() const;
+  void set_normal_field(const std::string& value);
+  void set_normal_field(std::string&& value);
+  void set_normal_field(const char* value);
+  void set_normal_field(const char* value, size_t size);
+  std::string* mutable_normal_field();
+  std::string* release_normal_field();
+  void set_allocated_normal_field(std::string* normal_field);
+
+  // optional int32 CAPITAL_FIELD = 2;
+  bool has_capital_field() const;
+  void clear_capital_field();
+  static const int kCAPITALFIELDFieldNumber = 2;
+  ::PROTOBUF_NAMESPACE_ID::int32 capital_field() const;
+  void set_capital_field(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // optional int32 CamelCaseField = 3;
+  bool has_camelcasefield() const;
+  void clear_camelcasefield();
+  static const int kCamelCaseFieldFieldNumber = 3;
+  ::PROTOBUF_NAMESPACE_ID::int32 camelcasefield() const;
+  void set_camelcasefield(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestCamelCase)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr normal_field_;
+  ::PROTOBUF_NAMESPACE_ID::int32 capital_field_;
+  ::PROTOBUF_NAMESPACE_ID::int32 camelcasefield_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestBoolMap_BoolMapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestBoolMap_BoolMapEntry_DoNotUse, 
+    bool, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestBoolMap_BoolMapEntry_DoNotUse, 
+    bool, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestBoolMap_BoolMapEntry_DoNotUse();
+  TestBoolMap_BoolMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestBoolMap_BoolMapEntry_DoNotUse& other);
+  static const TestBoolMap_BoolMapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestBoolMap_BoolMapEntry_DoNotUse*>(&_TestBoolMap_BoolMapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const { return true; }
+  bool ValidateValue() const { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class TestBoolMap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestBoolMap) */ {
+ public:
+  TestBoolMap();
+  virtual ~TestBoolMap();
+
+  TestBoolMap(const TestBoolMap& from);
+  TestBoolMap(TestBoolMap&& from) noexcept
+    : TestBoolMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestBoolMap& operator=(const TestBoolMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestBoolMap& operator=(TestBoolMap&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestBoolMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestBoolMap* internal_default_instance() {
+    return reinterpret_cast<const TestBoolMap*>(
+               &_TestBoolMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  void Swap(TestBoolMap* other);
+  friend void swap(TestBoolMap& a, TestBoolMap& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestBoolMap* New() const final {
+    return CreateMaybeMessage<TestBoolMap>(nullptr);
+  }
+
+  TestBoolMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestBoolMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestBoolMap& from);
+  void MergeFrom(const TestBoolMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestBoolMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestBoolMap";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<bool, int32> bool_map = 1;
+  int bool_map_size() const;
+  void clear_bool_map();
+  static const int kBoolMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      bool_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_bool_map();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestBoolMap)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestBoolMap_BoolMapEntry_DoNotUse,
+      bool, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > bool_map_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestRecursion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRecursion) */ {
+ public:
+  TestRecursion();
+  virtual ~TestRecursion();
+
+  TestRecursion(const TestRecursion& from);
+  TestRecursion(TestRecursion&& from) noexcept
+    : TestRecursion() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRecursion& operator=(const TestRecursion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRecursion& operator=(TestRecursion&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestRecursion& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestRecursion* internal_default_instance() {
+    return reinterpret_cast<const TestRecursion*>(
+               &_TestRecursion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  void Swap(TestRecursion* other);
+  friend void swap(TestRecursion& a, TestRecursion& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestRecursion* New() const final {
+    return CreateMaybeMessage<TestRecursion>(nullptr);
+  }
+
+  TestRecursion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestRecursion>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestRecursion& from);
+  void MergeFrom(const TestRecursion& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestRecursion* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestRecursion";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional .protobuf_unittest.TestRecursion child = 2;
+  bool has_child() const;
+  void clear_child();
+  static const int kChildFieldNumber = 2;
+  const ::protobuf_unittest::TestRecursion& child() const;
+  ::protobuf_unittest::TestRecursion* release_child();
+  ::protobuf_unittest::TestRecursion* mutable_child();
+  void set_allocated_child(::protobuf_unittest::TestRecursion* child);
+
+  // optional int32 value = 1;
+  bool has_value() const;
+  void clear_value();
+  static const int kValueFieldNumber = 1;
+  ::PROTOBUF_NAMESPACE_ID::int32 value() const;
+  void set_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRecursion)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::protobuf_unittest::TestRecursion* child_;
+  ::PROTOBUF_NAMESPACE_ID::int32 value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestStringMap_StringMapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestStringMap_StringMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestStringMap_StringMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  TestStringMap_StringMapEntry_DoNotUse();
+  TestStringMap_StringMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestStringMap_StringMapEntry_DoNotUse& other);
+  static const TestStringMap_StringMapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestStringMap_StringMapEntry_DoNotUse*>(&_TestStringMap_StringMapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+       key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestStringMap.StringMapEntry.key");
+    return true;
+ }
+  bool ValidateValue() const {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+       value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestStringMap.StringMapEntry.value");
+    return true;
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class TestStringMap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestStringMap) */ {
+ public:
+  TestStringMap();
+  virtual ~TestStringMap();
+
+  TestStringMap(const TestStringMap& from);
+  TestStringMap(TestStringMap&& from) noexcept
+    : TestStringMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestStringMap& operator=(const TestStringMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestStringMap& operator=(TestStringMap&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestStringMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestStringMap* internal_default_instance() {
+    return reinterpret_cast<const TestStringMap*>(
+               &_TestStringMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  void Swap(TestStringMap* other);
+  friend void swap(TestStringMap& a, TestStringMap& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestStringMap* New() const final {
+    return CreateMaybeMessage<TestStringMap>(nullptr);
+  }
+
+  TestStringMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestStringMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestStringMap& from);
+  void MergeFrom(const TestStringMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestStringMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestStringMap";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // map<string, string> string_map = 1;
+  int string_map_size() const;
+  void clear_string_map();
+  static const int kStringMapFieldNumber = 1;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      string_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_string_map();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestStringMap)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestStringMap_StringMapEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > string_map_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestStringSerializer_StringMapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestStringSerializer_StringMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestStringSerializer_StringMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  TestStringSerializer_StringMapEntry_DoNotUse();
+  TestStringSerializer_StringMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestStringSerializer_StringMapEntry_DoNotUse& other);
+  static const TestStringSerializer_StringMapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestStringSerializer_StringMapEntry_DoNotUse*>(&_TestStringSerializer_StringMapEntry_DoNotUse_default_instance_); }
+  bool ValidateKey() const {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+       key().data(), key().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestStringSerializer.StringMapEntry.key");
+    return true;
+ }
+  bool ValidateValue() const {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+       value().data(), value().size(), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestStringSerializer.StringMapEntry.value");
+    return true;
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const;
+};
+
+// -------------------------------------------------------------------
+
+class TestStringSerializer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestStringSerializer) */ {
+ public:
+  TestStringSerializer();
+  virtual ~TestStringSerializer();
+
+  TestStringSerializer(const TestStringSerializer& from);
+  TestStringSerializer(TestStringSerializer&& from) noexcept
+    : TestStringSerializer() {
+    *this = ::std::move(from);
+  }
+
+  inline TestStringSerializer& operator=(const TestStringSerializer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestStringSerializer& operator=(TestStringSerializer&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return default_instance().GetDescriptor();
+  }
+  static const TestStringSerializer& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestStringSerializer* internal_default_instance() {
+    return reinterpret_cast<const TestStringSerializer*>(
+               &_TestStringSerializer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  void Swap(TestStringSerializer* other);
+  friend void swap(TestStringSerializer& a, TestStringSerializer& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestStringSerializer* New() const final {
+    return CreateMaybeMessage<TestStringSerializer>(nullptr);
+  }
+
+  TestStringSerializer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestStringSerializer>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestStringSerializer& from);
+  void MergeFrom(const TestStringSerializer& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestStringSerializer* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestStringSerializer";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  // repeated string repeated_string = 2;
+  int repeated_string_size() const;
+  void clear_repeated_string();
+  static const int kRepeatedStringFieldNumber = 2;
+  const std::string& repeated_string(int index) const;
+  std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const std::string& value);
+  void set_repeated_string(int index, std::string&& value);
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, size_t size);
+  std::string* add_repeated_string();
+  void add_repeated_string(const std::string& value);
+  void add_repeated_string(std::string&& value);
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& repeated_string() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_repeated_string();
+
+  // map<string, string> string_map = 3;
+  int string_map_size() const;
+  void clear_string_map();
+  static const int kStringMapFieldNumber = 3;
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      string_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_string_map();
+
+  // optional string scalar_string = 1;
+  bool has_scalar_string() const;
+  void clear_scalar_string();
+  static const int kScalarStringFieldNumber = 1;
+  const std::string& scalar_string() const;
+  void set_scalar_string(const std::string& value);
+  void set_scalar_string(std::string&& value);
+  void set_scalar_string(const char* value);
+  void set_scalar_string(const char* value, size_t size);
+  std::string* mutable_scalar_string();
+  std::string* release_scalar_string();
+  void set_allocated_scalar_string(std::string* scalar_string);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestStringSerializer)
+ private:
+  class HasBitSetters;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> repeated_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestStringSerializer_StringMapEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > string_map_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scalar_string_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TestFlagsAndStrings_RepeatedGroup
+
+// required string f = 3;
+inline bool TestFlagsAndStrings_RepeatedGroup::has_f() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestFlagsAndStrings_RepeatedGroup::clear_f() {
+  f_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestFlagsAndStrings_RepeatedGroup::f() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+  return f_.GetNoArena();
+}
+inline void TestFlagsAndStrings_RepeatedGroup::set_f(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  f_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+}
+inline void TestFlagsAndStrings_RepeatedGroup::set_f(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  f_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+}
+inline void TestFlagsAndStrings_RepeatedGroup::set_f(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  f_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+}
+inline void TestFlagsAndStrings_RepeatedGroup::set_f(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  f_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+}
+inline std::string* TestFlagsAndStrings_RepeatedGroup::mutable_f() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+  return f_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* TestFlagsAndStrings_RepeatedGroup::release_f() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+  if (!has_f()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return f_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestFlagsAndStrings_RepeatedGroup::set_allocated_f(std::string* f) {
+  if (f != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  f_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), f);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestFlagsAndStrings.RepeatedGroup.f)
+}
+
+// -------------------------------------------------------------------
+
+// TestFlagsAndStrings
+
+// required int32 A = 1;
+inline bool TestFlagsAndStrings::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestFlagsAndStrings::clear_a() {
+  a_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestFlagsAndStrings::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestFlagsAndStrings.A)
+  return a_;
+}
+inline void TestFlagsAndStrings::set_a(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestFlagsAndStrings.A)
+}
+
+// repeated group RepeatedGroup = 2 { ... };
+inline int TestFlagsAndStrings::repeatedgroup_size() const {
+  return repeatedgroup_.size();
+}
+inline void TestFlagsAndStrings::clear_repeatedgroup() {
+  repeatedgroup_.Clear();
+}
+inline ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup* TestFlagsAndStrings::mutable_repeatedgroup(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestFlagsAndStrings.repeatedgroup)
+  return repeatedgroup_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup >*
+TestFlagsAndStrings::mutable_repeatedgroup() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestFlagsAndStrings.repeatedgroup)
+  return &repeatedgroup_;
+}
+inline const ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup& TestFlagsAndStrings::repeatedgroup(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestFlagsAndStrings.repeatedgroup)
+  return repeatedgroup_.Get(index);
+}
+inline ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup* TestFlagsAndStrings::add_repeatedgroup() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestFlagsAndStrings.repeatedgroup)
+  return repeatedgroup_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestFlagsAndStrings_RepeatedGroup >&
+TestFlagsAndStrings::repeatedgroup() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestFlagsAndStrings.repeatedgroup)
+  return repeatedgroup_;
+}
+
+// -------------------------------------------------------------------
+
+// TestBase64ByteArrays
+
+// required bytes a = 1;
+inline bool TestBase64ByteArrays::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestBase64ByteArrays::clear_a() {
+  a_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestBase64ByteArrays::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestBase64ByteArrays.a)
+  return a_.GetNoArena();
+}
+inline void TestBase64ByteArrays::set_a(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  a_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestBase64ByteArrays.a)
+}
+inline void TestBase64ByteArrays::set_a(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  a_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestBase64ByteArrays.a)
+}
+inline void TestBase64ByteArrays::set_a(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  a_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestBase64ByteArrays.a)
+}
+inline void TestBase64ByteArrays::set_a(const void* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  a_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestBase64ByteArrays.a)
+}
+inline std::string* TestBase64ByteArrays::mutable_a() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestBase64ByteArrays.a)
+  return a_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* TestBase64ByteArrays::release_a() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestBase64ByteArrays.a)
+  if (!has_a()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return a_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestBase64ByteArrays::set_allocated_a(std::string* a) {
+  if (a != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  a_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), a);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestBase64ByteArrays.a)
+}
+
+// -------------------------------------------------------------------
+
+// TestJavaScriptJSON
+
+// optional int32 a = 1;
+inline bool TestJavaScriptJSON::has_a() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestJavaScriptJSON::clear_a() {
+  a_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptJSON::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptJSON.a)
+  return a_;
+}
+inline void TestJavaScriptJSON::set_a(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptJSON.a)
+}
+
+// optional float final = 2;
+inline bool TestJavaScriptJSON::has_final() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TestJavaScriptJSON::clear_final() {
+  final_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline float TestJavaScriptJSON::final() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptJSON.final)
+  return final_;
+}
+inline void TestJavaScriptJSON::set_final(float value) {
+  _has_bits_[0] |= 0x00000008u;
+  final_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptJSON.final)
+}
+
+// optional string in = 3;
+inline bool TestJavaScriptJSON::has_in() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestJavaScriptJSON::clear_in() {
+  in_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestJavaScriptJSON::in() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptJSON.in)
+  return in_.GetNoArena();
+}
+inline void TestJavaScriptJSON::set_in(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  in_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptJSON.in)
+}
+inline void TestJavaScriptJSON::set_in(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  in_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestJavaScriptJSON.in)
+}
+inline void TestJavaScriptJSON::set_in(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  in_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestJavaScriptJSON.in)
+}
+inline void TestJavaScriptJSON::set_in(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  in_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestJavaScriptJSON.in)
+}
+inline std::string* TestJavaScriptJSON::mutable_in() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestJavaScriptJSON.in)
+  return in_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* TestJavaScriptJSON::release_in() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestJavaScriptJSON.in)
+  if (!has_in()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return in_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestJavaScriptJSON::set_allocated_in(std::string* in) {
+  if (in != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  in_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), in);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestJavaScriptJSON.in)
+}
+
+// optional string Var = 4;
+inline bool TestJavaScriptJSON::has_var() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestJavaScriptJSON::clear_var() {
+  var_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TestJavaScriptJSON::var() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptJSON.Var)
+  return var_.GetNoArena();
+}
+inline void TestJavaScriptJSON::set_var(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  var_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptJSON.Var)
+}
+inline void TestJavaScriptJSON::set_var(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  var_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestJavaScriptJSON.Var)
+}
+inline void TestJavaScriptJSON::set_var(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  var_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestJavaScriptJSON.Var)
+}
+inline void TestJavaScriptJSON::set_var(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  var_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestJavaScriptJSON.Var)
+}
+inline std::string* TestJavaScriptJSON::mutable_var() {
+  _has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestJavaScriptJSON.Var)
+  return var_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* TestJavaScriptJSON::release_var() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestJavaScriptJSON.Var)
+  if (!has_var()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return var_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestJavaScriptJSON::set_allocated_var(std::string* var) {
+  if (var != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  var_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), var);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestJavaScriptJSON.Var)
+}
+
+// -------------------------------------------------------------------
+
+// TestJavaScriptOrderJSON1
+
+// optional int32 d = 1;
+inline bool TestJavaScriptOrderJSON1::has_d() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestJavaScriptOrderJSON1::clear_d() {
+  d_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON1::d() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON1.d)
+  return d_;
+}
+inline void TestJavaScriptOrderJSON1::set_d(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  d_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON1.d)
+}
+
+// optional int32 c = 2;
+inline bool TestJavaScriptOrderJSON1::has_c() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestJavaScriptOrderJSON1::clear_c() {
+  c_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON1::c() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON1.c)
+  return c_;
+}
+inline void TestJavaScriptOrderJSON1::set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  c_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON1.c)
+}
+
+// optional bool x = 3;
+inline bool TestJavaScriptOrderJSON1::has_x() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestJavaScriptOrderJSON1::clear_x() {
+  x_ = false;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline bool TestJavaScriptOrderJSON1::x() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON1.x)
+  return x_;
+}
+inline void TestJavaScriptOrderJSON1::set_x(bool value) {
+  _has_bits_[0] |= 0x00000004u;
+  x_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON1.x)
+}
+
+// optional int32 b = 4;
+inline bool TestJavaScriptOrderJSON1::has_b() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TestJavaScriptOrderJSON1::clear_b() {
+  b_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON1::b() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON1.b)
+  return b_;
+}
+inline void TestJavaScriptOrderJSON1::set_b(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  b_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON1.b)
+}
+
+// optional int32 a = 5;
+inline bool TestJavaScriptOrderJSON1::has_a() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TestJavaScriptOrderJSON1::clear_a() {
+  a_ = 0;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON1::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON1.a)
+  return a_;
+}
+inline void TestJavaScriptOrderJSON1::set_a(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000010u;
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON1.a)
+}
+
+// -------------------------------------------------------------------
+
+// TestJavaScriptOrderJSON2
+
+// optional int32 d = 1;
+inline bool TestJavaScriptOrderJSON2::has_d() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestJavaScriptOrderJSON2::clear_d() {
+  d_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON2::d() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON2.d)
+  return d_;
+}
+inline void TestJavaScriptOrderJSON2::set_d(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  d_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON2.d)
+}
+
+// optional int32 c = 2;
+inline bool TestJavaScriptOrderJSON2::has_c() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestJavaScriptOrderJSON2::clear_c() {
+  c_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON2::c() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON2.c)
+  return c_;
+}
+inline void TestJavaScriptOrderJSON2::set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  c_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON2.c)
+}
+
+// optional bool x = 3;
+inline bool TestJavaScriptOrderJSON2::has_x() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestJavaScriptOrderJSON2::clear_x() {
+  x_ = false;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline bool TestJavaScriptOrderJSON2::x() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON2.x)
+  return x_;
+}
+inline void TestJavaScriptOrderJSON2::set_x(bool value) {
+  _has_bits_[0] |= 0x00000004u;
+  x_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON2.x)
+}
+
+// optional int32 b = 4;
+inline bool TestJavaScriptOrderJSON2::has_b() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TestJavaScriptOrderJSON2::clear_b() {
+  b_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON2::b() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON2.b)
+  return b_;
+}
+inline void TestJavaScriptOrderJSON2::set_b(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  b_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON2.b)
+}
+
+// optional int32 a = 5;
+inline bool TestJavaScriptOrderJSON2::has_a() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TestJavaScriptOrderJSON2::clear_a() {
+  a_ = 0;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJavaScriptOrderJSON2::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON2.a)
+  return a_;
+}
+inline void TestJavaScriptOrderJSON2::set_a(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000010u;
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestJavaScriptOrderJSON2.a)
+}
+
+// repeated .protobuf_unittest.TestJavaScriptOrderJSON1 z = 6;
+inline int TestJavaScriptOrderJSON2::z_size() const {
+  return z_.size();
+}
+inline void TestJavaScriptOrderJSON2::clear_z() {
+  z_.Clear();
+}
+inline ::protobuf_unittest::TestJavaScriptOrderJSON1* TestJavaScriptOrderJSON2::mutable_z(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestJavaScriptOrderJSON2.z)
+  return z_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestJavaScriptOrderJSON1 >*
+TestJavaScriptOrderJSON2::mutable_z() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestJavaScriptOrderJSON2.z)
+  return &z_;
+}
+inline const ::protobuf_unittest::TestJavaScriptOrderJSON1& TestJavaScriptOrderJSON2::z(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestJavaScriptOrderJSON2.z)
+  return z_.Get(index);
+}
+inline ::protobuf_unittest::TestJavaScriptOrderJSON1* TestJavaScriptOrderJSON2::add_z() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestJavaScriptOrderJSON2.z)
+  return z_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest::TestJavaScriptOrderJSON1 >&
+TestJavaScriptOrderJSON2::z() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestJavaScriptOrderJSON2.z)
+  return z_;
+}
+
+// -------------------------------------------------------------------
+
+// TestLargeInt
+
+// required int64 a = 1;
+inline bool TestLargeInt::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestLargeInt::clear_a() {
+  a_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestLargeInt::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLargeInt.a)
+  return a_;
+}
+inline void TestLargeInt::set_a(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000001u;
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLargeInt.a)
+}
+
+// required uint64 b = 2;
+inline bool TestLargeInt::has_b() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestLargeInt::clear_b() {
+  b_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestLargeInt::b() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLargeInt.b)
+  return b_;
+}
+inline void TestLargeInt::set_b(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000002u;
+  b_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLargeInt.b)
+}
+
+// -------------------------------------------------------------------
+
+// TestNumbers
+
+// optional .protobuf_unittest.TestNumbers.MyType a = 1;
+inline bool TestNumbers::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestNumbers::clear_a() {
+  a_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::protobuf_unittest::TestNumbers_MyType TestNumbers::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestNumbers.a)
+  return static_cast< ::protobuf_unittest::TestNumbers_MyType >(a_);
+}
+inline void TestNumbers::set_a(::protobuf_unittest::TestNumbers_MyType value) {
+  assert(::protobuf_unittest::TestNumbers_MyType_IsValid(value));
+  _has_bits_[0] |= 0x00000001u;
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestNumbers.a)
+}
+
+// optional int32 b = 2;
+inline bool TestNumbers::has_b() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestNumbers::clear_b() {
+  b_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestNumbers::b() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestNumbers.b)
+  return b_;
+}
+inline void TestNumbers::set_b(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  b_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestNumbers.b)
+}
+
+// optional float c = 3;
+inline bool TestNumbers::has_c() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestNumbers::clear_c() {
+  c_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline float TestNumbers::c() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestNumbers.c)
+  return c_;
+}
+inline void TestNumbers::set_c(float value) {
+  _has_bits_[0] |= 0x00000004u;
+  c_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestNumbers.c)
+}
+
+// optional bool d = 4;
+inline bool TestNumbers::has_d() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TestNumbers::clear_d() {
+  d_ = false;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline bool TestNumbers::d() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestNumbers.d)
+  return d_;
+}
+inline void TestNumbers::set_d(bool value) {
+  _has_bits_[0] |= 0x00000008u;
+  d_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestNumbers.d)
+}
+
+// optional double e = 5;
+inline bool TestNumbers::has_e() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TestNumbers::clear_e() {
+  e_ = 0;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline double TestNumbers::e() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestNumbers.e)
+  return e_;
+}
+inline void TestNumbers::set_e(double value) {
+  _has_bits_[0] |= 0x00000010u;
+  e_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestNumbers.e)
+}
+
+// optional uint32 f = 6;
+inline bool TestNumbers::has_f() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void TestNumbers::clear_f() {
+  f_ = 0u;
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestNumbers::f() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestNumbers.f)
+  return f_;
+}
+inline void TestNumbers::set_f(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000020u;
+  f_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestNumbers.f)
+}
+
+// -------------------------------------------------------------------
+
+// TestCamelCase
+
+// optional string normal_field = 1;
+inline bool TestCamelCase::has_normal_field() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestCamelCase::clear_normal_field() {
+  normal_field_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestCamelCase::normal_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestCamelCase.normal_field)
+  return normal_field_.GetNoArena();
+}
+inline void TestCamelCase::set_normal_field(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  normal_field_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestCamelCase.normal_field)
+}
+inline void TestCamelCase::set_normal_field(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  normal_field_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestCamelCase.normal_field)
+}
+inline void TestCamelCase::set_normal_field(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  normal_field_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestCamelCase.normal_field)
+}
+inline void TestCamelCase::set_normal_field(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  normal_field_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestCamelCase.normal_field)
+}
+inline std::string* TestCamelCase::mutable_normal_field() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestCamelCase.normal_field)
+  return normal_field_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* TestCamelCase::release_normal_field() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestCamelCase.normal_field)
+  if (!has_normal_field()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return normal_field_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestCamelCase::set_allocated_normal_field(std::string* normal_field) {
+  if (normal_field != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  normal_field_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), normal_field);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestCamelCase.normal_field)
+}
+
+// optional int32 CAPITAL_FIELD = 2;
+inline bool TestCamelCase::has_capital_field() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestCamelCase::clear_capital_field() {
+  capital_field_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestCamelCase::capital_field() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestCamelCase.CAPITAL_FIELD)
+  return capital_field_;
+}
+inline void TestCamelCase::set_capital_field(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  capital_field_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestCamelCase.CAPITAL_FIELD)
+}
+
+// optional int32 CamelCaseField = 3;
+inline bool TestCamelCase::has_camelcasefield() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestCamelCase::clear_camelcasefield() {
+  camelcasefield_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestCamelCase::camelcasefield() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestCamelCase.CamelCaseField)
+  return camelcasefield_;
+}
+inline void TestCamelCase::set_camelcasefield(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  camelcasefield_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestCamelCase.CamelCaseField)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestBoolMap
+
+// map<bool, int32> bool_map = 1;
+inline int TestBoolMap::bool_map_size() const {
+  return bool_map_.size();
+}
+inline void TestBoolMap::clear_bool_map() {
+  bool_map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestBoolMap::bool_map() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestBoolMap.bool_map)
+  return bool_map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestBoolMap::mutable_bool_map() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestBoolMap.bool_map)
+  return bool_map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// TestRecursion
+
+// optional int32 value = 1;
+inline bool TestRecursion::has_value() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestRecursion::clear_value() {
+  value_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRecursion::value() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRecursion.value)
+  return value_;
+}
+inline void TestRecursion::set_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  value_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRecursion.value)
+}
+
+// optional .protobuf_unittest.TestRecursion child = 2;
+inline bool TestRecursion::has_child() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestRecursion::clear_child() {
+  if (child_ != nullptr) child_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::protobuf_unittest::TestRecursion& TestRecursion::child() const {
+  const ::protobuf_unittest::TestRecursion* p = child_;
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRecursion.child)
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest::TestRecursion*>(
+      &::protobuf_unittest::_TestRecursion_default_instance_);
+}
+inline ::protobuf_unittest::TestRecursion* TestRecursion::release_child() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestRecursion.child)
+  _has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestRecursion* temp = child_;
+  child_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestRecursion* TestRecursion::mutable_child() {
+  _has_bits_[0] |= 0x00000001u;
+  if (child_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestRecursion>(GetArenaNoVirtual());
+    child_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestRecursion.child)
+  return child_;
+}
+inline void TestRecursion::set_allocated_child(::protobuf_unittest::TestRecursion* child) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete child_;
+  }
+  if (child) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      child = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, child, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  child_ = child;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestRecursion.child)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestStringMap
+
+// map<string, string> string_map = 1;
+inline int TestStringMap::string_map_size() const {
+  return string_map_.size();
+}
+inline void TestStringMap::clear_string_map() {
+  string_map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestStringMap::string_map() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestStringMap.string_map)
+  return string_map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestStringMap::mutable_string_map() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestStringMap.string_map)
+  return string_map_.MutableMap();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestStringSerializer
+
+// optional string scalar_string = 1;
+inline bool TestStringSerializer::has_scalar_string() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestStringSerializer::clear_scalar_string() {
+  scalar_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestStringSerializer::scalar_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestStringSerializer.scalar_string)
+  return scalar_string_.GetNoArena();
+}
+inline void TestStringSerializer::set_scalar_string(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  scalar_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestStringSerializer.scalar_string)
+}
+inline void TestStringSerializer::set_scalar_string(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  scalar_string_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestStringSerializer.scalar_string)
+}
+inline void TestStringSerializer::set_scalar_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  scalar_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestStringSerializer.scalar_string)
+}
+inline void TestStringSerializer::set_scalar_string(const char* value, size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  scalar_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestStringSerializer.scalar_string)
+}
+inline std::string* TestStringSerializer::mutable_scalar_string() {
+  _has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestStringSerializer.scalar_string)
+  return scalar_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* TestStringSerializer::release_scalar_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestStringSerializer.scalar_string)
+  if (!has_scalar_string()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return scalar_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestStringSerializer::set_allocated_scalar_string(std::string* scalar_string) {
+  if (scalar_string != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  scalar_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), scalar_string);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestStringSerializer.scalar_string)
+}
+
+// repeated string repeated_string = 2;
+inline int TestStringSerializer::repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline void TestStringSerializer::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline const std::string& TestStringSerializer::repeated_string(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestStringSerializer.repeated_string)
+  return repeated_string_.Get(index);
+}
+inline std::string* TestStringSerializer::mutable_repeated_string(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestStringSerializer.repeated_string)
+  return repeated_string_.Mutable(index);
+}
+inline void TestStringSerializer::set_repeated_string(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestStringSerializer.repeated_string)
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestStringSerializer::set_repeated_string(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestStringSerializer.repeated_string)
+  repeated_string_.Mutable(index)->assign(std::move(value));
+}
+inline void TestStringSerializer::set_repeated_string(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestStringSerializer.repeated_string)
+}
+inline void TestStringSerializer::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestStringSerializer.repeated_string)
+}
+inline std::string* TestStringSerializer::add_repeated_string() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestStringSerializer.repeated_string)
+  return repeated_string_.Add();
+}
+inline void TestStringSerializer::add_repeated_string(const std::string& value) {
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestStringSerializer.repeated_string)
+}
+inline void TestStringSerializer::add_repeated_string(std::string&& value) {
+  repeated_string_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestStringSerializer.repeated_string)
+}
+inline void TestStringSerializer::add_repeated_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestStringSerializer.repeated_string)
+}
+inline void TestStringSerializer::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestStringSerializer.repeated_string)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestStringSerializer::repeated_string() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestStringSerializer.repeated_string)
+  return repeated_string_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestStringSerializer::mutable_repeated_string() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestStringSerializer.repeated_string)
+  return &repeated_string_;
+}
+
+// map<string, string> string_map = 3;
+inline int TestStringSerializer::string_map_size() const {
+  return string_map_.size();
+}
+inline void TestStringSerializer::clear_string_map() {
+  string_map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestStringSerializer::string_map() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestStringSerializer.string_map)
+  return string_map_.GetMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestStringSerializer::mutable_string_map() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestStringSerializer.string_map)
+  return string_map_.MutableMap();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::protobuf_unittest::TestNumbers_MyType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protobuf_unittest::TestNumbers_MyType>() {
+  return ::protobuf_unittest::TestNumbers_MyType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2fjson_5fformat_2eproto
@@ -35,7 +35,9 @@
 #include <google/protobuf/util/message_differencer.h>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include <google/protobuf/stubs/callback.h>
@@ -43,6 +45,7 @@
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/stringprintf.h>
 #include <google/protobuf/any.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
@@ -127,6 +130,11 @@ class MessageDifferencer::MultipleFieldsMapKeyComparator
     return true;
   }
 
+  const std::vector<std::vector<const FieldDescriptor*> >& key_field_paths()
+      const {
+    return key_field_paths_;
+  }
+
  private:
   bool IsMatchInternal(
       const Message& message1,
@@ -268,6 +276,7 @@ MessageDifferencer::MessageDifferencer()
       report_matches_(false),
       report_moves_(true),
       report_ignores_(true),
+      compare_serialized_first_(false),
       output_string_(nullptr),
       match_indices_for_smart_list_callback_(
           MatchIndicesPostProcessorForSmartList) {}
@@ -562,6 +571,14 @@ bool MessageDifferencer::Compare(
                 << descriptor2->full_name();
     return false;
   }
+  // Differences are not needed, so skip the field by field comparison if the
+  // messages are the same on the wire. Only the top-level messages are
+  // compared this way: doing it at every nesting level would serialize each
+  // sub-message once per enclosing message.
+  if (compare_serialized_first_ && reporter_ == NULL &&
+      parent_fields->empty() && HaveSameSerialization(message1, message2)) {
+    return true;
+  }
   // Expand google.protobuf.Any payload if possible.
   if (descriptor1->full_name() == internal::kAnyFullTypeName) {
     std::unique_ptr<Message> data1;
@@ -605,6 +622,30 @@ bool MessageDifferencer::Compare(
       parent_fields) && unknown_compare_result;
 }
 
+namespace {
+
+void SerializeDeterministically(const Message& message, std::string* output) {
+  output->clear();
+  io::StringOutputStream output_stream(output);
+  io::CodedOutputStream coded_output(&output_stream);
+  coded_output.SetSerializationDeterministic(true);
+  message.SerializeWithCachedSizes(&coded_output);
+}
+
+}  // namespace
+
+bool MessageDifferencer::HaveSameSerialization(const Message& message1,
+                                               const Message& message2) {
+  // Comparing sizes first avoids serializing most messages that differ. It
+  // also caches the sizes of sub-messages for SerializeWithCachedSizes().
+  if (message1.ByteSizeLong() != message2.ByteSizeLong()) {
+    return false;
+  }
+  SerializeDeterministically(message1, &serialized1_);
+  SerializeDeterministically(message2, &serialized2_);
+  return serialized1_ == serialized2_;
+}
+
 std::vector<const FieldDescriptor*> MessageDifferencer::RetrieveFields(
     const Message& message, bool base_message) {
   const Descriptor* descriptor = message.GetDescriptor();
@@ -1623,12 +1664,37 @@ bool MessageDifferencer::MatchRepeatedFieldIndices(
           }
         }
       }
+      // Elements that match have the same hash, so an element only needs to
+      // be compared to the elements with the same hash. Candidates are kept
+      // in index order, so the matching is the same as without hashes.
+      const bool use_hashes =
+          !is_treated_as_smart_set &&
+          CanHashElements(repeated_field, key_comparator);
+      std::unordered_map<uint64, std::vector<int> > candidates;
+      if (use_hashes) {
+        for (int j = start_offset; j < count2; j++) {
+          candidates[HashElement(message2, repeated_field, key_comparator, j)]
+              .push_back(j);
+        }
+      }
       for (int i = start_offset; i < count1; ++i) {
         // Indicates any matched elements for this repeated field.
         bool match = false;
         int matched_j = -1;
 
-        for (int j = start_offset; j < count2; j++) {
+        const std::vector<int>* hash_candidates = NULL;
+        int candidate_count = count2 - start_offset;
+        if (use_hashes) {
+          std::unordered_map<uint64, std::vector<int> >::const_iterator it =
+              candidates.find(HashElement(message1, repeated_field,
+                                          key_comparator, i));
+          hash_candidates = it != candidates.end() ? &it->second : NULL;
+          candidate_count =
+              hash_candidates != NULL ? hash_candidates->size() : 0;
+        }
+        for (int k = 0; k < candidate_count; k++) {
+          const int j = hash_candidates != NULL ? (*hash_candidates)[k]
+                                                : start_offset + k;
           if (match_list2->at(j) != -1) {
             if (!is_treated_as_smart_set || num_diffs_list1[i] == 0) {
               continue;
@@ -1700,6 +1766,145 @@ bool MessageDifferencer::MatchRepeatedFieldIndices(
   return success;
 }
 
+namespace {
+
+// Mixes "value" into "hash", FNV-1a style but on 64-bit words.
+uint64 CombineHash(uint64 hash, uint64 value) {
+  const uint64 kFnvPrime = 0x100000001b3;
+  return (hash ^ value) * kFnvPrime;
+}
+
+}  // namespace
+
+bool MessageDifferencer::CanHashElements(
+    const FieldDescriptor* repeated_field,
+    const MapKeyComparator* key_comparator) const {
+  // Custom comparators and criteria may consider different values the same.
+  if (field_comparator_ != NULL || !ignore_criteria_.empty()) {
+    return false;
+  }
+  if (key_comparator == NULL) {
+    // All floating point elements would have the same hash.
+    return repeated_field->cpp_type() != FieldDescriptor::CPPTYPE_FLOAT &&
+           repeated_field->cpp_type() != FieldDescriptor::CPPTYPE_DOUBLE;
+  }
+  return key_comparator == &map_entry_key_comparator_ ||
+         std::find(owned_key_comparators_.begin(),
+                   owned_key_comparators_.end(),
+                   key_comparator) != owned_key_comparators_.end();
+}
+
+uint64 MessageDifferencer::HashElement(const Message& message,
+                                       const FieldDescriptor* repeated_field,
+                                       const MapKeyComparator* key_comparator,
+                                       int index) const {
+  if (key_comparator == NULL) {
+    return HashFieldValue(message, repeated_field, index);
+  }
+  const Message& element =
+      message.GetReflection()->GetRepeatedMessage(message, repeated_field,
+                                                  index);
+  if (key_comparator == &map_entry_key_comparator_) {
+    // An ignored map key is compared as part of the whole entry.
+    const FieldDescriptor* key = element.GetDescriptor()->FindFieldByNumber(1);
+    return ignored_fields_.find(key) != ignored_fields_.end()
+               ? HashMessage(element)
+               : HashFieldValue(element, key, -1);
+  }
+  // Otherwise this is one of our MultipleFieldsMapKeyComparators.
+  const std::vector<std::vector<const FieldDescriptor*> >& key_field_paths =
+      static_cast<const MultipleFieldsMapKeyComparator*>(key_comparator)
+          ->key_field_paths();
+  uint64 hash = 0;
+  for (int i = 0; i < key_field_paths.size(); ++i) {
+    const std::vector<const FieldDescriptor*>& key_field_path =
+        key_field_paths[i];
+    const Message* current = &element;
+    for (int j = 0; j + 1 < key_field_path.size() && current != NULL; ++j) {
+      const Reflection* reflection = current->GetReflection();
+      current = reflection->HasField(*current, key_field_path[j])
+                    ? &reflection->GetMessage(*current, key_field_path[j])
+                    : NULL;
+    }
+    const FieldDescriptor* key = key_field_path.back();
+    // Repeated keys are compared as lists or sets, so they are not hashed.
+    hash = CombineHash(hash, current != NULL && !key->is_repeated()
+                                 ? HashFieldValue(*current, key, -1)
+                                 : 0);
+  }
+  return hash;
+}
+
+uint64 MessageDifferencer::HashFieldValue(const Message& message,
+                                          const FieldDescriptor* field,
+                                          int index) const {
+  // Default values hash to 0, so that in EQUIVALENT mode a field set to its
+  // default has the same hash as an unset one.
+  const Reflection* reflection = message.GetReflection();
+  switch (field->cpp_type()) {
+#define HASH_FIELD_VALUE(CPPTYPE, METHOD, DEFAULT)                          \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                                  \
+    return static_cast<uint64>(                                             \
+               index < 0                                                    \
+                   ? reflection->Get##METHOD(message, field)                \
+                   : reflection->GetRepeated##METHOD(message, field,        \
+                                                     index)) ^              \
+           static_cast<uint64>(DEFAULT);
+
+    HASH_FIELD_VALUE(INT32, Int32, field->default_value_int32())
+    HASH_FIELD_VALUE(INT64, Int64, field->default_value_int64())
+    HASH_FIELD_VALUE(UINT32, UInt32, field->default_value_uint32())
+    HASH_FIELD_VALUE(UINT64, UInt64, field->default_value_uint64())
+    HASH_FIELD_VALUE(BOOL, Bool, field->default_value_bool())
+    HASH_FIELD_VALUE(ENUM, EnumValue, field->default_value_enum()->number())
+#undef HASH_FIELD_VALUE
+
+    case FieldDescriptor::CPPTYPE_FLOAT:
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      return 0;
+    case FieldDescriptor::CPPTYPE_STRING: {
+      std::string scratch;
+      const std::string& value =
+          index < 0
+              ? reflection->GetStringReference(message, field, &scratch)
+              : reflection->GetRepeatedStringReference(message, field, index,
+                                                       &scratch);
+      return value == field->default_value_string()
+                 ? 0
+                 : std::hash<std::string>()(value);
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      // Unset messages are not visited; recursive types would never end.
+      if (index < 0 && !reflection->HasField(message, field)) {
+        return 0;
+      }
+      return HashMessage(
+          index < 0 ? reflection->GetMessage(message, field)
+                    : reflection->GetRepeatedMessage(message, field, index));
+  }
+  return 0;
+}
+
+uint64 MessageDifferencer::HashMessage(const Message& message) const {
+  const Descriptor* descriptor = message.GetDescriptor();
+  // Any is compared by its unpacked payload, not by its serialized value.
+  if (descriptor->full_name() == internal::kAnyFullTypeName) {
+    return 0;
+  }
+  // Values of unset fields are hashed too, as they are compared in EQUIVALENT
+  // mode. Repeated fields may be compared as sets, so they are not hashed.
+  uint64 hash = 0;
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_repeated() ||
+        ignored_fields_.find(field) != ignored_fields_.end()) {
+      continue;
+    }
+    hash = CombineHash(hash, HashFieldValue(message, field, -1));
+  }
+  return hash;
+}
+
 FieldComparator::ComparisonResult MessageDifferencer::GetFieldComparisonResult(
     const Message& message1, const Message& message2,
     const FieldDescriptor* field, int index1, int index2,
@@ -553,6 +553,18 @@ class PROTOBUF_EXPORT MessageDifferencer {
     report_ignores_ = report_ignores;
   }
 
+  // Tells the differencer to first compare the deterministic serializations of
+  // the two top-level messages, and to only compare their fields one by one if
+  // the serializations differ. Each message is serialized at most once per
+  // Compare call, so this is faster for large messages that are usually the
+  // same. It is only done when no reporter is set. Messages with the same
+  // serialization are treated as equal regardless of the field comparator, so
+  // NaN values compare as equal to themselves. This method must be called
+  // before Compare. The default for a new differencer is false.
+  void set_compare_serialized_first(bool compare_serialized_first) {
+    compare_serialized_first_ = compare_serialized_first;
+  }
+
   // Sets the scope of the comparison (as defined in the Scope enumeration
   // above) that is used by this differencer when determining which fields to
   // compare between the messages.
@@ -730,6 +742,11 @@ class PROTOBUF_EXPORT MessageDifferencer {
   bool Compare(const Message& message1, const Message& message2,
                std::vector<SpecificField>* parent_fields);
 
+  // Returns true if the deterministic serializations of the two messages are
+  // the same. Used by Compare() for the top-level messages if
+  // compare_serialized_first_ is set.
+  bool HaveSameSerialization(const Message& message1, const Message& message2);
+
   // Compares all the unknown fields in two messages.
   bool CompareUnknownFields(const Message& message1, const Message& message2,
                             const UnknownFieldSet&, const UnknownFieldSet&,
@@ -848,6 +865,23 @@ class PROTOBUF_EXPORT MessageDifferencer {
       std::vector<int>* match_list1,
       std::vector<int>* match_list2);
 
+  // Returns true if elements of the repeated field that match always have the
+  // same HashElement(), so that MatchRepeatedFieldIndices() only needs to try
+  // to match elements with the same hash. This is the case unless a custom
+  // FieldComparator, IgnoreCriteria or MapKeyComparator is used.
+  bool CanHashElements(const FieldDescriptor* repeated_field,
+                       const MapKeyComparator* key_comparator) const;
+
+  // Returns a hash of the element at "index" of the repeated field, computed
+  // from the values that IsMatch() compares exactly. Floating point values
+  // are not hashed, as they may match without being equal.
+  uint64 HashElement(const Message& message,
+                     const FieldDescriptor* repeated_field,
+                     const MapKeyComparator* key_comparator, int index) const;
+  uint64 HashFieldValue(const Message& message, const FieldDescriptor* field,
+                        int index) const;
+  uint64 HashMessage(const Message& message) const;
+
   // If "any" is of type google.protobuf.Any, extract its payload using
   // DynamicMessageFactory and store in "data".
   bool UnpackAny(const Message& any, std::unique_ptr<Message>* data);
@@ -895,8 +929,12 @@ class PROTOBUF_EXPORT MessageDifferencer {
   bool report_matches_;
   bool report_moves_;
   bool report_ignores_;
+  bool compare_serialized_first_;
 
   std::string* output_string_;
+  // Buffers for HaveSameSerialization(), reused across calls.
+  std::string serialized1_;
+  std::string serialized2_;
 
   // Callback to post-process the matched indices to support SMART_LIST.
   std::function<void(std::vector<int>*,
@@ -35,6 +35,8 @@
 // TODO(ksroka): Move some of these tests to field_comparator_test.cc.
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <random>
 #include <string>
 #include <vector>
@@ -256,6 +258,62 @@ TEST(MessageDifferencerTest, RepeatedFieldPartialInequalityTest) {
   EXPECT_FALSE(differencer.Compare(msg1, msg2));
 }
 
+TEST(MessageDifferencerTest, CompareSerializedFirstTest) {
+  unittest::TestAllTypes msg1;
+  unittest::TestAllTypes msg2;
+  TestUtil::SetAllFields(&msg1);
+  TestUtil::SetAllFields(&msg2);
+
+  util::MessageDifferencer differencer;
+  differencer.set_compare_serialized_first(true);
+  EXPECT_TRUE(differencer.Compare(msg1, msg2));
+
+  // Messages that differ are compared field by field.
+  msg1.mutable_optional_nested_message()->set_bb(-1);
+  EXPECT_FALSE(differencer.Compare(msg1, msg2));
+  msg2.mutable_optional_nested_message()->set_bb(-1);
+  EXPECT_TRUE(differencer.Compare(msg1, msg2));
+
+  // Messages with different serializations can still be equivalent.
+  msg1.clear_optional_int32();
+  msg2.set_optional_int32(0);
+  EXPECT_FALSE(differencer.Compare(msg1, msg2));
+  differencer.set_message_field_comparison(
+      util::MessageDifferencer::EQUIVALENT);
+  EXPECT_TRUE(differencer.Compare(msg1, msg2));
+
+  // Differences are still reported.
+  std::string output;
+  differencer.ReportDifferencesToString(&output);
+  msg1.set_optional_string("foo");
+  EXPECT_FALSE(differencer.Compare(msg1, msg2));
+  EXPECT_EQ("modified: optional_string: \"foo\" -> \"115\"\n", output);
+}
+
+TEST(MessageDifferencerTest, CompareSerializedFirstNaNTest) {
+  unittest::TestAllTypes msg1;
+  unittest::TestAllTypes msg2;
+  msg1.set_optional_double(std::numeric_limits<double>::quiet_NaN());
+  msg2.set_optional_double(std::numeric_limits<double>::quiet_NaN());
+
+  util::MessageDifferencer differencer;
+  EXPECT_FALSE(differencer.Compare(msg1, msg2));
+  differencer.set_compare_serialized_first(true);
+  EXPECT_TRUE(differencer.Compare(msg1, msg2));
+
+  // Only the top-level messages are compared by serialization, so nested
+  // messages are compared field by field once the top-level ones differ.
+  unittest::NestedTestAllTypes nested1;
+  unittest::NestedTestAllTypes nested2;
+  *nested1.mutable_payload() = msg1;
+  *nested2.mutable_payload() = msg2;
+  EXPECT_TRUE(differencer.Compare(nested1, nested2));
+  nested1.mutable_child();
+  differencer.set_message_field_comparison(
+      util::MessageDifferencer::EQUIVALENT);
+  EXPECT_FALSE(differencer.Compare(nested1, nested2));
+}
+
 TEST(MessageDifferencerTest, BasicEquivalencyTest) {
   // Create the testing protos
   unittest::TestAllTypes msg1;
@@ -1265,6 +1323,97 @@ TEST(MessageDifferencerTest, RepeatedFieldSetTest_SetOfSet) {
   EXPECT_TRUE(differencer.Compare(msg1, msg2));
 }
 
+// Reports the differences between msg1 and msg2 with the given settings, once
+// as configured and once with a FieldComparator, which turns off matching
+// elements of sets and maps by hash.
+void ExpectSameDiffWithoutHashing(
+    const Message& msg1, const Message& msg2,
+    std::function<void(util::MessageDifferencer*)> configure) {
+  std::string hashed_diff;
+  util::MessageDifferencer hashed_differencer;
+  configure(&hashed_differencer);
+  hashed_differencer.ReportDifferencesToString(&hashed_diff);
+  const bool hashed_result = hashed_differencer.Compare(msg1, msg2);
+
+  std::string diff;
+  util::MessageDifferencer differencer;
+  configure(&differencer);
+  util::DefaultFieldComparator field_comparator;
+  differencer.set_field_comparator(&field_comparator);
+  differencer.ReportDifferencesToString(&diff);
+  EXPECT_EQ(differencer.Compare(msg1, msg2), hashed_result);
+  EXPECT_EQ(diff, hashed_diff);
+}
+
+TEST(MessageDifferencerTest, RepeatedFieldHashMatchingTest) {
+  protobuf_unittest::TestDiffMessage msg1;
+  protobuf_unittest::TestDiffMessage msg2;
+  std::mt19937 random(42);
+  for (int i = 0; i < 200; ++i) {
+    protobuf_unittest::TestDiffMessage::Item* item = msg1.add_item();
+    item->set_a(i % 50);
+    item->set_b(StrCat("item", i % 70));
+    item->add_ra(i);
+    item->mutable_m()->set_c(i % 30);
+  }
+  msg2 = msg1;
+  std::shuffle(msg2.mutable_item()->pointer_begin(),
+               msg2.mutable_item()->pointer_end(), random);
+  msg2.mutable_item(3)->set_b("changed");
+  msg2.mutable_item(7)->add_ra(-1);
+  msg2.mutable_item(11)->mutable_m()->set_a(1);
+  msg2.add_item()->set_a(1000);
+  msg1.mutable_item()->SwapElements(0, 199);
+
+  const Descriptor* item_descriptor =
+      protobuf_unittest::TestDiffMessage::Item::descriptor();
+  const FieldDescriptor* item = GetFieldDescriptor(msg1, "item");
+  ExpectSameDiffWithoutHashing(
+      msg1, msg2,
+      [item](util::MessageDifferencer* differencer) {
+        differencer->TreatAsSet(item);
+      });
+  ExpectSameDiffWithoutHashing(
+      msg1, msg2,
+      [item, item_descriptor](util::MessageDifferencer* differencer) {
+        differencer->TreatAsSet(item);
+        differencer->IgnoreField(item_descriptor->FindFieldByName("b"));
+      });
+  ExpectSameDiffWithoutHashing(
+      msg1, msg2,
+      [item, item_descriptor](util::MessageDifferencer* differencer) {
+        differencer->TreatAsMap(item, item_descriptor->FindFieldByName("b"));
+      });
+  ExpectSameDiffWithoutHashing(
+      msg1, msg2,
+      [item, item_descriptor](util::MessageDifferencer* differencer) {
+        std::vector<std::vector<const FieldDescriptor*> > key_field_paths(2);
+        key_field_paths[0].push_back(item_descriptor->FindFieldByName("a"));
+        key_field_paths[1].push_back(item_descriptor->FindFieldByName("m"));
+        key_field_paths[1].push_back(
+            protobuf_unittest::TestField::descriptor()->FindFieldByName("c"));
+        differencer->TreatAsMapWithMultipleFieldPathsAsKey(item,
+                                                           key_field_paths);
+      });
+}
+
+TEST(MessageDifferencerTest, MapFieldHashMatchingTest) {
+  unittest::TestMap msg1;
+  unittest::TestMap msg2;
+  for (int i = 0; i < 100; ++i) {
+    (*msg1.mutable_map_int32_int32())[i] = i;
+    (*msg1.mutable_map_string_string())[StrCat(i)] = StrCat(i);
+    (*msg2.mutable_map_int32_int32())[99 - i] = 99 - i;
+    (*msg2.mutable_map_string_string())[StrCat(99 - i)] = StrCat(99 - i);
+  }
+  EXPECT_TRUE(util::MessageDifferencer::Equals(msg1, msg2));
+
+  (*msg2.mutable_map_int32_int32())[5] = 6;
+  (*msg2.mutable_map_string_string())["100"] = "100";
+  ExpectSameDiffWithoutHashing(msg1, msg2,
+                               [](util::MessageDifferencer* differencer) {});
+}
+
 TEST(MessageDifferencerTest, RepeatedFieldSetTest_Combination) {
   // Create the testing protos
   protobuf_unittest::TestDiffMessage msg1;
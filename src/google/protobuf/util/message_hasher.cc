@@ -0,0 +1,232 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/message_hasher.h>
+
+#include <vector>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/any.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/map_field.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/util/message_differencer.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+
+namespace {
+
+// The finalizer of MurmurHash3, which spreads every input bit over the
+// whole result.
+inline uint64 Mix(uint64 value) {
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccd;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53;
+  value ^= value >> 33;
+  return value;
+}
+
+// Order dependent, so that e.g. swapping two fields changes the hash.
+inline uint64 Combine(uint64 hash, uint64 value) {
+  return Mix(hash * 0x9e3779b97f4a7c15 + value);
+}
+
+uint64 HashString(const std::string& value) {
+  const uint8* data = reinterpret_cast<const uint8*>(value.data());
+  const uint8* end = data + value.size();
+  uint64 hash = value.size();
+  for (; end - data >= 8; data += 8) {
+    uint64 word;
+    io::CodedInputStream::ReadLittleEndian64FromArray(data, &word);
+    hash = Combine(hash, word);
+  }
+  uint64 tail = 0;
+  for (int shift = 0; data < end; ++data, shift += 8) {
+    tail |= static_cast<uint64>(*data) << shift;
+  }
+  return Combine(hash, tail);
+}
+
+// 0.0 and -0.0 are equal, so they must have the same hash. NaN is not equal
+// to anything, so its hash does not matter.
+inline uint64 HashDouble(double value) {
+  return value == 0 ? 0 : internal::WireFormatLite::EncodeDouble(value);
+}
+
+uint64 HashFieldValue(const Message& message, const FieldDescriptor* field,
+                      int index) {
+  const Reflection* reflection = message.GetReflection();
+  switch (field->cpp_type()) {
+#define HASH_FIELD_VALUE(CPPTYPE, METHOD, HASH)                          \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                               \
+    return HASH(index < 0                                                \
+                    ? reflection->Get##METHOD(message, field)            \
+                    : reflection->GetRepeated##METHOD(message, field, index));
+
+    HASH_FIELD_VALUE(INT32, Int32, static_cast<uint64>)
+    HASH_FIELD_VALUE(INT64, Int64, static_cast<uint64>)
+    HASH_FIELD_VALUE(UINT32, UInt32, static_cast<uint64>)
+    HASH_FIELD_VALUE(UINT64, UInt64, static_cast<uint64>)
+    HASH_FIELD_VALUE(BOOL, Bool, static_cast<uint64>)
+    HASH_FIELD_VALUE(ENUM, EnumValue, static_cast<uint64>)
+    HASH_FIELD_VALUE(FLOAT, Float, HashDouble)
+    HASH_FIELD_VALUE(DOUBLE, Double, HashDouble)
+    HASH_FIELD_VALUE(MESSAGE, Message, MessageHasher::Hash)
+#undef HASH_FIELD_VALUE
+
+    case FieldDescriptor::CPPTYPE_STRING: {
+      std::string scratch;
+      return HashString(
+          index < 0 ? reflection->GetStringReference(message, field, &scratch)
+                    : reflection->GetRepeatedStringReference(
+                          message, field, index, &scratch));
+    }
+  }
+  return 0;
+}
+
+uint64 HashMapKey(const MapKey& key) {
+  switch (key.type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      return static_cast<uint64>(key.GetInt32Value());
+    case FieldDescriptor::CPPTYPE_INT64:
+      return static_cast<uint64>(key.GetInt64Value());
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return key.GetUInt32Value();
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return key.GetUInt64Value();
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return key.GetBoolValue();
+    case FieldDescriptor::CPPTYPE_STRING:
+      return HashString(key.GetStringValue());
+    default:
+      GOOGLE_LOG(DFATAL) << "Invalid map key type: " << key.type();
+      return 0;
+  }
+}
+
+uint64 HashMapValue(const MapValueRef& value, const FieldDescriptor* field) {
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      return static_cast<uint64>(value.GetInt32Value());
+    case FieldDescriptor::CPPTYPE_INT64:
+      return static_cast<uint64>(value.GetInt64Value());
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return value.GetUInt32Value();
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return value.GetUInt64Value();
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return value.GetBoolValue();
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return static_cast<uint64>(value.GetEnumValue());
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      return HashDouble(value.GetFloatValue());
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      return HashDouble(value.GetDoubleValue());
+    case FieldDescriptor::CPPTYPE_STRING:
+      return HashString(value.GetStringValue());
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return MessageHasher::Hash(value.GetMessageValue());
+  }
+  return 0;
+}
+
+}  // namespace
+
+uint64 MessageHasher::Hash(const Message& message) {
+  const Descriptor* descriptor = message.GetDescriptor();
+  const Reflection* reflection = message.GetReflection();
+  if (descriptor->full_name() == internal::kAnyFullTypeName) {
+    // MessageDifferencer compares the unpacked payloads, which only depend on
+    // the type name at the end of the URL.
+    std::string scratch;
+    const std::string& type_url = reflection->GetStringReference(
+        message, descriptor->FindFieldByNumber(1), &scratch);
+    return HashString(type_url.substr(type_url.find_last_of('/') + 1));
+  }
+  std::vector<const FieldDescriptor*> fields;
+  reflection->ListFields(message, &fields);
+  uint64 hash = fields.size();
+  for (int i = 0; i < fields.size(); ++i) {
+    hash = Combine(hash, fields[i]->number());
+    hash = Combine(hash, HashField(message, fields[i]));
+  }
+  return hash;
+}
+
+uint64 MessageHasher::HashField(const Message& message,
+                                const FieldDescriptor* field) {
+  if (field->is_map()) {
+    return HashMapField(message, field);
+  }
+  if (!field->is_repeated()) {
+    return HashFieldValue(message, field, -1);
+  }
+  const int size = message.GetReflection()->FieldSize(message, field);
+  uint64 hash = size;
+  for (int i = 0; i < size; ++i) {
+    hash = Combine(hash, HashFieldValue(message, field, i));
+  }
+  return hash;
+}
+
+uint64 MessageHasher::HashMapField(const Message& message,
+                                   const FieldDescriptor* field) {
+  const Reflection* reflection = message.GetReflection();
+  const FieldDescriptor* value_field =
+      field->message_type()->FindFieldByNumber(2);
+  Message* mutable_message = const_cast<Message*>(&message);
+  uint64 entries_hash = 0;
+  for (MapIterator it = reflection->MapBegin(mutable_message, field),
+                   end = reflection->MapEnd(mutable_message, field);
+       it != end; ++it) {
+    // Entries are added up, so that their order does not matter.
+    entries_hash += Combine(HashMapKey(it.GetKey()),
+                            HashMapValue(it.GetValueRef(), value_field));
+  }
+  return Combine(reflection->MapSize(message, field), entries_hash);
+}
+
+size_t MessageHash::operator()(const Message& message) const {
+  return MessageHasher::Hash(message);
+}
+
+bool MessageEquals::operator()(const Message& message1,
+                               const Message& message2) const {
+  return MessageDifferencer::Equals(message1, message2);
+}
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,90 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Defines MessageHasher, which computes a hash of the contents of a message
+// without serializing it.
+
+#ifndef GOOGLE_PROTOBUF_UTIL_MESSAGE_HASHER_H__
+#define GOOGLE_PROTOBUF_UTIL_MESSAGE_HASHER_H__
+
+#include <stddef.h>
+
+#include <google/protobuf/stubs/common.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+class FieldDescriptor;
+class Message;
+
+namespace util {
+
+// Computes a hash of a message by walking its fields through reflection.
+// Messages that MessageDifferencer::Equals() considers equal have the same
+// hash. In particular:
+//  * Map fields are hashed independently of the order of their entries.
+//  * Unknown fields are not hashed.
+//  * google.protobuf.Any is hashed by its type URL only, as messages with
+//    different serialized payloads can be equal.
+// The hash does not depend on the process or on memory addresses, but it may
+// change between releases of this library, so it should not be persisted.
+class PROTOBUF_EXPORT MessageHasher {
+ public:
+  static uint64 Hash(const Message& message);
+
+ private:
+  static uint64 HashField(const Message& message, const FieldDescriptor* field);
+  // Hashes the entries of a map field in any order, iterating the map itself
+  // rather than its repeated field view.
+  static uint64 HashMapField(const Message& message,
+                             const FieldDescriptor* field);
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MessageHasher);
+};
+
+// Function objects for using messages as keys of unordered containers, e.g.
+//   std::unordered_set<Foo, util::MessageHash, util::MessageEquals> foos;
+struct PROTOBUF_EXPORT MessageHash {
+  size_t operator()(const Message& message) const;
+};
+
+struct PROTOBUF_EXPORT MessageEquals {
+  bool operator()(const Message& message1, const Message& message2) const;
+};
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_UTIL_MESSAGE_HASHER_H__
@@ -0,0 +1,151 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/message_hasher.h>
+
+#include <memory>
+#include <unordered_set>
+
+#include <google/protobuf/any_test.pb.h>
+#include <google/protobuf/map_test_util.h>
+#include <google/protobuf/map_unittest.pb.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace {
+
+using protobuf_unittest::TestAllTypes;
+using protobuf_unittest::TestAny;
+using protobuf_unittest::TestMap;
+
+TEST(MessageHasherTest, EqualMessagesHaveSameHash) {
+  TestAllTypes message1, message2;
+  EXPECT_EQ(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+
+  TestUtil::SetAllFields(&message1);
+  TestUtil::SetAllFields(&message2);
+  EXPECT_EQ(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+
+  // A dynamic message with the same contents has the same hash.
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> dynamic_message(
+      factory.GetPrototype(TestAllTypes::descriptor())->New());
+  dynamic_message->ParseFromString(message1.SerializeAsString());
+  EXPECT_EQ(MessageHasher::Hash(message1),
+            MessageHasher::Hash(*dynamic_message));
+
+  // Unknown fields are not hashed.
+  message2.mutable_unknown_fields()->AddVarint(123456, 1);
+  EXPECT_EQ(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+  message2.mutable_unknown_fields()->Clear();
+
+  message1.set_optional_double(0.0);
+  message2.set_optional_double(-0.0);
+  EXPECT_TRUE(MessageDifferencer::Equals(message1, message2));
+  EXPECT_EQ(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+}
+
+TEST(MessageHasherTest, DifferentMessagesHaveDifferentHashes) {
+  TestAllTypes message1, message2;
+  TestUtil::SetAllFields(&message1);
+  TestUtil::SetAllFields(&message2);
+
+  message2.set_optional_int32(message1.optional_int32() + 1);
+  EXPECT_NE(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+  message2 = message1;
+  message2.mutable_optional_nested_message()->set_bb(-1);
+  EXPECT_NE(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+  message2 = message1;
+  message2.mutable_repeated_int32()->SwapElements(0, 1);
+  EXPECT_NE(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+  message2 = message1;
+  message2.set_optional_string(message1.optional_string() + "x");
+  EXPECT_NE(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+
+  // Set and unset fields are different, even if the value is the default.
+  TestAllTypes empty, default_int32;
+  default_int32.set_optional_int32(0);
+  EXPECT_NE(MessageHasher::Hash(empty), MessageHasher::Hash(default_int32));
+}
+
+TEST(MessageHasherTest, MapOrderDoesNotMatter) {
+  TestMap message1, message2;
+  MapTestUtil::SetMapFields(&message1);
+  for (int i = 0; i < 100; ++i) {
+    (*message1.mutable_map_int32_int32())[i] = i;
+    (*message1.mutable_map_string_string())[StrCat(i)] = StrCat(i);
+  }
+  for (int i = 99; i >= 0; --i) {
+    (*message2.mutable_map_int32_int32())[i] = i;
+    (*message2.mutable_map_string_string())[StrCat(i)] = StrCat(i);
+  }
+  MapTestUtil::SetMapFields(&message2);
+  ASSERT_TRUE(MessageDifferencer::Equals(message1, message2));
+  EXPECT_EQ(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+
+  (*message2.mutable_map_int32_int32())[5] = 6;
+  EXPECT_NE(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+}
+
+TEST(MessageHasherTest, AnyIsHashedByTypeName) {
+  TestAny message1, message2;
+  TestAllTypes payload;
+  payload.set_optional_int32(1);
+  message1.mutable_any_value()->PackFrom(payload);
+  message2.mutable_any_value()->PackFrom(payload, "example.com");
+  ASSERT_TRUE(MessageDifferencer::Equals(message1, message2));
+  EXPECT_EQ(MessageHasher::Hash(message1), MessageHasher::Hash(message2));
+}
+
+TEST(MessageHasherTest, UnorderedSet) {
+  std::unordered_set<TestAllTypes, MessageHash, MessageEquals> messages;
+  TestAllTypes message;
+  messages.insert(message);
+  TestUtil::SetAllFields(&message);
+  messages.insert(message);
+  messages.insert(message);
+  EXPECT_EQ(2, messages.size());
+  EXPECT_EQ(1, messages.count(message));
+  EXPECT_EQ(1, messages.count(TestAllTypes()));
+  message.set_optional_int32(-1);
+  EXPECT_EQ(0, messages.count(message));
+}
+
+}  // namespace
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
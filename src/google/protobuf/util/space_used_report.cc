@@ -0,0 +1,360 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/space_used_report.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/stubs/stringprintf.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/map_field.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/unknown_field_set.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+
+using internal::ReflectionInternals;
+
+namespace {
+
+typedef SpaceUsedReport::Usage Usage;
+
+void AddUsage(Usage* to, const Usage& from) {
+  to->bytes += from.bytes;
+  to->slack_bytes += from.slack_bytes;
+  to->count += from.count;
+}
+
+// Adds the bytes only, for memory of a field that belongs to a message.
+void AddBytes(Usage* to, const Usage& from) {
+  to->bytes += from.bytes;
+  to->slack_bytes += from.slack_bytes;
+}
+
+void AddScaledUsage(Usage* to, const Usage& from, double scale) {
+  to->bytes += static_cast<size_t>(from.bytes * scale + 0.5);
+  to->slack_bytes += static_cast<size_t>(from.slack_bytes * scale + 0.5);
+  to->count += static_cast<int64>(from.count * scale + 0.5);
+}
+
+// Heap allocated capacity that does not hold characters.
+size_t StringSlack(const std::string& value) {
+  return internal::StringSpaceUsedExcludingSelfLong(value) > 0
+             ? value.capacity() - value.size()
+             : 0;
+}
+
+std::string FieldPath(const std::string& parent_path,
+                      const FieldDescriptor* field) {
+  const std::string name =
+      field->is_extension() ? "(" + field->full_name() + ")" : field->name();
+  return parent_path.empty() ? name : parent_path + "." + name;
+}
+
+bool CompareUsage(const std::pair<std::string, Usage>& a,
+                  const std::pair<std::string, Usage>& b) {
+  if (a.second.bytes != b.second.bytes) return a.second.bytes > b.second.bytes;
+  return a.first < b.first;
+}
+
+void PrintUsage(const std::string& title,
+                const std::map<std::string, Usage>& usage,
+                std::string* output) {
+  std::vector<std::pair<std::string, Usage> > sorted(usage.begin(),
+                                                     usage.end());
+  std::sort(sorted.begin(), sorted.end(), CompareUsage);
+  StringAppendF(output, "%14s %14s %12s  %s\n", "bytes", "slack", "count",
+                title.c_str());
+  for (int i = 0; i < sorted.size(); i++) {
+    const Usage& entry = sorted[i].second;
+    StringAppendF(output, "%14llu %14llu %12lld  %s\n",
+                  static_cast<unsigned long long>(entry.bytes),
+                  static_cast<unsigned long long>(entry.slack_bytes),
+                  static_cast<long long>(entry.count),
+                  sorted[i].first.c_str());
+  }
+}
+
+}  // namespace
+
+SpaceUsedReport::SpaceUsedReport() : max_sampled_elements_(0) {}
+
+SpaceUsedReport::~SpaceUsedReport() {}
+
+void SpaceUsedReport::AddMessage(const Message& message) {
+  Usage usage = AddMessageTree(message, "", 1.0);
+  AddUsage(&total_, usage);
+}
+
+void SpaceUsedReport::AddArena(const Arena& arena) {
+  const uint64 allocated = arena.SpaceAllocated();
+  const uint64 used = arena.SpaceUsed();
+  arena_usage_.bytes += allocated;
+  arena_usage_.slack_bytes += allocated - used;
+  arena_usage_.count++;
+}
+
+SpaceUsedReport::Usage SpaceUsedReport::AddMessageTree(
+    const Message& message, const std::string& path, double weight) {
+  const Descriptor* descriptor = message.GetDescriptor();
+  const Reflection* reflection = message.GetReflection();
+  const TypeInfo& info = GetTypeInfo(descriptor, reflection);
+  const internal::ExtensionSet* extensions =
+      ReflectionInternals::GetExtensionSet(message);
+
+  // The entries of the ExtensionSet and the objects of repeated extensions
+  // are allocated separately, but belong to the message like its object.
+  size_t object_bytes =
+      info.object_size +
+      reflection->GetUnknownFields(message).SpaceUsedExcludingSelfLong();
+  if (extensions != NULL) {
+    object_bytes += extensions->StorageSpaceUsedLong();
+  }
+  // The memory owned by this message itself, as opposed to its sub-messages.
+  Usage own;
+  own.bytes = object_bytes;
+  own.count = 1;
+
+  // Singular numeric fields are stored in the object, so only the fields
+  // which can own memory are visited.
+  Usage fields;
+  for (int i = 0; i < info.owning_fields.size(); i++) {
+    const FieldDescriptor* field = info.owning_fields[i];
+    AddUsage(&fields, AddField(message, field, FieldPath(path, field), weight,
+                               &own));
+  }
+  if (extensions != NULL && extensions->NumExtensions() > 0) {
+    std::vector<const FieldDescriptor*> set_fields;
+    reflection->ListFields(message, &set_fields);
+    for (int i = 0; i < set_fields.size(); i++) {
+      if (set_fields[i]->is_extension()) {
+        AddUsage(&fields, AddField(message, set_fields[i],
+                                   FieldPath(path, set_fields[i]), weight,
+                                   &own));
+      }
+    }
+  }
+  AddScaledUsage(&type_usage_[descriptor->full_name()], own, weight);
+
+  Usage usage;
+  usage.bytes = object_bytes + fields.bytes;
+  usage.slack_bytes = fields.slack_bytes;
+  usage.count = 1;
+  return usage;
+}
+
+SpaceUsedReport::Usage SpaceUsedReport::AddField(
+    const Message& message, const FieldDescriptor* field,
+    const std::string& path, double weight, Usage* own) {
+  const Reflection* reflection = message.GetReflection();
+  Usage usage;
+
+  if (field->is_map()) {
+    // The map and, if it was ever used, its repeated field view.
+    usage.bytes = ReflectionInternals::GetMapData(message, field)
+                      ->SpaceUsedExcludingSelfLong();
+    usage.count = ReflectionInternals::MapSize(message, field);
+    AddBytes(own, usage);
+  } else if (field->is_repeated()) {
+    const void* raw = ReflectionInternals::GetRawRepeatedField(message, field);
+    switch (field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)                                      \
+      case FieldDescriptor::CPPTYPE_##CPPTYPE: {                        \
+        const RepeatedField<TYPE>& repeated =                           \
+            *static_cast<const RepeatedField<TYPE>*>(raw);              \
+        usage.bytes = repeated.SpaceUsedExcludingSelfLong();            \
+        usage.slack_bytes =                                             \
+            (repeated.Capacity() - repeated.size()) * sizeof(TYPE);     \
+        usage.count = repeated.size();                                  \
+        break;                                                          \
+      }
+
+      HANDLE_TYPE( INT32,  int32);
+      HANDLE_TYPE( INT64,  int64);
+      HANDLE_TYPE(UINT32, uint32);
+      HANDLE_TYPE(UINT64, uint64);
+      HANDLE_TYPE(DOUBLE, double);
+      HANDLE_TYPE( FLOAT,  float);
+      HANDLE_TYPE(  BOOL,   bool);
+      HANDLE_TYPE(  ENUM,    int);
+#undef HANDLE_TYPE
+
+      case FieldDescriptor::CPPTYPE_STRING: {
+        const RepeatedPtrField<std::string>& repeated =
+            *static_cast<const RepeatedPtrField<std::string>*>(raw);
+        usage.bytes = repeated.SpaceUsedExcludingSelfLong();
+        usage.slack_bytes =
+            (repeated.Capacity() - repeated.size()) * sizeof(void*) +
+            repeated.ClearedCount() * sizeof(std::string);
+        for (int i = 0; i < repeated.size(); i++) {
+          usage.slack_bytes += StringSlack(repeated.Get(i));
+        }
+        usage.count = repeated.size();
+        break;
+      }
+
+      case FieldDescriptor::CPPTYPE_MESSAGE: {
+        const RepeatedPtrField<Message>& repeated =
+            *static_cast<const RepeatedPtrField<Message>*>(raw);
+        // The array of pointers and the cleared elements kept for reuse
+        // belong to this message.
+        if (repeated.Capacity() > 0) {
+          usage.bytes = repeated.Capacity() * sizeof(void*) +
+                        ReflectionInternals::RepeatedPtrFieldHeaderSize();
+          usage.slack_bytes =
+              (repeated.Capacity() - repeated.size()) * sizeof(void*);
+        }
+        if (repeated.ClearedCount() > 0) {
+          const size_t cleared_bytes =
+              repeated.ClearedCount() *
+              GetTypeInfo(field->message_type(), reflection).object_size;
+          usage.bytes += cleared_bytes;
+          usage.slack_bytes += cleared_bytes;
+        }
+        AddBytes(own, usage);
+
+        const int size = repeated.size();
+        int sampled = size;
+        if (max_sampled_elements_ > 0 && sampled > max_sampled_elements_) {
+          sampled = max_sampled_elements_;
+        }
+        const double scale =
+            sampled > 0 ? static_cast<double>(size) / sampled : 1.0;
+        Usage elements;
+        for (int i = 0; i < sampled; i++) {
+          AddUsage(&elements,
+                   AddMessageTree(repeated.Get(i), path, weight * scale));
+        }
+        elements.count = 0;
+        AddScaledUsage(&usage, elements, scale);
+        usage.count = size;
+        AddScaledUsage(&field_usage_[path], usage, weight);
+        return usage;
+      }
+    }
+    AddBytes(own, usage);
+  } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+    std::string scratch;
+    const std::string& value =
+        reflection->GetStringReference(message, field, &scratch);
+    const Message* prototype =
+        GetTypeInfo(message.GetDescriptor(), reflection).prototype;
+    // Strings that were never set point to the default value, which the
+    // message does not own.
+    if (&value != &scratch &&
+        (prototype == NULL ||
+         &value != &reflection->GetStringReference(*prototype, field,
+                                                   &scratch))) {
+      usage.bytes =
+          sizeof(value) + internal::StringSpaceUsedExcludingSelfLong(value);
+      usage.slack_bytes = StringSlack(value);
+      usage.count = 1;
+      AddBytes(own, usage);
+    }
+  } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+    if (reflection->HasField(message, field)) {
+      usage = AddMessageTree(reflection->GetMessage(message, field), path,
+                             weight);
+    }
+  } else {
+    // Other singular fields are stored in the object itself, and are not
+    // listed in TypeInfo::owning_fields.
+    return usage;
+  }
+
+  if (usage.bytes > 0) {
+    AddScaledUsage(&field_usage_[path], usage, weight);
+  }
+  return usage;
+}
+
+const SpaceUsedReport::TypeInfo& SpaceUsedReport::GetTypeInfo(
+    const Descriptor* descriptor, const Reflection* reflection) {
+  std::unordered_map<const Descriptor*, TypeInfo>::iterator it =
+      type_infos_.find(descriptor);
+  if (it != type_infos_.end()) {
+    return it->second;
+  }
+  TypeInfo* info = &type_infos_[descriptor];
+  info->prototype = reflection->GetMessageFactory()->GetPrototype(descriptor);
+  info->object_size = 0;
+  if (info->prototype != NULL) {
+    // A prototype owns no memory other than the object itself, except that
+    // map fields count the Map they contain, which is counted again with the
+    // field.
+    info->object_size = info->prototype->SpaceUsedLong();
+    for (int i = 0; i < descriptor->field_count(); i++) {
+      if (descriptor->field(i)->is_map()) {
+        info->object_size -=
+            ReflectionInternals::GetMapData(*info->prototype,
+                                            descriptor->field(i))
+                ->SpaceUsedExcludingSelfLong();
+      }
+    }
+  }
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_repeated() ||
+        field->cpp_type() == FieldDescriptor::CPPTYPE_STRING ||
+        field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+      info->owning_fields.push_back(field);
+    }
+  }
+  return *info;
+}
+
+std::string SpaceUsedReport::DebugString() const {
+  std::string output;
+  StringAppendF(&output, "total: %llu bytes, %llu slack, %lld messages\n",
+                static_cast<unsigned long long>(total_.bytes),
+                static_cast<unsigned long long>(total_.slack_bytes),
+                static_cast<long long>(total_.count));
+  if (arena_usage_.count > 0) {
+    StringAppendF(&output, "arenas: %llu bytes, %llu unused, %lld arenas\n",
+                  static_cast<unsigned long long>(arena_usage_.bytes),
+                  static_cast<unsigned long long>(arena_usage_.slack_bytes),
+                  static_cast<long long>(arena_usage_.count));
+  }
+  PrintUsage("type", type_usage_, &output);
+  PrintUsage("field", field_usage_, &output);
+  return output;
+}
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,163 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Defines SpaceUsedReport, which breaks down the memory used by messages by
+// field path and by message type.
+
+#ifndef GOOGLE_PROTOBUF_UTIL_SPACE_USED_REPORT_H__
+#define GOOGLE_PROTOBUF_UTIL_SPACE_USED_REPORT_H__
+
+#include <stddef.h>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+class Arena;
+class Descriptor;
+class FieldDescriptor;
+class Message;
+class Reflection;
+
+namespace util {
+
+// Attributes the memory counted by Message::SpaceUsedLong() to the fields and
+// message types that use it. Several messages can be added to one report, e.g.
+// all the entries of a cache:
+//
+//   util::SpaceUsedReport report;
+//   report.set_max_sampled_elements(100);
+//   for (const Foo& foo : cache) report.AddMessage(foo);
+//   GOOGLE_LOG(INFO) << report.DebugString();
+//
+// Field paths are the names of the fields from the root message joined by
+// ".", with extensions in parentheses. Elements of repeated fields share the
+// path of the field. The usage of a path includes the sub-messages below it,
+// so the usages of nested paths overlap. The usage of a message type only
+// includes the memory owned by messages of that type directly, so the usages
+// of all types add up to the total.
+class PROTOBUF_EXPORT SpaceUsedReport {
+ public:
+  struct Usage {
+    Usage() : bytes(0), slack_bytes(0), count(0) {}
+
+    // Bytes allocated, including slack_bytes.
+    size_t bytes;
+    // Bytes allocated but not holding values: string capacity beyond the
+    // size, repeated field capacity beyond the size, and cleared elements kept
+    // for reuse. For arenas, the part of the blocks not yet handed out.
+    size_t slack_bytes;
+    // Number of messages for a type or the root. For fields, the number of
+    // values of repeated and map fields and 1 for singular fields.
+    int64 count;
+  };
+
+  SpaceUsedReport();
+  ~SpaceUsedReport();
+
+  // Only walks the first "max_sampled_elements" elements of each repeated
+  // message field, and extrapolates the usage of the others from them. 0 (the
+  // default) walks all of them. The usage of a large message can then be
+  // estimated in time independent of its size.
+  void set_max_sampled_elements(int max_sampled_elements) {
+    max_sampled_elements_ = max_sampled_elements;
+  }
+
+  // Adds the memory used by "message" and everything it owns.
+  void AddMessage(const Message& message);
+
+  // Adds the blocks of "arena". The messages on the arena are attributed to
+  // fields by AddMessage() as for heap allocated messages; this records what
+  // the arena allocated in total and how much of it is still unused.
+  void AddArena(const Arena& arena);
+
+  // Usage of all the messages added.
+  const Usage& total() const { return total_; }
+  // Usage of all the arenas added.
+  const Usage& arena_usage() const { return arena_usage_; }
+  const std::map<std::string, Usage>& field_usage() const {
+    return field_usage_;
+  }
+  // Keyed by the full name of the message type.
+  const std::map<std::string, Usage>& type_usage() const {
+    return type_usage_;
+  }
+
+  // Returns a table of the usage by type and by field path, largest first.
+  std::string DebugString() const;
+
+ private:
+  // Records the usage of "message" and returns it including its sub-messages.
+  // Everything recorded is multiplied by "weight", which is larger than 1 for
+  // elements standing in for others that were not sampled.
+  Usage AddMessageTree(const Message& message, const std::string& path,
+                       double weight);
+  // Records the usage of one field of "message" and returns it including its
+  // sub-messages. The memory of the field that is not in sub-messages is also
+  // added to "own".
+  Usage AddField(const Message& message, const FieldDescriptor* field,
+                 const std::string& path, double weight, Usage* own);
+
+  struct TypeInfo {
+    const Message* prototype;
+    // sizeof() the message class, measured on the prototype.
+    size_t object_size;
+    // The fields which can own memory outside the object: repeated, string
+    // and message fields. Messages with few of them are walked in time
+    // independent of their number of fields.
+    std::vector<const FieldDescriptor*> owning_fields;
+  };
+  const TypeInfo& GetTypeInfo(const Descriptor* descriptor,
+                              const Reflection* reflection);
+
+  int max_sampled_elements_;
+  Usage total_;
+  Usage arena_usage_;
+  std::map<std::string, Usage> field_usage_;
+  std::map<std::string, Usage> type_usage_;
+  std::unordered_map<const Descriptor*, TypeInfo> type_infos_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(SpaceUsedReport);
+};
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_UTIL_SPACE_USED_REPORT_H__
@@ -0,0 +1,211 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/space_used_report.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <google/protobuf/map_unittest.pb.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/test_util.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace {
+
+using protobuf_unittest::TestAllExtensions;
+using protobuf_unittest::TestAllTypes;
+using protobuf_unittest::TestMap;
+
+size_t SumOfTypeUsage(const SpaceUsedReport& report) {
+  size_t bytes = 0;
+  for (std::map<std::string, SpaceUsedReport::Usage>::const_iterator it =
+           report.type_usage().begin();
+       it != report.type_usage().end(); ++it) {
+    bytes += it->second.bytes;
+  }
+  return bytes;
+}
+
+TEST(SpaceUsedReportTest, TotalMatchesSpaceUsedLong) {
+  TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  message.mutable_unknown_fields()->AddVarint(123456, 1);
+
+  SpaceUsedReport report;
+  report.AddMessage(message);
+  EXPECT_EQ(message.SpaceUsedLong(), report.total().bytes);
+  EXPECT_EQ(1, report.total().count);
+  EXPECT_EQ(report.total().bytes, SumOfTypeUsage(report));
+  EXPECT_EQ(1, report.type_usage().at("protobuf_unittest.TestAllTypes").count);
+
+  // The same holds for a dynamic message.
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> dynamic_message(
+      factory.GetPrototype(TestAllTypes::descriptor())->New());
+  dynamic_message->ParseFromString(message.SerializeAsString());
+  SpaceUsedReport dynamic_report;
+  dynamic_report.AddMessage(*dynamic_message);
+  EXPECT_EQ(dynamic_message->SpaceUsedLong(), dynamic_report.total().bytes);
+}
+
+TEST(SpaceUsedReportTest, FieldPaths) {
+  TestAllTypes message;
+  message.mutable_optional_nested_message()->set_bb(1);
+  message.add_repeated_nested_message()->set_bb(2);
+  message.add_repeated_nested_message()->set_bb(3);
+  message.set_optional_int32(4);
+
+  SpaceUsedReport report;
+  report.AddMessage(message);
+  const std::map<std::string, SpaceUsedReport::Usage>& fields =
+      report.field_usage();
+  ASSERT_EQ(1, fields.count("optional_nested_message"));
+  EXPECT_EQ(message.optional_nested_message().SpaceUsedLong(),
+            fields.at("optional_nested_message").bytes);
+  ASSERT_EQ(1, fields.count("repeated_nested_message"));
+  EXPECT_EQ(2, fields.at("repeated_nested_message").count);
+  EXPECT_LT(message.repeated_nested_message(0).SpaceUsedLong() * 2,
+            fields.at("repeated_nested_message").bytes);
+  // Scalars are stored in the message itself.
+  EXPECT_EQ(0, fields.count("optional_int32"));
+  EXPECT_EQ(0, fields.count("repeated_int32"));
+}
+
+TEST(SpaceUsedReportTest, Slack) {
+  TestAllTypes message;
+  message.mutable_repeated_int32()->Reserve(100);
+  message.add_repeated_int32(1);
+  message.mutable_optional_string()->reserve(1000);
+  message.set_optional_string("abc");
+
+  SpaceUsedReport report;
+  report.AddMessage(message);
+  const SpaceUsedReport::Usage& repeated =
+      report.field_usage().at("repeated_int32");
+  EXPECT_EQ(1, repeated.count);
+  EXPECT_EQ((message.repeated_int32().Capacity() - 1) * sizeof(int32),
+            repeated.slack_bytes);
+  const SpaceUsedReport::Usage& string = report.field_usage().at(
+      "optional_string");
+  EXPECT_EQ(message.optional_string().capacity() - 3, string.slack_bytes);
+  EXPECT_EQ(repeated.slack_bytes + string.slack_bytes,
+            report.total().slack_bytes);
+}
+
+TEST(SpaceUsedReportTest, SampledElements) {
+  TestAllTypes message;
+  for (int i = 0; i < 100; i++) {
+    message.add_repeated_nested_message()->set_bb(i);
+  }
+
+  SpaceUsedReport report;
+  report.AddMessage(message);
+  SpaceUsedReport sampled_report;
+  sampled_report.set_max_sampled_elements(10);
+  sampled_report.AddMessage(message);
+
+  // All the elements have the same size, so the estimate is exact.
+  EXPECT_EQ(report.total().bytes, sampled_report.total().bytes);
+  EXPECT_EQ(100, sampled_report.field_usage()
+                     .at("repeated_nested_message")
+                     .count);
+  EXPECT_EQ(100, sampled_report.type_usage()
+                     .at("protobuf_unittest.TestAllTypes.NestedMessage")
+                     .count);
+}
+
+TEST(SpaceUsedReportTest, MapsAndExtensions) {
+  TestMap map_message;
+  (*map_message.mutable_map_int32_int32())[1] = 2;
+  (*map_message.mutable_map_int32_int32())[3] = 4;
+  SpaceUsedReport report;
+  report.AddMessage(map_message);
+  EXPECT_EQ(2, report.field_usage().at("map_int32_int32").count);
+  EXPECT_EQ(map_message.SpaceUsedLong(), report.total().bytes);
+
+  TestAllExtensions extensions;
+  TestUtil::SetAllExtensions(&extensions);
+  SpaceUsedReport extension_report;
+  extension_report.AddMessage(extensions);
+  EXPECT_EQ(1, extension_report.field_usage().count(
+                   "(protobuf_unittest.optional_nested_message_extension)"));
+  EXPECT_EQ(2, extension_report.field_usage()
+                   .at("(protobuf_unittest.repeated_string_extension)")
+                   .count);
+  EXPECT_EQ(extensions.SpaceUsedLong(), extension_report.total().bytes);
+  EXPECT_EQ(extension_report.total().bytes, SumOfTypeUsage(extension_report));
+
+  // Cleared extensions keep their memory.
+  extensions.ClearExtension(protobuf_unittest::repeated_int32_extension);
+  extensions.ClearExtension(protobuf_unittest::optional_string_extension);
+  SpaceUsedReport cleared_report;
+  cleared_report.AddMessage(extensions);
+  EXPECT_EQ(0, cleared_report.field_usage().count(
+                   "(protobuf_unittest.repeated_int32_extension)"));
+  EXPECT_EQ(extensions.SpaceUsedLong(), cleared_report.total().bytes);
+}
+
+TEST(SpaceUsedReportTest, Arena) {
+  Arena arena;
+  TestAllTypes* message = Arena::CreateMessage<TestAllTypes>(&arena);
+  TestUtil::SetAllFields(message);
+
+  SpaceUsedReport report;
+  report.AddMessage(*message);
+  report.AddArena(arena);
+  EXPECT_EQ(arena.SpaceAllocated(), report.arena_usage().bytes);
+  EXPECT_EQ(arena.SpaceAllocated() - arena.SpaceUsed(),
+            report.arena_usage().slack_bytes);
+  EXPECT_EQ(1, report.arena_usage().count);
+  EXPECT_NE(std::string::npos, report.DebugString().find("arenas:"));
+}
+
+TEST(SpaceUsedReportTest, DebugString) {
+  TestAllTypes message;
+  message.set_optional_string(std::string(100, 'x'));
+
+  SpaceUsedReport report;
+  report.AddMessage(message);
+  const std::string output = report.DebugString();
+  EXPECT_NE(std::string::npos, output.find("protobuf_unittest.TestAllTypes\n"));
+  EXPECT_NE(std::string::npos, output.find("optional_string\n"));
+}
+
+}  // namespace
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
@@ -34,6 +34,7 @@
 
 #include <stack>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <google/protobuf/wire_format.h>
@@ -820,24 +821,41 @@ static void SerializeMapValueRefWithCachedSizes(const FieldDescriptor* field,
 
 class MapKeySorter {
  public:
-  static std::vector<MapKey> SortKey(const Message& message,
-                                     const Reflection* reflection,
-                                     const FieldDescriptor* field) {
-    std::vector<MapKey> sorted_key_list;
+  typedef std::pair<MapKey, MapValueRef> Entry;
+
+  // Copies the entries of the map to "entries" and returns pointers to them
+  // sorted by key. Only the pointers are sorted, as moving MapKeys around
+  // would copy them. The values are read through the iterator, so unlike
+  // InsertOrLookupMapValue() this does not mark the map as modified and a
+  // synchronized repeated field stays valid.
+  static std::vector<const Entry*> SortEntries(const Message& message,
+                                               const Reflection* reflection,
+                                               const FieldDescriptor* field,
+                                               std::vector<Entry>* entries) {
+    entries->reserve(reflection->MapSize(message, field));
     for (MapIterator it =
              reflection->MapBegin(const_cast<Message*>(&message), field);
          it != reflection->MapEnd(const_cast<Message*>(&message), field);
          ++it) {
-      sorted_key_list.push_back(it.GetKey());
+      entries->push_back(Entry(it.GetKey(), it.GetValueRef()));
+    }
+    std::vector<const Entry*> sorted_entry_list;
+    sorted_entry_list.reserve(entries->size());
+    for (int i = 0; i < entries->size(); i++) {
+      sorted_entry_list.push_back(&(*entries)[i]);
     }
     MapKeyComparator comparator;
-    std::sort(sorted_key_list.begin(), sorted_key_list.end(), comparator);
-    return sorted_key_list;
+    std::sort(sorted_entry_list.begin(), sorted_entry_list.end(), comparator);
+    return sorted_entry_list;
   }
 
  private:
   class MapKeyComparator {
    public:
+    bool operator()(const Entry* a, const Entry* b) const {
+      return (*this)(a->first, b->first);
+    }
+
     bool operator()(const MapKey& a, const MapKey& b) const {
       GOOGLE_DCHECK(a.type() == b.type());
       switch (a.type()) {
@@ -910,14 +928,13 @@ void WireFormat::SerializeFieldWithCachedSizes(
         message_reflection->GetMapData(message, field);
     if (map_field->IsMapValid()) {
       if (output->IsSerializationDeterministic()) {
-        std::vector<MapKey> sorted_key_list =
-            MapKeySorter::SortKey(message, message_reflection, field);
-        for (std::vector<MapKey>::iterator it = sorted_key_list.begin();
-             it != sorted_key_list.end(); ++it) {
-          MapValueRef map_value;
-          message_reflection->InsertOrLookupMapValue(
-              const_cast<Message*>(&message), field, *it, &map_value);
-          SerializeMapEntry(field, *it, map_value, output);
+        std::vector<MapKeySorter::Entry> entries;
+        std::vector<const MapKeySorter::Entry*> sorted_entry_list =
+            MapKeySorter::SortEntries(message, message_reflection, field,
+                                      &entries);
+        for (int i = 0; i < sorted_entry_list.size(); i++) {
+          SerializeMapEntry(field, sorted_entry_list[i]->first,
+                            sorted_entry_list[i]->second, output);
         }
       } else {
         for (MapIterator it = message_reflection->MapBegin(